@@ -25,6 +25,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "sysdeps.h"
 #include "cpu_emulation.h"
@@ -33,6 +34,10 @@
 #include "prefs.h"
 #include "video.h"
 #include "adb.h"
+#include "timer.h"
+#include "savestate.h"
+#include "perf_registry.h"
+#include "power.h"
 
 #ifdef POWERPC_ROM
 #include "thunks.h"
@@ -42,13 +47,50 @@
 #include "esp_attr.h"  // For DRAM_ATTR
 #endif
 
+#if INPUT_REPLAY
+#include <stdio.h>
+#include "console.h"
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#endif
+#endif
+
 #define DEBUG 0
 #include "debug.h"
 
 
-// Global variables
+// Input event queue
+// The input task posts key, button and mouse events into a single-producer/
+// single-consumer ring that ADBInterrupt() drains on the CPU task, so the two
+// sides share nothing but the ring indices. Everything below the queue is
+// owned by the CPU task.
+enum {
+	EVENT_KEY_DOWN,			// code = Mac key code
+	EVENT_KEY_UP,
+	EVENT_BUTTON_DOWN,		// code = button
+	EVENT_BUTTON_UP,
+	EVENT_MOVE,				// x/y absolute or relative, depending on the mouse mode
+	EVENT_MOUSE_MODE		// code = 1 for relative mouse mode
+};
+
+struct adb_event {
+	uint8 type;
+	uint8 code;
+	int16 x, y;
+	uint32 time;			// GetTicks_usec() when posted
+};
+
+const uint32 EVENT_QUEUE_SIZE = 128;	// Power of two
+DRAM_ATTR static adb_event event_queue[EVENT_QUEUE_SIZE];
+static uint32 event_head = 0;			// Written by the input task only
+static uint32 event_tail = 0;			// Written by ADBInterrupt() only
+
+// Producer state (input task)
+static bool post_relative = false;		// Mouse mode of the posted events
+static int carry_x = 0, carry_y = 0;	// Relative motion not posted yet (queue full)
+
 // Mouse and keyboard state - in internal SRAM for fast access during ADB interrupt
-DRAM_ATTR static int mouse_x = 0, mouse_y = 0;							// Mouse position
+DRAM_ATTR static int mouse_x = 0, mouse_y = 0;							// Mouse position, or motion to send
 static int old_mouse_x = 0, old_mouse_y = 0;
 static bool mouse_button[3] = {false, false, false};			// Mouse button states
 static bool old_mouse_button[3] = {false, false, false};
@@ -58,15 +100,66 @@ static bool relative_mouse = false;
 DRAM_ATTR static uint8 key_states[16];				// Key states (Mac keycodes)
 #define MATRIX(code) (key_states[code >> 3] & (1 << (~code & 7)))
 
-// Keyboard event buffer (Mac keycodes with up/down flag)
-const int KEY_BUFFER_SIZE = 16;
-DRAM_ATTR static uint8 key_buffer[KEY_BUFFER_SIZE];
-static unsigned int key_read_ptr = 0, key_write_ptr = 0;
+// Absolute position written to the low memory globals but not yet picked up
+// by the cursor VBL task (see position_settled())
+static bool position_new = false;
+static uint32 position_ticks = 0;		// Ticks when it was written
+
+// Posting time of the oldest motion not handed to the Mac yet
+static bool motion_pending = false;
+static uint32 motion_time = 0;
+
+// Events posted and dropped with the queue full (input task)
+static perf_counter *const perf_events = PerfCounter("input.events", PERF_COUNT, PERF_CORE_IO);
+static perf_counter *const perf_dropped = PerfCounter("input.dropped", PERF_COUNT, PERF_CORE_IO);
+
+// ADB interrupts taken (CPU task)
+static perf_counter *const perf_interrupts = PerfCounter("input.interrupts", PERF_COUNT, PERF_CORE_CPU);
+
+#if INPUT_TELEMETRY
+// Registry histograms, written by the CPU task
+static perf_histogram *const latency[ADB_LATENCY_COUNT] = {
+	PerfHistogram("input.move_us", PERF_CORE_CPU),
+	PerfHistogram("input.button_us", PERF_CORE_CPU),
+	PerfHistogram("input.key_us", PERF_CORE_CPU)
+};
+#endif
 
-// O2S: Button event buffer (Mac button with up/down flag) -> avoid to loose tap on a trackpad
-const int BUTTON_BUFFER_SIZE = 32;
-DRAM_ATTR static uint8 button_buffer[BUTTON_BUFFER_SIZE];
-static unsigned int button_read_ptr = 0, button_write_ptr = 0;
+#if INPUT_REPLAY
+// Input recording and replay (CPU task). The events ADBInterrupt() hands to
+// the Mac are recorded with the Mac's tick count (Ticks, the VBL count)
+// since the start and written to INPUT_REPLAY_FILE as text. A replay hands
+// them to the Mac at the same tick counts in place of the queue, whose live
+// events are dropped meanwhile, so a benchmark run gets the same input at
+// the same points of emulated time.
+#ifdef ARDUINO
+#define INPUT_REPLAY_FILE "/sd/input.rec"
+#else
+#define INPUT_REPLAY_FILE "input.rec"
+#endif
+const uint32 REPLAY_EVENTS = 16384;		// 192 KB of PSRAM, allocated on first use
+
+struct replay_event {
+	uint32 ticks;			// Ticks since the start
+	uint8 type;
+	uint8 code;
+	int16 x, y;
+};
+
+static replay_event *replay_events = NULL;	// Recording, or the replay loaded
+static uint32 replay_count = 0;
+static uint32 replay_pos = 0;			// Next event to replay
+static uint32 replay_start = 0;			// Ticks at the start
+static bool recording = false;
+static volatile bool replaying = false;		// Also read by ADBPending()
+static volatile uint32 replay_next = 0;	// Ticks when the next event is due
+
+static perf_counter *const perf_recorded = PerfCounter("input.recorded", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_replayed = PerfCounter("input.replayed", PERF_COUNT, PERF_CORE_CPU);
+
+static bool replay_start_at(uint32 ticks);
+static void record_start_at(uint32 ticks);
+#endif
 
 static uint8 mouse_reg_3[2] = {0x63, 0x01};	// Mouse ADB register 3
 
@@ -75,9 +168,6 @@ static uint8 key_reg_3[2] = {0x62, 0x05};	// Keyboard ADB register 3
 
 static uint8 m_keyboard_type = 0x05;
 
-// ADB mouse motion lock (for platforms that use separate input thread)
-static B2_mutex *mouse_lock;
-
 
 /*
  *  Initialize ADB emulation
@@ -85,9 +175,16 @@ static B2_mutex *mouse_lock;
 
 void ADBInit(void)
 {
-	mouse_lock = B2_create_mutex();
 	m_keyboard_type = (uint8)PrefsFindInt32("keyboardtype");
 	key_reg_3[1] = m_keyboard_type;
+
+#if INPUT_REPLAY
+	// From boot: tick 0 is the start
+	if (PrefsFindBool("inputreplay"))
+		replay_start_at(0);
+	else if (PrefsFindBool("inputrecord"))
+		record_start_at(0);
+#endif
 }
 
 
@@ -97,11 +194,33 @@ void ADBInit(void)
 
 void ADBExit(void)
 {
-	if (mouse_lock) {
-		B2_delete_mutex(mouse_lock);
-		mouse_lock = NULL;
-	}
+#if INPUT_REPLAY
+	if (recording)
+		ADBRecordStop();
+#endif
+}
+
+
+#if SAVE_STATE
+/*
+ *  Device registers and mouse position for hibernate/resume (keys and
+ *  buttons start up released, queued events are dropped)
+ */
+
+void ADBStateIO(savestate *s)
+{
+	savestate_var(s, mouse_x);
+	savestate_var(s, mouse_y);
+	savestate_var(s, old_mouse_x);
+	savestate_var(s, old_mouse_y);
+	savestate_var(s, old_mouse_button);
+	savestate_var(s, relative_mouse);
+	post_relative = relative_mouse;
+	savestate_var(s, mouse_reg_3);
+	savestate_var(s, key_reg_2);
+	savestate_var(s, key_reg_3);
 }
+#endif
 
 
 /*
@@ -239,20 +358,56 @@ void ADBOp(uint8 op, uint8 *data)
 
 
 /*
- *  Mouse was moved (x/y are absolute or relative, depending on ADBSetRelMouseMode())
+ *  Post an event for ADBInterrupt() (input task only), false if the queue is full
  */
 
-void ADBMouseMoved(int x, int y)
+static bool post_event(uint8 type, uint8 code, int x = 0, int y = 0)
 {
-	B2_lock_mutex(mouse_lock);
-	if (relative_mouse) {
-		mouse_x += x; mouse_y += y;
-	} else {
-		mouse_x = x; mouse_y = y;
+	uint32 head = event_head;
+	if (head - __atomic_load_n(&event_tail, __ATOMIC_ACQUIRE) >= EVENT_QUEUE_SIZE) {
+		perf_inc(perf_dropped);
+		return false;
 	}
-	B2_unlock_mutex(mouse_lock);
+	adb_event &e = event_queue[head & (EVENT_QUEUE_SIZE - 1)];
+	e.type = type;
+	e.code = code;
+	e.x = x;
+	e.y = y;
+	e.time = (uint32)GetTicks_usec();
+	__atomic_store_n(&event_head, head + 1, __ATOMIC_RELEASE);
+	perf_inc(perf_events);
+	PowerWake();
 	SetInterruptFlag(INTFLAG_ADB);
 	TriggerInterrupt();
+	return true;
+}
+
+// Relative motion is never dropped: what does not fit goes out with the next event
+static void post_motion(void)
+{
+	while (carry_x != 0 || carry_y != 0) {
+		int dx = carry_x < -32768 ? -32768 : (carry_x > 32767 ? 32767 : carry_x);
+		int dy = carry_y < -32768 ? -32768 : (carry_y > 32767 ? 32767 : carry_y);
+		if (!post_event(EVENT_MOVE, 0, dx, dy))
+			return;
+		carry_x -= dx;
+		carry_y -= dy;
+	}
+}
+
+
+/*
+ *  Mouse was moved (x/y are absolute or relative, depending on ADBSetRelMouseMode())
+ */
+
+void ADBMouseMoved(int x, int y)
+{
+	if (post_relative) {
+		carry_x += x;
+		carry_y += y;
+		post_motion();
+	} else
+		post_event(EVENT_MOVE, 0, x, y);
 }
 
 
@@ -262,13 +417,8 @@ void ADBMouseMoved(int x, int y)
 
 void ADBMouseDown(int button)
 {
-    // O2S: Add button to buffer
-    button_buffer[button_write_ptr] = button;
-    button_write_ptr = (button_write_ptr + 1) % BUTTON_BUFFER_SIZE;
-
-    // O2S: mouse_button[button] = true;
-	SetInterruptFlag(INTFLAG_ADB);
-	TriggerInterrupt();
+	post_motion();
+	post_event(EVENT_BUTTON_DOWN, button);
 }
 
 
@@ -278,13 +428,8 @@ void ADBMouseDown(int button)
 
 void ADBMouseUp(int button)
 {
-    // O2S: Add button to buffer
-    button_buffer[button_write_ptr] = button | 0x80;
-    button_write_ptr = (button_write_ptr + 1) % BUTTON_BUFFER_SIZE;
-
-    // O2S: mouse_button[button] = false;
-	SetInterruptFlag(INTFLAG_ADB);
-	TriggerInterrupt();
+	post_motion();
+	post_event(EVENT_BUTTON_UP, button);
 }
 
 
@@ -294,10 +439,11 @@ void ADBMouseUp(int button)
 
 void ADBSetRelMouseMode(bool relative)
 {
-	if (relative_mouse != relative) {
-		relative_mouse = relative;
-		mouse_x = mouse_y = 0;
-    }
+	// Retried by the next call if the queue is full
+	if (post_relative != relative && post_event(EVENT_MOUSE_MODE, relative)) {
+		post_relative = relative;
+		carry_x = carry_y = 0;
+	}
 }
 
 
@@ -307,16 +453,7 @@ void ADBSetRelMouseMode(bool relative)
 
 void ADBKeyDown(int code)
 {
-	// Add keycode to buffer
-	key_buffer[key_write_ptr] = code;
-	key_write_ptr = (key_write_ptr + 1) % KEY_BUFFER_SIZE;
-
-	// Set key in matrix
-	key_states[code >> 3] |= (1 << (~code & 7));
-
-	// Trigger interrupt
-	SetInterruptFlag(INTFLAG_ADB);
-	TriggerInterrupt();
+	post_event(EVENT_KEY_DOWN, code);
 }
 
 
@@ -326,16 +463,7 @@ void ADBKeyDown(int code)
 
 void ADBKeyUp(int code)
 {
-	// Add keycode to buffer
-	key_buffer[key_write_ptr] = code | 0x80;	// Key-up flag
-	key_write_ptr = (key_write_ptr + 1) % KEY_BUFFER_SIZE;
-
-	// Clear key in matrix
-	key_states[code >> 3] &= ~(1 << (~code & 7));
-
-	// Trigger interrupt
-	SetInterruptFlag(INTFLAG_ADB);
-	TriggerInterrupt();
+	post_event(EVENT_KEY_UP, code);
 }
 
 
@@ -356,7 +484,8 @@ uint8 ADBGetKeyboardLEDs(void)
 	// Bit 6: Scroll Lock LED (0 = on)
 	// Mac ADB typically uses bit 2 of key_reg_2[1] for Caps Lock LED
 	
-	// Also check the key matrix for current key state as fallback
+	// Also check the key matrix for current key state as fallback (it is
+	// updated by ADBInterrupt(), a stale byte only delays the LED a poll)
 	// Mac keycode 0x39 is Caps Lock
 	if (MATRIX(0x39)) {
 		leds |= 0x02;  // Caps Lock (USB HID bit 1)
@@ -377,168 +506,434 @@ uint8 ADBGetKeyboardLEDs(void)
 
 
 /*
- *  ADB interrupt function (executed as part of 60Hz interrupt)
+ *  Input latency accounting (CPU task). Motion, presses and key downs are
+ *  also timed to the screen showing the Mac's response (see video_esp32.cpp);
+ *  releases rarely draw anything.
  */
 
-void ADBInterrupt(void)
+static inline void record_latency(int which, uint32 posted, bool photon)
 {
-	M68kRegisters r;
+#if INPUT_TELEMETRY
+	perf_record(latency[which], (uint32)GetTicks_usec() - posted);
+	if (photon)
+		VideoPhotonArm(which, posted);
+#else
+	UNUSED(which);
+	UNUSED(posted);
+	UNUSED(photon);
+#endif
+}
 
-	// Return if ADB is not initialized
-	uint32 adb_base = ReadMacInt32(0xcf8);
-	if (!adb_base || adb_base == 0xffffffff)
-		return;
-	uint32 tmp_data = adb_base + 0x163;	// Temporary storage for faked ADB data
+#if INPUT_TELEMETRY
+const telemetry_histogram *ADBLatency(int which)
+{
+	return &latency[which]->h;
+}
+
+// Cleared by the CPU task on its next record
+void ADBLatencyReset(void)
+{
+	for (int i = 0; i < ADB_LATENCY_COUNT; i++)
+		latency[i]->reset = true;
+}
+#endif
 
-	// Get mouse state
-	B2_lock_mutex(mouse_lock);
-	int mx = mouse_x;
-	int my = mouse_y;
-	if (relative_mouse)
-		mouse_x = mouse_y = 0;
-	B2_unlock_mutex(mouse_lock);
 
-	uint32 key_base = adb_base + 4;
+/*
+ *  Send a Talk 0 packet from the mouse (relative motion, -64..63) to the ADB handler
+ */
+
+static void mouse_talk(uint32 adb_base, uint32 tmp_data, int dx, int dy)
+{
+	M68kRegisters r;
 	uint32 mouse_base = adb_base + 16;
 
+	if (mouse_reg_3[1] == 4) {
+		// Extended mouse protocol
+		WriteMacInt8(tmp_data, 3);
+		WriteMacInt8(tmp_data + 1, (dy & 0x7f) | (mouse_button[0] ? 0 : 0x80));
+		WriteMacInt8(tmp_data + 2, (dx & 0x7f) | (mouse_button[1] ? 0 : 0x80));
+		WriteMacInt8(tmp_data + 3, ((dy >> 3) & 0x70) | ((dx >> 7) & 0x07) | (mouse_button[2] ? 0x08 : 0x88));
+	} else {
+		// 100/200 dpi mode
+		WriteMacInt8(tmp_data, 2);
+		WriteMacInt8(tmp_data + 1, (dy & 0x7f) | (mouse_button[0] ? 0 : 0x80));
+		WriteMacInt8(tmp_data + 2, (dx & 0x7f) | (mouse_button[1] ? 0 : 0x80));
+	}
+	r.a[0] = tmp_data;
+	r.a[1] = ReadMacInt32(mouse_base);
+	r.a[2] = ReadMacInt32(mouse_base + 4);
+	r.a[3] = adb_base;
+	r.d[0] = (mouse_reg_3[0] << 4) | 0x0c;	// Talk 0
+	Execute68k(r.a[1], &r);
+
+	old_mouse_button[0] = mouse_button[0];
+	old_mouse_button[1] = mouse_button[1];
+	old_mouse_button[2] = mouse_button[2];
+}
+
+
+/*
+ *  Hand the collected mouse motion or position to the Mac
+ */
+
+static void mouse_update(uint32 adb_base, uint32 tmp_data)
+{
+	if (motion_pending) {
+		motion_pending = false;
+		record_latency(ADB_LATENCY_MOVE, motion_time, true);
+	}
+
 	if (relative_mouse) {
-        while (mx != 0 || my != 0 || button_read_ptr != button_write_ptr) {
-            if (button_read_ptr != button_write_ptr) {
-                // Read button event
-                uint8 button = button_buffer[button_read_ptr];
-                button_read_ptr = (button_read_ptr + 1) % BUTTON_BUFFER_SIZE;
-                mouse_button[button & 0x3] = (button & 0x80) ? false : true;
-            }
-            
-            // Clamp movement to signed 7-bit range (-64 to +63)
-            // This ensures we don't lose movement when accumulation exceeds one packet
-            int dx = mx;
-            int dy = my;
-            if (dx > 63) {
-                dx = 63;
-            } else if (dx < -64) {
-                dx = -64;
-            }
-            if (dy > 63) {
-                dy = 63;
-            } else if (dy < -64) {
-                dy = -64;
-            }
-            
-            // Call mouse ADB handler with clamped values
-            if (mouse_reg_3[1] == 4) {
-                // Extended mouse protocol
-                WriteMacInt8(tmp_data, 3);
-                WriteMacInt8(tmp_data + 1, (dy & 0x7f) | (mouse_button[0] ? 0 : 0x80));
-                WriteMacInt8(tmp_data + 2, (dx & 0x7f) | (mouse_button[1] ? 0 : 0x80));
-                WriteMacInt8(tmp_data + 3, ((dy >> 3) & 0x70) | ((dx >> 7) & 0x07) | (mouse_button[2] ? 0x08 : 0x88));
-            } else {
-                // 100/200 dpi mode
-                WriteMacInt8(tmp_data, 2);
-                WriteMacInt8(tmp_data + 1, (dy & 0x7f) | (mouse_button[0] ? 0 : 0x80));
-                WriteMacInt8(tmp_data + 2, (dx & 0x7f) | (mouse_button[1] ? 0 : 0x80));
-            }
-            r.a[0] = tmp_data;
-            r.a[1] = ReadMacInt32(mouse_base);
-            r.a[2] = ReadMacInt32(mouse_base + 4);
-            r.a[3] = adb_base;
-            r.d[0] = (mouse_reg_3[0] << 4) | 0x0c;    // Talk 0
-            Execute68k(r.a[1], &r);
-
-            old_mouse_button[0] = mouse_button[0];
-            old_mouse_button[1] = mouse_button[1];
-            old_mouse_button[2] = mouse_button[2];
-            
-            // Subtract only what was sent, preserving remainder for next iteration
-            mx -= dx;
-            my -= dy;
-        }
 
-	} else {
+		// Split the motion into packets of the signed 7-bit range
+		while (mouse_x != 0 || mouse_y != 0) {
+			int dx = mouse_x > 63 ? 63 : (mouse_x < -64 ? -64 : mouse_x);
+			int dy = mouse_y > 63 ? 63 : (mouse_y < -64 ? -64 : mouse_y);
+			mouse_talk(adb_base, tmp_data, dx, dy);
+			mouse_x -= dx;
+			mouse_y -= dy;
+		}
+
+	} else if (mouse_x != old_mouse_x || mouse_y != old_mouse_y) {
 
 		// Update mouse position (absolute)
-		if (mx != old_mouse_x || my != old_mouse_y) {
 #ifdef POWERPC_ROM
-			static const uint8 proc_template[] = {
-				0x2f, 0x08,		// move.l a0,-(sp)
-				0x2f, 0x00,		// move.l d0,-(sp)
-				0x2f, 0x01,		// move.l d1,-(sp)
-				0x70, 0x01,		// moveq #1,d0 (MoveTo)
-				0xaa, 0xdb,		// CursorDeviceDispatch
-				M68K_RTS >> 8, M68K_RTS & 0xff
-			};
-			BUILD_SHEEPSHAVER_PROCEDURE(proc);
-			r.a[0] = ReadMacInt32(mouse_base + 4);
-			r.d[0] = mx;
-			r.d[1] = my;
-			Execute68k(proc, &r);
+		static const uint8 proc_template[] = {
+			0x2f, 0x08,		// move.l a0,-(sp)
+			0x2f, 0x00,		// move.l d0,-(sp)
+			0x2f, 0x01,		// move.l d1,-(sp)
+			0x70, 0x01,		// moveq #1,d0 (MoveTo)
+			0xaa, 0xdb,		// CursorDeviceDispatch
+			M68K_RTS >> 8, M68K_RTS & 0xff
+		};
+		BUILD_SHEEPSHAVER_PROCEDURE(proc);
+		M68kRegisters r;
+		r.a[0] = ReadMacInt32(adb_base + 16 + 4);
+		r.d[0] = mouse_x;
+		r.d[1] = mouse_y;
+		Execute68k(proc, &r);
+#else
+		WriteMacInt16(0x82a, mouse_x);
+		WriteMacInt16(0x828, mouse_y);
+		WriteMacInt16(0x82e, mouse_x);
+		WriteMacInt16(0x82c, mouse_y);
+		WriteMacInt8(0x8ce, ReadMacInt8(0x8cf));	// CrsrCouple -> CrsrNew
+		position_new = true;
+		position_ticks = ReadMacInt32(0x16a);
+#endif
+		old_mouse_x = mouse_x;
+		old_mouse_y = mouse_y;
+	}
+}
+
+
+/*
+ *  An absolute position only reaches Mouse (where clicks are reported) when
+ *  the cursor VBL task picks it up and clears CrsrNew. A button change must
+ *  wait for that or the click lands where the pointer was before. The VBL
+ *  tasks run after the interrupt handlers, so two ticks bound the wait.
+ */
+
+static bool position_settled(void)
+{
+	if (position_new && ReadMacInt8(0x8ce) != 0 && ReadMacInt32(0x16a) - position_ticks < 2)
+		return false;
+	position_new = false;
+	return true;
+}
+
+
+#if INPUT_REPLAY
+/*
+ *  Input recording and replay (CPU task)
+ */
+
+static bool replay_alloc(void)
+{
+	if (replay_events == NULL) {
+#ifdef ARDUINO
+		replay_events = (replay_event *)heap_caps_malloc(REPLAY_EVENTS * sizeof(replay_event), MALLOC_CAP_SPIRAM);
 #else
-			WriteMacInt16(0x82a, mx);
-			WriteMacInt16(0x828, my);
-			WriteMacInt16(0x82e, mx);
-			WriteMacInt16(0x82c, my);
-			WriteMacInt8(0x8ce, ReadMacInt8(0x8cf));	// CrsrCouple -> CrsrNew
+		replay_events = (replay_event *)malloc(REPLAY_EVENTS * sizeof(replay_event));
 #endif
-			old_mouse_x = mx;
-			old_mouse_y = my;
+		if (replay_events == NULL) {
+			write_log("[INPUT] Cannot allocate %d KB for input recording\n", (int)(REPLAY_EVENTS * sizeof(replay_event) / 1024));
+			return false;
 		}
+	}
+	return true;
+}
+
+static void record_start_at(uint32 ticks)
+{
+	if (replaying) {
+		write_log("[INPUT] Replaying, not recording\n");
+		return;
+	}
+	if (!replay_alloc())
+		return;
+
+	// The mouse mode comes first, for a replay that starts in the other one
+	replay_events[0].ticks = 0;
+	replay_events[0].type = EVENT_MOUSE_MODE;
+	replay_events[0].code = relative_mouse;
+	replay_events[0].x = replay_events[0].y = 0;
+	replay_count = 1;
+	replay_start = ticks;
+	recording = true;
+	write_log("[INPUT] Recording input events\n");
+}
 
-        // O2S: Process accumulated button events
-        while (button_read_ptr != button_write_ptr) {
-            // Read button event
-            uint8 button = button_buffer[button_read_ptr];
-            button_read_ptr = (button_read_ptr + 1) % BUTTON_BUFFER_SIZE;
-            mouse_button[button & 0x3] = (button & 0x80) ? false : true;
-
-            if (mouse_button[0] != old_mouse_button[0] || mouse_button[1] != old_mouse_button[1] || mouse_button[2] != old_mouse_button[2]) {
-                uint32 mouse_base = adb_base + 16;
-
-                // Call mouse ADB handler
-                if (mouse_reg_3[1] == 4) {
-                    // Extended mouse protocol
-                    WriteMacInt8(tmp_data, 3);
-                    WriteMacInt8(tmp_data + 1, mouse_button[0] ? 0 : 0x80);
-                    WriteMacInt8(tmp_data + 2, mouse_button[1] ? 0 : 0x80);
-                    WriteMacInt8(tmp_data + 3, mouse_button[2] ? 0x08 : 0x88);
-                } else {
-                    // 100/200 dpi mode
-                    WriteMacInt8(tmp_data, 2);
-                    WriteMacInt8(tmp_data + 1, mouse_button[0] ? 0 : 0x80);
-                    WriteMacInt8(tmp_data + 2, mouse_button[1] ? 0 : 0x80);
-                }
-                r.a[0] = tmp_data;
-                r.a[1] = ReadMacInt32(mouse_base);
-                r.a[2] = ReadMacInt32(mouse_base + 4);
-                r.a[3] = adb_base;
-                r.d[0] = (mouse_reg_3[0] << 4) | 0x0c;    // Talk 0
-                Execute68k(r.a[1], &r);
-
-                old_mouse_button[0] = mouse_button[0];
-                old_mouse_button[1] = mouse_button[1];
-                old_mouse_button[2] = mouse_button[2];
-            }
-        }
+static void record_event(const adb_event &e)
+{
+	if (replay_count >= REPLAY_EVENTS) {
+		recording = false;
+		write_log("[INPUT] %u events recorded, recording stopped\n", replay_count);
+		return;
+	}
+	replay_event &r = replay_events[replay_count++];
+	r.ticks = ReadMacInt32(0x16a) - replay_start;
+	r.type = e.type;
+	r.code = e.code;
+	r.x = e.x;
+	r.y = e.y;
+	perf_inc(perf_recorded);
+}
+
+static bool replay_start_at(uint32 ticks)
+{
+	if (recording) {
+		write_log("[INPUT] Recording, write it out first\n");
+		return false;
+	}
+	if (!replay_alloc())
+		return false;
+	FILE *f = fopen(INPUT_REPLAY_FILE, "r");
+	if (f == NULL) {
+		write_log("[INPUT] Cannot open %s\n", INPUT_REPLAY_FILE);
+		return false;
+	}
+	replaying = false;
+	uint32 n = 0;
+	char line[80];
+	while (n < REPLAY_EVENTS && fgets(line, sizeof(line), f)) {
+		unsigned t, type, code;
+		int x, y;
+		if (line[0] == '#' || sscanf(line, "%u %u %u %d %d", &t, &type, &code, &x, &y) != 5 || type > EVENT_MOUSE_MODE)
+			continue;
+		replay_event &r = replay_events[n++];
+		r.ticks = t;
+		r.type = type;
+		r.code = code;
+		r.x = x;
+		r.y = y;
+	}
+	fclose(f);
+	if (n == 0) {
+		write_log("[INPUT] No events in %s\n", INPUT_REPLAY_FILE);
+		return false;
+	}
+	replay_count = n;
+	replay_pos = 0;
+	replay_start = ticks;
+	replay_next = ticks + replay_events[0].ticks;
+	replaying = true;
+	write_log("[INPUT] Replaying %u events over %u ticks from %s\n", n, replay_events[n - 1].ticks, INPUT_REPLAY_FILE);
+	return true;
+}
+
+void ADBRecordStart(void)
+{
+	record_start_at(ReadMacInt32(0x16a));
+}
 
+void ADBRecordStop(void)
+{
+	if (!recording) {
+		write_log("[INPUT] Not recording\n");
+		return;
+	}
+	recording = false;
+	FILE *f = fopen(INPUT_REPLAY_FILE, "w");
+	if (f == NULL) {
+		write_log("[INPUT] Cannot open %s\n", INPUT_REPLAY_FILE);
+		return;
 	}
+	fprintf(f, "# %u input events: ticks type code x y\n", replay_count);
+	for (uint32 i = 0; i < replay_count; i++) {
+		const replay_event &r = replay_events[i];
+		fprintf(f, "%u %u %u %d %d\n", r.ticks, r.type, r.code, r.x, r.y);
+	}
+	fclose(f);
+	write_log("[INPUT] Wrote %u events over %u ticks to %s\n", replay_count, replay_events[replay_count - 1].ticks, INPUT_REPLAY_FILE);
+}
 
-	// Process accumulated keyboard events
-	while (key_read_ptr != key_write_ptr) {
+void ADBReplayStart(void)
+{
+	replay_start_at(ReadMacInt32(0x16a));
+}
+#endif
 
-		// Read keyboard event
-		uint8 mac_code = key_buffer[key_read_ptr];
-		key_read_ptr = (key_read_ptr + 1) % KEY_BUFFER_SIZE;
 
-		// Call keyboard ADB handler
-		WriteMacInt8(tmp_data, 2);
-		WriteMacInt8(tmp_data + 1, mac_code);
-		WriteMacInt8(tmp_data + 2, mac_code == 0x7f ? 0x7f : 0xff);	// Power key is special
-		r.a[0] = tmp_data;
-		r.a[1] = ReadMacInt32(key_base);
-		r.a[2] = ReadMacInt32(key_base + 4);
-		r.a[3] = adb_base;
-		r.d[0] = (key_reg_3[0] << 4) | 0x0c;	// Talk 0
-		Execute68k(r.a[1], &r);
+/*
+ *  Next event for ADBInterrupt(): from the queue, or while a replay runs,
+ *  the next recorded one once its tick has come
+ */
+
+static bool peek_event(adb_event &e, uint32 head)
+{
+#if INPUT_REPLAY
+	if (replaying) {
+		if ((int32)(ReadMacInt32(0x16a) - replay_next) < 0)
+			return false;
+		const replay_event &r = replay_events[replay_pos];
+		e.type = r.type;
+		e.code = r.code;
+		e.x = r.x;
+		e.y = r.y;
+		e.time = (uint32)GetTicks_usec();
+		return true;
+	}
+#endif
+	if (event_tail == head)
+		return false;
+	e = event_queue[event_tail & (EVENT_QUEUE_SIZE - 1)];
+	return true;
+}
+
+static void take_event(const adb_event &e)
+{
+#if INPUT_REPLAY
+	if (replaying) {
+		perf_inc(perf_replayed);
+		if (++replay_pos < replay_count) {
+			replay_next = replay_start + replay_events[replay_pos].ticks;
+		} else {
+			replaying = false;
+			write_log("[INPUT] Replay done at tick %u\n", ReadMacInt32(0x16a) - replay_start);
+			ConsoleMark("replay");
+		}
+		return;
+	}
+	if (recording)
+		record_event(e);
+#else
+	UNUSED(e);
+#endif
+	__atomic_store_n(&event_tail, event_tail + 1, __ATOMIC_RELEASE);
+}
+
+
+/*
+ *  Events waiting for ADBInterrupt() (any task). The input task raises
+ *  INTFLAG_ADB with each event; the 60Hz tick raises it again while events
+ *  are left, e.g. a click waiting for the cursor or posted before the Mac
+ *  started, and when a replayed event is due.
+ */
+
+bool ADBPending(void)
+{
+#if INPUT_REPLAY
+	if (replaying && (int32)(ReadMacInt32(0x16a) - replay_next) >= 0)
+		return true;
+#endif
+	return __atomic_load_n(&event_head, __ATOMIC_ACQUIRE) != __atomic_load_n(&event_tail, __ATOMIC_ACQUIRE);
+}
+
+
+/*
+ *  ADB interrupt function (executed whenever the input task posts events,
+ *  and with the 60Hz interrupt while some are left)
+ */
+
+void ADBInterrupt(void)
+{
+	M68kRegisters r;
+
+	// Return if ADB is not initialized
+	uint32 adb_base = ReadMacInt32(0xcf8);
+	if (!adb_base || adb_base == 0xffffffff)
+		return;
+	uint32 tmp_data = adb_base + 0x163;	// Temporary storage for faked ADB data
+	uint32 key_base = adb_base + 4;
+	perf_inc(perf_interrupts);
+
+	// Drain the event queue in order. Motion is collected and only sent
+	// before a button or mode change and at the end, so the Mac sees the
+	// latest position once per interrupt and the pointer is where the input
+	// put it when a click arrives. A click waiting for the cursor to get
+	// there stays queued (with everything after it) for the next interrupt.
+	uint32 head = __atomic_load_n(&event_head, __ATOMIC_ACQUIRE);
+#if INPUT_REPLAY
+	if (replaying)
+		__atomic_store_n(&event_tail, head, __ATOMIC_RELEASE);	// Live input is dropped
+#endif
+	adb_event e;
+	while (peek_event(e, head)) {
+		if (e.type == EVENT_BUTTON_DOWN || e.type == EVENT_BUTTON_UP) {
+			mouse_update(adb_base, tmp_data);
+			if (!position_settled())
+				break;
+		}
+		take_event(e);
+
+		switch (e.type) {
+			case EVENT_MOVE:
+				if (!motion_pending) {
+					motion_pending = true;
+					motion_time = e.time;
+				}
+				if (relative_mouse) {
+					mouse_x += e.x;
+					mouse_y += e.y;
+				} else {
+					mouse_x = e.x;
+					mouse_y = e.y;
+				}
+				break;
+
+			case EVENT_BUTTON_DOWN:
+			case EVENT_BUTTON_UP:
+				mouse_button[e.code & 3] = (e.type == EVENT_BUTTON_DOWN);
+				if (mouse_button[0] != old_mouse_button[0] || mouse_button[1] != old_mouse_button[1] || mouse_button[2] != old_mouse_button[2])
+					mouse_talk(adb_base, tmp_data, 0, 0);
+				record_latency(ADB_LATENCY_BUTTON, e.time, e.type == EVENT_BUTTON_DOWN);
+				break;
+
+			case EVENT_MOUSE_MODE:
+				mouse_update(adb_base, tmp_data);
+				relative_mouse = (e.code != 0);
+				mouse_x = relative_mouse ? 0 : old_mouse_x;
+				mouse_y = relative_mouse ? 0 : old_mouse_y;
+				break;
+
+			case EVENT_KEY_DOWN:
+			case EVENT_KEY_UP: {
+				uint8 mac_code = e.code;
+				if (e.type == EVENT_KEY_DOWN) {
+					key_states[mac_code >> 3] |= (1 << (~mac_code & 7));
+				} else {
+					key_states[mac_code >> 3] &= ~(1 << (~mac_code & 7));
+					mac_code |= 0x80;	// Key-up flag
+				}
+
+				// Call keyboard ADB handler
+				WriteMacInt8(tmp_data, 2);
+				WriteMacInt8(tmp_data + 1, mac_code);
+				WriteMacInt8(tmp_data + 2, mac_code == 0x7f ? 0x7f : 0xff);	// Power key is special
+				r.a[0] = tmp_data;
+				r.a[1] = ReadMacInt32(key_base);
+				r.a[2] = ReadMacInt32(key_base + 4);
+				r.a[3] = adb_base;
+				r.d[0] = (key_reg_3[0] << 4) | 0x0c;	// Talk 0
+				Execute68k(r.a[1], &r);
+				record_latency(ADB_LATENCY_KEY, e.time, e.type == EVENT_KEY_DOWN);
+				break;
+			}
+		}
 	}
+	mouse_update(adb_base, tmp_data);
 
 	// Clear temporary data
 	WriteMacInt32(tmp_data, 0);
@@ -0,0 +1,211 @@
+/*
+ *  app_profile_esp32.cpp - Performance settings per Mac application
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  A game wants a short quantum and frequent frames, a number cruncher a
+ *  long quantum and the single precision FPU, a text editor short input
+ *  polls, and the boot profile is a compromise between them. The profiles
+ *  file can also hold "[app:Name]" sections of console tunables, which
+ *  apply while that application runs:
+ *
+ *    [app:SimCity 2000]
+ *    quantumus 1000
+ *    fastframems 16
+ *
+ *    [app:Mathematica]
+ *    quantumus 8000
+ *    fpufast 1
+ *
+ *  The service task reads CurApName, the name of the current application,
+ *  every APP_POLL_MS. The Process Manager also switches it to background
+ *  applications for their slices, so a new name counts once it has been
+ *  seen APP_STABLE_POLLS times in a row. Then the tunables the previous
+ *  application's section set get back the values they had before, and
+ *  those of the new application's section (names compared without case)
+ *  are set, clamped as by the console's "set":
+ *
+ *    [APP] SimCity 2000: quantumus 1000, fastframems 16
+ *    [APP] Finder: defaults
+ *
+ *  A "set" on the console of a value an application's section set lasts
+ *  until that application is left.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "boot_gui.h"
+#include "sdcard.h"
+#include "console.h"
+#include "app_profile.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+#if APP_PROFILES
+
+#define APP_PROFILES_MAX    16      // [app:] sections read
+#define APP_SETTINGS_MAX    8       // Tunables per section
+#define APP_POLL_MS         500     // CurApName checks
+#define APP_STABLE_POLLS    2       // Checks a new name must last
+
+// Low memory global
+#define CurApName           0x910   // Pascal string, 31 characters at most
+
+struct app_setting {
+    char name[16];
+    uint32 value;
+    uint32 saved;           // Value before, while applied
+};
+
+struct app_profile {
+    char app[32];
+    int num_settings;
+    app_setting settings[APP_SETTINGS_MAX];
+};
+
+static app_profile *profiles = NULL;    // In PSRAM, NULL: none in the file
+static int num_profiles = 0;
+
+// Service task
+static char current_app[32] = "";       // Application whose section applies
+static char candidate_app[32] = "";     // New name, and times seen in a row
+static int candidate_polls = 0;
+static app_profile *applied = NULL;
+static uint32 last_poll_ms = 0;
+
+
+/*
+ *  Profiles file
+ */
+
+void AppProfileInit(void)
+{
+    FILE *f = fopen(SD_MOUNT_POINT BOOT_GUI_PROFILES_FILE, "r");
+    if (f == NULL)
+        return;
+
+    app_profile *p = NULL;
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        int len = strlen(line);
+        while (len > 0 && isspace((unsigned char)line[len - 1]))
+            line[--len] = '\0';
+        if (len == 0 || line[0] == '#' || line[0] == ';')
+            continue;
+
+        // Section header, only the "[app:" ones are ours
+        if (line[0] == '[') {
+            p = NULL;
+            char *end = strchr(line, ']');
+            if (end == NULL || strncmp(line, "[app:", 5) != 0)
+                continue;
+            *end = '\0';
+            if (num_profiles == APP_PROFILES_MAX) {
+                Serial.printf("[APP] WARNING: No room for %s\n", line + 5);
+                continue;
+            }
+            if (profiles == NULL)
+                profiles = (app_profile *)ps_calloc(APP_PROFILES_MAX, sizeof(app_profile));
+            if (profiles == NULL)
+                break;
+            p = &profiles[num_profiles++];
+            strncpy(p->app, line + 5, sizeof(p->app) - 1);
+            continue;
+        }
+        if (p == NULL)
+            continue;
+
+        // "<tunable> <value>"
+        char name[16];
+        unsigned long value;
+        if (sscanf(line, "%15s %lu", name, &value) != 2) {
+            Serial.printf("[APP] WARNING: %s: bad line \"%s\"\n", p->app, line);
+        } else if (p->num_settings == APP_SETTINGS_MAX) {
+            Serial.printf("[APP] WARNING: %s: no room for %s\n", p->app, name);
+        } else {
+            app_setting *s = &p->settings[p->num_settings++];
+            strcpy(s->name, name);
+            s->value = value;
+        }
+    }
+    fclose(f);
+    if (num_profiles > 0)
+        Serial.printf("[APP] %d application profiles\n", num_profiles);
+}
+
+static app_profile *find_profile(const char *app)
+{
+    for (int i = 0; i < num_profiles; i++)
+        if (strcasecmp(profiles[i].app, app) == 0)
+            return &profiles[i];
+    return NULL;
+}
+
+
+/*
+ *  Switching
+ */
+
+static void apply(const char *app)
+{
+    // Back to the values from before the last section, in reverse order
+    if (applied) {
+        for (int i = applied->num_settings - 1; i >= 0; i--)
+            ConsoleSetTunable(applied->settings[i].name, applied->settings[i].saved, NULL);
+        applied = NULL;
+    }
+
+    app_profile *p = find_profile(app);
+    if (p == NULL) {
+        Serial.printf("[APP] %s: defaults\n", app);
+        return;
+    }
+    char log[160];
+    int n = snprintf(log, sizeof(log), "[APP] %s:", app);
+    for (int i = 0; i < p->num_settings; i++) {
+        app_setting *s = &p->settings[i];
+        bool ok = ConsoleSetTunable(s->name, s->value, &s->saved);
+        if (!ok)
+            s->saved = s->value;    // Restores nothing either
+        if (n < (int)sizeof(log))
+            n += snprintf(log + n, sizeof(log) - n, "%s %s %u%s", i ? "," : "", s->name, s->value,
+                          ok ? "" : " (unknown)");
+    }
+    applied = p;
+    Serial.println(log);
+}
+
+void AppProfilePoll(uint32 now_ms)
+{
+    if (num_profiles == 0 || now_ms - last_poll_ms < APP_POLL_MS)
+        return;
+    last_poll_ms = now_ms;
+
+    // CurApName of the application running now (empty before the Finder)
+    char app[32];
+    uint8 len = ReadMacInt8(CurApName);
+    if (len == 0 || len > 31)
+        return;
+    for (int i = 0; i < len; i++)
+        app[i] = ReadMacInt8(CurApName + 1 + i);
+    app[len] = '\0';
+
+    if (strcmp(app, current_app) == 0) {
+        candidate_polls = 0;
+        return;
+    }
+    if (strcmp(app, candidate_app) != 0) {
+        strcpy(candidate_app, app);
+        candidate_polls = 0;
+    }
+    if (++candidate_polls < APP_STABLE_POLLS)
+        return;
+    strcpy(current_app, app);
+    candidate_polls = 0;
+    apply(app);
+}
+
+#endif // APP_PROFILES
@@ -174,7 +174,7 @@ static int32 AudioGetInfo(uint32 infoPtr, uint32 selector, uint32 sourceID)
 			r.d[0] = selector;
 			r.a[1] = sourceID;
 			r.a[2] = AudioStatus.mixer;
-			Execute68k(audio_data + adatGetInfo, &r);
+			Execute68kRegs(audio_data + adatGetInfo, &r, M68K_REG_D(0) | M68K_REG_A(0) | M68K_REG_A(1) | M68K_REG_A(2), M68K_REG_D(0));
 			D(bug("  delegated to Apple Mixer, returns %08lx\n", r.d[0]));
 			return r.d[0];
 	}
@@ -262,7 +262,7 @@ static int32 AudioSetInfo(uint32 infoPtr, uint32 selector, uint32 sourceID)
 			r.d[0] = selector;
 			r.a[1] = sourceID;
 			r.a[2] = AudioStatus.mixer;
-			Execute68k(audio_data + adatSetInfo, &r);
+			Execute68kRegs(audio_data + adatSetInfo, &r, M68K_REG_D(0) | M68K_REG_A(0) | M68K_REG_A(1) | M68K_REG_A(2), M68K_REG_D(0));
 			D(bug("  delegated to Apple Mixer, returns %08lx\n", r.d[0]));
 			return r.d[0];
 	}
@@ -410,7 +410,7 @@ adat_error:	printf("FATAL: audio component data block initialization error\n");
 					if (AudioStatus.mixer) {
 						// Close Apple Mixer
 						r.a[0] = AudioStatus.mixer;
-						Execute68k(audio_data + adatCloseMixer, &r);
+						Execute68kRegs(audio_data + adatCloseMixer, &r, M68K_REG_A(0), M68K_REG_D(0));
 						D(bug(" CloseMixer() returns %08lx, mixer %08lx\n", r.d[0], AudioStatus.mixer));
 						AudioStatus.mixer = 0;
 					}
@@ -469,7 +469,7 @@ adat_error:	printf("FATAL: audio component data block initialization error\n");
 			r.a[0] = audio_data + adatMixer;
 			r.d[0] = 0;
 			r.a[1] = audio_data + adatData;
-			Execute68k(audio_data + adatOpenMixer, &r);
+			Execute68kRegs(audio_data + adatOpenMixer, &r, M68K_REG_D(0) | M68K_REG_A(0) | M68K_REG_A(1), M68K_REG_D(0));
 			AudioStatus.mixer = ReadMacInt32(audio_data + adatMixer);
 			D(bug(" OpenMixer() returns %08lx, mixer %08lx\n", r.d[0], AudioStatus.mixer));
 			return r.d[0];
@@ -502,7 +502,7 @@ adat_error:	printf("FATAL: audio component data block initialization error\n");
 			r.d[0] = ReadMacInt16(p + 4);
 			r.a[0] = ReadMacInt32(p);
 			r.a[1] = AudioStatus.mixer;
-			Execute68k(audio_data + adatStartSource, &r);
+			Execute68kRegs(audio_data + adatStartSource, &r, M68K_REG_D(0) | M68K_REG_A(0) | M68K_REG_A(1), M68K_REG_D(0));
 			D(bug(" returns %08lx\n", r.d[0]));
 			return noErr;
 
@@ -516,7 +516,7 @@ delegate:	// Delegate call to Apple Mixer
 			D(bug(" delegating call to Apple Mixer\n"));
 			r.a[0] = AudioStatus.mixer;
 			r.a[1] = params;
-			Execute68k(audio_data + adatDelegateCall, &r);
+			Execute68kRegs(audio_data + adatDelegateCall, &r, M68K_REG_A(0) | M68K_REG_A(1), M68K_REG_D(0));
 			D(bug(" returns %08lx\n", r.d[0]));
 			return r.d[0];
 
@@ -526,7 +526,7 @@ delegate:	// Delegate call to Apple Mixer
 			r.a[0] = ReadMacInt32(p + 4);
 			r.a[1] = ReadMacInt32(p + 8);
 			r.a[2] = AudioStatus.mixer;
-			Execute68k(audio_data + adatPlaySourceBuffer, &r);
+			Execute68kRegs(audio_data + adatPlaySourceBuffer, &r, M68K_REG_D(0) | M68K_REG_A(0) | M68K_REG_A(1) | M68K_REG_A(2), M68K_REG_D(0));
 			D(bug(" returns %08lx\n", r.d[0]));
 			return r.d[0];
 
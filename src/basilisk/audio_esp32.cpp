@@ -0,0 +1,518 @@
+/*
+ *  audio_esp32.cpp - Audio output through the Tab5 codec
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The Sound Manager mixes into Mac memory in blocks of audio_frames_per_block
+ *  frames (see audio.cpp), in whatever rate, size and channel count the Mac
+ *  picked. An audio task on Core 0 keeps the speaker fed: whenever a block
+ *  of the ring is free and a sound is playing it raises INTFLAG_AUDIO, and
+ *  AudioInterrupt() on the CPU task runs the Apple Mixer once and copies its
+ *  output into that block untouched. The audio task then converts the block
+ *  to the codec's one format (16-bit stereo at AUDIO_OUTPUT_RATE), with
+ *  linear resampling and the Mac volume in fixed point, and hands it to
+ *  M5.Speaker, which owns the I2S driver, its DMA buffers and the codec
+ *  setup on this board, and queues two blocks per channel.
+ *
+ *  All the common Mac rates and both sample sizes are offered to the Sound
+ *  Manager, so the Apple Mixer passes sounds through at their own rate
+ *  instead of resampling them in emulated 68k code. Neither side ever waits
+ *  for the other: the CPU only pays for the mixing, and only while a sound
+ *  is playing.
+ */
+
+#include <string.h>
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "prefs.h"
+#include "audio.h"
+#include "audio_defs.h"
+#include "perf_registry.h"
+#include "task_stats.h"
+
+#include <M5Unified.h>
+#include <esp_heap_caps.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// ============================================================================
+// Audio Task Configuration (runs on Core 0 next to the speaker task)
+// ============================================================================
+#define AUDIO_TASK_STACK_SIZE 3072
+#define AUDIO_TASK_PRIORITY   2     // Above video and input, a late block is audible
+#define AUDIO_TASK_CORE       0     // Run on Core 0, leaving Core 1 for CPU emulation
+#define AUDIO_POLL_MS         10    // Speaker queue check while blocks are in flight
+#define AUDIO_IDLE_MS         20    // Check for a new sound while nothing plays
+
+#define AUDIO_CHANNEL         0     // M5.Speaker virtual channel
+#define AUDIO_BLOCKS          4     // Ring: two queued in the speaker, two filling
+#define AUDIO_BLOCK_MS        46    // Block length, about 1024 frames at 22050 Hz
+#define AUDIO_OUTPUT_RATE     44100 // Codec rate, every block is converted to it
+#define AUDIO_SPEAKER_VOLUME  255   // Codec volume, the Mac volume is applied per sample
+
+static TaskHandle_t audio_task_handle = NULL;
+static volatile bool audio_task_running = false;
+
+// Mac sample rates offered to the Sound Manager (16.16 fixed point)
+static const uint32 mac_sample_rates[] = {
+    11025U << 16,
+    0x2b7745d1,     // 11127.27 Hz
+    22050U << 16,
+    0x56ee8ba3,     // 22254.55 Hz, the Mac's native rate
+    44100U << 16
+};
+
+// Ring block: the mixer's output as the Mac wrote it, and the same block
+// converted for the codec, which plays from it until the speaker is done
+struct audio_block {
+    uint8 *data;            // Mac samples (big-endian 16-bit or offset 8-bit)
+    uint32 frames;          // Frames in data
+    uint32 rate;            // Format of data, 16.16 fixed point rate
+    uint8 size;
+    uint8 channels;
+    int16 *out;             // Converted 16-bit stereo samples
+    uint32 out_frames;      // Frames in out
+};
+
+static audio_block audio_blocks[AUDIO_BLOCKS];
+static uint32 block_bytes = 0;              // Mac bytes one block can hold
+static uint32 out_capacity = 0;             // Converted frames one block can hold
+static uint32 block_filled = 0;             // Blocks filled, written by AudioInterrupt() only
+static bool block_requested = false;        // INTFLAG_AUDIO raised for the next block
+
+// Blocks filled, and those the mixer left short (CPU task)
+static perf_counter *const perf_blocks = PerfCounter("audio.blocks", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_padded = PerfCounter("audio.padded", PERF_COUNT, PERF_CORE_CPU);
+static task_stats *const audio_task_stats = TaskStats("audio");
+
+// Resampler state, carried from block to block (audio task only)
+static uint32 resample_rate = 0;            // Input rate of the running stream
+static uint64 resample_pos = 0;             // 32.32 position, between frames pos-1 and pos
+static int32 resample_last_l = 0;           // Last frame of the previous block
+static int32 resample_last_r = 0;
+
+// Volume and mute, as the Sound Manager sets them
+static uint32 main_volume = 0x01000100;
+static uint32 speaker_volume = 0x01000100;
+static bool main_mute = false;
+static bool speaker_mute = false;
+
+
+// Per channel gains from the volumes above, 0x100 is unity (audio task reads)
+static uint32 gain_left = 0x100;
+static uint32 gain_right = 0x100;
+
+
+/*
+ *  Channel gains from the Mac volumes (8.8 fixed point, left channel in the
+ *  upper 16 bits); applied in the conversion stage
+ */
+
+static void update_volume(void)
+{
+    uint32 left = 0, right = 0;
+    if (!main_mute && !speaker_mute) {
+        left = ((main_volume >> 16) * (speaker_volume >> 16)) >> 8;
+        right = ((main_volume & 0xffff) * (speaker_volume & 0xffff)) >> 8;
+        if (left > 0x100) left = 0x100;
+        if (right > 0x100) right = 0x100;
+    }
+    __atomic_store_n(&gain_left, left, __ATOMIC_RELAXED);
+    __atomic_store_n(&gain_right, right, __ATOMIC_RELAXED);
+}
+
+
+/*
+ *  Conversion stage: one Mac block to 16-bit stereo at AUDIO_OUTPUT_RATE
+ */
+
+static inline void read_frame(const audio_block &blk, uint32 i, int32 &l, int32 &r)
+{
+    if (blk.size == 16) {
+        const uint8 *p = blk.data + i * 2 * blk.channels;
+        l = (int16)((p[0] << 8) | p[1]);
+        r = (blk.channels == 2) ? (int16)((p[2] << 8) | p[3]) : l;
+    } else {
+        const uint8 *p = blk.data + i * blk.channels;
+        l = (p[0] - 0x80) << 8;
+        r = (blk.channels == 2) ? (p[1] - 0x80) << 8 : l;
+    }
+}
+
+static void convert_block(audio_block &blk)
+{
+    // A new stream starts from silence
+    if (blk.rate != resample_rate) {
+        resample_rate = blk.rate;
+        resample_pos = 0;
+        resample_last_l = resample_last_r = 0;
+    }
+
+    uint64 step = ((uint64)blk.rate << 16) / AUDIO_OUTPUT_RATE;
+    int32 gl = __atomic_load_n(&gain_left, __ATOMIC_RELAXED);
+    int32 gr = __atomic_load_n(&gain_right, __ATOMIC_RELAXED);
+    uint64 end = (uint64)blk.frames << 32;
+    uint64 pos = resample_pos;
+    int16 *out = blk.out;
+    uint32 n = 0;
+
+    // Interpolate between frames i-1 and i, frame -1 being the last one of
+    // the previous block
+    int32 l0 = resample_last_l, r0 = resample_last_r, l1, r1;
+    uint32 prev = 0;
+    if (blk.frames)
+        read_frame(blk, 0, l1, r1);
+    while (pos < end && n < out_capacity) {
+        uint32 i = pos >> 32;
+        if (i != prev) {
+            if (i == prev + 1) {
+                l0 = l1; r0 = r1;
+            } else
+                read_frame(blk, i - 1, l0, r0);
+            read_frame(blk, i, l1, r1);
+            prev = i;
+        }
+        int32 f = (uint32)pos >> 17;
+        int32 l = l0 + (((l1 - l0) * f) >> 15);
+        int32 r = r0 + (((r1 - r0) * f) >> 15);
+        out[0] = (l * gl) >> 8;
+        out[1] = (r * gr) >> 8;
+        out += 2;
+        n++;
+        pos += step;
+    }
+
+    if (blk.frames) {
+        read_frame(blk, blk.frames - 1, resample_last_l, resample_last_r);
+        resample_pos = pos - end;
+    }
+    blk.out_frames = n;
+}
+
+
+/*
+ *  Audio task: hand filled blocks to the speaker and ask for new ones
+ */
+
+static void audioTask(void *param)
+{
+    (void)param;
+    Serial.println("[AUDIO] Audio task started on Core 0");
+    task_run(audio_task_stats);
+
+    uint32 submitted = 0;
+    while (audio_task_running) {
+        uint32 filled = __atomic_load_n(&block_filled, __ATOMIC_ACQUIRE);
+
+        // The speaker queues two blocks per channel and plays from our buffers
+        while (submitted != filled && M5.Speaker.isPlaying(AUDIO_CHANNEL) < 2) {
+            audio_block &blk = audio_blocks[submitted % AUDIO_BLOCKS];
+            convert_block(blk);
+            if (blk.out_frames)
+                M5.Speaker.playRaw(blk.out, blk.out_frames * 2, AUDIO_OUTPUT_RATE, true, 1, AUDIO_CHANNEL, false);
+            submitted++;
+        }
+
+        // Blocks the speaker no longer holds may be filled again
+        uint32 finished = submitted - M5.Speaker.isPlaying(AUDIO_CHANNEL);
+        bool free_block = (filled - finished) < AUDIO_BLOCKS;
+
+        // Ask the Mac for the next block while a sound is playing
+        if (AudioStatus.num_sources > 0 && free_block && !__atomic_load_n(&block_requested, __ATOMIC_ACQUIRE)) {
+            __atomic_store_n(&block_requested, true, __ATOMIC_RELEASE);
+            SetInterruptFlag(INTFLAG_AUDIO);
+            TriggerInterrupt();
+        }
+
+        // AudioInterrupt() notifies a filled block, the speaker is polled
+        bool busy = submitted != filled || M5.Speaker.isPlaying(AUDIO_CHANNEL) > 0;
+        task_wait(audio_task_stats, busy ? AUDIO_POLL_MS : AUDIO_IDLE_MS);
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(busy ? AUDIO_POLL_MS : AUDIO_IDLE_MS));
+        task_run(audio_task_stats);
+    }
+
+    M5.Speaker.stop(AUDIO_CHANNEL);
+    Serial.println("[AUDIO] Audio task exiting");
+    vTaskDelete(NULL);
+}
+
+
+/*
+ *  Block size for the current sample rate
+ */
+
+static void set_block_size(void)
+{
+    audio_frames_per_block = ((AudioStatus.sample_rate >> 16) * AUDIO_BLOCK_MS / 1000 + 63) & ~63;
+}
+
+
+/*
+ *  Initialization
+ */
+
+void AudioInit(void)
+{
+    // Init audio status and feature flags
+    AudioStatus.sample_rate = 0x56ee8ba3;
+    AudioStatus.sample_size = 16;
+    AudioStatus.channels = 2;
+    AudioStatus.mixer = 0;
+    AudioStatus.num_sources = 0;
+    audio_component_flags = cmpWantsRegisterMessage | kStereoOut | k16BitOut | k8BitRawOut;
+    set_block_size();
+
+    // Every common Mac format; the conversion stage turns each into the
+    // codec format, so the mixer does not have to in 68k code
+    for (uint32 i = 0; i < sizeof(mac_sample_rates) / sizeof(mac_sample_rates[0]); i++)
+        audio_sample_rates.push_back(mac_sample_rates[i]);
+    audio_sample_sizes.push_back(8);
+    audio_sample_sizes.push_back(16);
+    audio_channel_counts.push_back(1);
+    audio_channel_counts.push_back(2);
+
+    // Sound disabled in prefs? Then do nothing
+    if (PrefsFindBool("nosound"))
+        return;
+
+    // Ring big enough for the largest block of any rate: 16-bit stereo Mac
+    // samples at 44100 Hz, and the most output frames a block resamples to
+    uint32 max_frames = 0;
+    out_capacity = 0;
+    for (uint32 i = 0; i < sizeof(mac_sample_rates) / sizeof(mac_sample_rates[0]); i++) {
+        uint32 frames = ((mac_sample_rates[i] >> 16) * AUDIO_BLOCK_MS / 1000 + 63) & ~63;
+        uint32 out_frames = (uint32)((uint64)(frames + 1) * AUDIO_OUTPUT_RATE * 65536 / mac_sample_rates[i]) + 1;
+        if (frames > max_frames) max_frames = frames;
+        if (out_frames > out_capacity) out_capacity = out_frames;
+    }
+    block_bytes = max_frames * 2 * 2;
+    for (int i = 0; i < AUDIO_BLOCKS; i++) {
+        audio_blocks[i].data = (uint8 *)heap_caps_malloc(block_bytes, MALLOC_CAP_SPIRAM);
+        audio_blocks[i].out = (int16 *)heap_caps_malloc(out_capacity * 2 * sizeof(int16), MALLOC_CAP_SPIRAM);
+        if (audio_blocks[i].data == NULL || audio_blocks[i].out == NULL) {
+            Serial.println("[AUDIO] ERROR: Cannot allocate audio ring");
+            AudioExit();
+            return;
+        }
+    }
+
+    // Keep the speaker's mixing task off the CPU core, and run the codec at
+    // the rate the conversion stage produces so the speaker need not resample
+    auto spk_cfg = M5.Speaker.config();
+    spk_cfg.task_pinned_core = AUDIO_TASK_CORE;
+    spk_cfg.sample_rate = AUDIO_OUTPUT_RATE;
+    M5.Speaker.config(spk_cfg);
+    if (!M5.Speaker.begin()) {
+        Serial.println("[AUDIO] ERROR: Speaker not available");
+        AudioExit();
+        return;
+    }
+    audio_open = true;
+    M5.Speaker.setVolume(AUDIO_SPEAKER_VOLUME);
+    update_volume();
+
+    audio_task_running = true;
+    BaseType_t result = xTaskCreatePinnedToCore(
+        audioTask,
+        "AudioTask",
+        AUDIO_TASK_STACK_SIZE,
+        NULL,
+        AUDIO_TASK_PRIORITY,
+        &audio_task_handle,
+        AUDIO_TASK_CORE
+    );
+    if (result != pdPASS) {
+        Serial.println("[AUDIO] ERROR: Failed to create audio task");
+        audio_task_running = false;
+        AudioExit();
+        return;
+    }
+    Serial.printf("[AUDIO] Output %d Hz, Mac rate %d Hz, %d frames per block\n", AUDIO_OUTPUT_RATE, AudioStatus.sample_rate >> 16, audio_frames_per_block);
+}
+
+
+/*
+ *  Deinitialization
+ */
+
+void AudioExit(void)
+{
+    if (audio_task_running) {
+        audio_task_running = false;
+        xTaskNotifyGive(audio_task_handle);
+        vTaskDelay(pdMS_TO_TICKS(50));
+        audio_task_handle = NULL;
+    }
+    if (audio_open) {
+        M5.Speaker.end();
+        audio_open = false;
+    }
+    for (int i = 0; i < AUDIO_BLOCKS; i++) {
+        if (audio_blocks[i].data) {
+            heap_caps_free(audio_blocks[i].data);
+            audio_blocks[i].data = NULL;
+        }
+        if (audio_blocks[i].out) {
+            heap_caps_free(audio_blocks[i].out);
+            audio_blocks[i].out = NULL;
+        }
+    }
+}
+
+
+/*
+ *  First source added, start audio stream
+ */
+
+void audio_enter_stream()
+{
+    if (audio_task_handle) {
+        task_notify(audio_task_stats);
+        xTaskNotifyGive(audio_task_handle);
+    }
+}
+
+
+/*
+ *  Last source removed, stop audio stream
+ */
+
+void audio_exit_stream()
+{
+}
+
+
+/*
+ *  MacOS audio interrupt, read next data block (CPU task, asked for by the
+ *  audio task when a block of the ring is free)
+ */
+
+void AudioInterrupt(void)
+{
+    D(bug("AudioInterrupt\n"));
+    if (!__atomic_load_n(&block_requested, __ATOMIC_ACQUIRE))
+        return;
+
+    // Get data from apple mixer
+    uint32 apple_stream_info = 0;
+    if (AudioStatus.mixer) {
+        M68kRegisters r;
+        r.a[0] = audio_data + adatStreamInfo;
+        r.a[1] = AudioStatus.mixer;
+        Execute68kRegs(audio_data + adatGetSourceData, &r, M68K_REG_A(0) | M68K_REG_A(1), 0);
+        apple_stream_info = ReadMacInt32(audio_data + adatStreamInfo);
+    } else
+        WriteMacInt32(audio_data + adatStreamInfo, 0);
+
+    // Copy it into the free block as it is, the audio task converts it;
+    // silence pads a short block, so the speaker keeps the pace whatever
+    // the mixer returns
+    uint32 filled = block_filled;
+    audio_block &blk = audio_blocks[filled % AUDIO_BLOCKS];
+    uint32 frame_bytes = (AudioStatus.sample_size >> 3) * AudioStatus.channels;
+    uint32 frames = audio_frames_per_block;
+    if (frames * frame_bytes > block_bytes)
+        frames = block_bytes / frame_bytes;
+    uint32 work = 0;
+    if (apple_stream_info) {
+        work = ReadMacInt32(apple_stream_info + scd_sampleCount);
+        if (work > frames)
+            work = frames;
+        memcpy(blk.data, Mac2HostAddr(ReadMacInt32(apple_stream_info + scd_buffer)), work * frame_bytes);
+    }
+    memset(blk.data + work * frame_bytes, AudioStatus.sample_size == 8 ? 0x80 : 0, (frames - work) * frame_bytes);
+    perf_inc(perf_blocks);
+    if (work < frames)
+        perf_inc(perf_padded);
+    blk.frames = frames;
+    blk.rate = AudioStatus.sample_rate;
+    blk.size = AudioStatus.sample_size;
+    blk.channels = AudioStatus.channels;
+
+    __atomic_store_n(&block_filled, filled + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&block_requested, false, __ATOMIC_RELEASE);
+    task_notify(audio_task_stats);
+    xTaskNotifyGive(audio_task_handle);
+}
+
+
+/*
+ *  Set sampling parameters
+ *  "index" is an index into the audio_sample_rates[] etc. vectors
+ *  It is guaranteed that AudioStatus.num_sources == 0
+ */
+
+bool audio_set_sample_rate(int index)
+{
+    AudioStatus.sample_rate = audio_sample_rates[index];
+    set_block_size();
+    return true;
+}
+
+bool audio_set_sample_size(int index)
+{
+    AudioStatus.sample_size = audio_sample_sizes[index];
+    return true;
+}
+
+bool audio_set_channels(int index)
+{
+    AudioStatus.channels = audio_channel_counts[index];
+    return true;
+}
+
+
+/*
+ *  Get/set volume controls (volume values received/returned have the left channel
+ *  volume in the upper 16 bits and the right channel volume in the lower 16 bits;
+ *  both volumes are 8.8 fixed point values with 0x0100 meaning "maximum volume"))
+ */
+
+bool audio_get_main_mute(void)
+{
+    return main_mute;
+}
+
+uint32 audio_get_main_volume(void)
+{
+    return main_volume;
+}
+
+bool audio_get_speaker_mute(void)
+{
+    return speaker_mute;
+}
+
+uint32 audio_get_speaker_volume(void)
+{
+    return speaker_volume;
+}
+
+void audio_set_main_mute(bool mute)
+{
+    main_mute = mute;
+    update_volume();
+}
+
+void audio_set_main_volume(uint32 vol)
+{
+    main_volume = vol;
+    update_volume();
+}
+
+void audio_set_speaker_mute(bool mute)
+{
+    speaker_mute = mute;
+    update_volume();
+}
+
+void audio_set_speaker_volume(uint32 vol)
+{
+    speaker_volume = vol;
+    update_volume();
+}
@@ -0,0 +1,760 @@
+/*
+ *  bincue_esp32.cpp - BIN/CUE CD-ROM images with CD audio playback
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  A .cue sheet describes the tracks of one or more .bin files: the data
+ *  track is read through Sys_read() like an ISO image, 2048 bytes of each
+ *  raw sector, and the audio tracks are played by a CD audio task on
+ *  Core 0. It streams the play range from the card into a PSRAM ring in
+ *  large sequential reads (CD_READ_SECTORS at a time, about two seconds)
+ *  so it takes the card only a few times a minute, and queues the ring
+ *  block by block on its own M5.Speaker channel, which mixes it with the
+ *  Mac's sound. Red Book audio is 16-bit stereo at 44100 Hz, the codec's
+ *  own format, so it is played as it is.
+ *
+ *  The CPU task only changes the player state under player_lock; the
+ *  position cdrom.cpp reports is the block the speaker is playing.
+ */
+
+#include <string.h>
+#include <ctype.h>
+#include <stdio.h>
+
+#include "sysdeps.h"
+#include "main.h"
+#include "audio.h"
+#include "sdcard.h"
+#include "bincue.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <M5Unified.h>
+#include <esp_heap_caps.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// CD geometry
+#define CD_FRAMES_PER_SECOND  75
+#define CD_RAW_SECTOR         2352
+#define CD_DATA_SECTOR        2048
+#define CD_MSF_OFFSET         150       // MSF 00:02:00 is LBA 0
+#define CD_MAX_TRACKS         99
+
+// CD audio task (runs on Core 0 next to the audio task)
+#define CD_TASK_STACK_SIZE    3072
+#define CD_TASK_PRIORITY      2
+#define CD_TASK_CORE          0
+#define CD_POLL_MS            40        // Speaker queue check while playing
+
+#define CD_AUDIO_CHANNEL      1         // M5.Speaker virtual channel, the Mac's is 0
+#define CD_PLAY_SECTORS       8         // Speaker block, 107ms (two are queued)
+#define CD_READ_SECTORS       144       // One card read, 1.9s (a multiple of the block)
+#define CD_BUFFER_SECTORS     (2 * CD_READ_SECTORS)   // PSRAM ring
+#define CD_DATA_SECTORS       32        // Raw data sectors per card read
+#define CD_BUFFER_ALIGN       64        // SDMMC DMA alignment, 8 raw sectors are a multiple
+
+// Audio status codes of the Q subchannel (GetPosition)
+enum {
+    CD_STATUS_PLAYING = 0x11,
+    CD_STATUS_PAUSED = 0x12,
+    CD_STATUS_COMPLETED = 0x13,
+    CD_STATUS_ERROR = 0x14,
+    CD_STATUS_NONE = 0x15
+};
+
+struct cue_track {
+    uint8 number;
+    uint8 file;             // Index into the image's file names
+    bool audio;
+    uint16 sector_size;     // Bytes per sector in the file
+    uint16 header;          // Bytes before the user data of a data sector
+    uint32 start;           // LBA of INDEX 01
+    uint32 length;          // Sectors of the track in its file, from INDEX 01
+    loff_t offset;          // File offset of INDEX 01
+};
+
+struct bincue_image {
+    int num_files;
+    char *files[CD_MAX_TRACKS];     // Paths of the .bin files, mount point included
+    bool swap[CD_MAX_TRACKS];       // Big-endian (MOTOROLA) audio samples
+    int num_tracks;
+    cue_track tracks[CD_MAX_TRACKS];
+    uint32 leadout;                 // LBA of the lead-out
+    cue_track *data;                // Data track, NULL for an audio CD
+    int data_fd;                    // Its file
+    uint8 *scratch;                 // Raw data sectors read from the card
+    uint8 volume_left, volume_right;
+};
+
+// CD audio player (one drive; state shared with the CPU task under player_lock)
+static SemaphoreHandle_t player_lock = NULL;
+static TaskHandle_t player_task = NULL;
+static bincue_image *player_image = NULL;   // Image being played, NULL: none
+static uint8 player_status = CD_STATUS_NONE;
+static uint32 player_generation = 0;        // Changes with each play or stop
+static uint32 ring_base = 0;                // LBA at ring sector 0
+static uint32 read_lba = 0;                 // Next sector to read into the ring
+static uint32 play_lba = 0;                 // Next sector to queue in the speaker
+static uint32 end_lba = 0;                  // End of the play range (exclusive)
+static uint32 queued_lba[4];                // Start of each block queued in the speaker
+static uint32 queued_count = 0;             // Blocks queued so far
+static uint32 position_lba = 0;             // Sector the speaker is playing
+static uint8 *ring = NULL;                  // CD_BUFFER_SECTORS raw sectors (PSRAM)
+static bool stream_reading = false;         // Card read in flight, the image must stay
+
+// Card file the task streams from (task only while reading)
+static int stream_fd = -1;
+static int stream_file = -1;
+
+
+/*
+ *  MSF conversions
+ */
+
+static inline uint32 msf_to_lba(uint8 m, uint8 s, uint8 f)
+{
+    uint32 frames = (m * 60 + s) * CD_FRAMES_PER_SECOND + f;
+    return frames > CD_MSF_OFFSET ? frames - CD_MSF_OFFSET : 0;
+}
+
+static inline void frames_to_msf(uint32 frames, uint8 *msf)
+{
+    msf[0] = frames / (60 * CD_FRAMES_PER_SECOND);
+    msf[1] = (frames / CD_FRAMES_PER_SECOND) % 60;
+    msf[2] = frames % CD_FRAMES_PER_SECOND;
+}
+
+static bool parse_msf(const char *s, uint32 &frames)
+{
+    int m, sec, f;
+    if (sscanf(s, "%d:%d:%d", &m, &sec, &f) != 3)
+        return false;
+    frames = (m * 60 + sec) * CD_FRAMES_PER_SECOND + f;
+    return true;
+}
+
+/*
+ *  Track holding a sector, NULL before the first one
+ */
+
+static cue_track *find_track(bincue_image *img, uint32 lba)
+{
+    cue_track *found = NULL;
+    for (int i = 0; i < img->num_tracks; i++) {
+        if (img->tracks[i].start > lba)
+            break;
+        found = &img->tracks[i];
+    }
+    return found;
+}
+
+
+/*
+ *  Cue sheet parser
+ */
+
+// Next word of a line, or the quoted string, into buf; returns the rest
+static const char *next_token(const char *p, char *buf, size_t size)
+{
+    while (isspace((unsigned char)*p))
+        p++;
+    size_t n = 0;
+    if (*p == '"') {
+        p++;
+        while (*p && *p != '"') {
+            if (n < size - 1) buf[n++] = *p;
+            p++;
+        }
+        if (*p == '"')
+            p++;
+    } else {
+        while (*p && !isspace((unsigned char)*p)) {
+            if (n < size - 1) buf[n++] = *p;
+            p++;
+        }
+    }
+    buf[n] = 0;
+    return p;
+}
+
+// Tracks [first, num_tracks) are in the file just ended: their lengths
+// and the LBA where the next file starts
+static bool end_file(bincue_image *img, int first, uint32 &file_base)
+{
+    if (img->num_files == 0)
+        return true;
+    struct stat st;
+    if (stat(img->files[img->num_files - 1], &st) != 0) {
+        Serial.printf("[CDROM] ERROR: Cannot find %s\n", img->files[img->num_files - 1]);
+        return false;
+    }
+    if (first >= img->num_tracks)
+        return true;
+    uint32 sectors = st.st_size / img->tracks[first].sector_size;
+    for (int i = first; i < img->num_tracks; i++) {
+        cue_track &t = img->tracks[i];
+        uint32 begin = t.offset / t.sector_size;
+        uint32 end = (i + 1 < img->num_tracks) ? img->tracks[i + 1].offset / img->tracks[i + 1].sector_size : sectors;
+        t.length = end > begin ? end - begin : 0;
+    }
+    file_base += sectors;
+    return true;
+}
+
+static bool parse_cue(bincue_image *img, const char *cue_path)
+{
+    FILE *f = fopen(cue_path, "r");
+    if (f == NULL)
+        return false;
+
+    // .bin files are named relative to the cue sheet
+    const char *slash = strrchr(cue_path, '/');
+    int dir_len = slash ? slash - cue_path + 1 : 0;
+
+    char line[512], word[256];
+    uint32 file_base = 0, pregap = 0;
+    int file_first = 0;
+    bool ok = true;
+    cue_track *t = NULL;
+    while (ok && fgets(line, sizeof(line), f)) {
+        const char *p = next_token(line, word, sizeof(word));
+        if (strcasecmp(word, "FILE") == 0) {
+            ok = end_file(img, file_first, file_base);
+            file_first = img->num_tracks;
+            if (img->num_files >= CD_MAX_TRACKS) {
+                ok = false;
+                break;
+            }
+            p = next_token(p, word, sizeof(word));
+            int len = dir_len + strlen(word) + 1;
+            char *path = (char *)malloc(len);
+            if (path == NULL) {
+                ok = false;
+                break;
+            }
+            snprintf(path, len, "%.*s%s", dir_len, cue_path, word);
+            next_token(p, word, sizeof(word));
+            img->swap[img->num_files] = strcasecmp(word, "MOTOROLA") == 0;
+            img->files[img->num_files++] = path;
+        } else if (strcasecmp(word, "TRACK") == 0) {
+            if (img->num_files == 0 || img->num_tracks >= CD_MAX_TRACKS) {
+                ok = false;
+                break;
+            }
+            t = &img->tracks[img->num_tracks++];
+            memset(t, 0, sizeof(cue_track));
+            p = next_token(p, word, sizeof(word));
+            t->number = atoi(word);
+            t->file = img->num_files - 1;
+            next_token(p, word, sizeof(word));
+            if (strcasecmp(word, "AUDIO") == 0) {
+                t->audio = true;
+                t->sector_size = CD_RAW_SECTOR;
+            } else if (strcasecmp(word, "MODE1/2048") == 0) {
+                t->sector_size = CD_DATA_SECTOR;
+            } else if (strcasecmp(word, "MODE1/2352") == 0) {
+                t->sector_size = CD_RAW_SECTOR;
+                t->header = 16;
+            } else if (strcasecmp(word, "MODE2/2352") == 0) {
+                t->sector_size = CD_RAW_SECTOR;
+                t->header = 24;     // Form 1: sync, header and subheader
+            } else {
+                Serial.printf("[CDROM] ERROR: Track mode %s not supported\n", word);
+                ok = false;
+            }
+        } else if (strcasecmp(word, "PREGAP") == 0 && t) {
+            uint32 frames;
+            next_token(p, word, sizeof(word));
+            if (parse_msf(word, frames))
+                pregap += frames;
+        } else if (strcasecmp(word, "INDEX") == 0 && t) {
+            uint32 frames;
+            p = next_token(p, word, sizeof(word));
+            int index = atoi(word);
+            next_token(p, word, sizeof(word));
+            if (index == 1 && parse_msf(word, frames)) {
+                t->offset = (loff_t)frames * t->sector_size;
+                t->start = file_base + frames + pregap;
+            }
+        }
+    }
+    fclose(f);
+    if (ok)
+        ok = end_file(img, file_first, file_base);
+    img->leadout = file_base + pregap;
+    return ok && img->num_tracks > 0;
+}
+
+
+/*
+ *  Open a .cue image (name from the SD root)
+ */
+
+void *open_bincue(const char *name)
+{
+    bincue_image *img = (bincue_image *)calloc(1, sizeof(bincue_image));
+    if (img == NULL)
+        return NULL;
+    img->data_fd = -1;
+    img->volume_left = img->volume_right = 0xff;
+
+    char path[300];
+    snprintf(path, sizeof(path), "%s%s", SD_MOUNT_POINT, name);
+    if (!parse_cue(img, path)) {
+        Serial.printf("[CDROM] ERROR: Cannot use cue sheet %s\n", name);
+        close_bincue(img);
+        return NULL;
+    }
+
+    for (int i = 0; i < img->num_tracks; i++) {
+        if (!img->tracks[i].audio) {
+            img->data = &img->tracks[i];
+            break;
+        }
+    }
+    if (img->data) {
+        img->data_fd = open(img->files[img->data->file], O_RDONLY);
+        if (img->data->sector_size != CD_DATA_SECTOR)
+            img->scratch = (uint8 *)heap_caps_aligned_alloc(CD_BUFFER_ALIGN, CD_DATA_SECTORS * CD_RAW_SECTOR, MALLOC_CAP_SPIRAM);
+        if (img->data_fd < 0 || (img->data->sector_size != CD_DATA_SECTOR && img->scratch == NULL)) {
+            Serial.printf("[CDROM] ERROR: Cannot open data track of %s\n", name);
+            close_bincue(img);
+            return NULL;
+        }
+    }
+
+    Serial.printf("[CDROM] %s: %d tracks in %d files, %s data track\n", name,
+                  img->num_tracks, img->num_files, img->data ? "with" : "no");
+    return img;
+}
+
+void close_bincue(void *arg)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (img == NULL)
+        return;
+    CDStop_bincue(img);
+    if (player_lock) {
+        // Let a card read of this image end first
+        xSemaphoreTake(player_lock, portMAX_DELAY);
+        while (stream_reading) {
+            xSemaphoreGive(player_lock);
+            vTaskDelay(1);
+            xSemaphoreTake(player_lock, portMAX_DELAY);
+        }
+        if (player_image == img)
+            player_image = NULL;
+        if (stream_fd >= 0) {
+            close(stream_fd);
+            stream_fd = -1;
+            stream_file = -1;
+        }
+        xSemaphoreGive(player_lock);
+    }
+    if (img->data_fd >= 0)
+        close(img->data_fd);
+    if (img->scratch)
+        heap_caps_free(img->scratch);
+    for (int i = 0; i < img->num_files; i++)
+        free(img->files[i]);
+    free(img);
+}
+
+
+/*
+ *  Data track: size and reads of its 2048-byte blocks
+ */
+
+loff_t size_bincue(void *arg)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (img == NULL || img->data == NULL)
+        return 0;
+    return (loff_t)img->data->length * CD_DATA_SECTOR;
+}
+
+size_t read_bincue(void *arg, void *buffer, loff_t offset, size_t length)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (img == NULL || img->data == NULL)
+        return 0;
+    cue_track *t = img->data;
+    loff_t size = (loff_t)t->length * CD_DATA_SECTOR;
+    if (offset >= size)
+        return 0;
+    if (offset + (loff_t)length > size)
+        length = size - offset;
+
+    // Cooked sectors are the image itself
+    if (t->sector_size == CD_DATA_SECTOR) {
+        ssize_t n = pread(img->data_fd, buffer, length, t->offset + offset);
+        return n > 0 ? n : 0;
+    }
+
+    // Raw sectors: one read per CD_DATA_SECTORS, keeping the user data
+    uint8 *dst = (uint8 *)buffer;
+    size_t done = 0;
+    while (done < length) {
+        uint32 sector = (offset + done) / CD_DATA_SECTOR;
+        uint32 skip = (offset + done) % CD_DATA_SECTOR;
+        uint32 count = (skip + length - done + CD_DATA_SECTOR - 1) / CD_DATA_SECTOR;
+        if (count > CD_DATA_SECTORS)
+            count = CD_DATA_SECTORS;
+        ssize_t n = pread(img->data_fd, img->scratch, count * CD_RAW_SECTOR, t->offset + (loff_t)sector * CD_RAW_SECTOR);
+        if (n < (ssize_t)(count * CD_RAW_SECTOR))
+            break;
+        for (uint32 i = 0; i < count && done < length; i++) {
+            size_t n = CD_DATA_SECTOR - skip;
+            if (n > length - done)
+                n = length - done;
+            memcpy(dst + done, img->scratch + i * CD_RAW_SECTOR + t->header + skip, n);
+            done += n;
+            skip = 0;
+        }
+    }
+    return done;
+}
+
+
+/*
+ *  Table of contents, in the layout cdrom.cpp reads
+ */
+
+bool readtoc_bincue(void *arg, uint8 *toc)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (img == NULL)
+        return false;
+    uint8 *p = toc + 4;
+    for (int i = 0; i <= img->num_tracks; i++) {
+        bool leadout = i == img->num_tracks;
+        *p++ = 0;
+        *p++ = 0x10 | ((leadout || !img->tracks[i].audio) ? 0x04 : 0x00);   // ADR 1, data or audio
+        *p++ = leadout ? 0xaa : img->tracks[i].number;
+        *p++ = 0;
+        *p++ = 0;
+        frames_to_msf((leadout ? img->leadout : img->tracks[i].start) + CD_MSF_OFFSET, p);
+        p += 3;
+    }
+    uint32 size = p - toc - 2;
+    toc[0] = size >> 8;
+    toc[1] = size;
+    toc[2] = img->tracks[0].number;
+    toc[3] = img->tracks[img->num_tracks - 1].number;
+    return true;
+}
+
+
+/*
+ *  CD audio task: stream the play range into the ring and queue it
+ */
+
+// Read sectors [lba, lba + count) into the ring from slot on (task, unlocked)
+static void stream_read(bincue_image *img, uint32 lba, uint32 count, uint8 *dst)
+{
+    while (count > 0) {
+        cue_track *t = find_track(img, lba);
+        uint32 n = count;
+        if (t && t->audio && lba - t->start < t->length) {
+            if (n > t->start + t->length - lba)
+                n = t->start + t->length - lba;
+            if (stream_file != t->file) {
+                if (stream_fd >= 0)
+                    close(stream_fd);
+                stream_fd = open(img->files[t->file], O_RDONLY);
+                stream_file = stream_fd >= 0 ? t->file : -1;
+            }
+            ssize_t got = stream_fd >= 0 ? pread(stream_fd, dst, n * CD_RAW_SECTOR, t->offset + (loff_t)(lba - t->start) * CD_RAW_SECTOR) : 0;
+            if (got < 0)
+                got = 0;
+            if ((size_t)got < n * CD_RAW_SECTOR)
+                memset(dst + got, 0, n * CD_RAW_SECTOR - got);
+            if (img->swap[t->file]) {
+                uint16 *s = (uint16 *)dst;
+                for (uint32 i = 0; i < n * CD_RAW_SECTOR / 2; i++)
+                    s[i] = __builtin_bswap16(s[i]);
+            }
+        } else {
+            // Gaps and data tracks play as silence up to the next track
+            cue_track *next = t ? t + 1 : &img->tracks[0];
+            if (next < img->tracks + img->num_tracks && next->start > lba && n > next->start - lba)
+                n = next->start - lba;
+            memset(dst, 0, n * CD_RAW_SECTOR);
+        }
+        lba += n;
+        count -= n;
+        dst += n * CD_RAW_SECTOR;
+    }
+}
+
+static void cdAudioTask(void *param)
+{
+    (void)param;
+    Serial.println("[CDROM] CD audio task started on Core 0");
+
+    while (true) {
+        bincue_image *img = NULL;
+        uint32 generation = 0, lba = 0, count = 0;
+        uint8 *dst = NULL;
+
+        xSemaphoreTake(player_lock, portMAX_DELAY);
+        bool playing = player_image && player_status == CD_STATUS_PLAYING;
+        if (playing) {
+            // Blocks the speaker is done with, and the one it is playing
+            uint32 in_speaker = M5.Speaker.isPlaying(CD_AUDIO_CHANNEL);
+            if (in_speaker > queued_count)
+                in_speaker = queued_count;
+            position_lba = in_speaker ? queued_lba[(queued_count - in_speaker) % 4] : play_lba;
+
+            // Queue the next blocks, they play from the ring
+            while (play_lba < read_lba && M5.Speaker.isPlaying(CD_AUDIO_CHANNEL) < 2) {
+                uint32 n = read_lba - play_lba;
+                if (n > CD_PLAY_SECTORS)
+                    n = CD_PLAY_SECTORS;
+                const int16 *block = (const int16 *)(ring + ((play_lba - ring_base) % CD_BUFFER_SECTORS) * CD_RAW_SECTOR);
+                M5.Speaker.playRaw(block, n * CD_RAW_SECTOR / 2, 44100, true, 1, CD_AUDIO_CHANNEL, false);
+                queued_lba[queued_count++ % 4] = play_lba;
+                play_lba += n;
+            }
+
+            if (play_lba >= end_lba && M5.Speaker.isPlaying(CD_AUDIO_CHANNEL) == 0) {
+                player_status = CD_STATUS_COMPLETED;
+                position_lba = end_lba;
+            } else if (read_lba < end_lba) {
+                // Read when a whole read fits behind the oldest block still queued
+                uint32 oldest = queued_count ? position_lba : play_lba;
+                uint32 free = CD_BUFFER_SECTORS - (read_lba - oldest);
+                uint32 want = end_lba - read_lba;
+                if (want > CD_READ_SECTORS)
+                    want = CD_READ_SECTORS;
+                if (free >= CD_READ_SECTORS || (want < CD_READ_SECTORS && free >= want)) {
+                    img = player_image;
+                    generation = player_generation;
+                    lba = read_lba;
+                    count = want;
+                    dst = ring + ((read_lba - ring_base) % CD_BUFFER_SECTORS) * CD_RAW_SECTOR;
+                    stream_reading = true;
+                }
+            }
+        }
+        xSemaphoreGive(player_lock);
+
+        // The card read runs unlocked, a play or stop meanwhile discards it
+        if (img) {
+            stream_read(img, lba, count, dst);
+            xSemaphoreTake(player_lock, portMAX_DELAY);
+            if (generation == player_generation)
+                read_lba += count;
+            stream_reading = false;
+            xSemaphoreGive(player_lock);
+            continue;
+        }
+        ulTaskNotifyTake(pdTRUE, playing ? pdMS_TO_TICKS(CD_POLL_MS) : portMAX_DELAY);
+    }
+}
+
+
+/*
+ *  Player control (CPU task)
+ */
+
+// Start streaming from lba, with player_lock held
+static void player_start(bincue_image *img, uint32 lba)
+{
+    M5.Speaker.stop(CD_AUDIO_CHANNEL);
+    player_image = img;
+    player_generation++;
+    ring_base = read_lba = play_lba = position_lba = lba;
+    queued_count = 0;
+    player_status = CD_STATUS_PLAYING;
+}
+
+bool CDPlay_bincue(void *arg, uint8 start_m, uint8 start_s, uint8 start_f,
+                   uint8 end_m, uint8 end_s, uint8 end_f)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (img == NULL || !audio_open || player_lock == NULL)
+        return false;
+
+    uint32 start = msf_to_lba(start_m, start_s, start_f);
+    uint32 end = msf_to_lba(end_m, end_s, end_f);
+    if (end > img->leadout)
+        end = img->leadout;
+    cue_track *t = find_track(img, start);
+    if (t == NULL || !t->audio || start >= end)
+        return false;
+
+    if (ring == NULL) {
+        ring = (uint8 *)heap_caps_aligned_alloc(CD_BUFFER_ALIGN, CD_BUFFER_SECTORS * CD_RAW_SECTOR, MALLOC_CAP_SPIRAM);
+        if (ring == NULL) {
+            Serial.println("[CDROM] ERROR: Cannot allocate CD audio buffer");
+            return false;
+        }
+    }
+    if (player_task == NULL) {
+        if (xTaskCreatePinnedToCore(cdAudioTask, "CDAudioTask", CD_TASK_STACK_SIZE, NULL,
+                                    CD_TASK_PRIORITY, &player_task, CD_TASK_CORE) != pdPASS) {
+            Serial.println("[CDROM] ERROR: Failed to create CD audio task");
+            player_task = NULL;
+            return false;
+        }
+    }
+
+    xSemaphoreTake(player_lock, portMAX_DELAY);
+    player_start(img, start);
+    end_lba = end;
+    xSemaphoreGive(player_lock);
+    M5.Speaker.setChannelVolume(CD_AUDIO_CHANNEL, (img->volume_left + img->volume_right) / 2);
+    xTaskNotifyGive(player_task);
+    return true;
+}
+
+bool CDPause_bincue(void *arg)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (player_lock == NULL)
+        return false;
+    xSemaphoreTake(player_lock, portMAX_DELAY);
+    bool ok = player_image == img && player_status == CD_STATUS_PLAYING;
+    if (ok) {
+        // Resume with the block the speaker was playing, it is still in the ring
+        M5.Speaker.stop(CD_AUDIO_CHANNEL);
+        play_lba = position_lba;
+        queued_count = 0;
+        player_status = CD_STATUS_PAUSED;
+    }
+    xSemaphoreGive(player_lock);
+    return ok;
+}
+
+bool CDResume_bincue(void *arg)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (player_lock == NULL)
+        return false;
+    xSemaphoreTake(player_lock, portMAX_DELAY);
+    bool ok = player_image == img && player_status == CD_STATUS_PAUSED;
+    if (ok)
+        player_status = CD_STATUS_PLAYING;
+    xSemaphoreGive(player_lock);
+    if (ok)
+        xTaskNotifyGive(player_task);
+    return ok;
+}
+
+bool CDStop_bincue(void *arg)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (player_lock == NULL)
+        return false;
+    xSemaphoreTake(player_lock, portMAX_DELAY);
+    bool ok = player_image == img;
+    if (ok && (player_status == CD_STATUS_PLAYING || player_status == CD_STATUS_PAUSED)) {
+        M5.Speaker.stop(CD_AUDIO_CHANNEL);
+        player_generation++;
+        queued_count = 0;
+        player_status = CD_STATUS_NONE;
+    }
+    xSemaphoreGive(player_lock);
+    return ok;
+}
+
+// Scanning plays on from the given position; the speaker keeps the pace
+bool CDScan_bincue(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, bool reverse)
+{
+    bincue_image *img = (bincue_image *)arg;
+    (void)reverse;
+    if (player_lock == NULL)
+        return false;
+    uint32 start = msf_to_lba(start_m, start_s, start_f);
+    cue_track *t = find_track(img, start);
+    if (t == NULL || !t->audio)
+        return false;
+    xSemaphoreTake(player_lock, portMAX_DELAY);
+    bool ok = player_image == img;
+    if (ok)
+        player_start(img, start);
+    xSemaphoreGive(player_lock);
+    if (ok)
+        xTaskNotifyGive(player_task);
+    return ok;
+}
+
+void CDSetVol_bincue(void *arg, uint8 left, uint8 right)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (img == NULL)
+        return;
+    img->volume_left = left;
+    img->volume_right = right;
+    if (audio_open)
+        M5.Speaker.setChannelVolume(CD_AUDIO_CHANNEL, (left + right) / 2);
+}
+
+void CDGetVol_bincue(void *arg, uint8 *left, uint8 *right)
+{
+    bincue_image *img = (bincue_image *)arg;
+    *left = img ? img->volume_left : 0;
+    *right = img ? img->volume_right : 0;
+}
+
+
+/*
+ *  Q subchannel: audio status and position, in the layout cdrom.cpp reads
+ */
+
+bool GetPosition_bincue(void *arg, uint8 *pos)
+{
+    bincue_image *img = (bincue_image *)arg;
+    if (img == NULL || player_lock == NULL)
+        return false;
+
+    xSemaphoreTake(player_lock, portMAX_DELAY);
+    uint8 status = (player_image == img) ? player_status : CD_STATUS_NONE;
+    uint32 lba = (player_image == img) ? position_lba : 0;
+    xSemaphoreGive(player_lock);
+
+    cue_track *t = find_track(img, lba);
+    if (t == NULL)
+        t = &img->tracks[0];
+    memset(pos, 0, 16);
+    pos[1] = status;
+    pos[3] = 12;                            // Sub-Q data length
+    pos[5] = 0x10 | (t->audio ? 0x00 : 0x04);
+    pos[6] = t->number;
+    pos[7] = 1;                             // Index
+    frames_to_msf(lba + CD_MSF_OFFSET, pos + 9);
+    frames_to_msf(lba > t->start ? lba - t->start : 0, pos + 13);
+    return true;
+}
+
+
+/*
+ *  Initialization and deinitialization
+ */
+
+void InitBinCue()
+{
+    if (player_lock == NULL)
+        player_lock = xSemaphoreCreateMutex();
+}
+
+void ExitBinCue()
+{
+    if (player_lock == NULL)
+        return;
+    xSemaphoreTake(player_lock, portMAX_DELAY);
+    if (player_image && audio_open)
+        M5.Speaker.stop(CD_AUDIO_CHANNEL);
+    player_image = NULL;
+    player_status = CD_STATUS_NONE;
+    player_generation++;
+    xSemaphoreGive(player_lock);
+}
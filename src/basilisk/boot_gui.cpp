@@ -8,17 +8,23 @@
  *  - Hard disk image selection
  *  - CD-ROM ISO selection
  *  - RAM size selection (4/8/12/16 MB)
+ *  - CPU benchmark before boot
+ *  - Resuming a hibernated session
  *  - Settings persistence to SD card
+ *  - Image index, so the lists need no walk of the card at boot
+ *  - Performance profile selection
  */
 
 #include <Arduino.h>
 #include <M5Unified.h>
 #include <M5GFX.h>
-#include <SD.h>
 #include <vector>
 #include <string>
+#include <dirent.h>
+#include <sys/stat.h>
 
 #include "boot_gui.h"
+#include "sdcard.h"
 
 // ============================================================================
 // Classic Mac Color Palette
@@ -102,8 +108,20 @@ static char selected_disk_path[BOOT_GUI_MAX_PATH] = "";
 static char selected_cdrom_path[BOOT_GUI_MAX_PATH] = "";
 static int selected_ram_mb = 8;  // Default 8MB
 static bool skip_gui = false;    // If true, skip boot GUI and go straight to emulator
+static bool benchmark_setting = false;  // benchmark=yes: run the CPU benchmark on every boot
+static bool benchmark_once = false;     // Benchmark button: run it on this boot only
+static bool fpufast_setting = false;    // fpufast=yes: single precision FPU arithmetic
+static bool native_screen = false;      // screen=1280x720: native Mac screen, no pixel doubling
+static bool resume_session = false;     // A hibernated session is waiting and was not dismissed
+static char wifi_ssid[64] = "";         // wifi_ssid=: network for Ethernet over WiFi, "": none
+static char wifi_password[64] = "";
+static bool udp_tunnel_setting = false; // udptunnel=yes: AppleTalk over UDP instead of bridging
+static char serial_a[8] = "";           // seriala=: modem port on "usb" or "uart", "": none
+static char serial_b[8] = "";           // serialb=: printer port
+static char profile_name[32] = "";      // profile=: section of the profiles file, "": defaults
 
 static const char* SETTINGS_FILE = "/basilisk_settings.txt";
+static const char* STATE_FILE = "/basilisk.state";   // Written by savestate.cpp
 
 // ============================================================================
 // File Lists
@@ -111,6 +129,25 @@ static const char* SETTINGS_FILE = "/basilisk_settings.txt";
 
 static std::vector<std::string> disk_files;
 static std::vector<std::string> cdrom_files;
+static std::vector<std::string> profile_names;  // Sections of BOOT_GUI_PROFILES_FILE
+
+// Image index (see loadIndex())
+struct image_entry {
+    std::string path;       // From the card's root, with a leading slash
+    uint32_t size;
+    uint32_t mtime;
+    bool cdrom;
+};
+
+#define BOOT_GUI_SCAN_DEPTH 2  // Subdirectory levels searched for images
+static const char* INDEX_FILE = "/basilisk_images.idx";
+static const char* INDEX_HEADER = "# BasiliskII image index 1";
+
+static std::vector<image_entry> index_entries;  // Lists shown, as in the index file
+static std::vector<image_entry> scan_entries;   // The scan task's, until scan_done
+static bool scan_running = false;               // Scan task started, result not taken
+static bool scan_done = false;                  // Set by the scan task
+static bool scan_changed = false;               // scan_entries differ from index_entries
 
 static int disk_selection_index = 0;
 static int cdrom_selection_index = 0;  // 0 = None
@@ -130,8 +167,9 @@ static bool gui_initialized = false;
 
 static void loadSettings(void);
 static void saveSettings(void);
-static void scanDiskFiles(void);
-static void scanCDROMFiles(void);
+static void scanImageFiles(std::vector<image_entry>& entries);
+static void setImageLists(const std::vector<image_entry>& entries);
+static void applyScan(bool wait);
 static void drawDesktopPattern(void);
 static void drawWindow(int x, int y, int w, int h, const char* title);
 static void drawButton(int x, int y, int w, int h, const char* label, bool pressed);
@@ -151,7 +189,7 @@ static void loadSettings(void)
 {
     Serial.println("[BOOT_GUI] Loading settings...");
     
-    File file = SD.open(SETTINGS_FILE, FILE_READ);
+    File file = SDCard().open(SETTINGS_FILE, FILE_READ);
     if (!file) {
         Serial.println("[BOOT_GUI] No settings file found, using defaults");
         return;
@@ -180,13 +218,40 @@ static void loadSettings(void)
         } else if (key == "ramsize") {
             selected_ram_mb = value.toInt();
             if (selected_ram_mb != 4 && selected_ram_mb != 8 && 
-                selected_ram_mb != 12 && selected_ram_mb != 16) {
+                selected_ram_mb != 12 && selected_ram_mb != 16 &&
+                selected_ram_mb != 24 && selected_ram_mb != 32) {
                 selected_ram_mb = 8;  // Default to 8MB if invalid
             }
             Serial.printf("[BOOT_GUI] Loaded RAM: %d MB\n", selected_ram_mb);
         } else if (key == "skip_gui") {
             skip_gui = (value == "yes" || value == "true" || value == "1");
             Serial.printf("[BOOT_GUI] Loaded skip_gui: %s\n", skip_gui ? "yes" : "no");
+        } else if (key == "benchmark") {
+            benchmark_setting = (value == "yes" || value == "true" || value == "1");
+            Serial.printf("[BOOT_GUI] Loaded benchmark: %s\n", benchmark_setting ? "yes" : "no");
+        } else if (key == "fpufast") {
+            fpufast_setting = (value == "yes" || value == "true" || value == "1");
+            Serial.printf("[BOOT_GUI] Loaded fpufast: %s\n", fpufast_setting ? "yes" : "no");
+        } else if (key == "screen") {
+            native_screen = (value == "1280x720");
+            Serial.printf("[BOOT_GUI] Loaded screen: %s\n", native_screen ? "1280x720" : "640x360");
+        } else if (key == "wifi_ssid") {
+            strncpy(wifi_ssid, value.c_str(), sizeof(wifi_ssid) - 1);
+            Serial.printf("[BOOT_GUI] Loaded wifi_ssid: %s\n", wifi_ssid);
+        } else if (key == "wifi_password") {
+            strncpy(wifi_password, value.c_str(), sizeof(wifi_password) - 1);
+        } else if (key == "udptunnel") {
+            udp_tunnel_setting = (value == "yes" || value == "true" || value == "1");
+            Serial.printf("[BOOT_GUI] Loaded udptunnel: %s\n", udp_tunnel_setting ? "yes" : "no");
+        } else if (key == "seriala") {
+            strncpy(serial_a, value.c_str(), sizeof(serial_a) - 1);
+            Serial.printf("[BOOT_GUI] Loaded seriala: %s\n", serial_a);
+        } else if (key == "serialb") {
+            strncpy(serial_b, value.c_str(), sizeof(serial_b) - 1);
+            Serial.printf("[BOOT_GUI] Loaded serialb: %s\n", serial_b);
+        } else if (key == "profile") {
+            strncpy(profile_name, value.c_str(), sizeof(profile_name) - 1);
+            Serial.printf("[BOOT_GUI] Loaded profile: %s\n", profile_name);
         }
     }
     
@@ -197,7 +262,7 @@ static void saveSettings(void)
 {
     Serial.println("[BOOT_GUI] Saving settings...");
     
-    File file = SD.open(SETTINGS_FILE, FILE_WRITE);
+    File file = SDCard().open(SETTINGS_FILE, FILE_WRITE);
     if (!file) {
         Serial.println("[BOOT_GUI] ERROR: Cannot open settings file for writing");
         return;
@@ -207,11 +272,63 @@ static void saveSettings(void)
     file.printf("cdrom=%s\n", selected_cdrom_path);
     file.printf("ramsize=%d\n", selected_ram_mb);
     file.printf("skip_gui=%s\n", skip_gui ? "yes" : "no");
+    file.printf("benchmark=%s\n", benchmark_setting ? "yes" : "no");
+    file.printf("fpufast=%s\n", fpufast_setting ? "yes" : "no");
+    file.printf("screen=%s\n", native_screen ? "1280x720" : "640x360");
+    if (strlen(wifi_ssid) > 0) {
+        file.printf("wifi_ssid=%s\n", wifi_ssid);
+        file.printf("wifi_password=%s\n", wifi_password);
+        file.printf("udptunnel=%s\n", udp_tunnel_setting ? "yes" : "no");
+    }
+    if (strlen(serial_a) > 0)
+        file.printf("seriala=%s\n", serial_a);
+    if (strlen(serial_b) > 0)
+        file.printf("serialb=%s\n", serial_b);
+    if (strlen(profile_name) > 0)
+        file.printf("profile=%s\n", profile_name);
     
     file.close();
     Serial.println("[BOOT_GUI] Settings saved");
 }
 
+// Section names of the profiles file, for the Profile button
+static void loadProfiles(void)
+{
+    profile_names.clear();
+    File file = SDCard().open(BOOT_GUI_PROFILES_FILE, FILE_READ);
+    if (!file) {
+        return;
+    }
+    while (file.available()) {
+        String line = file.readStringUntil('\n');
+        line.trim();
+        int end = line.indexOf(']');
+        if (line.startsWith("[") && end > 1 && !line.startsWith("[app:")) {
+            profile_names.push_back(line.substring(1, end).c_str());
+        }
+    }
+    file.close();
+    Serial.printf("[BOOT_GUI] %d performance profiles\n", (int)profile_names.size());
+}
+
+// Next profile for the Profile button: defaults, then each section in turn
+static void nextProfile(void)
+{
+    size_t i = 0;
+    if (profile_name[0]) {
+        while (i < profile_names.size() && profile_names[i] != profile_name) {
+            i++;
+        }
+        i++;
+    }
+    if (i < profile_names.size()) {
+        strncpy(profile_name, profile_names[i].c_str(), sizeof(profile_name) - 1);
+    } else {
+        profile_name[0] = '\0';
+    }
+    Serial.printf("[BOOT_GUI] Selected profile: %s\n", profile_name[0] ? profile_name : "Default");
+}
+
 // ============================================================================
 // File Scanning
 // ============================================================================
@@ -225,98 +342,196 @@ static bool hasExtension(const char* filename, const char* ext)
     return strcasecmp(dot, ext) == 0;
 }
 
-static void scanDiskFiles(void)
+// ============================================================================
+// Image Index
+// ============================================================================
+
+/*
+ *  The disk and CD-ROM images found on the card are kept in an index file,
+ *  so the lists are there at once on the next boot. A scan task on Core 0
+ *  walks the card again while the countdown runs, reading only directory
+ *  entries (POSIX readdir() opens no files) and stat()ing only images. If
+ *  it finds anything different (added, removed, resized or rewritten
+ *  images), it rewrites the index and the lists are replaced. FAT keeps no
+ *  change time for directories, so this walk is how the index is checked.
+ */
+
+static bool isImageFile(const char* name, bool* cdrom)
 {
-    Serial.println("[BOOT_GUI] Scanning for disk images...");
-    disk_files.clear();
-    
-    File root = SD.open("/");
-    if (!root) {
-        Serial.println("[BOOT_GUI] ERROR: Cannot open SD root");
+    if (hasExtension(name, ".dsk") || hasExtension(name, ".img")) {
+        *cdrom = false;
+        return true;
+    }
+    if (hasExtension(name, ".iso") || hasExtension(name, ".cue")) {
+        *cdrom = true;
+        return true;
+    }
+    return false;
+}
+
+static bool loadIndex(std::vector<image_entry>& entries)
+{
+    entries.clear();
+    File file = SDCard().open(INDEX_FILE, FILE_READ);
+    if (!file) {
+        return false;
+    }
+    bool valid = false;
+    while (file.available()) {
+        String line = file.readStringUntil('\n');
+        line.trim();
+        if (line == INDEX_HEADER) {
+            valid = true;
+            continue;
+        }
+        
+        // <disk|cdrom> <size> <mtime> <path>
+        char type[8];
+        unsigned size, mtime;
+        int path_pos = 0;
+        if (!valid || sscanf(line.c_str(), "%7s %u %u %n", type, &size, &mtime, &path_pos) != 3 || path_pos == 0) {
+            continue;
+        }
+        image_entry entry;
+        entry.path = line.c_str() + path_pos;
+        entry.size = size;
+        entry.mtime = mtime;
+        entry.cdrom = (strcmp(type, "cdrom") == 0);
+        entries.push_back(entry);
+    }
+    file.close();
+    return valid;
+}
+
+static void saveIndex(const std::vector<image_entry>& entries)
+{
+    File file = SDCard().open(INDEX_FILE, FILE_WRITE);
+    if (!file) {
+        Serial.println("[BOOT_GUI] ERROR: Cannot write the image index");
+        return;
+    }
+    file.printf("%s\n", INDEX_HEADER);
+    for (size_t i = 0; i < entries.size(); i++) {
+        file.printf("%s %u %u %s\n", entries[i].cdrom ? "cdrom" : "disk",
+                    (unsigned)entries[i].size, (unsigned)entries[i].mtime, entries[i].path.c_str());
+    }
+    file.close();
+}
+
+/*
+ *  Collect the images of a directory and its subdirectories
+ *  (path is relative to the card, "" for the root)
+ */
+static void scanDirectory(const std::string& path, int depth, std::vector<image_entry>& entries,
+                          int& disks, int& cdroms)
+{
+    std::string dir_path = std::string(SD_MOUNT_POINT) + (path.empty() ? "/" : path);
+    DIR* dir = opendir(dir_path.c_str());
+    if (!dir) {
         return;
     }
     
-    while (true) {
-        File entry = root.openNextFile();
-        if (!entry) {
-            break;
+    std::vector<std::string> subdirs;
+    struct dirent* de;
+    while ((de = readdir(dir)) != NULL) {
+        // Skip hidden files and directories (starting with '.')
+        if (de->d_name[0] == '.') {
+            continue;
         }
-        
-        if (!entry.isDirectory()) {
-            const char* name = entry.name();
-            // Skip hidden files (starting with '.')
-            if (name[0] == '.') {
-                entry.close();
-                continue;
-            }
-            if (hasExtension(name, ".dsk") || hasExtension(name, ".img")) {
-                // Store with leading slash for full path
-                std::string path = "/";
-                path += name;
-                disk_files.push_back(path);
-                Serial.printf("[BOOT_GUI] Found disk: %s\n", path.c_str());
+        std::string child = path + "/" + de->d_name;
+        if (de->d_type == DT_DIR) {
+            if (depth < BOOT_GUI_SCAN_DEPTH && strcmp(de->d_name, "System Volume Information") != 0) {
+                subdirs.push_back(child);
             }
+            continue;
         }
-        entry.close();
         
-        if (disk_files.size() >= BOOT_GUI_MAX_FILES) {
-            break;
+        bool cdrom;
+        if (!isImageFile(de->d_name, &cdrom) || (cdrom ? cdroms : disks) >= BOOT_GUI_MAX_FILES) {
+            continue;
         }
+        struct stat st;
+        if (stat((SD_MOUNT_POINT + child).c_str(), &st) != 0) {
+            continue;
+        }
+        image_entry entry;
+        entry.path = child;
+        entry.size = (uint32_t)st.st_size;
+        entry.mtime = (uint32_t)st.st_mtime;
+        entry.cdrom = cdrom;
+        entries.push_back(entry);
+        (cdrom ? cdroms : disks)++;
     }
-    root.close();
-    
-    Serial.printf("[BOOT_GUI] Found %d disk images\n", disk_files.size());
+    closedir(dir);
     
-    // Find index of currently selected disk
-    disk_selection_index = 0;
-    for (size_t i = 0; i < disk_files.size(); i++) {
-        if (disk_files[i] == selected_disk_path) {
-            disk_selection_index = i;
-            break;
+    // Root images first, then each subdirectory's
+    for (size_t i = 0; i < subdirs.size(); i++) {
+        scanDirectory(subdirs[i], depth + 1, entries, disks, cdroms);
+    }
+}
+
+static void scanImageFiles(std::vector<image_entry>& entries)
+{
+    uint32_t start = millis();
+    int disks = 0, cdroms = 0;
+    entries.clear();
+    scanDirectory("", 0, entries, disks, cdroms);
+    Serial.printf("[BOOT_GUI] Scanned the card in %u ms: %d disk images, %d CD-ROM images\n",
+                  (unsigned)(millis() - start), disks, cdroms);
+}
+
+static bool sameEntries(const std::vector<image_entry>& a, const std::vector<image_entry>& b)
+{
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].path != b[i].path || a[i].size != b[i].size ||
+            a[i].mtime != b[i].mtime || a[i].cdrom != b[i].cdrom) {
+            return false;
         }
     }
+    return true;
 }
 
-static void scanCDROMFiles(void)
+static void scanTask(void* param)
 {
-    Serial.println("[BOOT_GUI] Scanning for CD-ROM images...");
+    (void)param;
+    scanImageFiles(scan_entries);
+    scan_changed = !sameEntries(scan_entries, index_entries);
+    if (scan_changed) {
+        Serial.println("[BOOT_GUI] Image index out of date, rewriting it");
+        saveIndex(scan_entries);
+    }
+    __atomic_store_n(&scan_done, true, __ATOMIC_RELEASE);
+    vTaskDelete(NULL);
+}
+
+/*
+ *  Fill the GUI lists from the index entries
+ */
+static void setImageLists(const std::vector<image_entry>& entries)
+{
+    disk_files.clear();
     cdrom_files.clear();
-    
-    File root = SD.open("/");
-    if (!root) {
-        Serial.println("[BOOT_GUI] ERROR: Cannot open SD root");
-        return;
+    for (size_t i = 0; i < entries.size(); i++) {
+        (entries[i].cdrom ? cdrom_files : disk_files).push_back(entries[i].path);
     }
     
-    while (true) {
-        File entry = root.openNextFile();
-        if (!entry) {
-            break;
-        }
-        
-        if (!entry.isDirectory()) {
-            const char* name = entry.name();
-            // Skip hidden files (starting with '.')
-            if (name[0] == '.') {
-                entry.close();
-                continue;
-            }
-            if (hasExtension(name, ".iso")) {
-                std::string path = "/";
-                path += name;
-                cdrom_files.push_back(path);
-                Serial.printf("[BOOT_GUI] Found CD-ROM: %s\n", path.c_str());
-            }
-        }
-        entry.close();
-        
-        if (cdrom_files.size() >= BOOT_GUI_MAX_FILES) {
+    // Find index of currently selected disk
+    disk_selection_index = 0;
+    for (size_t i = 0; i < disk_files.size(); i++) {
+        if (disk_files[i] == selected_disk_path) {
+            disk_selection_index = i;
             break;
         }
     }
-    root.close();
     
-    Serial.printf("[BOOT_GUI] Found %d CD-ROM images\n", cdrom_files.size());
+    // If no disk is selected but we found some, select the first one
+    if (strlen(selected_disk_path) == 0 && disk_files.size() > 0) {
+        strncpy(selected_disk_path, disk_files[0].c_str(), BOOT_GUI_MAX_PATH - 1);
+        disk_selection_index = 0;
+    }
     
     // Find index of currently selected CD-ROM (0 = None)
     cdrom_selection_index = 0;
@@ -330,6 +545,32 @@ static void scanCDROMFiles(void)
     }
 }
 
+/*
+ *  Take the scan task's result once it is done (GUI task only)
+ *  With wait, block until it is done
+ */
+static void applyScan(bool wait)
+{
+    if (!scan_running) {
+        return;
+    }
+    if (wait) {
+        while (!__atomic_load_n(&scan_done, __ATOMIC_ACQUIRE)) {
+            delay(5);
+        }
+    } else if (!__atomic_load_n(&scan_done, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+    scan_running = false;
+    if (scan_changed) {
+        index_entries.swap(scan_entries);
+        setImageLists(index_entries);
+        disk_scroll_offset = 0;
+        cdrom_scroll_offset = 0;
+    }
+    scan_entries.clear();
+}
+
 // ============================================================================
 // Drawing Functions - Desktop Pattern
 // ============================================================================
@@ -597,6 +838,8 @@ static void runCountdownScreen(void)
     bool settings_requested = false;
     
     while (countdown > 0 && !settings_requested) {
+        applyScan(false);
+        
         // Handle touch input FIRST (before drawing, so M5.update() is fresh)
         M5.update();
         auto touch = M5.Touch.getDetail();
@@ -643,7 +886,7 @@ static void runCountdownScreen(void)
         
         // Draw countdown text - large
         char countdown_text[32];
-        sprintf(countdown_text, "Starting in %d...", countdown);
+        sprintf(countdown_text, resume_session ? "Resuming in %d..." : "Starting in %d...", countdown);
         canvas->setTextSize(4);
         canvas->drawString(countdown_text, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 - 80);
         
@@ -658,9 +901,16 @@ static void runCountdownScreen(void)
             sprintf(info, "Disk: %s", disk_name);
             canvas->drawString(info, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
             
-            sprintf(info, "RAM: %d MB", selected_ram_mb);
+            if (profile_name[0]) {
+                snprintf(info, sizeof(info), "RAM: %d MB, profile: %s", selected_ram_mb, profile_name);
+            } else {
+                sprintf(info, "RAM: %d MB", selected_ram_mb);
+            }
             canvas->drawString(info, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 40);
         }
+        if (resume_session) {
+            canvas->drawString("Saved session (settings: cold boot)", SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 80);
+        }
         
         // Draw button - huge at bottom
         drawButton(btn_x, btn_y, btn_w, btn_h, "Change Settings", button_pressed);
@@ -678,6 +928,8 @@ static void runCountdownScreen(void)
     }
     
     if (settings_requested) {
+        // The settings may not match the saved session, so boot from disk
+        resume_session = false;
         runSettingsScreen();
     }
 }
@@ -715,6 +967,19 @@ static void runSettingsScreen(void)
     int boot_btn_x = (SCREEN_WIDTH - boot_btn_w) / 2;
     int boot_btn_y = SCREEN_HEIGHT - boot_btn_h - SCREEN_MARGIN;
     
+    // Benchmark button - bottom right, boots after running the CPU benchmark
+    int bench_btn_w = 260;
+    int bench_btn_h = boot_btn_h;
+    int bench_btn_x = SCREEN_WIDTH - bench_btn_w - SCREEN_MARGIN;
+    int bench_btn_y = boot_btn_y;
+    
+    // Profile button - bottom left, cycles through the profiles file's sections
+    bool show_profile = !profile_names.empty();
+    int prof_btn_w = bench_btn_w;
+    int prof_btn_h = boot_btn_h;
+    int prof_btn_x = SCREEN_MARGIN;
+    int prof_btn_y = boot_btn_y;
+    
     // Debug: Print layout info
     Serial.printf("[BOOT_GUI] Layout: list_y=%d, list_h=%d, item_height=%d\n", list_y, list_h, LIST_ITEM_HEIGHT);
     Serial.printf("[BOOT_GUI] Disk list: x=%d-%d, y=%d-%d\n", disk_list_x, disk_list_x + list_w, list_y, list_y + list_h);
@@ -732,6 +997,10 @@ static void runSettingsScreen(void)
     
     bool boot_pressed = false;
     bool boot_touch_started = false;
+    bool bench_pressed = false;
+    bool bench_touch_started = false;
+    bool prof_pressed = false;
+    bool prof_touch_started = false;
     bool should_boot = false;
     
     // Touch state - save position on press for use on release
@@ -742,6 +1011,11 @@ static void runSettingsScreen(void)
     bool touch_in_boot_btn = false;
     
     while (!should_boot) {
+        // The lists change only between touches
+        if (!touch_in_disk_list && !touch_in_cdrom_list) {
+            applyScan(false);
+        }
+        
         // Handle touch input FIRST (before drawing)
         M5.update();
         auto touch = M5.Touch.getDetail();
@@ -759,6 +1033,16 @@ static void runSettingsScreen(void)
                 boot_pressed = true;
             }
             
+            if (isPointInRect(touch_start_x, touch_start_y, bench_btn_x, bench_btn_y, bench_btn_w, bench_btn_h)) {
+                bench_touch_started = true;
+                bench_pressed = true;
+            }
+            
+            if (show_profile && isPointInRect(touch_start_x, touch_start_y, prof_btn_x, prof_btn_y, prof_btn_w, prof_btn_h)) {
+                prof_touch_started = true;
+                prof_pressed = true;
+            }
+            
             Serial.printf("[BOOT_GUI] Touch start at (%d, %d) disk=%d cdrom=%d boot=%d\n", 
                           touch_start_x, touch_start_y, touch_in_disk_list, touch_in_cdrom_list, touch_in_boot_btn);
         }
@@ -773,6 +1057,18 @@ static void runSettingsScreen(void)
                 Serial.println("[BOOT_GUI] Boot button pressed");
             }
             
+            // Check Benchmark button
+            if (bench_touch_started) {
+                benchmark_once = true;
+                should_boot = true;
+                Serial.println("[BOOT_GUI] Benchmark button pressed");
+            }
+            
+            // Check Profile button
+            if (prof_touch_started) {
+                nextProfile();
+            }
+            
             // Check disk list click (use saved start position)
             if (touch_in_disk_list) {
                 int clicked_item = (touch_start_y - list_y - 2) / LIST_ITEM_HEIGHT + disk_scroll_offset;
@@ -810,7 +1106,7 @@ static void runSettingsScreen(void)
             // Check RAM radio buttons (use saved start position)
             // Use same layout calculation as drawing
             int radio_start_x = ram_x + 120;
-            int radio_gap = (SCREEN_WIDTH - radio_start_x - SCREEN_MARGIN) / 4;
+            int radio_gap = (SCREEN_WIDTH - radio_start_x - SCREEN_MARGIN) / 6;
             int radio_y_hit = ram_y;
             int radio_hit_w = radio_gap - 10;  // Hit area width
             int radio_hit_h = RADIO_SIZE + 20;  // Hit area height
@@ -827,6 +1123,12 @@ static void runSettingsScreen(void)
             } else if (isPointInRect(touch_start_x, touch_start_y, radio_start_x + radio_gap * 3, radio_y_hit, radio_hit_w, radio_hit_h)) {
                 selected_ram_mb = 16;
                 Serial.println("[BOOT_GUI] Selected RAM: 16 MB");
+            } else if (isPointInRect(touch_start_x, touch_start_y, radio_start_x + radio_gap * 4, radio_y_hit, radio_hit_w, radio_hit_h)) {
+                selected_ram_mb = 24;
+                Serial.println("[BOOT_GUI] Selected RAM: 24 MB");
+            } else if (isPointInRect(touch_start_x, touch_start_y, radio_start_x + radio_gap * 5, radio_y_hit, radio_hit_w, radio_hit_h)) {
+                selected_ram_mb = 32;
+                Serial.println("[BOOT_GUI] Selected RAM: 32 MB");
             }
             
             // Reset touch state
@@ -835,12 +1137,22 @@ static void runSettingsScreen(void)
             touch_in_boot_btn = false;
             boot_touch_started = false;
             boot_pressed = false;
+            bench_touch_started = false;
+            bench_pressed = false;
+            prof_touch_started = false;
+            prof_pressed = false;
         }
         
         // Update boot button visual while held
         if (touch.isPressed() && boot_touch_started) {
             boot_pressed = isPointInRect(touch.x, touch.y, boot_btn_x, boot_btn_y, boot_btn_w, boot_btn_h);
         }
+        if (touch.isPressed() && bench_touch_started) {
+            bench_pressed = isPointInRect(touch.x, touch.y, bench_btn_x, bench_btn_y, bench_btn_w, bench_btn_h);
+        }
+        if (touch.isPressed() && prof_touch_started) {
+            prof_pressed = isPointInRect(touch.x, touch.y, prof_btn_x, prof_btn_y, prof_btn_w, prof_btn_h);
+        }
         
         // Draw screen - simple gray background
         canvas->fillScreen(MAC_LIGHT_GRAY);
@@ -873,15 +1185,30 @@ static void runSettingsScreen(void)
         
         // Draw RAM radio buttons - spread across screen for easy touch
         int radio_start_x = ram_x + 120;
-        int radio_gap = (SCREEN_WIDTH - radio_start_x - SCREEN_MARGIN) / 4;
+        int radio_gap = (SCREEN_WIDTH - radio_start_x - SCREEN_MARGIN) / 6;
         drawRadioButton(radio_start_x, ram_y, "4 MB", selected_ram_mb == 4);
         drawRadioButton(radio_start_x + radio_gap, ram_y, "8 MB", selected_ram_mb == 8);
         drawRadioButton(radio_start_x + radio_gap * 2, ram_y, "12 MB", selected_ram_mb == 12);
         drawRadioButton(radio_start_x + radio_gap * 3, ram_y, "16 MB", selected_ram_mb == 16);
+        drawRadioButton(radio_start_x + radio_gap * 4, ram_y, "24 MB", selected_ram_mb == 24);
+        drawRadioButton(radio_start_x + radio_gap * 5, ram_y, "32 MB", selected_ram_mb == 32);
         
         // Draw Boot button
         drawButton(boot_btn_x, boot_btn_y, boot_btn_w, boot_btn_h, "Boot", boot_pressed);
         
+        // Draw Benchmark button
+        drawButton(bench_btn_x, bench_btn_y, bench_btn_w, bench_btn_h, "Benchmark", bench_pressed);
+        
+        // Draw Profile button
+        if (show_profile) {
+            char label[16];
+            snprintf(label, sizeof(label), "%.10s", profile_name[0] ? profile_name : "Default");
+            drawButton(prof_btn_x, prof_btn_y, prof_btn_w, prof_btn_h, label, prof_pressed);
+            canvas->setTextSize(2);
+            canvas->setTextDatum(BL_DATUM);
+            canvas->drawString("Profile:", prof_btn_x, prof_btn_y - 6);
+        }
+        
         // Push to display
         canvas->pushSprite(0, 0);
         
@@ -889,6 +1216,7 @@ static void runSettingsScreen(void)
     }
     
     // Save settings before booting
+    applyScan(true);
     saveSettings();
 }
 
@@ -926,16 +1254,27 @@ bool BootGUI_Init(void)
     
     // Load saved settings
     loadSettings();
+    loadProfiles();
     
-    // Scan for disk files
-    scanDiskFiles();
-    scanCDROMFiles();
+    // Hibernated session to resume
+    resume_session = SDCard().exists(STATE_FILE);
+    if (resume_session) {
+        Serial.println("[BOOT_GUI] Found a saved session");
+    }
     
-    // If no disk is selected but we found some, select the first one
-    if (strlen(selected_disk_path) == 0 && disk_files.size() > 0) {
-        strncpy(selected_disk_path, disk_files[0].c_str(), BOOT_GUI_MAX_PATH - 1);
-        disk_selection_index = 0;
+    // Disk and CD-ROM images: from the index, checked by a scan on Core 0
+    // while the countdown runs. Without an index the card is walked now.
+    if (loadIndex(index_entries)) {
+        Serial.printf("[BOOT_GUI] Image index: %d entries\n", (int)index_entries.size());
+        if (!skip_gui) {
+            scan_done = false;
+            scan_running = xTaskCreatePinnedToCore(scanTask, "ImageScan", 6144, NULL, 1, NULL, 0) == pdPASS;
+        }
+    } else {
+        scanImageFiles(index_entries);
+        saveIndex(index_entries);
     }
+    setImageLists(index_entries);
     
     gui_initialized = true;
     Serial.println("[BOOT_GUI] Initialization complete");
@@ -953,8 +1292,8 @@ void BootGUI_Run(void)
     // Check if we should skip the GUI
     if (skip_gui) {
         Serial.println("[BOOT_GUI] skip_gui=yes, skipping boot GUI");
-        Serial.printf("[BOOT_GUI] Using saved settings: disk=%s, ram=%dMB\n", 
-                      selected_disk_path, selected_ram_mb);
+        Serial.printf("[BOOT_GUI] Using saved settings: disk=%s, ram=%dMB%s\n", 
+                      selected_disk_path, selected_ram_mb, resume_session ? ", resuming" : "");
         
         // Cleanup canvas since we won't use it
         if (canvas) {
@@ -969,6 +1308,7 @@ void BootGUI_Run(void)
     
     // Run countdown screen (may transition to settings screen)
     runCountdownScreen();
+    applyScan(true);
     
     // Cleanup canvas
     if (canvas) {
@@ -999,3 +1339,53 @@ int BootGUI_GetRAMSizeMB(void)
 {
     return selected_ram_mb;
 }
+
+bool BootGUI_GetBenchmark(void)
+{
+    return benchmark_setting || benchmark_once;
+}
+
+bool BootGUI_GetFPUFast(void)
+{
+    return fpufast_setting;
+}
+
+bool BootGUI_GetNativeScreen(void)
+{
+    return native_screen;
+}
+
+bool BootGUI_GetResume(void)
+{
+    return resume_session;
+}
+
+const char* BootGUI_GetWiFiSSID(void)
+{
+    return wifi_ssid;
+}
+
+const char* BootGUI_GetWiFiPassword(void)
+{
+    return wifi_password;
+}
+
+bool BootGUI_GetUDPTunnel(void)
+{
+    return udp_tunnel_setting;
+}
+
+const char* BootGUI_GetSerialA(void)
+{
+    return serial_a;
+}
+
+const char* BootGUI_GetSerialB(void)
+{
+    return serial_b;
+}
+
+const char* BootGUI_GetProfile(void)
+{
+    return profile_name;
+}
@@ -44,6 +44,11 @@ using std::vector;
 #include "sys.h"
 #include "prefs.h"
 #include "cdrom.h"
+#include "savestate.h"
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#endif
 
 #define DEBUG 0
 #include "debug.h"
@@ -123,12 +128,84 @@ static const uint8 bcd2bin[256] = {
 };
 
 
+#if CDROM_BUFFER_SIZE
+/*
+ *  Track buffer
+ *
+ *  Like the read-ahead buffer of a real drive: a read that misses the buffer
+ *  and continues the previous one fills all CDROM_BUFFER_SIZE bytes from the
+ *  requested sector on in one transfer, any other miss reads
+ *  CDROM_SEEK_READ bytes. The many small sequential reads of installers and
+ *  games are then copied out of PSRAM. Sys_read() of CD-ROM handles bypasses
+ *  the disk block cache, so streaming a CD never evicts hard disk blocks.
+ */
+#define CDROM_SEEK_READ (32 * 1024)
+
+static uint8 *track_buffer = NULL;	// CDROM_BUFFER_SIZE bytes, NULL: direct reads
+static void *track_fh = NULL;		// File the buffer holds data of
+static loff_t track_start = 0;		// Image offset of the buffer
+static size_t track_length = 0;		// Valid bytes in the buffer
+static loff_t track_next = -1;		// Image offset where the last read ended
+
+static void track_drop(void *fh)
+{
+	if (track_fh == fh) {
+		track_fh = NULL;
+		track_length = 0;
+		track_next = -1;
+	}
+}
+
+static size_t track_read(void *fh, uint8 *buffer, loff_t offset, size_t length)
+{
+	if (track_buffer == NULL || length >= CDROM_BUFFER_SIZE)
+		return Sys_read(fh, buffer, offset, length);
+
+	size_t done = 0;
+	while (done < length) {
+		loff_t pos = offset + done;
+		if (track_fh != fh || pos < track_start || pos >= track_start + (loff_t)track_length) {
+			size_t want = (pos == track_next) ? CDROM_BUFFER_SIZE : CDROM_SEEK_READ;
+			if (want < length - done)
+				want = CDROM_BUFFER_SIZE;
+			track_fh = fh;
+			track_start = pos & ~0x7ff;
+			track_length = Sys_read(fh, track_buffer, track_start, want);
+			if (pos >= track_start + (loff_t)track_length)
+				break;
+		}
+		size_t n = track_start + track_length - pos;
+		if (n > length - done)
+			n = length - done;
+		memcpy(buffer + done, track_buffer + (pos - track_start), n);
+		done += n;
+	}
+	track_next = offset + done;
+
+	// Sys_read() does this for reads straight into Mac RAM
+	if (done > 0)
+		FlushCodeCache(buffer, done);
+	return done;
+}
+#else
+static inline void track_drop(void *fh)
+{
+	UNUSED(fh);
+}
+
+static inline size_t track_read(void *fh, uint8 *buffer, loff_t offset, size_t length)
+{
+	return Sys_read(fh, buffer, offset, length);
+}
+#endif
+
+
 // Struct for each drive
 struct cdrom_drive_info {
 	cdrom_drive_info() : num(0), fh(NULL), start_byte(0), status(0), drop(false), init_null(false), driver_reference_number(0) {}
 	cdrom_drive_info(void *fh_) : num(0), fh(fh_), start_byte(0), status(0), drop(false), init_null(false), driver_reference_number(0) {}
 	
-	void close_fh(void) { SysAllowRemoval(fh); Sys_close(fh); }
+	void close_fh(void) { SysAllowRemoval(fh); track_drop(fh); Sys_close(fh); }
 	
 	int num;			// Drive number
 	void *fh;			// File handle
@@ -197,9 +274,9 @@ static void find_hfs_partition(cdrom_drive_info &info)
 	uint8 *map = new uint8[512];
 	D(bug("Looking for HFS partitions on CD-ROM...\n"));
 	
-	// Search first 64 blocks for HFS partition
+	// Search first 64 blocks for HFS partition (one read into the track buffer)
 	for (int i=0; i<64; i++) {
-		if (Sys_read(info.fh, map, i * 512, 512) != 512)
+		if (track_read(info.fh, map, i * 512, 512) != 512)
 			break;
 		D(bug(" block %d, signature '%c%c' (%02x%02x)\n", i, map[0], map[1], map[0], map[1]));
 		
@@ -316,6 +393,15 @@ static bool position2msf(const cdrom_drive_info &info, uint16 postype, uint32 po
 void CDROMInit(void)
 {
 	SysAddCDROMPrefs();
+
+#if CDROM_BUFFER_SIZE
+#ifdef ARDUINO
+	track_buffer = (uint8 *)heap_caps_aligned_alloc(64, CDROM_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+#else
+	track_buffer = (uint8 *)malloc(CDROM_BUFFER_SIZE);
+#endif
+	D(bug("CD-ROM track buffer %p\n", track_buffer));
+#endif
 	
 	// Add drives specified in preferences
 	int index = 0;
@@ -357,7 +443,51 @@ void CDROMExit(void)
 	for (info = drives.begin(); info != end; ++info)
 		info->close_fh();
 	drives.clear();
+
+#if CDROM_BUFFER_SIZE
+#ifdef ARDUINO
+	heap_caps_free(track_buffer);
+#else
+	free(track_buffer);
+#endif
+	track_buffer = NULL;
+#endif
+}
+
+
+#if SAVE_STATE
+/*
+ *  Drive state for hibernate/resume. The drives must be the ones the
+ *  snapshot was taken with, in the same order.
+ */
+
+void CDROMStateIO(savestate *s)
+{
+	uint32 count = drives.size();
+	savestate_var(s, count);
+	if (count != drives.size()) {
+		savestate_fail(s, "CD-ROM drives changed");
+		return;
+	}
+	drive_vec::iterator info, end = drives.end();
+	for (info = drives.begin(); info != end; ++info) {
+		savestate_var(s, info->num);
+		savestate_var(s, info->to_be_mounted);
+		savestate_var(s, info->status);
+		savestate_var(s, info->mount_non_hfs);
+		savestate_var(s, info->stop_at);
+		savestate_var(s, info->start_at);
+		savestate_var(s, info->play_mode);
+		savestate_var(s, info->play_order);
+		savestate_var(s, info->repeat);
+		savestate_var(s, info->power_mode);
+		savestate_var(s, info->drop);
+		savestate_var(s, info->init_null);
+		savestate_var(s, info->driver_reference_number);
+	}
+	savestate_var(s, acc_run_called);
 }
+#endif
 
 
 /*
@@ -419,7 +549,7 @@ static void mount_mountable_volumes(void)
 			M68kRegisters r;
 			r.d[0] = info->num;
 			r.a[0] = 7;	// diskEvent
-			Execute68kTrap(0xa02f, &r);		// PostEvent()
+			Execute68kTrapRegs(0xa02f, &r, M68K_REG_D(0) | M68K_REG_A(0), 0);	// PostEvent()
 			info->to_be_mounted = false;
 		}
 	}
@@ -604,7 +734,7 @@ int16 CDROMPrime(uint32 pb, uint32 dce)
 	if ((ReadMacInt16(pb + ioTrap) & 0xff) == aRdCmd) {
 		
 		// Read
-		actual = Sys_read(info->fh, buffer, position + info->start_byte, length);
+		actual = track_read(info->fh, (uint8 *)buffer, position + info->start_byte, length);
 		if (actual != length) {
 			
 			// Read error, tried to read HFS root block?
@@ -674,6 +804,7 @@ int16 CDROMControl(uint32 pb, uint32 dce)
 		case 7:			// EjectTheDisc
 			D(bug("CDROMControl EjectTheDisc\n"));
 			if (ReadMacInt8(info->status + dsDiskInPlace) > 0) {
+				track_drop(info->fh);
 				if (info->drop || !SysIsFixedDisk(info->fh)) {
 					SysAllowRemoval(info->fh);
 					SysEject(info->fh);
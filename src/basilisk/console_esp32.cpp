@@ -0,0 +1,477 @@
+/*
+ *  console_esp32.cpp - Command console on the USB serial port
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The CPU task used to read the console one character at a time, and the
+ *  counters were only seen in the reports printed every 5 seconds. A task
+ *  on Core 0 now reads whole lines from the USB port and answers them
+ *  itself:
+ *
+ *    stats [name]          counters and histograms of perf_registry.cpp
+ *    reset                 start the counts and histograms from zero
+ *    tasks                 busy %, run slices and stalls of the Core 0 tasks
+ *    traps [n]             the n A-line traps with the most time (trap_profile.cpp)
+ *    get [name]            tunables, with their ranges
+ *    set <name> <value>    change a tunable, used from the next pass
+ *    report on|off         the periodic reports
+ *    hud on|off            the on-screen performance HUD (hud_esp32.cpp)
+ *    move <x> <y>          scripted input, posted by the input task: pointer
+ *    button down|up [b]    to Mac coordinates, a mouse button, a click
+ *    click <x> <y> [n]     (n = 2: double click) or a Mac key code, pressed
+ *    key <code> [down|up]  and released unless down or up is given
+ *    mode text|raw         raw: each reply is one "@<command> name=value..." line
+ *    help
+ *
+ *  A line of one character is a debug command (p, r, t, T, x, f, h, v, V,
+ *  d, D, i, I, e, E, y, m, M, see main_esp32.cpp). It is queued for the CPU task, which
+ *  runs it at its next tick check as before.
+ *
+ *  Counts are shown since the last reset, with their rate per second over
+ *  that time; gauges as last set. The tunables are the prefs of a
+ *  performance profile (see prefs_esp32.cpp) plus the disk cache's
+ *  read-ahead and dirty limit. Each module registers its own variables; the
+ *  console only reads and writes them, one aligned 32-bit word at a time.
+ *
+ *  Milestones are printed as "[MARK] <name> ms=<millis>" ("@mark" in raw
+ *  mode): "cpu" when the 68k starts, "events" at the first GetNextEvent or
+ *  WaitNextEvent, "launch" at each _Launch and "replay" at the end of an
+ *  input replay (see adb.cpp). tools/bench_harness.py times boots and
+ *  application launches from them and the scripted input.
+ *
+ *  While a Mac serial port is on USB, the input is the Mac's and the
+ *  console reads nothing.
+ */
+
+#include "sysdeps.h"
+#include "prefs.h"
+#include "serial.h"
+#include "console.h"
+#include "perf_registry.h"
+#include "hud.h"
+#include "task_stats.h"
+#include "trap_profile.h"
+#include "input.h"
+#include "main.h"
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#if SERIAL_CONSOLE
+
+#define CONSOLE_TASK_STACK_SIZE 4096
+#define CONSOLE_TASK_PRIORITY   1
+#define CONSOLE_TASK_CORE       0
+#define CONSOLE_POLL_MS         20
+#define CONSOLE_LINE_MAX        80
+#define CONSOLE_MAX_TUNABLES    24
+#define CONSOLE_COMMANDS        8       // Debug commands waiting for the CPU task
+#define CONSOLE_ARGS            4
+#define CONSOLE_CLICKS_MAX      3
+
+struct console_tunable {
+    const char *name;
+    volatile uint32 *value;
+    uint32 min, max;
+};
+
+static console_tunable tunables[CONSOLE_MAX_TUNABLES];
+static volatile int num_tunables = 0;
+static QueueHandle_t command_queue = NULL;
+static task_stats *const console_task_stats = TaskStats("console");
+static volatile bool reports = true;
+static bool raw_mode = false;
+static uint32 reset_ms = 0;             // millis() at the last "reset" (console task)
+static bool events_marked = false;      // "events" printed (CPU task)
+
+
+/*
+ *  Registration (init, before the values are used)
+ */
+
+void ConsoleAddTunable(const char *name, volatile uint32 *value, uint32 min, uint32 max)
+{
+    int n = num_tunables;
+    for (int i = 0; i < n; i++)
+        if (tunables[i].value == value)
+            return;     // Patches installed again after a Mac reset
+    if (n >= CONSOLE_MAX_TUNABLES) {
+        Serial.printf("[CONSOLE] WARNING: No room for %s\n", name);
+        return;
+    }
+    tunables[n].name = name;
+    tunables[n].value = value;
+    tunables[n].min = min;
+    tunables[n].max = max;
+    num_tunables = n + 1;
+}
+
+static console_tunable *find_tunable(const char *name)
+{
+    for (int i = 0; i < num_tunables; i++) {
+        if (strcmp(tunables[i].name, name) == 0)
+            return &tunables[i];
+    }
+    return NULL;
+}
+
+static void set_tunable(console_tunable *t, uint32 x)
+{
+    *t->value = x < t->min ? t->min : (x > t->max ? t->max : x);
+}
+
+bool ConsoleSetTunable(const char *name, uint32 value, uint32 *old)
+{
+    console_tunable *t = find_tunable(name);
+    if (t == NULL)
+        return false;
+    if (old)
+        *old = *t->value;
+    set_tunable(t, value);
+    return true;
+}
+
+
+/*
+ *  Replies
+ */
+
+// Tunables (all, or the one named) in the current mode
+static void print_tunables(const char *command, const char *name)
+{
+    if (raw_mode)
+        Serial.printf("@%s", command);
+    for (int i = 0; i < num_tunables; i++) {
+        const console_tunable &t = tunables[i];
+        if (name && strcmp(name, t.name) != 0)
+            continue;
+        uint32 x = *t.value;
+        if (raw_mode)
+            Serial.printf(" %s=%u", t.name, x);
+        else
+            Serial.printf("[CONSOLE] %-12s %u (%u-%u)\n", t.name, x, t.min, t.max);
+    }
+    if (raw_mode)
+        Serial.print("\n");
+}
+
+// Registry counters and histograms (all, or those whose name starts with
+// prefix); histograms as samples/p50/p95/p99/max in raw mode
+static void print_stats(const char *prefix)
+{
+    size_t len = prefix ? strlen(prefix) : 0;
+    uint32 ms = millis() - reset_ms;
+    if (raw_mode)
+        Serial.printf("@stats ms=%u", ms);
+    else
+        Serial.printf("[CONSOLE] %.1f s since reset\n", ms / 1000.0f);
+
+    for (int i = 0; i < PerfCounterCount(); i++) {
+        const perf_counter *c = PerfCounterAt(i);
+        if (prefix && strncmp(c->name, prefix, len) != 0)
+            continue;
+        uint32 x = perf_read(c);
+        if (raw_mode)
+            Serial.printf(" %s=%u", c->name, x);
+        else if (c->kind == PERF_COUNT && ms > 0)
+            Serial.printf("[CONSOLE] %-20s %10u  %10.1f/s  core %d\n", c->name, x, x * 1000.0f / ms, c->core);
+        else
+            Serial.printf("[CONSOLE] %-20s %10u              core %d\n", c->name, x, c->core);
+    }
+
+    for (int i = 0; i < PerfHistogramCount(); i++) {
+        const perf_histogram *p = PerfHistogramAt(i);
+        if (prefix && strncmp(p->name, prefix, len) != 0)
+            continue;
+        telemetry_histogram h;
+        if (p->reset)
+            memset(&h, 0, sizeof(h));   // Not cleared by its writer yet
+        else
+            memcpy(&h, (const void *)&p->h, sizeof(h));
+        uint32 p50 = telemetry_percentile(h, 50), p95 = telemetry_percentile(h, 95);
+        uint32 p99 = telemetry_percentile(h, 99);
+        if (raw_mode)
+            Serial.printf(" %s=%u/%u/%u/%u/%u", p->name, h.samples, p50, p95, p99, h.max);
+        else
+            Serial.printf("[CONSOLE] %-20s n=%u p50=%u p95=%u p99=%u max=%u  core %d\n",
+                          p->name, h.samples, p50, p95, p99, h.max, p->core);
+    }
+    if (raw_mode)
+        Serial.print("\n");
+}
+
+#if TASK_STATS
+// Core 0 tasks since the last reset (task_stats_esp32.cpp): busy %, run
+// slices, p99 and longest slice, late wakeups
+static void print_tasks(void)
+{
+    uint32 ms = millis() - reset_ms;
+    if (raw_mode)
+        Serial.printf("@tasks ms=%u", ms);
+    for (int i = 0; i < TaskStatsCount(); i++) {
+        const task_stats *t = TaskStatsAt(i);
+        telemetry_histogram h;
+        if (t->slice_us->reset)
+            memset(&h, 0, sizeof(h));
+        else
+            memcpy(&h, (const void *)&t->slice_us->h, sizeof(h));
+        float busy = ms ? perf_read(t->busy_us) / (ms * 10.0f) : 0.0f;
+        uint32 p99 = telemetry_percentile(h, 99);
+        uint32 stalls = perf_read(t->stalls);
+        if (raw_mode)
+            Serial.printf(" %s=%.1f/%u/%u/%u/%u", t->name, busy, h.samples, p99, h.max, stalls);
+        else
+            Serial.printf("[CONSOLE] %-8s busy %5.1f%%  slices %-7u p99 %-6u max %-7u us  stalls %u\n",
+                          t->name, busy, h.samples, p99, h.max, stalls);
+    }
+    if (raw_mode)
+        Serial.print("\n");
+}
+#endif
+
+static void print_reply(const char *command, const char *text)
+{
+    if (raw_mode)
+        Serial.printf("@%s %s\n", command, text);
+    else
+        Serial.printf("[CONSOLE] %s\n", text);
+}
+
+static void print_error(const char *what, const char *arg)
+{
+    if (raw_mode)
+        Serial.printf("@err %s %s\n", what, arg);
+    else
+        Serial.printf("[CONSOLE] ERROR: %s %s\n", what, arg);
+}
+
+static void print_help(void)
+{
+    if (raw_mode) {
+        Serial.println("@help stats reset tasks traps get set report hud move button click key mode restart help");
+        return;
+    }
+    Serial.println("[CONSOLE] stats [prefix]        counters and histograms (cpu., video., disk.)");
+    Serial.println("[CONSOLE] reset                 start the counters from zero");
+    Serial.println("[CONSOLE] tasks                 busy %, run slices and stalls of the Core 0 tasks");
+    Serial.println("[CONSOLE] traps [n]             A-line traps with the most time");
+    Serial.println("[CONSOLE] get [name]            tunables");
+    Serial.println("[CONSOLE] set <name> <value>    change a tunable");
+    Serial.println("[CONSOLE] report on|off         periodic performance reports");
+    Serial.println("[CONSOLE] hud on|off            on-screen performance HUD");
+    Serial.println("[CONSOLE] move <x> <y>          move the pointer (Mac coordinates)");
+    Serial.println("[CONSOLE] button down|up [b]    press or release a mouse button");
+    Serial.println("[CONSOLE] click <x> <y> [n]     click n times (2: double click)");
+    Serial.println("[CONSOLE] key <code> [down|up]  press and/or release a Mac key code");
+    Serial.println("[CONSOLE] mode text|raw         raw: one @ line per reply, for scripts");
+    Serial.println("[CONSOLE] restart               boot the Mac again (warm: ROM and host stay)");
+    Serial.println("[CONSOLE] p r t T x f h v V d D i I e E y m M: debug commands (see README)");
+}
+
+
+// Reply to a scripted input command, "busy" when the input queue is full
+static void inject_reply(const char *command, bool ok)
+{
+    if (ok)
+        print_reply(command, "ok");
+    else
+        print_error("busy", command);
+}
+
+
+/*
+ *  Commands
+ */
+
+static void run_line(char *line)
+{
+    char *argv[CONSOLE_ARGS];
+    int argc = 0;
+    char *save;
+    for (char *p = strtok_r(line, " \t", &save); p && argc < CONSOLE_ARGS; p = strtok_r(NULL, " \t", &save))
+        argv[argc++] = p;
+    if (argc == 0)
+        return;
+
+    // One character: debug command for the CPU task
+    if (argc == 1 && argv[0][1] == '\0') {
+        char c = argv[0][0];
+        if (xQueueSend(command_queue, &c, 0) != pdTRUE)
+            print_error("busy", argv[0]);
+        return;
+    }
+
+    const char *command = argv[0];
+    if (strcmp(command, "stats") == 0) {
+        print_stats(argc > 1 ? argv[1] : NULL);
+    } else if (strcmp(command, "reset") == 0) {
+        PerfReset();
+#if TRAP_PROFILE
+        trap_profile_reset();
+#endif
+        reset_ms = millis();
+        print_reply("reset", "ok");
+#if TASK_STATS
+    } else if (strcmp(command, "tasks") == 0) {
+        print_tasks();
+#endif
+#if TRAP_PROFILE
+    } else if (strcmp(command, "traps") == 0) {
+        trap_profile_dump(argc > 1 ? atoi(argv[1]) : 20);
+#endif
+    } else if (strcmp(command, "get") == 0) {
+        if (argc > 1 && find_tunable(argv[1]) == NULL)
+            print_error("unknown tunable", argv[1]);
+        else
+            print_tunables("get", argc > 1 ? argv[1] : NULL);
+    } else if (strcmp(command, "set") == 0) {
+        console_tunable *v = argc == 3 ? find_tunable(argv[1]) : NULL;
+        char *end;
+        uint32 x = argc == 3 ? strtoul(argv[2], &end, 0) : 0;
+        if (argc != 3) {
+            print_error("usage:", "set <name> <value>");
+        } else if (v == NULL) {
+            print_error("unknown tunable", argv[1]);
+        } else if (*end != '\0') {
+            print_error("bad value", argv[2]);
+        } else {
+            set_tunable(v, x);
+            print_tunables("set", v->name);
+        }
+    } else if (strcmp(command, "report") == 0 && argc == 2 &&
+               (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "off") == 0)) {
+        reports = (strcmp(argv[1], "on") == 0);
+        print_reply("report", argv[1]);
+#if PERF_HUD
+    } else if (strcmp(command, "hud") == 0 && argc == 2 &&
+               (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "off") == 0)) {
+        HudShow(strcmp(argv[1], "on") == 0);
+        print_reply("hud", argv[1]);
+#endif
+    } else if (strcmp(command, "move") == 0 && argc == 3) {
+        inject_reply("move", InputInject(INPUT_INJECT_MOVE, 0, atoi(argv[1]), atoi(argv[2])));
+    } else if (strcmp(command, "button") == 0 && argc >= 2 &&
+               (strcmp(argv[1], "down") == 0 || strcmp(argv[1], "up") == 0)) {
+        int type = strcmp(argv[1], "down") == 0 ? INPUT_INJECT_BUTTON_DOWN : INPUT_INJECT_BUTTON_UP;
+        inject_reply("button", InputInject(type, argc > 2 ? atoi(argv[2]) & 3 : 0, 0, 0));
+    } else if (strcmp(command, "click") == 0 && argc >= 3) {
+        int n = argc > 3 ? atoi(argv[3]) : 1;
+        n = n < 1 ? 1 : (n > CONSOLE_CLICKS_MAX ? CONSOLE_CLICKS_MAX : n);
+        bool ok = InputInject(INPUT_INJECT_MOVE, 0, atoi(argv[1]), atoi(argv[2]));
+        for (int i = 0; i < n && ok; i++)
+            ok = InputInject(INPUT_INJECT_BUTTON_DOWN, 0, 0, 0) && InputInject(INPUT_INJECT_BUTTON_UP, 0, 0, 0);
+        inject_reply("click", ok);
+    } else if (strcmp(command, "key") == 0 && argc >= 2) {
+        char *end;
+        uint32 code = strtoul(argv[1], &end, 0);
+        bool down = argc < 3 || strcmp(argv[2], "down") == 0;
+        bool up = argc < 3 || strcmp(argv[2], "up") == 0;
+        if (*end != '\0' || code > 0x7f || (!down && !up))
+            print_error("usage:", "key <code> [down|up]");
+        else
+            inject_reply("key", (!down || InputInject(INPUT_INJECT_KEY_DOWN, code, 0, 0)) &&
+                                (!up || InputInject(INPUT_INJECT_KEY_UP, code, 0, 0)));
+    } else if (strcmp(command, "mode") == 0 && argc == 2 &&
+               (strcmp(argv[1], "raw") == 0 || strcmp(argv[1], "text") == 0)) {
+        raw_mode = (strcmp(argv[1], "raw") == 0);
+        print_reply("mode", argv[1]);
+#if WARM_RESTART
+    } else if (strcmp(command, "restart") == 0) {
+        WarmRestart();
+        print_reply("restart", "ok");
+#endif
+    } else if (strcmp(command, "help") == 0) {
+        print_help();
+    } else {
+        print_error("unknown command", command);
+    }
+}
+
+
+/*
+ *  Console task (Core 0)
+ */
+
+static void consoleTask(void *param)
+{
+    (void)param;
+    char line[CONSOLE_LINE_MAX + 1];
+    int len = 0;
+    bool too_long = false;
+
+    while (true) {
+        while (!SerialUSBInUse() && Serial.available() > 0) {
+            int c = Serial.read();
+            if (c == '\r' || c == '\n') {
+                line[len] = '\0';
+                if (too_long)
+                    print_error("line too long", "");
+                else
+                    run_line(line);
+                len = 0;
+                too_long = false;
+            } else if (len < CONSOLE_LINE_MAX) {
+                line[len++] = (char)c;
+            } else {
+                too_long = true;
+            }
+        }
+        task_wait(console_task_stats, CONSOLE_POLL_MS);
+        vTaskDelay(pdMS_TO_TICKS(CONSOLE_POLL_MS));
+        task_run(console_task_stats);
+    }
+}
+
+
+/*
+ *  Interface
+ */
+
+void ConsoleInit(void)
+{
+    reports = PrefsFindBool("perfreport");
+    command_queue = xQueueCreate(CONSOLE_COMMANDS, sizeof(char));
+    if (command_queue == NULL ||
+        xTaskCreatePinnedToCore(consoleTask, "Console", CONSOLE_TASK_STACK_SIZE, NULL,
+                                CONSOLE_TASK_PRIORITY, NULL, CONSOLE_TASK_CORE) != pdPASS) {
+        Serial.println("[CONSOLE] ERROR: Cannot start the console task");
+        return;
+    }
+    Serial.printf("[CONSOLE] Ready, %d counters, %d histograms, %d tunables, type help and Enter\n",
+                  PerfCounterCount(), PerfHistogramCount(), num_tunables);
+}
+
+int ConsoleNextCommand(void)
+{
+    char c;
+    if (command_queue == NULL || xQueueReceive(command_queue, &c, 0) != pdTRUE)
+        return -1;
+    return (unsigned char)c;
+}
+
+bool ConsoleReports(void)
+{
+    return reports;
+}
+
+void ConsoleMark(const char *name)
+{
+    if (raw_mode)
+        Serial.printf("@mark %s ms=%u\n", name, millis());
+    else
+        Serial.printf("[MARK] %s ms=%u\n", name, millis());
+}
+
+void ConsoleTrapMark(uint16 opcode)
+{
+    if (opcode == 0xa9f2) {
+        ConsoleMark("launch");
+    } else if (!events_marked) {
+        events_marked = true;
+        ConsoleMark("events");
+    }
+}
+
+#endif
@@ -0,0 +1,292 @@
+/*
+ *  cursor_esp32.cpp - Cursor overlay instead of a frame buffer cursor
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The ROM draws the cursor into the frame buffer: every mouse move erases
+ *  it from its save-under buffer and draws it at the new position, which
+ *  dirties up to four tiles 60 times a second, and every QuickDraw call on
+ *  the screen shields it first. With USE_CURSOR_OVERLAY the low memory
+ *  cursor vectors (JHideCursor, JShowCursor, JShieldCursor, JSetCrsr,
+ *  JCrsrObscure, JCrsrTask) and SetCCursor() are pointed at EmulOp stubs.
+ *  They keep the cursor globals (CrsrState, CrsrObscure, TheCrsr, Mouse)
+ *  the way the ROM does but never touch the frame buffer. The video task
+ *  composites the cursor sprite into the pushed bands instead (see
+ *  VideoSetCursor()), so cursor motion costs no frame buffer writes.
+ *
+ *  Color cursors are shown in the black and white form every CCrsr carries.
+ */
+
+#include <string.h>
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "emul_op.h"
+#include "video.h"
+#include "cursor.h"
+#include "savestate.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+#if USE_CURSOR_OVERLAY
+
+// Low memory globals
+#define JHideCursor     0x800
+#define JShowCursor     0x804
+#define JShieldCursor   0x808
+#define JSetCrsr        0x818
+#define JCrsrObscure    0x81c
+#define MTemp           0x828
+#define RawMouse        0x82c
+#define Mouse           0x830
+#define CrsrPin         0x834
+#define TheCrsr         0x844
+#define CrsrVis         0x8cc
+#define CrsrNew         0x8ce
+#define CrsrState       0x8d0
+#define CrsrObscure     0x8d2
+#define JCrsrTask       0x8ee
+
+// Traps
+#define TRAP_SETCCURSOR 0xaa1c
+
+// Cursor fields
+#define crsrData        0
+#define crsrMask        32
+#define crsrHotSpot     64
+#define SIZEOF_Cursor   68
+
+// CCrsr fields (black and white version)
+#define ccrsr1Data      20
+#define ccrsrMask       52
+#define ccrsrHotSpot    84
+
+// Stub layout of the patch block
+enum {
+    crHideStub = 0,             // 4 bytes
+    crShowStub = 4,             // 4 bytes
+    crShieldStub = 8,           // 8 bytes
+    crSetStub = 16,             // 8 bytes
+    crObscureStub = 24,         // 4 bytes
+    crTaskStub = 28,            // 4 bytes
+    crSetCCursorStub = 32,      // 8 bytes
+    SIZEOF_crpatch = 40
+};
+
+static uint32 cr_patch = 0;         // Mac address of the patch block
+static int shield_depth = 0;        // ShieldCursor() calls not yet balanced by ShowCursor()
+
+
+/*
+ *  Hand the cursor image, position and visibility to the video task
+ */
+
+static void publish_cursor(void)
+{
+    uint16 data[16], mask[16];
+    for (int i = 0; i < 16; i++) {
+        data[i] = ReadMacInt16(TheCrsr + crsrData + i * 2);
+        mask[i] = ReadMacInt16(TheCrsr + crsrMask + i * 2);
+    }
+    int16 hot_v = ReadMacInt16(TheCrsr + crsrHotSpot);
+    int16 hot_h = ReadMacInt16(TheCrsr + crsrHotSpot + 2);
+    int16 v = ReadMacInt16(Mouse);
+    int16 h = ReadMacInt16(Mouse + 2);
+
+    // Shielding only matters to a frame buffer cursor, the overlay stays up
+    bool visible = (int16)ReadMacInt16(CrsrState) + shield_depth >= 0 && ReadMacInt8(CrsrObscure) == 0;
+    WriteMacInt8(CrsrVis, visible ? 0xff : 0);
+
+    VideoSetCursor(data, mask, h - hot_h, v - hot_v, visible);
+}
+
+
+/*
+ *  VBL cursor task: follow the mouse, pinned to CrsrPin
+ */
+
+static void cursor_task(void)
+{
+    if (ReadMacInt8(CrsrNew) == 0)
+        return;
+    WriteMacInt8(CrsrNew, 0);
+
+    int16 v = ReadMacInt16(MTemp);
+    int16 h = ReadMacInt16(MTemp + 2);
+    int16 top = ReadMacInt16(CrsrPin), left = ReadMacInt16(CrsrPin + 2);
+    int16 bottom = ReadMacInt16(CrsrPin + 4), right = ReadMacInt16(CrsrPin + 6);
+    if (v >= bottom) v = bottom - 1;
+    if (v < top) v = top;
+    if (h >= right) h = right - 1;
+    if (h < left) h = left;
+
+    WriteMacInt16(MTemp, v);
+    WriteMacInt16(MTemp + 2, h);
+    WriteMacInt16(RawMouse, v);
+    WriteMacInt16(RawMouse + 2, h);
+    WriteMacInt16(Mouse, v);
+    WriteMacInt16(Mouse + 2, h);
+
+    // ObscureCursor() lasts until the mouse moves
+    WriteMacInt8(CrsrObscure, 0);
+}
+
+
+/*
+ *  Vector stub entry
+ */
+
+void CursorOp(uint16 opcode, M68kRegisters *r)
+{
+    uint32 sp = r->a[7];
+
+    switch (opcode) {
+        case M68K_EMUL_OP_CURSOR_HIDE:
+            WriteMacInt16(CrsrState, ReadMacInt16(CrsrState) - 1);
+            break;
+        case M68K_EMUL_OP_CURSOR_SHOW: {
+            // Never above 0, as in the ROM
+            int16 state = ReadMacInt16(CrsrState);
+            if (state < 0)
+                WriteMacInt16(CrsrState, state + 1);
+            if (shield_depth > 0)
+                shield_depth--;
+            break;
+        }
+        case M68K_EMUL_OP_CURSOR_SHIELD:
+            // ShieldCursor(shieldRect: Rect; offsetPt: Point) always hides one level
+            WriteMacInt16(CrsrState, ReadMacInt16(CrsrState) - 1);
+            shield_depth++;
+            break;
+        case M68K_EMUL_OP_CURSOR_SET: {
+            // SetCursor(crsr: Cursor)
+            uint32 crsr = ReadMacInt32(sp + 4);
+            for (int i = 0; i < SIZEOF_Cursor; i += 4)
+                WriteMacInt32(TheCrsr + i, ReadMacInt32(crsr + i));
+            break;
+        }
+        case M68K_EMUL_OP_CURSOR_SET_CCURSOR: {
+            // SetCCursor(cCrsr: CCrsrHandle)
+            uint32 h = ReadMacInt32(sp + 4);
+            uint32 p = h ? ReadMacInt32(h) : 0;
+            if (p == 0)
+                break;
+            for (int i = 0; i < 32; i += 4) {
+                WriteMacInt32(TheCrsr + crsrData + i, ReadMacInt32(p + ccrsr1Data + i));
+                WriteMacInt32(TheCrsr + crsrMask + i, ReadMacInt32(p + ccrsrMask + i));
+            }
+            WriteMacInt32(TheCrsr + crsrHotSpot, ReadMacInt32(p + ccrsrHotSpot));
+            break;
+        }
+        case M68K_EMUL_OP_CURSOR_OBSCURE:
+            WriteMacInt8(CrsrObscure, 0xff);
+            break;
+        case M68K_EMUL_OP_CURSOR_TASK:
+            cursor_task();
+            break;
+    }
+
+    publish_cursor();
+}
+
+
+/*
+ *  Install the vector stubs
+ */
+
+// Run the EmulOp, then return (no arguments) or pop arg_size bytes of arguments
+static void write_stub(uint32 p, uint16 opcode, uint16 arg_size)
+{
+    WriteMacInt16(p, opcode); p += 2;
+    if (arg_size == 0) {
+        WriteMacInt16(p, M68K_RTS);
+        return;
+    }
+    WriteMacInt16(p, 0x205f); p += 2;                               // move.l  (sp)+,a0
+    WriteMacInt16(p, 0x508f | ((arg_size & 7) << 9)); p += 2;      // addq.l  #arg_size,sp
+    WriteMacInt16(p, M68K_JMP_A0);                                  // jmp     (a0)
+}
+
+void CursorInstall(void)
+{
+    if (cr_patch || TwentyFourBitAddressing)
+        return;
+
+    M68kRegisters r;
+    r.d[0] = SIZEOF_crpatch;
+    Execute68kTrap(0xa71e, &r);     // NewPtrSysClear()
+    if (r.a[0] == 0)
+        return;
+    cr_patch = r.a[0];
+
+    write_stub(cr_patch + crHideStub, M68K_EMUL_OP_CURSOR_HIDE, 0);
+    write_stub(cr_patch + crShowStub, M68K_EMUL_OP_CURSOR_SHOW, 0);
+    write_stub(cr_patch + crShieldStub, M68K_EMUL_OP_CURSOR_SHIELD, 8);
+    write_stub(cr_patch + crSetStub, M68K_EMUL_OP_CURSOR_SET, 4);
+    write_stub(cr_patch + crObscureStub, M68K_EMUL_OP_CURSOR_OBSCURE, 0);
+    write_stub(cr_patch + crTaskStub, M68K_EMUL_OP_CURSOR_TASK, 0);
+    write_stub(cr_patch + crSetCCursorStub, M68K_EMUL_OP_CURSOR_SET_CCURSOR, 4);
+
+    // Let the ROM erase its cursor from the frame buffer one last time
+    Execute68kTrap(0xa852, &r);     // HideCursor()
+
+    WriteMacInt32(JHideCursor, cr_patch + crHideStub);
+    WriteMacInt32(JShowCursor, cr_patch + crShowStub);
+    WriteMacInt32(JShieldCursor, cr_patch + crShieldStub);
+    WriteMacInt32(JSetCrsr, cr_patch + crSetStub);
+    WriteMacInt32(JCrsrObscure, cr_patch + crObscureStub);
+    WriteMacInt32(JCrsrTask, cr_patch + crTaskStub);
+    r.d[0] = TRAP_SETCCURSOR;
+    r.a[0] = cr_patch + crSetCCursorStub;
+    Execute68kTrap(0xa647, &r);     // SetToolTrapAddress()
+
+    // Balance the HideCursor() above, the overlay shows the cursor from now on
+    WriteMacInt16(CrsrState, ReadMacInt16(CrsrState) + 1);
+    publish_cursor();
+    D(bug("Cursor overlay patches at %08x\n", cr_patch));
+}
+
+/*
+ *  Mac reset: the vectors are the ROM's again and the ROM draws the cursor
+ */
+void CursorReset(void)
+{
+    if (cr_patch == 0)
+        return;
+    cr_patch = 0;
+    shield_depth = 0;
+    static const uint16 none[16] = {0};
+    VideoSetCursor(none, none, 0, 0, false);
+}
+
+#if SAVE_STATE
+/*
+ *  The patch block and the shield count, for hibernate/resume (the block
+ *  and the vectors live in the RAM image; the next VBL republishes the cursor)
+ */
+void CursorStateIO(savestate *s)
+{
+    savestate_var(s, cr_patch);
+    savestate_var(s, shield_depth);
+}
+#endif
+
+#else
+
+void CursorInstall(void)
+{
+}
+
+void CursorReset(void)
+{
+}
+
+void CursorOp(uint16 opcode, M68kRegisters *r)
+{
+    UNUSED(opcode);
+    UNUSED(r);
+}
+
+#endif
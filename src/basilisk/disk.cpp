@@ -41,6 +41,7 @@ using std::vector;
 #include "sys.h"
 #include "prefs.h"
 #include "disk.h"
+#include "savestate.h"
 
 #define DEBUG 0
 #include "debug.h"
@@ -103,6 +104,22 @@ uint32 DiskIconAddr;
 // Flag: Control(accRun) has been called, interrupt routine is now active
 static bool acc_run_called = false;
 
+// Deferred task calling IODone for an asynchronous Prime() (laid out like the serial driver's)
+enum {
+	diskdtCode = 20,	// DT code is stored here
+	diskdtResult = 30,
+	diskdtDCE = 34,
+	SIZEOF_diskdt = 38
+};
+
+// Asynchronous Prime() in flight (the Device Manager sends one at a time)
+static uint32 async_dt = 0;			// Deferred task, 0 if none could be allocated
+static uint32 async_pb = 0;			// ParamBlock of the request, 0 if none
+static uint32 async_dce = 0;
+static bool async_write = false;
+static bool async_done = false;		// Transfer finished, async_actual valid
+static uint32 async_actual = 0;
+
 
 /*
  *  Get pointer to drive info or drives.end() if not found
@@ -202,6 +219,43 @@ void DiskExit(void)
 }
 
 
+#if SAVE_STATE
+/*
+ *  Drive state for hibernate/resume. The drives must be the ones the
+ *  snapshot was taken with, in the same order.
+ */
+
+void DiskStateIO(savestate *s)
+{
+	uint32 count = drives.size();
+	savestate_var(s, count);
+	if (count != drives.size()) {
+		savestate_fail(s, "disk drives changed");
+		return;
+	}
+	drive_vec::iterator info, end = drives.end();
+	for (info = drives.begin(); info != end; ++info) {
+		savestate_var(s, info->num);
+		savestate_var(s, info->to_be_mounted);
+		savestate_var(s, info->status);
+	}
+	savestate_var(s, acc_run_called);
+
+	// A transfer in flight is finished first, DiskInterrupt() completes it
+	if (!savestate_loading(s) && async_pb && !async_done) {
+		async_actual = SysWaitIO();
+		async_done = true;
+	}
+	savestate_var(s, async_dt);
+	savestate_var(s, async_pb);
+	savestate_var(s, async_dce);
+	savestate_var(s, async_write);
+	savestate_var(s, async_done);
+	savestate_var(s, async_actual);
+}
+#endif
+
+
 /*
  *  Disk was inserted, flag for mounting
  */
@@ -253,7 +307,7 @@ static void mount_mountable_volumes(void)
 			M68kRegisters r;
 			r.d[0] = info->num;
 			r.a[0] = 7;	// diskEvent
-			Execute68kTrap(0xa02f, &r);		// PostEvent()
+			Execute68kTrapRegs(0xa02f, &r, M68K_REG_D(0) | M68K_REG_A(0), 0);	// PostEvent()
 			info->to_be_mounted = false;
 		}
 	}
@@ -272,6 +326,25 @@ int16 DiskOpen(uint32 pb, uint32 dce)
 	WriteMacInt32(dce + dCtlPosition, 0);
 	acc_run_called = false;
 
+	// Allocate Deferred Task structure for asynchronous Prime() calls
+	if (async_pb)
+		SysWaitIO();
+	M68kRegisters r;
+	r.d[0] = SIZEOF_diskdt;
+	Execute68kTrap(0xa71e, &r);		// NewPtrSysClear()
+	async_dt = r.a[0];
+	async_pb = 0;
+	if (async_dt) {
+		WriteMacInt16(async_dt + qType, dtQType);
+		WriteMacInt32(async_dt + dtAddr, async_dt + diskdtCode);
+		WriteMacInt32(async_dt + dtParam, async_dt + diskdtResult);
+														// Deferred function for signalling that Prime is complete (pointer to result in a1)
+		WriteMacInt16(async_dt + diskdtCode, 0x2019);		// move.l	(a1)+,d0	(result)
+		WriteMacInt16(async_dt + diskdtCode + 2, 0x2251);	// move.l	(a1),a1		(dce)
+		WriteMacInt32(async_dt + diskdtCode + 4, 0x207808fc);	// move.l	JIODone,a0
+		WriteMacInt16(async_dt + diskdtCode + 8, 0x4ed0);	// jmp		(a0)
+	}
+
 	// Install drives
 	drive_vec::iterator info, end = drives.end();
 	for (info = drives.begin(); info != end; ++info) {
@@ -282,7 +355,6 @@ int16 DiskOpen(uint32 pb, uint32 dce)
 		if (info->fh) {
 
 			// Allocate drive status record
-			M68kRegisters r;
 			r.d[0] = SIZEOF_DrvSts;
 			Execute68kTrap(0xa71e, &r);		// NewPtrSysClear()
 			if (r.a[0] == 0)
@@ -348,8 +420,21 @@ int16 DiskPrime(uint32 pb, uint32 dce)
 	if ((length & 0x1ff) || (position & 0x1ff))
 		return paramErr;
 
+	// Asynchronous, not immediate: the I/O task transfers while the CPU goes
+	// on, DiskInterrupt() calls IODone (positive result: request in progress)
+	bool write = (ReadMacInt16(pb + ioTrap) & 0xff) != aRdCmd;
+	if ((ReadMacInt16(pb + ioTrap) & 0x600) == 0x400 && async_dt && async_pb == 0 && !(write && info->read_only)) {
+		if (SysStartIO(info->fh, write, buffer, position + info->start_byte, length)) {
+			async_pb = pb;
+			async_dce = dce;
+			async_write = write;
+			async_done = false;
+			return 1;
+		}
+	}
+
 	size_t actual = 0;
-	if ((ReadMacInt16(pb + ioTrap) & 0xff) == aRdCmd) {
+	if (!write) {
 
 		// Read
 		actual = Sys_read(info->fh, buffer, position + info->start_byte, length);
@@ -422,7 +507,7 @@ int16 DiskControl(uint32 pb, uint32 dce)
 				M68kRegisters r;
 				r.d[0] = info->num;
 				r.a[0] = 7;	// diskEvent
-				Execute68kTrap(0xa02f, &r);		// PostEvent()
+				Execute68kTrapRegs(0xa02f, &r, M68K_REG_D(0) | M68K_REG_A(0), 0);	// PostEvent()
 			} else if (ReadMacInt8(info->status + dsDiskInPlace) > 0) {
 				SysEject(info->fh);
 				WriteMacInt8(info->status + dsDiskInPlace, 0);
@@ -551,12 +636,62 @@ int16 DiskStatus(uint32 pb, uint32 dce)
 }
 
 
+/*
+ *  Complete the asynchronous Prime() once its transfer is done,
+ *  activate deferred task to call IODone
+ */
+
+static void complete_async_prime(void)
+{
+	if (async_pb == 0)
+		return;
+	if (!async_done) {
+		size_t actual;
+		if (!SysIOResult(&actual))
+			return;
+		async_actual = actual;
+		async_done = true;
+	}
+
+	uint32 pb = async_pb;
+	int16 result = noErr;
+	if (!async_write && async_actual > 0)
+		FlushCodeCache(Mac2HostAddr(ReadMacInt32(pb + ioBuffer)), async_actual);
+	if (async_actual != ReadMacInt32(pb + ioReqCount))
+		result = async_write ? writErr : readErr;
+	else {
+		// Update ParamBlock and DCE
+		WriteMacInt32(pb + ioActCount, async_actual);
+		WriteMacInt32(async_dce + dCtlPosition, ReadMacInt32(async_dce + dCtlPosition) + async_actual);
+	}
+
+	WriteMacInt32(async_dt + diskdtResult, (int32)result);
+	WriteMacInt32(async_dt + diskdtDCE, async_dce);
+	async_pb = 0;
+	async_done = false;
+	EnqueueMac(async_dt, 0xd92);
+}
+
+
+/*
+ *  Asynchronous transfer done (INTFLAG_DISK)
+ */
+
+void DiskIOInterrupt(void)
+{
+	complete_async_prime();
+}
+
+
 /*
  *  Driver interrupt routine (1Hz) - check for volumes to be mounted
+ *  (and for a transfer whose INTFLAG_DISK was lost to hibernation)
  */
 
 void DiskInterrupt(void)
 {
+	complete_async_prime();
+
 	if (!acc_run_called)
 		return;
 
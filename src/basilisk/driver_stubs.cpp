@@ -38,8 +38,9 @@ int16 SCSIMsgIn(void) { return 0; }
 int16 SCSIMsgOut(void) { return noErr; }
 int16 SCSIMgrBusy(void) { return 0; }  // Return 0 = not busy
 
+#ifdef HOST_BUILD
 /*
- * Serial driver stubs
+ * Serial driver stubs (the device links serial.cpp and serial_esp32.cpp)
  */
 
 // Dummy serial port object
@@ -71,9 +72,11 @@ int16 SerialControl(uint32 pb, uint32 dce, int port) { (void)pb; (void)dce; (voi
 int16 SerialStatus(uint32 pb, uint32 dce, int port) { (void)pb; (void)dce; (void)port; return noErr; }
 int16 SerialClose(uint32 pb, uint32 dce, int port) { (void)pb; (void)dce; (void)port; return noErr; }
 void SerialInterrupt(void) {}
+#endif
 
+#ifdef HOST_BUILD
 /*
- * Ethernet driver stubs
+ * Ethernet driver stubs (the device links ether.cpp and ether_esp32.cpp)
  */
 
 void EtherInit(void) {}
@@ -85,9 +88,11 @@ int16 EtherControl(uint32 pb, uint32 dce) { (void)pb; (void)dce; return noErr; }
 void EtherReadPacket(uint32 &src, uint32 &dest, uint32 &len, uint32 &remaining) {
     (void)src; (void)dest; (void)len; (void)remaining;
 }
+#endif
 
+#ifdef HOST_BUILD
 /*
- * Audio driver stubs
+ * Audio driver stubs (the device links audio.cpp and audio_esp32.cpp)
  */
 
 #include <vector>
@@ -127,6 +132,7 @@ int16 SoundInPrime(uint32 pb, uint32 dce) { (void)pb; (void)dce; return noErr; }
 int16 SoundInControl(uint32 pb, uint32 dce) { (void)pb; (void)dce; return noErr; }
 int16 SoundInStatus(uint32 pb, uint32 dce) { (void)pb; (void)dce; return noErr; }
 int16 SoundInClose(uint32 pb, uint32 dce) { (void)pb; (void)dce; return noErr; }
+#endif
 
 /*
  * Timer functions - ESP32 implementation
@@ -134,9 +140,7 @@ int16 SoundInClose(uint32 pb, uint32 dce) { (void)pb; (void)dce; return noErr; }
 
 // Get current time in microseconds
 void timer_current_time(uint64 &time) {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    time = (uint64)tv.tv_sec * 1000000 + tv.tv_usec;
+    time = GetTicks_usec();
 }
 
 // Build date/time as base for Mac clock
@@ -191,6 +195,11 @@ uint32 TimerDateTime(void) {
     // Unix epoch is Jan 1, 1970
     // Difference is 2082844800 seconds
     
+#ifdef HOST_BUILD
+    // Fixed start date (2000-01-01) plus emulated time, so runs are repeatable
+    return (uint32)(946684800UL + millis() / 1000 + 2082844800UL);
+#else
+
     // Get time from ESP32 - if not set via NTP, use build time as base
     time_t t = time(NULL);
     
@@ -211,13 +220,12 @@ uint32 TimerDateTime(void) {
     }
     
     return (uint32)(t + 2082844800UL);
+#endif
 }
 
 // Return microsecond counter (split into hi/lo 32-bit parts)
 void Microseconds(uint32 &hi, uint32 &lo) {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    uint64 us = (uint64)tv.tv_sec * 1000000 + tv.tv_usec;
+    uint64 us = GetTicks_usec();
     hi = (uint32)(us >> 32);
     lo = (uint32)(us & 0xFFFFFFFF);
 }
@@ -41,6 +41,10 @@
 #include "ether.h"
 #include "extfs.h"
 #include "emul_op.h"
+#include "quickdraw.h"
+#include "cursor.h"
+#include "fixmath.h"
+#include "rsrc_cache.h"
 
 #ifdef ENABLE_MON
 #include "mon.h"
@@ -53,6 +57,54 @@ extern bool tick_inhibit;
 
 void PlayStartupSound();
 
+#if USE_NATIVE_BLOCK_MOVE
+/*
+ *  Host address of a Mac memory range BlockMove() may copy with memmove(),
+ *  NULL if any part of it needs the memory bank handlers
+ */
+
+static uint8 *block_move_host_addr(uint32 addr, uint32 size, bool dest, bool &frame)
+{
+	frame = false;
+	if (addr < RAMSize && size <= RAMSize - addr)
+		return RAMBaseHost + addr;
+	if (!dest && addr - ROMBaseMac < ROMSize && size <= ROMSize - (addr - ROMBaseMac))
+		return ROMBaseHost + (addr - ROMBaseMac);
+	if (MacFrameLayout == FLAYOUT_DIRECT && addr - MacFrameBaseMac < MacFrameSize && size <= MacFrameSize - (addr - MacFrameBaseMac)) {
+		frame = true;
+		return MacFrameBaseHost + (addr - MacFrameBaseMac);
+	}
+	return NULL;
+}
+
+/*
+ *  Native BlockMove()/BlockMoveData() (a0 = source, a1 = destination, d0 = byte count)
+ */
+
+static void block_move(uint32 src, uint32 dest, uint32 size)
+{
+	bool src_frame, dest_frame;
+	uint8 *s = block_move_host_addr(src, size, false, src_frame);
+	uint8 *d = block_move_host_addr(dest, size, true, dest_frame);
+
+	if (s && d) {
+		// memmove() handles the overlap and copies aligned words where it can
+		memmove(d, s, size);
+		if (dest_frame)
+			VideoMarkDirtyRange(dest - MacFrameBaseMac, size);
+		else
+			FlushCodeCache(d, size);	// Moved code, or data over decode cache traces
+	} else if (dest - src < size) {
+		// Overlapping move to a higher address through the memory banks
+		for (uint32 i = size; i > 0; i--)
+			WriteMacInt8(dest + i - 1, ReadMacInt8(src + i - 1));
+	} else {
+		for (uint32 i = 0; i < size; i++)
+			WriteMacInt8(dest + i, ReadMacInt8(src + i));
+	}
+}
+#endif
+
 /*
  *  Execute EMUL_OP opcode (called by 68k emulator or Illegal Instruction trap handler)
  */
@@ -63,6 +115,7 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 	switch (opcode) {
 		case M68K_EMUL_BREAK: {				// Breakpoint
 			printf("*** Breakpoint\n");
+			EmulOpMakeSR();
 			printf("d0 %08x d1 %08x d2 %08x d3 %08x\n"
 				   "d4 %08x d5 %08x d6 %08x d7 %08x\n"
 				   "a0 %08x a1 %08x a2 %08x a3 %08x\n"
@@ -91,6 +144,7 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 			TimerReset();
 			EtherReset();
 			AudioReset();
+			ResetStartupPatches();
 #ifdef USE_SDL_AUDIO
 			PlayStartupSound();
 #endif
@@ -441,7 +495,11 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 					break;
 				default:
 					printf("FATAL: SCSIDispatch(%d): illegal selector\n", sel);
+#if WARM_RESTART
+					WarmRestart();
+#else
 					QuitEmulator();
+#endif
 					break;
 			}
 			r->a[0] = ret;			// "rtd" emulation, a0 = return address, a1 = new stack pointer
@@ -449,12 +507,19 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 			break;
 		}
 
-		case M68K_EMUL_OP_IRQ:			// Level 1 interrupt
+		case M68K_EMUL_OP_IRQ: {		// Level 1 interrupt
 			r->d[0] = 0;
 
-			if (InterruptFlags & INTFLAG_60HZ) {
-				ClearInterruptFlag(INTFLAG_60HZ);
+			// Take every pending source with a single clear instead of one
+			// atomic per flag; sources raised meanwhile stay pending
+			uint32 pending = InterruptFlags;
+#if !PRECISE_TIMING
+			pending &= ~INTFLAG_TIMER;
+#endif
+			if (pending)
+				ClearInterruptFlag(pending);
 
+			if (pending & INTFLAG_60HZ) {
 				// Increment Ticks variable
 				WriteMacInt32(0x16a, ReadMacInt32(0x16a) + 1);
 
@@ -477,8 +542,7 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 				}
 			}
 
-			if (InterruptFlags & INTFLAG_1HZ) {
-				ClearInterruptFlag(INTFLAG_1HZ);
+			if (pending & INTFLAG_1HZ) {
 				if (HasMacStarted()) {
 					SonyInterrupt();
 					DiskInterrupt();
@@ -486,38 +550,37 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 				}
 			}
 
-			if (InterruptFlags & INTFLAG_SERIAL) {
-				ClearInterruptFlag(INTFLAG_SERIAL);
+			if (pending & INTFLAG_SERIAL) {
 				SerialInterrupt();
 			}
 
-			if (InterruptFlags & INTFLAG_ETHER) {
-				ClearInterruptFlag(INTFLAG_ETHER);
+			if (pending & INTFLAG_ETHER) {
 				EtherInterrupt();
 			}
 #if PRECISE_TIMING
-			if (InterruptFlags & INTFLAG_TIMER) {
-				ClearInterruptFlag(INTFLAG_TIMER);
+			if (pending & INTFLAG_TIMER) {
 				TimerInterrupt();
 			}
 #endif
-			if (InterruptFlags & INTFLAG_AUDIO) {
-				ClearInterruptFlag(INTFLAG_AUDIO);
+			if (pending & INTFLAG_AUDIO) {
 				AudioInterrupt();
 			}
 
-			if (InterruptFlags & INTFLAG_ADB) {
-				ClearInterruptFlag(INTFLAG_ADB);
+			if (pending & INTFLAG_ADB) {
 				if (HasMacStarted())
 					ADBInterrupt();
 			}
 
-			if (InterruptFlags & INTFLAG_NMI) {
-				ClearInterruptFlag(INTFLAG_NMI);
+			if (pending & INTFLAG_DISK) {
+				DiskIOInterrupt();
+			}
+
+			if (pending & INTFLAG_NMI) {
 				if (HasMacStarted())
 					TriggerNMI();
 			}
 			break;
+		}
 
 		case M68K_EMUL_OP_PUT_SCRAP: {		// PutScrap() patch
 			void *scrap = Mac2HostAddr(ReadMacInt32(r->a[7] + 4));
@@ -567,6 +630,59 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 			FlushCodeCache(Mac2HostAddr(r->a[0]), r->a[1]);
 			break;
 
+#if USE_NATIVE_BLOCK_MOVE
+		case M68K_EMUL_OP_BLOCK_MOVE_NATIVE:	// BlockMove() replacement
+			if (r->d[0] && r->a[0] != r->a[1])
+				block_move(r->a[0], r->a[1], r->d[0]);
+			r->d[0] = 0;	// noErr
+			break;
+#endif
+
+#if USE_NATIVE_QUICKDRAW
+		case M68K_EMUL_OP_QD_COPYBITS:		// QuickDraw fast paths
+		case M68K_EMUL_OP_QD_FILLRECT:
+		case M68K_EMUL_OP_QD_ERASERECT:
+		case M68K_EMUL_OP_QD_SCROLLRECT:
+			QuickDrawOp(opcode, r);
+			break;
+#endif
+
+#if USE_NATIVE_FIXMATH
+		case M68K_EMUL_OP_FIXMATH:			// FixMath and bit utility traps
+			FixMathOp(r);
+			break;
+#endif
+
+#if USE_NATIVE_RSRC
+		case M68K_EMUL_OP_RSRC_GET:			// GetResource()/Get1Resource() lookups
+			RsrcCacheOp(r);
+			break;
+
+		case M68K_EMUL_OP_RSRC_CHANGED:		// A resource map may change
+			RsrcCacheFlush();
+			break;
+#endif
+
+#if FAST_BOOT
+		case M68K_EMUL_OP_DELAY_LOOP: {		// "dbra dN,*" delay loop, followed by "exg dN,dN"
+			int reg = ReadMacInt16(EmulOpAddress() + 2) & 7;
+			r->d[reg] |= 0xffff;			// Where the loop leaves the counter
+			break;
+		}
+#endif
+
+#if USE_CURSOR_OVERLAY
+		case M68K_EMUL_OP_CURSOR_HIDE:		// Cursor overlay vectors
+		case M68K_EMUL_OP_CURSOR_SHOW:
+		case M68K_EMUL_OP_CURSOR_SHIELD:
+		case M68K_EMUL_OP_CURSOR_SET:
+		case M68K_EMUL_OP_CURSOR_SET_CCURSOR:
+		case M68K_EMUL_OP_CURSOR_OBSCURE:
+		case M68K_EMUL_OP_CURSOR_TASK:
+			CursorOp(opcode, r);
+			break;
+#endif
+
 		case M68K_EMUL_OP_DEBUGUTIL:
 		//	printf("DebugUtil d0=%08lx  a5=%08lx\n", r->d[0], r->a[5]);
 			r->d[0] = DebugUtil(r->d[0]);
@@ -581,6 +697,7 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 
 		case M68K_EMUL_OP_SUSPEND: {
 			printf("*** Suspend\n");
+			EmulOpMakeSR();
 			printf("d0 %08x d1 %08x d2 %08x d3 %08x\n"
 				   "d4 %08x d5 %08x d6 %08x d7 %08x\n"
 				   "a0 %08x a1 %08x a2 %08x a3 %08x\n"
@@ -598,6 +715,7 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 
 		default:
 			printf("FATAL: EMUL_OP called with bogus opcode %08x\n", opcode);
+			EmulOpMakeSR();
 			printf("d0 %08x d1 %08x d2 %08x d3 %08x\n"
 				   "d4 %08x d5 %08x d6 %08x d7 %08x\n"
 				   "a0 %08x a1 %08x a2 %08x a3 %08x\n"
@@ -610,7 +728,11 @@ void EmulOp(uint16 opcode, M68kRegisters *r)
 			const char *arg[4] = {"mon", "-m", "-r", NULL};
 			mon(3, arg);
 #endif
+#if WARM_RESTART
+			WarmRestart();
+#else
 			QuitEmulator();
+#endif
 			break;
 	}
 }
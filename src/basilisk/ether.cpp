@@ -28,6 +28,7 @@
 #include "sysdeps.h"
 
 #include <string.h>
+#include <assert.h>
 #include <map>
 
 #if SUPPORTS_UDP_TUNNEL
@@ -94,6 +95,11 @@ void EtherInit(void)
 		udp_tunnel = true;
 		udp_port = PrefsFindInt32("udpport");
 
+		// Join the network, the tunnel needs an address of its own
+		uint32 udp_ip = ether_udp_link();
+		if (udp_ip == 0)
+			return;
+
 		// Open UDP socket
 		udp_socket = socket(PF_INET, SOCK_DGRAM, 0);
 		if (udp_socket < 0) {
@@ -114,19 +120,6 @@ void EtherInit(void)
 			return;
 		}
 
-		// Retrieve local IP address (or at least one of them)
-		socklen_t sa_length = sizeof(sa);
-		getsockname(udp_socket, (struct sockaddr *)&sa, &sa_length);
-		uint32 udp_ip = sa.sin_addr.s_addr;
-		if (udp_ip == INADDR_ANY || udp_ip == INADDR_LOOPBACK) {
-			char name[256];
-			gethostname(name, sizeof(name));
-			struct hostent *local = gethostbyname(name);
-			if (local)
-				udp_ip = *(uint32 *)local->h_addr_list[0];
-		}
-		udp_ip = ntohl(udp_ip);
-
 		// Construct dummy Ethernet address from local IP address
 		ether_addr[0] = 'B';
 		ether_addr[1] = '2';
@@ -145,7 +138,7 @@ void EtherInit(void)
 		ioctl(udp_socket, FIONBIO, &on);
 #endif
 
-		// Start thread for packet reception
+		// Start tasks for packet reception and transmission
 		if (!ether_start_udp_thread(udp_socket)) {
 			CLOSESOCKET(udp_socket);
 			udp_socket = -1;
@@ -254,6 +247,10 @@ int16 EtherOpen(uint32 pb, uint32 dce)
 	WriteMacInt16(ether_data + ed_ReadPacket + 18, M68K_EMUL_OP_ETHER_READ_PACKET);	//2
 	WriteMacInt16(ether_data + ed_ReadPacket + 20, 0x4a43);	//  tst.w	d3
 	WriteMacInt16(ether_data + ed_ReadPacket + 22, 0x4e75);	//  rts
+
+	// Receive ring for the platform code
+	if (net_open && !ether_open())
+		return openErr;
 	return 0;
 }
 
@@ -346,12 +343,8 @@ int16 EtherControl(uint32 pb, uint32 dce)
 					bug("\n");
 #endif
 
-					// Send packet
-					struct sockaddr_in sa;
-					sa.sin_family = AF_INET;
-					sa.sin_addr.s_addr = htonl(dest_ip);
-					sa.sin_port = htons(udp_port);
-					if (sendto(udp_socket, packet, len, 0, (struct sockaddr *)&sa, sizeof(sa)) < 0) {
+					// Queue packet, the send task sends it on Core 0
+					if (!ether_udp_send(packet, len, dest_ip, udp_port)) {
 						D(bug("WARNING: Couldn't transmit packet\n"));
 						return excessCollsns;
 					}
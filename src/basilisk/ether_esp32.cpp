@@ -0,0 +1,675 @@
+/*
+ *  ether_esp32.cpp - Ethernet over the Tab5's WiFi co-processor
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The ESP32-C6 next to the P4 runs the WiFi stack (ESP-Hosted over
+ *  SDIO) and hands us whole Ethernet II frames of the station interface.
+ *  The Mac takes over that interface: its Ethernet address is the
+ *  station's, so replies come straight back, and lwIP on our side is cut
+ *  out of the receive path once the station is associated (Open Transport
+ *  or MacTCP runs DHCP itself).
+ *
+ *  Received frames are copied once, by the hosted receive task, into a
+ *  ring of packet buffers in the Mac's system heap, and INTFLAG_ETHER
+ *  makes EtherInterrupt() on the CPU task hand each one to its protocol
+ *  handler in place: ReadPacket copies from the ring straight into the
+ *  protocol's own buffers. The interrupt is raised once per burst, the
+ *  CPU takes every frame that has arrived by then. Frames no protocol
+ *  handler would take are dropped before that, on Core 0: the station
+ *  hands us every broadcast and multicast of the network, and each one
+ *  the Mac does not listen to cost an interrupt and the protocol dispatch
+ *  in 68k code for nothing. Frames the Mac writes
+ *  are passed to the WiFi driver from Mac RAM as they are; only a frame
+ *  split over several write data structure entries is gathered first.
+ *
+ *  With udptunnel, the station keeps its own IP address and ether.cpp
+ *  tunnels AppleTalk to other emulators in UDP datagrams, one frame each
+ *  as desktop Basilisk II does. A receive task on Core 0 reads the
+ *  datagrams into the same ring, and a send task sends the frames the Mac
+ *  queued, so the CPU never waits in the socket layer.
+ */
+
+#include <string.h>
+#include <map>
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "macos_util.h"
+#include "prefs.h"
+#include "ether.h"
+#include "ether_defs.h"
+
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include <esp_private/wifi.h>
+#include <esp_netif.h>
+#include <esp_heap_caps.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// SDIO link to the ESP32-C6 on the Tab5
+#define WIFI_SDIO_CLK       12
+#define WIFI_SDIO_CMD       13
+#define WIFI_SDIO_D0        11
+#define WIFI_SDIO_D1        10
+#define WIFI_SDIO_D2        9
+#define WIFI_SDIO_D3        8
+#define WIFI_SDIO_RESET     15
+
+// Receive ring in Mac RAM (single producer: hosted receive task, single consumer: CPU task)
+#define ETHER_RX_SLOTS      16          // Frames waiting for EtherInterrupt()
+#define ETHER_SLOT_SIZE     1520        // 1514-byte frame, rounded up
+
+static uint32 rx_ring = 0;              // Mac address of the ring, 0: not allocated
+static uint8 *rx_ring_host = NULL;      // Its host address, NULL while unusable
+static uint16 rx_length[ETHER_RX_SLOTS];
+static struct sockaddr_in rx_from[ETHER_RX_SLOTS];     // Sender of a tunnelled frame
+static uint32 rx_head = 0;              // Next slot to fill (receive task)
+static uint32 rx_tail = 0;              // Next slot to deliver (CPU task)
+static bool rx_signalled = false;       // INTFLAG_ETHER raised, not yet taken
+static bool rx_writing = false;         // The UDP task is reading into a slot
+static portMUX_TYPE rx_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Link state and counters
+static volatile bool link_up = false;
+static bool bridge = false;             // The Mac owns the station interface (no udptunnel)
+static volatile uint32 station_ip = 0;  // DHCP address with udptunnel (host byte order)
+static uint32 rx_frames = 0, rx_dropped = 0, rx_filtered = 0, tx_frames = 0, tx_errors = 0;
+
+// Receive filter: the protocol types with a handler and the multicast
+// addresses the Mac added, as the receive task sees them (guarded by rx_mux)
+#define FILTER_TYPES        16
+#define FILTER_MULTICASTS   16
+
+struct multicast_entry {
+    uint8 addr[6];
+    uint16 count;                       // AddMulti calls not yet matched by DelMulti
+};
+
+static uint16 filter_types[FILTER_TYPES];
+static int filter_type_count = 0;
+static bool filter_all_types = false;   // More protocols than the table holds
+static multicast_entry filter_multicasts[FILTER_MULTICASTS];
+static int filter_multicast_count = 0;
+static bool filter_all_multicasts = false;
+
+// AppleTalk over UDP: send ring (single producer: CPU task, single consumer: send task)
+#define UDP_TASK_STACK_SIZE 3072
+#define UDP_TASK_PRIORITY   2
+#define UDP_TASK_CORE       0
+#define UDP_POLL_MS         100         // Receive wait, the task checks for a stop in between
+#define UDP_TX_SLOTS        16
+#define WIFI_CONNECT_MS     15000       // Wait for an address before the tunnel binds
+
+struct udp_frame {
+    uint8 data[1514];
+    uint16 length;
+    uint16 port;
+    uint32 dest_ip;
+};
+
+static int udp_fd = -1;
+static udp_frame *tx_ring = NULL;       // UDP_TX_SLOTS frames (PSRAM)
+static uint32 tx_head = 0;              // Next slot to fill (CPU task)
+static uint32 tx_tail = 0;              // Next slot to send (send task)
+static TaskHandle_t udp_rx_task = NULL;
+static TaskHandle_t udp_tx_task = NULL;
+static volatile bool udp_running = false;
+
+// Gather buffer for frames in several pieces (CPU task only)
+static uint8 tx_buffer[1516];
+
+// Attached network protocols, maps protocol type to MacOS handler address
+static std::map<uint16, uint32> net_protocols;
+
+
+/*
+ *  Frames are in the ring: one interrupt for all that arrive before the
+ *  CPU takes them
+ */
+
+static inline void rx_signal(void)
+{
+    if (!__atomic_exchange_n(&rx_signalled, true, __ATOMIC_ACQ_REL)) {
+        SetInterruptFlag(INTFLAG_ETHER);
+        TriggerInterrupt();
+    }
+}
+
+
+/*
+ *  Whether a protocol handler would take a frame (rx_mux held)
+ */
+
+static bool rx_wanted(const uint8 *frame)
+{
+    // Multicasts the Mac did not add (broadcasts and our own address pass)
+    if ((frame[0] & 1) && !filter_all_multicasts && memcmp(frame, "\xff\xff\xff\xff\xff\xff", 6) != 0) {
+        int i = 0;
+        while (i < filter_multicast_count && memcmp(filter_multicasts[i].addr, frame, 6) != 0)
+            i++;
+        if (i == filter_multicast_count)
+            return false;
+    }
+
+    // Protocols nobody attached (802.3 frames have a length instead of a type)
+    if (filter_all_types)
+        return true;
+    uint16 type = (frame[12] << 8) | frame[13];
+    uint16 search_type = (type <= 1500 ? 0 : type);
+    for (int i = 0; i < filter_type_count; i++) {
+        if (filter_types[i] == search_type)
+            return true;
+    }
+    return false;
+}
+
+
+/*
+ *  Frame from the WiFi driver (hosted receive task)
+ */
+
+static esp_err_t wifi_receive(void *buffer, uint16_t len, void *eb)
+{
+    const uint8 *frame = (const uint8 *)buffer;
+    bool queued = false, wanted = false;
+
+    // Frames we sent, echoed back by the access point, are dropped
+    if (len >= 14 && len <= 1514 && memcmp(frame + 6, ether_addr, 6) != 0) {
+        portENTER_CRITICAL(&rx_mux);
+        wanted = rx_wanted(frame);
+        if (wanted && rx_ring_host && rx_head - __atomic_load_n(&rx_tail, __ATOMIC_ACQUIRE) < ETHER_RX_SLOTS) {
+            uint32 slot = rx_head % ETHER_RX_SLOTS;
+            memcpy(rx_ring_host + slot * ETHER_SLOT_SIZE, frame, len);
+            rx_length[slot] = len;
+            __atomic_store_n(&rx_head, rx_head + 1, __ATOMIC_RELEASE);
+            queued = true;
+        }
+        portEXIT_CRITICAL(&rx_mux);
+        if (queued)
+            rx_frames++;
+        else if (!wanted)
+            rx_filtered++;
+        else
+            rx_dropped++;
+    }
+    esp_wifi_internal_free_rx_buffer(eb);
+
+    if (queued)
+        rx_signal();
+    return ESP_OK;
+}
+
+
+/*
+ *  Station events: take over the receive path once associated
+ */
+
+static void wifi_event(arduino_event_id_t event, arduino_event_info_t info)
+{
+    switch (event) {
+        case ARDUINO_EVENT_WIFI_STA_CONNECTED: {
+            // The Mac does DHCP with the same address, ours would only confuse the server
+            if (bridge) {
+                esp_netif_t *netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+                if (netif)
+                    esp_netif_dhcpc_stop(netif);
+                esp_wifi_internal_reg_rxcb(WIFI_IF_STA, wifi_receive);
+            }
+            link_up = true;
+            Serial.printf("[ETHER] Connected to %s\n", PrefsFindString("wifissid"));
+            break;
+        }
+        case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+            station_ip = ntohl(info.got_ip.ip_info.ip.addr);
+            break;
+        case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+            if (link_up)
+                Serial.println("[ETHER] Disconnected, reconnecting");
+            link_up = false;
+            break;
+        default:
+            break;
+    }
+}
+
+
+/*
+ *  Join the WiFi network (wifissid), the Mac's Ethernet address is the station's
+ */
+
+static bool wifi_start(void)
+{
+    const char *ssid = PrefsFindString("wifissid");
+    if (ssid == NULL || ssid[0] == 0)
+        return false;
+    const char *password = PrefsFindString("wifipassword");
+
+    WiFi.setPins(WIFI_SDIO_CLK, WIFI_SDIO_CMD, WIFI_SDIO_D0, WIFI_SDIO_D1, WIFI_SDIO_D2, WIFI_SDIO_D3, WIFI_SDIO_RESET);
+    WiFi.onEvent(wifi_event);
+    if (!WiFi.mode(WIFI_STA)) {
+        Serial.println("[ETHER] ERROR: WiFi co-processor not available");
+        return false;
+    }
+    WiFi.setSleep(false);           // Power save adds 100ms to every reply
+    WiFi.setAutoReconnect(true);
+    esp_wifi_get_mac(WIFI_IF_STA, ether_addr);
+
+    // Association goes on in the background, the Mac retries until it is up
+    WiFi.begin(ssid, password ? password : "");
+    Serial.printf("[ETHER] Address %02x:%02x:%02x:%02x:%02x:%02x, joining %s\n",
+                  ether_addr[0], ether_addr[1], ether_addr[2], ether_addr[3], ether_addr[4], ether_addr[5], ssid);
+    return true;
+}
+
+
+/*
+ *  Initialization: bridge the Mac's Ethernet to the station interface
+ */
+
+bool ether_init(void)
+{
+    bridge = true;
+    return wifi_start();
+}
+
+
+/*
+ *  Link for the UDP tunnel: join the network and wait for an address
+ *  Returns the local IP address in host byte order, 0 if there is none
+ */
+
+uint32 ether_udp_link(void)
+{
+    bridge = false;
+    if (!wifi_start())
+        return 0;
+    uint32 start = millis();
+    while (station_ip == 0) {
+        if (millis() - start > WIFI_CONNECT_MS) {
+            Serial.println("[ETHER] ERROR: No IP address for the UDP tunnel");
+            return 0;
+        }
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    uint32 ip = station_ip;
+    Serial.printf("[ETHER] UDP tunnel on %u.%u.%u.%u\n", ip >> 24, (ip >> 16) & 0xff, (ip >> 8) & 0xff, ip & 0xff);
+    return ip;
+}
+
+
+/*
+ *  Deinitialization
+ */
+
+void ether_exit(void)
+{
+    if (bridge)
+        esp_wifi_internal_reg_rxcb(WIFI_IF_STA, NULL);
+    link_up = false;
+    WiFi.disconnect(true);
+    Serial.printf("[ETHER] %u frames received, %u dropped, %u filtered, %u sent, %u send errors\n",
+                  rx_frames, rx_dropped, rx_filtered, tx_frames, tx_errors);
+}
+
+
+/*
+ *  Reset: the ring was in the system heap, which is gone
+ */
+
+void ether_reset(void)
+{
+    // A datagram being read into the ring is done within a few microseconds
+    portENTER_CRITICAL(&rx_mux);
+    while (rx_writing) {
+        portEXIT_CRITICAL(&rx_mux);
+        vTaskDelay(1);
+        portENTER_CRITICAL(&rx_mux);
+    }
+    rx_ring_host = NULL;
+    rx_head = rx_tail = 0;
+    filter_type_count = filter_multicast_count = 0;
+    filter_all_types = filter_all_multicasts = false;
+    portEXIT_CRITICAL(&rx_mux);
+    rx_ring = 0;
+    net_protocols.clear();
+}
+
+
+/*
+ *  Driver opened: allocate the receive ring in the system heap
+ */
+
+bool ether_open(void)
+{
+    if (rx_ring)
+        return true;
+    M68kRegisters r;
+    r.d[0] = ETHER_RX_SLOTS * ETHER_SLOT_SIZE;
+    Execute68kTrap(0xa71e, &r);     // NewPtrSysClear()
+    if (r.a[0] == 0)
+        return false;
+    rx_ring = r.a[0];
+    portENTER_CRITICAL(&rx_mux);
+    rx_head = rx_tail = 0;
+    rx_ring_host = Mac2HostAddr(rx_ring);
+    portEXIT_CRITICAL(&rx_mux);
+    D(bug(" receive ring at %08x\n", rx_ring));
+    return true;
+}
+
+
+/*
+ *  Add/remove multicast address: the station passes on all it receives,
+ *  the receive filter keeps those the Mac added
+ */
+
+static int find_multicast(const uint8 *addr)
+{
+    for (int i = 0; i < filter_multicast_count; i++) {
+        if (memcmp(filter_multicasts[i].addr, addr, 6) == 0)
+            return i;
+    }
+    return -1;
+}
+
+int16 ether_add_multicast(uint32 pb)
+{
+    uint8 addr[6];
+    Mac2Host_memcpy(addr, pb + eMultiAddr, 6);
+    portENTER_CRITICAL(&rx_mux);
+    int i = find_multicast(addr);
+    if (i >= 0) {
+        filter_multicasts[i].count++;
+    } else if (filter_multicast_count < FILTER_MULTICASTS) {
+        multicast_entry &e = filter_multicasts[filter_multicast_count++];
+        memcpy(e.addr, addr, 6);
+        e.count = 1;
+    } else {
+        filter_all_multicasts = true;
+    }
+    portEXIT_CRITICAL(&rx_mux);
+    return noErr;
+}
+
+int16 ether_del_multicast(uint32 pb)
+{
+    uint8 addr[6];
+    Mac2Host_memcpy(addr, pb + eMultiAddr, 6);
+    portENTER_CRITICAL(&rx_mux);
+    int i = find_multicast(addr);
+    if (i >= 0 && --filter_multicasts[i].count == 0)
+        filter_multicasts[i] = filter_multicasts[--filter_multicast_count];
+    bool known = i >= 0 || filter_all_multicasts;
+    portEXIT_CRITICAL(&rx_mux);
+    if (!known)
+        return eMultiErr;
+    return noErr;
+}
+
+
+/*
+ *  Attach/detach protocol handler
+ */
+
+int16 ether_attach_ph(uint16 type, uint32 handler)
+{
+    if (net_protocols.find(type) != net_protocols.end())
+        return lapProtErr;
+    net_protocols[type] = handler;
+    if (handler) {
+        portENTER_CRITICAL(&rx_mux);
+        if (filter_type_count < FILTER_TYPES)
+            filter_types[filter_type_count++] = type;
+        else
+            filter_all_types = true;
+        portEXIT_CRITICAL(&rx_mux);
+    }
+    return noErr;
+}
+
+int16 ether_detach_ph(uint16 type)
+{
+    if (net_protocols.erase(type) == 0)
+        return lapProtErr;
+    portENTER_CRITICAL(&rx_mux);
+    for (int i = 0; i < filter_type_count; i++) {
+        if (filter_types[i] == type) {
+            filter_types[i] = filter_types[--filter_type_count];
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&rx_mux);
+    return noErr;
+}
+
+
+/*
+ *  Transmit raw ethernet packet
+ */
+
+int16 ether_write(uint32 wds)
+{
+    if (!link_up)
+        return excessCollsns;
+
+    // A frame in one piece goes to the driver from Mac RAM
+    const uint8 *frame;
+    int len;
+    if (ReadMacInt16(wds + 6) == 0) {
+        len = ReadMacInt16(wds);
+        if (len > 1514)
+            len = 1514;
+        frame = Mac2HostAddr(ReadMacInt32(wds + 2));
+    } else {
+        len = ether_wds_to_buffer(wds, tx_buffer);
+        frame = tx_buffer;
+    }
+
+    if (esp_wifi_internal_tx(WIFI_IF_STA, (void *)frame, len) != ESP_OK) {
+        tx_errors++;
+        return excessCollsns;
+    }
+    tx_frames++;
+    return noErr;
+}
+
+
+/*
+ *  UDP tunnel receive task: datagrams straight into the receive ring
+ */
+
+static void udpReceiveTask(void *param)
+{
+    UNUSED(param);
+    while (udp_running) {
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(udp_fd, &fds);
+        struct timeval tv = {0, UDP_POLL_MS * 1000};
+        if (select(udp_fd + 1, &fds, NULL, NULL, &tv) <= 0)
+            continue;
+
+        // Claim the next slot, the socket is non-blocking so the read is quick
+        uint8 *slot_data = NULL;
+        uint32 slot = 0;
+        portENTER_CRITICAL(&rx_mux);
+        if (rx_ring_host && rx_head - __atomic_load_n(&rx_tail, __ATOMIC_ACQUIRE) < ETHER_RX_SLOTS) {
+            slot = rx_head % ETHER_RX_SLOTS;
+            slot_data = rx_ring_host + slot * ETHER_SLOT_SIZE;
+            rx_writing = true;
+        }
+        portEXIT_CRITICAL(&rx_mux);
+
+        // Read the whole burst that is waiting, a full ring drops datagrams
+        if (slot_data == NULL) {
+            uint8 discard[64];
+            while (recv(udp_fd, discard, sizeof(discard), MSG_DONTWAIT) > 0)
+                rx_dropped++;
+            continue;
+        }
+        socklen_t from_len = sizeof(rx_from[slot]);
+        int len = recvfrom(udp_fd, slot_data, 1514, MSG_DONTWAIT, (struct sockaddr *)&rx_from[slot], &from_len);
+
+        portENTER_CRITICAL(&rx_mux);
+        bool queued = len >= 14 && rx_ring_host;
+        if (queued) {
+            rx_length[slot] = len;
+            __atomic_store_n(&rx_head, rx_head + 1, __ATOMIC_RELEASE);
+        }
+        rx_writing = false;
+        portEXIT_CRITICAL(&rx_mux);
+        if (queued) {
+            rx_frames++;
+            rx_signal();
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+
+/*
+ *  UDP tunnel send task: everything the Mac queued, in one go
+ */
+
+static void udpSendTask(void *param)
+{
+    UNUSED(param);
+    while (udp_running) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(UDP_POLL_MS));
+        uint32 head = __atomic_load_n(&tx_head, __ATOMIC_ACQUIRE);
+        while (tx_tail != head) {
+            udp_frame &f = tx_ring[tx_tail % UDP_TX_SLOTS];
+            struct sockaddr_in sa;
+            memset(&sa, 0, sizeof(sa));
+            sa.sin_family = AF_INET;
+            sa.sin_addr.s_addr = htonl(f.dest_ip);
+            sa.sin_port = htons(f.port);
+            if (sendto(udp_fd, f.data, f.length, 0, (struct sockaddr *)&sa, sizeof(sa)) < 0)
+                tx_errors++;
+            else
+                tx_frames++;
+            __atomic_store_n(&tx_tail, tx_tail + 1, __ATOMIC_RELEASE);
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+
+/*
+ *  Queue a tunnelled frame for the send task (CPU task)
+ *  Returns false if the send ring is full
+ */
+
+bool ether_udp_send(const uint8 *packet, int len, uint32 dest_ip, uint16 port)
+{
+    uint32 tail = __atomic_load_n(&tx_tail, __ATOMIC_ACQUIRE);
+    if (tx_ring == NULL || tx_head - tail >= UDP_TX_SLOTS)
+        return false;
+    udp_frame &f = tx_ring[tx_head % UDP_TX_SLOTS];
+    memcpy(f.data, packet, len);
+    f.length = len;
+    f.port = port;
+    f.dest_ip = dest_ip;
+    __atomic_store_n(&tx_head, tx_head + 1, __ATOMIC_RELEASE);
+
+    // The task takes the frames of a burst together
+    if (tx_head - tail == 1)
+        xTaskNotifyGive(udp_tx_task);
+    return true;
+}
+
+
+/*
+ *  Start/stop UDP tunnel tasks
+ */
+
+bool ether_start_udp_thread(int socket_fd)
+{
+    tx_ring = (udp_frame *)heap_caps_malloc(UDP_TX_SLOTS * sizeof(udp_frame), MALLOC_CAP_SPIRAM);
+    if (tx_ring == NULL)
+        return false;
+    udp_fd = socket_fd;
+    tx_head = tx_tail = 0;
+    udp_running = true;
+    if (xTaskCreatePinnedToCore(udpReceiveTask, "UDPRecvTask", UDP_TASK_STACK_SIZE, NULL,
+                                UDP_TASK_PRIORITY, &udp_rx_task, UDP_TASK_CORE) != pdPASS ||
+        xTaskCreatePinnedToCore(udpSendTask, "UDPSendTask", UDP_TASK_STACK_SIZE, NULL,
+                                UDP_TASK_PRIORITY, &udp_tx_task, UDP_TASK_CORE) != pdPASS) {
+        Serial.println("[ETHER] ERROR: Failed to create UDP tunnel tasks");
+        ether_stop_udp_thread();
+        return false;
+    }
+    return true;
+}
+
+void ether_stop_udp_thread(void)
+{
+    udp_running = false;
+    if (udp_tx_task)
+        xTaskNotifyGive(udp_tx_task);
+    vTaskDelay(pdMS_TO_TICKS(2 * UDP_POLL_MS));
+    udp_rx_task = udp_tx_task = NULL;
+    heap_caps_free(tx_ring);
+    tx_ring = NULL;
+    udp_fd = -1;
+    Serial.printf("[ETHER] %u frames received, %u dropped, %u sent, %u send errors\n",
+                  rx_frames, rx_dropped, tx_frames, tx_errors);
+}
+
+
+/*
+ *  Ethernet interrupt: hand the received frames to their protocol handlers
+ */
+
+void EtherInterrupt(void)
+{
+    D(bug("EtherIRQ\n"));
+
+    // Frames arriving from now on raise the interrupt again
+    __atomic_store_n(&rx_signalled, false, __ATOMIC_RELEASE);
+    uint32 head = __atomic_load_n(&rx_head, __ATOMIC_ACQUIRE);
+    while (rx_tail != head && rx_ring) {
+        uint32 slot = rx_tail % ETHER_RX_SLOTS;
+        uint32 packet = rx_ring + slot * ETHER_SLOT_SIZE;
+        uint32 length = rx_length[slot];
+
+        // Tunnelled frames go to the protocols ether.cpp keeps
+        if (!bridge) {
+            ether_udp_read(packet, length, &rx_from[slot]);
+            __atomic_store_n(&rx_tail, rx_tail + 1, __ATOMIC_RELEASE);
+            head = __atomic_load_n(&rx_head, __ATOMIC_ACQUIRE);
+            continue;
+        }
+
+        // Look for protocol (802.3 frames have a length instead of a type)
+        uint16 type = ReadMacInt16(packet + 12);
+        uint16 search_type = (type <= 1500 ? 0 : type);
+        std::map<uint16, uint32>::const_iterator it = net_protocols.find(search_type);
+        if (it != net_protocols.end() && it->second) {
+            // Copy header to RHA
+            Mac2Mac_memcpy(ether_data + ed_RHA, packet, 14);
+
+            // Call protocol handler, ReadPacket reads from the ring slot
+            M68kRegisters r;
+            r.d[0] = type;                              // Packet type
+            r.d[1] = length - 14;                       // Remaining packet length (without header, for ReadPacket)
+            r.a[0] = packet + 14;                       // Pointer to packet (Mac address, for ReadPacket)
+            r.a[3] = ether_data + ed_RHA + 14;          // Pointer behind header in RHA
+            r.a[4] = ether_data + ed_ReadPacket;        // Pointer to ReadPacket/ReadRest routines
+            Execute68k(it->second, &r);
+        }
+
+        // The slot is free for the receive task again
+        __atomic_store_n(&rx_tail, rx_tail + 1, __ATOMIC_RELEASE);
+        head = __atomic_load_n(&rx_head, __ATOMIC_ACQUIRE);
+    }
+}
@@ -0,0 +1,2029 @@
+/*
+ *  extfs.cpp - Folder on the SD card as a Mac volume
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The folder named by the "extfs" pref is mounted as a volume through the
+ *  File System Manager (System 7.5, or 7.1 with the FSM extension). The
+ *  HFS component of our file system is a stub that calls ExtFSHFS(), which
+ *  answers the File Manager calls with the card's files: Finder copies,
+ *  Open and Standard File dialogs and applications see them as they are,
+ *  and a read goes from FatFs into the Mac buffer with no HFS catalog or
+ *  extents B-tree walked in emulated code.
+ *
+ *  Each file and folder the Mac has seen is an FSItem with a fixed catalog
+ *  ID, found by ID and by (parent, name) through two hash tables. Pathnames
+ *  are parsed natively; the FSM utilities (_HFSUtilities) are called only
+ *  for the File Manager's own tables: FCBs, the VCB, working directories
+ *  and the default volume. All of them go through one 68k stub that copies
+ *  a Pascal argument block onto the stack.
+ *
+ *  The Finder enumerates a folder with an indexed GetCatInfo() per entry.
+ *  The last DIR_LISTINGS folders listed are kept with their entries in
+ *  order, and each item caches its kind, sizes, date and Finder info, so
+ *  an enumeration scans the folder on the card once rather than once per
+ *  entry, and a name looked up in a listed folder is known to be missing
+ *  without a stat(). Only the Mac changes the folder while it runs, so
+ *  the caches are dropped by our own creates, deletes, renames, moves and
+ *  writes and never expire.
+ *
+ *  Resource forks and Finder info are kept in sidecar files, .rsrc/<name>
+ *  and .finf/<name> next to the file (see extfs_esp32.cpp), as the Unix
+ *  versions of Basilisk II do, so a folder can be shared with them. Names
+ *  starting with '.' are not shown.
+ */
+
+#include "sysdeps.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <utime.h>
+#include <sys/stat.h>
+
+#include <Arduino.h>
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "macos_util.h"
+#include "prefs.h"
+#include "user_strings.h"
+#include "emul_op.h"
+#include "disk.h"
+#include "perf_registry.h"
+#include "extfs_defs.h"
+#include "extfs.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+#if SUPPORTS_EXTFS
+
+#define MY_FSID             0x4232      // 'B2'
+#define ROOT_PARENT_ID      1
+#define ROOT_ID             2
+#define FS_STACK_SIZE       0x8000      // Stack of the HFS component, after fs_data
+#define CLUMP_SIZE          0x8000
+#define MAX_VOLUME_BYTES    0x7fff0000  // Larger sizes overflow the System 7 Finder
+#define ITEM_HASH_SIZE      512         // Power of two
+#define DIR_LISTINGS        8
+
+// Error codes not in macos_util.h
+enum {
+    dirFulErr = -33,
+    vLckdErr = -46,
+    volOnLinErr = -55,
+    wrPermErr = -61,
+    badMovErr = -122,
+    afpItemNotFound = -5012
+};
+
+enum {  // FSSpec struct
+    fsVRefNum = 0,
+    fsParID = 2,
+    fsName = 6
+};
+
+// _HFSUtilities selectors
+enum {
+    utAllocateFCB = 0x00,
+    utReleaseFCB = 0x01,
+    utIndexFCB = 0x04,
+    utResolveFCB = 0x05,
+    utAllocateVCB = 0x06,
+    utAddNewVCB = 0x07,
+    utDisposeVCB = 0x08,
+    utAllocateWDCB = 0x0c,
+    utReleaseWDCB = 0x0d,
+    utResolveWDCB = 0x0e,
+    utAdjustEOF = 0x10,
+    utSetDefaultVol = 0x11,
+    utGetDefaultVol = 0x12,
+    utDetermineVol = 0x1d
+};
+
+// Our data in the system heap
+enum {
+    fsCommStub = 0,                 // EmulOp, rtd #10
+    fsHFSStub = 8,                  // EmulOp, rtd #16
+    fsUtilStub = 16,                // FSM utility call, see fsm_util()
+    fsDrvStatus = 32,               // Drive queue element
+    fsFSD = fsDrvStatus + 32,       // File system descriptor
+    fsPB = fsFSD + SIZEOF_FSDRec,   // Parameter block for our calls
+    fsArgs = fsPB + 108,            // FSM utility arguments
+    fsReturn = fsArgs + 32,         // FSM utility results
+    fsWDPB = fsReturn + 16,         // UTGetDefaultVol() parameter block
+    fsFinfo = fsWDPB + SIZEOF_WDParam,
+    fsIcon = fsFinfo + 32,          // ICN# of the volume
+    SIZEOF_fsdat = fsIcon + 256
+};
+
+// FSItem.flags: which cached values are valid
+enum {
+    ITEM_EXISTS = 1,                // Found on the card
+    ITEM_STAT = 2,                  // is_dir, size, mtime
+    ITEM_RSIZE = 4,                 // rsrc_size
+    ITEM_FINFO = 8,                 // finfo
+    ITEM_COUNT = 16                 // count
+};
+
+struct FSItem {
+    FSItem *next_id;                // Hash chains
+    FSItem *next_name;
+    FSItem *parent;
+    uint32 id;                      // Catalog node ID
+    uint32 parent_id;
+    char *name;                     // Host name
+    char guest_name[32];            // Mac name (MacRoman C string)
+    uint8 flags;
+    bool is_dir;
+    uint16 open_count;              // Forks open
+    uint32 size;                    // Data fork
+    uint32 rsrc_size;
+    uint32 mtime;                   // Mac time
+    uint32 count;                   // Entries of a folder
+    uint8 finfo[32];                // FInfo and FXInfo (or DInfo and DXInfo), Mac byte order
+};
+
+struct dir_listing {
+    uint32 dir_id;                  // 0: free
+    uint32 used;                    // LRU stamp
+    uint32 count;
+    uint32 files;                   // Entries that are not folders
+    FSItem **entries;               // In readdir() order
+};
+
+struct fsm_param {
+    uint32 value;
+    int size;                       // 2 or 4
+};
+
+static bool ready = false;
+static char root_path[MAX_PATH_LENGTH];     // Host path of the volume
+static char full_path[MAX_PATH_LENGTH];     // Host path of the last item asked for
+static char volume_name[28];                // C string
+static uint32 fs_data = 0;                  // Mac address of our data
+static uint32 mounted_vcb = 0;
+static int16 drive_number;
+static uint32 al_block_size = 512;
+static uint64 open_fds = 0;                 // Host descriptors of open forks, by bit
+
+static FSItem *id_hash[ITEM_HASH_SIZE];
+static FSItem *name_hash[ITEM_HASH_SIZE];
+static uint32 next_cnid = fsUsrCNID;
+static FSItem *root_parent, *root;
+
+static dir_listing listings[DIR_LISTINGS];
+static uint32 listing_clock = 0;
+
+static perf_counter *const perf_calls = PerfCounter("extfs.calls", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_dir_scans = PerfCounter("extfs.dir_scans", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_dir_hits = PerfCounter("extfs.dir_hits", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_stats = PerfCounter("extfs.stats", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_read_bytes = PerfCounter("extfs.read_bytes", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_write_bytes = PerfCounter("extfs.write_bytes", PERF_COUNT, PERF_CORE_CPU);
+
+
+/*
+ *  Strings and errors
+ */
+
+static void cstr2pstr(char *dst, const char *src)
+{
+    size_t n = strlen(src);
+    if (n > 255)
+        n = 255;
+    *dst++ = n;
+    memcpy(dst, src, n);
+}
+
+static void pstr2cstr(char *dst, const uint8 *src, size_t size)
+{
+    size_t n = *src++;
+    if (n > size - 1)
+        n = size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+}
+
+static int16 errno2oserr(void)
+{
+    switch (errno) {
+        case 0:
+            return noErr;
+        case ENOENT:
+        case EISDIR:
+            return fnfErr;
+        case ENOTDIR:
+            return dirNFErr;
+        case EACCES:
+        case EPERM:
+            return permErr;
+        case EEXIST:
+            return dupFNErr;
+        case EBUSY:
+        case ENOTEMPTY:
+            return fBsyErr;
+        case ENOSPC:
+            return dskFulErr;
+        case EROFS:
+            return wPrErr;
+        case EMFILE:
+        case ENFILE:
+            return tmfoErr;
+        case EINVAL:
+            return paramErr;
+        case ENOMEM:
+            return memFullErr;
+        default:
+            return ioErr;
+    }
+}
+
+
+/*
+ *  Items
+ */
+
+static inline uint32 id_key(uint32 id)
+{
+    return (id * 0x9e3779b1) >> 23 & (ITEM_HASH_SIZE - 1);
+}
+
+static uint32 name_key(uint32 parent_id, const char *name)
+{
+    uint32 h = parent_id * 0x9e3779b1;
+    for (; *name; name++) {
+        uint8 c = *name;
+        if (c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+        h = (h ^ c) * 16777619;
+    }
+    return h & (ITEM_HASH_SIZE - 1);
+}
+
+static void link_name(FSItem *item)
+{
+    FSItem **head = &name_hash[name_key(item->parent_id, item->guest_name)];
+    item->next_name = *head;
+    *head = item;
+}
+
+static void unlink_name(FSItem *item)
+{
+    FSItem **p = &name_hash[name_key(item->parent_id, item->guest_name)];
+    while (*p && *p != item)
+        p = &(*p)->next_name;
+    if (*p)
+        *p = item->next_name;
+    item->next_name = NULL;
+}
+
+static void set_guest_name(FSItem *item, const char *guest)
+{
+    strncpy(item->guest_name, guest, 31);
+    item->guest_name[31] = 0;
+    for (char *p = item->guest_name; *p; p++)
+        if (*p == ':')
+            *p = '/';
+}
+
+static FSItem *new_item(FSItem *parent, uint32 id, const char *host_name, const char *guest_name)
+{
+    FSItem *item = (FSItem *)psram_calloc(1, sizeof(FSItem));
+    char *name = (char *)psram_malloc(strlen(host_name) + 1);
+    if (item == NULL || name == NULL) {
+        free(item);
+        free(name);
+        return NULL;
+    }
+    strcpy(name, host_name);
+    item->name = name;
+    item->parent = parent;
+    item->parent_id = parent ? parent->id : 0;
+    item->id = id;
+    set_guest_name(item, guest_name);
+
+    FSItem **head = &id_hash[id_key(id)];
+    item->next_id = *head;
+    *head = item;
+    link_name(item);
+    return item;
+}
+
+static FSItem *find_item_by_id(uint32 id)
+{
+    for (FSItem *item = id_hash[id_key(id)]; item; item = item->next_id)
+        if (item->id == id)
+            return item;
+    return NULL;
+}
+
+// Item of a Mac name in a folder, NULL if the Mac has not seen it yet
+static FSItem *find_child(FSItem *parent, const char *guest_name)
+{
+    for (FSItem *item = name_hash[name_key(parent->id, guest_name)]; item; item = item->next_name)
+        if (item->parent == parent && strcasecmp(item->guest_name, guest_name) == 0)
+            return item;
+    return NULL;
+}
+
+// Item of a host name found in a folder, made if needed
+static FSItem *host_child(FSItem *parent, const char *host_name)
+{
+    char guest[32];
+    strncpy(guest, host_encoding_to_macroman(host_name), 31);
+    guest[31] = 0;
+    for (FSItem *item = name_hash[name_key(parent->id, guest)]; item; item = item->next_name)
+        if (item->parent == parent && strcasecmp(item->name, host_name) == 0)
+            return item;
+    return new_item(parent, next_cnid++, host_name, guest);
+}
+
+// Item of a Mac name in a folder, made if needed (the file may not exist)
+static FSItem *guest_child(FSItem *parent, const char *guest_name)
+{
+    FSItem *item = find_child(parent, guest_name);
+    if (item)
+        return item;
+    return new_item(parent, next_cnid++, macroman_to_host_encoding(guest_name), guest_name);
+}
+
+static void build_path(FSItem *item, char *path)
+{
+    if (item->id <= ROOT_ID) {
+        strcpy(path, root_path);
+        return;
+    }
+    build_path(item->parent, path);
+    add_path_component(path, item->name);
+}
+
+static void get_path_for_fsitem(FSItem *item)
+{
+    build_path(item, full_path);
+}
+
+static void free_items(void)
+{
+    for (int i = 0; i < ITEM_HASH_SIZE; i++) {
+        FSItem *item = id_hash[i];
+        while (item) {
+            FSItem *next = item->next_id;
+            free(item->name);
+            free(item);
+            item = next;
+        }
+        id_hash[i] = name_hash[i] = NULL;
+    }
+    root = root_parent = NULL;
+}
+
+
+/*
+ *  Folder listings and item metadata
+ */
+
+static dir_listing *find_listing(uint32 dir_id)
+{
+    for (int i = 0; i < DIR_LISTINGS; i++)
+        if (listings[i].dir_id == dir_id)
+            return &listings[i];
+    return NULL;
+}
+
+// The folder's entries changed
+static void drop_listing(FSItem *dir)
+{
+    dir->flags &= ~ITEM_COUNT;
+    dir_listing *l = find_listing(dir->id);
+    if (l) {
+        free(l->entries);
+        memset(l, 0, sizeof(*l));
+    }
+}
+
+static void drop_listings(void)
+{
+    for (int i = 0; i < DIR_LISTINGS; i++) {
+        free(listings[i].entries);
+        memset(&listings[i], 0, sizeof(listings[i]));
+    }
+}
+
+static bool hidden_name(FSItem *dir, const char *name)
+{
+    return name[0] == '.' || (dir == root && strcasecmp(name, "System Volume Information") == 0);
+}
+
+static void set_item_stat(FSItem *item, const struct stat &st)
+{
+    item->is_dir = S_ISDIR(st.st_mode);
+    item->size = st.st_size > 0x7fffffff ? 0x7fffffff : st.st_size;
+    item->mtime = TimeToMacTime(st.st_mtime);
+    item->flags |= ITEM_EXISTS | ITEM_STAT;
+}
+
+static dir_listing *get_listing(FSItem *dir)
+{
+    dir_listing *l = find_listing(dir->id);
+    if (l) {
+        perf_inc(perf_dir_hits);
+        l->used = ++listing_clock;
+        return l;
+    }
+
+    // Least recently used slot
+    l = &listings[0];
+    for (int i = 1; i < DIR_LISTINGS; i++)
+        if (listings[i].used < l->used)
+            l = &listings[i];
+    free(l->entries);
+    memset(l, 0, sizeof(*l));
+
+    get_path_for_fsitem(dir);
+    DIR *d = opendir(full_path);
+    if (d == NULL)
+        return NULL;
+    perf_inc(perf_dir_scans);
+    size_t base = strlen(full_path);
+    uint32 capacity = 0;
+    struct dirent *de;
+    while ((de = readdir(d)) != NULL) {
+        if (hidden_name(dir, de->d_name))
+            continue;
+        FSItem *item = host_child(dir, de->d_name);
+        if (item == NULL)
+            break;
+        full_path[base] = 0;
+        add_path_component(full_path, de->d_name);
+        struct stat st;
+        perf_inc(perf_stats);
+        if (stat(full_path, &st) < 0)
+            continue;
+        set_item_stat(item, st);
+        if (l->count == capacity) {
+            capacity = capacity ? capacity * 2 : 32;
+            FSItem **entries = (FSItem **)realloc(l->entries, capacity * sizeof(FSItem *));
+            if (entries == NULL)
+                break;
+            l->entries = entries;
+        }
+        l->entries[l->count++] = item;
+        if (!item->is_dir)
+            l->files++;
+    }
+    closedir(d);
+    full_path[base] = 0;
+
+    l->dir_id = dir->id;
+    l->used = ++listing_clock;
+    dir->count = l->count;
+    dir->flags |= ITEM_COUNT;
+    return l;
+}
+
+static bool item_exists(FSItem *item)
+{
+    if (item->flags & ITEM_EXISTS)
+        return true;
+    if (item->parent && find_listing(item->parent_id))
+        return false;   // Not in the listing
+    get_path_for_fsitem(item);
+    struct stat st;
+    perf_inc(perf_stats);
+    if (stat(full_path, &st) < 0)
+        return false;
+    set_item_stat(item, st);
+    return true;
+}
+
+// Kind, size and date; false if the item does not exist
+static bool item_stat(FSItem *item)
+{
+    if (item->flags & ITEM_STAT)
+        return true;
+    if (!item_exists(item))
+        return false;
+    if (item->flags & ITEM_STAT)
+        return true;
+    get_path_for_fsitem(item);
+    struct stat st;
+    perf_inc(perf_stats);
+    if (stat(full_path, &st) < 0) {
+        item->flags &= ~ITEM_EXISTS;
+        return false;
+    }
+    set_item_stat(item, st);
+    return true;
+}
+
+static uint32 item_rsrc_size(FSItem *item)
+{
+    if (!(item->flags & ITEM_RSIZE)) {
+        get_path_for_fsitem(item);
+        item->rsrc_size = get_rfork_size(full_path);
+        item->flags |= ITEM_RSIZE;
+    }
+    return item->rsrc_size;
+}
+
+static uint32 item_count(FSItem *dir)
+{
+    if (dir->flags & ITEM_COUNT)
+        return dir->count;
+    dir->count = 0;
+    get_path_for_fsitem(dir);
+    DIR *d = opendir(full_path);
+    if (d) {
+        struct dirent *de;
+        while ((de = readdir(d)) != NULL)
+            if (!hidden_name(dir, de->d_name))
+                dir->count++;
+        closedir(d);
+    }
+    dir->flags |= ITEM_COUNT;
+    return dir->count;
+}
+
+static const uint8 *item_finfo(FSItem *item)
+{
+    if (!(item->flags & ITEM_FINFO)) {
+        get_path_for_fsitem(item);
+        get_finfo(full_path, fs_data + fsFinfo, fs_data + fsFinfo + 16, item->is_dir);
+        Mac2Host_memcpy(item->finfo, fs_data + fsFinfo, 32);
+        item->flags |= ITEM_FINFO;
+    }
+    return item->finfo;
+}
+
+// Write Finder info from the Mac (fxinfo may be 0) unless it is what the item has
+static void set_item_finfo(FSItem *item, uint32 finfo, uint32 fxinfo)
+{
+    const uint8 *old = item_finfo(item);
+    size_t n = fxinfo ? 32 : 16;
+    if (memcmp(old, Mac2HostAddr(finfo), 16) == 0 && (!fxinfo || memcmp(old + 16, Mac2HostAddr(fxinfo), 16) == 0))
+        return;
+    get_path_for_fsitem(item);
+    set_finfo(full_path, finfo, fxinfo, item->is_dir);
+    Mac2Host_memcpy(item->finfo, finfo, 16);
+    if (n == 32)
+        Mac2Host_memcpy(item->finfo + 16, fxinfo, 16);
+}
+
+static void track_fd(int fd, bool open)
+{
+    if (fd < 0 || fd >= 64)
+        return;
+    if (open)
+        open_fds |= 1ULL << fd;
+    else
+        open_fds &= ~(1ULL << fd);
+}
+
+static inline uint32 physical_size(uint32 size)
+{
+    return (size + al_block_size - 1) & ~(al_block_size - 1);
+}
+
+
+/*
+ *  FSM utilities
+ *
+ *  params are in the routine's declaration order. They are laid out in
+ *  fsArgs as a Pascal caller pushes them, the first at the highest address,
+ *  and the stub copies the block onto the stack:
+ *
+ *      clr.w   -(sp)           ; Result
+ *  1$  move.w  -(a0),-(sp)     ; a0: end of the block
+ *      dbra    d1,1$           ; d1: words - 1
+ *      _HFSUtilities           ; d0: selector
+ *      move.w  (sp)+,d0
+ *      rts
+ */
+
+static int16 fsm_util(uint16 selector, const fsm_param *params, int n)
+{
+    uint32 p = fs_data + fsArgs;
+    for (int i = n - 1; i >= 0; i--) {
+        if (params[i].size == 4)
+            WriteMacInt32(p, params[i].value);
+        else
+            WriteMacInt16(p, params[i].value);
+        p += params[i].size;
+    }
+    M68kRegisters r;
+    r.d[0] = selector;
+    r.d[1] = (p - (fs_data + fsArgs)) / 2 - 1;
+    r.a[0] = p;
+    Execute68k(fs_data + fsUtilStub, &r);
+    return (int16)(r.d[0] & 0xffff);
+}
+
+static int16 resolve_fcb(int16 refNum, uint32 &fcb)
+{
+    fsm_param p[] = {{(uint16)refNum, 2}, {fs_data + fsReturn, 4}};
+    int16 result = fsm_util(utResolveFCB, p, 2);
+    if (result != noErr)
+        return result;
+    fcb = ReadMacInt32(fs_data + fsReturn);
+    return ReadMacInt32(fcb + fcbFlNm) ? noErr : fnOpnErr;
+}
+
+static int16 adjust_eof(int16 refNum)
+{
+    fsm_param p[] = {{(uint16)refNum, 2}};
+    return fsm_util(utAdjustEOF, p, 1);
+}
+
+// Folder that the pathname in ioNamePtr starts from
+static int16 get_current_dir(uint32 pb, uint32 dirID, uint32 &current_dir, bool no_vol_name = false)
+{
+    uint32 name_ptr = 0;
+    if (no_vol_name) {
+        name_ptr = ReadMacInt32(pb + ioNamePtr);
+        WriteMacInt32(pb + ioNamePtr, 0);
+    }
+    uint32 ret = fs_data + fsReturn;
+    fsm_param p[] = {{pb, 4}, {ret, 4}, {ret + 2, 4}, {ret + 4, 4}, {ret + 6, 4}};
+    int16 result = fsm_util(utDetermineVol, p, 5);
+    if (no_vol_name)
+        WriteMacInt32(pb + ioNamePtr, name_ptr);
+    int16 status = ReadMacInt16(ret);
+    D(bug("  UTDetermineVol() returned %d, status %d\n", result, status));
+    if (result != noErr)
+        return result;
+
+    switch (status) {
+        case dtmvFullPathname:      // Starts with the volume name
+            current_dir = ROOT_PARENT_ID;
+            break;
+
+        case dtmvVRefNum:           // Volume or drive number
+        case dtmvDriveNum:
+            current_dir = dirID ? dirID : ROOT_ID;
+            break;
+
+        case dtmvWDRefNum:          // Working directory
+            if (dirID)
+                current_dir = dirID;
+            else {
+                fsm_param w[] = {{0, 4}, {0, 2}, {ReadMacInt16(pb + ioVRefNum), 2}, {ret, 4}};
+                result = fsm_util(utResolveWDCB, w, 4);
+                if (result == noErr)
+                    current_dir = ReadMacInt32(ReadMacInt32(ret) + wdDirID);
+            }
+            break;
+
+        case dtmvDefault:           // Default volume
+            if (dirID)
+                current_dir = dirID;
+            else {
+                uint32 wdpb = fs_data + fsWDPB;
+                WriteMacInt32(wdpb + ioNamePtr, 0);
+                fsm_param w[] = {{wdpb, 4}};
+                result = fsm_util(utGetDefaultVol, w, 1);
+                if (result == noErr)
+                    current_dir = ReadMacInt32(wdpb + ioWDDirID);
+            }
+            break;
+
+        default:
+            result = paramErr;
+            break;
+    }
+    return result;
+}
+
+// Item named by ioVRefNum, dirID and ioNamePtr; the last pathname
+// component need not exist. full_path is set to its host path.
+static int16 get_item_and_path(uint32 pb, uint32 dirID, FSItem *&item, bool no_vol_name = false)
+{
+    uint32 current_dir;
+    int16 result = get_current_dir(pb, dirID, current_dir, no_vol_name);
+    if (result != noErr)
+        return result;
+    FSItem *dir = find_item_by_id(current_dir);
+    if (dir == NULL)
+        return dirNFErr;
+
+    uint32 name_ptr = ReadMacInt32(pb + ioNamePtr);
+    const uint8 *name = name_ptr && !no_vol_name ? Mac2HostAddr(name_ptr) : NULL;
+    const char *p = name ? (const char *)name + 1 : NULL;
+    const char *end = name ? p + name[0] : NULL;
+    if (p && p < end && *p == ':' && dir != root_parent)
+        p++;                        // Partial pathname
+
+    item = dir;
+    while (p && p < end) {
+        if (*p == ':') {            // Empty component: parent folder
+            if (dir->id <= ROOT_ID)
+                return dirNFErr;
+            dir = dir->parent;
+            item = dir;
+            p++;
+            continue;
+        }
+        const char *q = (const char *)memchr(p, ':', end - p);
+        if (q == NULL)
+            q = end;
+        char component[32];
+        size_t n = q - p;
+        if (n > 31)
+            return bdNamErr;
+        memcpy(component, p, n);
+        component[n] = 0;
+
+        if (dir == root_parent)     // Volume name
+            item = root;
+        else if ((item = guest_child(dir, component)) == NULL)
+            return memFullErr;
+        if (q < end) {              // Must be a folder
+            if (!item_stat(item) || !item->is_dir)
+                return dirNFErr;
+            dir = item;
+            p = q + 1;
+        } else
+            p = q;
+    }
+    if (item == root_parent)
+        item = root;
+    get_path_for_fsitem(item);
+    return noErr;
+}
+
+
+/*
+ *  Volume
+ */
+
+static void volume_blocks(uint32 &total_blocks, uint32 &free_blocks)
+{
+    uint64 total, free;
+    extfs_volume_size(total, free);
+    if (total > MAX_VOLUME_BYTES)
+        total = MAX_VOLUME_BYTES;
+    if (free > total)
+        free = total;
+    total_blocks = total / al_block_size;
+    free_blocks = free / al_block_size;
+}
+
+static int16 fs_mount_vol(uint32 pb)
+{
+    D(bug(" fs_mount_vol(%08lx), vRefNum %d\n", pb, ReadMacInt16(pb + ioVRefNum)));
+    if ((int16)ReadMacInt16(pb + ioVRefNum) != drive_number)
+        return nsvErr;
+    if (mounted_vcb)
+        return volOnLinErr;
+    root->flags &= ~ITEM_STAT;
+    if (!item_stat(root))
+        return offLinErr;
+
+    // Allocation blocks: the smallest size from 512 bytes that counts the volume in 16 bits
+    uint64 total, free;
+    extfs_volume_size(total, free);
+    if (total > MAX_VOLUME_BYTES)
+        total = MAX_VOLUME_BYTES;
+    al_block_size = 512;
+    while (total / al_block_size > 0xfffe)
+        al_block_size <<= 1;
+    uint32 total_blocks, free_blocks;
+    volume_blocks(total_blocks, free_blocks);
+
+    // Make our VCB
+    uint32 ret = fs_data + fsReturn;
+    fsm_param a[] = {{ret, 4}, {ret + 2, 4}, {0, 2}};
+    int16 result = fsm_util(utAllocateVCB, a, 3);
+    if (result != noErr)
+        return result;
+    uint32 vcb = ReadMacInt32(ret + 2);
+    WriteMacInt16(vcb + vcbSigWord, 0x4244);
+    WriteMacInt32(vcb + vcbCrDate, root->mtime);
+    WriteMacInt32(vcb + vcbLsMod, root->mtime);
+    WriteMacInt32(vcb + vcbVolBkUp, 0);
+    WriteMacInt16(vcb + vcbNmFls, item_count(root));
+    WriteMacInt16(vcb + vcbNmRtDirs, 1);
+    WriteMacInt16(vcb + vcbNmAlBlks, total_blocks);
+    WriteMacInt32(vcb + vcbAlBlkSiz, al_block_size);
+    WriteMacInt32(vcb + vcbClpSiz, CLUMP_SIZE);
+    WriteMacInt32(vcb + vcbNxtCNID, next_cnid);
+    WriteMacInt16(vcb + vcbFreeBks, free_blocks);
+    cstr2pstr((char *)Mac2HostAddr(vcb + vcbVN), volume_name);
+    WriteMacInt16(vcb + vcbFSID, MY_FSID);
+    WriteMacInt32(vcb + vcbFilCnt, 1);
+    WriteMacInt32(vcb + vcbDirCnt, 1);
+
+    // Add it to the VCB queue
+    fsm_param n[] = {{(uint16)drive_number, 2}, {ret, 4}, {vcb, 4}};
+    result = fsm_util(utAddNewVCB, n, 3);
+    if (result != noErr)
+        return result;
+    int16 vRefNum = ReadMacInt16(ret);
+    mounted_vcb = vcb;
+
+    // Tell the Finder
+    M68kRegisters r;
+    r.d[0] = drive_number;
+    r.a[0] = 7;     // diskEvt
+    Execute68kTrap(0xa02f, &r);     // PostEvent()
+
+    WriteMacInt16(pb + ioVRefNum, vRefNum);
+    Serial.printf("[EXTFS] Volume \"%s\" mounted, %u KB free\n", volume_name, (unsigned)(free / 1024));
+    return noErr;
+}
+
+static int16 fs_unmount_vol(uint32 vcb)
+{
+    D(bug(" fs_unmount_vol(%08lx)\n", vcb));
+    fsm_param p[] = {{vcb, 4}};
+    int16 result = fsm_util(utDisposeVCB, p, 1);
+    if (result == noErr)
+        mounted_vcb = 0;
+    return result;
+}
+
+static int16 fs_get_vol_info(uint32 pb, bool hfs, uint32 vcb)
+{
+    D(bug(" fs_get_vol_info(%08lx)\n", pb));
+    uint32 total_blocks, free_blocks;
+    volume_blocks(total_blocks, free_blocks);
+
+    if (ReadMacInt32(pb + ioNamePtr))
+        cstr2pstr((char *)Mac2HostAddr(ReadMacInt32(pb + ioNamePtr)), volume_name);
+    if ((int16)ReadMacInt16(pb + ioVolIndex) > 0 && vcb)
+        WriteMacInt16(pb + ioVRefNum, ReadMacInt16(vcb + vcbVRefNum));
+    WriteMacInt32(pb + ioVCrDate, root->mtime);
+    WriteMacInt32(pb + ioVLsMod, root->mtime);
+    WriteMacInt16(pb + ioVAtrb, 0);
+    WriteMacInt16(pb + ioVNmFls, item_count(root));
+    WriteMacInt16(pb + ioVBitMap, 0);
+    WriteMacInt16(pb + ioAllocPtr, 0);
+    WriteMacInt16(pb + ioVNmAlBlks, total_blocks);
+    WriteMacInt32(pb + ioVAlBlkSiz, al_block_size);
+    WriteMacInt32(pb + ioVClpSiz, CLUMP_SIZE);
+    WriteMacInt16(pb + ioAlBlSt, 0);
+    WriteMacInt32(pb + ioVNxtCNID, next_cnid);
+    WriteMacInt16(pb + ioVFrBlk, free_blocks);
+    if (vcb)
+        WriteMacInt16(vcb + vcbFreeBks, free_blocks);
+    if (hfs) {
+        WriteMacInt16(pb + ioVSigWord, 0x4244);
+        WriteMacInt16(pb + ioVDrvInfo, drive_number);
+        WriteMacInt16(pb + ioVDRefNum, ReadMacInt16(fs_data + fsDrvStatus + dsQRefNum));
+        WriteMacInt16(pb + ioVFSID, MY_FSID);
+        WriteMacInt32(pb + ioVBkUp, 0);
+        WriteMacInt16(pb + ioVSeqNum, 0);
+        WriteMacInt32(pb + ioVWrCnt, 0);
+        WriteMacInt32(pb + ioVFilCnt, 1);
+        WriteMacInt32(pb + ioVDirCnt, 1);
+        Mac_memset(pb + ioVFndrInfo, 0, 32);
+    }
+    return noErr;
+}
+
+static int16 fs_get_vol_parms(uint32 pb)
+{
+    D(bug(" fs_get_vol_parms(%08lx)\n", pb));
+    uint32 actual = ReadMacInt32(pb + ioReqCount);
+    if (actual > SIZEOF_GetVolParmsInfoBuffer)
+        actual = SIZEOF_GetVolParmsInfoBuffer;
+    WriteMacInt32(pb + ioActCount, actual);
+    uint32 p = ReadMacInt32(pb + ioBuffer);
+    if (actual > vMVersion)
+        WriteMacInt16(p + vMVersion, 2);
+    if (actual > vMAttrib)
+        WriteMacInt32(p + vMAttrib, kNoMiniFndr | kNoVNEdit | kNoLclSync | kTrshOffLine | kNoSwitchTo | kNoBootBlks | kNoSysDir | kHasExtFSVol);
+    if (actual > vMLocalHand)
+        WriteMacInt32(p + vMLocalHand, 0);
+    if (actual > vMServerAdr)
+        WriteMacInt32(p + vMServerAdr, 0);
+    if (actual >= SIZEOF_GetVolParmsInfoBuffer) {
+        WriteMacInt32(p + vMVolumeGrade, 0);
+        WriteMacInt16(p + vMForeignPrivID, 0);
+    }
+    return noErr;
+}
+
+static int16 fs_get_vol(uint32 pb)
+{
+    D(bug(" fs_get_vol(%08lx)\n", pb));
+    fsm_param p[] = {{pb, 4}};
+    return fsm_util(utGetDefaultVol, p, 1);
+}
+
+static int16 fs_set_vol(uint32 pb, bool hfs, uint32 vcb)
+{
+    D(bug(" fs_set_vol(%08lx), vRefNum %d\n", pb, ReadMacInt16(pb + ioVRefNum)));
+    uint32 dir_id;
+    int16 ref_num;
+    if (hfs) {
+        FSItem *item;
+        int16 result = get_item_and_path(pb, ReadMacInt32(pb + ioDirID), item);
+        if (result != noErr)
+            return result;
+        if (!item_stat(item) || !item->is_dir)
+            return dirNFErr;
+        dir_id = item->id;
+        ref_num = ReadMacInt16(vcb + vcbVRefNum);
+    } else {
+        uint32 ret = fs_data + fsReturn;
+        fsm_param p[] = {{pb, 4}, {ret, 4}, {ret + 2, 4}, {ret + 4, 4}, {ret + 6, 4}};
+        int16 result = fsm_util(utDetermineVol, p, 5);
+        if (result != noErr)
+            return result;
+        if (ReadMacInt16(ret) == dtmvWDRefNum) {
+            dir_id = 0;
+            ref_num = ReadMacInt16(pb + ioVRefNum);
+        } else {
+            dir_id = ROOT_ID;
+            ref_num = ReadMacInt16(vcb + vcbVRefNum);
+        }
+    }
+    fsm_param p[] = {{0, 4}, {dir_id, 4}, {(uint16)ref_num, 2}};
+    return fsm_util(utSetDefaultVol, p, 3);
+}
+
+
+/*
+ *  Catalog information
+ */
+
+static void put_file_info(uint32 pb, FSItem *item, bool hfs)
+{
+    WriteMacInt32(pb + ioDirID, item->id);
+    Host2Mac_memcpy(pb + ioFlFndrInfo, item_finfo(item), 16);
+    WriteMacInt16(pb + ioFlStBlk, 0);
+    WriteMacInt32(pb + ioFlLgLen, item->size);
+    WriteMacInt32(pb + ioFlPyLen, physical_size(item->size));
+    WriteMacInt16(pb + ioFlRStBlk, 0);
+    uint32 rsrc_size = item_rsrc_size(item);
+    WriteMacInt32(pb + ioFlRLgLen, rsrc_size);
+    WriteMacInt32(pb + ioFlRPyLen, physical_size(rsrc_size));
+    WriteMacInt32(pb + ioFlCrDat, item->mtime);
+    WriteMacInt32(pb + ioFlMdDat, item->mtime);
+    if (hfs) {
+        WriteMacInt32(pb + ioFlBkDat, 0);
+        Host2Mac_memcpy(pb + ioFlXFndrInfo, item->finfo + 16, 16);
+        WriteMacInt32(pb + ioFlParID, item->parent_id);
+        WriteMacInt32(pb + ioFlClpSiz, 0);
+    }
+}
+
+static int16 fs_get_file_info(uint32 pb, bool hfs, uint32 dirID)
+{
+    D(bug(" fs_get_file_info(%08lx), vRefNum %d, index %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt16(pb + ioFDirIndex), dirID));
+    FSItem *item;
+    int16 dir_index = ReadMacInt16(pb + ioFDirIndex);
+    if (dir_index <= 0) {           // By name
+        int16 result = get_item_and_path(pb, dirID, item);
+        if (result != noErr)
+            return result;
+        if (!item_stat(item) || item->is_dir)
+            return fnfErr;
+    } else {                        // n-th file of the folder
+        uint32 current_dir;
+        int16 result = get_current_dir(pb, dirID, current_dir, true);
+        if (result != noErr)
+            return result;
+        FSItem *dir = find_item_by_id(current_dir);
+        if (dir == NULL)
+            return dirNFErr;
+        dir_listing *l = get_listing(dir);
+        if (l == NULL)
+            return dirNFErr;
+        if ((uint32)dir_index > l->files)
+            return fnfErr;
+        item = NULL;
+        for (uint32 i = 0, n = 0; i < l->count; i++)
+            if (!l->entries[i]->is_dir && ++n == (uint32)dir_index) {
+                item = l->entries[i];
+                break;
+            }
+        if (item == NULL)
+            return fnfErr;
+        if (ReadMacInt32(pb + ioNamePtr))
+            cstr2pstr((char *)Mac2HostAddr(ReadMacInt32(pb + ioNamePtr)), item->guest_name);
+    }
+
+    WriteMacInt16(pb + ioFRefNum, 0);
+    WriteMacInt8(pb + ioFlAttrib, item->open_count ? faOpen : 0);
+    WriteMacInt8(pb + ioFVersNum, 0);
+    put_file_info(pb, item, hfs);
+    return noErr;
+}
+
+static void set_item_mtime(FSItem *item, uint32 mtime)
+{
+    if (item->is_dir || mtime == item->mtime)
+        return;
+    get_path_for_fsitem(item);
+    struct utimbuf times;
+    times.actime = times.modtime = MacTimeToTime(mtime);
+    if (utime(full_path, &times) == 0)
+        item->mtime = mtime;
+}
+
+static int16 fs_set_file_info(uint32 pb, bool hfs, uint32 dirID)
+{
+    D(bug(" fs_set_file_info(%08lx), vRefNum %d, index %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt16(pb + ioFDirIndex), dirID));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, dirID, item);
+    if (result != noErr)
+        return result;
+    if (!item_stat(item) || item->is_dir)
+        return fnfErr;
+    set_item_finfo(item, pb + ioFlFndrInfo, hfs ? pb + ioFlXFndrInfo : 0);
+    set_item_mtime(item, ReadMacInt32(pb + ioFlMdDat));
+    return noErr;
+}
+
+static int16 fs_get_cat_info(uint32 pb)
+{
+    D(bug(" fs_get_cat_info(%08lx), vRefNum %d, index %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt16(pb + ioFDirIndex), ReadMacInt32(pb + ioDirID)));
+    FSItem *item;
+    int16 dir_index = ReadMacInt16(pb + ioFDirIndex);
+    uint32 dirID = ReadMacInt32(pb + ioDirID);
+    if (dir_index < 0) {            // The folder itself
+        int16 result = get_item_and_path(pb, dirID, item, true);
+        if (result != noErr)
+            return result;
+    } else if (dir_index == 0) {    // By name
+        int16 result = get_item_and_path(pb, dirID, item);
+        if (result != noErr)
+            return result;
+    } else {                        // n-th entry of the folder
+        uint32 current_dir;
+        int16 result = get_current_dir(pb, dirID, current_dir, true);
+        if (result != noErr)
+            return result;
+        FSItem *dir = find_item_by_id(current_dir);
+        if (dir == NULL)
+            return dirNFErr;
+        dir_listing *l = get_listing(dir);
+        if (l == NULL)
+            return dirNFErr;
+        if ((uint32)dir_index > l->count)
+            return fnfErr;
+        item = l->entries[dir_index - 1];
+    }
+    if (!item_stat(item))
+        return item->id == ROOT_ID ? offLinErr : fnfErr;
+
+    if (dir_index != 0 && ReadMacInt32(pb + ioNamePtr))
+        cstr2pstr((char *)Mac2HostAddr(ReadMacInt32(pb + ioNamePtr)), item->id == ROOT_ID ? volume_name : item->guest_name);
+    WriteMacInt16(pb + ioFRefNum, 0);
+    WriteMacInt8(pb + ioFlAttrib, item->is_dir ? faIsDir : (item->open_count ? faOpen : 0));
+    WriteMacInt8(pb + ioACUser, 0);
+    if (item->is_dir) {
+        WriteMacInt32(pb + ioDirID, item->id);
+        Host2Mac_memcpy(pb + ioDrUsrWds, item_finfo(item), 16);
+        WriteMacInt16(pb + ioDrNmFls, item_count(item));
+        WriteMacInt32(pb + ioDrCrDat, item->mtime);
+        WriteMacInt32(pb + ioDrMdDat, item->mtime);
+        WriteMacInt32(pb + ioDrBkDat, 0);
+        Host2Mac_memcpy(pb + ioDrFndrInfo, item->finfo + 16, 16);
+        WriteMacInt32(pb + ioDrParID, item->parent_id);
+    } else
+        put_file_info(pb, item, true);
+    return noErr;
+}
+
+static int16 fs_set_cat_info(uint32 pb)
+{
+    D(bug(" fs_set_cat_info(%08lx), vRefNum %d, index %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt16(pb + ioFDirIndex), ReadMacInt32(pb + ioDirID)));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, ReadMacInt32(pb + ioDirID), item);
+    if (result != noErr)
+        return result;
+    if (!item_stat(item))
+        return fnfErr;
+    set_item_finfo(item, pb + ioFlFndrInfo, pb + ioFlXFndrInfo);
+    set_item_mtime(item, ReadMacInt32(pb + ioFlMdDat));
+    return noErr;
+}
+
+
+/*
+ *  Forks
+ *
+ *  The host file descriptor of an open fork is kept in fcbCatPos, -1 for a
+ *  resource fork that has no sidecar file yet; the first write makes it.
+ *  fcbCrPs is the mark and fcbEOF the logical EOF.
+ */
+
+static int16 fs_open(uint32 pb, uint32 dirID, uint32 vcb, bool resource_fork)
+{
+    D(bug(" fs_open(%08lx), %s, vRefNum %d, dirID %d\n", pb, resource_fork ? "rsrc" : "data", ReadMacInt16(pb + ioVRefNum), dirID));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, dirID, item);
+    if (result != noErr)
+        return result;
+    if (!item_stat(item) || item->is_dir)
+        return fnfErr;
+
+    int flag;
+    bool locked = false;
+    switch (ReadMacInt8(pb + ioPermssn)) {
+        case fsCurPerm:
+            flag = O_RDWR;
+            break;
+        case fsRdPerm:
+            flag = O_RDONLY;
+            break;
+        case fsWrPerm:
+        case fsRdWrPerm:
+        case fsRdWrShPerm:
+            flag = O_RDWR;
+            break;
+        default:
+            return paramErr;
+    }
+
+    get_path_for_fsitem(item);
+    int fd = resource_fork ? open_rfork(full_path, flag) : open(full_path, flag);
+    if (fd < 0 && flag == O_RDWR && (errno == EACCES || errno == EROFS) && ReadMacInt8(pb + ioPermssn) == fsCurPerm) {
+        flag = O_RDONLY;
+        locked = true;
+        fd = resource_fork ? open_rfork(full_path, flag) : open(full_path, flag);
+    }
+    uint32 size = 0;
+    if (fd >= 0) {
+        struct stat st;
+        if (fstat(fd, &st) < 0) {
+            result = errno2oserr();
+            close(fd);
+            return result;
+        }
+        size = st.st_size;
+    } else if (!resource_fork || errno != ENOENT)
+        return errno2oserr();       // No sidecar: empty resource fork
+
+    // Allocate an FCB
+    uint32 ret = fs_data + fsReturn;
+    fsm_param p[] = {{ret, 4}, {ret + 2, 4}};
+    result = fsm_util(utAllocateFCB, p, 2);
+    if (result != noErr) {
+        if (fd >= 0)
+            close(fd);
+        return result;
+    }
+    int16 refNum = ReadMacInt16(ret);
+    uint32 fcb = ReadMacInt32(ret + 2);
+
+    WriteMacInt32(fcb + fcbFlNm, item->id);
+    WriteMacInt8(fcb + fcbFlags, (flag == O_RDWR ? fcbWriteMask : 0) | (resource_fork ? fcbResourceMask : 0) | (locked ? fcbFileLockedMask : 0));
+    WriteMacInt32(fcb + fcbEOF, size);
+    WriteMacInt32(fcb + fcbPLen, physical_size(size));
+    WriteMacInt32(fcb + fcbCrPs, 0);
+    WriteMacInt32(fcb + fcbVPtr, vcb);
+    WriteMacInt32(fcb + fcbClmpSize, CLUMP_SIZE);
+    Host2Mac_memcpy(fcb + fcbFType, item_finfo(item) + fdType, 4);
+    WriteMacInt32(fcb + fcbCatPos, fd);
+    track_fd(fd, true);
+    WriteMacInt32(fcb + fcbDirID, item->parent_id);
+    cstr2pstr((char *)Mac2HostAddr(fcb + fcbCName), item->guest_name);
+    item->open_count++;
+
+    WriteMacInt16(pb + ioRefNum, refNum);
+    return noErr;
+}
+
+static int16 fs_close(uint32 pb)
+{
+    int16 refNum = ReadMacInt16(pb + ioRefNum);
+    D(bug(" fs_close(%08lx), refNum %d\n", pb, refNum));
+    uint32 fcb;
+    int16 result = resolve_fcb(refNum, fcb);
+    if (result != noErr)
+        return result;
+
+    FSItem *item = find_item_by_id(ReadMacInt32(fcb + fcbFlNm));
+    int fd = ReadMacInt32(fcb + fcbCatPos);
+    track_fd(fd, false);
+    if (ReadMacInt8(fcb + fcbFlags) & fcbResourceMask) {
+        if (fd >= 0 && item) {
+            get_path_for_fsitem(item);
+            close_rfork(full_path, fd);
+            item->flags &= ~ITEM_RSIZE;
+        } else if (fd >= 0)
+            close(fd);
+    } else if (fd >= 0)
+        close(fd);
+    WriteMacInt32(fcb + fcbCatPos, (uint32)-1);
+    if (item && item->open_count)
+        item->open_count--;
+
+    fsm_param p[] = {{(uint16)refNum, 2}};
+    return fsm_util(utReleaseFCB, p, 1);
+}
+
+// Move the mark as ioPosMode and ioPosOffset say; past the logical EOF it
+// stops there and eofErr is returned
+static int16 seek_fork(uint32 pb, uint32 fcb, uint32 &pos)
+{
+    int64 mark = ReadMacInt32(fcb + fcbCrPs);
+    uint32 eof = ReadMacInt32(fcb + fcbEOF);
+    int32 offset = ReadMacInt32(pb + ioPosOffset);
+    switch (ReadMacInt16(pb + ioPosMode) & 3) {
+        case fsFromStart:
+            mark = offset;
+            break;
+        case fsFromLEOF:
+            mark = (int64)eof + offset;
+            break;
+        case fsFromMark:
+            mark += offset;
+            break;
+    }
+    if (mark < 0)
+        return posErr;
+    int16 result = noErr;
+    if (mark > eof) {
+        mark = eof;
+        result = eofErr;
+    }
+    pos = mark;
+    WriteMacInt32(fcb + fcbCrPs, pos);
+    return result;
+}
+
+// Host descriptor of a fork to write to, with a sidecar made for a resource fork
+static int16 writable_fork(uint32 fcb, int &fd)
+{
+    if (!(ReadMacInt8(fcb + fcbFlags) & fcbWriteMask))
+        return wrPermErr;
+    fd = ReadMacInt32(fcb + fcbCatPos);
+    if (fd >= 0)
+        return noErr;
+    FSItem *item = find_item_by_id(ReadMacInt32(fcb + fcbFlNm));
+    if (item == NULL)
+        return fnOpnErr;
+    get_path_for_fsitem(item);
+    fd = open_rfork(full_path, O_RDWR | O_CREAT);
+    if (fd < 0)
+        return errno2oserr();
+    WriteMacInt32(fcb + fcbCatPos, fd);
+    track_fd(fd, true);
+    return noErr;
+}
+
+// A fork of the item was written to
+static void fork_changed(uint32 fcb)
+{
+    WriteMacInt8(fcb + fcbFlags, ReadMacInt8(fcb + fcbFlags) | fcbModifiedMask);
+    FSItem *item = find_item_by_id(ReadMacInt32(fcb + fcbFlNm));
+    if (item)
+        item->flags &= ~(ITEM_STAT | ITEM_RSIZE);
+}
+
+static int16 fs_read(uint32 pb)
+{
+    D(bug(" fs_read(%08lx), refNum %d, buffer %p, count %d, posMode %d, posOffset %d\n", pb, ReadMacInt16(pb + ioRefNum), ReadMacInt32(pb + ioBuffer), ReadMacInt32(pb + ioReqCount), ReadMacInt16(pb + ioPosMode), ReadMacInt32(pb + ioPosOffset)));
+    WriteMacInt32(pb + ioActCount, 0);
+    uint32 fcb;
+    int16 result = resolve_fcb(ReadMacInt16(pb + ioRefNum), fcb);
+    if (result != noErr)
+        return result;
+    uint32 pos;
+    result = seek_fork(pb, fcb, pos);
+    if (result == posErr)
+        return result;
+
+    uint32 count = ReadMacInt32(pb + ioReqCount);
+    uint32 eof = ReadMacInt32(fcb + fcbEOF);
+    uint32 length = eof - pos < count ? eof - pos : count;
+    uint32 buffer = ReadMacInt32(pb + ioBuffer);
+    int fd = ReadMacInt32(fcb + fcbCatPos);
+    uint32 actual = 0;
+    result = noErr;
+    if (length && fd >= 0) {
+        // Straight into the Mac buffer
+        ssize_t n = -1;
+        if (lseek(fd, pos, SEEK_SET) >= 0)
+            n = extfs_read(fd, Mac2HostAddr(buffer), length);
+        if (n < 0)
+            result = errno2oserr();
+        else
+            actual = n;
+    }
+
+    // Newline mode: up to and including the newline character
+    uint16 mode = ReadMacInt16(pb + ioPosMode);
+    bool newline = false;
+    if ((mode & 0x80) && actual) {
+        const uint8 *p = Mac2HostAddr(buffer);
+        const uint8 *nl = (const uint8 *)memchr(p, mode >> 8, actual);
+        if (nl) {
+            actual = nl - p + 1;
+            newline = true;
+        }
+    }
+    if (actual) {
+        FlushCodeCache(Mac2HostAddr(buffer), actual);
+        perf_add(perf_read_bytes, actual);
+    }
+
+    pos += actual;
+    WriteMacInt32(fcb + fcbCrPs, pos);
+    WriteMacInt32(pb + ioPosOffset, pos);
+    WriteMacInt32(pb + ioActCount, actual);
+    if (result == noErr && actual < count && !newline)
+        result = eofErr;
+    return result;
+}
+
+static int16 fs_write(uint32 pb)
+{
+    D(bug(" fs_write(%08lx), refNum %d, buffer %p, count %d, posMode %d, posOffset %d\n", pb, ReadMacInt16(pb + ioRefNum), ReadMacInt32(pb + ioBuffer), ReadMacInt32(pb + ioReqCount), ReadMacInt16(pb + ioPosMode), ReadMacInt32(pb + ioPosOffset)));
+    WriteMacInt32(pb + ioActCount, 0);
+    int16 refNum = ReadMacInt16(pb + ioRefNum);
+    uint32 fcb;
+    int16 result = resolve_fcb(refNum, fcb);
+    if (result != noErr)
+        return result;
+    int fd;
+    if ((result = writable_fork(fcb, fd)) != noErr)
+        return result;
+    uint32 pos;
+    if ((result = seek_fork(pb, fcb, pos)) != noErr)
+        return result;
+
+    uint32 count = ReadMacInt32(pb + ioReqCount);
+    uint32 actual = 0;
+    if (count) {
+        ssize_t n = -1;
+        if (lseek(fd, pos, SEEK_SET) >= 0)
+            n = extfs_write(fd, Mac2HostAddr(ReadMacInt32(pb + ioBuffer)), count);
+        if (n > 0)
+            actual = n;
+        if ((uint32)n != count)
+            result = n < 0 ? errno2oserr() : dskFulErr;
+        perf_add(perf_write_bytes, actual);
+        fork_changed(fcb);
+    }
+
+    pos += actual;
+    WriteMacInt32(fcb + fcbCrPs, pos);
+    WriteMacInt32(pb + ioPosOffset, pos);
+    WriteMacInt32(pb + ioActCount, actual);
+    if (pos > ReadMacInt32(fcb + fcbEOF)) {
+        WriteMacInt32(fcb + fcbEOF, pos);
+        WriteMacInt32(fcb + fcbPLen, physical_size(pos));
+        adjust_eof(refNum);
+    }
+    return result;
+}
+
+static int16 fs_get_eof(uint32 pb)
+{
+    D(bug(" fs_get_eof(%08lx), refNum %d\n", pb, ReadMacInt16(pb + ioRefNum)));
+    uint32 fcb;
+    int16 result = resolve_fcb(ReadMacInt16(pb + ioRefNum), fcb);
+    if (result != noErr)
+        return result;
+    WriteMacInt32(pb + ioMisc, ReadMacInt32(fcb + fcbEOF));
+    return noErr;
+}
+
+static int16 fs_set_eof(uint32 pb)
+{
+    D(bug(" fs_set_eof(%08lx), refNum %d, size %d\n", pb, ReadMacInt16(pb + ioRefNum), ReadMacInt32(pb + ioMisc)));
+    int16 refNum = ReadMacInt16(pb + ioRefNum);
+    uint32 fcb;
+    int16 result = resolve_fcb(refNum, fcb);
+    if (result != noErr)
+        return result;
+    int fd;
+    if ((result = writable_fork(fcb, fd)) != noErr)
+        return result;
+    uint32 size = ReadMacInt32(pb + ioMisc);
+    if (ftruncate(fd, size) < 0)
+        return errno2oserr();
+    fork_changed(fcb);
+
+    WriteMacInt32(fcb + fcbEOF, size);
+    WriteMacInt32(fcb + fcbPLen, physical_size(size));
+    if (ReadMacInt32(fcb + fcbCrPs) > size)
+        WriteMacInt32(fcb + fcbCrPs, size);
+    return adjust_eof(refNum);
+}
+
+static int16 fs_get_fpos(uint32 pb)
+{
+    D(bug(" fs_get_fpos(%08lx), refNum %d\n", pb, ReadMacInt16(pb + ioRefNum)));
+    uint32 fcb;
+    int16 result = resolve_fcb(ReadMacInt16(pb + ioRefNum), fcb);
+    if (result != noErr)
+        return result;
+    WriteMacInt32(pb + ioReqCount, 0);
+    WriteMacInt32(pb + ioActCount, 0);
+    WriteMacInt16(pb + ioPosMode, 0);
+    WriteMacInt32(pb + ioPosOffset, ReadMacInt32(fcb + fcbCrPs));
+    return noErr;
+}
+
+static int16 fs_set_fpos(uint32 pb)
+{
+    D(bug(" fs_set_fpos(%08lx), refNum %d, posMode %d, offset %d\n", pb, ReadMacInt16(pb + ioRefNum), ReadMacInt16(pb + ioPosMode), ReadMacInt32(pb + ioPosOffset)));
+    uint32 fcb;
+    int16 result = resolve_fcb(ReadMacInt16(pb + ioRefNum), fcb);
+    if (result != noErr)
+        return result;
+    uint32 pos;
+    result = seek_fork(pb, fcb, pos);
+    if (result != posErr)
+        WriteMacInt32(pb + ioPosOffset, pos);
+    return result;
+}
+
+static int16 fs_flush_file(uint32 pb)
+{
+    uint32 fcb;
+    int16 result = resolve_fcb(ReadMacInt16(pb + ioRefNum), fcb);
+    if (result != noErr)
+        return result;
+    int fd = ReadMacInt32(fcb + fcbCatPos);
+    if (fd >= 0 && fsync(fd) < 0)
+        return errno2oserr();
+    return noErr;
+}
+
+static int16 fs_get_fcb_info(uint32 pb, uint32 vcb)
+{
+    D(bug(" fs_get_fcb_info(%08lx), vRefNum %d, refNum %d, idx %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt16(pb + ioRefNum), ReadMacInt16(pb + ioFCBIndx)));
+    uint32 ret = fs_data + fsReturn;
+    int16 index = ReadMacInt16(pb + ioFCBIndx);
+    uint32 fcb;
+    if (index > 0) {                // n-th open fork of the volume
+        WriteMacInt16(ret, 0);
+        for (int i = 0; i < index; i++) {
+            fsm_param p[] = {{vcb, 4}, {ret, 4}, {ret + 2, 4}};
+            if (fsm_util(utIndexFCB, p, 3) != noErr)
+                return fnOpnErr;
+        }
+        fcb = ReadMacInt32(ret + 2);
+        WriteMacInt16(pb + ioRefNum, ReadMacInt16(ret));
+    } else {
+        int16 result = resolve_fcb(ReadMacInt16(pb + ioRefNum), fcb);
+        if (result != noErr)
+            return result;
+    }
+
+    if (ReadMacInt32(pb + ioNamePtr))
+        Mac2Mac_memcpy(ReadMacInt32(pb + ioNamePtr), fcb + fcbCName, ReadMacInt8(fcb + fcbCName) + 1);
+    WriteMacInt32(pb + ioFCBFlNm, ReadMacInt32(fcb + fcbFlNm));
+    WriteMacInt8(pb + ioFCBFlags, ReadMacInt8(fcb + fcbFlags));
+    WriteMacInt16(pb + ioFCBStBlk, 0);
+    WriteMacInt32(pb + ioFCBEOF, ReadMacInt32(fcb + fcbEOF));
+    WriteMacInt32(pb + ioFCBPLen, ReadMacInt32(fcb + fcbPLen));
+    WriteMacInt32(pb + ioFCBCrPs, ReadMacInt32(fcb + fcbCrPs));
+    WriteMacInt16(pb + ioFCBVRefNum, ReadMacInt16(ReadMacInt32(fcb + fcbVPtr) + vcbVRefNum));
+    WriteMacInt32(pb + ioFCBClpSiz, ReadMacInt32(fcb + fcbClmpSize));
+    WriteMacInt32(pb + ioFCBParID, ReadMacInt32(fcb + fcbDirID));
+    return noErr;
+}
+
+
+/*
+ *  Creating, deleting, renaming and moving
+ */
+
+static int16 fs_create(uint32 pb, uint32 dirID)
+{
+    D(bug(" fs_create(%08lx), vRefNum %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), dirID));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, dirID, item);
+    if (result != noErr)
+        return result;
+    if (item->id == ROOT_ID)
+        return bdNamErr;
+    if (item_exists(item))
+        return dupFNErr;
+    get_path_for_fsitem(item);
+    int fd = open(full_path, O_WRONLY | O_CREAT | O_EXCL, 0666);
+    if (fd < 0)
+        return errno2oserr();
+    close(fd);
+    item->flags = ITEM_EXISTS;
+    drop_listing(item->parent);
+    return noErr;
+}
+
+static int16 fs_dir_create(uint32 pb)
+{
+    D(bug(" fs_dir_create(%08lx), vRefNum %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt32(pb + ioDirID)));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, ReadMacInt32(pb + ioDirID), item);
+    if (result != noErr)
+        return result;
+    if (item->id == ROOT_ID)
+        return bdNamErr;
+    if (item_exists(item))
+        return dupFNErr;
+    get_path_for_fsitem(item);
+    if (mkdir(full_path, 0777) < 0)
+        return errno2oserr();
+    item->flags = ITEM_EXISTS;
+    drop_listing(item->parent);
+    WriteMacInt32(pb + ioDirID, item->id);
+    return noErr;
+}
+
+static int16 fs_delete(uint32 pb, uint32 dirID)
+{
+    D(bug(" fs_delete(%08lx), vRefNum %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), dirID));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, dirID, item);
+    if (result != noErr)
+        return result;
+    if (item->id == ROOT_ID)
+        return fBsyErr;
+    if (!item_stat(item))
+        return fnfErr;
+    if (item->open_count)
+        return fBsyErr;
+    get_path_for_fsitem(item);
+    if (!extfs_remove(full_path))
+        return errno2oserr();
+    if (item->is_dir)
+        drop_listing(item);
+    item->flags = 0;
+    drop_listing(item->parent);
+    return noErr;
+}
+
+// Host path of a name in a folder
+static void child_path(FSItem *dir, const char *host_name, char *path)
+{
+    build_path(dir, path);
+    add_path_component(path, host_name);
+}
+
+static int16 fs_rename(uint32 pb, uint32 dirID)
+{
+    D(bug(" fs_rename(%08lx), vRefNum %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), dirID));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, dirID, item);
+    if (result != noErr)
+        return result;
+    if (item->id == ROOT_ID)
+        return bdNamErr;
+    if (!item_exists(item))
+        return fnfErr;
+
+    uint32 new_name = ReadMacInt32(pb + ioMisc);
+    if (new_name == 0 || ReadMacInt8(new_name) == 0 || ReadMacInt8(new_name) > 31)
+        return bdNamErr;
+    char guest[32];
+    pstr2cstr(guest, Mac2HostAddr(new_name), sizeof(guest));
+    if (strchr(guest, ':'))
+        return bdNamErr;
+    FSItem *other = find_child(item->parent, guest);
+    if (other && other != item) {
+        if (item_exists(other))
+            return dupFNErr;
+        unlink_name(other);         // Stale name, never on the card
+    }
+
+    char host[MAX_PATH_LENGTH], old_path[MAX_PATH_LENGTH], new_path[MAX_PATH_LENGTH];
+    strncpy(host, macroman_to_host_encoding(guest), sizeof(host) - 1);
+    host[sizeof(host) - 1] = 0;
+    if (strcmp(host, item->name) == 0)
+        return noErr;
+    build_path(item, old_path);
+    child_path(item->parent, host, new_path);
+    if (other == item) {
+        // Only the case changes; FAT would see the new name taken
+        char temp_path[MAX_PATH_LENGTH];
+        child_path(item->parent, ".extfs-rename", temp_path);
+        if (!extfs_rename(old_path, temp_path))
+            return errno2oserr();
+        strcpy(old_path, temp_path);
+    }
+    if (!extfs_rename(old_path, new_path))
+        return errno2oserr();
+
+    char *name = (char *)psram_malloc(strlen(host) + 1);
+    if (name == NULL)
+        return memFullErr;
+    strcpy(name, host);
+    free(item->name);
+    item->name = name;
+    unlink_name(item);
+    set_guest_name(item, guest);
+    link_name(item);
+    drop_listing(item->parent);
+    return noErr;
+}
+
+static int16 fs_cat_move(uint32 pb)
+{
+    D(bug(" fs_cat_move(%08lx), vRefNum %d, dirID %d, new dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt32(pb + ioDirID), ReadMacInt32(pb + ioNewDirID)));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, ReadMacInt32(pb + ioDirID), item);
+    if (result != noErr)
+        return result;
+    if (item->id == ROOT_ID)
+        return badMovErr;
+    if (!item_exists(item))
+        return fnfErr;
+
+    // Destination folder, named by ioNewName in ioNewDirID
+    uint32 dpb = fs_data + fsPB;
+    Mac2Mac_memcpy(dpb, pb, 108);
+    WriteMacInt32(dpb + ioNamePtr, ReadMacInt32(pb + ioNewName));
+    FSItem *dest;
+    result = get_item_and_path(dpb, ReadMacInt32(pb + ioNewDirID), dest);
+    if (result != noErr)
+        return result;
+    if (!item_stat(dest) || !dest->is_dir)
+        return dirNFErr;
+    for (FSItem *p = dest; p; p = p->parent)
+        if (p == item)
+            return badMovErr;
+    if (dest == item->parent)
+        return noErr;
+
+    FSItem *other = find_child(dest, item->guest_name);
+    if (other) {
+        if (item_exists(other))
+            return dupFNErr;
+        unlink_name(other);
+    }
+    char old_path[MAX_PATH_LENGTH], new_path[MAX_PATH_LENGTH];
+    build_path(item, old_path);
+    child_path(dest, item->name, new_path);
+    if (!extfs_rename(old_path, new_path))
+        return errno2oserr();
+
+    drop_listing(item->parent);
+    drop_listing(dest);
+    unlink_name(item);
+    item->parent = dest;
+    item->parent_id = dest->id;
+    link_name(item);
+    return noErr;
+}
+
+
+/*
+ *  Working directories and FSSpecs
+ */
+
+static int16 fs_open_wd(uint32 pb)
+{
+    D(bug(" fs_open_wd(%08lx), vRefNum %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt32(pb + ioWDDirID)));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, ReadMacInt32(pb + ioWDDirID), item);
+    if (result != noErr)
+        return result;
+    if (!item_stat(item) || !item->is_dir)
+        return dirNFErr;
+    WriteMacInt32(pb + ioWDDirID, item->id);
+    fsm_param p[] = {{pb, 4}};
+    return fsm_util(utAllocateWDCB, p, 1);
+}
+
+static int16 fs_close_wd(uint32 pb)
+{
+    D(bug(" fs_close_wd(%08lx), vRefNum %d\n", pb, ReadMacInt16(pb + ioVRefNum)));
+    fsm_param p[] = {{ReadMacInt16(pb + ioVRefNum), 2}};
+    return fsm_util(utReleaseWDCB, p, 1);
+}
+
+static int16 fs_get_wd_info(uint32 pb, uint32 vcb)
+{
+    D(bug(" fs_get_wd_info(%08lx), vRefNum %d, idx %d, procID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt16(pb + ioWDIndex), ReadMacInt32(pb + ioWDProcID)));
+    uint32 name_ptr = ReadMacInt32(pb + ioNamePtr);
+
+    // The volume itself
+    if (ReadMacInt16(pb + ioWDIndex) == 0 && ReadMacInt16(pb + ioVRefNum) == ReadMacInt16(vcb + vcbVRefNum)) {
+        WriteMacInt32(pb + ioWDProcID, 0);
+        WriteMacInt16(pb + ioWDVRefNum, ReadMacInt16(vcb + vcbVRefNum));
+        if (name_ptr)
+            Mac2Mac_memcpy(name_ptr, vcb + vcbVN, 28);
+        WriteMacInt32(pb + ioWDDirID, ROOT_ID);
+        return noErr;
+    }
+
+    uint32 ret = fs_data + fsReturn;
+    fsm_param p[] = {{ReadMacInt32(pb + ioWDProcID), 4}, {ReadMacInt16(pb + ioWDIndex), 2}, {ReadMacInt16(pb + ioVRefNum), 2}, {ret, 4}};
+    int16 result = fsm_util(utResolveWDCB, p, 4);
+    if (result != noErr)
+        return result;
+    uint32 wdcb = ReadMacInt32(ret);
+    uint32 wd_vcb = ReadMacInt32(wdcb + wdVCBPtr);
+    WriteMacInt32(pb + ioWDProcID, ReadMacInt32(wdcb + wdProcID));
+    WriteMacInt16(pb + ioWDVRefNum, ReadMacInt16(wd_vcb + vcbVRefNum));
+    if (name_ptr)
+        Mac2Mac_memcpy(name_ptr, wd_vcb + vcbVN, 28);
+    WriteMacInt32(pb + ioWDDirID, ReadMacInt32(wdcb + wdDirID));
+    return noErr;
+}
+
+static int16 fs_make_fsspec(uint32 pb, uint32 vcb)
+{
+    D(bug(" fs_make_fsspec(%08lx), vRefNum %d, dirID %d\n", pb, ReadMacInt16(pb + ioVRefNum), ReadMacInt32(pb + ioDirID)));
+    FSItem *item;
+    int16 result = get_item_and_path(pb, ReadMacInt32(pb + ioDirID), item);
+    if (result != noErr)
+        return result;
+    uint32 fss = ReadMacInt32(pb + ioMisc);
+    WriteMacInt16(fss + fsVRefNum, ReadMacInt16(vcb + vcbVRefNum));
+    WriteMacInt32(fss + fsParID, item->parent_id);
+    cstr2pstr((char *)Mac2HostAddr(fss + fsName), item->id == ROOT_ID ? volume_name : item->guest_name);
+    return item_exists(item) ? noErr : fnfErr;
+}
+
+
+/*
+ *  Initialization
+ */
+
+void ExtFSInit(void)
+{
+    const char *pref = PrefsFindString("extfs");
+    if (pref == NULL || *pref == 0)
+        return;
+    const char *path = extfs_host_root(pref);
+    if (path == NULL || strlen(path) >= sizeof(root_path) - 64)
+        return;
+    strcpy(root_path, path);
+    struct stat st;
+    if (stat(root_path, &st) < 0 || !S_ISDIR(st.st_mode)) {
+        Serial.printf("[EXTFS] %s is not a folder, no shared volume\n", root_path);
+        return;
+    }
+    extfs_init();
+
+    // Volume named after the folder
+    const char *name = strrchr(root_path, '/');
+    name = name && name[1] ? name + 1 : GetString(STR_EXTFS_VOLUME_NAME);
+    strncpy(volume_name, host_encoding_to_macroman(name), sizeof(volume_name) - 1);
+    volume_name[sizeof(volume_name) - 1] = 0;
+
+    root_parent = new_item(NULL, ROOT_PARENT_ID, "", "");
+    root = root_parent ? new_item(root_parent, ROOT_ID, "", volume_name) : NULL;
+    if (root == NULL)
+        return;
+    set_item_stat(root, st);
+    ready = true;
+    Serial.printf("[EXTFS] Sharing %s as \"%s\"\n", root_path, volume_name);
+}
+
+void ExtFSExit(void)
+{
+    if (!ready)
+        return;
+    drop_listings();
+    free_items();
+    extfs_exit();
+    ready = false;
+}
+
+// 32x32 ICN# of an SD card
+static void make_icon(uint32 icon)
+{
+    uint8 *data = Mac2HostAddr(icon);
+    uint8 *mask = data + 128;
+    memset(data, 0, 256);
+    for (int y = 0; y < 32; y++) {
+        for (int x = 0; x < 32; x++) {
+            bool inside = x >= 6 && x <= 25 && y >= 3 && y <= 28 && x - y <= 17;
+            if (!inside)
+                continue;
+            bool edge = x == 6 || x == 25 || y == 3 || y == 28 || x - y == 17;
+            bool contact = y >= 6 && y <= 10 && x >= 9 && x <= 20 && (x - 9) % 3 < 2;
+            uint8 bit = 0x80 >> (x & 7);
+            mask[y * 4 + x / 8] |= bit;
+            if (edge || contact)
+                data[y * 4 + x / 8] |= bit;
+        }
+    }
+}
+
+void InstallExtFS(void)
+{
+    if (!ready)
+        return;
+    M68kRegisters r;
+
+    // After a Mac reset: the FCBs and the VCB of the last boot are gone
+    for (int fd = 0; fd < 64; fd++)
+        if (open_fds & (1ULL << fd))
+            close(fd);
+    open_fds = 0;
+    for (int i = 0; i < ITEM_HASH_SIZE; i++)
+        for (FSItem *item = id_hash[i]; item; item = item->next_id)
+            item->open_count = 0;
+    mounted_vcb = 0;
+
+    // File System Manager 1.2 or later
+    r.d[0] = gestaltFSAttr;
+    Execute68kTrap(0xa1ad, &r);     // Gestalt()
+    if ((r.d[0] & 0xffff) || !(r.a[0] & (1 << gestaltHasFileSystemManager))) {
+        Serial.println("[EXTFS] No File System Manager, no shared volume");
+        return;
+    }
+    r.d[0] = gestaltFSMVersion;
+    Execute68kTrap(0xa1ad, &r);     // Gestalt()
+    if ((r.d[0] & 0xffff) || r.a[0] < 0x0120) {
+        Serial.println("[EXTFS] File System Manager older than 1.2, no shared volume");
+        return;
+    }
+
+    // Our data and the HFS component's stack
+    r.d[0] = SIZEOF_fsdat + FS_STACK_SIZE;
+    Execute68kTrap(0xa71e, &r);     // NewPtrSysClear()
+    if (r.a[0] == 0)
+        return;
+    fs_data = r.a[0];
+
+    WriteMacInt16(fs_data + fsCommStub, M68K_EMUL_OP_EXTFS_COMM);
+    WriteMacInt16(fs_data + fsCommStub + 2, M68K_RTD);
+    WriteMacInt16(fs_data + fsCommStub + 4, 10);
+    WriteMacInt16(fs_data + fsHFSStub, M68K_EMUL_OP_EXTFS_HFS);
+    WriteMacInt16(fs_data + fsHFSStub + 2, M68K_RTD);
+    WriteMacInt16(fs_data + fsHFSStub + 4, 16);
+    uint32 p = fs_data + fsUtilStub;
+    WriteMacInt16(p, 0x4267);       // clr.w    -(sp)
+    WriteMacInt16(p + 2, 0x3f20);   // move.w   -(a0),-(sp)
+    WriteMacInt32(p + 4, 0x51c9fffc);   // dbra d1,*-2
+    WriteMacInt16(p + 8, 0xa824);   // _HFSUtilities
+    WriteMacInt16(p + 10, 0x301f);  // move.w   (sp)+,d0
+    WriteMacInt16(p + 12, M68K_RTS);
+    make_icon(fs_data + fsIcon);
+
+    // File system descriptor, enabled before it is installed
+    uint32 fsd = fs_data + fsFSD;
+    WriteMacInt16(fsd + fsdLength, SIZEOF_FSDRec);
+    WriteMacInt16(fsd + fsdVersion, fsdVersion1);
+    WriteMacInt16(fsd + fileSystemFSID, MY_FSID);
+    cstr2pstr((char *)Mac2HostAddr(fsd + fileSystemName), GetString(STR_EXTFS_NAME));
+    WriteMacInt32(fsd + fileSystemCommProc, fs_data + fsCommStub);
+    WriteMacInt32(fsd + fsdHFSCI + compInterfMask, fsmComponentEnableMask | hfsCIResourceLoadedMask | hfsCIDoesHFSMask);
+    WriteMacInt32(fsd + fsdHFSCI + compInterfProc, fs_data + fsHFSStub);
+    WriteMacInt32(fsd + fsdHFSCI + stackTop, fs_data + SIZEOF_fsdat + FS_STACK_SIZE);
+    WriteMacInt32(fsd + fsdHFSCI + stackSize, FS_STACK_SIZE);
+    WriteMacInt32(fsd + fsdHFSCI + idSector, (uint32)-1);
+    r.a[0] = fsd;
+    r.d[0] = 0;                     // InstallFS
+    Execute68kTrap(0xa0ac, &r);     // FSMDispatch()
+    if (r.d[0] & 0xffff) {
+        Serial.printf("[EXTFS] InstallFS() returned %d\n", (int16)r.d[0]);
+        return;
+    }
+
+    // Our drive
+    uint32 total_blocks = 0, free_blocks;
+    volume_blocks(total_blocks, free_blocks);
+    uint32 sectors = (uint64)total_blocks * al_block_size / 512;
+    drive_number = FindFreeDriveNumber(1);
+    uint32 ds = fs_data + fsDrvStatus;
+    WriteMacInt8(ds + dsDiskInPlace, 8);    // Fixed disk
+    WriteMacInt8(ds + dsInstalled, 1);
+    WriteMacInt16(ds + dsQType, hard20);
+    WriteMacInt16(ds + dsDriveSize, sectors & 0xffff);
+    WriteMacInt16(ds + dsDriveS1, sectors >> 16);
+    WriteMacInt16(ds + dsQFSID, MY_FSID);
+    r.d[0] = (drive_number << 16) | (DiskRefNum & 0xffff);
+    r.a[0] = ds + dsQLink;
+    Execute68kTrap(0xa04e, &r);     // AddDrive()
+
+    // Mount the volume
+    uint32 pb = fs_data + fsPB;
+    WriteMacInt16(pb + ioVRefNum, drive_number);
+    r.a[0] = pb;
+    Execute68kTrap(0xa00f, &r);     // MountVol()
+    D(bug("MountVol() returned %d\n", (int16)r.d[0]));
+}
+
+
+/*
+ *  FS communications routine
+ */
+
+int16 ExtFSComm(uint16 message, uint32 paramBlock, uint32 globalsPtr)
+{
+    D(bug("ExtFSComm(%d, %08lx, %08lx)\n", message, paramBlock, globalsPtr));
+    switch (message) {
+        case ffsNopMessage:
+        case ffsLoadMessage:
+        case ffsUnloadMessage:
+            return noErr;
+
+        case ffsGetIconMessage:     // Volume icon
+            if (ReadMacInt8(paramBlock + iconType) == kLargeIcon && ReadMacInt32(paramBlock + requestSize) >= 256) {
+                Mac2Mac_memcpy(ReadMacInt32(paramBlock + iconBufferPtr), fs_data + fsIcon, 256);
+                WriteMacInt32(paramBlock + actualSize, 256);
+                return noErr;
+            }
+            return afpItemNotFound;
+
+        case ffsIDDiskMessage:      // Is the drive ours?
+            return (int16)ReadMacInt16(paramBlock + ioVRefNum) == drive_number ? noErr : extFSErr;
+
+        case ffsIDVolMountMessage:
+            return extFSErr;
+
+        default:
+            return fsmUnknownFSMMessageErr;
+    }
+}
+
+
+/*
+ *  FS HFS component routine
+ */
+
+int16 ExtFSHFS(uint32 vcb, uint16 selectCode, uint32 paramBlock, uint32 globalsPtr, int16 fsid)
+{
+    D(bug("ExtFSHFS(%08lx, %04x, %08lx, %08lx, %d)\n", vcb, selectCode, paramBlock, globalsPtr, fsid));
+    perf_inc(perf_calls);
+    uint16 trap = selectCode & 0xf0ff;
+    bool hfs = selectCode & kHFSMask;
+    uint32 dirID = hfs ? ReadMacInt32(paramBlock + ioDirID) : 0;
+    switch (trap) {
+        case kFSMOpen:
+            return fs_open(paramBlock, dirID, vcb, false);
+        case kFSMClose:
+            return fs_close(paramBlock);
+        case kFSMRead:
+            return fs_read(paramBlock);
+        case kFSMWrite:
+            return fs_write(paramBlock);
+        case kFSMGetVolInfo:
+            return fs_get_vol_info(paramBlock, hfs, vcb);
+        case kFSMCreate:
+            return fs_create(paramBlock, dirID);
+        case kFSMDelete:
+            return fs_delete(paramBlock, dirID);
+        case kFSMOpenRF:
+            return fs_open(paramBlock, dirID, vcb, true);
+        case kFSMRename:
+            return fs_rename(paramBlock, dirID);
+        case kFSMGetFileInfo:
+            return fs_get_file_info(paramBlock, hfs, dirID);
+        case kFSMSetFileInfo:
+            return fs_set_file_info(paramBlock, hfs, dirID);
+        case kFSMUnmountVol:
+            return fs_unmount_vol(vcb);
+        case kFSMMountVol:
+            return fs_mount_vol(paramBlock);
+        case kFSMAllocate:
+            WriteMacInt32(paramBlock + ioActCount, ReadMacInt32(paramBlock + ioReqCount));
+            return noErr;
+        case kFSMGetEOF:
+            return fs_get_eof(paramBlock);
+        case kFSMSetEOF:
+            return fs_set_eof(paramBlock);
+        case kFSMGetVol:
+            return fs_get_vol(paramBlock);
+        case kFSMSetVol:
+            return fs_set_vol(paramBlock, hfs, vcb);
+        case kFSMGetFPos:
+            return fs_get_fpos(paramBlock);
+        case kFSMSetFPos:
+            return fs_set_fpos(paramBlock);
+        case kFSMFlushFile:
+            return fs_flush_file(paramBlock);
+        case kFSMFlushVol:
+        case kFSMEject:
+        case kFSMOffline:
+        case kFSMSetFilLock:
+        case kFSMRstFilLock:
+        case kFSMSetVolInfo:
+            return noErr;
+        case kFSMOpenWD:
+            return fs_open_wd(paramBlock);
+        case kFSMCloseWD:
+            return fs_close_wd(paramBlock);
+        case kFSMCatMove:
+            return fs_cat_move(paramBlock);
+        case kFSMDirCreate:
+            return fs_dir_create(paramBlock);
+        case kFSMGetWDInfo:
+            return fs_get_wd_info(paramBlock, vcb);
+        case kFSMGetFCBInfo:
+            return fs_get_fcb_info(paramBlock, vcb);
+        case kFSMGetCatInfo:
+            return fs_get_cat_info(paramBlock);
+        case kFSMSetCatInfo:
+            return fs_set_cat_info(paramBlock);
+        case kFSMGetVolParms:
+            return fs_get_vol_parms(paramBlock);
+        case kFSMOpenDF:
+            return fs_open(paramBlock, ReadMacInt32(paramBlock + ioDirID), vcb, false);
+        case kFSMMakeFSSpec:
+            return fs_make_fsspec(paramBlock, vcb);
+        default:
+            D(bug("ExtFSHFS: unimplemented selector %04x\n", selectCode));
+            return paramErr;
+    }
+}
+
+#endif // SUPPORTS_EXTFS
@@ -0,0 +1,505 @@
+/*
+ *  extfs_esp32.cpp - Shared folder on the SD card, host side
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Host functions of extfs.cpp over the card's FAT file system (/sd).
+ *
+ *  FAT has no resource forks or Finder info, so they are kept in sidecar
+ *  files in hidden folders next to the file: dir/.rsrc/name holds the
+ *  resource fork and dir/.finf/name the 32 bytes of FInfo and FXInfo (DInfo
+ *  and DXInfo for a folder), the layout the Unix versions of Basilisk II
+ *  use. The shared folder's own info is .finf/.volume in it. A file with no
+ *  .finf gets its type and creator from its extension.
+ *
+ *  Mac names are stored with the characters FAT or the Mac cannot have in a
+ *  name written as %XX, and MacRoman letters as %XX too, so any Mac name
+ *  survives the round trip. Names coming from elsewhere in UTF-8 are shown
+ *  in MacRoman where it has the letter.
+ *
+ *  Reads and writes of 4KB and more start with a piece that brings the file
+ *  position to a sector boundary, so FatFs moves the rest as whole sectors
+ *  by DMA; straight to the Mac buffer when it is 64-byte aligned, else
+ *  through an aligned PSRAM bounce buffer (as sys_esp32.cpp does for disk
+ *  images).
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "extfs.h"
+#include "extfs_defs.h"
+#include "sdcard.h"
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <esp_heap_caps.h>
+#include <esp_vfs_fat.h>
+
+#if SUPPORTS_EXTFS
+
+#define DEBUG 0
+#include "debug.h"
+
+#define DMA_ALIGN       64
+#define SECTOR_SIZE     512
+#define BOUNCE_SIZE     0x8000
+#define DIRECT_MIN      4096        // Smaller transfers are plain read()/write() calls
+
+static char root[MAX_PATH_LENGTH];
+static uint8 *bounce = NULL;
+
+
+/*
+ *  Setup
+ */
+
+const char *extfs_host_root(const char *pref)
+{
+    // "/Shared" or "Shared" is /sd/Shared; a path on /sd is taken as it is
+    if (strncmp(pref, SD_MOUNT_POINT "/", strlen(SD_MOUNT_POINT) + 1) == 0)
+        snprintf(root, sizeof(root), "%s", pref);
+    else
+        snprintf(root, sizeof(root), "%s%s%s", SD_MOUNT_POINT, pref[0] == '/' ? "" : "/", pref);
+    size_t n = strlen(root);
+    while (n > 1 && root[n - 1] == '/')
+        root[--n] = 0;
+    return root;
+}
+
+void extfs_init(void)
+{
+    if (bounce == NULL)
+        bounce = (uint8 *)heap_caps_aligned_alloc(DMA_ALIGN, BOUNCE_SIZE, MALLOC_CAP_SPIRAM);
+}
+
+void extfs_exit(void)
+{
+    if (bounce) {
+        heap_caps_free(bounce);
+        bounce = NULL;
+    }
+}
+
+void extfs_volume_size(uint64 &total_bytes, uint64 &free_bytes)
+{
+    uint64_t total, free;
+    if (esp_vfs_fat_info(SD_MOUNT_POINT, &total, &free) != ESP_OK)
+        total = free = 0;
+    total_bytes = total;
+    free_bytes = free;
+}
+
+void add_path_component(char *path, const char *component)
+{
+    size_t n = strlen(path);
+    if (n + 1 + strlen(component) >= MAX_PATH_LENGTH)
+        return;
+    if (n == 0 || path[n - 1] != '/')
+        path[n++] = '/';
+    strcpy(path + n, component);
+}
+
+
+/*
+ *  Sidecar files
+ */
+
+// Path of the sidecar of a file in the hidden folder "sub" next to it
+static void sidecar_path(const char *path, const char *sub, char *out)
+{
+    if (strcmp(path, root) == 0) {
+        snprintf(out, MAX_PATH_LENGTH, "%s/%s/.volume", root, sub);
+        return;
+    }
+    const char *name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+    snprintf(out, MAX_PATH_LENGTH, "%.*s%s/%s", (int)(name - path), path, sub, name);
+}
+
+// Hidden folder for a sidecar path
+static void make_sidecar_dir(const char *sidecar)
+{
+    char dir[MAX_PATH_LENGTH];
+    strcpy(dir, sidecar);
+    char *slash = strrchr(dir, '/');
+    if (slash) {
+        *slash = 0;
+        mkdir(dir, 0777);
+    }
+}
+
+struct ext_type {
+    const char *ext;
+    uint32 type;
+    uint32 creator;
+};
+
+static const ext_type ext_types[] = {
+    {".txt",  FOURCC('T','E','X','T'), FOURCC('t','t','x','t')},
+    {".text", FOURCC('T','E','X','T'), FOURCC('t','t','x','t')},
+    {".c",    FOURCC('T','E','X','T'), FOURCC('t','t','x','t')},
+    {".h",    FOURCC('T','E','X','T'), FOURCC('t','t','x','t')},
+    {".htm",  FOURCC('T','E','X','T'), FOURCC('M','O','S','S')},
+    {".html", FOURCC('T','E','X','T'), FOURCC('M','O','S','S')},
+    {".sit",  FOURCC('S','I','T','!'), FOURCC('S','I','T','x')},
+    {".sea",  FOURCC('A','P','P','L'), FOURCC('a','e','v','t')},
+    {".hqx",  FOURCC('T','E','X','T'), FOURCC('S','I','T','x')},
+    {".bin",  FOURCC('S','I','T','!'), FOURCC('S','I','T','x')},
+    {".cpt",  FOURCC('P','A','C','T'), FOURCC('C','P','C','T')},
+    {".zip",  FOURCC('Z','I','P',' '), FOURCC('S','I','T','x')},
+    {".gz",   FOURCC('G','z','i','p'), FOURCC('S','I','T','x')},
+    {".dsk",  FOURCC('d','I','m','g'), FOURCC('d','C','p','y')},
+    {".img",  FOURCC('d','I','m','g'), FOURCC('d','C','p','y')},
+    {".image",FOURCC('d','I','m','g'), FOURCC('d','C','p','y')},
+    {".gif",  FOURCC('G','I','F','f'), FOURCC('o','g','l','e')},
+    {".jpg",  FOURCC('J','P','E','G'), FOURCC('o','g','l','e')},
+    {".jpeg", FOURCC('J','P','E','G'), FOURCC('o','g','l','e')},
+    {".png",  FOURCC('P','N','G','f'), FOURCC('o','g','l','e')},
+    {".bmp",  FOURCC('B','M','P','f'), FOURCC('o','g','l','e')},
+    {".pict", FOURCC('P','I','C','T'), FOURCC('t','t','x','t')},
+    {".pdf",  FOURCC('P','D','F',' '), FOURCC('C','A','R','O')},
+    {".ps",   FOURCC('T','E','X','T'), FOURCC('v','g','r','d')},
+    {".aif",  FOURCC('A','I','F','F'), FOURCC('T','V','O','D')},
+    {".aiff", FOURCC('A','I','F','F'), FOURCC('T','V','O','D')},
+    {".wav",  FOURCC('W','A','V','E'), FOURCC('T','V','O','D')},
+    {".mov",  FOURCC('M','o','o','V'), FOURCC('T','V','O','D')},
+    {".mid",  FOURCC('M','i','d','i'), FOURCC('T','V','O','D')},
+    {NULL, 0, 0}
+};
+
+void get_finfo(const char *path, uint32 finfo, uint32 fxinfo, bool is_dir)
+{
+    Mac_memset(finfo, 0, SIZEOF_FInfo);
+    if (fxinfo)
+        Mac_memset(fxinfo, 0, SIZEOF_FXInfo);
+
+    char sidecar[MAX_PATH_LENGTH];
+    sidecar_path(path, ".finf", sidecar);
+    int fd = open(sidecar, O_RDONLY);
+    if (fd >= 0) {
+        uint8 info[SIZEOF_FInfo + SIZEOF_FXInfo];
+        ssize_t n = read(fd, info, sizeof(info));
+        close(fd);
+        if (n >= SIZEOF_FInfo) {
+            Host2Mac_memcpy(finfo, info, SIZEOF_FInfo);
+            if (fxinfo && n == (ssize_t)sizeof(info))
+                Host2Mac_memcpy(fxinfo, info + SIZEOF_FInfo, SIZEOF_FXInfo);
+            return;
+        }
+    }
+
+    // No Finder info yet: type and creator from the extension
+    if (is_dir)
+        return;
+    const char *ext = strrchr(path, '.');
+    if (ext == NULL || strchr(ext, '/'))
+        return;
+    for (const ext_type *e = ext_types; e->ext; e++) {
+        if (strcasecmp(ext, e->ext) == 0) {
+            WriteMacInt32(finfo + fdType, e->type);
+            WriteMacInt32(finfo + fdCreator, e->creator);
+            return;
+        }
+    }
+}
+
+void set_finfo(const char *path, uint32 finfo, uint32 fxinfo, bool is_dir)
+{
+    char sidecar[MAX_PATH_LENGTH];
+    sidecar_path(path, ".finf", sidecar);
+    int fd = open(sidecar, O_RDWR | O_CREAT, 0666);
+    if (fd < 0 && errno == ENOENT) {
+        make_sidecar_dir(sidecar);
+        fd = open(sidecar, O_RDWR | O_CREAT, 0666);
+    }
+    if (fd < 0)
+        return;
+    write(fd, Mac2HostAddr(finfo), SIZEOF_FInfo);
+    if (fxinfo)
+        write(fd, Mac2HostAddr(fxinfo), SIZEOF_FXInfo);
+    close(fd);
+}
+
+uint32 get_rfork_size(const char *path)
+{
+    char sidecar[MAX_PATH_LENGTH];
+    sidecar_path(path, ".rsrc", sidecar);
+    struct stat st;
+    return stat(sidecar, &st) == 0 ? st.st_size : 0;
+}
+
+int open_rfork(const char *path, int flag)
+{
+    char sidecar[MAX_PATH_LENGTH];
+    sidecar_path(path, ".rsrc", sidecar);
+    int fd = open(sidecar, flag, 0666);
+    if (fd < 0 && errno == ENOENT && (flag & O_CREAT)) {
+        make_sidecar_dir(sidecar);
+        fd = open(sidecar, flag, 0666);
+    }
+    return fd;
+}
+
+void close_rfork(const char *path, int fd)
+{
+    struct stat st;
+    bool empty = fstat(fd, &st) == 0 && st.st_size == 0;
+    close(fd);
+
+    // No sidecar for an empty resource fork
+    if (empty) {
+        char sidecar[MAX_PATH_LENGTH];
+        sidecar_path(path, ".rsrc", sidecar);
+        unlink(sidecar);
+    }
+}
+
+
+/*
+ *  Data transfers
+ */
+
+ssize_t extfs_read(int fd, void *buffer, size_t length)
+{
+    if (length < DIRECT_MIN || bounce == NULL)
+        return read(fd, buffer, length);
+
+    uint8 *p = (uint8 *)buffer;
+    size_t done = 0;
+    off_t pos = lseek(fd, 0, SEEK_CUR);
+    size_t head = pos < 0 ? 0 : (SECTOR_SIZE - (pos & (SECTOR_SIZE - 1))) & (SECTOR_SIZE - 1);
+    while (done < length) {
+        size_t n = length - done;
+        ssize_t actual;
+        if (head) {
+            n = head;
+            head = 0;
+            actual = read(fd, p, n);
+        } else if (((uintptr_t)(p + done) & (DMA_ALIGN - 1)) == 0)
+            actual = read(fd, p + done, n);
+        else {
+            if (n > BOUNCE_SIZE)
+                n = BOUNCE_SIZE;
+            actual = read(fd, bounce, n);
+            if (actual > 0)
+                memcpy(p + done, bounce, actual);
+        }
+        if (actual < 0)
+            return done ? (ssize_t)done : -1;
+        done += actual;
+        if ((size_t)actual < n)
+            break;
+    }
+    return done;
+}
+
+ssize_t extfs_write(int fd, void *buffer, size_t length)
+{
+    if (length < DIRECT_MIN || bounce == NULL)
+        return write(fd, buffer, length);
+
+    const uint8 *p = (const uint8 *)buffer;
+    size_t done = 0;
+    off_t pos = lseek(fd, 0, SEEK_CUR);
+    size_t head = pos < 0 ? 0 : (SECTOR_SIZE - (pos & (SECTOR_SIZE - 1))) & (SECTOR_SIZE - 1);
+    while (done < length) {
+        size_t n = length - done;
+        ssize_t actual;
+        if (head) {
+            n = head;
+            head = 0;
+            actual = write(fd, p, n);
+        } else if (((uintptr_t)(p + done) & (DMA_ALIGN - 1)) == 0)
+            actual = write(fd, p + done, n);
+        else {
+            if (n > BOUNCE_SIZE)
+                n = BOUNCE_SIZE;
+            memcpy(bounce, p + done, n);
+            actual = write(fd, bounce, n);
+        }
+        if (actual < 0)
+            return done ? (ssize_t)done : -1;
+        done += actual;
+        if ((size_t)actual < n)
+            break;
+    }
+    return done;
+}
+
+
+/*
+ *  Deleting and renaming, with the sidecars
+ */
+
+static void remove_sidecars(const char *path)
+{
+    char sidecar[MAX_PATH_LENGTH];
+    sidecar_path(path, ".finf", sidecar);
+    unlink(sidecar);
+    sidecar_path(path, ".rsrc", sidecar);
+    unlink(sidecar);
+}
+
+// A folder holding nothing but empty sidecar folders
+static bool folder_empty(const char *path)
+{
+    DIR *d = opendir(path);
+    if (d == NULL)
+        return false;
+    bool empty = true;
+    struct dirent *de;
+    while (empty && (de = readdir(d)) != NULL) {
+        if (strcmp(de->d_name, ".") == 0 || strcmp(de->d_name, "..") == 0)
+            continue;
+        if (strcmp(de->d_name, ".finf") == 0 || strcmp(de->d_name, ".rsrc") == 0) {
+            char sub[MAX_PATH_LENGTH];
+            snprintf(sub, sizeof(sub), "%s/%s", path, de->d_name);
+            DIR *s = opendir(sub);
+            if (s) {
+                while ((de = readdir(s)) != NULL)
+                    if (strcmp(de->d_name, ".") && strcmp(de->d_name, "..")) {
+                        empty = false;
+                        break;
+                    }
+                closedir(s);
+            }
+            continue;
+        }
+        empty = false;
+    }
+    closedir(d);
+    return empty;
+}
+
+bool extfs_remove(const char *path)
+{
+    struct stat st;
+    if (stat(path, &st) < 0)
+        return false;
+    if (S_ISDIR(st.st_mode)) {
+        // FAT says "denied" for a full folder; the Mac wants fBsyErr
+        if (!folder_empty(path)) {
+            errno = ENOTEMPTY;
+            return false;
+        }
+        char sub[MAX_PATH_LENGTH];
+        snprintf(sub, sizeof(sub), "%s/.finf", path);
+        rmdir(sub);
+        snprintf(sub, sizeof(sub), "%s/.rsrc", path);
+        rmdir(sub);
+        if (rmdir(path) < 0)
+            return false;
+    } else if (unlink(path) < 0)
+        return false;
+    remove_sidecars(path);
+    return true;
+}
+
+bool extfs_rename(const char *old_path, const char *new_path)
+{
+    if (rename(old_path, new_path) < 0)
+        return false;
+    static const char *const subs[] = {".finf", ".rsrc"};
+    for (int i = 0; i < 2; i++) {
+        char old_sidecar[MAX_PATH_LENGTH], new_sidecar[MAX_PATH_LENGTH];
+        sidecar_path(old_path, subs[i], old_sidecar);
+        struct stat st;
+        if (stat(old_sidecar, &st) < 0)
+            continue;
+        sidecar_path(new_path, subs[i], new_sidecar);
+        make_sidecar_dir(new_sidecar);
+        rename(old_sidecar, new_sidecar);
+    }
+    return true;
+}
+
+
+/*
+ *  Names
+ */
+
+// Unicode of MacRoman 0x80..0xff
+static const uint16 macroman_unicode[128] = {
+    0x00c4, 0x00c5, 0x00c7, 0x00c9, 0x00d1, 0x00d6, 0x00dc, 0x00e1, 0x00e0, 0x00e2, 0x00e4, 0x00e3, 0x00e5, 0x00e7, 0x00e9, 0x00e8,
+    0x00ea, 0x00eb, 0x00ed, 0x00ec, 0x00ee, 0x00ef, 0x00f1, 0x00f3, 0x00f2, 0x00f4, 0x00f6, 0x00f5, 0x00fa, 0x00f9, 0x00fb, 0x00fc,
+    0x2020, 0x00b0, 0x00a2, 0x00a3, 0x00a7, 0x2022, 0x00b6, 0x00df, 0x00ae, 0x00a9, 0x2122, 0x00b4, 0x00a8, 0x2260, 0x00c6, 0x00d8,
+    0x221e, 0x00b1, 0x2264, 0x2265, 0x00a5, 0x00b5, 0x2202, 0x2211, 0x220f, 0x03c0, 0x222b, 0x00aa, 0x00ba, 0x03a9, 0x00e6, 0x00f8,
+    0x00bf, 0x00a1, 0x00ac, 0x221a, 0x0192, 0x2248, 0x2206, 0x00ab, 0x00bb, 0x2026, 0x00a0, 0x00c0, 0x00c3, 0x00d5, 0x0152, 0x0153,
+    0x2013, 0x2014, 0x201c, 0x201d, 0x2018, 0x2019, 0x00f7, 0x25ca, 0x00ff, 0x0178, 0x2044, 0x20ac, 0x2039, 0x203a, 0xfb01, 0xfb02,
+    0x2021, 0x00b7, 0x201a, 0x201e, 0x2030, 0x00c2, 0x00ca, 0x00c1, 0x00cb, 0x00c8, 0x00cd, 0x00ce, 0x00cf, 0x00cc, 0x00d3, 0x00d4,
+    0xf8ff, 0x00d2, 0x00da, 0x00db, 0x00d9, 0x0131, 0x02c6, 0x02dc, 0x00af, 0x02d8, 0x02d9, 0x02da, 0x00b8, 0x02dd, 0x02db, 0x02c7
+};
+
+static int hex_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+const char *host_encoding_to_macroman(const char *filename)
+{
+    static char name[32];
+    const uint8 *p = (const uint8 *)filename;
+    int n = 0;
+    while (*p && n < 31) {
+        uint32 c = *p++;
+        if (c == '%' && hex_digit(p[0]) >= 0 && hex_digit(p[1]) >= 0) {
+            name[n++] = hex_digit(p[0]) << 4 | hex_digit(p[1]);
+            p += 2;
+            continue;
+        }
+        if (c < 0x80) {
+            name[n++] = c;
+            continue;
+        }
+
+        // UTF-8
+        int extra = c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : c >= 0xc0 ? 1 : 0;
+        c &= 0x3f >> extra;
+        for (int i = 0; i < extra && (*p & 0xc0) == 0x80; i++)
+            c = c << 6 | (*p++ & 0x3f);
+        char m = '?';
+        for (int i = 0; i < 128; i++)
+            if (macroman_unicode[i] == c) {
+                m = 0x80 + i;
+                break;
+            }
+        name[n++] = m;
+    }
+    name[n] = 0;
+    return name;
+}
+
+const char *macroman_to_host_encoding(const char *filename)
+{
+    static char name[MAX_PATH_LENGTH];
+    static const char hex[] = "0123456789ABCDEF";
+    const uint8 *p = (const uint8 *)filename;
+    size_t len = strlen(filename);
+    size_t n = 0;
+    for (size_t i = 0; i < len && n < sizeof(name) - 4; i++) {
+        uint8 c = p[i];
+        bool escape = c >= 0x80 || c < 0x20 || strchr("/\\:*?\"<>|%", c) ||
+                      (i == 0 && c == '.') || (i == len - 1 && (c == '.' || c == ' '));
+        if (escape) {
+            name[n++] = '%';
+            name[n++] = hex[c >> 4];
+            name[n++] = hex[c & 15];
+        } else
+            name[n++] = c;
+    }
+    name[n] = 0;
+    return name;
+}
+
+#endif // SUPPORTS_EXTFS
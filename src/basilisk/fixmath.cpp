@@ -0,0 +1,278 @@
+/*
+ *  fixmath.cpp - Native FixMath and bit utility traps
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  QuickDraw, the Font Manager's scaling and many applications call the
+ *  Toolbox fixed point and bit utilities in their inner loops. The ROM runs
+ *  each of them as a dozen 68k instructions, several MULU/DIVU among them,
+ *  plus the trap dispatch. They are pure functions of their stack arguments,
+ *  so the traps are pointed at small stubs that hand the call to
+ *  FixMathOp():
+ *
+ *  - FixMul(), FracMul(), FixDiv(), FracDiv() and FixRatio(), rounded to
+ *    the nearest value and pinned to 0x7fffffff/0x80000000 on overflow or
+ *    division by zero, as the ROM does
+ *  - LongMul(), the 64-bit product into an Int64Bit
+ *  - BitAnd(), BitOr(), BitXor(), BitNot(), BitShift(), HiWord(), LoWord()
+ *  - BitTst(), BitSet() and BitClr(), bit 0 being the high bit of the byte
+ *    at bytePtr
+ *
+ *  The "nonativemath" pref leaves the ROM versions alone. Once installed,
+ *  the console's "set nativemath 0" makes the stubs jump to the previous
+ *  trap addresses instead, to rule them out while the Mac runs.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "prefs.h"
+#include "emul_op.h"
+#include "console.h"
+#include "fixmath.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+#if USE_NATIVE_FIXMATH
+
+// Trap selectors (d0 of M68K_EMUL_OP_FIXMATH)
+enum {
+    fmFixMul,
+    fmFracMul,
+    fmFixDiv,
+    fmFracDiv,
+    fmFixRatio,
+    fmLongMul,
+    fmBitAnd,
+    fmBitOr,
+    fmBitXor,
+    fmBitNot,
+    fmBitShift,
+    fmBitTst,
+    fmBitSet,
+    fmBitClr,
+    fmHiWord,
+    fmLoWord,
+    FIXMATH_TRAPS
+};
+
+struct fixmath_trap {
+    uint16 trap;
+    uint16 arg_size;                // Bytes of Pascal arguments popped on return
+};
+
+static const fixmath_trap fixmath_traps[FIXMATH_TRAPS] = {
+    {0xa868, 8},                    // FixMul(a, b: Fixed): Fixed
+    {0xa84a, 8},                    // FracMul(x, y: Fract): Fract
+    {0xa84d, 8},                    // FixDiv(x, y: Fixed): Fixed
+    {0xa84b, 8},                    // FracDiv(x, y: Fract): Fract
+    {0xa869, 4},                    // FixRatio(numer, denom: INTEGER): Fixed
+    {0xa867, 12},                   // LongMul(a, b: LONGINT; VAR result: Int64Bit)
+    {0xa858, 8},                    // BitAnd(value1, value2: LONGINT): LONGINT
+    {0xa85b, 8},                    // BitOr(value1, value2: LONGINT): LONGINT
+    {0xa859, 8},                    // BitXor(value1, value2: LONGINT): LONGINT
+    {0xa85a, 4},                    // BitNot(value: LONGINT): LONGINT
+    {0xa85c, 6},                    // BitShift(value: LONGINT; count: INTEGER): LONGINT
+    {0xa85d, 8},                    // BitTst(bytePtr: Ptr; bitNum: LONGINT): BOOLEAN
+    {0xa85e, 8},                    // BitSet(bytePtr: Ptr; bitNum: LONGINT)
+    {0xa85f, 8},                    // BitClr(bytePtr: Ptr; bitNum: LONGINT)
+    {0xa86a, 4},                    // HiWord(x: LONGINT): INTEGER
+    {0xa86b, 4},                    // LoWord(x: LONGINT): INTEGER
+};
+
+#define FIXMATH_STUB_SIZE 16
+
+static uint32 fixmath_patch = 0;            // Mac address of the stubs
+static volatile uint32 native_math = 1;     // 0: stubs jump to the previous traps
+
+
+/*
+ *  Arithmetic
+ */
+
+static uint32 pin(int64 v)
+{
+    if (v > 0x7fffffffLL)
+        return 0x7fffffff;
+    if (v < -0x80000000LL)
+        return 0x80000000;
+    return (uint32)v;
+}
+
+// a * b / 2^shift, rounded
+static uint32 fixed_mul(int32 a, int32 b, int shift)
+{
+    int64 p = (int64)a * b;
+    return pin((p + ((int64)1 << (shift - 1))) >> shift);
+}
+
+// x * 2^shift / y, rounded
+static uint32 fixed_div(int32 x, int32 y, int shift)
+{
+    if (y == 0)
+        return x < 0 ? 0x80000000 : 0x7fffffff;
+    uint64 n = (uint64)(x < 0 ? -(int64)x : (int64)x) << shift;
+    uint64 d = y < 0 ? -(int64)y : (int64)y;
+    int64 q = (int64)((n + d / 2) / d);
+    return pin((x < 0) != (y < 0) ? -q : q);
+}
+
+// The 68k shifts by the count modulo 64, 32 and more clear the value
+static uint32 bit_shift(uint32 value, int16 count)
+{
+    int n = (count < 0 ? -count : count) & 63;
+    if (n >= 32)
+        return 0;
+    return count < 0 ? value >> n : value << n;
+}
+
+
+/*
+ *  Trap stub entry: d0 = 0 when handled (arguments popped, result stored),
+ *  otherwise the stub jumps to the previous trap
+ */
+
+void FixMathOp(M68kRegisters *r)
+{
+    uint32 sel = r->d[0];
+    if (!native_math || sel >= FIXMATH_TRAPS) {
+        r->d[0] = 1;
+        return;
+    }
+
+    uint32 sp = r->a[7];
+    uint32 ret = ReadMacInt32(sp);
+    switch (sel) {
+        case fmFixMul:
+            WriteMacInt32(sp + 12, fixed_mul(ReadMacInt32(sp + 8), ReadMacInt32(sp + 4), 16));
+            break;
+        case fmFracMul:
+            WriteMacInt32(sp + 12, fixed_mul(ReadMacInt32(sp + 8), ReadMacInt32(sp + 4), 30));
+            break;
+        case fmFixDiv:
+            WriteMacInt32(sp + 12, fixed_div(ReadMacInt32(sp + 8), ReadMacInt32(sp + 4), 16));
+            break;
+        case fmFracDiv:
+            WriteMacInt32(sp + 12, fixed_div(ReadMacInt32(sp + 8), ReadMacInt32(sp + 4), 30));
+            break;
+        case fmFixRatio:
+            WriteMacInt32(sp + 8, fixed_div((int16)ReadMacInt16(sp + 6), (int16)ReadMacInt16(sp + 4), 16));
+            break;
+        case fmLongMul: {
+            uint64 p = (uint64)((int64)(int32)ReadMacInt32(sp + 12) * (int32)ReadMacInt32(sp + 8));
+            uint32 result = ReadMacInt32(sp + 4);
+            WriteMacInt32(result, (uint32)(p >> 32));
+            WriteMacInt32(result + 4, (uint32)p);
+            break;
+        }
+        case fmBitAnd:
+            WriteMacInt32(sp + 12, ReadMacInt32(sp + 8) & ReadMacInt32(sp + 4));
+            break;
+        case fmBitOr:
+            WriteMacInt32(sp + 12, ReadMacInt32(sp + 8) | ReadMacInt32(sp + 4));
+            break;
+        case fmBitXor:
+            WriteMacInt32(sp + 12, ReadMacInt32(sp + 8) ^ ReadMacInt32(sp + 4));
+            break;
+        case fmBitNot:
+            WriteMacInt32(sp + 8, ~ReadMacInt32(sp + 4));
+            break;
+        case fmBitShift:
+            WriteMacInt32(sp + 10, bit_shift(ReadMacInt32(sp + 6), ReadMacInt16(sp + 4)));
+            break;
+        case fmBitTst:
+        case fmBitSet:
+        case fmBitClr: {
+            int32 bit = ReadMacInt32(sp + 4);
+            uint32 addr = ReadMacInt32(sp + 8) + (bit >> 3);
+            uint8 mask = 0x80 >> (bit & 7);
+            if (sel == fmBitTst)
+                WriteMacInt8(sp + 12, (ReadMacInt8(addr) & mask) ? 1 : 0);     // BOOLEAN in the high byte
+            else if (sel == fmBitSet)
+                WriteMacInt8(addr, ReadMacInt8(addr) | mask);
+            else
+                WriteMacInt8(addr, ReadMacInt8(addr) & ~mask);
+            break;
+        }
+        case fmHiWord:
+            WriteMacInt16(sp + 8, ReadMacInt32(sp + 4) >> 16);
+            break;
+        case fmLoWord:
+            WriteMacInt16(sp + 8, ReadMacInt32(sp + 4));
+            break;
+    }
+
+    // Pop the arguments, the stub returns with rts
+    uint32 arg_size = fixmath_traps[sel].arg_size;
+    WriteMacInt32(sp + arg_size, ret);
+    r->a[7] = sp + arg_size;
+    r->d[0] = 0;
+}
+
+
+/*
+ *  Install the trap stubs
+ */
+
+// Offer the call to FixMathOp(), jump to the previous trap when declined
+static void write_stub(uint32 p, int sel, uint32 orig)
+{
+    WriteMacInt16(p, 0x7000 | sel); p += 2;             // moveq   #sel,d0
+    WriteMacInt16(p, M68K_EMUL_OP_FIXMATH); p += 2;
+    WriteMacInt16(p, 0x4a40); p += 2;                   // tst.w   d0
+    WriteMacInt16(p, 0x6706); p += 2;                   // beq.s   1
+    WriteMacInt16(p, M68K_JMP); p += 2;                 // jmp     orig
+    WriteMacInt32(p, orig); p += 4;
+    WriteMacInt16(p, M68K_RTS);                         //1 rts
+}
+
+void FixMathInstall(void)
+{
+    if (fixmath_patch || PrefsFindBool("nonativemath"))
+        return;
+
+    M68kRegisters r;
+    r.d[0] = FIXMATH_TRAPS * FIXMATH_STUB_SIZE;
+    Execute68kTrap(0xa71e, &r);     // NewPtrSysClear()
+    if (r.a[0] == 0)
+        return;
+    fixmath_patch = r.a[0];
+
+    // Each stub is complete before its trap points at it
+    for (int i = 0; i < FIXMATH_TRAPS; i++) {
+        uint32 stub = fixmath_patch + i * FIXMATH_STUB_SIZE;
+        r.d[0] = fixmath_traps[i].trap;
+        Execute68kTrap(0xa746, &r);     // GetToolTrapAddress()
+        write_stub(stub, i, r.a[0]);
+        FlushCodeCache(Mac2HostAddr(stub), FIXMATH_STUB_SIZE);
+        r.d[0] = fixmath_traps[i].trap;
+        r.a[0] = stub;
+        Execute68kTrap(0xa647, &r);     // SetToolTrapAddress()
+    }
+
+    ConsoleAddTunable("nativemath", &native_math, 0, 1);
+    D(bug("FixMath patches at %08x\n", fixmath_patch));
+}
+
+void FixMathReset(void)
+{
+    fixmath_patch = 0;
+}
+
+#else
+
+void FixMathInstall(void)
+{
+}
+
+void FixMathReset(void)
+{
+}
+
+void FixMathOp(M68kRegisters *r)
+{
+    UNUSED(r);
+}
+
+#endif
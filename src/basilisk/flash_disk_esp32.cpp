@@ -0,0 +1,142 @@
+/*
+ *  flash_disk_esp32.cpp - Disk image kept in a flash partition
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The "sysvol" data partition holds one disk image, named by the
+ *  "flashdisk" pref: typically a small boot volume with a trimmed System
+ *  Folder. Sys_open() maps it through the flash cache, and boot-time reads
+ *  of the System file become memory copies from flash instead of SD card
+ *  transfers.
+ *
+ *  The image is copied from the card the first time it is opened, and again
+ *  only when the file on the card changes (path, size or modification
+ *  time). The header sector is erased before the copy and written after it,
+ *  so a cut off copy is never mapped. The mapping is read-only; writes to
+ *  the volume go to an overlay file on the card (see sys_esp32.cpp).
+ */
+
+#include "sysdeps.h"
+#include "flash_disk.h"
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_heap_caps.h>
+
+#if FLASH_DISK
+
+#define DEBUG 0
+#include "debug.h"
+
+#define FLASH_DISK_SUBTYPE  0x41            // "sysvol" in partitions.csv
+#define FLASH_DISK_MAGIC    0x42324644      // 'B2FD'
+#define FLASH_DISK_VERSION  1
+#define FLASH_DISK_IMAGE    0x10000         // Image offset, on a 64KB MMU page
+#define FLASH_DISK_COPY     0x10000         // Bytes erased and written at a time
+
+// First sector of the partition, written after the image it describes
+struct flash_disk_header {
+    uint32 magic;
+    uint32 version;
+    uint32 size;            // Image file size, modification time and path
+    uint32 mtime;
+    char path[64];
+};
+
+static const esp_partition_t *partition = NULL;
+static const uint8 *flash_image = NULL;
+static esp_partition_mmap_handle_t flash_handle;
+
+
+/*
+ *  Partition access
+ */
+
+static bool find_partition(void)
+{
+    if (partition == NULL)
+        partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)FLASH_DISK_SUBTYPE, "sysvol");
+    return partition != NULL;
+}
+
+static bool same_file(const flash_disk_header &h, const char *path, uint32 size, uint32 mtime)
+{
+    return h.magic == FLASH_DISK_MAGIC && h.version == FLASH_DISK_VERSION &&
+           h.size == size && h.mtime == mtime && strncmp(h.path, path, sizeof(h.path) - 1) == 0;
+}
+
+static bool copy_image(const char *path, uint32 size, uint32 mtime, flash_disk_reader read, void *arg)
+{
+    uint8 *buffer = (uint8 *)heap_caps_aligned_alloc(64, FLASH_DISK_COPY, MALLOC_CAP_SPIRAM);
+    if (buffer == NULL)
+        return false;
+
+    // Header invalidated first
+    bool ok = esp_partition_erase_range(partition, 0, partition->erase_size) == ESP_OK;
+    for (uint32 offset = 0; ok && offset < size; offset += FLASH_DISK_COPY) {
+        uint32 n = size - offset < FLASH_DISK_COPY ? size - offset : FLASH_DISK_COPY;
+        ok = read(arg, buffer, offset, n) &&
+             esp_partition_erase_range(partition, FLASH_DISK_IMAGE + offset, FLASH_DISK_COPY) == ESP_OK &&
+             esp_partition_write(partition, FLASH_DISK_IMAGE + offset, buffer, n) == ESP_OK;
+    }
+    heap_caps_free(buffer);
+
+    flash_disk_header h;
+    memset(&h, 0, sizeof(h));
+    h.magic = FLASH_DISK_MAGIC;
+    h.version = FLASH_DISK_VERSION;
+    h.size = size;
+    h.mtime = mtime;
+    strncpy(h.path, path, sizeof(h.path) - 1);
+    return ok && esp_partition_write(partition, 0, &h, sizeof(h)) == ESP_OK;
+}
+
+
+/*
+ *  Map the image, copied from the card if the partition holds another one
+ */
+
+const uint8 *FlashDiskMap(const char *path, uint32 size, uint32 mtime, flash_disk_reader read, void *arg)
+{
+    if (flash_image != NULL)
+        return NULL;
+    if (!find_partition()) {
+        Serial.println("[FLASHDISK] No \"sysvol\" partition, the image stays on the card");
+        return NULL;
+    }
+    uint32 room = partition->size - FLASH_DISK_IMAGE;
+    if (((size + FLASH_DISK_COPY - 1) & ~(FLASH_DISK_COPY - 1)) > room) {
+        Serial.printf("[FLASHDISK] %s is too large for the partition (%u KB > %u KB)\n", path, size / 1024, room / 1024);
+        return NULL;
+    }
+
+    flash_disk_header h;
+    if (esp_partition_read(partition, 0, &h, sizeof(h)) != ESP_OK || !same_file(h, path, size, mtime)) {
+        Serial.printf("[FLASHDISK] Copying %s to flash (%u KB)...\n", path, size / 1024);
+        uint32 t0 = millis();
+        if (!copy_image(path, size, mtime, read, arg)) {
+            Serial.println("[FLASHDISK] ERROR: Cannot copy the image to flash");
+            return NULL;
+        }
+        Serial.printf("[FLASHDISK] Copied in %u ms\n", millis() - t0);
+    }
+
+    const void *p;
+    if (esp_partition_mmap(partition, FLASH_DISK_IMAGE, size, ESP_PARTITION_MMAP_DATA, &p, &flash_handle) != ESP_OK) {
+        Serial.println("[FLASHDISK] ERROR: Cannot map the image");
+        return NULL;
+    }
+    flash_image = (const uint8 *)p;
+    Serial.printf("[FLASHDISK] %s mapped from flash at %p\n", path, flash_image);
+    return flash_image;
+}
+
+void FlashDiskUnmap(void)
+{
+    if (flash_image == NULL)
+        return;
+    esp_partition_munmap(flash_handle);
+    flash_image = NULL;
+}
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ *  hud_esp32.cpp - On-screen performance HUD
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  A strip in the bottom left corner of the panel shows, once a second:
+ *
+ *    MIPS 11.8  FPS 24  tiles/frame 5.1  disk r 310 w 12 KB/s
+ *    PSRAM 13.2 MB  SRAM 118 KB free  load core0 38%  core1 100%
+ *
+ *  The Mac screen fills the whole panel, so the HUD is composited over it
+ *  when the video task pushes a band under the strip, and the strip itself
+ *  is pushed after each refresh (see video_esp32.cpp). The Mac frame buffer
+ *  is never touched and no tile is rendered for the HUD, except once to
+ *  repaint what it covered when it is hidden.
+ *
+ *  All figures come from the counters of perf_registry.cpp, plus the free
+ *  heap. The load of a core is the share of time its idle task did not
+ *  run: the idle hook of each core adds the time since its last call,
+ *  when the calls are less than a tick and a bit apart (the idle task
+ *  sleeps until the next interrupt in between). A task that runs for less
+ *  than that is counted as idle, so the load is a lower bound.
+ *
+ *  Shown with the "hud" pref, a tap with two fingers or the console's
+ *  "hud" command. The strip is allocated in PSRAM the first time it shows.
+ */
+
+#include "sysdeps.h"
+#include "prefs.h"
+#include "perf_registry.h"
+#include "hud.h"
+
+#include <M5Unified.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <esp_freertos_hooks.h>
+
+#if PERF_HUD
+
+#define HUD_IDLE_GAP_US     1100    // Idle hook calls further apart: a task ran
+#define HUD_TEXT_SIZE       2       // 6x8 font doubled, 12x16 pixels per character
+#define HUD_FG              0xffe0  // Yellow on black
+#define HUD_BG              0x0000
+
+// Idle time of each core, written by its idle task
+static perf_counter *const perf_idle[2] = {
+    PerfCounter("core0.idle_us", PERF_COUNT, 0),
+    PerfCounter("core1.idle_us", PERF_COUNT, 1)
+};
+static uint32 idle_last[2];
+
+static volatile bool hud_visible = false;
+static M5Canvas *canvas = NULL;             // The strip (video task)
+
+// Counters shown, NULL if not built in, and their values at the last refresh
+enum {
+    HUD_INSTRUCTIONS,
+    HUD_FRAMES,
+    HUD_TILES,
+    HUD_READ_BYTES,
+    HUD_WRITE_BYTES,
+    HUD_IDLE0,
+    HUD_IDLE1,
+    HUD_COUNTERS
+};
+static const char *const hud_names[HUD_COUNTERS] = {
+    "cpu.instructions", "video.partial", "video.tiles",
+    "disk.read_bytes", "disk.write_bytes", "core0.idle_us", "core1.idle_us"
+};
+static perf_counter *hud_counters[HUD_COUNTERS];
+static uint32 hud_last[HUD_COUNTERS];
+static uint32 hud_last_ms = 0;
+
+
+/*
+ *  Idle time accounting (idle task of each core)
+ */
+
+static void idle_account(int core)
+{
+    uint32 now = (uint32)esp_timer_get_time();
+    uint32 gap = now - idle_last[core];
+    idle_last[core] = now;
+    if (gap <= HUD_IDLE_GAP_US)
+        perf_add(perf_idle[core], gap);
+}
+
+static bool idle_hook_core0(void)
+{
+    idle_account(0);
+    return true;
+}
+
+static bool idle_hook_core1(void)
+{
+    idle_account(1);
+    return true;
+}
+
+
+/*
+ *  Strip (video task)
+ */
+
+// Change of a counter since the last refresh, 0 if it is not built in
+static uint32 hud_delta(int which)
+{
+    perf_counter *c = hud_counters[which];
+    return c ? perf_delta(c, hud_last[which]) : 0;
+}
+
+static void draw_strip(uint32 ms)
+{
+    float s = ms / 1000.0f;
+    uint32 instructions = hud_delta(HUD_INSTRUCTIONS);
+    uint32 frames = hud_delta(HUD_FRAMES);
+    uint32 tiles = hud_delta(HUD_TILES);
+    uint32 read_bytes = hud_delta(HUD_READ_BYTES);
+    uint32 write_bytes = hud_delta(HUD_WRITE_BYTES);
+    uint32 idle0 = hud_delta(HUD_IDLE0);
+    uint32 idle1 = hud_delta(HUD_IDLE1);
+    int load0 = 100 - (int)(idle0 / (ms * 10.0f) + 0.5f);
+    int load1 = 100 - (int)(idle1 / (ms * 10.0f) + 0.5f);
+
+    char line[64];
+    canvas->fillSprite(HUD_BG);
+    canvas->setCursor(4, 4);
+    snprintf(line, sizeof(line), "MIPS %.1f  FPS %.0f  tiles/frame %.1f  disk r %u w %u KB/s",
+             instructions / (s * 1e6f), frames / s, frames ? (float)tiles / frames : 0.0f,
+             (uint32)(read_bytes / s / 1024), (uint32)(write_bytes / s / 1024));
+    canvas->print(line);
+    canvas->setCursor(4, 4 + 8 * HUD_TEXT_SIZE);
+    snprintf(line, sizeof(line), "PSRAM %.1f MB  SRAM %u KB free  load core0 %d%%  core1 %d%%",
+             heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1048576.0f,
+             (uint32)(heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024),
+             load0 < 0 ? 0 : load0, load1 < 0 ? 0 : load1);
+    canvas->print(line);
+}
+
+bool HudUpdate(void)
+{
+    uint32 now = millis();
+    if (canvas == NULL) {
+        canvas = new M5Canvas(&M5.Display);
+        canvas->setColorDepth(16);
+        canvas->setPsram(true);
+        if (canvas->createSprite(HUD_WIDTH, HUD_HEIGHT) == NULL) {
+            Serial.println("[HUD] ERROR: No memory for the HUD strip");
+            delete canvas;
+            canvas = NULL;
+            hud_visible = false;
+            return false;
+        }
+        canvas->setTextSize(HUD_TEXT_SIZE);
+        canvas->setTextColor(HUD_FG, HUD_BG);
+
+        // First figures after a full interval
+        for (int i = 0; i < HUD_COUNTERS; i++)
+            hud_delta(i);
+        hud_last_ms = now;
+        canvas->fillSprite(HUD_BG);
+        return true;
+    }
+    if (now - hud_last_ms < HUD_INTERVAL_MS)
+        return false;
+    draw_strip(now - hud_last_ms);
+    hud_last_ms = now;
+    return true;
+}
+
+const uint16 *HudPixels(void)
+{
+    return canvas ? (const uint16 *)canvas->getBuffer() : NULL;
+}
+
+
+/*
+ *  Interface
+ */
+
+void HudInit(void)
+{
+    for (int i = 0; i < HUD_COUNTERS; i++)
+        hud_counters[i] = PerfCounterFind(hud_names[i]);
+    if (esp_register_freertos_idle_hook_for_cpu(idle_hook_core0, 0) != ESP_OK ||
+        esp_register_freertos_idle_hook_for_cpu(idle_hook_core1, 1) != ESP_OK)
+        Serial.println("[HUD] WARNING: No idle hooks, the core load is not measured");
+    hud_visible = PrefsFindBool("hud");
+}
+
+void HudShow(bool show)
+{
+    hud_visible = show;
+}
+
+void HudToggle(void)
+{
+    hud_visible = !hud_visible;
+}
+
+bool HudVisible(void)
+{
+    return hud_visible;
+}
+
+#endif
@@ -34,11 +34,42 @@ extern void ADBKeyDown(int code);
 extern void ADBKeyUp(int code);
 
 extern void ADBInterrupt(void);
+extern bool ADBPending(void);
 
 extern void ADBSetRelMouseMode(bool relative);
 
+#if INPUT_REPLAY
+// Record the events handed to the Mac with their tick counts, write them to
+// SD, and replay them at the same ticks from now (CPU task, see adb.cpp)
+extern void ADBRecordStart(void);
+extern void ADBRecordStop(void);
+extern void ADBReplayStart(void);
+#endif
+
 // Get keyboard LED state (for USB keyboard LED sync)
 // Returns bitmask: bit 0 = Num Lock, bit 1 = Caps Lock, bit 2 = Scroll Lock
 extern uint8 ADBGetKeyboardLEDs(void);
 
+#if INPUT_TELEMETRY
+#include "telemetry.h"
+
+// Latency histograms in us, from posting an input event to handing it to the Mac
+enum {
+	ADB_LATENCY_MOVE,
+	ADB_LATENCY_BUTTON,
+	ADB_LATENCY_KEY,
+	ADB_LATENCY_COUNT
+};
+
+extern const telemetry_histogram *ADBLatency(int which);
+extern void ADBLatencyReset(void);
+
+// Input to photon, from posting an event to the end of the push of the
+// first frame that changed after the Mac got it (see video_esp32.cpp).
+// CPU task: an event of kind which, posted at posted, was handed to the Mac.
+extern void VideoPhotonArm(int which, uint32 posted);
+extern const telemetry_histogram *VideoPhotonLatency(int which);
+extern void VideoPhotonReset(void);
+#endif
+
 #endif
@@ -0,0 +1,26 @@
+/*
+ *  app_profile.h - Performance settings per Mac application
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef APP_PROFILE_H
+#define APP_PROFILE_H
+
+#if APP_PROFILES
+
+// Read the "[app:Name]" sections of the profiles file (after the modules
+// have registered their console tunables)
+extern void AppProfileInit(void);
+
+// Service task: apply the section of the current application once it has
+// changed
+extern void AppProfilePoll(uint32 now_ms);
+
+#else
+
+static inline void AppProfilePoll(uint32) {}
+
+#endif
+
+#endif /* APP_PROFILE_H */
@@ -18,6 +18,9 @@
 // Maximum number of files to list
 #define BOOT_GUI_MAX_FILES 32
 
+// Performance profiles, "[name]" sections of prefs lines (see prefs_esp32.cpp)
+#define BOOT_GUI_PROFILES_FILE "/basilisk_profiles.txt"
+
 /*
  *  Initialize the boot GUI system
  *  Must be called after SD card is initialized
@@ -58,4 +61,56 @@ uint32_t BootGUI_GetRAMSize(void);
  */
 int BootGUI_GetRAMSizeMB(void);
 
+/*
+ *  Check whether to run the CPU benchmark before booting
+ *  Returns true if the Benchmark button was pressed or the settings file
+ *  has benchmark=yes
+ */
+bool BootGUI_GetBenchmark(void);
+
+/*
+ *  Check whether FPU arithmetic should be rounded to single precision
+ *  Returns true if the settings file has fpufast=yes
+ */
+bool BootGUI_GetFPUFast(void);
+
+/*
+ *  Check whether the Mac screen should be the native 1280x720 (up to 256 colors)
+ *  Returns true if the settings file has screen=1280x720, false for 640x360
+ */
+bool BootGUI_GetNativeScreen(void);
+
+/*
+ *  Check whether to resume the hibernated session instead of booting
+ *  Returns true if a snapshot was found and the settings screen was not opened
+ */
+bool BootGUI_GetResume(void);
+
+/*
+ *  Get the WiFi network the Ethernet driver joins
+ *  Returns the wifi_ssid= and wifi_password= settings ("" if not set)
+ */
+const char* BootGUI_GetWiFiSSID(void);
+const char* BootGUI_GetWiFiPassword(void);
+
+/*
+ *  Check whether to tunnel AppleTalk over UDP instead of bridging Ethernet
+ *  Returns true if the settings file has udptunnel=yes
+ */
+bool BootGUI_GetUDPTunnel(void);
+
+/*
+ *  Get what the Mac's modem (A) and printer (B) ports are connected to
+ *  Returns the seriala= and serialb= settings: "usb", "uart" or "" for none
+ */
+const char* BootGUI_GetSerialA(void);
+const char* BootGUI_GetSerialB(void);
+
+/*
+ *  Get the performance profile to apply from BOOT_GUI_PROFILES_FILE
+ *  Returns the profile= setting or the one picked on the settings screen
+ *  ("" for the built-in defaults)
+ */
+const char* BootGUI_GetProfile(void);
+
 #endif // BOOT_GUI_H
@@ -0,0 +1,49 @@
+/*
+ *  console.h - Command console on the USB serial port
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#if SERIAL_CONSOLE
+
+// Values the console shows with "get" and changes with "set" (clamped to
+// min..max). Registered once at init, by the module that owns the variable.
+// "stats" shows the counters of perf_registry.h.
+extern void ConsoleAddTunable(const char *name, volatile uint32 *value, uint32 min, uint32 max);
+
+// Any task: set a tunable as "set" does, the value before in *old (if not
+// NULL); false if none has that name
+extern bool ConsoleSetTunable(const char *name, uint32 value, uint32 *old);
+
+// Start the console task on Core 0
+extern void ConsoleInit(void);
+
+// CPU task: next one-character debug command typed on the console, -1: none
+extern int ConsoleNextCommand(void);
+
+// Whether the periodic [IPS], [MAIN PERF], [VIDEO PERF] and [DISK PERF]
+// lines are printed ("report on|off", "perfreport" pref)
+extern bool ConsoleReports(void);
+
+// Any task: print a milestone for the scripts that time the Mac
+// (tools/bench_harness.py), "[MARK] <name> ms=<millis>" or in raw mode
+// "@mark <name> ms=<millis>"
+extern void ConsoleMark(const char *name);
+
+// CPU task, A-line traps that make milestones: the first GetNextEvent or
+// WaitNextEvent ("events", the Finder is up) and each _Launch ("launch")
+#define CONSOLE_TRAP_MARK(opcode) ((opcode) == 0xa860 || (opcode) == 0xa970 || (opcode) == 0xa9f2)
+extern void ConsoleTrapMark(uint16 opcode);
+
+#else
+
+static inline void ConsoleAddTunable(const char *, volatile uint32 *, uint32, uint32) {}
+static inline bool ConsoleReports(void) { return true; }
+static inline void ConsoleMark(const char *) {}
+
+#endif
+
+#endif /* CONSOLE_H */
@@ -0,0 +1,19 @@
+/*
+ *  cursor.h - Cursor overlay instead of a frame buffer cursor
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef CURSOR_H
+#define CURSOR_H
+
+// Take over the low memory cursor vectors (called by PatchAfterStartup())
+extern void CursorInstall(void);
+
+// Give the cursor back to the ROM (Mac reset)
+extern void CursorReset(void);
+
+// Handle one of the M68K_EMUL_OP_CURSOR_* opcodes of the vector stubs
+extern void CursorOp(uint16 opcode, M68kRegisters *r);
+
+#endif
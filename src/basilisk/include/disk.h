@@ -32,6 +32,7 @@ extern void DiskInit(void);
 extern void DiskExit(void);
 
 extern void DiskInterrupt(void);
+extern void DiskIOInterrupt(void);
 
 extern bool DiskMountVolume(void *fh);
 
@@ -91,6 +91,22 @@ enum {
 	M68K_EMUL_OP_DEBUGUTIL,
 	M68K_EMUL_OP_IDLE_TIME,
 	M68K_EMUL_OP_SUSPEND,
+	M68K_EMUL_OP_BLOCK_MOVE_NATIVE,
+	M68K_EMUL_OP_QD_COPYBITS,
+	M68K_EMUL_OP_QD_FILLRECT,
+	M68K_EMUL_OP_QD_ERASERECT,		// 0x713c
+	M68K_EMUL_OP_CURSOR_HIDE,
+	M68K_EMUL_OP_CURSOR_SHOW,
+	M68K_EMUL_OP_CURSOR_SHIELD,
+	M68K_EMUL_OP_CURSOR_SET,		// 0x7140
+	M68K_EMUL_OP_CURSOR_SET_CCURSOR,
+	M68K_EMUL_OP_CURSOR_OBSCURE,
+	M68K_EMUL_OP_CURSOR_TASK,
+	M68K_EMUL_OP_QD_SCROLLRECT,		// 0x7144
+	M68K_EMUL_OP_FIXMATH,
+	M68K_EMUL_OP_DELAY_LOOP,
+	M68K_EMUL_OP_RSRC_GET,
+	M68K_EMUL_OP_RSRC_CHANGED,		// 0x7148
 	M68K_EMUL_OP_MAX				// highest number
 };
 
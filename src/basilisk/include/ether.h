@@ -37,6 +37,7 @@ extern void EtherInterrupt(void);
 extern bool ether_init(void);
 extern void ether_exit(void);
 extern void ether_reset(void);
+extern bool ether_open(void);
 extern int16 ether_add_multicast(uint32 pb);
 extern int16 ether_del_multicast(uint32 pb);
 extern int16 ether_attach_ph(uint16 type, uint32 handler);
@@ -45,6 +46,8 @@ extern int16 ether_write(uint32 wds);
 extern bool ether_start_udp_thread(int socket_fd);
 extern void ether_stop_udp_thread(void);
 extern void ether_udp_read(uint32 packet, int length, struct sockaddr_in *from);
+extern uint32 ether_udp_link(void);
+extern bool ether_udp_send(const uint8 *packet, int len, uint32 dest_ip, uint16 port);
 
 extern uint8 ether_addr[6];	// Ethernet address (set by ether_init())
 
@@ -44,6 +44,8 @@ extern bool extfs_remove(const char *path);
 extern bool extfs_rename(const char *old_path, const char *new_path);
 extern const char *host_encoding_to_macroman(const char *filename); // What if the guest OS is using MacJapanese or MacArabic? Oh well...
 extern const char *macroman_to_host_encoding(const char *filename); // What if the guest OS is using MacJapanese or MacArabic? Oh well...
+extern const char *extfs_host_root(const char *pref);	// Host path of the shared folder named by the "extfs" pref
+extern void extfs_volume_size(uint64 &total_bytes, uint64 &free_bytes);
 
 // Maximum length of full path name
 const int MAX_PATH_LENGTH = 1024;
@@ -0,0 +1,21 @@
+/*
+ *  fixmath.h - Native FixMath and bit utility traps
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef FIXMATH_H
+#define FIXMATH_H
+
+// Patch FixMul(), FixDiv(), LongMul(), BitAnd() and the other small pure
+// Toolbox utilities, unless the "nonativemath" pref is set (called by
+// PatchAfterStartup())
+extern void FixMathInstall(void);
+
+// The system heap holding the stubs is gone (Mac reset)
+extern void FixMathReset(void);
+
+// Handle M68K_EMUL_OP_FIXMATH of the trap stubs (d0 = trap selector)
+extern void FixMathOp(M68kRegisters *r);
+
+#endif
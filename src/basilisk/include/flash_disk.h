@@ -0,0 +1,26 @@
+/*
+ *  flash_disk.h - Disk image kept in a flash partition
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef FLASH_DISK_H
+#define FLASH_DISK_H
+
+#if FLASH_DISK
+
+// Reads length bytes of the image at offset, false on an error
+typedef bool (*flash_disk_reader)(void *arg, void *buffer, uint32 offset, uint32 length);
+
+// Map the image (path, size and modification time on the card) from the
+// "sysvol" partition through the flash cache. If the partition holds
+// another file, the image is copied into it with read first. Returns NULL
+// if there is no partition, the image does not fit or one is mapped already.
+extern const uint8 *FlashDiskMap(const char *path, uint32 size, uint32 mtime, flash_disk_reader read, void *arg);
+
+// Drop the mapping when the image is closed
+extern void FlashDiskUnmap(void);
+
+#endif
+
+#endif /* FLASH_DISK_H */
@@ -0,0 +1,41 @@
+/*
+ *  hud.h - On-screen performance HUD
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef HUD_H
+#define HUD_H
+
+#if PERF_HUD
+
+// Strip of the panel the HUD covers (display pixels, bottom left corner;
+// even, so it is whole Mac pixels at 640x360 too)
+#define HUD_WIDTH       640
+#define HUD_HEIGHT      40
+#define HUD_X           0
+#define HUD_Y           (720 - HUD_HEIGHT)
+#define HUD_INTERVAL_MS 1000    // Text refreshed once a second
+
+// Start the idle time accounting, show the HUD if the "hud" pref is set
+extern void HudInit(void);
+
+// Any task: show, hide or flip the HUD (two finger tap, "hud" command)
+extern void HudShow(bool show);
+extern void HudToggle(void);
+extern bool HudVisible(void);
+
+// Video task: redraw the strip when HUD_INTERVAL_MS has passed, true if it
+// changed and must be pushed; HudPixels() is HUD_WIDTH x HUD_HEIGHT RGB565
+// in the display's byte order, NULL before the first HudUpdate()
+extern bool HudUpdate(void);
+extern const uint16 *HudPixels(void);
+
+#else
+
+static inline void HudInit(void) {}
+static inline void HudToggle(void) {}
+
+#endif
+
+#endif /* HUD_H */
@@ -65,6 +65,27 @@ bool InputIsKeyboardConnected(void);
  */
 bool InputIsMouseConnected(void);
 
+/*
+ *  Queue a scripted event for the input task, which posts it like its own
+ *  (console "move", "button", "click" and "key" commands). x/y are absolute
+ *  Mac coordinates for INPUT_INJECT_MOVE, code is the button or the Mac key
+ *  code. Returns false when the queue is full or the task is not running.
+ */
+enum {
+    INPUT_INJECT_MOVE,
+    INPUT_INJECT_BUTTON_DOWN,
+    INPUT_INJECT_BUTTON_UP,
+    INPUT_INJECT_KEY_DOWN,
+    INPUT_INJECT_KEY_UP
+};
+bool InputInject(int type, int code, int x, int y);
+
+/*
+ *  Print/clear the input latency histograms (INPUT_TELEMETRY)
+ */
+void InputTelemetryDump(void);
+void InputTelemetryReset(void);
+
 #ifdef __cplusplus
 }
 #endif
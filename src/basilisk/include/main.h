@@ -57,6 +57,12 @@ extern void ErrorAlert(int string_id);
 extern void WarningAlert(const char *text);				// Display warning alert
 extern void WarningAlert(int string_id);
 extern bool ChoiceAlert(const char *text, const char *pos, const char *neg);	// Display choice alert
+#if PARALLEL_BOOT
+extern void WaitRAMCleared(void);						// Mac RAM is being cleared in the background
+#endif
+#if WARM_RESTART
+extern void WarmRestart(void);							// Boot the Mac again, keeping the ROM, RAM and host tasks
+#endif
 
 // Mutexes (non-recursive)
 struct B2_mutex;
@@ -74,7 +80,8 @@ enum {
 	INTFLAG_AUDIO = 16,	// Audio block read
 	INTFLAG_TIMER = 32,	// Time Manager
 	INTFLAG_ADB = 64,	// ADB
-	INTFLAG_NMI = 128	// NMI
+	INTFLAG_NMI = 128,	// NMI
+	INTFLAG_DISK = 256	// Asynchronous disk transfer done
 };
 
 extern uint32 InterruptFlags;									// Currently pending interrupts
@@ -0,0 +1,93 @@
+/*
+ *  perf_registry.h - Named performance counters and histograms
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef PERF_REGISTRY_H
+#define PERF_REGISTRY_H
+
+#include <string.h>
+#include "telemetry.h"
+
+// Writer of a value: the CPU task, a task on Core 0, or any task holding
+// the owner's lock (one at a time)
+#define PERF_CORE_CPU   1
+#define PERF_CORE_IO    0
+#define PERF_CORE_ANY   (-1)
+
+enum {
+    PERF_COUNT,         // Sum since boot, read as the sum since PerfReset()
+    PERF_GAUGE          // Last value set
+};
+
+// Each value has a single writer, which updates it with plain stores (no
+// atomics, no locks); readers see every aligned word whole. A reset only
+// moves the reader's base, so it never races with the writer.
+struct perf_counter {
+    const char *name;
+    volatile uint32 value;
+    uint32 base;        // value at the last PerfReset()
+    int8 kind;
+    int8 core;
+};
+
+// Histograms are cleared by their writer, before its next sample after
+// PerfReset()
+struct perf_histogram {
+    const char *name;
+    telemetry_histogram h;
+    volatile bool reset;
+    int8 core;
+};
+
+// Register a value. Safe from static initializers: the tables need no
+// construction. A full table hands out a shared scratch value.
+extern perf_counter *PerfCounter(const char *name, int kind, int core);
+extern perf_histogram *PerfHistogram(const char *name, int core);
+
+// Writer side
+static inline void perf_add(perf_counter *c, uint32 n) { c->value = c->value + n; }
+static inline void perf_inc(perf_counter *c) { perf_add(c, 1); }
+static inline void perf_set(perf_counter *c, uint32 v) { c->value = v; }
+
+static inline void perf_record(perf_histogram *p, uint32 v)
+{
+    if (p->reset) {
+        memset(&p->h, 0, sizeof(p->h));
+        p->reset = false;
+    }
+    telemetry_record(p->h, v);
+}
+
+// Reader side: value since the last reset, and the change since the
+// reader's own last look (for periodic reports, independent of resets)
+static inline uint32 perf_read(const perf_counter *c)
+{
+    return c->kind == PERF_COUNT ? c->value - c->base : c->value;
+}
+
+static inline uint32 perf_delta(const perf_counter *c, uint32 &last)
+{
+    uint32 v = c->value;
+    uint32 d = v - last;
+    last = v;
+    return d;
+}
+
+// Registered values, in registration order
+extern int PerfCounterCount(void);
+extern perf_counter *PerfCounterAt(int i);
+extern int PerfHistogramCount(void);
+extern perf_histogram *PerfHistogramAt(int i);
+
+// Counter registered under name, NULL if none (after static init)
+extern perf_counter *PerfCounterFind(const char *name);
+
+// Copy of every counter's perf_read() taken in one pass; returns the count
+extern int PerfSnapshot(uint32 *values, int max);
+
+// Start all counts and histograms again from zero
+extern void PerfReset(void);
+
+#endif /* PERF_REGISTRY_H */
@@ -0,0 +1,34 @@
+/*
+ *  power.h - CPU clock scaling by emulator load
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef POWER_H
+#define POWER_H
+
+#if POWER_MANAGER
+
+// Set up frequency scaling and start at the full clock; false (and a fixed
+// clock) when the IDF has no power management
+extern bool PowerInit(void);
+
+// CPU task, after each sleep in idle_wait()
+extern void PowerIdle(uint32 slept_us);
+
+// CPU task, once per main loop pass: drop the clock after a sustained idle
+// stretch, raise it at once when a quantum runs without sleeping
+extern void PowerLoop(uint32 now_ms);
+
+// Any task: input arrived, the CPU task raises the clock when it wakes up
+extern void PowerWake(void);
+
+#else
+
+static inline void PowerIdle(uint32) {}
+static inline void PowerLoop(uint32) {}
+static inline void PowerWake(void) {}
+
+#endif
+
+#endif /* POWER_H */
@@ -35,7 +35,7 @@ extern void AddPlatformPrefsDefaults(void);
 extern void LoadPrefs(const char *vmdir);
 extern void SavePrefs(void);
 
-extern void LoadPrefsFromStream(FILE *f);
+extern void LoadPrefsFromStream(FILE *f, const char *section = NULL);
 extern void SavePrefsToStream(FILE *f);
 
 // Public preferences access functions
@@ -0,0 +1,19 @@
+/*
+ *  quickdraw.h - Native QuickDraw fast paths
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef QUICKDRAW_H
+#define QUICKDRAW_H
+
+// Patch CopyBits(), FillRect() and EraseRect() (called by PatchAfterStartup())
+extern void QuickDrawInstall(void);
+
+// The system heap holding the patch block is gone (Mac reset)
+extern void QuickDrawReset(void);
+
+// Handle one of the M68K_EMUL_OP_QD_* opcodes of the trap stubs
+extern void QuickDrawOp(uint16 opcode, M68kRegisters *r);
+
+#endif
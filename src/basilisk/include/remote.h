@@ -0,0 +1,37 @@
+/*
+ *  remote.h - Remote display stream over USB
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef REMOTE_H
+#define REMOTE_H
+
+#if REMOTE_DISPLAY
+
+// Start the stream task, streaming if the "remotedisplay" pref is set
+// (called by VideoInit())
+extern void RemoteInit(void);
+
+// Video task: the frame buffer and its mode, for the frames that follow
+extern void RemoteSetMode(const uint8 *frame_buffer, int width, int height, int depth, uint32 bytes_per_row);
+
+// Video task: the palette, each RGB565 color doubled as the video task keeps it
+extern void RemoteSetPalette(const uint32 *palette2x);
+
+// Video task: Mac pixels of the frame being pushed that changed
+extern void RemoteMarkDirty(int x, int y, int width, int height);
+
+// True while a stream is on, so the video task can skip marking
+extern volatile uint32 remote_streaming;
+
+static inline bool RemoteActive(void) { return remote_streaming != 0; }
+
+#else
+
+static inline void RemoteInit(void) {}
+static inline bool RemoteActive(void) { return false; }
+
+#endif
+
+#endif /* REMOTE_H */
@@ -0,0 +1,43 @@
+/*
+ *  rom_flash.h - ROM kept in a flash partition
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef ROM_FLASH_H
+#define ROM_FLASH_H
+
+#if ROM_FLASH
+
+// Read the ROM file (path, size and modification time) into buffer from
+// the copy in the "rom" partition. Returns false if the copy is of another
+// file, the card has to be read then.
+extern bool ROMFlashLoad(const char *path, uint32 size, uint32 mtime, uint8 *buffer);
+
+// Keep the ROM just read from the card in the partition for the next boots
+extern void ROMFlashStore(const char *path, uint32 size, uint32 mtime, const uint8 *buffer);
+
+// PatchROM() cache: read the patched image into ROMBaseHost and the host
+// state saved with it, if it was stored under this key
+extern bool ROMFlashLoadPatched(uint32 key, void *state, uint32 size);
+
+// Key and host state to save when ROMFlashMap() writes the patched image
+extern void ROMFlashSetPatchState(uint32 key, const void *state, uint32 size);
+
+// After InitAll() has patched the ROM: run it from the flash mapping of the
+// patched image and free the PSRAM copy. With install, a partition image
+// that differs is rewritten first (the settings changed); otherwise the
+// ROM stays in PSRAM.
+extern void ROMFlashMap(bool install);
+
+// Before the host writes to the ROM: move it back into PSRAM if it is
+// mapped from flash. Returns false if there is no PSRAM for it.
+extern bool ROMFlashUnmap(void);
+
+#else
+
+static inline bool ROMFlashUnmap(void) { return true; }
+
+#endif
+
+#endif /* ROM_FLASH_H */
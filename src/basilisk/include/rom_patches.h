@@ -52,5 +52,6 @@ extern bool PatchROM(void);
 extern void InstallDrivers(uint32 pb);
 extern void InstallSERD(void);
 extern void PatchAfterStartup(void);
+extern void ResetStartupPatches(void);
 
 #endif
@@ -0,0 +1,23 @@
+/*
+ *  rsrc_cache.h - Native GetResource() lookups with a cache
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef RSRC_CACHE_H
+#define RSRC_CACHE_H
+
+// Patch GetResource(), Get1Resource() and the traps that change resource
+// maps, unless the "nonativersrc" pref is set (called by PatchAfterStartup())
+extern void RsrcCacheInstall(void);
+
+// The system heap holding the stubs and the maps is gone (Mac reset)
+extern void RsrcCacheReset(void);
+
+// Handle M68K_EMUL_OP_RSRC_GET of the lookup stubs (d0 = trap selector)
+extern void RsrcCacheOp(M68kRegisters *r);
+
+// Handle M68K_EMUL_OP_RSRC_CHANGED: forget the cached lookups
+extern void RsrcCacheFlush(void);
+
+#endif
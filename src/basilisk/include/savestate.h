@@ -0,0 +1,52 @@
+/*
+ *  savestate.h - Machine state snapshots (hibernate/resume)
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef SAVESTATE_H
+#define SAVESTATE_H
+
+#if SAVE_STATE
+
+// Snapshot stream. Each module describes its state once with savestate_io();
+// the same function saves or restores it, depending on the stream direction.
+struct savestate;
+extern void savestate_io(savestate *s, void *data, uint32 size);
+extern bool savestate_loading(const savestate *s);
+extern void savestate_fail(savestate *s, const char *why);
+
+template <class T> static inline void savestate_var(savestate *s, T &v)
+{
+	savestate_io(s, &v, sizeof(v));
+}
+
+// Module state, defined next to the data it describes
+extern void CPUStateIO(savestate *s);			// newcpu.cpp: registers and control registers
+extern void FPUStateIO(savestate *s);			// fpu_ieee.cpp
+extern void TimerStateIO(savestate *s);			// timer.cpp: Time Manager tasks
+extern void ADBStateIO(savestate *s);			// adb.cpp
+extern void VideoStateIO(savestate *s);			// video.cpp: mode and palette of every monitor
+extern void SonyStateIO(savestate *s);			// sony.cpp
+extern void DiskStateIO(savestate *s);			// disk.cpp
+extern void CDROMStateIO(savestate *s);			// cdrom.cpp
+extern void QuickDrawStateIO(savestate *s);		// quickdraw_esp32.cpp
+extern void CursorStateIO(savestate *s);		// cursor_esp32.cpp
+
+// Ask for a snapshot at the next safe point (any task or core)
+extern void SaveStateRequest(void);
+
+// CPU task, from the tick check: take a requested snapshot and quit the
+// emulator. Returns true if a snapshot was attempted, even a failed one.
+extern bool SaveStatePoll(void);
+
+// Restore the snapshot after InitAll(), before Resume680x0(). Returns false
+// (with the machine untouched) when there is no usable snapshot.
+extern bool SaveStateRestore(void);
+
+// Delete the snapshot before a cold boot, which would make it stale
+extern void SaveStateDiscard(void);
+
+#endif
+
+#endif /* SAVESTATE_H */
@@ -0,0 +1,21 @@
+/*
+ *  sdcard.h - SD card file system (SDMMC 4-bit bus, SPI fallback)
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef SDCARD_H
+#define SDCARD_H
+
+#include <FS.h>
+
+// VFS path of the card, for stdio and POSIX file access
+#define SD_MOUNT_POINT "/sd"
+
+// Mount the card at /sd, on the SDMMC host if it answers there, else over SPI
+extern bool SDCardInit(void);
+
+// File system of the mounted card (SD_MMC or SD)
+extern fs::FS &SDCard(void);
+
+#endif
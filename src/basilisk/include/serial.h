@@ -50,6 +50,7 @@ extern void SerialInterrupt(void);
 // System specific and internal functions/data
 extern void SerialInit(void);
 extern void SerialExit(void);
+extern bool SerialUSBInUse(void);
 
 // Serial driver Deferred Task structure
 enum {
@@ -21,6 +21,8 @@
 #ifndef SLOT_ROM_H
 #define SLOT_ROM_H
 
+// Build the slot ROM without installing it, returns its data (or NULL)
+extern const uint8 *BuildSlotROM(int &size);
 extern bool InstallSlotROM(void);
 extern void ChecksumSlotROM(void);
 
@@ -0,0 +1,43 @@
+/*
+ *  sram_plan.h - Placement of the hot tables in internal SRAM
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef SRAM_PLAN_H
+#define SRAM_PLAN_H
+
+#include <stddef.h>
+#include <stdlib.h>
+
+// Flags of a slot
+#define SRAM_ONLY       1       // No PSRAM fallback: NULL when it does not get SRAM
+#define SRAM_STREAM     2       // Accessed in runs: weighed by bandwidth, not latency
+
+struct sram_slot;
+
+#if SRAM_PLAN
+
+// Register a table that wants internal SRAM, from a static initializer: its
+// size and benefit score, the accesses to it per 100 emulated instructions
+// (0: never worth SRAM, only listed in the plan)
+extern sram_slot *SramSlot(const char *name, size_t size, int score, int flags);
+
+// Once, before the tables are allocated: place the slots, highest score per
+// byte first (weighed by the time SRAM saves on an access, as measured with
+// SRAM_CALIBRATE), into the free internal SRAM less SRAM_PLAN_RESERVE, and
+// print the plan
+extern void SramPlan(void);
+
+// Allocate a slot's table where the plan put it, NULL if out of memory
+extern void *SramAlloc(sram_slot *slot, size_t size);
+
+#else
+
+static inline sram_slot *SramSlot(const char *, size_t, int, int) { return 0; }
+static inline void SramPlan(void) {}
+static inline void *SramAlloc(sram_slot *, size_t size) { return malloc(size); }
+
+#endif
+
+#endif /* SRAM_PLAN_H */
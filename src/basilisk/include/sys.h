@@ -76,4 +76,18 @@ extern void SysCDGetVolume(void *fh, uint8 &left, uint8 &right);
 // Periodic flush for sector cache - call from main loop
 extern void Sys_periodic_flush(void);
 
+// Write all cached disk writes to the card and wait for them
+extern void Sys_sync(void);
+
+// Asynchronous transfer, one at a time (false: not available, use Sys_read()/Sys_write())
+// INTFLAG_DISK is raised when it is done, SysIOResult() then returns the byte count
+extern bool SysStartIO(void *fh, bool write, void *buffer, loff_t offset, size_t length);
+extern bool SysIOResult(size_t *actual);
+extern size_t SysWaitIO(void);
+
+// Per-image request counters and latency histograms (DISK_TELEMETRY)
+extern void SysTelemetryDump(void);                 // Print them
+extern void SysTelemetryReset(void);                // Clear them
+extern void SysTelemetryReport(uint32 interval_ms); // One line of totals since the last call
+
 #endif
@@ -0,0 +1,86 @@
+/*
+ *  task_stats.h - Run slices and late wakeups of the Core 0 tasks
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef TASK_STATS_H
+#define TASK_STATS_H
+
+#if TASK_STATS
+
+#include <esp_timer.h>
+#include "perf_registry.h"
+
+// A wakeup this much later than the wait's timeout or the notification
+// counts as a stall (the task was ready, Core 0 was busy elsewhere)
+#define TASK_STALL_US   5000
+
+// One instrumented task. Its counters are registered as
+// "task.<name>.busy_us", "task.<name>.stalls" and "task.<name>.slice_us".
+struct task_stats {
+    const char *name;
+    perf_counter *busy_us;      // Time from each wakeup to the next wait
+    perf_counter *stalls;       // Wakeups later than TASK_STALL_US
+    perf_histogram *slice_us;   // Length of each run slice
+    uint32 start;               // Wakeup of the running slice (task only)
+    uint32 deadline;            // Timeout of the current wait, 0: none (task only)
+    volatile uint32 notified;   // First notification since the wait, 0: none
+};
+
+// Register a task, from a static initializer; returns a shared scratch
+// entry when the table is full
+extern task_stats *TaskStats(const char *name);
+
+// Registered tasks, in registration order
+extern int TaskStatsCount(void);
+extern task_stats *TaskStatsAt(int i);
+
+static inline uint32 task_stats_now(void)
+{
+    uint32 now = (uint32)esp_timer_get_time();
+    return now ? now : 1;       // 0 means "none"
+}
+
+// The task: before it blocks, with the timeout of the wait (0: none)
+static inline void task_wait(task_stats *t, uint32 timeout_ms)
+{
+    uint32 now = task_stats_now();
+    uint32 slice = now - t->start;
+    perf_add(t->busy_us, slice);
+    perf_record(t->slice_us, slice);
+    t->deadline = timeout_ms ? now + timeout_ms * 1000 : 0;
+    t->notified = 0;
+}
+
+// The task: after it woke up. It was due at its timeout or at the first
+// notification, whichever came first.
+static inline void task_run(task_stats *t)
+{
+    uint32 now = task_stats_now();
+    uint32 due = t->notified;
+    if (due == 0 || (t->deadline && (int32)(t->deadline - due) < 0))
+        due = t->deadline;
+    if (due && (int32)(now - due) > TASK_STALL_US)
+        perf_inc(t->stalls);
+    t->start = now;
+}
+
+// Whoever notifies the task, just before xTaskNotifyGive()
+static inline void task_notify(task_stats *t)
+{
+    if (t->notified == 0)
+        t->notified = task_stats_now();
+}
+
+#else
+
+struct task_stats;
+static inline task_stats *TaskStats(const char *) { return 0; }
+static inline void task_wait(task_stats *, uint32) {}
+static inline void task_run(task_stats *) {}
+static inline void task_notify(task_stats *) {}
+
+#endif
+
+#endif /* TASK_STATS_H */
@@ -0,0 +1,61 @@
+/*
+ *  telemetry.h - Log-scale histograms for the video and disk telemetry
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// Buckets are exact below 4 and have 4 sub-buckets per power of two above,
+// so a percentile is within 25% of the true value. 80 buckets reach 1.8s.
+#define TELEMETRY_BUCKETS 80
+
+struct telemetry_histogram {
+    uint32 count[TELEMETRY_BUCKETS];
+    uint32 samples;
+    uint32 max;
+};
+
+/*
+ *  Histogram bucket of a value, and the smallest value of a bucket
+ */
+static inline int telemetry_bucket(uint32 v)
+{
+    if (v < 4) return v;
+    int e = 31 - __builtin_clz(v);
+    int b = 4 * (e - 1) + ((v >> (e - 2)) & 3);
+    return (b < TELEMETRY_BUCKETS) ? b : TELEMETRY_BUCKETS - 1;
+}
+
+static inline uint32 telemetry_bucket_low(int b)
+{
+    if (b < 4) return b;
+    return (uint32)(4 + b % 4) << (b / 4 - 1);
+}
+
+static inline void telemetry_record(telemetry_histogram &h, uint32 v)
+{
+    h.count[telemetry_bucket(v)]++;
+    h.samples++;
+    if (v > h.max) h.max = v;
+}
+
+/*
+ *  Upper bound of the bucket holding the given percentile of the samples
+ */
+static inline uint32 telemetry_percentile(const telemetry_histogram &h, uint32 percent)
+{
+    uint32 rank = (uint32)(((uint64)h.samples * percent + 99) / 100);
+    uint32 seen = 0;
+    for (int b = 0; b < TELEMETRY_BUCKETS - 1; b++) {
+        seen += h.count[b];
+        if (seen >= rank) {
+            uint32 high = telemetry_bucket_low(b + 1) - 1;
+            return (high < h.max) ? high : h.max;
+        }
+    }
+    return h.max;
+}
+
+#endif
@@ -0,0 +1,35 @@
+/*
+ *  usb_msc.h - Disk images on a USB flash drive or SSD
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef USB_MSC_H
+#define USB_MSC_H
+
+// VFS path of the USB drive; disk and cdrom prefs starting with it are
+// opened there instead of on the SD card
+#define USB_MOUNT_POINT "/usb"
+
+#if USB_MSC_HOST
+
+// Start the USB mass storage driver if a disk or cdrom pref names an image
+// on the USB drive (called by SysInit(), before the disks are opened)
+extern void UsbMscInit(void);
+
+// True if the image path is on the USB drive
+extern bool UsbMscPath(const char *name);
+
+// Wait for the drive to be mounted, at most USB_MSC_WAIT_MS the first time
+// and not at all once that has expired; true when it is mounted
+extern bool UsbMscReady(void);
+
+#else
+
+static inline void UsbMscInit(void) {}
+static inline bool UsbMscPath(const char *) { return false; }
+static inline bool UsbMscReady(void) { return false; }
+
+#endif
+
+#endif /* USB_MSC_H */
@@ -179,6 +179,11 @@ public:
 	int16 driver_control(uint16 code, uint32 param, uint32 dce);
 	int16 driver_status(uint16 code, uint32 param);
 
+#if SAVE_STATE
+	// Save or restore the driver state (hibernate/resume, see savestate.cpp)
+	void state_io(struct savestate *s);
+#endif
+
 protected:
 	vector<video_mode> modes;                         // List of supported video modes
 	vector<video_mode>::const_iterator current_mode;  // Currently selected video mode
@@ -274,11 +279,25 @@ extern void VideoQuitFullScreen(void);
 extern void VideoInterrupt(void);
 extern void VideoRefresh(void);
 extern void VideoSignalFrameReady(void);  // Signal video task that a new frame is ready (non-blocking)
+extern void VideoSetPaused(bool paused);  // Stop/restart display updates (CPU benchmark)
+extern void VideoTelemetryDump(void);     // Print the frame time histograms (VIDEO_TELEMETRY)
+extern void VideoTelemetryReset(void);    // Clear them at the start of the next frame
 
 // Write-time dirty tracking for framebuffer - called from memory.cpp on writes
 // These mark tiles dirty immediately when CPU writes to framebuffer, avoiding
 // expensive per-frame comparison
 extern void VideoMarkDirtyOffset(uint32 offset);     // Mark single byte dirty
 extern void VideoMarkDirtyRange(uint32 offset, uint32 size);  // Mark range dirty
+extern void VideoMarkDirtyRect(uint32 offset, uint32 width, uint32 height, uint32 row_bytes);  // Mark rectangle dirty
+extern void VideoMarkDirtyPixels(int x, int y, int w, int h);  // Mark rectangle of Mac pixels dirty
+extern void VideoScrollRect(uint32 offset, uint32 width, uint32 height, uint32 row_bytes, int dy);  // Rectangle moved down by dy rows
+
+// Cursor overlay (USE_CURSOR_OVERLAY): 16x16 black and white cursor with its
+// top left corner at Mac pixel (x, y), composited by the video task
+extern void VideoSetCursor(const uint16 *data, const uint16 *mask, int x, int y, bool visible);
+
+// Render assist (USE_RENDER_ASSIST): the CPU task, woken in idle_wait(),
+// converts half a band for the video task; true if it converted one
+extern bool VideoAssist(void);
 
 #endif
@@ -37,5 +37,8 @@ extern void XPRAMExit(void);
 extern void LoadXPRAM(const char *vmdir);
 extern void SaveXPRAM(void);
 extern void ZapPRAM(void);
+#if XPRAM_NVS
+extern void XPRAMPoll(uint32 now_ms);	// Commit settled changes to NVS (service task)
+#endif
 
 #endif
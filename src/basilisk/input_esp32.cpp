@@ -15,12 +15,18 @@
 #include "input.h"
 #include "adb.h"
 #include "video.h"
+#include "savestate.h"
+#include "prefs.h"
+#include "console.h"
+#include "hud.h"
+#include "task_stats.h"
 
 #include <M5Unified.h>
 #include <EspUsbHost.h>
 #include "esp_attr.h"  // For DRAM_ATTR
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 
 #define DEBUG 0
 #include "debug.h"
@@ -31,11 +37,27 @@
 #define INPUT_TASK_STACK_SIZE 4096
 #define INPUT_TASK_PRIORITY   1
 #define INPUT_TASK_CORE       0  // Run on Core 0, leaving Core 1 for CPU emulation
-#define INPUT_POLL_INTERVAL_MS 16  // 60Hz polling
+#define INPUT_POLL_INTERVAL_MS 16  // 60Hz polling of buttons and LEDs
+#define TOUCH_POLL_INTERVAL_MS 8   // Touch panel sampling, at the GT911 report rate
+#define INPUT_USB_MIN_WAIT_US  1000 // usbHost->task() returning sooner did not block
+#define INPUT_INJECT_QUEUE     32   // Scripted events waiting for the input task
+
+// Poll intervals, "inputpollms" and "touchpollms" prefs of a performance profile
+static volatile uint32 input_poll_ms = INPUT_POLL_INTERVAL_MS;
+static volatile uint32 touch_poll_ms = TOUCH_POLL_INTERVAL_MS;
 
 static TaskHandle_t input_task_handle = NULL;
 static volatile bool input_task_running = false;
 
+// Scripted events from the console, posted by the input task (the only
+// producer of ADB events)
+struct input_inject_event {
+    uint8_t type;
+    uint8_t code;
+    int16_t x, y;
+};
+static QueueHandle_t inject_queue = NULL;
+
 // ============================================================================
 // USB HID Scancode to Mac ADB Keycode Translation Table
 // ============================================================================
@@ -248,9 +270,10 @@ static bool keyboard_enabled = true;
 
 // Touch state
 static bool touch_was_pressed = false;
-static bool touch_pending_click = false;  // Defer click until cursor has moved
 static int last_touch_x = 0;
 static int last_touch_y = 0;
+static bool touch_hud_toggled = false;  // HUD flipped by this touch's second finger
+static task_stats *const input_task_stats = TaskStats("input");
 
 // USB device connection state
 static bool keyboard_connected = false;
@@ -557,7 +580,9 @@ static void convertTouchToMac(int touch_x, int touch_y, int *mac_x, int *mac_y)
 
 /*
  *  Process touch panel input
- *  Called from InputPoll() to handle touch events
+ *  Called every touch_poll_ms from the input task. Every sample is
+ *  posted: ADBInterrupt() collects them into the latest position per
+ *  interrupt and holds a click until the cursor has reached it.
  */
 static void processTouchInput(void)
 {
@@ -567,6 +592,19 @@ static void processTouchInput(void)
     auto touch_detail = M5.Touch.getDetail();
     
     bool is_pressed = touch_detail.isPressed();
+    
+#if PERF_HUD
+    // A second finger flips the performance HUD, once per touch
+    if (is_pressed && M5.Touch.getCount() >= 2) {
+        if (!touch_hud_toggled) {
+            HudToggle();
+            touch_hud_toggled = true;
+        }
+    } else if (!is_pressed) {
+        touch_hud_toggled = false;
+    }
+#endif
+    
     int touch_x = touch_detail.x;
     int touch_y = touch_detail.y;
     
@@ -580,23 +618,11 @@ static void processTouchInput(void)
             ADBSetRelMouseMode(false);
             touch_was_pressed = true;
             
-            // Move cursor to touch position first
+            // Move cursor to touch position, then press
             ADBMouseMoved(mac_x, mac_y);
-            
-            // Defer the click until next poll cycle to ensure cursor has moved
-            // This prevents the "click before move" issue where the Mac processes
-            // the button event before the cursor position update takes effect
-            touch_pending_click = true;
+            ADBMouseDown(0);
         } else {
-            // Check if we have a pending click from the previous cycle
-            if (touch_pending_click) {
-                // Now that cursor position has been processed, send the click
-                ADBMouseDown(0);
-                touch_pending_click = false;
-            }
-            
             // Touch is being held/dragged
-            // Only update if position changed significantly (reduce noise)
             int dx = mac_x - last_touch_x;
             int dy = mac_y - last_touch_y;
             if (dx != 0 || dy != 0) {
@@ -609,18 +635,40 @@ static void processTouchInput(void)
     } else {
         if (touch_was_pressed) {
             // Touch just released
-            // If there was a pending click that never got sent (very quick tap),
-            // send click and release together
-            if (touch_pending_click) {
-                ADBMouseDown(0);
-                touch_pending_click = false;
-            }
             ADBMouseUp(0);
             touch_was_pressed = false;
         }
     }
 }
 
+/*
+ *  Post the scripted events queued by InputInject()
+ */
+static void processInjectedInput(void)
+{
+    input_inject_event e;
+    while (inject_queue != NULL && xQueueReceive(inject_queue, &e, 0) == pdTRUE) {
+        switch (e.type) {
+        case INPUT_INJECT_MOVE:
+            ADBSetRelMouseMode(false);
+            ADBMouseMoved(e.x, e.y);
+            break;
+        case INPUT_INJECT_BUTTON_DOWN:
+            ADBMouseDown(e.code);
+            break;
+        case INPUT_INJECT_BUTTON_UP:
+            ADBMouseUp(e.code);
+            break;
+        case INPUT_INJECT_KEY_DOWN:
+            ADBKeyDown(e.code);
+            break;
+        case INPUT_INJECT_KEY_UP:
+            ADBKeyUp(e.code);
+            break;
+        }
+    }
+}
+
 /*
  *  Check and update keyboard LED state
  */
@@ -651,33 +699,71 @@ static void updateKeyboardLEDs(void)
 // ============================================================================
 
 /*
- *  Input polling task - runs on Core 0 independently of CPU emulation
- *  This offloads the ~2.3ms USB host processing from the CPU emulation loop
+ *  Input task - runs on Core 0 independently of CPU emulation
+ *
+ *  USB reports are handled as they arrive: usbHost->task() blocks in the USB
+ *  host library's event waits and runs the report callbacks, which post
+ *  straight into the ADB event queue, so a key or mouse report reaches the
+ *  Mac within a millisecond or two instead of up to a poll interval later.
+ *  The task sleeps in those waits between reports. In between, the touch
+ *  panel is sampled every touch_poll_ms, and the buttons and the keyboard
+ *  LEDs are polled every input_poll_ms, and the events scripted on the
+ *  console (InputInject()) are posted on every pass.
+ *  This task is the only producer of ADB events while it runs.
  */
 static void inputTask(void *param)
 {
     (void)param;
     Serial.println("[INPUT] Input task started on Core 0");
+    task_run(input_task_stats);
     
-    const TickType_t poll_interval = pdMS_TO_TICKS(INPUT_POLL_INTERVAL_MS);
+    uint32_t last_poll = millis() - input_poll_ms;
+    uint32_t last_touch_poll = last_poll;
     
     while (input_task_running) {
-        // Update M5 library (touch, buttons, etc.)
-        M5.update();
+        uint32_t now = millis();
+        if (now - last_touch_poll >= touch_poll_ms) {
+            last_touch_poll = now;
+            
+            // Sample the touch panel on its own, faster cadence
+            if (M5.Touch.isEnabled()) {
+                M5.Touch.update(now);
+            }
+            processTouchInput();
+        }
+        processInjectedInput();
         
-        // Process touch input
-        processTouchInput();
+        if (now - last_poll >= input_poll_ms) {
+            last_poll = now;
+            
+            // Update M5 library (touch, buttons, etc.)
+            M5.update();
+            
+#if SAVE_STATE
+            // A click on the power button hibernates (the CPU task writes the snapshot)
+            if (M5.BtnPWR.wasClicked()) {
+                SaveStateRequest();
+            }
+#endif
+            
+            // Update keyboard LEDs (Caps Lock, etc.)
+            updateKeyboardLEDs();
+        }
         
-        // Process USB Host events (this is the slow part ~2ms)
+        // Wait for USB Host events and handle them
+        // The report callbacks run inside usbHost->task(), counted as waiting
+        task_wait(input_task_stats, usbHost != NULL ? 0 : touch_poll_ms);
         if (usbHost != NULL) {
+            uint32_t t0 = micros();
             usbHost->task();
+            if (micros() - t0 < INPUT_USB_MIN_WAIT_US) {
+                // Nothing blocked, let lower priority tasks on Core 0 run
+                vTaskDelay(1);
+            }
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(touch_poll_ms));
         }
-        
-        // Update keyboard LEDs (Caps Lock, etc.)
-        updateKeyboardLEDs();
-        
-        // Wait until next poll interval
-        vTaskDelay(poll_interval);
+        task_run(input_task_stats);
     }
     
     Serial.println("[INPUT] Input task exiting");
@@ -701,7 +787,6 @@ bool InputInit(void)
     
     // Initialize touch state
     touch_was_pressed = false;
-    touch_pending_click = false;
     last_touch_x = 0;
     last_touch_y = 0;
     
@@ -709,6 +794,14 @@ bool InputInit(void)
     last_led_state = 0;
     last_led_check_time = 0;
     
+    // Poll intervals set by the performance profile, if any
+    if (PrefsFindInt32("inputpollms") > 0)
+        input_poll_ms = PrefsFindInt32("inputpollms");
+    if (PrefsFindInt32("touchpollms") > 0)
+        touch_poll_ms = PrefsFindInt32("touchpollms");
+    ConsoleAddTunable("inputpollms", &input_poll_ms, 1, 1000);
+    ConsoleAddTunable("touchpollms", &touch_poll_ms, 1, 1000);
+    
     // Set mouse to absolute mode for touch input (USB mouse will switch to relative)
     ADBSetRelMouseMode(false);
     
@@ -724,6 +817,8 @@ bool InputInit(void)
         Serial.println("[INPUT] ERROR: Failed to create USB Host instance");
     }
     
+    inject_queue = xQueueCreate(INPUT_INJECT_QUEUE, sizeof(input_inject_event));
+    
     // Start input polling task on Core 0
     // This offloads input processing from the CPU emulation loop
     input_task_running = true;
@@ -761,7 +856,6 @@ void InputExit(void)
     
     // Release any held buttons
     if (touch_was_pressed) {
-        touch_pending_click = false;
         ADBMouseUp(0);
         touch_was_pressed = false;
     }
@@ -773,6 +867,18 @@ void InputExit(void)
     }
 }
 
+bool InputInject(int type, int code, int x, int y)
+{
+    if (!input_task_running || inject_queue == NULL)
+        return false;
+    input_inject_event e;
+    e.type = (uint8_t)type;
+    e.code = (uint8_t)code;
+    e.x = (int16_t)x;
+    e.y = (int16_t)y;
+    return xQueueSend(inject_queue, &e, 0) == pdTRUE;
+}
+
 void InputPoll(void)
 {
     // Process touch input
@@ -798,9 +904,6 @@ void InputSetTouchEnabled(bool enabled)
 {
     touch_enabled = enabled;
     if (!enabled && touch_was_pressed) {
-        if (touch_pending_click) {
-            touch_pending_click = false;
-        }
         ADBMouseUp(0);
         touch_was_pressed = false;
     }
@@ -821,6 +924,39 @@ bool InputIsMouseConnected(void)
     return mouse_connected;
 }
 
+#if INPUT_TELEMETRY
+/*
+ *  Print the input latency percentiles (us from posting an event on Core 0
+ *  to handing it to the Mac, touch samples are up to TOUCH_POLL_INTERVAL_MS
+ *  older than that)
+ */
+void InputTelemetryDump(void)
+{
+    static const char *names[ADB_LATENCY_COUNT] = {"move", "button", "key"};
+    for (int i = 0; i < ADB_LATENCY_COUNT; i++) {
+        const telemetry_histogram &h = *ADBLatency(i);
+        if (h.samples == 0) continue;
+        Serial.printf("[INPUT TELEMETRY] %-6s n=%-7u p50=%-6u p95=%-6u p99=%-6u max=%u\n",
+                      names[i], h.samples, telemetry_percentile(h, 50),
+                      telemetry_percentile(h, 95), telemetry_percentile(h, 99), h.max);
+    }
+    // Posted to the screen showing the Mac's response
+    for (int i = 0; i < ADB_LATENCY_COUNT; i++) {
+        const telemetry_histogram &h = *VideoPhotonLatency(i);
+        if (h.samples == 0) continue;
+        Serial.printf("[INPUT TELEMETRY] %-6s photon n=%-7u p50=%-6u p95=%-6u p99=%-6u max=%u\n",
+                      names[i], h.samples, telemetry_percentile(h, 50),
+                      telemetry_percentile(h, 95), telemetry_percentile(h, 99), h.max);
+    }
+}
+
+void InputTelemetryReset(void)
+{
+    ADBLatencyReset();
+    VideoPhotonReset();
+}
+#endif
+
 // ============================================================================
 // Legacy functions (kept for compatibility, now handled via EspUsbHost callbacks)
 // ============================================================================
@@ -180,6 +180,11 @@ bool InitAll(const char *vmdir)
 	XPRAM[0x58] = uint8(main_monitor.depth_to_apple_mode(main_monitor.get_current_mode().depth));
 	XPRAM[0x59] = 0;
 
+#if PARALLEL_BOOT
+	// Nothing before this point touches Mac RAM
+	WaitRAMCleared();
+#endif
+
 #if EMULATED_68K
 	// Init 680x0 emulation (this also activates the memory system which is needed for PatchROM())
 	if (!Init680x0())
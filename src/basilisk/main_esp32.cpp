@@ -12,15 +12,22 @@
 
 #include <M5Unified.h>
 #include <M5GFX.h>
-#include <SD.h>
 #include <esp_heap_caps.h>
 
 // FreeRTOS for dual-core support and timers
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/timers.h"
+#include "freertos/semphr.h"
+#include <esp_timer.h>
 
 #include "cpu_emulation.h"
+#if WARM_RESTART
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#endif
 #include "sys.h"
 #include "rom_patches.h"
 #include "xpram.h"
@@ -32,6 +39,23 @@
 #include "macos_util.h"
 #include "user_strings.h"
 #include "input.h"
+#include "adb.h"
+#include "pc_profiler.h"
+#include "trap_profile.h"
+#include "trace_ring.h"
+#include "cpu_bench.h"
+#include "cpu_check.h"
+#include "savestate.h"
+#include "sdcard.h"
+#include "serial.h"
+#include "rom_flash.h"
+#include "console.h"
+#include "perf_registry.h"
+#include "hud.h"
+#include "sram_plan.h"
+#include "power.h"
+#include "task_stats.h"
+#include "app_profile.h"
 
 #define DEBUG 1
 #include "debug.h"
@@ -66,76 +90,211 @@ uint32 InterruptFlags = 0;
 void basilisk_loop(void);
 
 // CPU tick counter for timing (used by newcpu.cpp)
-// With video rendering offloaded to Core 0, we can use a much higher quantum
-// Higher quantum = less frequent periodic checks = faster emulation
-// Increased to 40000 with 15fps video for maximum emulation performance
-int32 emulated_ticks = 40000;
-static int32 emulated_ticks_quantum = 40000;
+// The quantum is resized after every basilisk_loop call so that the loop runs
+// every quantum_target_us of emulation time whatever the instruction mix
+// (a fixed 40000 instructions took anywhere between 13ms and 30ms)
+#define QUANTUM_TARGET_US   2000        // Default, "quantumus" pref
+#define QUANTUM_MIN         1000
+#define QUANTUM_MAX         100000
+#define QUANTUM_PENDING     500         // Next check while an interrupt waits
+static volatile uint32 quantum_target_us = QUANTUM_TARGET_US;
+int32 emulated_ticks = 4000;
+static int32 emulated_ticks_quantum = 4000;     // Adaptive, see cpu_do_check_ticks()
+static int32 emulated_ticks_running = 4000;     // Quantum of the current run
+static uint32 quantum_start_us = 0;
 
 // ============================================================================
 // IPS (Instructions Per Second) Monitoring
 // ============================================================================
-// These counters track emulated 68k instructions for performance measurement
-static volatile uint64_t ips_total_instructions = 0;    // Total instructions executed
-static volatile uint64_t ips_last_instructions = 0;     // Instructions at last report
-static volatile uint32_t ips_last_report_time = 0;      // Time of last IPS report
-static volatile uint32_t ips_current = 0;               // Most recent IPS measurement
+// Emulated 68k instructions, counted in the registry once per quantum
+static perf_counter *const perf_instructions = PerfCounter("cpu.instructions", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_quantum = PerfCounter("cpu.quantum", PERF_GAUGE, PERF_CORE_CPU);
+static perf_counter *const perf_ips = PerfCounter("cpu.ips", PERF_GAUGE, PERF_CORE_IO);
+static uint64_t ips_total_instructions = 0;             // Total at the last report
+static uint32_t ips_last_instructions = 0;              // perf_instructions at the last report
+static uint32_t ips_last_report_time = 0;               // Time of last IPS report
 #define IPS_REPORT_INTERVAL_MS 5000                     // Report IPS every 5 seconds
 
 /*
  *  CPU tick check - called periodically during emulation
  *  
- *  This is called every emulated_ticks_quantum instructions (40000 by default).
- *  We use this to:
+ *  This is called every emulated_ticks_quantum instructions (sized for one
+ *  call every quantum_target_us). We use this to:
  *  1. Count instructions for IPS monitoring
  *  2. Handle periodic tasks (60Hz, video, input, etc.)
+ *  3. Size the next quantum from the measured emulation time
  */
 void cpu_do_check_ticks(void)
 {
-    // Count instructions executed since last tick check
-    // This is the number of instructions in one quantum
-    ips_total_instructions += emulated_ticks_quantum;
+    // Instructions actually executed: the quantum plus the last batch overrun
+    int32 executed = emulated_ticks_running - emulated_ticks;
+    uint32 cpu_us = micros() - quantum_start_us;
+    perf_add(perf_instructions, executed);
     
     // Call basilisk_loop to handle periodic tasks
     basilisk_loop();
     
+    // Move the quantum a quarter of the way towards the size that would
+    // have taken quantum_target_us, so one slow ROM call does not whipsaw it
+    if (cpu_us > 0 && executed > 0) {
+        int32 ideal = (int32)(((int64_t)executed * quantum_target_us) / cpu_us);
+        emulated_ticks_quantum += (ideal - emulated_ticks_quantum) / 4;
+        if (emulated_ticks_quantum < QUANTUM_MIN)
+            emulated_ticks_quantum = QUANTUM_MIN;
+        else if (emulated_ticks_quantum > QUANTUM_MAX)
+            emulated_ticks_quantum = QUANTUM_MAX;
+        perf_set(perf_quantum, emulated_ticks_quantum);
+    }
+    
+    // An interrupt the 68k has not taken yet (masked, or raised by another
+    // core without TriggerInterrupt) is looked at again soon
+    emulated_ticks_running = InterruptFlags ? QUANTUM_PENDING : emulated_ticks_quantum;
+    
     // Reset tick counter
-    emulated_ticks = emulated_ticks_quantum;
+    emulated_ticks = emulated_ticks_running;
+    quantum_start_us = micros();
 }
 
 /*
  *  Report IPS (Instructions Per Second) statistics
- *  Called from basilisk_loop periodically
+ *  Called from housekeeping() periodically
  */
 static void reportIPSStats(uint32 current_time)
 {
     if (current_time - ips_last_report_time >= IPS_REPORT_INTERVAL_MS) {
-        uint64_t instructions_delta = ips_total_instructions - ips_last_instructions;
+        uint32_t instructions_delta = perf_delta(perf_instructions, ips_last_instructions);
         uint32_t time_delta_ms = current_time - ips_last_report_time;
+        ips_total_instructions += instructions_delta;
         
         if (time_delta_ms > 0) {
             // Calculate IPS (instructions per second)
             // Use 64-bit math to avoid overflow
-            ips_current = (uint32_t)((instructions_delta * 1000ULL) / time_delta_ms);
+            uint32_t ips = (uint32_t)((instructions_delta * 1000ULL) / time_delta_ms);
+            perf_set(perf_ips, ips);
             
             // Report in MIPS (millions of instructions per second) for readability
-            float mips = ips_current / 1000000.0f;
+            float mips = ips / 1000000.0f;
             
-            Serial.printf("[IPS] %u instructions/sec (%.2f MIPS), total: %llu\n", 
-                          ips_current, mips, ips_total_instructions);
+            if (ConsoleReports())
+                Serial.printf("[IPS] %u instructions/sec (%.2f MIPS), total: %llu, quantum: %d\n", 
+                              ips, mips, ips_total_instructions, emulated_ticks_quantum);
         }
         
-        ips_last_instructions = ips_total_instructions;
         ips_last_report_time = current_time;
     }
 }
 
+#if PC_PROFILER || TRACE_RING || SAVE_STATE || VIDEO_TELEMETRY || DISK_TELEMETRY || INPUT_TELEMETRY || INPUT_REPLAY || MEM_PROFILE
+/*
+ *  Serial debug commands (a line of one character on the console, see
+ *  console_esp32.cpp, or a single keystroke without SERIAL_CONSOLE):
+ *    PC profiler: 'p' dumps the histograms, 'r' clears them
+ *    Trace ring:  't' records PCs, 'T' PCs and registers, 'x' stops, 'f' writes it to SD
+ *    Save state:  'h' hibernates to SD
+ *    Video:       'v' dumps the frame time histograms, 'V' clears them
+ *    Disk:        'd' dumps the per-image request counters, 'D' clears them
+ *    Input:       'i' dumps the input latency histograms, 'I' clears them,
+ *                 'e' records input events, 'E' writes them to SD, 'y' replays them
+ *    Memory:      'm' dumps the memory access profile, 'M' clears it
+ */
+static int nextDebugCommand(void)
+{
+#if SERIAL_CONSOLE
+    return ConsoleNextCommand();
+#else
+    return Serial.available() > 0 ? Serial.read() : -1;
+#endif
+}
+
+static void pollDebugCommands(void)
+{
+    int c;
+    while ((c = nextDebugCommand()) >= 0) {
+        switch (c) {
+#if PC_PROFILER
+        case 'p':
+            pc_profiler_dump();
+            break;
+        case 'r':
+            pc_profiler_reset();
+            break;
+#endif
+#if TRACE_RING
+        case 't':
+            trace_ring_arm(1);
+            break;
+        case 'T':
+            trace_ring_arm(2);
+            break;
+        case 'x':
+            trace_ring_arm(0);
+            break;
+        case 'f':
+            trace_ring_flush();
+            break;
+#endif
+#if SAVE_STATE
+        case 'h':
+            SaveStateRequest();
+            break;
+#endif
+#if VIDEO_TELEMETRY
+        case 'v':
+            VideoTelemetryDump();
+            break;
+        case 'V':
+            VideoTelemetryReset();
+            break;
+#endif
+#if DISK_TELEMETRY
+        case 'd':
+            SysTelemetryDump();
+            break;
+        case 'D':
+            SysTelemetryReset();
+            break;
+#endif
+#if INPUT_TELEMETRY
+        case 'i':
+            InputTelemetryDump();
+            break;
+        case 'I':
+            InputTelemetryReset();
+            break;
+#endif
+#if INPUT_REPLAY
+        case 'e':
+            ADBRecordStart();
+            break;
+        case 'E':
+            ADBRecordStop();
+            break;
+        case 'y':
+            ADBReplayStart();
+            break;
+#endif
+#if MEM_PROFILE
+        case 'm':
+            MemProfileDump();
+            break;
+        case 'M':
+            MemProfileReset();
+            break;
+#endif
+        }
+    }
+#if TRACE_RING
+    trace_ring_service();
+#endif
+}
+#endif
+
 /*
  *  Get current IPS measurement (for external use)
  */
 uint32_t getEmulatorIPS(void)
 {
-    return ips_current;
+    return perf_ips->value;
 }
 
 /*
@@ -152,16 +311,39 @@ static uint32 last_60hz_time = 0;
 static uint32 last_second_time = 0;
 static uint32 last_video_signal = 0;
 static uint32 last_disk_flush_time = 0;
+static bool resumed = false;            // Machine state restored from a snapshot
+#if WARM_RESTART
+static volatile bool restart_requested = false;
+extern bool quit_program;
+#endif
 
-// Video signal interval (ms) - how often to signal video task
-// The video task runs at its own pace, this just triggers buffer swap
-#define VIDEO_SIGNAL_INTERVAL 42  // ~24 FPS
+// Video signal interval (ms) - how often to look for screen changes
+// The video task is only signalled when there are any, and paces itself
+// (60 FPS for small updates, 24 FPS for large ones)
+#define VIDEO_SIGNAL_INTERVAL 16  // Default, "videoms" pref
+static volatile uint32 video_signal_interval = VIDEO_SIGNAL_INTERVAL;
 
 // Disk flush interval (ms) - how often to flush write buffer to SD card
-#define DISK_FLUSH_INTERVAL 2000  // 2 seconds
+#define DISK_FLUSH_INTERVAL 2000  // 2 seconds, "diskflushms" pref
+static volatile uint32 disk_flush_interval = DISK_FLUSH_INTERVAL;
+
+// Service task: video signals, disk flushes and reports on Core 0
+#define SERVICE_TASK_STACK_SIZE 4096
+#define SERVICE_TASK_PRIORITY   1
+#define SERVICE_TASK_CORE       0
+static TaskHandle_t service_task_handle = NULL;
+static task_stats *const service_task_stats = TaskStats("service");
+static volatile bool debug_poll_due = false;    // Set by each service pass, cleared by the CPU task
+static void startServiceTask(void);
+static void stopServiceTask(void);
 
-// FreeRTOS timer for 60Hz tick
-static TimerHandle_t timer_60hz = NULL;
+#if HARDWARE_TICK
+// Periodic esp_timer for the 60Hz and 1Hz interrupts
+#define TICK_PERIOD_US      16667
+static esp_timer_handle_t tick_timer = NULL;
+static volatile uint32 last_tick_us = 0;        // Time of the last 60Hz tick
+static uint64_t next_second_us = 0;             // Due time of the next 1Hz tick (timer task only)
+#endif
 
 // NOTE: Input polling is now handled by a dedicated task on Core 0
 // See input_esp32.cpp inputTask()
@@ -169,60 +351,112 @@ static TimerHandle_t timer_60hz = NULL;
 // ============================================================================
 // Performance profiling counters for main loop
 // ============================================================================
-static uint32 perf_loop_count = 0;           // Number of basilisk_loop calls
-static uint32 perf_flush_us = 0;             // Time spent in disk flush
-static uint32 perf_flush_count = 0;          // Number of flushes
+static perf_counter *const perf_loops = PerfCounter("main.loops", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_flushes = PerfCounter("main.flushes", PERF_COUNT, PERF_CORE_IO);
+static perf_counter *const perf_flush_us = PerfCounter("main.flush_us", PERF_COUNT, PERF_CORE_IO);
 // NOTE: Input polling stats removed - input now runs on Core 0 task
 static uint32 perf_main_last_report = 0;     // Last time stats were printed
+static uint32 perf_last_loops = 0;           // Counters at the last report
+static uint32 perf_last_flushes = 0;
+static uint32 perf_last_flush_us = 0;
 #define PERF_MAIN_REPORT_INTERVAL_MS 5000    // Report every 5 seconds
 
 /*
- *  Set/clear interrupt flags (thread-safe using atomic operations)
+ *  Set/clear interrupt flags
+ *
+ *  InterruptFlags is the mailbox between interrupt sources (input and video
+ *  tasks on Core 0, the main loop on the CPU task) and the CPU core. Setting
+ *  releases whatever the source prepared for its handler; the CPU reads the
+ *  flags with acquire ordering once per batch and clears them in one go in
+ *  the IRQ EmulOp.
  */
 void SetInterruptFlag(uint32 flag)
 {
-    // Use atomic OR for thread safety (called from timer callback on different core)
-    __atomic_or_fetch(&InterruptFlags, flag, __ATOMIC_SEQ_CST);
+    __atomic_or_fetch(&InterruptFlags, flag, __ATOMIC_RELEASE);
+    
+    // Wake the CPU task if it is sleeping in idle_wait()
+    idle_resume();
 }
 
 void ClearInterruptFlag(uint32 flag)
 {
-    // Use atomic AND for thread safety
-    __atomic_and_fetch(&InterruptFlags, ~flag, __ATOMIC_SEQ_CST);
+    // Still an atomic AND: sources on Core 0 may be setting other bits
+    __atomic_and_fetch(&InterruptFlags, ~flag, __ATOMIC_RELAXED);
 }
 
 /*
- *  Handle 60Hz tick - called from main loop at safe points
- *  Using polling instead of FreeRTOS timer to avoid race conditions
+ *  Handle 60Hz tick
+ *
+ *  With HARDWARE_TICK this runs in the esp_timer task on Core 0. It only
+ *  posts to InterruptFlags, which the CPU task looks at every batch, so the
+ *  interrupt is taken within a few instructions whatever the quantum is
+ *  doing. Without it, basilisk_loop() polls it at the end of each quantum.
  */
+static void handle_1hz_tick(void);
+
 static void handle_60hz_tick(void)
 {
-    // Set 60Hz interrupt flag
-    SetInterruptFlag(INTFLAG_60HZ);
-    
-    // Handle ADB (mouse/keyboard) updates
-    SetInterruptFlag(INTFLAG_ADB);
+    // Set 60Hz interrupt flag; ADB only while input events are waiting (the
+    // input task raises it for each new one)
+    SetInterruptFlag(ADBPending() ? INTFLAG_60HZ | INTFLAG_ADB : INTFLAG_60HZ);
     
     // Trigger interrupt in CPU emulation
     TriggerInterrupt();
 }
 
+#if HARDWARE_TICK
+// esp_timer callback: the 1Hz tick follows the wall clock, not a tick count
+static void tick_timer_func(void *arg)
+{
+    uint64_t now = esp_timer_get_time();
+    last_tick_us = (uint32)now;
+    handle_60hz_tick();
+    if (now >= next_second_us) {
+        next_second_us += 1000000;
+        if (next_second_us <= now)
+            next_second_us = now + 1000000;
+        handle_1hz_tick();
+    }
+}
+#endif
+
 /*
- *  Start the 60Hz timer (now uses polling in main loop)
+ *  Start the 60Hz timer
  */
 static bool start60HzTimer(void)
 {
-    // No timer creation needed - we use polling now
-    Serial.println("[MAIN] 60Hz using polling mode (safer)");
+#if HARDWARE_TICK
+    esp_timer_create_args_t args = {};
+    args.callback = tick_timer_func;
+    args.name = "60Hz";
+    if (esp_timer_create(&args, &tick_timer) != ESP_OK)
+        return false;
+    last_tick_us = (uint32)esp_timer_get_time();
+    next_second_us = esp_timer_get_time() + 1000000;
+    if (esp_timer_start_periodic(tick_timer, TICK_PERIOD_US) != ESP_OK) {
+        esp_timer_delete(tick_timer);
+        tick_timer = NULL;
+        return false;
+    }
+    Serial.println("[MAIN] 60Hz tick from esp_timer");
+#else
+    Serial.println("[MAIN] 60Hz using polling mode");
+#endif
     return true;
 }
 
 /*
- *  Stop the 60Hz timer (no-op when using polling)
+ *  Stop the 60Hz timer
  */
 static void stop60HzTimer(void)
 {
-    // No timer to stop in polling mode
+#if HARDWARE_TICK
+    if (tick_timer) {
+        esp_timer_stop(tick_timer);
+        esp_timer_delete(tick_timer);
+        tick_timer = NULL;
+    }
+#endif
 }
 
 /*
@@ -249,12 +483,22 @@ void B2_delete_mutex(B2_mutex *mutex)
 }
 
 /*
- *  Flush code cache (no-op for interpreted emulation)
+ *  Flush code cache - retires decode cache traces covering the patched code
  */
 void FlushCodeCache(void *start, uint32 size)
 {
+#if USE_DECODE_CACHE
+    uint8 *p = (uint8 *)start;
+    if (p >= RAMBaseHost && p < RAMBaseHost + RAMSize) {
+        m68k_dcache_invalidate(p - RAMBaseHost, size);
+    } else if (p >= ROMBaseHost && p < ROMBaseHost + ROMSize) {
+        // ROM traces share one generation, so patching ROM drops everything
+        m68k_dcache_flush();
+    }
+#else
     UNUSED(start);
     UNUSED(size);
+#endif
 }
 
 /*
@@ -296,9 +540,25 @@ bool ChoiceAlert(const char *text, const char *pos, const char *neg)
 void QuitEmulator(void)
 {
     Serial.println("[MAIN] QuitEmulator called");
+#if TRACE_RING
+    if (trace_ring_level)
+        trace_ring_flush();
+#endif
     emulator_running = false;
 }
 
+#if WARM_RESTART
+/*
+ *  Boot the Mac again: the CPU leaves Start680x0() at the next quantum and
+ *  RunEmulator() resets it, the ROM, RAM, prefs and host tasks stay as they are
+ */
+void WarmRestart(void)
+{
+    Serial.println("[MAIN] Warm restart requested");
+    restart_requested = true;
+}
+#endif
+
 /*
  *  Load ROM file from SD card
  */
@@ -306,7 +566,7 @@ static bool LoadROM(const char *rom_path)
 {
     Serial.printf("[MAIN] Loading ROM from: %s\n", rom_path);
     
-    File rom_file = SD.open(rom_path, FILE_READ);
+    File rom_file = SDCard().open(rom_path, FILE_READ);
     if (!rom_file) {
         Serial.printf("[MAIN] ERROR: Cannot open ROM file: %s\n", rom_path);
         return false;
@@ -336,17 +596,31 @@ static bool LoadROM(const char *rom_path)
     // Clear buffer
     memset(ROMBaseHost, 0, ROMSize);
     
-    // Read ROM file
-    size_t bytes_read = rom_file.read(ROMBaseHost, rom_size);
-    rom_file.close();
+    bool from_flash = false;
+#if ROM_FLASH
+    // The same file as the copy in flash: no need to read the card
+    uint32 mtime = (uint32)rom_file.getLastWrite();
+    from_flash = ROMFlashLoad(rom_path, rom_size, mtime, ROMBaseHost);
+#endif
     
-    if (bytes_read != rom_size) {
-        Serial.printf("[MAIN] ERROR: ROM read failed (got %d, expected %d)\n", 
-                      bytes_read, rom_size);
-        free(ROMBaseHost);
-        ROMBaseHost = NULL;
-        return false;
+    if (!from_flash) {
+        // Read ROM file
+        size_t bytes_read = rom_file.read(ROMBaseHost, rom_size);
+        
+        if (bytes_read != rom_size) {
+            Serial.printf("[MAIN] ERROR: ROM read failed (got %d, expected %d)\n", 
+                          bytes_read, rom_size);
+            rom_file.close();
+            free(ROMBaseHost);
+            ROMBaseHost = NULL;
+            return false;
+        }
+        
+#if ROM_FLASH
+        ROMFlashStore(rom_path, rom_size, mtime, ROMBaseHost);
+#endif
     }
+    rom_file.close();
     
     Serial.printf("[MAIN] ROM loaded successfully at %p (%d bytes)\n", 
                   ROMBaseHost, ROMSize);
@@ -364,6 +638,26 @@ static bool LoadROM(const char *rom_path)
 /*
  *  Allocate Mac RAM
  */
+#if PARALLEL_BOOT
+static SemaphoreHandle_t ram_cleared = NULL;    // Given by ramClearTask()
+
+static void ramClearTask(void *param)
+{
+    UNUSED(param);
+    uint32 t0 = millis();
+    memset(RAMBaseHost, 0, RAMSize);
+    Serial.printf("[MAIN] Mac RAM cleared on Core 0 in %u ms\n", millis() - t0);
+    xSemaphoreGive(ram_cleared);
+    vTaskDelete(NULL);
+}
+#endif
+
+// PSRAM left for what is allocated after the Mac RAM: ROM, frame and
+// present buffers, disk and CD caches, CPU tables
+#define RAM_PSRAM_RESERVE   (6 * 1024 * 1024)
+#define RAM_MIN_SIZE        (4 * 1024 * 1024)
+#define RAM_MAX_SIZE        (32 * 1024 * 1024)  // Largest boot GUI choice, DCACHE_RAM_PAGES
+
 static bool AllocateRAM(void)
 {
     // Get RAM size from preferences
@@ -371,6 +665,22 @@ static bool AllocateRAM(void)
     if (RAMSize < 1024 * 1024) {
         RAMSize = 8 * 1024 * 1024;  // Default 8MB
     }
+    if (RAMSize > RAM_MAX_SIZE) {
+        Serial.printf("[MAIN] WARNING: %u MB of Mac RAM requested, %u MB is the most supported\n",
+                      RAMSize / (1024 * 1024), RAM_MAX_SIZE / (1024 * 1024));
+        RAMSize = RAM_MAX_SIZE;
+    }
+    
+    // The Mac RAM is one block. Shrink a request the PSRAM cannot hold, in
+    // whole megabytes, rather than failing the boot or starving the
+    // allocations that follow.
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    size_t fits = largest > RAM_PSRAM_RESERVE ? (largest - RAM_PSRAM_RESERVE) & ~(size_t)(1024 * 1024 - 1) : 0;
+    if (RAMSize > fits && fits >= RAM_MIN_SIZE) {
+        Serial.printf("[MAIN] WARNING: %u MB of Mac RAM requested, %u MB fit in PSRAM\n",
+                      RAMSize / (1024 * 1024), (unsigned)(fits / (1024 * 1024)));
+        RAMSize = fits;
+    }
     
     Serial.printf("[MAIN] Allocating %d bytes for Mac RAM...\n", RAMSize);
     
@@ -381,14 +691,44 @@ static bool AllocateRAM(void)
         return false;
     }
     
+#if PARALLEL_BOOT
+    // Clear RAM on Core 0 while the ROM loads and InitAll() starts the drivers
+    ram_cleared = xSemaphoreCreateBinary();
+    if (ram_cleared == NULL ||
+        xTaskCreatePinnedToCore(ramClearTask, "RAMClear", 2048, NULL, 1, NULL, 0) != pdPASS) {
+        memset(RAMBaseHost, 0, RAMSize);
+        if (ram_cleared) {
+            xSemaphoreGive(ram_cleared);
+        }
+    }
+#else
     // Clear RAM
     memset(RAMBaseHost, 0, RAMSize);
+#endif
     
     Serial.printf("[MAIN] Mac RAM allocated at %p (%d bytes)\n", RAMBaseHost, RAMSize);
     
     return true;
 }
 
+#if PARALLEL_BOOT
+/*
+ *  Wait for ramClearTask(), called by InitAll() before the CPU and ROM
+ *  patches use Mac RAM
+ */
+void WaitRAMCleared(void)
+{
+    if (ram_cleared == NULL) {
+        return;
+    }
+    uint32 t0 = millis();
+    xSemaphoreTake(ram_cleared, portMAX_DELAY);
+    vSemaphoreDelete(ram_cleared);
+    ram_cleared = NULL;
+    Serial.printf("[MAIN] Waited %u ms for the Mac RAM clear\n", millis() - t0);
+}
+#endif
+
 /*
  *  1Hz tick handler
  */
@@ -420,6 +760,9 @@ static bool InitEmulator(void)
     Serial.printf("[MAIN] Internal SRAM: %d/%d bytes free, largest block: %d bytes\n", 
                   free_internal, total_internal, largest_internal);
     
+    // Decide which hot tables get internal SRAM, before any is allocated
+    SramPlan();
+    
     Serial.printf("[MAIN] CPU Frequency: %d MHz\n", ESP.getCpuFreqMHz());
     Serial.printf("[MAIN] Running on Core: %d\n", xPortGetCoreID());
     
@@ -431,6 +774,17 @@ static bool InitEmulator(void)
     char **dummy_argv = dummy_argv_data;
     PrefsInit(NULL, dummy_argc, dummy_argv);
     
+    // Timing set by the performance profile, if any (0: not set)
+    if (PrefsFindInt32("quantumus") > 0)
+        quantum_target_us = PrefsFindInt32("quantumus");
+    if (PrefsFindInt32("videoms") > 0)
+        video_signal_interval = PrefsFindInt32("videoms");
+    if (PrefsFindInt32("diskflushms") > 0)
+        disk_flush_interval = PrefsFindInt32("diskflushms");
+    ConsoleAddTunable("quantumus", &quantum_target_us, 100, 100000);
+    ConsoleAddTunable("videoms", &video_signal_interval, 1, 1000);
+    ConsoleAddTunable("diskflushms", &disk_flush_interval, 100, 60000);
+    
     // Initialize system I/O (SD card)
     SysInit();
     
@@ -458,20 +812,81 @@ static bool InitEmulator(void)
         return false;
     }
     
-    // Start 60Hz FreeRTOS timer
+#if CPU_BENCH
+    // Before the 60Hz tick and the input task start, so they do not interfere
+    if (PrefsFindBool("benchmark")) {
+        cpu_bench_run();
+    }
+#endif
+#if CPU_CHECK
+    if (PrefsFindBool("cpucheck")) {
+        cpu_check_run();
+    }
+#endif
+    
+#if SAVE_STATE
+    // Resume the hibernated session, or make sure a cold boot cannot leave a
+    // snapshot behind that no longer matches the disk image
+    resumed = PrefsFindBool("resume") && SaveStateRestore();
+    if (!resumed) {
+        SaveStateDiscard();
+    }
+#endif
+    
+#if ROM_FLASH
+    // Run the patched ROM from flash (a resumed session never rewrites it)
+    ROMFlashMap(!resumed);
+#endif
+    
+    // Start 60Hz timer
     if (!start60HzTimer()) {
-        // Non-fatal - will fall back to polling
+        // Non-fatal - basilisk_loop() polls the ticks instead
         Serial.println("[MAIN] WARNING: 60Hz timer failed, using polling fallback");
     }
     
+    // Video signals, disk flushes and reports on Core 0
+    startServiceTask();
+    
     // Initialize input handling (touch panel, USB keyboard/mouse)
     if (!InputInit()) {
         // Non-fatal - emulator can run without input
         Serial.println("[MAIN] WARNING: Input initialization failed");
     }
     
+#if POWER_MANAGER
+    // Clock scaling by load (non-fatal, the clock stays fixed)
+    PowerInit();
+#endif
+    
+#if PC_PROFILER
+    if (!pc_profiler_init()) {
+        Serial.println("[MAIN] WARNING: PC profiler not started");
+    }
+#endif
+#if TRAP_PROFILE
+    if (!trap_profile_init()) {
+        Serial.println("[MAIN] WARNING: Trap profiler not started");
+    }
+#endif
+    
+#if SERIAL_CONSOLE
+    // Commands on the USB serial port, read on Core 0
+    ConsoleInit();
+#endif
+    
+#if APP_PROFILES
+    // Tunables per Mac application, once all are registered
+    AppProfileInit();
+#endif
+    
+#if PERF_HUD
+    // Performance strip on the panel, drawn by the video task when shown
+    HudInit();
+#endif
+    
     Serial.println("[MAIN] Emulator initialized successfully!");
-    Serial.printf("[MAIN] Tick quantum: %d instructions\n", emulated_ticks_quantum);
+    Serial.printf("[MAIN] Tick quantum: adaptive, %d-%d instructions per %uus\n",
+                  QUANTUM_MIN, QUANTUM_MAX, quantum_target_us);
     
     // Print memory status after init
     Serial.printf("[MAIN] Free heap after init: %d bytes\n", ESP.getFreeHeap());
@@ -504,7 +919,24 @@ static void RunEmulator(void)
     
     // Start the 68k CPU - this function runs the emulation loop
     // It will return when QuitEmulator() is called
-    Start680x0();
+    if (resumed) {
+        Resume680x0();
+    } else {
+        Start680x0();
+    }
+    
+#if WARM_RESTART
+    // Warm restart: same as the reset line, m68k_reset() reads the ROM vectors
+    while (restart_requested && emulator_running) {
+        Serial.println("[MAIN] Warm restart");
+        restart_requested = false;
+        quit_program = false;
+        resumed = false;
+        __atomic_store_n(&InterruptFlags, 0, __ATOMIC_RELEASE);
+        FlushCodeCache(RAMBaseHost, RAMSize);
+        Start680x0();
+    }
+#endif
     
     Serial.println("[MAIN] 68k CPU emulation ended");
 }
@@ -529,9 +961,17 @@ void basilisk_setup(void)
     }
     
     // Run emulator
+    ConsoleMark("cpu");
     RunEmulator();
     
     // Cleanup
+#if PC_PROFILER
+    pc_profiler_exit();
+#endif
+#if TRAP_PROFILE
+    trap_profile_exit();
+#endif
+    stopServiceTask();
     stop60HzTimer();
     InputExit();
     ExitAll();
@@ -549,79 +989,187 @@ static void reportMainPerfStats(uint32 current_time)
     if (current_time - perf_main_last_report >= PERF_MAIN_REPORT_INTERVAL_MS) {
         perf_main_last_report = current_time;
         
-        if (perf_loop_count > 0) {
-            uint32 loops_per_sec = (perf_loop_count * 1000) / PERF_MAIN_REPORT_INTERVAL_MS;
+        uint32 loops = perf_delta(perf_loops, perf_last_loops);
+        uint32 flushes = perf_delta(perf_flushes, perf_last_flushes);
+        uint32 flush_us = perf_delta(perf_flush_us, perf_last_flush_us);
+        if (loops > 0 && ConsoleReports()) {
             Serial.printf("[MAIN PERF] loops/sec=%u flushes=%u flush_avg=%uus\n",
-                          loops_per_sec,
-                          perf_flush_count,
-                          perf_flush_count > 0 ? perf_flush_us / perf_flush_count : 0);
+                          loops * 1000 / PERF_MAIN_REPORT_INTERVAL_MS, flushes,
+                          flushes > 0 ? flush_us / flushes : 0);
         }
+        SysTelemetryReport(PERF_MAIN_REPORT_INTERVAL_MS);
+    }
+}
+
+/*
+ *  Housekeeping: the periodic disk flush, the XPRAM commit, the application
+ *  profiles and the 5-second reports
+ *  (service task, or the CPU task when there is none)
+ */
+static void housekeeping(uint32 current_time)
+{
+    // Periodic disk write buffer flush (every 2 seconds by default)
+    if (current_time - last_disk_flush_time >= disk_flush_interval) {
+        last_disk_flush_time = current_time;
+        uint32 t0 = micros();
+        Sys_periodic_flush();
+        uint32 t1 = micros();
+        perf_add(perf_flush_us, t1 - t0);
+        perf_inc(perf_flushes);
+    }
+    
+#if XPRAM_NVS
+    // Control panel changes to flash once they settle
+    XPRAMPoll(current_time);
+#endif
+    
+    // Tunables of the application that came to the front
+    AppProfilePoll(current_time);
+    
+    // Report performance stats periodically
+    reportMainPerfStats(current_time);
+    
+    // Report IPS stats periodically
+    reportIPSStats(current_time);
+}
+
+/*
+ *  Service task (Core 0)
+ *
+ *  Runs everything of the main loop that does not raise interrupts, so
+ *  none of it costs the CPU core time: it signals the video task every
+ *  video_signal_interval, then does the housekeeping. It shares only
+ *  counters and flags with the CPU task. The debug commands act on CPU
+ *  state and still run there, but only once per pass of this task.
+ */
+static void serviceTask(void *param)
+{
+    UNUSED(param);
+    task_run(service_task_stats);
+    for (;;) {
+        task_wait(service_task_stats, video_signal_interval);
+        vTaskDelay(pdMS_TO_TICKS(video_signal_interval));
+        task_run(service_task_stats);
         
-        // Reset counters
-        perf_loop_count = 0;
-        perf_flush_us = 0;
-        perf_flush_count = 0;
+        // Non-blocking, wakes the video task only when something changed
+        VideoRefresh();
+        
+        housekeeping(millis());
+        debug_poll_due = true;
+    }
+}
+
+static void startServiceTask(void)
+{
+    if (xTaskCreatePinnedToCore(serviceTask, "Service", SERVICE_TASK_STACK_SIZE, NULL,
+                                SERVICE_TASK_PRIORITY, &service_task_handle, SERVICE_TASK_CORE) != pdPASS) {
+        Serial.println("[MAIN] WARNING: No service task, housekeeping on the CPU core");
+        service_task_handle = NULL;
+    }
+}
+
+static void stopServiceTask(void)
+{
+    if (service_task_handle) {
+        vTaskDelete(service_task_handle);
+        service_task_handle = NULL;
     }
 }
 
 /*
- *  Arduino loop function - called periodically during emulation
- *  This is called from the CPU emulator's main loop to handle periodic tasks
+ *  Main loop hook, called by cpu_do_check_ticks() once per quantum
  *
  *  With dual-core optimization:
- *  - 60Hz tick is polled here (safer than async timer)
- *  - Video refresh is handled by video task on Core 0 (doesn't block here)
+ *  - 60Hz and 1Hz ticks come from an esp_timer on Core 0 (polled here without HARDWARE_TICK)
+ *  - Video signals, disk flushes and reports come from the service task on Core 0
  *  - Input polling is handled by input task on Core 0 (doesn't block here)
- *  - This function is lightweight - no rendering or input polling happens here
+ *  - This function only posts ticks and looks at a few flags
  */
 void basilisk_loop(void)
 {
     uint32 current_time = millis();
     
-    perf_loop_count++;
+    perf_inc(perf_loops);
     
-    // Handle 60Hz tick (~16ms intervals)
-    if (current_time - last_60hz_time >= 16) {
-        last_60hz_time = current_time;
-        handle_60hz_tick();
+    // Handle 60Hz tick (~16ms intervals) and 1Hz tick, unless the tick timer posts them
+#if HARDWARE_TICK
+    if (tick_timer == NULL)
+#endif
+    {
+        if (current_time - last_60hz_time >= 16) {
+            last_60hz_time = current_time;
+            handle_60hz_tick();
+        }
+        
+        if (current_time - last_second_time >= 1000) {
+            last_second_time = current_time;
+            handle_1hz_tick();
+        }
     }
     
-    // Handle 1Hz tick
-    if (current_time - last_second_time >= 1000) {
-        last_second_time = current_time;
-        handle_1hz_tick();
+    // Without the service task, its work is done here
+    if (service_task_handle == NULL) {
+        if (current_time - last_video_signal >= video_signal_interval) {
+            last_video_signal = current_time;
+            VideoRefresh();
+        }
+        housekeeping(current_time);
+        debug_poll_due = true;
     }
     
-    // Signal video task that a new frame may be ready
-    // This is non-blocking - just sets a flag for the video task to pick up
-    if (current_time - last_video_signal >= VIDEO_SIGNAL_INTERVAL) {
-        last_video_signal = current_time;
-        VideoRefresh();  // Now just signals the video task, doesn't render
-    }
+    // Lower or raise the CPU clock by the load of the last passes
+    PowerLoop(current_time);
     
-    // Periodic disk write buffer flush (every 2 seconds)
-    // Time check done here to avoid function call overhead on every tick
-    if (current_time - last_disk_flush_time >= DISK_FLUSH_INTERVAL) {
-        last_disk_flush_time = current_time;
-        uint32 t0 = micros();
-        Sys_periodic_flush();
-        uint32 t1 = micros();
-        perf_flush_us += (t1 - t0);
-        perf_flush_count++;
+#if PC_PROFILER || TRACE_RING || SAVE_STATE || VIDEO_TELEMETRY || DISK_TELEMETRY || INPUT_TELEMETRY || INPUT_REPLAY || MEM_PROFILE
+    // Profiler, trace ring, hibernate, telemetry, input recording and memory profile requests from the serial console
+    // (unless a Mac serial port is on USB, its input is the Mac's then)
+    if (debug_poll_due) {
+        debug_poll_due = false;
+        if (!SerialUSBInUse())
+            pollDebugCommands();
     }
+#endif
     
-    // NOTE: Input polling (M5.update + InputPoll) is now handled by a dedicated
-    // task on Core 0, removing ~2.3ms of blocking time from this loop.
-    // See input_esp32.cpp inputTask()
+#if SAVE_STATE
+    // Hibernate if the power button or the console asked for it
+    SaveStatePoll();
+#endif
     
-    // Report performance stats periodically
-    reportMainPerfStats(current_time);
-    
-    // Report IPS stats periodically
-    reportIPSStats(current_time);
-    
-    // Yield to allow FreeRTOS tasks to run
-    taskYIELD();
+#if WARM_RESTART
+    // Leave the CPU loop between instructions, RunEmulator() boots again
+    if (restart_requested && m68k_execute_depth == 1) {
+        quit_program = true;
+        SPCFLAGS_SET(SPCFLAG_BRK);
+    }
+#endif
+}
+
+/*
+ *  Idle support for idle_wait() (timer_esp32.cpp)
+ *
+ *  basilisk_idle_timeout_us() is how long the CPU may sleep before the next
+ *  60Hz tick is due. basilisk_idle_done() keeps the slept time out of the
+ *  quantum measurement and ends the current quantum, so the tick (and any
+ *  interrupt that woke us) is handled after the current instruction.
+ */
+uint32 basilisk_idle_timeout_us(void)
+{
+#if HARDWARE_TICK
+    // The tick timer wakes the CPU through SetInterruptFlag(), this is a backstop
+    if (tick_timer) {
+        uint32 elapsed_us = (uint32)esp_timer_get_time() - last_tick_us;
+        return elapsed_us >= TICK_PERIOD_US ? 0 : 2 * TICK_PERIOD_US - elapsed_us;
+    }
+#endif
+    uint32 elapsed = millis() - last_60hz_time;
+    return elapsed >= 16 ? 0 : (16 - elapsed) * 1000;
+}
+
+void basilisk_idle_done(uint32 slept_us)
+{
+    quantum_start_us += slept_us;
+    emulated_ticks_running -= emulated_ticks;
+    emulated_ticks = 0;
 }
 
 /*
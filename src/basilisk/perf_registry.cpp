@@ -0,0 +1,104 @@
+/*
+ *  perf_registry.cpp - Named performance counters and histograms
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Every subsystem registers its counters here instead of keeping its own
+ *  volatile variables, so the console (and anything else that wants them)
+ *  reads them all the same way. Names are "<subsystem>.<what>".
+ *
+ *  Registration happens at init or from static initializers, before the
+ *  tasks that read the tables start, so the tables are not locked.
+ */
+
+#include "sysdeps.h"
+#include "perf_registry.h"
+
+#define PERF_MAX_COUNTERS   64
+#define PERF_MAX_HISTOGRAMS 24
+
+// Zero-initialized, usable before any constructor has run
+static perf_counter counters[PERF_MAX_COUNTERS];
+static perf_histogram histograms[PERF_MAX_HISTOGRAMS];
+static int num_counters;
+static int num_histograms;
+static perf_counter scratch_counter;
+static perf_histogram scratch_histogram;
+
+
+/*
+ *  Registration
+ */
+
+perf_counter *PerfCounter(const char *name, int kind, int core)
+{
+    if (num_counters == PERF_MAX_COUNTERS)
+        return &scratch_counter;
+    perf_counter *c = &counters[num_counters];
+    c->name = name;
+    c->kind = kind;
+    c->core = core;
+    num_counters++;
+    return c;
+}
+
+perf_histogram *PerfHistogram(const char *name, int core)
+{
+    if (num_histograms == PERF_MAX_HISTOGRAMS)
+        return &scratch_histogram;
+    perf_histogram *p = &histograms[num_histograms];
+    p->name = name;
+    p->core = core;
+    num_histograms++;
+    return p;
+}
+
+
+/*
+ *  Readers
+ */
+
+int PerfCounterCount(void)
+{
+    return num_counters;
+}
+
+perf_counter *PerfCounterAt(int i)
+{
+    return &counters[i];
+}
+
+int PerfHistogramCount(void)
+{
+    return num_histograms;
+}
+
+perf_histogram *PerfHistogramAt(int i)
+{
+    return &histograms[i];
+}
+
+perf_counter *PerfCounterFind(const char *name)
+{
+    for (int i = 0; i < num_counters; i++) {
+        if (strcmp(counters[i].name, name) == 0)
+            return &counters[i];
+    }
+    return NULL;
+}
+
+int PerfSnapshot(uint32 *values, int max)
+{
+    int n = num_counters < max ? num_counters : max;
+    for (int i = 0; i < n; i++)
+        values[i] = perf_read(&counters[i]);
+    return n;
+}
+
+void PerfReset(void)
+{
+    for (int i = 0; i < num_counters; i++)
+        counters[i].base = counters[i].value;
+    for (int i = 0; i < num_histograms; i++)
+        histograms[i].reset = true;
+}
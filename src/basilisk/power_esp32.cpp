@@ -0,0 +1,200 @@
+/*
+ *  power_esp32.cpp - CPU clock scaling by emulator load
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The P4 used to run at its full clock while the Mac sat at the Finder,
+ *  the CPU task asleep in idle_wait() nearly all the time. The power
+ *  manager lets esp_pm scale the clock between POWER_MIN_MHZ and the boot
+ *  clock, and holds an ESP_PM_CPU_FREQ_MAX lock while the Mac has work:
+ *
+ *  - It drops the lock after POWER_IDLE_WINDOWS windows of POWER_WINDOW_MS
+ *    in a row in which the CPU task slept at least POWER_IDLE_PERCENT of
+ *    the time and no tile of the screen changed.
+ *  - It takes the lock again as soon as POWER_BUSY_PASSES main loop passes
+ *    in a row ran without sleeping, when the window was not idle, or when
+ *    the ADB got an input event (PowerWake(), from any task).
+ *
+ *  The counters show what it costs and saves:
+ *
+ *    power.mhz         current clock
+ *    power.low_ms      time spent at the reduced clock
+ *    power.drops       clock drops, power.raises: raises
+ *    power.switch_us   histogram of the lock calls, the switch itself
+ *    power.wake_us     histogram from an input event to the full clock
+ *
+ *  The "powersave" pref (default on) turns it off, e.g. for benchmarks.
+ *  Without CONFIG_PM_ENABLE in the IDF the clock stays fixed.
+ */
+
+#include "sysdeps.h"
+#include "prefs.h"
+#include "perf_registry.h"
+#include "power.h"
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <esp_pm.h>
+
+#if POWER_MANAGER
+
+#define POWER_MIN_MHZ       90      // Clock while idle
+#define POWER_WINDOW_MS     500     // Idle share measured over this window
+#define POWER_IDLE_PERCENT  90      // Slept at least this share of a window: idle
+#define POWER_IDLE_WINDOWS  4       // Idle windows in a row before the drop (2 s)
+#define POWER_BUSY_PASSES   3       // Main loop passes without sleep before a raise
+
+static perf_counter *const perf_mhz = PerfCounter("power.mhz", PERF_GAUGE, PERF_CORE_CPU);
+static perf_counter *const perf_low_ms = PerfCounter("power.low_ms", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_drops = PerfCounter("power.drops", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_raises = PerfCounter("power.raises", PERF_COUNT, PERF_CORE_CPU);
+static perf_histogram *const perf_switch_us = PerfHistogram("power.switch_us", PERF_CORE_CPU);
+static perf_histogram *const perf_wake_us = PerfHistogram("power.wake_us", PERF_CORE_CPU);
+
+static esp_pm_lock_handle_t max_lock = NULL;    // NULL: clock not scaled
+static uint32 max_mhz;
+static bool full_clock = true;          // max_lock held (CPU task)
+static perf_counter *tiles = NULL;      // video.tiles, NULL if not built in
+static uint32 tiles_last;
+
+// Current window (CPU task)
+static uint32 window_start_ms;
+static uint32 window_slept_us;
+static uint32 slept_last_pass;          // window_slept_us at the previous pass
+static int idle_windows;
+static int busy_passes;
+
+static volatile uint32 wake_us = 0;     // First input since the last raise, 0: none
+
+
+/*
+ *  Clock changes (CPU task)
+ */
+
+static void raise_clock(void)
+{
+    uint32 t0 = (uint32)esp_timer_get_time();
+    esp_pm_lock_acquire(max_lock);
+    uint32 t1 = (uint32)esp_timer_get_time();
+    full_clock = true;
+    idle_windows = 0;
+    busy_passes = 0;
+    perf_record(perf_switch_us, t1 - t0);
+    perf_inc(perf_raises);
+    perf_set(perf_mhz, max_mhz);
+}
+
+static void drop_clock(void)
+{
+    uint32 t0 = (uint32)esp_timer_get_time();
+    esp_pm_lock_release(max_lock);
+    uint32 t1 = (uint32)esp_timer_get_time();
+    full_clock = false;
+    perf_record(perf_switch_us, t1 - t0);
+    perf_inc(perf_drops);
+    perf_set(perf_mhz, POWER_MIN_MHZ);
+}
+
+// Raise for a pending input event, and time it from the event
+static void raise_for_wake(void)
+{
+    uint32 since = __atomic_exchange_n(&wake_us, 0, __ATOMIC_ACQUIRE);
+    if (since == 0)
+        return;
+    if (!full_clock) {
+        raise_clock();
+        perf_record(perf_wake_us, (uint32)esp_timer_get_time() - since);
+    }
+}
+
+
+/*
+ *  Interface
+ */
+
+bool PowerInit(void)
+{
+    perf_set(perf_mhz, getCpuFrequencyMhz());
+    if (!PrefsFindBool("powersave")) {
+        Serial.println("[POWER] Clock scaling off (powersave pref)");
+        return false;
+    }
+
+    max_mhz = getCpuFrequencyMhz();
+    esp_pm_config_t config = {};
+    config.max_freq_mhz = max_mhz;
+    config.min_freq_mhz = POWER_MIN_MHZ;
+    config.light_sleep_enable = false;
+    esp_err_t err = esp_pm_configure(&config);
+    if (err == ESP_OK)
+        err = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "basilisk", &max_lock);
+    if (err == ESP_OK)
+        err = esp_pm_lock_acquire(max_lock);
+    if (err != ESP_OK) {
+        Serial.printf("[POWER] WARNING: No clock scaling (%s), fixed at %u MHz\n", esp_err_to_name(err), max_mhz);
+        max_lock = NULL;
+        return false;
+    }
+
+    tiles = PerfCounterFind("video.tiles");
+    tiles_last = tiles ? tiles->value : 0;
+    window_start_ms = millis();
+    Serial.printf("[POWER] %u MHz, %u MHz after %u ms idle\n", max_mhz, POWER_MIN_MHZ,
+                  POWER_WINDOW_MS * POWER_IDLE_WINDOWS);
+    return true;
+}
+
+void PowerIdle(uint32 slept_us)
+{
+    if (max_lock == NULL)
+        return;
+    window_slept_us += slept_us;
+    if (wake_us)
+        raise_for_wake();
+}
+
+void PowerLoop(uint32 now_ms)
+{
+    if (max_lock == NULL)
+        return;
+    if (wake_us)
+        raise_for_wake();
+
+    // Work: passes that ran a whole quantum without sleeping
+    bool slept = window_slept_us != slept_last_pass;
+    slept_last_pass = window_slept_us;
+    if (!full_clock) {
+        if (slept)
+            busy_passes = 0;
+        else if (++busy_passes >= POWER_BUSY_PASSES)
+            raise_clock();
+    }
+
+    uint32 elapsed = now_ms - window_start_ms;
+    if (elapsed < POWER_WINDOW_MS)
+        return;
+    uint32 changed = tiles ? perf_delta(tiles, tiles_last) : 0;
+    bool idle = window_slept_us / 10 >= elapsed * POWER_IDLE_PERCENT && changed == 0;
+    if (!full_clock)
+        perf_add(perf_low_ms, elapsed);
+    if (!idle) {
+        idle_windows = 0;
+        if (!full_clock)
+            raise_clock();
+    } else if (++idle_windows >= POWER_IDLE_WINDOWS && full_clock) {
+        drop_clock();
+    }
+    window_start_ms = now_ms;
+    window_slept_us = 0;
+    slept_last_pass = 0;
+}
+
+void PowerWake(void)
+{
+    if (max_lock == NULL || wake_us)
+        return;
+    uint32 now = (uint32)esp_timer_get_time();
+    __atomic_store_n(&wake_us, now ? now : 1, __ATOMIC_RELEASE);
+}
+
+#endif
@@ -382,15 +382,18 @@ void PrefsRemoveItem(const char *name, int index)
 
 /*
  *  Load prefs from stream (utility function for LoadPrefs() implementation)
+ *  With a section name, only the lines after "[section]" up to the next
+ *  section are read; otherwise those after any section header are skipped
  */
 
-void LoadPrefsFromStream(FILE *f)
+void LoadPrefsFromStream(FILE *f, const char *section)
 {
+	bool in_section = (section == NULL);
 	char line[256];
 	while(fgets(line, sizeof(line), f)) {
 		// Remove newline, if present
 		int len = strlen(line);
-		if (len > 0 && line[len-1] == '\n') {
+		while (len > 0 && (line[len-1] == '\n' || line[len-1] == '\r')) {
 			line[len-1] = '\0';
 			len--;
 		}
@@ -401,6 +404,17 @@ void LoadPrefsFromStream(FILE *f)
 		if (line[0] == '#' || line[0] == ';')
 			continue;
 
+		// Section header
+		if (line[0] == '[') {
+			char *end = strchr(line, ']');
+			if (end)
+				*end = 0;
+			in_section = (section != NULL && strcmp(line + 1, section) == 0);
+			continue;
+		}
+		if (!in_section)
+			continue;
+
 		// Terminate string after keyword
 		char *p = line;
 		while (*p && !isspace(*p)) p++;
@@ -7,12 +7,31 @@
 #include "sysdeps.h"
 #include "prefs.h"
 #include "boot_gui.h"
+#include "sdcard.h"
+
+#include <stdio.h>
 
 #define DEBUG 0
 #include "debug.h"
 
 // Platform-specific preferences items
 prefs_desc platform_prefs_items[] = {
+    {"benchmark", TYPE_BOOLEAN, false,  "run the CPU benchmark before booting"},
+    {"fpufast", TYPE_BOOLEAN, false,    "round FPU arithmetic to single precision (faster, less accurate)"},
+    {"resume", TYPE_BOOLEAN, false,     "resume the hibernated session instead of booting"},
+    {"wifissid", TYPE_STRING, false,    "WiFi network for the Ethernet driver"},
+    {"wifipassword", TYPE_STRING, false, "password of the WiFi network"},
+    // Timing, set by a performance profile (0 or unset: built-in default)
+    {"quantumus", TYPE_INT32, false,    "emulated time between main loop passes in us"},
+    {"videoms", TYPE_INT32, false,      "interval of the screen change checks in ms"},
+    {"fastframems", TYPE_INT32, false,  "minimum time after a small screen update in ms"},
+    {"slowframems", TYPE_INT32, false,  "minimum time after a large screen update in ms"},
+    {"diskflushms", TYPE_INT32, false,  "interval of the disk write buffer flushes in ms"},
+    {"inputpollms", TYPE_INT32, false,  "interval of the button and keyboard LED polls in ms"},
+    {"touchpollms", TYPE_INT32, false,  "interval of the touch panel samples in ms"},
+    {"perfreport", TYPE_BOOLEAN, false, "print the performance reports every 5 seconds"},
+    {"hud", TYPE_BOOLEAN, false,        "show the performance HUD from boot"},
+    {"powersave", TYPE_BOOLEAN, false,  "lower the CPU clock while the Mac is idle"},
     {NULL, TYPE_END, false, NULL}  // End marker
 };
 
@@ -46,8 +65,9 @@ void LoadPrefs(const char *vmdir)
     PrefsReplaceInt32("ramsize", ram_size);
     Serial.printf("[PREFS] RAM: %d MB\n", ram_size / (1024 * 1024));
     
-    // Set screen configuration
-    PrefsReplaceString("screen", "win/640/480");
+    // Set screen configuration: 640x360 doubled, or native (screen=1280x720 in settings)
+    PrefsReplaceString("screen", BootGUI_GetNativeScreen() ? "win/1280/720" : "win/640/360");
+    Serial.printf("[PREFS] Screen: %s\n", PrefsFindString("screen"));
     
     // Get hard disk path from Boot GUI selection
     const char* disk_path = BootGUI_GetDiskPath();
@@ -60,9 +80,6 @@ void LoadPrefs(const char *vmdir)
         Serial.println("[PREFS] Disk: /Macintosh8.dsk (default, read-write)");
     }
     
-    // Disable sound (for now)
-    PrefsReplaceBool("nosound", true);
-    
     // Get CD-ROM path from Boot GUI selection
     const char* cdrom_path = BootGUI_GetCDROMPath();
     if (cdrom_path && strlen(cdrom_path) > 0) {
@@ -81,9 +98,48 @@ void LoadPrefs(const char *vmdir)
     PrefsReplaceInt32("bootdrive", 0);
     PrefsReplaceInt32("bootdriver", 0);
     
+    // Sleep the CPU core in SynchIdleTime() instead of spinning the idle loop
+    PrefsReplaceBool("idlewait", true);
+    
     // Frame skip (lower = smoother but slower)
     PrefsReplaceInt32("frameskip", 4);
     
+    // CPU benchmark before boot (Benchmark button or benchmark=yes in settings)
+    PrefsReplaceBool("benchmark", BootGUI_GetBenchmark());
+    
+    // Single precision FPU arithmetic (fpufast=yes in settings)
+    PrefsReplaceBool("fpufast", BootGUI_GetFPUFast());
+    
+    // Resume a hibernated session (snapshot found, settings screen not opened)
+    PrefsReplaceBool("resume", BootGUI_GetResume());
+    
+    // Ethernet over WiFi (wifi_ssid= and wifi_password= in settings)
+    const char* wifi_ssid = BootGUI_GetWiFiSSID();
+    if (wifi_ssid && strlen(wifi_ssid) > 0) {
+        PrefsReplaceString("wifissid", wifi_ssid);
+        PrefsReplaceString("wifipassword", BootGUI_GetWiFiPassword());
+        PrefsReplaceBool("udptunnel", BootGUI_GetUDPTunnel());
+        Serial.printf("[PREFS] WiFi: %s%s\n", wifi_ssid, BootGUI_GetUDPTunnel() ? " (AppleTalk over UDP)" : "");
+    }
+    
+    // Serial ports (seriala= and serialb= in settings: usb or uart)
+    PrefsReplaceString("seriala", BootGUI_GetSerialA());
+    PrefsReplaceString("serialb", BootGUI_GetSerialB());
+    
+    // Performance profile (profile= in settings or the Profile button): the
+    // "[name]" section of the profiles file, prefs lines applied last
+    const char* profile = BootGUI_GetProfile();
+    if (profile && strlen(profile) > 0) {
+        FILE* f = fopen(SD_MOUNT_POINT BOOT_GUI_PROFILES_FILE, "r");
+        if (f) {
+            LoadPrefsFromStream(f, profile);
+            fclose(f);
+            Serial.printf("[PREFS] Profile: %s\n", profile);
+        } else {
+            Serial.printf("[PREFS] WARNING: No %s, profile %s not applied\n", BOOT_GUI_PROFILES_FILE, profile);
+        }
+    }
+    
     Serial.println("[PREFS] Preferences loaded");
     
     // Debug: Print loaded prefs
@@ -106,5 +162,11 @@ void SavePrefs(void)
  */
 void AddPlatformPrefsDefaults(void)
 {
-    // Defaults are set in LoadPrefs
+    // Performance reports on unless a profile turns them off
+    PrefsAddBool("perfreport", true);
+    
+    // Clock scaling on unless a profile turns it off
+    PrefsAddBool("powersave", true);
+    
+    // Other defaults are set in LoadPrefs
 }
@@ -32,6 +32,7 @@ prefs_desc common_prefs_items[] = {
 	{"disk", TYPE_STRING, true,       "device/file name of Mac volume"},
 	{"floppy", TYPE_STRING, true,     "device/file name of Mac floppy drive"},
 	{"cdrom", TYPE_STRING, true,      "device/file names of Mac CD-ROM drive"},
+	{"flashdisk", TYPE_STRING, false, "disk image to read from the sysvol flash partition"},
 	{"extfs", TYPE_STRING, false,     "root path of ExtFS"},
 	{"scsi0", TYPE_STRING, false,     "SCSI target for Mac SCSI ID 0"},
 	{"scsi1", TYPE_STRING, false,     "SCSI target for Mac SCSI ID 1"},
@@ -58,8 +59,17 @@ prefs_desc common_prefs_items[] = {
 	{"fpu", TYPE_BOOLEAN, false,      "enable FPU emulation"},
 	{"nocdrom", TYPE_BOOLEAN, false,  "don't install CD-ROM driver"},
 	{"nosound", TYPE_BOOLEAN, false,  "don't enable sound output"},
+	{"nonativemath", TYPE_BOOLEAN, false, "don't replace the FixMath and bit utility traps with native code"},
+	{"nonativetraps", TYPE_BOOLEAN, false, "dispatch Toolbox traps through the ROM trap dispatcher"},
+	{"nonativersrc", TYPE_BOOLEAN, false, "don't answer GetResource() natively"},
+	{"fastboot", TYPE_BOOLEAN, false, "skip the ROM's DBRA delay loops"},
+	{"remotedisplay", TYPE_BOOLEAN, false, "stream the screen over USB to tools/remote_view.py"},
+	{"cpucheck", TYPE_BOOLEAN, false, "compare the optimised CPU core with the plain handlers before booting"},
+	{"inputrecord", TYPE_BOOLEAN, false, "record the input events from boot, for inputreplay"},
+	{"inputreplay", TYPE_BOOLEAN, false, "replay the recorded input events from boot"},
 	{"noclipconversion", TYPE_BOOLEAN, false, "don't convert clipboard contents"},
 	{"nogui", TYPE_BOOLEAN, false,    "disable GUI"},
+	{"idlewait", TYPE_BOOLEAN, false, "sleep when idle"},
 	{"jit", TYPE_BOOLEAN, false,         "enable JIT compiler"},
 	{"jitfpu", TYPE_BOOLEAN, false,      "enable JIT compilation of FPU instructions"},
 	{"jitdebug", TYPE_BOOLEAN, false,    "enable JIT debugger (requires mon builtin)"},
@@ -111,6 +121,14 @@ void AddPrefsDefaults(void)
 	PrefsAddBool("fpu", false);
 	PrefsAddBool("nocdrom", false);
 	PrefsAddBool("nosound", false);
+	PrefsAddBool("nonativemath", false);
+	PrefsAddBool("nonativetraps", false);
+	PrefsAddBool("nonativersrc", false);
+	PrefsAddBool("fastboot", false);
+	PrefsAddBool("remotedisplay", false);
+	PrefsAddBool("cpucheck", false);
+	PrefsAddBool("inputrecord", false);
+	PrefsAddBool("inputreplay", false);
 	PrefsAddBool("noclipconversion", false);
 	PrefsAddBool("nogui", false);
 	
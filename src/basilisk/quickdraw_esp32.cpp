@@ -0,0 +1,635 @@
+/*
+ *  quickdraw_esp32.cpp - Native QuickDraw fast paths
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Finder and application redraws are dominated by CopyBits() and rectangle
+ *  fills, which the ROM runs as 68k loops storing to the frame buffer one
+ *  byte or long at a time (each store also marking its tile dirty). The
+ *  traps are head patched with small stubs that first offer the call to
+ *  QuickDrawOp(). The common cases are drawn natively and the dirty tiles
+ *  marked once per rectangle:
+ *
+ *  - CopyBits() with srcCopy, no mask region, no scaling, between 8-bit
+ *    pixel maps sharing a color table and black/white port colors
+ *  - FillRect() and EraseRect() with a solid (all 0 or all 1) pattern into
+ *    an 8-bit port
+ *  - ScrollRect() straight up or down in an 8-bit port with a solid
+ *    background pattern
+ *
+ *  A vertical move within the frame buffer (ScrollRect(), or a CopyBits()
+ *  from the screen to itself) is handed to VideoScrollRect(), which moves
+ *  the pixels already on the display instead of pushing the whole area.
+ *
+ *  Everything else (non-rectangular clipping, pictures or regions being
+ *  recorded, custom bottlenecks, other depths) jumps to the original trap.
+ */
+
+#include <string.h>
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "emul_op.h"
+#include "video.h"
+#include "quickdraw.h"
+#include "savestate.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+#if USE_NATIVE_QUICKDRAW
+
+// Traps
+#define TRAP_COPYBITS   0xa8ec
+#define TRAP_FILLRECT   0xa8a5
+#define TRAP_ERASERECT  0xa8a3
+#define TRAP_SCROLLRECT 0xa8ef
+
+// CGrafPort fields
+#define cgpPortPixMap   2
+#define cgpPortVersion  6
+#define cgpVisRgn       24
+#define cgpClipRgn      28
+#define cgpBkPixPat     32
+#define cgpRGBFgColor   36
+#define cgpRGBBkColor   42
+#define cgpPnVis        66
+#define cgpFgColor      80
+#define cgpBkColor      84
+#define cgpPicSave      92
+#define cgpRgnSave      96
+#define cgpPolySave     100
+#define cgpGrafProcs    104
+
+// PixMap fields
+#define pmBaseAddr      0
+#define pmRowBytes      4
+#define pmBounds        6
+#define pmVersion       14
+#define pmPixelType     30
+#define pmPixelSize     32
+#define pmTable         42
+
+// PixPat fields
+#define ppPatType       0
+#define ppPat1Data      20
+
+// Stub and scratch layout of the patch block
+enum {
+    qdCopyBitsStub = 0,         // 16 bytes
+    qdFillRectStub = 16,        // 14 bytes
+    qdEraseRectStub = 30,       // 14 bytes
+    qdShieldCursor = 44,        // 8 bytes
+    qdScratchRect = 52,         // 8 bytes
+    qdScrollRectStub = 60,      // 16 bytes
+    SIZEOF_qdpatch = 76
+};
+
+static uint32 qd_patch = 0;         // Mac address of the patch block
+static uint32 orig_copybits = 0;    // Previous trap addresses
+static uint32 orig_fillrect = 0;
+static uint32 orig_eraserect = 0;
+static uint32 orig_scrollrect = 0;
+static M68kRegisters *qd_regs;      // Registers of the trap call being handled
+
+struct qd_rect {
+    int16 top, left, bottom, right;
+};
+
+struct qd_pixmap {
+    uint32 addr;                    // Mac address of the PixMap
+    uint32 base;
+    uint32 row_bytes;
+    qd_rect bounds;
+    uint32 seed;                    // ctSeed of the color table
+};
+
+
+/*
+ *  Helpers
+ */
+
+static void read_rect(uint32 addr, qd_rect &r)
+{
+    r.top = (int16)ReadMacInt16(addr);
+    r.left = (int16)ReadMacInt16(addr + 2);
+    r.bottom = (int16)ReadMacInt16(addr + 4);
+    r.right = (int16)ReadMacInt16(addr + 6);
+}
+
+static bool rect_empty(const qd_rect &r)
+{
+    return r.top >= r.bottom || r.left >= r.right;
+}
+
+static void sect_rect(qd_rect &r, const qd_rect &s)
+{
+    if (s.top > r.top) r.top = s.top;
+    if (s.left > r.left) r.left = s.left;
+    if (s.bottom < r.bottom) r.bottom = s.bottom;
+    if (s.right < r.right) r.right = s.right;
+}
+
+static bool rect_inside(const qd_rect &r, const qd_rect &s)
+{
+    return r.top >= s.top && r.left >= s.left && r.bottom <= s.bottom && r.right <= s.right;
+}
+
+// Bounding box of a rectangular region, false for any other shape
+static bool region_rect(uint32 rgn, qd_rect &r)
+{
+    if (rgn == 0 || (rgn = ReadMacInt32(rgn)) == 0)
+        return false;
+    if (ReadMacInt16(rgn) != 10)
+        return false;
+    read_rect(rgn + 2, r);
+    return true;
+}
+
+// Current port, if it is a color port drawing without any recording or bottlenecks
+static uint32 current_port(uint32 a5)
+{
+    if (a5 == 0 || a5 >= RAMSize)
+        return 0;
+    uint32 port = ReadMacInt32(ReadMacInt32(a5));
+    if (port == 0 || port >= RAMSize)
+        return 0;
+    if ((ReadMacInt16(port + cgpPortVersion) & 0xc000) != 0xc000)
+        return 0;
+    if (ReadMacInt32(port + cgpPicSave) || ReadMacInt32(port + cgpRgnSave)
+     || ReadMacInt32(port + cgpPolySave) || ReadMacInt32(port + cgpGrafProcs))
+        return 0;
+    return port;
+}
+
+// Resolve a BitMap pointer (possibly the portBits of a color port) to an 8-bit PixMap
+static bool get_pixmap(uint32 bits, qd_pixmap &pm)
+{
+    uint16 row_bytes = ReadMacInt16(bits + pmRowBytes);
+    if ((row_bytes & 0xc000) == 0xc000) {
+        uint32 h = ReadMacInt32(bits);
+        if (h == 0 || (bits = ReadMacInt32(h)) == 0)
+            return false;
+        row_bytes = ReadMacInt16(bits + pmRowBytes);
+    }
+    if ((row_bytes & 0x8000) == 0)
+        return false;   // 1-bit BitMap
+    uint16 version = ReadMacInt16(bits + pmVersion);
+    if ((version != 0 && version != 4) || ReadMacInt16(bits + pmPixelType) != 0 || ReadMacInt16(bits + pmPixelSize) != 8)
+        return false;
+
+    pm.addr = bits;
+    pm.base = ReadMacInt32(bits + pmBaseAddr);
+    pm.row_bytes = row_bytes & 0x3fff;
+    read_rect(bits + pmBounds, pm.bounds);
+    uint32 table = ReadMacInt32(bits + pmTable);
+    pm.seed = (table && ReadMacInt32(table)) ? ReadMacInt32(ReadMacInt32(table)) : 0;
+    return pm.base != 0 && pm.row_bytes != 0;
+}
+
+// Host address of a rectangle (inside the bounds) of a pixel map, NULL if it is not plain memory
+static uint8 *pixmap_host_addr(const qd_pixmap &pm, const qd_rect &r, bool &frame)
+{
+    uint32 start = pm.base + (r.top - pm.bounds.top) * pm.row_bytes + (r.left - pm.bounds.left);
+    uint32 size = (r.bottom - r.top - 1) * pm.row_bytes + (r.right - r.left);
+    frame = false;
+    if (start < RAMSize && size <= RAMSize - start)
+        return RAMBaseHost + start;
+    if (MacFrameLayout == FLAYOUT_DIRECT && start - MacFrameBaseMac < MacFrameSize && size <= MacFrameSize - (start - MacFrameBaseMac)) {
+        frame = true;
+        return MacFrameBaseHost + (start - MacFrameBaseMac);
+    }
+    return NULL;
+}
+
+// Clip rectangle for drawing into the current port's own pixel map
+static bool port_clip(uint32 port, const qd_pixmap &pm, qd_rect &r)
+{
+    qd_rect vis, clip;
+    if (!region_rect(ReadMacInt32(port + cgpVisRgn), vis) || !region_rect(ReadMacInt32(port + cgpClipRgn), clip))
+        return false;
+    sect_rect(r, pm.bounds);
+    sect_rect(r, vis);
+    sect_rect(r, clip);
+    return true;
+}
+
+// Hide the cursor if it intersects a frame buffer rectangle (balanced by ShowCursor())
+static void shield_cursor(const qd_rect &r, const qd_pixmap &pm)
+{
+    M68kRegisters regs = *qd_regs;
+    WriteMacInt16(qd_patch + qdScratchRect, r.top);
+    WriteMacInt16(qd_patch + qdScratchRect + 2, r.left);
+    WriteMacInt16(qd_patch + qdScratchRect + 4, r.bottom);
+    WriteMacInt16(qd_patch + qdScratchRect + 6, r.right);
+    regs.a[0] = qd_patch + qdScratchRect;
+    regs.d[0] = ((uint32)(uint16)pm.bounds.top << 16) | (uint16)pm.bounds.left;
+    Execute68k(qd_patch + qdShieldCursor, &regs);
+}
+
+static void show_cursor(void)
+{
+    M68kRegisters regs = *qd_regs;
+    Execute68kTrap(0xa853, &regs);      // ShowCursor()
+}
+
+// Retire what the native stores made stale
+static void pixmap_written(const qd_pixmap &pm, uint8 *p, const qd_rect &r, bool frame)
+{
+    uint32 width = r.right - r.left, height = r.bottom - r.top;
+    if (frame)
+        VideoMarkDirtyRect(p - MacFrameBaseHost, width, height, pm.row_bytes);
+    else
+        FlushCodeCache(p, (height - 1) * pm.row_bytes + width);
+}
+
+// Move the rows of a rectangle by dv (rows are moved bottom up when scrolling down)
+static void move_rows(uint8 *d, const uint8 *s, uint32 width, int height, uint32 row_bytes, int dv)
+{
+    if (dv > 0) {
+        for (int y = height - 1; y >= 0; y--)
+            memmove(d + y * row_bytes, s + y * row_bytes, width);
+    } else {
+        for (int y = 0; y < height; y++)
+            memmove(d + y * row_bytes, s + y * row_bytes, width);
+    }
+}
+
+// Pixel of a solid pattern: 1 bits are the foreground pixel, 0 bits the
+// background. Without a pattern, the port's background pattern if it is an
+// old-style one. False for any other pattern.
+static bool solid_pixel(uint32 port, uint32 pat, uint8 &pixel)
+{
+    if (pat == 0) {
+        uint32 pp = ReadMacInt32(port + cgpBkPixPat);
+        if (pp == 0 || (pp = ReadMacInt32(pp)) == 0 || ReadMacInt16(pp + ppPatType) != 0)
+            return false;
+        pat = pp + ppPat1Data;
+    }
+
+    uint32 p0 = ReadMacInt32(pat), p1 = ReadMacInt32(pat + 4);
+    if (p0 == 0 && p1 == 0)
+        pixel = ReadMacInt32(port + cgpBkColor);
+    else if (p0 == 0xffffffff && p1 == 0xffffffff)
+        pixel = ReadMacInt32(port + cgpFgColor);
+    else
+        return false;
+    return true;
+}
+
+
+/*
+ *  CopyBits(srcBits, dstBits: BitMap; srcRect, dstRect: Rect; mode: INTEGER; maskRgn: RgnHandle)
+ */
+
+static bool qd_copybits(uint32 sp, uint32 a5)
+{
+    uint32 mask_rgn = ReadMacInt32(sp + 4);
+    uint16 mode = ReadMacInt16(sp + 8);
+    if (mask_rgn || mode != 0)     // srcCopy only
+        return false;
+
+    uint32 port = current_port(a5);
+    if (port == 0)
+        return false;
+
+    // Black foreground and white background, or srcCopy colorizes
+    for (int i = 0; i < 6; i += 2) {
+        if (ReadMacInt16(port + cgpRGBFgColor + i) != 0x0000 || ReadMacInt16(port + cgpRGBBkColor + i) != 0xffff)
+            return false;
+    }
+
+    qd_pixmap src, dst, port_pm;
+    if (!get_pixmap(ReadMacInt32(sp + 22), src) || !get_pixmap(ReadMacInt32(sp + 18), dst))
+        return false;
+    if (src.seed != dst.seed)       // Would need color mapping
+        return false;
+
+    qd_rect src_rect, dst_rect;
+    read_rect(ReadMacInt32(sp + 14), src_rect);
+    read_rect(ReadMacInt32(sp + 10), dst_rect);
+    if (src_rect.bottom - src_rect.top != dst_rect.bottom - dst_rect.top
+     || src_rect.right - src_rect.left != dst_rect.right - dst_rect.left)
+        return false;   // Scaling
+    if (rect_empty(dst_rect))
+        return true;
+    if (!rect_inside(src_rect, src.bounds))
+        return false;
+
+    // Clip the destination. Into the port's own pixels the port regions apply;
+    // for other destinations, only go native when they could not cut anything.
+    qd_rect clip = dst_rect;
+    if (get_pixmap(port + cgpPortPixMap, port_pm) && port_pm.addr == dst.addr) {
+        if (!port_clip(port, dst, clip))
+            return false;
+    } else {
+        qd_rect vis, cr;
+        if (!region_rect(ReadMacInt32(port + cgpVisRgn), vis) || !region_rect(ReadMacInt32(port + cgpClipRgn), cr))
+            return false;
+        if (!rect_inside(dst_rect, vis) || !rect_inside(dst_rect, cr))
+            return false;
+        sect_rect(clip, dst.bounds);
+    }
+    if (rect_empty(clip))
+        return true;
+    src_rect.top += clip.top - dst_rect.top;
+    src_rect.left += clip.left - dst_rect.left;
+    src_rect.bottom = src_rect.top + (clip.bottom - clip.top);
+    src_rect.right = src_rect.left + (clip.right - clip.left);
+
+    bool src_frame, dst_frame;
+    uint8 *s = pixmap_host_addr(src, src_rect, src_frame);
+    uint8 *d = pixmap_host_addr(dst, clip, dst_frame);
+    if (s == NULL || d == NULL)
+        return false;
+
+    if (src_frame)
+        shield_cursor(src_rect, src);
+    if (dst_frame)
+        shield_cursor(clip, dst);
+
+    // Rows are moved bottom up when scrolling down within one buffer
+    uint32 width = clip.right - clip.left;
+    int height = clip.bottom - clip.top;
+    if (d > s && src.base == dst.base) {
+        for (int y = height - 1; y >= 0; y--)
+            memmove(d + y * dst.row_bytes, s + y * src.row_bytes, width);
+    } else {
+        for (int y = 0; y < height; y++)
+            memmove(d + y * dst.row_bytes, s + y * src.row_bytes, width);
+    }
+
+    // A vertical move within the screen is a scroll: the display moves its pixels
+    int dv = clip.top - src_rect.top;
+    if (src_frame && dst_frame && src.base == dst.base && src.row_bytes == dst.row_bytes
+     && clip.left == src_rect.left && dv != 0)
+        VideoScrollRect(d - MacFrameBaseHost, width, height, dst.row_bytes, dv);
+    else
+        pixmap_written(dst, d, clip, dst_frame);
+
+    if (dst_frame)
+        show_cursor();
+    if (src_frame)
+        show_cursor();
+    return true;
+}
+
+
+/*
+ *  FillRect(r: Rect; pat: Pattern) and EraseRect(r: Rect)
+ */
+
+static bool qd_fillrect(uint32 rect, uint32 pat, uint32 a5)
+{
+    uint32 port = current_port(a5);
+    if (port == 0 || (int16)ReadMacInt16(port + cgpPnVis) < 0)
+        return false;
+
+    // Solid patterns only (EraseRect() uses the background pattern)
+    uint8 pixel;
+    if (!solid_pixel(port, pat, pixel))
+        return false;
+
+    qd_pixmap pm;
+    if (!get_pixmap(port + cgpPortPixMap, pm))
+        return false;
+    qd_rect r;
+    read_rect(rect, r);
+    if (!port_clip(port, pm, r))
+        return false;
+    if (rect_empty(r))
+        return true;
+
+    bool frame;
+    uint8 *d = pixmap_host_addr(pm, r, frame);
+    if (d == NULL)
+        return false;
+
+    if (frame)
+        shield_cursor(r, pm);
+    uint32 width = r.right - r.left;
+    for (int y = r.top; y < r.bottom; y++)
+        memset(d + (y - r.top) * pm.row_bytes, pixel, width);
+    pixmap_written(pm, d, r, frame);
+    if (frame)
+        show_cursor();
+    return true;
+}
+
+
+/*
+ *  ScrollRect(r: Rect; dh, dv: INTEGER; updateRgn: RgnHandle)
+ */
+
+static bool qd_scrollrect(uint32 rect, int16 dh, int16 dv, uint32 update_rgn, uint32 a5)
+{
+    if (dh != 0 || dv == 0 || update_rgn == 0 || ReadMacInt32(update_rgn) == 0)
+        return false;   // Vertical scrolling only
+
+    uint32 port = current_port(a5);
+    if (port == 0 || (int16)ReadMacInt16(port + cgpPnVis) < 0)
+        return false;
+    uint8 pixel;
+    if (!solid_pixel(port, 0, pixel))
+        return false;
+
+    qd_pixmap pm;
+    if (!get_pixmap(port + cgpPortPixMap, pm))
+        return false;
+    qd_rect r;
+    read_rect(rect, r);
+    if (!port_clip(port, pm, r))
+        return false;
+
+    // The rows that stay visible move by dv, the rest is erased and becomes the update region
+    qd_rect moved = r, update = r;
+    if (dv > 0) {
+        moved.top = r.top + dv;
+        update.bottom = (moved.top < r.bottom) ? moved.top : r.bottom;
+    } else {
+        moved.bottom = r.bottom + dv;
+        update.top = (moved.bottom > r.top) ? moved.bottom : r.top;
+    }
+
+    if (!rect_empty(r)) {
+        bool frame;
+        uint8 *base = pixmap_host_addr(pm, r, frame);
+        if (base == NULL)
+            return false;
+
+        if (frame)
+            shield_cursor(r, pm);
+        uint32 width = r.right - r.left;
+        if (!rect_empty(moved)) {
+            uint8 *d = base + (moved.top - r.top) * pm.row_bytes;
+            move_rows(d, d - dv * pm.row_bytes, width, moved.bottom - moved.top, pm.row_bytes, dv);
+            if (frame)
+                VideoScrollRect(d - MacFrameBaseHost, width, moved.bottom - moved.top, pm.row_bytes, dv);
+            else
+                pixmap_written(pm, d, moved, false);
+        }
+        if (!rect_empty(update)) {
+            uint8 *d = base + (update.top - r.top) * pm.row_bytes;
+            for (int y = update.top; y < update.bottom; y++)
+                memset(d + (y - update.top) * pm.row_bytes, pixel, width);
+            pixmap_written(pm, d, update, frame);
+        }
+        if (frame)
+            show_cursor();
+    }
+
+    // SetRectRgn(updateRgn, update)
+    if (rect_empty(update))
+        update.top = update.left = update.bottom = update.right = 0;
+    M68kRegisters regs = *qd_regs;
+    regs.a[0] = update_rgn;
+    regs.d[0] = 10;
+    Execute68kTrap(0xa024, &regs);      // SetHandleSize()
+    uint32 rgn = ReadMacInt32(update_rgn);
+    WriteMacInt16(rgn, 10);
+    WriteMacInt16(rgn + 2, update.top);
+    WriteMacInt16(rgn + 4, update.left);
+    WriteMacInt16(rgn + 6, update.bottom);
+    WriteMacInt16(rgn + 8, update.right);
+    return true;
+}
+
+
+/*
+ *  Trap stub entry: d0 = 0 when drawn natively, otherwise a0 = original trap
+ */
+
+void QuickDrawOp(uint16 opcode, M68kRegisters *r)
+{
+    uint32 sp = r->a[7];
+    bool done = false;
+    uint32 orig = 0;
+
+    qd_regs = r;
+    switch (opcode) {
+        case M68K_EMUL_OP_QD_COPYBITS:
+            done = qd_copybits(sp, r->a[5]);
+            orig = orig_copybits;
+            break;
+        case M68K_EMUL_OP_QD_FILLRECT:
+            done = qd_fillrect(ReadMacInt32(sp + 8), ReadMacInt32(sp + 4), r->a[5]);
+            orig = orig_fillrect;
+            break;
+        case M68K_EMUL_OP_QD_ERASERECT:
+            done = qd_fillrect(ReadMacInt32(sp + 4), 0, r->a[5]);
+            orig = orig_eraserect;
+            break;
+        case M68K_EMUL_OP_QD_SCROLLRECT:
+            done = qd_scrollrect(ReadMacInt32(sp + 12), ReadMacInt16(sp + 10), ReadMacInt16(sp + 8),
+                                 ReadMacInt32(sp + 4), r->a[5]);
+            orig = orig_scrollrect;
+            break;
+    }
+
+    r->d[0] = done ? 0 : 1;
+    r->a[0] = orig;
+}
+
+
+/*
+ *  Install the trap stubs
+ */
+
+static uint32 patch_trap(uint16 trap, uint32 stub)
+{
+    M68kRegisters r;
+    r.d[0] = trap;
+    Execute68kTrap(0xa746, &r);     // GetToolTrapAddress()
+    uint32 orig = r.a[0];
+    r.d[0] = trap;
+    r.a[0] = stub;
+    Execute68kTrap(0xa647, &r);     // SetToolTrapAddress()
+    return orig;
+}
+
+// Offer the call to QuickDrawOp(), pop the arguments when it was handled
+static uint32 write_stub(uint32 p, uint16 opcode, uint16 arg_size)
+{
+    WriteMacInt16(p, opcode); p += 2;
+    WriteMacInt16(p, 0x4a40); p += 2;           // tst.w   d0
+    WriteMacInt16(p, 0x6702); p += 2;           // beq.s   1
+    WriteMacInt16(p, M68K_JMP_A0); p += 2;      // jmp     (a0)
+    WriteMacInt16(p, 0x205f); p += 2;           //1 move.l  (sp)+,a0
+    if (arg_size <= 8) {
+        WriteMacInt16(p, 0x508f | ((arg_size & 7) << 9)); p += 2;  // addq.l  #arg_size,sp
+    } else {
+        WriteMacInt16(p, 0x4fef); p += 2;       // lea     arg_size(sp),sp
+        WriteMacInt16(p, arg_size); p += 2;
+    }
+    WriteMacInt16(p, M68K_JMP_A0); p += 2;      // jmp     (a0)
+    return p;
+}
+
+void QuickDrawInstall(void)
+{
+    if (qd_patch || TwentyFourBitAddressing)
+        return;
+
+    M68kRegisters r;
+    r.d[0] = SIZEOF_qdpatch;
+    Execute68kTrap(0xa71e, &r);     // NewPtrSysClear()
+    if (r.a[0] == 0)
+        return;
+    qd_patch = r.a[0];
+
+    write_stub(qd_patch + qdCopyBitsStub, M68K_EMUL_OP_QD_COPYBITS, 22);
+    write_stub(qd_patch + qdFillRectStub, M68K_EMUL_OP_QD_FILLRECT, 8);
+    write_stub(qd_patch + qdEraseRectStub, M68K_EMUL_OP_QD_ERASERECT, 4);
+    write_stub(qd_patch + qdScrollRectStub, M68K_EMUL_OP_QD_SCROLLRECT, 12);
+    uint32 p = qd_patch + qdShieldCursor;
+    WriteMacInt16(p, 0x2f08); p += 2;           // move.l  a0,-(sp)
+    WriteMacInt16(p, 0x2f00); p += 2;           // move.l  d0,-(sp)
+    WriteMacInt16(p, 0xa855); p += 2;           // ShieldCursor
+    WriteMacInt16(p, M68K_RTS);
+
+    orig_copybits = patch_trap(TRAP_COPYBITS, qd_patch + qdCopyBitsStub);
+    orig_fillrect = patch_trap(TRAP_FILLRECT, qd_patch + qdFillRectStub);
+    orig_eraserect = patch_trap(TRAP_ERASERECT, qd_patch + qdEraseRectStub);
+    orig_scrollrect = patch_trap(TRAP_SCROLLRECT, qd_patch + qdScrollRectStub);
+    D(bug("QuickDraw patches at %08x\n", qd_patch));
+}
+
+void QuickDrawReset(void)
+{
+    qd_patch = 0;
+    orig_copybits = orig_fillrect = orig_eraserect = orig_scrollrect = 0;
+}
+
+#if SAVE_STATE
+/*
+ *  The patch block and the traps it replaced, for hibernate/resume
+ *  (the block itself lives in the system heap, inside the RAM image)
+ */
+void QuickDrawStateIO(savestate *s)
+{
+    savestate_var(s, qd_patch);
+    savestate_var(s, orig_copybits);
+    savestate_var(s, orig_fillrect);
+    savestate_var(s, orig_eraserect);
+    savestate_var(s, orig_scrollrect);
+}
+#endif
+
+#else
+
+void QuickDrawInstall(void)
+{
+}
+
+void QuickDrawReset(void)
+{
+}
+
+void QuickDrawOp(uint16 opcode, M68kRegisters *r)
+{
+    UNUSED(opcode);
+    UNUSED(r);
+}
+
+#endif
@@ -0,0 +1,353 @@
+/*
+ *  remote_esp32.cpp - Remote display stream over USB
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Units managed from a distance had no view of the screen short of a full
+ *  frame buffer grab. With the "remotedisplay" pref (or "set remote 1" on
+ *  the console) the screen is streamed over the USB CDC port to
+ *  tools/remote_view.py, built from the dirty rectangles the video task
+ *  pushes to the panel.
+ *
+ *  The video task only ORs each rectangle it pushes into a grid of
+ *  REMOTE_CELL cells and hands over mode and palette changes. A task of
+ *  its own at the lowest priority on Core 0 takes the grid every
+ *  REMOTE_INTERVAL_MS, reads the changed cells from the frame buffer in
+ *  its own depth (1 to 8-bit indices or 16-bit pixels), PackBits encodes
+ *  them and writes them to the port. When the host reads slowly, only that
+ *  task waits: the grid goes on collecting the changes, so the frames in
+ *  between merge into one and the panel never waits for the stream.
+ *
+ *  Each message is a 12-byte header, "B2RD", type, flags, 2 reserved bytes
+ *  and the payload length, then the payload. Numbers are little-endian,
+ *  colors big-endian RGB565 as the panel takes them:
+ *
+ *    REMOTE_MODE      width, height (16-bit), depth in bits (8-bit)
+ *    REMOTE_PALETTE   256 colors
+ *    REMOTE_RECT      x, y, width, height (16-bit), then the PackBits rows
+ *    REMOTE_FRAME     sequence number (32-bit): show what came before
+ *
+ *  The cursor overlay and the HUD are drawn on the panel only: the viewer
+ *  shows the frame buffer.
+ *
+ *  The port also carries the log and the console. A message goes out with
+ *  one write, which the CDC driver does not interleave with other writes,
+ *  and the viewer skips the text between messages.
+ */
+
+#include "sysdeps.h"
+#include "prefs.h"
+#include "console.h"
+#include "perf_registry.h"
+#include "task_stats.h"
+#include "remote.h"
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#if REMOTE_DISPLAY
+
+#define REMOTE_CELL             32      // Mac pixels per side of a grid cell
+#define REMOTE_MAX_WIDTH        1280
+#define REMOTE_MAX_HEIGHT       720
+#define REMOTE_CELLS_X          (REMOTE_MAX_WIDTH / REMOTE_CELL)
+#define REMOTE_CELLS_Y          ((REMOTE_MAX_HEIGHT + REMOTE_CELL - 1) / REMOTE_CELL)
+#define REMOTE_RUN_CELLS        8       // Widest rectangle in one message
+#define REMOTE_INTERVAL_MS      100     // At most 10 updates a second
+#define REMOTE_TASK_STACK_SIZE  4096
+#define REMOTE_TASK_PRIORITY    1       // Below the video task
+#define REMOTE_TASK_CORE        0
+
+// Raw rectangle, and its worst case PackBits size
+#define REMOTE_RAW_SIZE         (REMOTE_RUN_CELLS * REMOTE_CELL * REMOTE_CELL * 2)
+#define REMOTE_BUFFER_SIZE      (16 + REMOTE_RAW_SIZE + REMOTE_RAW_SIZE / 128 + 16)
+
+enum {
+    REMOTE_MODE = 1,
+    REMOTE_PALETTE,
+    REMOTE_RECT,
+    REMOTE_FRAME
+};
+
+struct remote_mode {
+    const uint8 *frame_buffer;
+    int width, height, depth;
+    uint32 bytes_per_row;
+};
+
+volatile uint32 remote_streaming = 0;   // Stream on (console tunable)
+
+static perf_counter *const perf_bytes = PerfCounter("remote.bytes", PERF_COUNT, PERF_CORE_IO);
+static perf_counter *const perf_rects = PerfCounter("remote.rects", PERF_COUNT, PERF_CORE_IO);
+static perf_counter *const perf_frames = PerfCounter("remote.frames", PERF_COUNT, PERF_CORE_IO);
+static task_stats *const remote_task_stats = TaskStats("remote");
+
+// Handed over by the video task (remote_spinlock)
+static portMUX_TYPE remote_spinlock = portMUX_INITIALIZER_UNLOCKED;
+static remote_mode mode;
+static uint32 mode_version = 0;
+static uint16 palette[256];
+static uint32 palette_version = 0;
+static uint64 dirty[REMOTE_CELLS_Y];    // Bit x of row y: cell changed
+
+static uint8 *message = NULL;           // Message being built (stream task)
+static uint32 sequence = 0;
+
+
+/*
+ *  Video task side
+ */
+
+void RemoteSetMode(const uint8 *frame_buffer, int width, int height, int depth, uint32 bytes_per_row)
+{
+    portENTER_CRITICAL(&remote_spinlock);
+    mode.frame_buffer = frame_buffer;
+    mode.width = width < REMOTE_MAX_WIDTH ? width : REMOTE_MAX_WIDTH;
+    mode.height = height < REMOTE_MAX_HEIGHT ? height : REMOTE_MAX_HEIGHT;
+    mode.depth = depth;
+    mode.bytes_per_row = bytes_per_row;
+    mode_version++;
+    portEXIT_CRITICAL(&remote_spinlock);
+}
+
+void RemoteSetPalette(const uint32 *palette2x)
+{
+    uint16 colors[256];
+    for (int i = 0; i < 256; i++) {
+        colors[i] = (uint16)palette2x[i];
+    }
+    portENTER_CRITICAL(&remote_spinlock);
+    memcpy(palette, colors, sizeof(palette));
+    palette_version++;
+    portEXIT_CRITICAL(&remote_spinlock);
+}
+
+void RemoteMarkDirty(int x, int y, int width, int height)
+{
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    int cx0 = x / REMOTE_CELL, cx1 = (x + width - 1) / REMOTE_CELL;
+    int cy0 = y / REMOTE_CELL, cy1 = (y + height - 1) / REMOTE_CELL;
+    if (cx1 >= REMOTE_CELLS_X) cx1 = REMOTE_CELLS_X - 1;
+    if (cy1 >= REMOTE_CELLS_Y) cy1 = REMOTE_CELLS_Y - 1;
+    uint64 bits = ((2ull << cx1) - 1) & ~((1ull << cx0) - 1);
+    portENTER_CRITICAL(&remote_spinlock);
+    for (int cy = cy0; cy <= cy1; cy++) {
+        dirty[cy] |= bits;
+    }
+    portEXIT_CRITICAL(&remote_spinlock);
+}
+
+
+/*
+ *  Messages (stream task)
+ */
+
+static inline uint8 *put16(uint8 *p, uint32 v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+static inline uint8 *put32(uint8 *p, uint32 v)
+{
+    return put16(put16(p, v), v >> 16);
+}
+
+// Header in front of payload_size bytes already at message + 12
+static void send(int type, uint32 payload_size)
+{
+    uint8 *p = message;
+    *p++ = 'B'; *p++ = '2'; *p++ = 'R'; *p++ = 'D';
+    *p++ = type;
+    *p++ = 0;
+    p = put16(p, 0);
+    put32(p, payload_size);
+    Serial.write(message, 12 + payload_size);
+    perf_add(perf_bytes, 12 + payload_size);
+}
+
+static void send_mode(const remote_mode &m)
+{
+    uint8 *p = message + 12;
+    p = put16(p, m.width);
+    p = put16(p, m.height);
+    *p++ = m.depth;
+    *p++ = 0;
+    send(REMOTE_MODE, p - (message + 12));
+}
+
+static void send_palette(const uint16 *colors)
+{
+    // Kept byte-swapped for M5GFX: in memory order they are big-endian
+    memcpy(message + 12, colors, 256 * sizeof(uint16));
+    send(REMOTE_PALETTE, 256 * sizeof(uint16));
+}
+
+// PackBits: n < 128 copies n + 1 bytes, n > 128 repeats the next byte 257 - n times
+static uint8 *packbits(uint8 *out, const uint8 *src, int size)
+{
+    int i = 0;
+    while (i < size) {
+        int run = 1;
+        while (i + run < size && run < 128 && src[i + run] == src[i]) {
+            run++;
+        }
+        if (run >= 3) {
+            *out++ = 257 - run;
+            *out++ = src[i];
+            i += run;
+            continue;
+        }
+        // Literals up to the next run of three
+        int start = i;
+        while (i < size && i - start < 128) {
+            if (i + 2 < size && src[i] == src[i + 1] && src[i] == src[i + 2]) {
+                break;
+            }
+            i++;
+        }
+        *out++ = i - start - 1;
+        memcpy(out, src + start, i - start);
+        out += i - start;
+    }
+    return out;
+}
+
+// Cells cx0..cx1 of cell row cy, clipped to the screen and whole bytes
+static void send_rect(const remote_mode &m, int cx0, int cx1, int cy)
+{
+    int x = cx0 * REMOTE_CELL;
+    int y = cy * REMOTE_CELL;
+    int width = (cx1 + 1) * REMOTE_CELL - x;
+    int height = REMOTE_CELL;
+    if (x >= m.width || y >= m.height) {
+        return;
+    }
+    if (x + width > m.width) width = m.width - x;
+    if (y + height > m.height) height = m.height - y;
+    int row_bytes = width * m.depth / 8;
+    if (row_bytes <= 0) {
+        return;
+    }
+
+    uint8 *p = message + 12;
+    p = put16(p, x);
+    p = put16(p, y);
+    p = put16(p, width);
+    p = put16(p, height);
+    const uint8 *src = m.frame_buffer + y * m.bytes_per_row + x * m.depth / 8;
+    for (int row = 0; row < height; row++) {
+        p = packbits(p, src, row_bytes);
+        src += m.bytes_per_row;
+    }
+    send(REMOTE_RECT, p - (message + 12));
+    perf_inc(perf_rects);
+}
+
+static void send_frame(void)
+{
+    uint8 *p = put32(message + 12, ++sequence);
+    send(REMOTE_FRAME, p - (message + 12));
+    perf_inc(perf_frames);
+}
+
+
+/*
+ *  Stream task
+ */
+
+static void remoteTask(void *param)
+{
+    UNUSED(param);
+    bool started = false;               // Mode and palette sent since the stream went on
+    uint32 sent_mode = 0, sent_palette = 0;
+    task_run(remote_task_stats);
+    for (;;) {
+        task_wait(remote_task_stats, REMOTE_INTERVAL_MS);
+        vTaskDelay(pdMS_TO_TICKS(REMOTE_INTERVAL_MS));
+        task_run(remote_task_stats);
+        if (!remote_streaming) {
+            started = false;
+            continue;
+        }
+
+        remote_mode m;
+        uint16 colors[256];
+        uint64 cells[REMOTE_CELLS_Y];
+        bool new_mode, new_palette;
+        portENTER_CRITICAL(&remote_spinlock);
+        m = mode;
+        new_mode = !started || mode_version != sent_mode;
+        new_palette = new_mode || palette_version != sent_palette;
+        if (new_palette) {
+            memcpy(colors, palette, sizeof(colors));
+        }
+        sent_mode = mode_version;
+        sent_palette = palette_version;
+        memcpy(cells, dirty, sizeof(cells));
+        memset(dirty, 0, sizeof(dirty));
+        portEXIT_CRITICAL(&remote_spinlock);
+        if (m.frame_buffer == NULL) {
+            continue;
+        }
+
+        // A new mode, or a viewer that just started, gets the whole screen
+        if (new_mode) {
+            send_mode(m);
+            for (int cy = 0; cy < REMOTE_CELLS_Y; cy++) {
+                cells[cy] = (1ull << REMOTE_CELLS_X) - 1;
+            }
+            started = true;
+        }
+        if (new_palette && m.depth <= 8) {
+            send_palette(colors);
+        }
+
+        // Runs of changed cells in each cell row
+        bool any = new_mode || new_palette;
+        for (int cy = 0; cy < REMOTE_CELLS_Y; cy++) {
+            uint64 row = cells[cy];
+            while (row) {
+                int cx0 = __builtin_ctzll(row);
+                int cx1 = cx0;
+                while (cx1 + 1 < REMOTE_CELLS_X && cx1 - cx0 + 1 < REMOTE_RUN_CELLS && (row >> (cx1 + 1)) & 1) {
+                    cx1++;
+                }
+                row &= ~(((2ull << cx1) - 1) & ~((1ull << cx0) - 1));
+                send_rect(m, cx0, cx1, cy);
+                any = true;
+            }
+        }
+        if (any) {
+            send_frame();
+        }
+    }
+}
+
+
+/*
+ *  Interface
+ */
+
+void RemoteInit(void)
+{
+    message = (uint8 *)heap_caps_malloc(REMOTE_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    if (message == NULL ||
+        xTaskCreatePinnedToCore(remoteTask, "Remote", REMOTE_TASK_STACK_SIZE, NULL,
+                                REMOTE_TASK_PRIORITY, NULL, REMOTE_TASK_CORE) != pdPASS) {
+        Serial.println("[REMOTE] WARNING: No remote display stream");
+        return;
+    }
+    remote_streaming = PrefsFindBool("remotedisplay") ? 1 : 0;
+    ConsoleAddTunable("remote", &remote_streaming, 0, 1);
+    if (remote_streaming) {
+        Serial.println("[REMOTE] Streaming the screen over USB (tools/remote_view.py)");
+    }
+}
+
+#endif
@@ -0,0 +1,265 @@
+/*
+ *  rom_flash_esp32.cpp - ROM kept in a flash partition
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The "rom" data partition holds two images: the ROM file as it was read
+ *  from the card, and the ROM as PatchROM() and the slot ROM left it.
+ *
+ *  At boot the ROM file is only opened on the card. If the partition holds
+ *  the same file (path, size and modification time), it is read from
+ *  flash into the PSRAM buffer; otherwise it is read from the card and
+ *  stored. InitAll() patches the PSRAM copy as before. ROMFlashMap() then
+ *  compares the result with the patched image, maps that through the
+ *  flash cache as ROMBaseHost and frees the PSRAM copy. The patched image
+ *  is rewritten only when it differs on a cold boot, after a new ROM or
+ *  other settings (model, screen size, CD-ROM).
+ *
+ *  The header also holds the key of the patched image and the host state
+ *  PatchROM() left behind. When rom_patches.cpp computes the same key on
+ *  the next boot, it reads the patched image instead of patching again.
+ *
+ *  Mac writes to ROM are dropped by rom_bank anyway. The host writes to it
+ *  only at init and when a video mode change patches the slot ROM.
+ *  video.cpp calls ROMFlashUnmap() first when the bytes really change,
+ *  which puts the ROM back into PSRAM for the rest of the session.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "rom_flash.h"
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#if ROM_FLASH
+
+#define DEBUG 0
+#include "debug.h"
+
+#define ROM_FLASH_SUBTYPE   0x40            // "rom" in partitions.csv
+#define ROM_FLASH_MAGIC     0x42325246      // 'B2RF'
+#define ROM_FLASH_VERSION   2
+#define ROM_FLASH_SLOT      0x100000        // Room for the largest ROM
+#define ROM_FLASH_RAW       0x10000         // Image offsets, on 64KB MMU pages
+#define ROM_FLASH_PATCHED   (ROM_FLASH_RAW + ROM_FLASH_SLOT)
+#define ROM_FLASH_STATE     64              // Room for the PatchROM() state
+
+// First sector of the partition, written after the image it describes
+struct rom_flash_header {
+    uint32 magic;
+    uint32 version;
+    uint32 size;            // ROM file size, modification time and path
+    uint32 mtime;
+    char path[64];
+    uint32 patched_size;    // ROMSize of the patched image, 0: not written
+    uint32 patch_key;       // PatchROM() cache key and state, 0: none
+    uint8 patch_state[ROM_FLASH_STATE];
+};
+
+static const esp_partition_t *partition = NULL;
+static const uint8 *flash_rom = NULL;   // Mapping of the patched image
+static esp_partition_mmap_handle_t flash_handle;
+
+static uint32 patch_key = 0;            // Set by PatchROM(), for ROMFlashMap()
+static uint8 patch_state[ROM_FLASH_STATE];
+
+
+/*
+ *  Partition access
+ */
+
+static bool find_partition(void)
+{
+    if (partition == NULL)
+        partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ROM_FLASH_SUBTYPE, "rom");
+    return partition != NULL && partition->size >= ROM_FLASH_PATCHED + ROM_FLASH_SLOT;
+}
+
+static bool read_header(rom_flash_header &h)
+{
+    if (esp_partition_read(partition, 0, &h, sizeof(h)) != ESP_OK)
+        return false;
+    return h.magic == ROM_FLASH_MAGIC && h.version == ROM_FLASH_VERSION;
+}
+
+static bool write_header(const rom_flash_header &h)
+{
+    if (esp_partition_erase_range(partition, 0, partition->erase_size) != ESP_OK)
+        return false;
+    return esp_partition_write(partition, 0, &h, sizeof(h)) == ESP_OK;
+}
+
+// Write an image, header invalidated first so a cut off write is never used
+static bool write_image(uint32 offset, const uint8 *data, uint32 size)
+{
+    uint32 erase = (size + partition->erase_size - 1) & ~(partition->erase_size - 1);
+    return esp_partition_erase_range(partition, 0, partition->erase_size) == ESP_OK &&
+           esp_partition_erase_range(partition, offset, erase) == ESP_OK &&
+           esp_partition_write(partition, offset, data, size) == ESP_OK;
+}
+
+static bool same_file(const rom_flash_header &h, const char *path, uint32 size, uint32 mtime)
+{
+    return h.size == size && h.mtime == mtime && strncmp(h.path, path, sizeof(h.path) - 1) == 0;
+}
+
+
+/*
+ *  Read the ROM file from the copy in flash
+ */
+
+bool ROMFlashLoad(const char *path, uint32 size, uint32 mtime, uint8 *buffer)
+{
+    rom_flash_header h;
+    if (!find_partition() || !read_header(h) || !same_file(h, path, size, mtime))
+        return false;
+
+    uint32 t0 = millis();
+    if (esp_partition_read(partition, ROM_FLASH_RAW, buffer, size) != ESP_OK)
+        return false;
+    Serial.printf("[ROM] %s read from flash in %u ms\n", path, millis() - t0);
+    return true;
+}
+
+
+/*
+ *  Store the ROM file read from the card
+ */
+
+void ROMFlashStore(const char *path, uint32 size, uint32 mtime, const uint8 *buffer)
+{
+    if (!find_partition()) {
+        Serial.println("[ROM] No \"rom\" partition, the ROM stays in PSRAM");
+        return;
+    }
+    if (size > ROM_FLASH_SLOT)
+        return;
+
+    uint32 t0 = millis();
+    rom_flash_header h;
+    memset(&h, 0, sizeof(h));
+    h.magic = ROM_FLASH_MAGIC;
+    h.version = ROM_FLASH_VERSION;
+    h.size = size;
+    h.mtime = mtime;
+    strncpy(h.path, path, sizeof(h.path) - 1);
+    h.patched_size = 0;
+    if (!write_image(ROM_FLASH_RAW, buffer, size) || !write_header(h)) {
+        Serial.println("[ROM] ERROR: Cannot store the ROM in flash");
+        return;
+    }
+    Serial.printf("[ROM] %s stored in flash in %u ms\n", path, millis() - t0);
+}
+
+
+/*
+ *  PatchROM() cache
+ */
+
+bool ROMFlashLoadPatched(uint32 key, void *state, uint32 size)
+{
+    rom_flash_header h;
+    if (size > ROM_FLASH_STATE || !find_partition() || !read_header(h) ||
+        h.patch_key != key || h.patched_size != ROMSize)
+        return false;
+
+    uint32 t0 = millis();
+    if (esp_partition_read(partition, ROM_FLASH_PATCHED, ROMBaseHost, ROMSize) != ESP_OK)
+        return false;
+    memcpy(state, h.patch_state, size);
+    Serial.printf("[ROM] Patched ROM read from flash in %u ms\n", millis() - t0);
+    return true;
+}
+
+void ROMFlashSetPatchState(uint32 key, const void *state, uint32 size)
+{
+    if (size > ROM_FLASH_STATE)
+        return;
+    patch_key = key;
+    memset(patch_state, 0, sizeof(patch_state));
+    memcpy(patch_state, state, size);
+}
+
+
+/*
+ *  Run the patched ROM from flash
+ */
+
+static bool map_patched(const void **p)
+{
+    return esp_partition_mmap(partition, ROM_FLASH_PATCHED, ROM_FLASH_SLOT, ESP_PARTITION_MMAP_DATA,
+                              p, &flash_handle) == ESP_OK;
+}
+
+void ROMFlashMap(bool install)
+{
+    rom_flash_header h;
+    if (!find_partition() || !read_header(h) || ROMSize > ROM_FLASH_SLOT)
+        return;
+
+    const void *p;
+    if (!map_patched(&p))
+        return;
+    if (h.patched_size != ROMSize || memcmp(p, ROMBaseHost, ROMSize) != 0) {
+        esp_partition_munmap(flash_handle);
+        if (!install)
+            return;
+
+        // Settings or ROM changed since the image was written
+        Serial.println("[ROM] Writing the patched ROM to flash...");
+        uint32 t0 = millis();
+        h.patched_size = ROMSize;
+        h.patch_key = patch_key;
+        memcpy(h.patch_state, patch_state, sizeof(h.patch_state));
+        if (!write_image(ROM_FLASH_PATCHED, ROMBaseHost, ROMSize) || !write_header(h) || !map_patched(&p)) {
+            Serial.println("[ROM] ERROR: Cannot write the patched ROM to flash");
+            return;
+        }
+        if (memcmp(p, ROMBaseHost, ROMSize) != 0) {
+            Serial.println("[ROM] ERROR: Patched ROM in flash does not verify");
+            esp_partition_munmap(flash_handle);
+            return;
+        }
+        Serial.printf("[ROM] Written in %u ms\n", millis() - t0);
+    } else if (install && patch_key && h.patch_key != patch_key) {
+        // Same image, patched under a new key (another build): keep it
+        h.patch_key = patch_key;
+        memcpy(h.patch_state, patch_state, sizeof(h.patch_state));
+        write_header(h);
+    }
+
+    uint8 *psram_rom = ROMBaseHost;
+    flash_rom = (const uint8 *)p;
+    memory_set_rom_host((uint8 *)flash_rom);
+    FlushCodeCache(ROMBaseHost, ROMSize);
+    free(psram_rom);
+    Serial.printf("[ROM] Running from flash at %p, %u KB of PSRAM freed\n", flash_rom, ROMSize / 1024);
+}
+
+
+/*
+ *  Back into PSRAM before the host writes to the ROM
+ */
+
+bool ROMFlashUnmap(void)
+{
+    if (flash_rom == NULL || ROMBaseHost != flash_rom)
+        return true;
+
+    uint8 *copy = (uint8 *)ps_malloc(ROMSize);
+    if (copy == NULL) {
+        Serial.println("[ROM] ERROR: No PSRAM for a writable ROM copy");
+        return false;
+    }
+    memcpy(copy, flash_rom, ROMSize);
+
+    // The mapping stays, in case something still points into it
+    memory_set_rom_host(copy);
+    FlushCodeCache(ROMBaseHost, ROMSize);
+    Serial.println("[ROM] Slot ROM patched, running the ROM from PSRAM");
+    return true;
+}
+
+#endif
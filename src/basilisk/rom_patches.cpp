@@ -32,6 +32,11 @@
 #include "video.h"
 #include "extfs.h"
 #include "prefs.h"
+#include "quickdraw.h"
+#include "fixmath.h"
+#include "rsrc_cache.h"
+#include "cursor.h"
+#include "rom_flash.h"
 
 #if ENABLE_MON
 #include "mon.h"
@@ -55,6 +60,7 @@ static uint32 sony_offset;		// ROM offset of .Sony driver
 static uint32 serd_offset;		// ROM offset of SERD resource (serial drivers)
 static uint32 microseconds_offset;	// ROM offset of Microseconds() replacement routine
 static uint32 debugutil_offset;		// ROM offset of DebugUtil() replacement routine
+static uint32 block_move_offset;		// ROM offset of BlockMove() replacement routine
 
 // Prototypes
 uint16 ROMVersion;
@@ -703,6 +709,24 @@ static const uint8 adbop_patch[] = {	// Call ADBOp() completion procedure
 };
 
 
+/*
+ *  Point the BlockMove() trap (and BlockMoveData(), which shares its number)
+ *  at the native replacement routine
+ */
+
+static void install_block_move(void)
+{
+#if USE_NATIVE_BLOCK_MOVE
+	if (block_move_offset == 0)
+		return;
+	M68kRegisters r;
+	r.a[0] = ROMBaseMac + block_move_offset;
+	r.d[0] = 0xa02e;
+	Execute68kTrap(0xa247, &r);		// SetOSTrapAddress()
+#endif
+}
+
+
 /*
  *  Install .Sony, disk and CD-ROM drivers
  */
@@ -722,6 +746,9 @@ void InstallDrivers(uint32 pb)
 	r.d[0] = 0xa08d;
 	Execute68kTrap(0xa247, &r);		// SetOSTrapAddress()
 
+	// Install BlockMove() replacement routine
+	install_block_move();
+
 	// Install disk driver
 	r.a[0] = ROMBaseMac + sony_offset + 0x100;
 	r.d[0] = (uint32)DiskRefNum;
@@ -817,6 +844,24 @@ void InstallSERD(void)
 
 void PatchAfterStartup(void)
 {
+	// The System file installs its own BlockMove(), take the trap back
+	install_block_move();
+
+	// Native CopyBits()/FillRect()/EraseRect() fast paths
+	QuickDrawInstall();
+
+	// Native FixMul()/FixDiv()/LongMul()/BitTst() and friends
+	FixMathInstall();
+
+	// Native GetResource()/Get1Resource() for resources in memory
+	RsrcCacheInstall();
+
+	// Toolbox traps dispatched by op_illg(), once the trap table is known
+	NativeTrapsInstall();
+
+	// Cursor drawn by the video task instead of into the frame buffer
+	CursorInstall();
+
 #if SUPPORTS_EXTFS
 	// Install external file system
 	InstallExtFS();
@@ -824,6 +869,21 @@ void PatchAfterStartup(void)
 }
 
 
+/*
+ *  Forget the patches of the last boot, the system heap they were in is
+ *  gone (called on a MacOS reset, PatchAfterStartup() installs them again)
+ */
+
+void ResetStartupPatches(void)
+{
+	QuickDrawReset();
+	FixMathReset();
+	RsrcCacheReset();
+	NativeTrapsReset();
+	CursorReset();
+}
+
+
 /*
  *  Check ROM version, returns false if ROM version is not supported
  */
@@ -1013,6 +1073,36 @@ static bool patch_rom_classic(void)
 }
 
 // ROM patches for 32-bit clean Mac-II ROMs (version $067c)
+#if FAST_BOOT
+/*
+ *  The ROM waits for hardware with "dbra dN,*" loops, counted in units of
+ *  TimeDBRA and friends, which the patches fake as 10000 per millisecond.
+ *  Interpreted, a 100ms wait is a million DBRAs, and none of the hardware
+ *  is there to wait for. Each such loop becomes an EmulOp that leaves dN
+ *  as the loop would (low word $FFFF, flags untouched), followed by
+ *  "exg dN,dN" to tell it the register and fill the slot.
+ */
+
+static void patch_delay_loops(void)
+{
+	int count = 0;
+	uint16 *wp = (uint16 *)ROMBaseHost;
+	uint16 *end = (uint16 *)(ROMBaseHost + ROMSize) - 1;
+	for (; wp < end; wp++) {
+		uint16 op = ntohs(wp[0]);
+		if ((op & 0xfff8) != 0x51c8 || ntohs(wp[1]) != 0xfffe)	// dbra dN,*
+			continue;
+		int reg = op & 7;
+		wp[0] = htons(M68K_EMUL_OP_DELAY_LOOP);
+		wp[1] = htons(0xc140 | (reg << 9) | reg);				// exg dN,dN
+		wp++;
+		count++;
+	}
+	D(bug("delay loops %d\n", count));
+	printf("Fast boot: %d delay loops in ROM %08x replaced\n", count, ReadMacInt32(ROMBaseMac));
+}
+#endif
+
 static bool patch_rom_32(void)
 {
 	uint16 *wp;
@@ -1572,6 +1662,13 @@ static bool patch_rom_32(void)
 	// Replace Time Manager (the Microseconds patch is activated in InstallDrivers())
 	wp = (uint16 *)(ROMBaseHost + find_rom_trap(0xa058));
 	*wp++ = htons(M68K_EMUL_OP_INSTIME);
+#if USE_NATIVE_BLOCK_MOVE
+	*wp++ = htons(M68K_RTS);
+
+	// Replace BlockMove() (also activated in InstallDrivers())
+	block_move_offset = (uint8 *)wp - ROMBaseHost;
+	*wp++ = htons(M68K_EMUL_OP_BLOCK_MOVE_NATIVE);
+#endif
 	*wp = htons(M68K_RTS);
 	wp = (uint16 *)(ROMBaseHost + find_rom_trap(0xa059));
 	*wp++ = htons(0x40e7);		// move	sr,-(sp)
@@ -1657,15 +1754,120 @@ static bool patch_rom_32(void)
 	*wp++ = htons(M68K_EMUL_OP_IRQ);
 	*wp++ = htons(0x4a80);		// tst.l	d0
 	*wp = htons(0x67f4);		// beq		0x4080a294
+
+#if FAST_BOOT
+	// Replace the delay loops (last, so no other patch finds them changed)
+	if (PrefsFindBool("fastboot"))
+		patch_delay_loops();
+#endif
 	return true;
 }
 
+/*
+ *  Patched ROM cache: on a hit the patched ROM is read back with the host
+ *  state the patches leave behind, and none of the ROM searches run
+ */
+
+#if ROM_FLASH
+struct rom_patch_state {
+	uint32 universal_info, put_scrap_patch, get_scrap_patch;
+	uint32 sony_offset, serd_offset, microseconds_offset, debugutil_offset, block_move_offset;
+	uint32 sony_disk_icon, sony_drive_icon, disk_icon, cdrom_icon;
+};
+
+static uint32 hash_bytes(uint32 h, const void *data, uint32 size)
+{
+	const uint8 *p = (const uint8 *)data;
+	while (size--)
+		h = (h ^ *p++) * 16777619;	// FNV-1a
+	return h;
+}
+
+static uint32 hash_word(uint32 h, uint32 v)
+{
+	return hash_bytes(h, &v, sizeof(v));
+}
+
+// Everything the patches depend on: the ROM (its checksum), this build,
+// the preferences and CPU type they read and the slot ROM they install
+static uint32 patch_cache_key(void)
+{
+	uint32 h = 2166136261u;
+	h = hash_word(h, ReadMacInt32(ROMBaseMac));
+	h = hash_word(h, ROMSize);
+	h = hash_word(h, ROMVersion);
+	h = hash_bytes(h, __DATE__ " " __TIME__, sizeof(__DATE__ " " __TIME__));
+	h = hash_word(h, PrefsFindInt32("modelid"));
+	h = hash_word(h, CPUType);
+	h = hash_word(h, FPUType);
+	h = hash_word(h, PatchHWBases);
+	h = hash_word(h, FAST_BOOT && PrefsFindBool("fastboot"));
+	h = hash_word(h, ROMBaseMac);
+	h = hash_word(h, RAMBaseMac);
+	if (ROMVersion == ROM_VERSION_32) {
+		int size;
+		const uint8 *srom = BuildSlotROM(size);
+		if (srom == NULL)
+			return 0;
+		h = hash_bytes(h, srom, size);
+	}
+	return h ? h : 1;
+}
+
+static bool patch_cache_load(uint32 key)
+{
+	rom_patch_state s;
+	if (!ROMFlashLoadPatched(key, &s, sizeof(s)))
+		return false;
+	UniversalInfo = s.universal_info;
+	PutScrapPatch = s.put_scrap_patch;
+	GetScrapPatch = s.get_scrap_patch;
+	sony_offset = s.sony_offset;
+	serd_offset = s.serd_offset;
+	microseconds_offset = s.microseconds_offset;
+	debugutil_offset = s.debugutil_offset;
+	block_move_offset = s.block_move_offset;
+	SonyDiskIconAddr = s.sony_disk_icon;
+	SonyDriveIconAddr = s.sony_drive_icon;
+	DiskIconAddr = s.disk_icon;
+	CDROMIconAddr = s.cdrom_icon;
+	return true;
+}
+
+static void patch_cache_store(uint32 key)
+{
+	rom_patch_state s;
+	s.universal_info = UniversalInfo;
+	s.put_scrap_patch = PutScrapPatch;
+	s.get_scrap_patch = GetScrapPatch;
+	s.sony_offset = sony_offset;
+	s.serd_offset = serd_offset;
+	s.microseconds_offset = microseconds_offset;
+	s.debugutil_offset = debugutil_offset;
+	s.block_move_offset = block_move_offset;
+	s.sony_disk_icon = SonyDiskIconAddr;
+	s.sony_drive_icon = SonyDriveIconAddr;
+	s.disk_icon = DiskIconAddr;
+	s.cdrom_icon = CDROMIconAddr;
+	ROMFlashSetPatchState(key, &s, sizeof(s));
+}
+#endif
+
 bool PatchROM(void)
 {
 	// Print some information about the ROM
 	if (PrintROMInfo)
 		print_rom_info();
 
+#if ROM_FLASH
+	// A breakpoint is not part of the cached image
+	uint32 key = ROMBreakpoint ? 0 : patch_cache_key();
+	if (key && patch_cache_load(key)) {
+		FlushCodeCache(ROMBaseHost, ROMSize);
+		return true;
+	}
+#endif
+
 	// Patch ROM depending on version
 	switch (ROMVersion) {
 		case ROM_VERSION_CLASSIC:
@@ -1680,6 +1882,11 @@ bool PatchROM(void)
 			return false;
 	}
 
+#if ROM_FLASH
+	if (key)
+		patch_cache_store(key);
+#endif
+
 	// Install breakpoint
 	if (ROMBreakpoint) {
 #if ENABLE_MON
@@ -0,0 +1,343 @@
+/*
+ *  rsrc_cache.cpp - Native GetResource() lookups with a cache
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Launching an application or opening a window makes hundreds of
+ *  GetResource() and Get1Resource() calls. The ROM answers each of them by
+ *  walking the resource chain in interpreted 68k. For each map it scans
+ *  the type list and then the reference list of the type. The two traps
+ *  are head patched with stubs that first offer the call to RsrcCacheOp().
+ *  It walks the chain natively. A direct-mapped table remembers where
+ *  (type, ID) is in each map's reference list, or that the map does not
+ *  have it. Repeated lookups, and lookups that pass through the
+ *  application's maps down to the System file, then skip the scans.
+ *
+ *  The call goes to the ROM (or the System's patch) unless the resource is
+ *  found and its data is in memory. A resource that still has to be read,
+ *  one not found anywhere, a chain that does not start at CurMap, maps
+ *  outside RAM and RomMapInsert set are all left to the ROM.
+ *
+ *  The table is keyed by map handle and holds offsets into the map, so a
+ *  map moved by the Memory Manager stays valid. The traps that change maps
+ *  or close them (AddResource(), RmveResource(), SetResInfo(),
+ *  UpdateResFile(), CloseResFile(), RsrcZoneInit() and ResourceDispatch())
+ *  are head patched to start a new table generation first.
+ *
+ *  The "nonativersrc" pref leaves the traps alone. Once installed, the
+ *  console's "set nativersrc 0" makes the stubs jump to the previous trap
+ *  addresses instead.
+ */
+
+#include <string.h>
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "prefs.h"
+#include "emul_op.h"
+#include "console.h"
+#include "perf_registry.h"
+#include "rsrc_cache.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+#if USE_NATIVE_RSRC
+
+// Low memory globals
+#define TopMapHndl      0xa50
+#define CurMap          0xa5a
+#define ResErr          0xa60
+#define RomMapInsert    0xb9e
+
+// Resource map fields
+#define mapNext         16
+#define mapRefNum       20
+#define mapTypeList     24
+
+#define RSRC_CACHE_ENTRIES  512     // Power of two, 8KB
+#define RSRC_MAX_MAPS       64      // Longer chains are left to the ROM
+
+// Trap selectors (d0 of M68K_EMUL_OP_RSRC_GET)
+enum {
+    rcGetResource,
+    rcGet1Resource,
+    RSRC_GET_TRAPS
+};
+
+static const uint16 get_traps[RSRC_GET_TRAPS] = {
+    0xa9a0,                         // GetResource(theType: ResType; theID: INTEGER): Handle
+    0xa81f                          // Get1Resource(theType: ResType; theID: INTEGER): Handle
+};
+
+static const uint16 change_traps[] = {
+    0xa9ab,                         // AddResource()
+    0xa9ad,                         // RmveResource()
+    0xa9a9,                         // SetResInfo()
+    0xa999,                         // UpdateResFile()
+    0xa99a,                         // CloseResFile()
+    0xa996,                         // RsrcZoneInit()
+    0xa822                          // ResourceDispatch()
+};
+#define RSRC_CHANGE_TRAPS (sizeof(change_traps) / sizeof(change_traps[0]))
+
+#define RSRC_GET_STUB_SIZE      16
+#define RSRC_CHANGE_STUB_SIZE   8
+
+struct rsrc_entry {
+    uint32 map;                     // Map handle, 0: empty
+    uint32 type;
+    int16 id;
+    uint16 gen;                     // rsrc_gen when stored
+    uint32 ref;                     // Reference list entry, offset into the map, 0: not in the map
+};
+
+static rsrc_entry rsrc_cache[RSRC_CACHE_ENTRIES];
+static uint16 rsrc_gen = 1;
+static uint32 rsrc_patch = 0;               // Mac address of the stubs
+static volatile uint32 native_rsrc = 1;     // 0: stubs jump to the previous traps
+
+static perf_counter *const perf_native = PerfCounter("rsrc.native", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_rom = PerfCounter("rsrc.rom", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_misses = PerfCounter("rsrc.cache_misses", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_flushes = PerfCounter("rsrc.flushes", PERF_COUNT, PERF_CORE_CPU);
+
+
+/*
+ *  Resource maps
+ */
+
+static bool in_ram(uint32 addr, uint32 size)
+{
+    return addr < RAMSize && size <= RAMSize - addr;
+}
+
+// Map of a map handle, 0 if it is not plain RAM
+static uint32 deref_map(uint32 h)
+{
+    if (!in_ram(h, 4))
+        return 0;
+    uint32 map = ReadMacInt32(h);
+    return in_ram(map, mapTypeList + 2) ? map : 0;
+}
+
+// Reference list entry of (type, id), as an offset into the map, 0 if the
+// map does not have it. false if the map is not plain RAM.
+static bool map_find(uint32 map, uint32 type, int16 id, uint32 &ref)
+{
+    ref = 0;
+    uint32 types = map + ReadMacInt16(map + mapTypeList);
+    if (!in_ram(types, 2))
+        return false;
+    uint32 ntypes = (uint16)(ReadMacInt16(types) + 1);
+    if (!in_ram(types + 2, ntypes * 8))
+        return false;
+    for (uint32 t = types + 2; ntypes--; t += 8) {
+        if (ReadMacInt32(t) != type)
+            continue;
+        uint32 nrefs = (uint16)(ReadMacInt16(t + 4) + 1);
+        uint32 refs = types + ReadMacInt16(t + 6);
+        if (!in_ram(refs, nrefs * 12))
+            return false;
+        for (uint32 r = refs; nrefs--; r += 12) {
+            if ((int16)ReadMacInt16(r) == id) {
+                ref = r - map;
+                return true;
+            }
+        }
+        return true;
+    }
+    return true;
+}
+
+// Cached map_find(), keyed by map handle
+static bool lookup(uint32 h, uint32 map, uint32 type, int16 id, uint32 &ref)
+{
+    uint32 hash = h ^ (type * 0x9e3779b1) ^ ((uint32)(uint16)id * 0x85ebca6b);
+    rsrc_entry &e = rsrc_cache[(hash ^ (hash >> 15)) & (RSRC_CACHE_ENTRIES - 1)];
+    if (e.map == h && e.type == type && e.id == id && e.gen == rsrc_gen) {
+        ref = e.ref;
+        // A map changed behind the patched traps' back is left to the ROM
+        return ref == 0 || (in_ram(map + ref, 12) && (int16)ReadMacInt16(map + ref) == id);
+    }
+    perf_inc(perf_misses);
+    if (!map_find(map, type, id, ref))
+        return false;
+    e.map = h;
+    e.type = type;
+    e.id = id;
+    e.gen = rsrc_gen;
+    e.ref = ref;
+    return true;
+}
+
+// Handle of the resource in the chain from CurMap (only that map for
+// Get1Resource()), 0 to leave the call to the ROM
+static uint32 find_resource(uint32 type, int16 id, bool one_map)
+{
+    if (ReadMacInt8(RomMapInsert))
+        return 0;
+
+    // The current map
+    int16 cur = ReadMacInt16(CurMap);
+    uint32 h = ReadMacInt32(TopMapHndl);
+    uint32 map = 0;
+    int maps = 0;
+    for (; h; h = ReadMacInt32(map + mapNext)) {
+        if ((map = deref_map(h)) == 0 || ++maps > RSRC_MAX_MAPS)
+            return 0;
+        if ((int16)ReadMacInt16(map + mapRefNum) == cur)
+            break;
+    }
+
+    for (; h; h = ReadMacInt32(map + mapNext)) {
+        if ((map = deref_map(h)) == 0 || ++maps > RSRC_MAX_MAPS)
+            return 0;
+        uint32 ref;
+        if (!lookup(h, map, type, id, ref))
+            return 0;
+        if (ref) {
+            // Only data in memory is returned, the ROM reads the rest
+            uint32 handle = ReadMacInt32(map + ref + 8);
+            if (!in_ram(handle, 4) || ReadMacInt32(handle) == 0)
+                return 0;
+            return handle;
+        }
+        if (one_map)
+            break;
+    }
+    return 0;
+}
+
+
+/*
+ *  Trap stub entries
+ */
+
+// d0 = trap selector; d0 = 0 when handled (arguments popped, result
+// stored), otherwise the stub jumps to the previous trap
+void RsrcCacheOp(M68kRegisters *r)
+{
+    uint32 sel = r->d[0];
+    r->d[0] = 1;
+    if (!native_rsrc || sel >= RSRC_GET_TRAPS)
+        return;
+
+    uint32 sp = r->a[7];
+    uint32 handle = find_resource(ReadMacInt32(sp + 6), ReadMacInt16(sp + 4), sel == rcGet1Resource);
+    if (handle == 0) {
+        perf_inc(perf_rom);
+        return;
+    }
+    WriteMacInt32(sp + 10, handle);
+    WriteMacInt16(ResErr, 0);
+
+    // Pop the arguments, the stub returns with rts
+    WriteMacInt32(sp + 6, ReadMacInt32(sp));
+    r->a[7] = sp + 6;
+    r->d[0] = 0;
+    perf_inc(perf_native);
+}
+
+// A resource map may change, registers untouched
+void RsrcCacheFlush(void)
+{
+    if (++rsrc_gen == 0) {
+        memset(rsrc_cache, 0, sizeof(rsrc_cache));
+        rsrc_gen = 1;
+    }
+    perf_inc(perf_flushes);
+}
+
+
+/*
+ *  Install the trap stubs
+ */
+
+// Offer the call to RsrcCacheOp(), jump to the previous trap when declined
+static void write_get_stub(uint32 p, int sel, uint32 orig)
+{
+    WriteMacInt16(p, 0x7000 | sel); p += 2;             // moveq   #sel,d0
+    WriteMacInt16(p, M68K_EMUL_OP_RSRC_GET); p += 2;
+    WriteMacInt16(p, 0x4a40); p += 2;                   // tst.w   d0
+    WriteMacInt16(p, 0x6706); p += 2;                   // beq.s   1
+    WriteMacInt16(p, M68K_JMP); p += 2;                 // jmp     orig
+    WriteMacInt32(p, orig); p += 4;
+    WriteMacInt16(p, M68K_RTS);                         //1 rts
+}
+
+// New table generation, then the previous trap with the registers as they were
+static void write_change_stub(uint32 p, uint32 orig)
+{
+    WriteMacInt16(p, M68K_EMUL_OP_RSRC_CHANGED); p += 2;
+    WriteMacInt16(p, M68K_JMP); p += 2;                 // jmp     orig
+    WriteMacInt32(p, orig);
+}
+
+static void install_stub(uint16 trap, uint32 stub, uint32 size, int sel)
+{
+    M68kRegisters r;
+    r.d[0] = trap;
+    Execute68kTrap(0xa746, &r);     // GetToolTrapAddress()
+    if (sel >= 0)
+        write_get_stub(stub, sel, r.a[0]);
+    else
+        write_change_stub(stub, r.a[0]);
+    FlushCodeCache(Mac2HostAddr(stub), size);
+    r.d[0] = trap;
+    r.a[0] = stub;
+    Execute68kTrap(0xa647, &r);     // SetToolTrapAddress()
+}
+
+void RsrcCacheInstall(void)
+{
+    if (rsrc_patch || PrefsFindBool("nonativersrc"))
+        return;
+
+    M68kRegisters r;
+    r.d[0] = RSRC_GET_TRAPS * RSRC_GET_STUB_SIZE + RSRC_CHANGE_TRAPS * RSRC_CHANGE_STUB_SIZE;
+    Execute68kTrap(0xa71e, &r);     // NewPtrSysClear()
+    if (r.a[0] == 0)
+        return;
+    rsrc_patch = r.a[0];
+    RsrcCacheFlush();
+
+    // The changes are seen before any lookup is answered; each stub is
+    // complete before its trap points at it
+    uint32 stub = rsrc_patch + RSRC_GET_TRAPS * RSRC_GET_STUB_SIZE;
+    for (uint32 i = 0; i < RSRC_CHANGE_TRAPS; i++, stub += RSRC_CHANGE_STUB_SIZE)
+        install_stub(change_traps[i], stub, RSRC_CHANGE_STUB_SIZE, -1);
+    for (int i = 0; i < RSRC_GET_TRAPS; i++)
+        install_stub(get_traps[i], rsrc_patch + i * RSRC_GET_STUB_SIZE, RSRC_GET_STUB_SIZE, i);
+
+    ConsoleAddTunable("nativersrc", &native_rsrc, 0, 1);
+    D(bug("Resource lookup patches at %08x\n", rsrc_patch));
+}
+
+void RsrcCacheReset(void)
+{
+    rsrc_patch = 0;
+    RsrcCacheFlush();
+}
+
+#else
+
+void RsrcCacheInstall(void)
+{
+}
+
+void RsrcCacheReset(void)
+{
+}
+
+void RsrcCacheOp(M68kRegisters *r)
+{
+    UNUSED(r);
+}
+
+void RsrcCacheFlush(void)
+{
+}
+
+#endif
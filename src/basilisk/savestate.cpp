@@ -0,0 +1,316 @@
+/*
+ *  savestate.cpp - Machine state snapshots (hibernate/resume)
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  A cold boot goes through the ROM, InitAll() and a full Mac OS startup
+ *  from the SD disk image. Hibernating writes the whole machine to one file
+ *  instead: CPU and FPU registers, Mac RAM, the ROM (video mode switches
+ *  patch it), the frame buffer, XPRAM, and the host side state of the ADB,
+ *  Time Manager, video, QuickDraw and disk drivers. At the next boot
+ *  InitAll() sets everything up as usual, SaveStateRestore() overwrites it
+ *  from the file and the CPU carries on where it stopped. RAM, ROM and frame
+ *  buffer are one fread()/fwrite() each, so resuming takes about as long as
+ *  the SD card needs to read the file.
+ *
+ *  A snapshot is only taken between two instructions of the outermost
+ *  m68k_execute(). Deeper down, an EmulOp's host code is on the C stack and
+ *  cannot be saved. Disk images are flushed first. Once the snapshot has
+ *  been resumed, or a cold boot chosen instead, the disk image moves on
+ *  without it, so the device deletes the file. The host build discards
+ *  disk writes and keeps the file for repeated runs.
+ */
+
+#include "sysdeps.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef ARDUINO
+#include <esp_system.h>
+#endif
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "sys.h"
+#include "xpram.h"
+#include "timer.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "savestate.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+#if SAVE_STATE
+
+#ifdef ARDUINO
+#define SAVESTATE_FILE      "/sd/basilisk.state"
+#else
+#define SAVESTATE_FILE      "basilisk.state"
+#endif
+#define SAVESTATE_TEMP      SAVESTATE_FILE ".new"
+
+#define SAVESTATE_MAGIC     0x42325353      // "B2SS"
+#define SAVESTATE_VERSION   3
+#define SAVESTATE_END       0x454e4421      // "END!"
+#define SAVESTATE_BUFFER    32768           // stdio buffer for the small sections
+
+extern bool quit_program;
+
+// File header, checked before anything is restored
+struct savestate_header {
+    uint32 magic;
+    uint32 version;
+    uint32 file_size;       // Whole file, so a short write is rejected
+    uint32 ram_size;
+    uint32 rom_size;
+    uint32 rom_checksum;    // First long of the ROM image
+    uint32 frame_size;
+    uint32 xpram_size;
+};
+
+struct savestate {
+    FILE *f;
+    bool loading;
+    const char *error;      // First failure, NULL while all is well
+    bool committed;         // Past the drive lists, the machine is being overwritten
+};
+
+static volatile bool save_requested = false;
+
+
+/*
+ *  Stream access for the modules' state functions
+ */
+void savestate_io(savestate *s, void *data, uint32 size)
+{
+    if (s->error != NULL || size == 0)
+        return;
+    size_t done = s->loading ? fread(data, 1, size, s->f) : fwrite(data, 1, size, s->f);
+    if (done != size)
+        savestate_fail(s, s->loading ? "read error" : "write error");
+}
+
+bool savestate_loading(const savestate *s)
+{
+    return s->loading;
+}
+
+void savestate_fail(savestate *s, const char *why)
+{
+    if (s->error == NULL)
+        s->error = why;
+}
+
+
+/*
+ *  Header describing this machine
+ */
+static void init_header(savestate_header &h)
+{
+    memset(&h, 0, sizeof(h));
+    h.magic = SAVESTATE_MAGIC;
+    h.version = SAVESTATE_VERSION;
+    h.ram_size = RAMSize;
+    h.rom_size = ROMSize;
+    h.rom_checksum = ReadMacInt32(ROMBaseMac);
+    h.frame_size = MacFrameMaxSize;
+    h.xpram_size = XPRAM_SIZE;
+}
+
+
+/*
+ *  All sections, in file order
+ */
+static void state_sections(savestate *s)
+{
+    // Drive lists first: they are compared with the drives InitAll() has
+    // just opened, and a mismatch stops the restore before anything else
+    SonyStateIO(s);
+    DiskStateIO(s);
+    CDROMStateIO(s);
+    if (s->error != NULL)
+        return;
+    s->committed = true;
+
+    CPUStateIO(s);
+    FPUStateIO(s);
+    ADBStateIO(s);
+    TimerStateIO(s);
+    VideoStateIO(s);
+#if USE_NATIVE_QUICKDRAW
+    QuickDrawStateIO(s);
+#endif
+#if USE_CURSOR_OVERLAY
+    CursorStateIO(s);
+#endif
+    savestate_var(s, InterruptFlags);
+    savestate_io(s, XPRAM, XPRAM_SIZE);
+
+    // Bulk data last, in long sequential transfers
+    savestate_io(s, RAMBaseHost, RAMSize);
+    savestate_io(s, ROMBaseHost, ROMSize);
+    savestate_io(s, MacFrameBaseHost, MacFrameSize);
+
+    uint32 end = SAVESTATE_END;
+    savestate_var(s, end);
+    if (end != SAVESTATE_END)
+        savestate_fail(s, "sections out of step");
+}
+
+
+/*
+ *  Write the snapshot (to a temporary file, renamed once complete)
+ */
+static bool write_state(void)
+{
+    uint32 t0 = millis();
+
+    // The disk images must match the snapshot
+    Sys_sync();
+
+    FILE *f = fopen(SAVESTATE_TEMP, "wb");
+    if (f == NULL) {
+        Serial.printf("[STATE] ERROR: Cannot create %s\n", SAVESTATE_TEMP);
+        return false;
+    }
+    setvbuf(f, NULL, _IOFBF, SAVESTATE_BUFFER);
+
+    savestate s = {f, false, NULL, false};
+    savestate_header h;
+    init_header(h);
+    savestate_var(&s, h);
+    state_sections(&s);
+
+    // Now that the size is known, rewrite the header with it
+    h.file_size = (uint32)ftell(f);
+    if (s.error == NULL && (fseek(f, 0, SEEK_SET) != 0 || fwrite(&h, sizeof(h), 1, f) != 1))
+        savestate_fail(&s, "write error");
+    if (fclose(f) != 0)
+        savestate_fail(&s, "write error");
+
+    if (s.error == NULL) {
+        remove(SAVESTATE_FILE);
+        if (rename(SAVESTATE_TEMP, SAVESTATE_FILE) != 0)
+            savestate_fail(&s, "cannot rename");
+    }
+    if (s.error != NULL) {
+        Serial.printf("[STATE] ERROR: Snapshot failed (%s)\n", s.error);
+        remove(SAVESTATE_TEMP);
+        return false;
+    }
+
+    Serial.printf("[STATE] Saved %u KB to %s in %ums\n", h.file_size / 1024, SAVESTATE_FILE,
+                  (uint32)(millis() - t0));
+    return true;
+}
+
+
+/*
+ *  Hibernate at the next safe point
+ */
+void SaveStateRequest(void)
+{
+    save_requested = true;
+}
+
+bool SaveStatePoll(void)
+{
+    // Only between instructions of the outermost m68k_execute()
+    if (!save_requested || m68k_execute_depth != 1)
+        return false;
+    save_requested = false;
+
+    if (write_state()) {
+        Serial.println("[STATE] Hibernated, safe to power off");
+        QuitEmulator();
+        quit_program = true;
+        SPCFLAGS_SET(SPCFLAG_BRK);
+    }
+    return true;
+}
+
+
+/*
+ *  Resume from the snapshot
+ */
+bool SaveStateRestore(void)
+{
+    uint32 t0 = millis();
+
+    FILE *f = fopen(SAVESTATE_FILE, "rb");
+    if (f == NULL) {
+        Serial.println("[STATE] No snapshot to resume");
+        return false;
+    }
+    setvbuf(f, NULL, _IOFBF, SAVESTATE_BUFFER);
+
+    savestate_header h, want;
+    init_header(want);
+    const char *why = NULL;
+    if (fread(&h, sizeof(h), 1, f) != 1 || fseek(f, 0, SEEK_END) != 0)
+        why = "read error";
+    else if (h.magic != want.magic || h.version != want.version)
+        why = "not a snapshot of this version";
+    else if (h.file_size != (uint32)ftell(f))
+        why = "incomplete file";
+    else if (h.ram_size != want.ram_size || h.rom_size != want.rom_size || h.rom_checksum != want.rom_checksum ||
+             h.frame_size != want.frame_size || h.xpram_size != want.xpram_size)
+        why = "different ROM or RAM size";
+    else if (fseek(f, sizeof(h), SEEK_SET) != 0)
+        why = "read error";
+    if (why != NULL) {
+        Serial.printf("[STATE] Cannot resume %s: %s\n", SAVESTATE_FILE, why);
+        fclose(f);
+        return false;
+    }
+
+    savestate s = {f, true, NULL, false};
+    state_sections(&s);
+    fclose(f);
+
+    if (s.error != NULL) {
+        Serial.printf("[STATE] Cannot resume %s: %s\n", SAVESTATE_FILE, s.error);
+        if (!s.committed)
+            return false;
+
+        // Part of the machine has been overwritten: start again with a cold boot
+        remove(SAVESTATE_FILE);
+#ifdef ARDUINO
+        esp_restart();
+#else
+        exit(1);
+#endif
+    }
+
+#if USE_DECODE_CACHE
+    // Traces were decoded from the RAM and ROM contents InitAll() left
+    m68k_dcache_flush();
+#endif
+
+    // The clock stood still while the machine was off
+    WriteMacInt32(0x20c, TimerDateTime());
+
+#ifdef ARDUINO
+    remove(SAVESTATE_FILE);
+#endif
+    Serial.printf("[STATE] Resumed from %s (%u KB) in %ums\n", SAVESTATE_FILE, h.file_size / 1024,
+                  (uint32)(millis() - t0));
+    return true;
+}
+
+/*
+ *  Delete the snapshot before a cold boot
+ */
+void SaveStateDiscard(void)
+{
+#ifdef ARDUINO
+    if (remove(SAVESTATE_FILE) == 0)
+        Serial.printf("[STATE] Discarded %s for a cold boot\n", SAVESTATE_FILE);
+#endif
+}
+
+#endif /* SAVE_STATE */
@@ -0,0 +1,85 @@
+/*
+ *  sdcard_esp32.cpp - SD card file system (SDMMC 4-bit bus, SPI fallback)
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The Tab5's microSD slot is wired to the ESP32-P4's SDMMC slot 0 IOMUX
+ *  pins, so the card can run on the 4-bit SD bus at 40MHz (high speed)
+ *  instead of SPI at 25MHz, roughly six times the bandwidth for booting,
+ *  launching applications and installers. Cards that do not come up on the
+ *  SD bus (high speed, then default speed) are mounted over SPI on the same
+ *  wires as before. Either way the card is mounted at /sd, so stdio and
+ *  POSIX paths ("/sd/basilisk.state", the disk images) work with both, and
+ *  everything else opens files through SDCard().
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <SD.h>
+#include <SD_MMC.h>
+
+#include "sysdeps.h"
+#include "sdcard.h"
+
+// M5Stack Tab5 microSD slot (SDMMC slot 0)
+#define SD_MMC_CLK   43
+#define SD_MMC_CMD   44
+#define SD_MMC_D0    39
+#define SD_MMC_D1    40
+#define SD_MMC_D2    41
+#define SD_MMC_D3    42
+
+// The same wires in SPI mode
+#define SD_SPI_SCK   SD_MMC_CLK
+#define SD_SPI_MOSI  SD_MMC_CMD
+#define SD_SPI_MISO  SD_MMC_D0
+#define SD_SPI_CS    SD_MMC_D3
+#define SD_SPI_FREQ  25000000
+
+// Files open at once: disk images, the state file and the shared folder's
+// forks (see extfs.cpp)
+#define SD_MAX_FILES 16
+
+static fs::FS *card_fs = &SD;
+
+/*
+ *  Try the SDMMC host at one bus frequency (kHz)
+ */
+static bool begin_sdmmc(int freq_khz)
+{
+    if (!SD_MMC.setPins(SD_MMC_CLK, SD_MMC_CMD, SD_MMC_D0, SD_MMC_D1, SD_MMC_D2, SD_MMC_D3)) {
+        return false;
+    }
+    if (!SD_MMC.begin(SD_MOUNT_POINT, false, false, freq_khz, SD_MAX_FILES)) {
+        SD_MMC.end();
+        return false;
+    }
+    return true;
+}
+
+bool SDCardInit(void)
+{
+#if USE_SDMMC
+    if (begin_sdmmc(SDMMC_FREQ_HIGHSPEED) || begin_sdmmc(SDMMC_FREQ_DEFAULT)) {
+        card_fs = &SD_MMC;
+        Serial.printf("[SD] SDMMC 4-bit bus, %lluMB\n", SD_MMC.cardSize() / (1024 * 1024));
+        return true;
+    }
+    Serial.println("[SD] No card on the SDMMC bus, trying SPI");
+#endif
+
+    Serial.printf("[SD] SPI pins: SCK=%d, MOSI=%d, MISO=%d, CS=%d\n",
+                  SD_SPI_SCK, SD_SPI_MOSI, SD_SPI_MISO, SD_SPI_CS);
+    SPI.begin(SD_SPI_SCK, SD_SPI_MISO, SD_SPI_MOSI, SD_SPI_CS);
+    if (!SD.begin(SD_SPI_CS, SPI, SD_SPI_FREQ, SD_MOUNT_POINT, SD_MAX_FILES)) {
+        return false;
+    }
+    card_fs = &SD;
+    Serial.printf("[SD] SPI bus at %dMHz, %lluMB\n", SD_SPI_FREQ / 1000000, SD.cardSize() / (1024 * 1024));
+    return true;
+}
+
+fs::FS &SDCard(void)
+{
+    return *card_fs;
+}
@@ -0,0 +1,548 @@
+/*
+ *  serial_esp32.cpp - Serial device driver, ESP32 implementation
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The Mac's modem port (A) and printer port (B) are connected with the
+ *  seriala and serialb prefs: "usb" is the USB CDC port that also carries
+ *  the console, "uart" is UART1 on the Grove connector, anything else
+ *  leaves the port unavailable.
+ *
+ *  The UART and USB drivers already buffer in both directions (filled and
+ *  drained by their interrupts), so the port uses those buffers as its
+ *  rings instead of keeping another copy. A Prime whose data is already
+ *  there, or whose output fits in the driver's transmit buffer, completes
+ *  at once on the CPU task without the deferred task. Otherwise the
+ *  request is left to the serial task on Core 0, which moves data straight
+ *  between the driver and the Mac's buffer as it comes. It raises
+ *  INTFLAG_SERIAL once per pass for all the requests it finished, never
+ *  once per byte.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "macos_util.h"
+#include "prefs.h"
+#include "serial.h"
+#include "serial_defs.h"
+
+#include <Arduino.h>
+#include <HardwareSerial.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// UART1 pins (Grove Port C on the Tab5)
+#ifndef SERIAL_UART_RX_PIN
+#define SERIAL_UART_RX_PIN 7
+#endif
+#ifndef SERIAL_UART_TX_PIN
+#define SERIAL_UART_TX_PIN 6
+#endif
+
+#define SERIAL_TASK_STACK_SIZE 3072
+#define SERIAL_TASK_PRIORITY   2
+#define SERIAL_TASK_CORE       0
+#define SERIAL_POLL_MS         2        // Service interval while a request is pending
+#define SERIAL_BUFFER_SIZE     4096     // UART driver receive and transmit buffers
+#define SERIAL_CHUNK           512      // Most bytes moved per step
+
+enum {
+    DEV_NONE,
+    DEV_USB,
+    DEV_UART
+};
+
+class ESPSERDPort : public SERDPort {
+public:
+    ESPSERDPort(const char *dev_name);
+    virtual ~ESPSERDPort() {}
+
+    virtual int16 open(uint16 config);
+    virtual int16 prime_in(uint32 pb, uint32 dce);
+    virtual int16 prime_out(uint32 pb, uint32 dce);
+    virtual int16 control(uint32 pb, uint32 dce, uint16 code);
+    virtual int16 status(uint32 pb, uint32 dce, uint16 code);
+    virtual int16 close(void);
+
+    bool service(void);
+
+    int device;             // DEV_NONE, DEV_USB or DEV_UART
+    volatile bool active;   // Device is open, the serial task looks after it
+
+private:
+    int available(void);
+    size_t read(uint8 *buf, size_t length);
+    int write_space(void);
+    size_t write(const uint8 *buf, size_t length);
+    void configure(uint16 config);
+    void set_baud(uint32 baud);
+
+    SemaphoreHandle_t lock; // Request state, shared with the serial task
+
+    uint32 input_pb;        // Pending read: parameter block, Mac buffer, progress
+    uint8 *input_buffer;
+    uint32 input_length, input_done;
+
+    uint32 output_pb;       // Pending write
+    const uint8 *output_buffer;
+    uint32 output_length, output_done;
+
+    uint32 baud;            // Current line settings
+    uint32 line_config;
+};
+
+static ESPSERDPort *serial_ports[2];
+static TaskHandle_t serial_task = NULL;
+static volatile bool serial_running = false;
+static bool serial_usb_taken = false;
+
+
+/*
+ *  Serial task: complete pending requests as data comes and goes
+ */
+
+static void serialTask(void *param)
+{
+    UNUSED(param);
+    while (serial_running) {
+        bool pending = false, completed = false;
+        for (int i = 0; i < 2; i++) {
+            ESPSERDPort *p = serial_ports[i];
+            if (p->active) {
+                completed |= p->service();
+                pending |= p->read_pending || p->write_pending;
+            }
+        }
+
+        // One interrupt for everything finished in this pass
+        if (completed) {
+            SetInterruptFlag(INTFLAG_SERIAL);
+            TriggerInterrupt();
+        }
+
+        // Sleep until the next Prime when nothing is waiting
+        ulTaskNotifyTake(pdTRUE, pending ? pdMS_TO_TICKS(SERIAL_POLL_MS) : portMAX_DELAY);
+    }
+    vTaskDelete(NULL);
+}
+
+
+/*
+ *  Initialization
+ */
+
+static int device_from_prefs(const char *dev_name)
+{
+    if (dev_name && strcmp(dev_name, "usb") == 0)
+        return DEV_USB;
+    if (dev_name && strcmp(dev_name, "uart") == 0)
+        return DEV_UART;
+    return DEV_NONE;
+}
+
+void SerialInit(void)
+{
+    the_serd_port[0] = serial_ports[0] = new ESPSERDPort(PrefsFindString("seriala"));
+    the_serd_port[1] = serial_ports[1] = new ESPSERDPort(PrefsFindString("serialb"));
+    if (serial_ports[0]->device == DEV_UART && serial_ports[1]->device == DEV_UART) {
+        Serial.println("[SERIAL] Only one port can use the UART, printer port disabled");
+        serial_ports[1]->device = DEV_NONE;
+    }
+    if (serial_ports[0]->device == DEV_USB && serial_ports[1]->device == DEV_USB) {
+        Serial.println("[SERIAL] Only one port can use USB, printer port disabled");
+        serial_ports[1]->device = DEV_NONE;
+    }
+    serial_usb_taken = serial_ports[0]->device == DEV_USB || serial_ports[1]->device == DEV_USB;
+    if (serial_ports[0]->device == DEV_NONE && serial_ports[1]->device == DEV_NONE)
+        return;
+
+    serial_running = true;
+    if (xTaskCreatePinnedToCore(serialTask, "SerialTask", SERIAL_TASK_STACK_SIZE, NULL,
+                                SERIAL_TASK_PRIORITY, &serial_task, SERIAL_TASK_CORE) != pdPASS) {
+        Serial.println("[SERIAL] ERROR: Failed to create serial task");
+        serial_running = false;
+        serial_ports[0]->device = serial_ports[1]->device = DEV_NONE;
+        serial_usb_taken = false;
+        return;
+    }
+    static const char *names[] = {"none", "USB", "UART"};
+    Serial.printf("[SERIAL] Modem port: %s, printer port: %s\n",
+                  names[serial_ports[0]->device], names[serial_ports[1]->device]);
+}
+
+
+/*
+ *  Deinitialization
+ */
+
+void SerialExit(void)
+{
+    for (int i = 0; i < 2; i++) {
+        if (serial_ports[i] && serial_ports[i]->is_open)
+            serial_ports[i]->close();
+    }
+    if (serial_running) {
+        serial_running = false;
+        xTaskNotifyGive(serial_task);
+        vTaskDelay(pdMS_TO_TICKS(10));
+        serial_task = NULL;
+    }
+    for (int i = 0; i < 2; i++) {
+        delete serial_ports[i];
+        the_serd_port[i] = serial_ports[i] = NULL;
+    }
+}
+
+
+/*
+ *  Check whether a Mac port owns the USB console (the debug commands
+ *  must not read its input then)
+ */
+
+bool SerialUSBInUse(void)
+{
+    return serial_usb_taken;
+}
+
+
+/*
+ *  Constructor
+ */
+
+ESPSERDPort::ESPSERDPort(const char *dev_name)
+{
+    device = device_from_prefs(dev_name);
+    active = false;
+    lock = xSemaphoreCreateMutex();
+    input_pb = output_pb = 0;
+    input_buffer = NULL;
+    output_buffer = NULL;
+    input_length = input_done = output_length = output_done = 0;
+    baud = 9600;
+    line_config = SERIAL_8N1;
+}
+
+
+/*
+ *  Driver access
+ */
+
+int ESPSERDPort::available(void)
+{
+    return device == DEV_USB ? Serial.available() : Serial1.available();
+}
+
+size_t ESPSERDPort::read(uint8 *buf, size_t length)
+{
+    return device == DEV_USB ? Serial.read(buf, length) : Serial1.read(buf, length);
+}
+
+int ESPSERDPort::write_space(void)
+{
+    // Nobody listening on USB: the bytes go nowhere, as on an unplugged port
+    if (device == DEV_USB)
+        return Serial ? Serial.availableForWrite() : INT32_MAX;
+    return Serial1.availableForWrite();
+}
+
+size_t ESPSERDPort::write(const uint8 *buf, size_t length)
+{
+    if (device == DEV_USB)
+        return Serial ? Serial.write(buf, length) : length;
+    return Serial1.write(buf, length);
+}
+
+
+/*
+ *  Line settings (the USB port ignores them)
+ */
+
+void ESPSERDPort::set_baud(uint32 new_baud)
+{
+    baud = new_baud;
+    if (device == DEV_UART)
+        Serial1.updateBaudRate(baud);
+    D(bug(" baud rate %d\n", baud));
+}
+
+void ESPSERDPort::configure(uint16 config)
+{
+    // Time constant of the SCC's baud rate generator: 57600 / (n / 2 + 1)
+    uint32 n = config & 0x3ff;
+    baud = (2 * 115200 / (n + 2) + 1) / 2;
+
+    // Arduino UART config: word length 5..8 bits as 0..3, parity none/even/odd as 0/2/3,
+    // stop bits 1/1.5/2 as 1/2/3 (the same encoding as the Mac's)
+    static const uint8 data_bits[4] = {0, 2, 1, 3};     // data5, data7, data6, data8
+    static const uint8 parity[4] = {0, 3, 0, 2};        // noParity, oddParity, -, evenParity
+    uint32 stop = (config >> 14) & 3;
+    line_config = 0x8000000 | ((stop ? stop : 1) << 4) | (data_bits[(config >> 10) & 3] << 2) | parity[(config >> 12) & 3];
+
+    if (device == DEV_UART)
+        Serial1.begin(baud, line_config, SERIAL_UART_RX_PIN, SERIAL_UART_TX_PIN);
+    D(bug(" config %04x: baud rate %d, line %08x\n", config, baud, line_config));
+}
+
+
+/*
+ *  Open port
+ */
+
+int16 ESPSERDPort::open(uint16 config)
+{
+    if (device == DEV_NONE)
+        return openErr;
+    if (device == DEV_UART) {
+        Serial1.setRxBufferSize(SERIAL_BUFFER_SIZE);
+        Serial1.setTxBufferSize(SERIAL_BUFFER_SIZE);
+    }
+    configure(config);
+    active = true;
+    return noErr;
+}
+
+
+/*
+ *  Read data from port
+ */
+
+int16 ESPSERDPort::prime_in(uint32 pb, uint32 dce)
+{
+    uint8 *buf = Mac2HostAddr(ReadMacInt32(pb + ioBuffer));
+    uint32 length = ReadMacInt32(pb + ioReqCount);
+    D(bug(" prime_in %d bytes, %d waiting\n", length, available()));
+
+    // All of it there already: done without the deferred task
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint32 done = 0;
+    int n = available();
+    if (n > 0)
+        done = read(buf, n < (int)length ? n : length);
+    if (done == length) {
+        xSemaphoreGive(lock);
+        WriteMacInt32(pb + ioActCount, length);
+        return noErr;
+    }
+
+    WriteMacInt32(input_dt + serdtDCE, dce);
+    input_pb = pb;
+    input_buffer = buf;
+    input_length = length;
+    input_done = done;
+    read_done = false;
+    read_pending = true;
+    xSemaphoreGive(lock);
+    xTaskNotifyGive(serial_task);
+    return 1;   // Command in progress
+}
+
+
+/*
+ *  Write data to port
+ */
+
+int16 ESPSERDPort::prime_out(uint32 pb, uint32 dce)
+{
+    const uint8 *buf = Mac2HostAddr(ReadMacInt32(pb + ioBuffer));
+    uint32 length = ReadMacInt32(pb + ioReqCount);
+    D(bug(" prime_out %d bytes\n", length));
+
+    // Fits in the driver's transmit buffer: done without the deferred task
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if ((int)length <= write_space()) {
+        write(buf, length);
+        xSemaphoreGive(lock);
+        WriteMacInt32(pb + ioActCount, length);
+        return noErr;
+    }
+
+    WriteMacInt32(output_dt + serdtDCE, dce);
+    output_pb = pb;
+    output_buffer = buf;
+    output_length = length;
+    output_done = 0;
+    write_done = false;
+    write_pending = true;
+    xSemaphoreGive(lock);
+    xTaskNotifyGive(serial_task);
+    return 1;   // Command in progress
+}
+
+
+/*
+ *  Move data for the pending requests (serial task)
+ *  Returns true if one of them was completed
+ */
+
+bool ESPSERDPort::service(void)
+{
+    bool completed = false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    // Received bytes straight into the Mac's buffer
+    if (read_pending && !read_done) {
+        int n;
+        while (input_done < input_length && (n = available()) > 0) {
+            uint32 chunk = input_length - input_done;
+            if (chunk > (uint32)n)
+                chunk = n;
+            if (chunk > SERIAL_CHUNK)
+                chunk = SERIAL_CHUNK;
+            input_done += read(input_buffer + input_done, chunk);
+        }
+        if (input_done == input_length) {
+            WriteMacInt32(input_pb + ioActCount, input_done);
+            WriteMacInt32(input_dt + serdtResult, noErr);
+            read_done = true;
+            completed = true;
+        }
+    }
+
+    // As much of the Mac's data as the driver takes without blocking
+    if (write_pending && !write_done) {
+        int space;
+        while (output_done < output_length && (space = write_space()) > 0) {
+            uint32 chunk = output_length - output_done;
+            if (chunk > (uint32)space)
+                chunk = space;
+            if (chunk > SERIAL_CHUNK)
+                chunk = SERIAL_CHUNK;
+            output_done += write(output_buffer + output_done, chunk);
+        }
+        if (output_done == output_length) {
+            WriteMacInt32(output_pb + ioActCount, output_done);
+            WriteMacInt32(output_dt + serdtResult, noErr);
+            write_done = true;
+            completed = true;
+        }
+    }
+
+    xSemaphoreGive(lock);
+    return completed;
+}
+
+
+/*
+ *  Control calls
+ */
+
+int16 ESPSERDPort::control(uint32 pb, uint32 dce, uint16 code)
+{
+    UNUSED(dce);
+    switch (code) {
+        case 1:         // KillIO
+            xSemaphoreTake(lock, portMAX_DELAY);
+            read_pending = read_done = false;
+            write_pending = write_done = false;
+            xSemaphoreGive(lock);
+            return noErr;
+
+        case kSERDConfiguration:
+            configure(ReadMacInt16(pb + csParam));
+            return noErr;
+
+        case kSERDBaudRate: {
+            uint16 rate = ReadMacInt16(pb + csParam);
+            if (rate < 150)
+                rate = 150;
+            set_baud(rate);
+            WriteMacInt16(pb + csParam, rate);
+            return noErr;
+        }
+
+        case kSERD115KBaud:
+            set_baud(115200);
+            return noErr;
+
+        case kSERD230KBaud:
+        case kSERDSetHighSpeed:
+            set_baud(230400);
+            return noErr;
+
+        case kSERDClockMIDI:    // 1MHz external clock / 32
+            set_baud(31250);
+            return noErr;
+
+        case kSERDInputBuffer:  // The driver's own buffer is used
+        case kSERDSerHShake:
+        case kSERDHandshake:
+        case kSERDHandshakeRS232:
+        case kSERDClearBreak:
+        case kSERDSetBreak:
+        case kSERDMiscOptions:
+        case kSERDAssertDTR:
+        case kSERDNegateDTR:
+        case kSERDSetPEChar:
+        case kSERDSetPEAltChar:
+        case kSERDSetXOffFlag:
+        case kSERDClearXOffFlag:
+        case kSERDSendXOn:
+        case kSERDSendXOnOut:
+        case kSERDSendXOff:
+        case kSERDSendXOffOut:
+        case kSERDResetChannel:
+        case kSERDStickParity:
+        case kSERDAssertRTS:
+        case kSERDNegateRTS:
+            return noErr;
+
+        default:
+            D(bug("WARNING: SerialControl(): unimplemented control code %d\n", code));
+            return controlErr;
+    }
+}
+
+
+/*
+ *  Status calls
+ */
+
+int16 ESPSERDPort::status(uint32 pb, uint32 dce, uint16 code)
+{
+    UNUSED(dce);
+    switch (code) {
+        case kSERDInputCount:
+            WriteMacInt32(pb + csParam, available());
+            return noErr;
+
+        case kSERDStatus: {
+            bool carrier = device == DEV_UART || Serial;
+            WriteMacInt8(pb + csParam + staCumErrs, cum_errors);
+            cum_errors = 0;
+            WriteMacInt8(pb + csParam + staXOffSent, 0);
+            WriteMacInt8(pb + csParam + staXOffHold, 0);
+            WriteMacInt8(pb + csParam + staRdPend, read_pending);
+            WriteMacInt8(pb + csParam + staWrPend, write_pending);
+            WriteMacInt8(pb + csParam + staCtsHold, 0);
+            WriteMacInt8(pb + csParam + staDsrHold, 0);
+            WriteMacInt8(pb + csParam + staModemStatus, dsrEvent | ctsEvent | (carrier ? dcdEvent : 0));
+            return noErr;
+        }
+
+        default:
+            D(bug("WARNING: SerialStatus(): unimplemented status code %d\n", code));
+            return statusErr;
+    }
+}
+
+
+/*
+ *  Close port
+ */
+
+int16 ESPSERDPort::close(void)
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    active = false;
+    read_pending = read_done = false;
+    write_pending = write_done = false;
+    if (device == DEV_UART)
+        Serial1.end();
+    xSemaphoreGive(lock);
+    return noErr;
+}
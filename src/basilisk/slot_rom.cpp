@@ -231,7 +231,11 @@ static uint32 VMonitor(const monitor_desc &m, uint32 videoType, uint32 videoName
 	return ret;
 }
 
-bool InstallSlotROM(void)
+/*
+ *  Build slot ROM (the input of the ROM patch cache, see rom_patches.cpp)
+ */
+
+const uint8 *BuildSlotROM(int &size)
 {
 	uint32 boardType, boardName, vendorID, revLevel, partNum, date;
 	uint32 vendorInfo, sRsrcBoard;
@@ -257,12 +261,12 @@ bool InstallSlotROM(void)
 		srom = (uint8 *)heap_caps_malloc(4096, MALLOC_CAP_SPIRAM);
 		if (srom == NULL) {
 			Serial.println("[SLOT ROM] ERROR: Failed to allocate srom in PSRAM");
-			return false;
+			return NULL;
 		}
 #else
 		srom = (uint8 *)malloc(4096);
 		if (srom == NULL) {
-			return false;
+			return NULL;
 		}
 #endif
 	}
@@ -467,8 +471,21 @@ bool InstallSlotROM(void)
 	Long(0x5a932bc7);					// Test pattern
 	Word(0x000f);						// Byte lanes
 
+	slot_rom_size = size = p;
+	return srom;
+}
+
+/*
+ *  Install slot ROM at the end of the Mac ROM
+ */
+
+bool InstallSlotROM(void)
+{
+	int size;
+	if (BuildSlotROM(size) == NULL)
+		return false;
+
 	// Copy slot ROM to Mac ROM
-	slot_rom_size = p;
 	memcpy(ROMBaseHost + ROMSize - slot_rom_size, srom, slot_rom_size);
 
 	// Calculate checksum
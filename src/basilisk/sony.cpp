@@ -44,6 +44,7 @@ using std::vector;
 #include "sys.h"
 #include "prefs.h"
 #include "sony.h"
+#include "savestate.h"
 
 #define DEBUG 0
 #include "debug.h"
@@ -202,6 +203,31 @@ void SonyExit(void)
 }
 
 
+#if SAVE_STATE
+/*
+ *  Drive state for hibernate/resume. The drives must be the ones the
+ *  snapshot was taken with, in the same order.
+ */
+
+void SonyStateIO(savestate *s)
+{
+	uint32 count = drives.size();
+	savestate_var(s, count);
+	if (count != drives.size()) {
+		savestate_fail(s, "floppy drives changed");
+		return;
+	}
+	drive_vec::iterator info, end = drives.end();
+	for (info = drives.begin(); info != end; ++info) {
+		savestate_var(s, info->num);
+		savestate_var(s, info->to_be_mounted);
+		savestate_var(s, info->status);
+	}
+	savestate_var(s, acc_run_called);
+}
+#endif
+
+
 /*
  *  Disk was inserted, flag for mounting
  */
@@ -252,7 +278,7 @@ static void mount_mountable_volumes(void)
 			M68kRegisters r;
 			r.d[0] = info->num;
 			r.a[0] = 7;	// diskEvent
-			Execute68kTrap(0xa02f, &r);		// PostEvent()
+			Execute68kTrapRegs(0xa02f, &r, M68K_REG_D(0) | M68K_REG_A(0), 0);	// PostEvent()
 			info->to_be_mounted = false;
 		}
 	}
@@ -0,0 +1,269 @@
+/*
+ *  sram_plan_esp32.cpp - Placement of the hot tables in internal SRAM
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The handler index, the page index and the decode cache all run faster
+ *  from internal SRAM than from PSRAM, but there is not room for every
+ *  table, and which one got it used to depend on the order of the
+ *  allocations. Each of them now registers a slot with its size and a
+ *  benefit score (accesses per 100 emulated instructions). SramPlan()
+ *  runs before any of them is allocated and hands out the free internal
+ *  SRAM, less SRAM_PLAN_RESERVE for the task stacks, WiFi and DMA buffers
+ *  allocated later, greedily by score per byte. It prints the plan:
+ *
+ *    [SRAM] 412 KB free, largest block 380 KB, 96 KB reserved
+ *    [SRAM]   dcache          36 KB  score 100  SRAM
+ *    [SRAM]   cpufuncidx     128 KB  score  40  SRAM
+ *    [SRAM]   mem_bank_index  64 KB  score  20  SRAM
+ *    [SRAM]   table68k      1536 KB  score   0  PSRAM
+ *
+ *  SramAlloc() then allocates each table where the plan put it, and falls
+ *  back to PSRAM (except for SRAM_ONLY slots) when the SRAM has gone
+ *  meanwhile. Static DRAM_ATTR buffers are not slots: they are already
+ *  taken when the plan is made.
+ *
+ *  What SRAM saves on an access depends on the unit: the PSRAM clock, the
+ *  L2 cache size and the cache configuration differ between builds and
+ *  board revisions. With SRAM_CALIBRATE, a few milliseconds of tests before
+ *  the plan measure both memories:
+ *
+ *    [SRAM] SRAM   read 1650 MB/s, write 1480 MB/s, copy 820 MB/s, random read 18 ns
+ *    [SRAM] PSRAM  read  240 MB/s, write  190 MB/s, copy 110 MB/s, random read 310 ns
+ *
+ *  and a slot's score is weighed by the time an access saves in SRAM: the
+ *  random read latency for the tables indexed at random, the time to read
+ *  and write 4 bytes in a run for SRAM_STREAM slots. A PSRAM as fast as
+ *  the SRAM for a slot's accesses gives it no SRAM.
+ */
+
+#include "sysdeps.h"
+#include "sram_plan.h"
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+#if SRAM_PLAN
+
+#define SRAM_MAX_SLOTS      12
+#define SRAM_PLAN_RESERVE   (96 * 1024)     // Left for what is allocated after the plan
+#define CAL_SRAM_SIZE       (128 * 1024)    // Test buffers, larger than the L1 cache
+#define CAL_PSRAM_SIZE      (2048 * 1024)   // and than the L2 cache
+#define CAL_CHASE_STEPS     16384           // Dependent reads of the latency test
+#define CAL_LINE            64              // Cache line
+
+struct sram_slot {
+    const char *name;
+    size_t size;
+    int score;
+    int flags;
+    bool planned;       // Placed in SRAM by SramPlan()
+};
+
+// Zero-initialized, usable before any constructor has run
+static sram_slot slots[SRAM_MAX_SLOTS];
+static int num_slots;
+static sram_slot scratch_slot = {"scratch", 0, 0, 0, false};    // Slots that find the table full
+static bool plan_done = false;
+
+// Picoseconds an access saves in SRAM, 1 each: not measured, scores as they are
+static uint64 random_gain_ps = 1;
+static uint64 stream_gain_ps = 1;
+
+
+/*
+ *  Registration
+ */
+
+sram_slot *SramSlot(const char *name, size_t size, int score, int flags)
+{
+    if (num_slots == SRAM_MAX_SLOTS)
+        return &scratch_slot;
+    sram_slot *s = &slots[num_slots++];
+    s->name = name;
+    s->size = size;
+    s->score = score;
+    s->flags = flags;
+    return s;
+}
+
+
+#if SRAM_CALIBRATE
+/*
+ *  Calibration
+ */
+
+struct mem_speed {
+    uint32 read_mbs, write_mbs, copy_mbs;
+    uint32 random_ns;           // One read depending on the previous one
+};
+
+// Bytes per microsecond are MB/s
+static uint32 rate(size_t bytes, uint32 us)
+{
+    return bytes / (us ? us : 1);
+}
+
+static void measure(uint8 *buffer, size_t size, mem_speed *m)
+{
+    uint32 *words = (uint32 *)buffer;
+    size_t count = size / sizeof(uint32);
+
+    uint32 t0 = micros();
+    memset(buffer, 0x5a, size);
+    m->write_mbs = rate(size, micros() - t0);
+
+    t0 = micros();
+    uint32 sum = 0;
+    for (size_t i = 0; i < count; i++)
+        sum += words[i];
+    m->read_mbs = rate(size, micros() - t0);
+
+    t0 = micros();
+    memcpy(buffer + size / 2, buffer, size / 2);
+    m->copy_mbs = rate(size / 2, micros() - t0);
+
+    // A chain through every cache line in scattered order, so that neither
+    // the caches nor the prefetcher help: a full period LCG modulo the
+    // number of lines, a power of two
+    const uint32 stride = CAL_LINE / sizeof(uint32);
+    uint32 lines = size / CAL_LINE;
+    uint32 first = 0, prev = first;
+    for (uint32 i = 1; i < lines; i++) {
+        uint32 next = (prev * 1664525 + 1013904223) & (lines - 1);
+        words[prev * stride] = next;
+        prev = next;
+    }
+    words[prev * stride] = first;
+
+    uint32 line = first;
+    t0 = micros();
+    for (int i = 0; i < CAL_CHASE_STEPS; i++)
+        line = words[line * stride];
+    m->random_ns = (micros() - t0) * 1000 / CAL_CHASE_STEPS;
+
+    // Keep the loads
+    volatile uint32 sink = sum + line;
+    UNUSED(sink);
+}
+
+// Picoseconds to read and write 4 bytes in a run
+static uint64 stream_ps(const mem_speed &m)
+{
+    return (4000000ULL / (m.read_mbs ? m.read_mbs : 1) + 4000000ULL / (m.write_mbs ? m.write_mbs : 1)) / 2;
+}
+
+static void print_speed(const char *name, const mem_speed &m)
+{
+    Serial.printf("[SRAM] %-6s read %4u MB/s, write %4u MB/s, copy %4u MB/s, random read %u ns\n",
+                  name, m.read_mbs, m.write_mbs, m.copy_mbs, m.random_ns);
+}
+
+// Measure both memories and set the gains, which stay 1 if a test buffer is missing
+static void calibrate(void)
+{
+    uint8 *sram = (uint8 *)heap_caps_malloc(CAL_SRAM_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    uint8 *psram = (uint8 *)heap_caps_malloc(CAL_PSRAM_SIZE, MALLOC_CAP_SPIRAM);
+    if (sram == NULL || psram == NULL) {
+        Serial.println("[SRAM] WARNING: No room for the memory tests, scores taken as they are");
+    } else {
+        mem_speed s, p;
+        uint32 t0 = millis();
+        measure(sram, CAL_SRAM_SIZE, &s);
+        measure(psram, CAL_PSRAM_SIZE, &p);
+        print_speed("SRAM", s);
+        print_speed("PSRAM", p);
+        random_gain_ps = p.random_ns > s.random_ns ? (uint64)(p.random_ns - s.random_ns) * 1000 : 0;
+        uint64 ps = stream_ps(p), ss = stream_ps(s);
+        stream_gain_ps = ps > ss ? ps - ss : 0;
+        Serial.printf("[SRAM] An access saves %u ps at random, %u ps in a run (%u ms)\n",
+                      (unsigned)random_gain_ps, (unsigned)stream_gain_ps, (unsigned)(millis() - t0));
+    }
+    heap_caps_free(sram);
+    heap_caps_free(psram);
+}
+#endif
+
+
+/*
+ *  Plan
+ */
+
+// Time the slot's accesses save in SRAM, per 100 emulated instructions
+static uint64 benefit(const sram_slot *s)
+{
+    return (uint64)s->score * ((s->flags & SRAM_STREAM) ? stream_gain_ps : random_gain_ps);
+}
+
+// a is worth more internal SRAM per byte than b
+static bool denser(const sram_slot *a, const sram_slot *b)
+{
+    return benefit(a) * b->size > benefit(b) * a->size;
+}
+
+void SramPlan(void)
+{
+#if SRAM_CALIBRATE
+    calibrate();
+#endif
+    size_t free_sram = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    size_t largest_free = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    size_t largest = largest_free;
+    size_t budget = free_sram > SRAM_PLAN_RESERVE ? free_sram - SRAM_PLAN_RESERVE : 0;
+
+    // Best score per byte first, registration order among equals
+    sram_slot *order[SRAM_MAX_SLOTS];
+    for (int i = 0; i < num_slots; i++) {
+        int j = i;
+        while (j > 0 && denser(&slots[i], order[j - 1])) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = &slots[i];
+    }
+
+    // Each slot is assumed to come out of the largest block
+    for (int i = 0; i < num_slots; i++) {
+        sram_slot *s = order[i];
+        s->planned = benefit(s) > 0 && s->size <= budget && s->size <= largest;
+        if (s->planned) {
+            budget -= s->size;
+            largest -= s->size;
+        }
+    }
+    plan_done = true;
+
+    Serial.printf("[SRAM] %u KB free, largest block %u KB, %u KB reserved\n",
+                  (unsigned)(free_sram / 1024), (unsigned)(largest_free / 1024),
+                  (unsigned)(SRAM_PLAN_RESERVE / 1024));
+    for (int i = 0; i < num_slots; i++)
+        Serial.printf("[SRAM]   %-14s %5u KB  score %3d  %s\n", order[i]->name,
+                      (unsigned)((order[i]->size + 1023) / 1024), order[i]->score,
+                      order[i]->planned ? "SRAM" : "PSRAM");
+}
+
+
+/*
+ *  Allocation
+ */
+
+void *SramAlloc(sram_slot *slot, size_t size)
+{
+    // Before the plan, first come, first served
+    bool want_sram = plan_done ? slot->planned : true;
+    void *p = NULL;
+    if (want_sram) {
+        p = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (p == NULL && plan_done)
+            Serial.printf("[SRAM] WARNING: %s did not get its planned %u bytes of SRAM\n", slot->name, (unsigned)size);
+    }
+    bool in_sram = p != NULL;
+    if (p == NULL && !(slot->flags & SRAM_ONLY))
+        p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (p != NULL)
+        Serial.printf("[SRAM] %s: %u bytes in %s\n", slot->name, (unsigned)size, in_sram ? "internal SRAM" : "PSRAM");
+    return p;
+}
+
+#endif
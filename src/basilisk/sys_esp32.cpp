@@ -3,33 +3,88 @@
  *
  *  BasiliskII ESP32 Port
  *
- *  SIMPLIFIED DIRECT I/O - No caching, no buffering
- *  
- *  SD card has internal caching and Mac OS already batches I/O efficiently.
- *  Adding software caching/buffering just adds CPU overhead without benefit.
+ *  Disk image I/O goes through a PSRAM block cache (DISK_CACHE_SIZE): the
+ *  catalog and extents B-trees, resource maps and the System file are read
+ *  over and over while browsing in the Finder and launching applications,
+ *  and every SD random read costs a seek and a command round trip. Writes
+ *  are kept in the cache and written back in merged runs by a flush task on
+ *  Core 0, so saving a document does not stall the emulated CPU, and
+ *  asynchronous driver requests run on a Core 0 I/O task (USE_ASYNC_DISK).
+ *  The B-trees of each HFS volume are prefetched and then kept in the cache
+ *  (HFS_PIN_BTREES), so Finder browsing does not wait for random reads.
+ *  Floppy images are kept whole in PSRAM while inserted (FLOPPY_RAM_SIZE),
+ *  and the "flashdisk" image is read from a flash mapping (FLASH_DISK).
  */
 
 #include "sysdeps.h"
+#include "cpu_emulation.h"
 #include "main.h"
 #include "macos_util.h"
 #include "prefs.h"
 #include "sys.h"
+#include "sdcard.h"
+#include "usb_msc.h"
+#include "telemetry.h"
+#include "bincue.h"
+#include "console.h"
+#include "perf_registry.h"
+#include "task_stats.h"
+#include "flash_disk.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <esp_heap_caps.h>
 
-#include <SD.h>
-#include <FS.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 
 #define DEBUG 0
 #include "debug.h"
 
+struct chunk_image;
+
+#if DISK_TELEMETRY
+// Request counters of one image, printed with 'd' on the serial console
+struct disk_stats {
+    uint32 reads, writes;           // Requests
+    uint64 read_bytes, write_bytes;
+    uint32 seeks;                   // Requests not starting where the previous one ended
+    uint64 seek_bytes;              // Their distance from there
+    uint32 hits, misses;            // Block cache (or floppy RAM image) blocks found / read from the card
+    telemetry_histogram read_us, write_us;  // Request latency, lock wait included
+};
+#endif
+
+#define HFS_PIN_RANGES 6    // Three extents each of the catalog and extents B-trees
+
 // File handle structure - minimal with dirty tracking
 struct file_handle {
-    File file;
+    int fd;             // VFS file descriptor, read and written without stdio buffering
+    chunk_image *chunks;    // Chunked container, NULL for a raw image
+    void *bincue;       // BIN/CUE CD image (see bincue_esp32.cpp), NULL for a raw image
+    uint8 *ram_image;   // Whole floppy image in PSRAM, NULL: read from the card
+    loff_t ram_dirty_lo, ram_dirty_hi;  // Range of ram_image not yet on the card
+    const uint8 *flash_image;   // Image mapped from the sysvol partition, NULL: read from the card
+    uint8 *overlay_map;     // Sectors of flash_image in the overlay file (fd), one bit each
     bool is_open;
     bool read_only;
     bool is_floppy;
     bool is_cdrom;
     bool is_dirty;      // Track if there are pending writes to flush
     loff_t size;
+    loff_t next_read;   // End of the last read, to recognise sequential reads
+    uint32 check_hash;  // HFS check record to drop at the first write, 0: none
+    int hfs_probes;     // MDB lookups of the prefetch, to give up on a missing one
+#if HFS_PIN_BTREES
+    uint32 pin_block[HFS_PIN_RANGES], pin_end[HFS_PIN_RANGES];  // Cache blocks of the B-trees
+    int pin_ranges;
+#endif
+#if DISK_TELEMETRY
+    loff_t next_request;    // End of the last read or write
+    disk_stats stats;
+#endif
     char path[256];
 };
 
@@ -39,6 +94,1170 @@ static bool sd_initialized = false;
 // Open file handles for periodic flush
 static file_handle *open_file_handles[16] = {NULL};
 
+#if DISK_TELEMETRY
+/*
+ *  Telemetry: one request of a file done (the driver keeps one request per
+ *  image in flight, so only one task records into a handle at a time)
+ */
+
+// All images, in the registry; written with io_lock held
+static perf_counter *const perf_reads = PerfCounter("disk.reads", PERF_COUNT, PERF_CORE_ANY);
+static perf_counter *const perf_writes = PerfCounter("disk.writes", PERF_COUNT, PERF_CORE_ANY);
+static perf_counter *const perf_read_bytes = PerfCounter("disk.read_bytes", PERF_COUNT, PERF_CORE_ANY);
+static perf_counter *const perf_write_bytes = PerfCounter("disk.write_bytes", PERF_COUNT, PERF_CORE_ANY);
+static perf_counter *const perf_hits = PerfCounter("disk.hits", PERF_COUNT, PERF_CORE_ANY);
+static perf_counter *const perf_misses = PerfCounter("disk.misses", PERF_COUNT, PERF_CORE_ANY);
+static struct {
+    uint32 reads, writes, read_bytes, write_bytes, hits, misses;
+} stats_last;                       // Counters at the last [DISK PERF] line
+
+static inline void stats_count(bool write, size_t length)
+{
+    perf_inc(write ? perf_writes : perf_reads);
+    perf_add(write ? perf_write_bytes : perf_read_bytes, length);
+}
+
+static void stats_request(file_handle *fh, bool write, loff_t offset, size_t length, uint32 start_us)
+{
+    disk_stats &s = fh->stats;
+    uint32 us = micros() - start_us;
+    if (write) {
+        s.writes++;
+        s.write_bytes += length;
+        telemetry_record(s.write_us, us);
+    } else {
+        s.reads++;
+        s.read_bytes += length;
+        telemetry_record(s.read_us, us);
+    }
+    if (offset != fh->next_request) {
+        s.seeks++;
+        s.seek_bytes += (offset > fh->next_request) ? offset - fh->next_request : fh->next_request - offset;
+    }
+    fh->next_request = offset + length;
+}
+
+static inline void stats_block(file_handle *fh, bool hit)
+{
+    if (hit) {
+        fh->stats.hits++;
+        perf_inc(perf_hits);
+    } else {
+        fh->stats.misses++;
+        perf_inc(perf_misses);
+    }
+}
+#else
+static inline void stats_block(file_handle *fh, bool hit)
+{
+    UNUSED(fh);
+    UNUSED(hit);
+}
+#endif
+
+/*
+ *  Card transfers
+ *  
+ *  Disk images are read and written with pread()/pwrite() on the VFS file
+ *  descriptor rather than through an Arduino File, whose stdio stream
+ *  refills a small buffer and copies out of it. An unbuffered transfer of
+ *  whole sectors goes from FatFs straight to the SD driver, which DMAs a
+ *  multi-block command (CMD18/CMD25) to or from the buffer when it is cache
+ *  line aligned. For an unaligned buffer (most Mac RAM buffers) the driver
+ *  would move one sector at a time through its own bounce buffer, so those
+ *  go through bounce_buffer in large aligned pieces instead.
+ */
+#define DMA_ALIGN   64              // PSRAM cache line, the SDMMC DMA needs it
+#define BOUNCE_SIZE (64 * 1024)
+
+static uint8 *bounce_buffer = NULL; // Aligned stand-in for unaligned buffers (io_lock held)
+
+static inline bool dma_aligned(const void *p)
+{
+    return ((uintptr_t)p & (DMA_ALIGN - 1)) == 0;
+}
+
+static size_t raw_read(file_handle *fh, void *buffer, loff_t offset, size_t length)
+{
+    uint8 *dst = (uint8 *)buffer;
+    if (dma_aligned(dst) || bounce_buffer == NULL) {
+        ssize_t n = pread(fh->fd, dst, length, offset);
+        return n > 0 ? n : 0;
+    }
+    
+    size_t done = 0;
+    while (done < length) {
+        size_t n = (length - done < BOUNCE_SIZE) ? length - done : BOUNCE_SIZE;
+        ssize_t got = pread(fh->fd, bounce_buffer, n, offset + done);
+        if (got <= 0) {
+            break;
+        }
+        memcpy(dst + done, bounce_buffer, got);
+        done += got;
+        if ((size_t)got < n) {
+            break;
+        }
+    }
+    return done;
+}
+
+static size_t raw_write(file_handle *fh, const void *buffer, loff_t offset, size_t length)
+{
+    const uint8 *src = (const uint8 *)buffer;
+    if (dma_aligned(src) || bounce_buffer == NULL) {
+        ssize_t n = pwrite(fh->fd, src, length, offset);
+        return n > 0 ? n : 0;
+    }
+    
+    size_t done = 0;
+    while (done < length) {
+        size_t n = (length - done < BOUNCE_SIZE) ? length - done : BOUNCE_SIZE;
+        memcpy(bounce_buffer, src + done, n);
+        ssize_t put = pwrite(fh->fd, bounce_buffer, n, offset + done);
+        if (put <= 0) {
+            break;
+        }
+        done += put;
+        if ((size_t)put < n) {
+            break;
+        }
+    }
+    return done;
+}
+
+#if USE_CHUNKED_IMAGES
+/*
+ *  Chunked images
+ *  
+ *  An image made by tools/dsk_chunk.py is a container of fixed size chunks
+ *  (64KB by default). All-zero chunks take no space, the others are stored
+ *  LZ4 compressed, or raw where that does not save anything. The index of
+ *  all chunks is read into PSRAM when the image is opened; the file has the
+ *  same name as a raw image and is recognised by its header. A mostly empty
+ *  volume costs little card space, and a compressed chunk is read in less
+ *  time than the bytes it expands to.
+ *  
+ *  Writes copy on write: a zero or compressed chunk written to is expanded,
+ *  updated and appended to the file as a raw chunk, then its index entry is
+ *  rewritten (data first, so a power loss leaves the old chunk). Raw chunks
+ *  are written in place. The tool packs an image again to reclaim the
+ *  chunks left behind.
+ *  
+ *  All numbers are little-endian. Everything here runs with io_lock held.
+ */
+#define CHUNK_MAGIC         0x49433242      // "B2CI"
+#define CHUNK_VERSION       1
+#define CHUNK_MAX_SIZE      (1024 * 1024)
+
+enum {
+    CHUNK_ZERO = 0,     // Not stored, reads as zeros
+    CHUNK_RAW = 1,      // chunk_size bytes as they are
+    CHUNK_LZ4 = 2       // LZ4 block of stored bytes
+};
+
+struct chunk_header {
+    uint32 magic;
+    uint32 version;
+    uint32 chunk_size;      // Power of two, at least 512
+    uint32 chunk_count;
+    uint64 image_size;      // Bytes of the disk image
+    uint64 index_offset;    // chunk_count chunk_entry records
+};
+
+struct chunk_entry {
+    uint64 offset;          // Data in the container
+    uint32 stored;          // Bytes stored there
+    uint32 type;            // CHUNK_*
+};
+
+struct chunk_image {
+    uint32 chunk_size;
+    uint32 chunk_count;
+    loff_t index_offset;
+    loff_t append;          // Where the next copied chunk goes
+    chunk_entry *index;
+    uint8 *chunk;           // Expanded chunk (aligned, so that copies go out by DMA)
+    uint8 *packed;          // Compressed data read from the card
+    int32 chunk_no;         // Chunk held in chunk, -1 if none
+};
+
+/*
+ *  Decode an LZ4 block
+ *  Returns the number of bytes decoded, -1 if the data is corrupt
+ */
+static int32 lz4_decode(const uint8 *src, size_t src_len, uint8 *dst, size_t dst_len)
+{
+    const uint8 *ip = src, *iend = src + src_len;
+    uint8 *op = dst, *oend = dst + dst_len;
+    
+    while (ip < iend) {
+        uint32 token = *ip++;
+        
+        // Literals
+        size_t length = token >> 4;
+        if (length == 15) {
+            uint8 b;
+            do {
+                if (ip >= iend) return -1;
+                b = *ip++;
+                length += b;
+            } while (b == 255);
+        }
+        if (length > (size_t)(iend - ip) || length > (size_t)(oend - op)) {
+            return -1;
+        }
+        memcpy(op, ip, length);
+        op += length;
+        ip += length;
+        if (ip == iend) {
+            break;      // The last sequence has no match
+        }
+        
+        // Match
+        if (iend - ip < 2) {
+            return -1;
+        }
+        size_t distance = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (distance == 0 || distance > (size_t)(op - dst)) {
+            return -1;
+        }
+        length = token & 15;
+        if (length == 15) {
+            uint8 b;
+            do {
+                if (ip >= iend) return -1;
+                b = *ip++;
+                length += b;
+            } while (b == 255);
+        }
+        length += 4;
+        if (length > (size_t)(oend - op)) {
+            return -1;
+        }
+        const uint8 *match = op - distance;
+        if (distance >= length) {
+            memcpy(op, match, length);
+            op += length;
+        } else {
+            // Overlapping: repeats the last distance bytes
+            while (length--) {
+                *op++ = *match++;
+            }
+        }
+    }
+    return op - dst;
+}
+
+/*
+ *  Read the container header and index of an image, if it is one
+ *  Returns 1 for a container, 0 for a raw image, -1 for a damaged container
+ *  (which must not be offered to the Mac as a raw image it could overwrite)
+ */
+static int chunk_open(file_handle *fh, loff_t file_size)
+{
+    chunk_header h;
+    if (pread(fh->fd, &h, sizeof(h), 0) != sizeof(h) || h.magic != CHUNK_MAGIC) {
+        return 0;
+    }
+    if (h.version != CHUNK_VERSION || h.chunk_size < 512 || h.chunk_size > CHUNK_MAX_SIZE
+        || (h.chunk_size & (h.chunk_size - 1)) || h.image_size == 0 || h.image_size > 0x7fffffff
+        || h.chunk_count != (h.image_size + h.chunk_size - 1) / h.chunk_size) {
+        Serial.printf("[SYS] ERROR: %s: unsupported chunked image\n", fh->path);
+        return -1;
+    }
+    
+    // The index is DMA aligned so raw_read() does not need bounce_buffer,
+    // whose io_lock is not held here
+    chunk_image *ci = new chunk_image;
+    size_t index_size = h.chunk_count * sizeof(chunk_entry);
+    ci->chunk_size = h.chunk_size;
+    ci->chunk_count = h.chunk_count;
+    ci->index_offset = h.index_offset;
+    ci->append = (file_size + DMA_ALIGN - 1) & ~(loff_t)(DMA_ALIGN - 1);
+    ci->index = (chunk_entry *)heap_caps_aligned_alloc(DMA_ALIGN, index_size, MALLOC_CAP_SPIRAM);
+    ci->chunk = (uint8 *)heap_caps_aligned_alloc(DMA_ALIGN, h.chunk_size, MALLOC_CAP_SPIRAM);
+    ci->packed = (uint8 *)heap_caps_aligned_alloc(DMA_ALIGN, h.chunk_size, MALLOC_CAP_SPIRAM);
+    ci->chunk_no = -1;
+    if (ci->index == NULL || ci->chunk == NULL || ci->packed == NULL
+        || raw_read(fh, ci->index, ci->index_offset, index_size) != index_size) {
+        Serial.printf("[SYS] ERROR: %s: cannot load the chunk index\n", fh->path);
+        heap_caps_free(ci->index);
+        heap_caps_free(ci->chunk);
+        heap_caps_free(ci->packed);
+        delete ci;
+        return -1;
+    }
+    
+    fh->chunks = ci;
+    fh->size = h.image_size;
+    return 1;
+}
+
+static void chunk_close(file_handle *fh)
+{
+    chunk_image *ci = fh->chunks;
+    heap_caps_free(ci->index);
+    heap_caps_free(ci->chunk);
+    heap_caps_free(ci->packed);
+    delete ci;
+    fh->chunks = NULL;
+}
+
+/*
+ *  Expand a chunk into ci->chunk
+ */
+static bool chunk_expand(file_handle *fh, uint32 n)
+{
+    chunk_image *ci = fh->chunks;
+    if (ci->chunk_no == (int32)n) {
+        return true;
+    }
+    
+    const chunk_entry &e = ci->index[n];
+    bool ok;
+    switch (e.type) {
+        case CHUNK_ZERO:
+            memset(ci->chunk, 0, ci->chunk_size);
+            ok = true;
+            break;
+        case CHUNK_RAW:
+            ok = raw_read(fh, ci->chunk, e.offset, ci->chunk_size) == ci->chunk_size;
+            break;
+        case CHUNK_LZ4:
+            ok = e.stored <= ci->chunk_size
+                && raw_read(fh, ci->packed, e.offset, e.stored) == e.stored
+                && lz4_decode(ci->packed, e.stored, ci->chunk, ci->chunk_size) == (int32)ci->chunk_size;
+            break;
+        default:
+            ok = false;
+            break;
+    }
+    if (!ok) {
+        Serial.printf("[SYS] ERROR: %s: chunk %u unreadable\n", fh->path, n);
+        ci->chunk_no = -1;
+        return false;
+    }
+    ci->chunk_no = n;
+    return true;
+}
+
+static size_t chunk_read(file_handle *fh, uint8 *buffer, loff_t offset, size_t length)
+{
+    chunk_image *ci = fh->chunks;
+    size_t done = 0;
+    
+    while (done < length) {
+        loff_t pos = offset + done;
+        uint32 n = pos / ci->chunk_size;
+        uint32 in_chunk = pos % ci->chunk_size;
+        if (pos >= fh->size) {
+            break;
+        }
+        size_t count = ci->chunk_size - in_chunk;
+        if (count > length - done) count = length - done;
+        if (count > (size_t)(fh->size - pos)) count = fh->size - pos;
+        
+        const chunk_entry &e = ci->index[n];
+        if (e.type == CHUNK_ZERO) {
+            memset(buffer + done, 0, count);
+        } else if (e.type == CHUNK_RAW) {
+            // Straight from the card into the buffer
+            size_t got = raw_read(fh, buffer + done, e.offset + in_chunk, count);
+            done += got;
+            if (got != count) {
+                break;
+            }
+            continue;
+        } else {
+            if (!chunk_expand(fh, n)) {
+                break;
+            }
+            memcpy(buffer + done, ci->chunk + in_chunk, count);
+        }
+        done += count;
+    }
+    return done;
+}
+
+static size_t chunk_write(file_handle *fh, const uint8 *buffer, loff_t offset, size_t length)
+{
+    chunk_image *ci = fh->chunks;
+    size_t done = 0;
+    
+    while (done < length) {
+        loff_t pos = offset + done;
+        uint32 n = pos / ci->chunk_size;
+        uint32 in_chunk = pos % ci->chunk_size;
+        if (pos >= fh->size) {
+            break;
+        }
+        size_t count = ci->chunk_size - in_chunk;
+        if (count > length - done) count = length - done;
+        if (count > (size_t)(fh->size - pos)) count = fh->size - pos;
+        
+        chunk_entry &e = ci->index[n];
+        if (e.type == CHUNK_RAW) {
+            size_t put = raw_write(fh, buffer + done, e.offset + in_chunk, count);
+            done += put;
+            if (put != count) {
+                break;
+            }
+            continue;
+        }
+        
+        // Copy on write: the whole chunk goes raw to the end of the file
+        if (!chunk_expand(fh, n)) {
+            break;
+        }
+        memcpy(ci->chunk + in_chunk, buffer + done, count);
+        ci->chunk_no = -1;
+        if (raw_write(fh, ci->chunk, ci->append, ci->chunk_size) != ci->chunk_size) {
+            break;
+        }
+        chunk_entry copy = { (uint64)ci->append, ci->chunk_size, CHUNK_RAW };
+        if (raw_write(fh, &copy, ci->index_offset + n * sizeof(chunk_entry), sizeof(copy)) != sizeof(copy)) {
+            break;
+        }
+        e = copy;
+        ci->append += ci->chunk_size;
+        done += count;
+    }
+    return done;
+}
+#endif
+
+/*
+ *  Image transfers at image offsets (through the chunk index of a container)
+ */
+static inline size_t card_read(file_handle *fh, void *buffer, loff_t offset, size_t length)
+{
+#if USE_CHUNKED_IMAGES
+    if (fh->chunks) {
+        return chunk_read(fh, (uint8 *)buffer, offset, length);
+    }
+#endif
+    return raw_read(fh, buffer, offset, length);
+}
+
+static inline size_t card_write(file_handle *fh, const void *buffer, loff_t offset, size_t length)
+{
+#if USE_CHUNKED_IMAGES
+    if (fh->chunks) {
+        return chunk_write(fh, (const uint8 *)buffer, offset, length);
+    }
+#endif
+    return raw_write(fh, buffer, offset, length);
+}
+
+#if DISK_CACHE_SIZE
+/*
+ *  Block cache
+ *  
+ *  DISK_CACHE_BLOCK sized blocks of any open disk image (CD-ROM images have
+ *  their own track buffer in cdrom.cpp), found through a hash of file and
+ *  block number and replaced least recently used first. A miss at
+ *  the offset where the previous read of the file ended reads ahead
+ *  DISK_CACHE_READAHEAD blocks after one seek. Reads and writes of a quarter
+ *  of the cache or more (copying whole files, formatting) bypass it.
+ *  
+ *  Writes only go to the cache. A block keeps the byte range written since
+ *  it was last flushed. A block written before it was ever read holds only
+ *  that range ("incomplete") until a read fetches the rest from the card.
+ *  The flush task writes dirty ranges back, the ranges of adjacent blocks of
+ *  a file merged into one write of up to DISK_FLUSH_RUN bytes. The main loop
+ *  wakes it every 2 seconds, writers when DISK_DIRTY_LIMIT / 2 blocks are
+ *  dirty; at DISK_DIRTY_LIMIT the writer flushes synchronously.
+ *  
+ *  Files and cache are only touched with io_lock held. The flush task takes
+ *  it for one run at a time, so the CPU waits for one write at most.
+ *  
+ *  The read-ahead and the dirty limit can be changed on the console
+ *  ("readahead" and "dirtylimit").
+ *  
+ *  With HFS_PIN_BTREES, the blocks of the ranges a file handle pins (the
+ *  B-trees of its HFS volume, see prefetch_btrees()) are never replaced,
+ *  up to HFS_PIN_LIMIT blocks in all. Whether a block is pinned is decided
+ *  when it enters the cache, or when its range is pinned.
+ */
+#define CACHE_BLOCKS (DISK_CACHE_SIZE / DISK_CACHE_BLOCK)
+#define CACHE_HASH_SIZE 256
+#define CACHE_NONE (-1)
+#define HFS_PIN_LIMIT (CACHE_BLOCKS / 2)    // Pinned blocks at most, the rest is replaced as before
+
+#if DISK_DIRTY_LIMIT >= CACHE_BLOCKS - HFS_PIN_LIMIT
+#error "DISK_DIRTY_LIMIT must leave clean blocks to replace"
+#endif
+#if DISK_FLUSH_RUN < DISK_CACHE_BLOCK
+#error "DISK_FLUSH_RUN must hold a whole block"
+#endif
+
+#define FLUSH_TASK_STACK_SIZE 4096
+#define FLUSH_TASK_PRIORITY   1
+#define FLUSH_TASK_CORE       0  // Core 0, leaving Core 1 for CPU emulation
+
+struct cache_block {
+    file_handle *fh;    // NULL if free
+    uint32 block;       // Block number in the file
+    uint32 length;      // Bytes of the file in the block, less at the end of the file
+    uint32 used;        // LRU stamp
+    uint32 dirty_lo;    // Bytes written since the last flush (none if equal)
+    uint32 dirty_hi;
+    bool complete;      // All length bytes valid, otherwise only the dirty range
+    bool pinned;        // In a pinned range, never replaced
+    int16 next;         // Next block in the hash chain
+};
+
+static cache_block cache_blocks[CACHE_BLOCKS];
+static int16 cache_hash[CACHE_HASH_SIZE];
+static uint8 *cache_data = NULL;    // CACHE_BLOCKS * DISK_CACHE_BLOCK bytes of PSRAM, NULL: direct I/O
+static uint8 *flush_buffer = NULL;  // One merged write, or a block completed from the card
+static uint32 cache_clock = 0;
+static volatile uint32 cache_readahead = DISK_CACHE_READAHEAD;
+static volatile uint32 cache_dirty_limit = DISK_DIRTY_LIMIT;
+static int cache_dirty = 0;         // Blocks with a dirty range
+static int cache_pinned = 0;        // Pinned blocks
+static perf_counter *const perf_pinned = PerfCounter("disk.pinned", PERF_GAUGE, PERF_CORE_ANY);
+
+static SemaphoreHandle_t io_lock = NULL;
+static TaskHandle_t flush_task_handle = NULL;
+static task_stats *const flush_task_stats = TaskStats("flush");
+
+static inline bool cache_is_dirty(int i)
+{
+    return cache_blocks[i].dirty_hi != cache_blocks[i].dirty_lo;
+}
+
+static inline int cache_bucket(file_handle *fh, uint32 block)
+{
+    return (block ^ ((uintptr_t)fh >> 4)) & (CACHE_HASH_SIZE - 1);
+}
+
+static int cache_find(file_handle *fh, uint32 block)
+{
+    for (int i = cache_hash[cache_bucket(fh, block)]; i != CACHE_NONE; i = cache_blocks[i].next) {
+        if (cache_blocks[i].fh == fh && cache_blocks[i].block == block) {
+            return i;
+        }
+    }
+    return CACHE_NONE;
+}
+
+// Keep block i from being replaced, within HFS_PIN_LIMIT
+static void cache_pin(int i)
+{
+    if (!cache_blocks[i].pinned && cache_pinned < HFS_PIN_LIMIT) {
+        cache_blocks[i].pinned = true;
+        perf_set(perf_pinned, ++cache_pinned);
+    }
+}
+
+static bool cache_in_pinned_range(file_handle *fh, uint32 block)
+{
+#if HFS_PIN_BTREES
+    for (int n = 0; n < fh->pin_ranges; n++) {
+        if (block >= fh->pin_block[n] && block < fh->pin_end[n]) {
+            return true;
+        }
+    }
+#else
+    UNUSED(fh);
+    UNUSED(block);
+#endif
+    return false;
+}
+
+static void cache_link(int i, file_handle *fh, uint32 block, uint32 length)
+{
+    cache_block &b = cache_blocks[i];
+    b.fh = fh;
+    b.block = block;
+    b.length = length;
+    b.used = cache_clock;
+    b.dirty_lo = b.dirty_hi = 0;
+    b.complete = true;
+    b.pinned = false;
+    int h = cache_bucket(fh, block);
+    b.next = cache_hash[h];
+    cache_hash[h] = i;
+    if (cache_in_pinned_range(fh, block)) {
+        cache_pin(i);
+    }
+}
+
+static void cache_unlink(int i)
+{
+    int16 *link = &cache_hash[cache_bucket(cache_blocks[i].fh, cache_blocks[i].block)];
+    while (*link != i) {
+        link = &cache_blocks[*link].next;
+    }
+    *link = cache_blocks[i].next;
+    cache_blocks[i].fh = NULL;
+    if (cache_blocks[i].pinned) {
+        cache_blocks[i].pinned = false;
+        perf_set(perf_pinned, --cache_pinned);
+    }
+}
+
+// Bytes of the file in a block
+static inline uint32 cache_block_length(file_handle *fh, uint32 block)
+{
+    loff_t start = (loff_t)block * DISK_CACHE_BLOCK;
+    return (fh->size - start < DISK_CACHE_BLOCK) ? fh->size - start : DISK_CACHE_BLOCK;
+}
+
+/*
+ *  First block of the dirty run a block belongs to: walk back while the
+ *  previous block is dirty up to its end and this one from its start
+ */
+static int cache_run_head(int i)
+{
+    while (cache_blocks[i].dirty_lo == 0 && cache_blocks[i].block > 0) {
+        int j = cache_find(cache_blocks[i].fh, cache_blocks[i].block - 1);
+        if (j == CACHE_NONE || !cache_is_dirty(j) || cache_blocks[j].dirty_hi != cache_blocks[j].length) {
+            break;
+        }
+        i = j;
+    }
+    return i;
+}
+
+/*
+ *  Write back the dirty run starting at block i with one write
+ *  
+ *  The run continues into the next block of the file while a dirty range
+ *  ends at its block's end and the next one starts at 0. Incomplete blocks
+ *  are dropped once written, the card has all of their data.
+ */
+static void cache_flush_run(int i)
+{
+    file_handle *fh = cache_blocks[i].fh;
+    loff_t start = (loff_t)cache_blocks[i].block * DISK_CACHE_BLOCK + cache_blocks[i].dirty_lo;
+    uint32 size = 0;
+    
+    for (;;) {
+        cache_block &b = cache_blocks[i];
+        uint32 n = b.dirty_hi - b.dirty_lo;
+        if (size + n > DISK_FLUSH_RUN) {
+            break;
+        }
+        memcpy(flush_buffer + size, cache_data + i * DISK_CACHE_BLOCK + b.dirty_lo, n);
+        size += n;
+        
+        bool run_continues = (b.dirty_hi == b.length);
+        uint32 block = b.block;
+        b.dirty_lo = b.dirty_hi = 0;
+        cache_dirty--;
+        if (!b.complete) {
+            cache_unlink(i);
+        }
+        
+        if (!run_continues) {
+            break;
+        }
+        i = cache_find(fh, block + 1);
+        if (i == CACHE_NONE || !cache_is_dirty(i) || cache_blocks[i].dirty_lo != 0) {
+            break;
+        }
+    }
+    
+    if (card_write(fh, flush_buffer, start, size) != size) {
+        Serial.printf("[SYS] ERROR: Write back of %u bytes at %lld to %s failed\n",
+                      size, (long long)start, fh->path);
+    }
+    fh->is_dirty = true;
+}
+
+/*
+ *  Write back the dirty blocks of a file in a byte range (all files if fh is NULL)
+ */
+static void cache_flush_range(file_handle *fh, loff_t offset, loff_t length)
+{
+    // A run cut at DISK_FLUSH_RUN may go on in blocks already passed
+    bool flushed = true;
+    while (flushed) {
+        flushed = false;
+        for (int i = 0; i < CACHE_BLOCKS; i++) {
+            if (!cache_is_dirty(i) || (fh != NULL && cache_blocks[i].fh != fh)) {
+                continue;
+            }
+            loff_t start = (loff_t)cache_blocks[i].block * DISK_CACHE_BLOCK;
+            if (fh == NULL || (start < offset + length && start + DISK_CACHE_BLOCK > offset)) {
+                cache_flush_run(cache_run_head(i));
+                flushed = true;
+            }
+        }
+    }
+}
+
+// Clean unpinned block, the least recently used one (free ones first)
+static int cache_victim(void)
+{
+    int victim = CACHE_NONE;
+    for (int i = 0; i < CACHE_BLOCKS; i++) {
+        if (cache_blocks[i].fh == NULL) {
+            return i;
+        }
+        if (!cache_is_dirty(i) && !cache_blocks[i].pinned && (victim == CACHE_NONE || (int32)(cache_blocks[i].used - cache_blocks[victim].used) < 0)) {
+            victim = i;
+        }
+    }
+    if (victim == CACHE_NONE) {
+        // Cannot happen below the dirty limit, which leaves clean blocks
+        // beside the HFS_PIN_LIMIT pinned ones, but never lose writes
+        cache_flush_range(NULL, 0, 0);
+        return cache_victim();
+    }
+    cache_unlink(victim);
+    return victim;
+}
+
+/*
+ *  Read count blocks from the card into the cache, starting at block
+ *  Stops at the end of the file and at a block already cached
+ *  Returns the cache index of the first block, or CACHE_NONE on a read error
+ */
+static int cache_fill(file_handle *fh, uint32 block, int count)
+{
+    int first = CACHE_NONE;
+    for (int n = 0; n < count; n++, block++) {
+        loff_t start = (loff_t)block * DISK_CACHE_BLOCK;
+        if (start >= fh->size || (n > 0 && cache_find(fh, block) != CACHE_NONE)) {
+            break;
+        }
+        uint32 want = cache_block_length(fh, block);
+        
+        int i = cache_victim();
+        if (card_read(fh, cache_data + i * DISK_CACHE_BLOCK, start, want) != want) {
+            break;
+        }
+        cache_link(i, fh, block, want);
+        if (n == 0) {
+            first = i;
+        }
+    }
+    return first;
+}
+
+/*
+ *  Read the part of an incomplete block that was not written from the card
+ */
+static bool cache_complete(int i)
+{
+    cache_block &b = cache_blocks[i];
+    if (card_read(b.fh, flush_buffer, (loff_t)b.block * DISK_CACHE_BLOCK, b.length) != b.length) {
+        return false;
+    }
+    uint8 *data = cache_data + i * DISK_CACHE_BLOCK;
+    memcpy(data, flush_buffer, b.dirty_lo);
+    memcpy(data + b.dirty_hi, flush_buffer + b.dirty_hi, b.length - b.dirty_hi);
+    b.complete = true;
+    return true;
+}
+
+/*
+ *  Drop all blocks of a file in a byte range, after writing back their data
+ */
+static void cache_drop_range(file_handle *fh, loff_t offset, loff_t length)
+{
+    cache_flush_range(fh, offset, length);
+    for (int i = 0; i < CACHE_BLOCKS; i++) {
+        loff_t start = (loff_t)cache_blocks[i].block * DISK_CACHE_BLOCK;
+        if (cache_blocks[i].fh == fh && start < offset + length && start + DISK_CACHE_BLOCK > offset) {
+            cache_unlink(i);
+        }
+    }
+}
+
+/*
+ *  Read through the cache
+ *  Returns the number of bytes read, short at the end of the file or on an error
+ */
+static size_t cache_read(file_handle *fh, uint8 *buffer, loff_t offset, size_t length)
+{
+    bool sequential = (offset == fh->next_read);
+    size_t done = 0;
+    
+    while (done < length) {
+        loff_t pos = offset + done;
+        uint32 block = pos / DISK_CACHE_BLOCK;
+        uint32 in_block = pos % DISK_CACHE_BLOCK;
+        
+        int i = cache_find(fh, block);
+        stats_block(fh, i != CACHE_NONE && cache_blocks[i].complete);
+        if (i == CACHE_NONE) {
+            i = cache_fill(fh, block, sequential ? cache_readahead : 1);
+            if (i == CACHE_NONE) {
+                break;
+            }
+        } else if (!cache_blocks[i].complete && !cache_complete(i)) {
+            break;
+        }
+        cache_block &b = cache_blocks[i];
+        b.used = ++cache_clock;
+        if (in_block >= b.length) {
+            break;
+        }
+        
+        size_t n = b.length - in_block;
+        if (n > length - done) {
+            n = length - done;
+        }
+        memcpy(buffer + done, cache_data + i * DISK_CACHE_BLOCK + in_block, n);
+        done += n;
+    }
+    return done;
+}
+
+/*
+ *  Write into the cache
+ *  Returns the number of bytes written, short at the end of the file or on an error
+ */
+static size_t cache_write(file_handle *fh, const uint8 *buffer, loff_t offset, size_t length)
+{
+    size_t done = 0;
+    
+    while (done < length) {
+        loff_t pos = offset + done;
+        uint32 block = pos / DISK_CACHE_BLOCK;
+        uint32 in_block = pos % DISK_CACHE_BLOCK;
+        if (pos >= fh->size) {
+            break;
+        }
+        uint32 block_length = cache_block_length(fh, block);
+        uint32 n = block_length - in_block;
+        if (n > length - done) {
+            n = length - done;
+        }
+        
+        int i = cache_find(fh, block);
+        if (i == CACHE_NONE) {
+            // Nothing to read from the card, the block is only what is written
+            i = cache_victim();
+            cache_link(i, fh, block, block_length);
+            cache_blocks[i].complete = (in_block == 0 && n == block_length);
+        } else if (!cache_blocks[i].complete && (in_block > cache_blocks[i].dirty_hi || in_block + n < cache_blocks[i].dirty_lo)) {
+            // The dirty range must stay one range of valid bytes
+            if (!cache_complete(i)) {
+                break;
+            }
+        }
+        
+        cache_block &b = cache_blocks[i];
+        memcpy(cache_data + i * DISK_CACHE_BLOCK + in_block, buffer + done, n);
+        if (!cache_is_dirty(i)) {
+            b.dirty_lo = in_block;
+            b.dirty_hi = in_block + n;
+            cache_dirty++;
+        } else {
+            if (in_block < b.dirty_lo) b.dirty_lo = in_block;
+            if (in_block + n > b.dirty_hi) b.dirty_hi = in_block + n;
+        }
+        b.used = ++cache_clock;
+        done += n;
+    }
+    return done;
+}
+
+static inline void io_lock_take(void)
+{
+    if (io_lock) xSemaphoreTake(io_lock, portMAX_DELAY);
+}
+
+static inline void io_lock_give(void)
+{
+    if (io_lock) xSemaphoreGive(io_lock);
+}
+
+// Driver reads and writes waiting for io_lock; the prefetch lets them go first
+static volatile uint32 io_waiting = 0;
+
+static inline void io_lock_take_request(void)
+{
+    __atomic_add_fetch(&io_waiting, 1, __ATOMIC_RELAXED);
+    io_lock_take();
+    __atomic_sub_fetch(&io_waiting, 1, __ATOMIC_RELAXED);
+}
+#else
+static inline void io_lock_take(void) {}
+static inline void io_lock_give(void) {}
+static inline void io_lock_take_request(void) {}
+#endif
+
+#if FLOPPY_RAM_SIZE
+/*
+ *  Floppy RAM images
+ *  
+ *  A floppy image of up to FLOPPY_RAM_SIZE is read into PSRAM in one
+ *  transfer when it is opened, and Sony driver reads and writes are memory
+ *  copies. The range written since the last write back goes to the card
+ *  with the periodic flush, on eject and on close. Floppies stay out of the
+ *  block cache, so a disk tool copying a floppy does not evict hard disk
+ *  blocks.
+ */
+static void ram_image_load(file_handle *fh)
+{
+    if (!fh->is_floppy || fh->flash_image || fh->size > FLOPPY_RAM_SIZE) {
+        return;
+    }
+    uint8 *data = (uint8 *)heap_caps_aligned_alloc(DMA_ALIGN, fh->size, MALLOC_CAP_SPIRAM);
+    if (data == NULL) {
+        return;
+    }
+    io_lock_take();
+    size_t actual = card_read(fh, data, 0, fh->size);
+    io_lock_give();
+    if (actual != (size_t)fh->size) {
+        heap_caps_free(data);
+        return;
+    }
+    fh->ram_image = data;
+    fh->ram_dirty_lo = fh->size;
+    fh->ram_dirty_hi = 0;
+}
+
+// Write the dirty range back (io_lock held)
+static void ram_image_flush(file_handle *fh)
+{
+    if (fh->ram_dirty_hi <= fh->ram_dirty_lo) {
+        return;
+    }
+    loff_t lo = fh->ram_dirty_lo, length = fh->ram_dirty_hi - lo;
+    if (card_write(fh, fh->ram_image + lo, lo, length) == (size_t)length) {
+        fh->ram_dirty_lo = fh->size;
+        fh->ram_dirty_hi = 0;
+    }
+    fh->is_dirty = true;
+}
+
+static size_t ram_image_read(file_handle *fh, void *buffer, loff_t offset, size_t length)
+{
+    if (offset >= fh->size) {
+        return 0;
+    }
+    if (length > (size_t)(fh->size - offset)) {
+        length = fh->size - offset;
+    }
+    memcpy(buffer, fh->ram_image + offset, length);
+    return length;
+}
+
+static size_t ram_image_write(file_handle *fh, const void *buffer, loff_t offset, size_t length)
+{
+    if (offset >= fh->size) {
+        return 0;
+    }
+    if (length > (size_t)(fh->size - offset)) {
+        length = fh->size - offset;
+    }
+    memcpy(fh->ram_image + offset, buffer, length);
+    if (offset < fh->ram_dirty_lo) fh->ram_dirty_lo = offset;
+    if (offset + (loff_t)length > fh->ram_dirty_hi) fh->ram_dirty_hi = offset + length;
+    return length;
+}
+#endif
+
+#if FLASH_DISK
+/*
+ *  Flash images
+ *  
+ *  The image named by the "flashdisk" pref is kept in the sysvol flash
+ *  partition (see flash_disk_esp32.cpp) and read from its mapping with
+ *  memory copies, outside the block cache. A writable image gets an overlay
+ *  file next to it on the card, "<image>.cow": a header, a bitmap of the
+ *  512-byte sectors written, then each sector written at its image offset
+ *  past the bitmap. Sectors in the bitmap are read from there. The overlay
+ *  belongs to one version of the image (size and modification time) and
+ *  starts over empty when the image on the card changes; the image file
+ *  itself is never written. Reads and writes run with io_lock held.
+ */
+#define OVERLAY_MAGIC       0x42324f56      // 'B2OV'
+#define OVERLAY_VERSION     1
+#define OVERLAY_SECTOR      512
+#define OVERLAY_MAP         OVERLAY_SECTOR  // Bitmap offset, after the header
+
+struct overlay_header {
+    uint32 magic;
+    uint32 version;
+    uint32 size;        // Size and modification time of the image it belongs to
+    uint32 mtime;
+};
+
+// Bitmap bytes, in whole sectors
+static inline loff_t overlay_map_size(file_handle *fh)
+{
+    loff_t bytes = (fh->size / OVERLAY_SECTOR + 7) / 8;
+    return (bytes + OVERLAY_SECTOR - 1) & ~(loff_t)(OVERLAY_SECTOR - 1);
+}
+
+static inline loff_t overlay_data(file_handle *fh)
+{
+    return OVERLAY_MAP + overlay_map_size(fh);
+}
+
+static inline bool overlay_has(file_handle *fh, uint32 sector)
+{
+    return fh->overlay_map && (fh->overlay_map[sector >> 3] & (1 << (sector & 7)));
+}
+
+// Image bytes from the card for FlashDiskMap()
+static bool flash_image_copy(void *arg, void *buffer, uint32 offset, uint32 length)
+{
+    file_handle *fh = (file_handle *)arg;
+    io_lock_take();
+    size_t actual = card_read(fh, buffer, offset, length);
+    io_lock_give();
+    return actual == length;
+}
+
+// Open the overlay of a writable image, in place of the image file
+static bool overlay_open(file_handle *fh, const char *path, const struct stat &st)
+{
+    char overlay_path[sizeof(fh->path) + sizeof(SD_MOUNT_POINT) + 4];
+    snprintf(overlay_path, sizeof(overlay_path), "%s.cow", path);
+    int fd = open(overlay_path, O_RDWR | O_CREAT, 0666);
+    if (fd < 0) {
+        return false;
+    }
+    ssize_t map_size = overlay_map_size(fh);
+    uint8 *map = (uint8 *)heap_caps_calloc(1, map_size, MALLOC_CAP_SPIRAM);
+    if (map == NULL) {
+        close(fd);
+        return false;
+    }
+    
+    overlay_header h;
+    if (pread(fd, &h, sizeof(h), 0) != sizeof(h) || h.magic != OVERLAY_MAGIC || h.version != OVERLAY_VERSION
+        || h.size != (uint32)fh->size || h.mtime != (uint32)st.st_mtime
+        || pread(fd, map, map_size, OVERLAY_MAP) != map_size) {
+        // New, or written over another version of the image: start over empty
+        memset(map, 0, map_size);
+        h.magic = OVERLAY_MAGIC;
+        h.version = OVERLAY_VERSION;
+        h.size = fh->size;
+        h.mtime = st.st_mtime;
+        if (ftruncate(fd, 0) != 0 || pwrite(fd, &h, sizeof(h), 0) != sizeof(h)
+            || pwrite(fd, map, map_size, OVERLAY_MAP) != map_size) {
+            heap_caps_free(map);
+            close(fd);
+            return false;
+        }
+        fsync(fd);
+        Serial.printf("[SYS] %s: new overlay %s\n", fh->path, overlay_path);
+    }
+    close(fh->fd);
+    fh->fd = fd;
+    fh->overlay_map = map;
+    return true;
+}
+
+static void flash_image_open(file_handle *fh, const char *path, const struct stat &st)
+{
+    const char *flash_name = PrefsFindString("flashdisk");
+    if (flash_name == NULL || strcmp(flash_name, fh->path) != 0 || fh->is_cdrom || (fh->size % OVERLAY_SECTOR) != 0) {
+        return;
+    }
+    const uint8 *image = FlashDiskMap(fh->path, fh->size, st.st_mtime, flash_image_copy, fh);
+    if (image == NULL) {
+        return;
+    }
+    if (!fh->read_only && !overlay_open(fh, path, st)) {
+        Serial.printf("[SYS] WARNING: %s: no overlay file, the volume is read-only\n", fh->path);
+        fh->read_only = true;
+    }
+#if USE_CHUNKED_IMAGES
+    // The image is not read from the card any more
+    if (fh->chunks) {
+        chunk_close(fh);
+    }
+#endif
+    fh->flash_image = image;
+}
+
+static void flash_image_close(file_handle *fh)
+{
+    FlashDiskUnmap();
+    heap_caps_free(fh->overlay_map);
+    fh->overlay_map = NULL;
+    fh->flash_image = NULL;
+}
+
+static size_t flash_image_read(file_handle *fh, void *buffer, loff_t offset, size_t length)
+{
+    if (offset >= fh->size) {
+        return 0;
+    }
+    if (length > (size_t)(fh->size - offset)) {
+        length = fh->size - offset;
+    }
+    uint8 *dst = (uint8 *)buffer;
+    loff_t pos = offset, end = offset + length;
+    while (pos < end) {
+        // A run of sectors all in flash or all in the overlay
+        bool in_overlay = overlay_has(fh, pos / OVERLAY_SECTOR);
+        loff_t run_end = (pos / OVERLAY_SECTOR + 1) * OVERLAY_SECTOR;
+        while (run_end < end && overlay_has(fh, run_end / OVERLAY_SECTOR) == in_overlay) {
+            run_end += OVERLAY_SECTOR;
+        }
+        size_t n = (run_end < end ? run_end : end) - pos;
+        if (!in_overlay) {
+            memcpy(dst, fh->flash_image + pos, n);
+        } else if (raw_read(fh, dst, overlay_data(fh) + pos, n) != n) {
+            break;
+        }
+        dst += n;
+        pos += n;
+    }
+    return pos - offset;
+}
+
+// Sector data first, then the bitmap bytes that mark it
+static size_t flash_image_write(file_handle *fh, const void *buffer, loff_t offset, size_t length)
+{
+    if (fh->overlay_map == NULL || offset >= fh->size) {
+        return 0;
+    }
+    if (length > (size_t)(fh->size - offset)) {
+        length = fh->size - offset;
+    }
+    const uint8 *src = (const uint8 *)buffer;
+    loff_t pos = offset, end = offset + length, data = overlay_data(fh);
+    while (pos < end) {
+        loff_t sector_start = pos & ~(loff_t)(OVERLAY_SECTOR - 1);
+        size_t n;
+        if (pos != sector_start || end - pos < OVERLAY_SECTOR) {
+            // Part of a sector, completed from what it holds now
+            uint8 sector[OVERLAY_SECTOR];
+            n = (sector_start + OVERLAY_SECTOR < end ? sector_start + OVERLAY_SECTOR : end) - pos;
+            if (flash_image_read(fh, sector, sector_start, OVERLAY_SECTOR) != OVERLAY_SECTOR) {
+                break;
+            }
+            memcpy(sector + (pos - sector_start), src, n);
+            if (raw_write(fh, sector, data + sector_start, OVERLAY_SECTOR) != OVERLAY_SECTOR) {
+                break;
+            }
+        } else {
+            n = (end & ~(loff_t)(OVERLAY_SECTOR - 1)) - pos;
+            if (raw_write(fh, src, data + pos, n) != n) {
+                break;
+            }
+        }
+        for (loff_t s = sector_start; s < pos + (loff_t)n; s += OVERLAY_SECTOR) {
+            uint32 sector = s / OVERLAY_SECTOR;
+            fh->overlay_map[sector >> 3] |= 1 << (sector & 7);
+        }
+        src += n;
+        pos += n;
+    }
+    if (pos > offset) {
+        uint32 lo = offset / OVERLAY_SECTOR / 8, hi = (pos - 1) / OVERLAY_SECTOR / 8 + 1;
+        raw_write(fh, fh->overlay_map + lo, OVERLAY_MAP + lo, hi - lo);
+        fh->is_dirty = true;
+    }
+    return pos - offset;
+}
+#endif
+
 /*
  *  Initialize SD card
  */
@@ -81,30 +1300,150 @@ static void unregister_file_handle(file_handle *fh)
 }
 
 /*
- *  Periodic flush - ensures data is written to SD card
- *  Called every 2 seconds from main loop
+ *  Let the file system write the directory entries and FAT of the files
+ *  written since the last time (io_lock held)
  *  
  *  OPTIMIZED: Only flushes handles that have been written to since last flush.
  *  This avoids unnecessary SD card operations when files haven't changed.
  */
-void Sys_periodic_flush(void)
+static void flush_files(void)
 {
     for (int i = 0; i < 16; i++) {
         file_handle *fh = open_file_handles[i];
+#if FLOPPY_RAM_SIZE
+        if (fh != NULL && fh->ram_image) {
+            ram_image_flush(fh);
+        }
+#endif
         if (fh != NULL && fh->is_open && !fh->read_only && fh->is_dirty) {
-            fh->file.flush();
+            fsync(fh->fd);
             fh->is_dirty = false;  // Clear dirty flag after flush
         }
     }
 }
 
+/*
+ *  Write everything that is still cached and flush the files
+ *  (hibernate, shutdown)
+ */
+void Sys_sync(void)
+{
+    io_lock_take();
+#if DISK_CACHE_SIZE
+    if (cache_data) {
+        cache_flush_range(NULL, 0, 0);
+    }
+#endif
+    flush_files();
+    io_lock_give();
+}
+
+#if DISK_CACHE_SIZE
+/*
+ *  Write back task (Core 0)
+ *  Writes the dirty runs one per lock, then flushes the files
+ */
+static void flushTask(void *param)
+{
+    UNUSED(param);
+    task_run(flush_task_stats);
+    for (;;) {
+        task_wait(flush_task_stats, 0);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        task_run(flush_task_stats);
+        
+        bool more = true;
+        while (more) {
+            io_lock_take();
+            more = false;
+            for (int i = 0; i < CACHE_BLOCKS; i++) {
+                if (cache_is_dirty(i)) {
+                    cache_flush_run(cache_run_head(i));
+                    more = true;
+                    break;
+                }
+            }
+            if (!more) {
+                flush_files();
+            }
+            io_lock_give();
+        }
+    }
+}
+
+static void cache_init(void)
+{
+    // Aligned, so that blocks are read and written by DMA
+    cache_data = (uint8 *)heap_caps_aligned_alloc(DMA_ALIGN, CACHE_BLOCKS * DISK_CACHE_BLOCK, MALLOC_CAP_SPIRAM);
+    flush_buffer = (uint8 *)heap_caps_aligned_alloc(DMA_ALIGN, DISK_FLUSH_RUN, MALLOC_CAP_SPIRAM);
+    io_lock = xSemaphoreCreateMutex();
+    if (cache_data == NULL || flush_buffer == NULL || io_lock == NULL) {
+        Serial.println("[SYS] WARNING: No memory for the disk cache, direct I/O");
+        heap_caps_free(cache_data);
+        heap_caps_free(flush_buffer);
+        cache_data = NULL;
+        return;
+    }
+    memset(cache_blocks, 0, sizeof(cache_blocks));
+    for (int i = 0; i < CACHE_HASH_SIZE; i++) {
+        cache_hash[i] = CACHE_NONE;
+    }
+    
+    // Without the task, Sys_periodic_flush() writes back on the CPU core
+    if (xTaskCreatePinnedToCore(flushTask, "DiskFlush", FLUSH_TASK_STACK_SIZE, NULL,
+                                FLUSH_TASK_PRIORITY, &flush_task_handle, FLUSH_TASK_CORE) != pdPASS) {
+        Serial.println("[SYS] WARNING: No disk flush task, writing back on the CPU core");
+        flush_task_handle = NULL;
+    }
+    ConsoleAddTunable("readahead", &cache_readahead, 1, CACHE_BLOCKS / 4);
+    ConsoleAddTunable("dirtylimit", &cache_dirty_limit, 2, CACHE_BLOCKS - HFS_PIN_LIMIT - 1);
+    Serial.printf("[SYS] Disk cache: %d KB in %d KB blocks, read-ahead %d, write-back limit %d blocks\n",
+                  DISK_CACHE_SIZE / 1024, DISK_CACHE_BLOCK / 1024, DISK_CACHE_READAHEAD, DISK_DIRTY_LIMIT);
+}
+#endif
+
+/*
+ *  Periodic flush - ensures data is written to SD card
+ *  Called every 2 seconds from main loop, only wakes the flush task
+ */
+void Sys_periodic_flush(void)
+{
+#if DISK_CACHE_SIZE
+    if (flush_task_handle) {
+        task_notify(flush_task_stats);
+        xTaskNotifyGive(flush_task_handle);
+        return;
+    }
+#endif
+    Sys_sync();
+}
+
+#if USE_ASYNC_DISK
+static void io_task_init(void);
+#endif
+#define USE_PREFETCH (PARALLEL_BOOT && USE_ASYNC_DISK && DISK_CACHE_SIZE)
+#if USE_PREFETCH
+static void prefetch_start(file_handle *fh);
+static void prefetch_forget(file_handle *fh);
+#endif
+
 /*
  *  Initialization
  */
 void SysInit(void)
 {
     init_sd_card();
+    UsbMscInit();
+    bounce_buffer = (uint8 *)heap_caps_aligned_alloc(DMA_ALIGN, BOUNCE_SIZE, MALLOC_CAP_SPIRAM);
+#if DISK_CACHE_SIZE
+    cache_init();
+#else
     Serial.println("[SYS] Direct I/O mode (no caching)");
+#endif
+#if USE_ASYNC_DISK
+    io_task_init();
+#endif
+    InitBinCue();
 }
 
 /*
@@ -112,8 +1451,10 @@ void SysInit(void)
  */
 void SysExit(void)
 {
-    // Flush all open files
-    Sys_periodic_flush();
+    // Let a transfer in flight end, then write back and flush all open files
+    SysWaitIO();
+    ExitBinCue();
+    Sys_sync();
     sd_initialized = false;
 }
 
@@ -146,40 +1487,110 @@ void SysAddSerialPrefs(void)
 }
 
 /*
- *  Repair HFS volume - fix common corruption issues from improper shutdown
+ *  HFS volume check
+ *  
+ *  A writable .dsk volume is checked for leftovers of an improper shutdown
+ *  (attributes differing from the alternate MDB, stale Finder info words)
+ *  through the descriptor Sys_open() already holds. An image that has not
+ *  changed since it was last checked is skipped: HFS_CHECK_FILE_PATH keeps
+ *  the path hash, size and modification time of the images checked, so a
+ *  boot with unchanged images costs no MDB reads at all. The first write to
+ *  an image drops its record too: without a real time clock, FAT
+ *  modification times mean little.
  */
-static void Sys_repair_hfs_volume(const char *path)
+#define HFS_CHECK_FILE_PATH "/BasiliskII_HFSCheck"
+#define HFS_CHECK_RECORDS   16
+
+struct hfs_check_record {
+    uint32 path_hash;
+    uint32 size;
+    uint32 mtime;
+};
+
+static hfs_check_record hfs_checked[HFS_CHECK_RECORDS];
+static bool hfs_checked_loaded = false;
+
+static uint32 hfs_path_hash(const char *path)
 {
-    // Only repair .dsk files
-    if (strstr(path, ".dsk") == NULL && strstr(path, ".DSK") == NULL) {
-        return;
+    uint32 h = 2166136261u;     // FNV-1a
+    while (*path) {
+        h = (h ^ (uint8)*path++) * 16777619u;
     }
-    
-    Serial.printf("[SYS] Checking HFS volume: %s\n", path);
-    
-    File f = SD.open(path, "r+b");
-    if (!f) {
-        return;
+    return h ? h : 1;
+}
+
+static hfs_check_record *hfs_check_find(uint32 path_hash)
+{
+    if (!hfs_checked_loaded) {
+        hfs_checked_loaded = true;
+        File f = SDCard().open(HFS_CHECK_FILE_PATH, FILE_READ);
+        if (f) {
+            f.read((uint8_t *)hfs_checked, sizeof(hfs_checked));
+            f.close();
+        }
     }
-    
-    size_t file_size = f.size();
-    if (file_size < 1024 + 512) {
+    for (int i = 0; i < HFS_CHECK_RECORDS; i++) {
+        if (hfs_checked[i].path_hash == path_hash) {
+            return &hfs_checked[i];
+        }
+    }
+    return NULL;
+}
+
+static void hfs_check_save(void)
+{
+    File f = SDCard().open(HFS_CHECK_FILE_PATH, FILE_WRITE);
+    if (f) {
+        f.write((const uint8_t *)hfs_checked, sizeof(hfs_checked));
         f.close();
-        return;
+    }
+}
+
+static void hfs_check_remember(uint32 path_hash, const struct stat &st)
+{
+    hfs_check_record *r = hfs_check_find(path_hash);
+    if (r == NULL) {
+        // Replace the oldest record
+        memmove(&hfs_checked[1], &hfs_checked[0], sizeof(hfs_checked) - sizeof(hfs_checked[0]));
+        r = &hfs_checked[0];
+    }
+    r->path_hash = path_hash;
+    r->size = st.st_size;
+    r->mtime = st.st_mtime;
+    hfs_check_save();
+}
+
+static void hfs_check_forget(uint32 path_hash)
+{
+    hfs_check_record *r = hfs_check_find(path_hash);
+    if (r != NULL) {
+        memset(r, 0, sizeof(*r));
+        hfs_check_save();
+    }
+}
+
+/*
+ *  Repair HFS volume - fix common corruption issues from improper shutdown
+ *  Returns true if the MDB was rewritten
+ */
+static bool Sys_repair_hfs_volume(file_handle *fh)
+{
+    Serial.printf("[SYS] Checking HFS volume: %s\n", fh->path);
+    
+    if (fh->size < 1024 + 512) {
+        return false;
     }
     
     // Read main MDB
     uint8_t mdb[128];
-    if (!f.seek(1024) || f.read(mdb, 128) != 128) {
-        f.close();
-        return;
+    if (pread(fh->fd, mdb, 128, 1024) != 128) {
+        return false;
     }
     
     // Check HFS signature
     uint16_t signature = (mdb[0] << 8) | mdb[1];
     if (signature != 0x4244) {
-        f.close();
-        return;
+        return false;
     }
     
     // Read key fields
@@ -188,17 +1599,12 @@ static void Sys_repair_hfs_volume(const char *path)
     uint32_t drFndrInfo3 = (mdb[104] << 24) | (mdb[105] << 16) | (mdb[106] << 8) | mdb[107];
     
     // Get original drAtrb from Alternate MDB
-    size_t amdb_offset = ((file_size / 512) - 2) * 512;
+    loff_t amdb_offset = ((fh->size / 512) - 2) * 512;
     uint16_t original_drAtrb = drAtrb;
     
-    uint8_t amdb_sig[2];
-    if (f.seek(amdb_offset) && f.read(amdb_sig, 2) == 2) {
-        if ((amdb_sig[0] << 8 | amdb_sig[1]) == 0x4244) {
-            uint8_t amdb_atrb[2];
-            if (f.seek(amdb_offset + 10) && f.read(amdb_atrb, 2) == 2) {
-                original_drAtrb = (amdb_atrb[0] << 8) | amdb_atrb[1];
-            }
-        }
+    uint8_t amdb[12];
+    if (pread(fh->fd, amdb, 12, amdb_offset) == 12 && (amdb[0] << 8 | amdb[1]) == 0x4244) {
+        original_drAtrb = (amdb[10] << 8) | amdb[11];
     }
     
     bool needs_repair = false;
@@ -221,17 +1627,14 @@ static void Sys_repair_hfs_volume(const char *path)
     
     if (needs_repair) {
         Serial.println("[SYS] Repairing HFS volume...");
-        f.seek(1024 + 10);
-        f.write(&mdb[10], 2);
-        f.seek(1024 + 100);
-        f.write(&mdb[100], 8);
-        f.flush();
+        pwrite(fh->fd, &mdb[10], 2, 1024 + 10);
+        pwrite(fh->fd, &mdb[100], 8, 1024 + 100);
+        fsync(fh->fd);
         Serial.println("[SYS] Volume repaired");
     } else {
         Serial.println("[SYS] Volume OK");
     }
-    
-    f.close();
+    return needs_repair;
 }
 
 /*
@@ -243,11 +1646,6 @@ void *Sys_open(const char *name, bool read_only, bool is_cdrom)
         return NULL;
     }
     
-    // Repair HFS volume before opening
-    if (!read_only && !is_cdrom) {
-        Sys_repair_hfs_volume(name);
-    }
-    
     file_handle *fh = new file_handle;
     if (!fh) {
         return NULL;
@@ -256,6 +1654,23 @@ void *Sys_open(const char *name, bool read_only, bool is_cdrom)
     memset(fh, 0, sizeof(file_handle));
     strncpy(fh->path, name, sizeof(fh->path) - 1);
     fh->is_cdrom = is_cdrom;
+
+    // A cue sheet opens its own .bin files
+    size_t name_len = strlen(name);
+    if (is_cdrom && name_len > 4 && strcasecmp(name + name_len - 4, ".cue") == 0) {
+        fh->bincue = open_bincue(name);
+        fh->size = fh->bincue ? size_bincue(fh->bincue) : 0;
+        if (fh->size <= 0) {
+            close_bincue(fh->bincue);
+            delete fh;
+            return NULL;
+        }
+        fh->fd = -1;
+        fh->read_only = true;
+        fh->is_open = true;
+        Serial.printf("[SYS] Opened %s (%lld KB data track, ro=1)\n", name, (long long)(fh->size / 1024));
+        return fh;
+    }
     fh->is_floppy = (strstr(name, ".img") != NULL || strstr(name, ".IMG") != NULL);
     
     // Determine read-only status
@@ -264,42 +1679,91 @@ void *Sys_open(const char *name, bool read_only, bool is_cdrom)
     } else {
         fh->read_only = read_only;
     }
-    
-    // Open file
+    
+    // Open file, its directory entry gives the size. Images on the USB drive
+    // have its mount point in their name, and wait for it to be mounted.
+    char path[sizeof(fh->path) + sizeof(SD_MOUNT_POINT)];
+    if (UsbMscPath(name)) {
+        if (!UsbMscReady()) {
+            delete fh;
+            return NULL;
+        }
+        snprintf(path, sizeof(path), "%s", name);
+    } else {
+        snprintf(path, sizeof(path), "%s%s", SD_MOUNT_POINT, name);
+    }
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        delete fh;
+        return NULL;
+    }
     if (fh->read_only) {
-        fh->file = SD.open(name, FILE_READ);
+        fh->fd = open(path, O_RDONLY);
     } else {
-        fh->file = SD.open(name, "r+b");
-        if (!fh->file) {
-            fh->file = SD.open(name, FILE_READ);
+        fh->fd = open(path, O_RDWR);
+        if (fh->fd < 0) {
+            fh->fd = open(path, O_RDONLY);
             fh->read_only = true;
         }
     }
     
-    if (!fh->file) {
+    if (fh->fd < 0) {
         delete fh;
         return NULL;
     }
     
-    fh->size = fh->file.size();
-    if (fh->size == 0) {
-        if (fh->file.seek(0, SeekEnd)) {
-            fh->size = fh->file.position();
-            fh->file.seek(0, SeekSet);
+    fh->size = st.st_size;
+#if USE_CHUNKED_IMAGES
+    if (fh->size > 0) {
+        int chunked = chunk_open(fh, fh->size);
+        if (chunked < 0) {
+            close(fh->fd);
+            delete fh;
+            return NULL;
+        }
+        if (chunked > 0) {
+            Serial.printf("[SYS] %s: chunked image, %u chunks of %u KB\n",
+                          name, fh->chunks->chunk_count, fh->chunks->chunk_size / 1024);
         }
     }
-    
-    if (fh->size == 0) {
-        fh->file.close();
+#endif
+    if (fh->size <= 0) {
+        close(fh->fd);
         delete fh;
         return NULL;
     }
+#if FLASH_DISK
+    flash_image_open(fh, path, st);
+#endif
+    
+    // Check an HFS volume left by an improper shutdown, unless unchanged since the last check
+    if (!fh->read_only && fh->chunks == NULL && fh->flash_image == NULL &&
+        (strstr(name, ".dsk") != NULL || strstr(name, ".DSK") != NULL)) {
+        uint32 path_hash = hfs_path_hash(name);
+        hfs_check_record *r = hfs_check_find(path_hash);
+        if (r == NULL || r->size != (uint32)st.st_size || r->mtime != (uint32)st.st_mtime) {
+            if (Sys_repair_hfs_volume(fh)) {
+                stat(path, &st);
+            }
+            hfs_check_remember(path_hash, st);
+        }
+        fh->check_hash = path_hash;
+    }
+#if FLOPPY_RAM_SIZE
+    ram_image_load(fh);
+#endif
     
     fh->is_open = true;
+    io_lock_take();
     register_file_handle(fh);
+#if USE_PREFETCH
+    prefetch_start(fh);
+#endif
+    io_lock_give();
     
-    Serial.printf("[SYS] Opened %s (%lld KB, ro=%d)\n", 
-                  name, (long long)(fh->size / 1024), fh->read_only);
+    Serial.printf("[SYS] Opened %s (%lld KB, ro=%d%s)\n", 
+                  name, (long long)(fh->size / 1024), fh->read_only,
+                  fh->ram_image ? ", in PSRAM" : fh->flash_image ? ", in flash" : "");
     
     return fh;
 }
@@ -312,19 +1776,100 @@ void Sys_close(void *arg)
     file_handle *fh = (file_handle *)arg;
     if (!fh) return;
     
+    if (fh->bincue) {
+        close_bincue(fh->bincue);
+        delete fh;
+        return;
+    }
     if (fh->is_open) {
+        io_lock_take();
         unregister_file_handle(fh);
-        fh->file.flush();
-        fh->file.close();
+#if USE_PREFETCH
+        prefetch_forget(fh);
+#endif
+#if DISK_CACHE_SIZE
+        if (cache_data) {
+            cache_drop_range(fh, 0, fh->size);
+        }
+#endif
+#if FLOPPY_RAM_SIZE
+        if (fh->ram_image) {
+            ram_image_flush(fh);
+            heap_caps_free(fh->ram_image);
+            fh->ram_image = NULL;
+        }
+#endif
+        fsync(fh->fd);
+#if USE_CHUNKED_IMAGES
+        if (fh->chunks) {
+            chunk_close(fh);
+        }
+#endif
+        close(fh->fd);
+#if FLASH_DISK
+        if (fh->flash_image) {
+            flash_image_close(fh);
+        }
+#endif
         fh->is_open = false;
+        io_lock_give();
     }
     
     delete fh;
 }
 
 /*
- *  Read from a file/device - direct read, no caching
+ *  Read from a file/device, through the block cache
+ *  (without flushing the CPU's code cache, see Sys_read())
  */
+static size_t read_data(file_handle *fh, void *buffer, loff_t offset, size_t length)
+{
+    // BIN/CUE data tracks are read from their .bin file, outside the cache
+    if (fh->bincue) {
+        return read_bincue(fh->bincue, buffer, offset, length);
+    }
+#if DISK_TELEMETRY
+    uint32 start_us = micros();
+#endif
+    size_t actual = 0;
+    io_lock_take_request();
+#if FLOPPY_RAM_SIZE
+    if (fh->ram_image) {
+        actual = ram_image_read(fh, buffer, offset, length);
+        stats_block(fh, true);
+    } else
+#endif
+#if FLASH_DISK
+    if (fh->flash_image) {
+        actual = flash_image_read(fh, buffer, offset, length);
+        stats_block(fh, true);
+    } else
+#endif
+#if DISK_CACHE_SIZE
+    if (cache_data && length < DISK_CACHE_SIZE / 4 && !fh->is_cdrom) {
+        actual = cache_read(fh, (uint8 *)buffer, offset, length);
+    } else
+#endif
+    {
+#if DISK_CACHE_SIZE
+        // The card must have what is still only in the cache
+        if (cache_data) {
+            cache_flush_range(fh, offset, length);
+        }
+#endif
+        actual = card_read(fh, buffer, offset, length);
+    }
+    fh->next_read = offset + actual;
+#if DISK_TELEMETRY
+    stats_count(false, actual);
+#endif
+    io_lock_give();
+#if DISK_TELEMETRY
+    stats_request(fh, false, offset, actual, start_us);
+#endif
+    return actual;
+}
+
 size_t Sys_read(void *arg, void *buffer, loff_t offset, size_t length)
 {
     file_handle *fh = (file_handle *)arg;
@@ -332,15 +1877,17 @@ size_t Sys_read(void *arg, void *buffer, loff_t offset, size_t length)
         return 0;
     }
     
-    if (!fh->file.seek(offset)) {
-        return 0;
+    size_t actual = read_data(fh, buffer, offset, length);
+
+    // Drivers read straight into Mac RAM, which may replace cached code
+    if (actual > 0) {
+        FlushCodeCache(buffer, actual);
     }
-    
-    return fh->file.read((uint8_t *)buffer, length);
+    return actual;
 }
 
 /*
- *  Write to a file/device - direct write, no buffering
+ *  Write to a file/device, into the block cache (written back later)
  *  Marks handle dirty for deferred flush
  */
 size_t Sys_write(void *arg, void *buffer, loff_t offset, size_t length)
@@ -350,17 +1897,597 @@ size_t Sys_write(void *arg, void *buffer, loff_t offset, size_t length)
         return 0;
     }
     
-    if (!fh->file.seek(offset)) {
-        return 0;
+#if DISK_TELEMETRY
+    uint32 start_us = micros();
+#endif
+    // The volume will need checking again if it is not unmounted cleanly
+    if (fh->check_hash) {
+        hfs_check_forget(fh->check_hash);
+        fh->check_hash = 0;
+    }
+    
+    size_t written = 0;
+    io_lock_take_request();
+#if FLOPPY_RAM_SIZE
+    if (fh->ram_image) {
+        written = ram_image_write(fh, buffer, offset, length);
+    } else
+#endif
+#if FLASH_DISK
+    if (fh->flash_image) {
+        written = flash_image_write(fh, buffer, offset, length);
+    } else
+#endif
+#if DISK_CACHE_SIZE
+    if (cache_data && length < DISK_CACHE_SIZE / 4) {
+        written = cache_write(fh, (uint8 *)buffer, offset, length);
+    } else
+#endif
+    {
+#if DISK_CACHE_SIZE
+        // Cached copies of the range would go stale
+        if (cache_data) {
+            cache_drop_range(fh, offset, length);
+        }
+#endif
+        written = card_write(fh, buffer, offset, length);
+        if (written > 0) {
+            fh->is_dirty = true;  // Mark for deferred flush
+        }
     }
+#if DISK_TELEMETRY
+    stats_count(true, written);
+#endif
+    io_lock_give();
     
-    size_t written = fh->file.write((uint8_t *)buffer, length);
-    if (written > 0) {
-        fh->is_dirty = true;  // Mark for deferred flush
+#if DISK_CACHE_SIZE
+    // Bound what a power loss can take: write back in the background from
+    // half the limit, here and now at the limit
+    int dirty_limit = cache_dirty_limit;
+    if (cache_dirty >= dirty_limit) {
+        Sys_sync();
+    } else if (cache_dirty >= dirty_limit / 2 && flush_task_handle) {
+        task_notify(flush_task_stats);
+        xTaskNotifyGive(flush_task_handle);
     }
+#endif
+#if DISK_TELEMETRY
+    // With the write back a writer waited for at the dirty limit
+    stats_request(fh, true, offset, written, start_us);
+#endif
     return written;
 }
 
+#if USE_ASYNC_DISK
+/*
+ *  Asynchronous transfers
+ *  
+ *  Disk driver Prime() calls with the async trap bit hand their transfer to
+ *  an I/O task on Core 0 and return at once, so the CPU goes on (cursor,
+ *  VBL tasks, progress bars) while the card is busy. The driver stays busy
+ *  until IODone, so there is never more than one transfer. When it is done
+ *  the task raises INTFLAG_DISK and the driver's interrupt routine picks up
+ *  the result with SysIOResult() and completes the request.
+ *  
+ *  The task reads without FlushCodeCache(), the decode cache belongs to the
+ *  CPU core; the driver flushes the buffer when it completes the request.
+ */
+#define IO_TASK_STACK_SIZE 4096
+#define IO_TASK_PRIORITY   2  // Ahead of the video and flush tasks, the Mac is waiting
+#define IO_TASK_CORE       0
+
+struct io_request {
+    file_handle *fh;
+    bool write;
+    void *buffer;
+    loff_t offset;
+    size_t length;
+    size_t actual;
+};
+
+static io_request io_req;
+static bool io_busy = false;    // Transfer started and its result not yet taken (CPU core only)
+static bool io_done = false;    // Set by the task once io_req.actual is valid
+static bool io_queued = false;  // io_req waits for the task
+static TaskHandle_t io_task_handle = NULL;
+static task_stats *const io_task_stats = TaskStats("diskio");
+
+#if USE_PREFETCH
+/*
+ *  Volume header prefetch
+ *  
+ *  While InitAll() goes on with the other drivers and the video on Core 1,
+ *  the I/O task reads the first blocks of every disk image just opened
+ *  into the cache: boot blocks, partition map, HFS master directory block
+ *  and volume bitmap. The extents of the extents and catalog B-trees that
+ *  the MDB lists follow (the MDB of an Apple_HFS partition first, if the
+ *  image has a partition map), up to PREFETCH_BTREES bytes in all. The Mac
+ *  reads them right after the boot blocks, then at random whenever the
+ *  Finder opens a folder or an application is looked up. With
+ *  HFS_PIN_BTREES the same ranges are pinned, so they stay in the cache
+ *  after boot and the blocks past the prefetched part stay once read:
+ *  
+ *    [SYS] Macintosh8.dsk: HFS volume at 0, B-trees 1024 KB pinned
+ *  
+ *  With several images open the ranges are scheduled like an elevator:
+ *  the task takes the range that comes next after the card position it
+ *  last read, ordered by file and block, and wraps around to the first one
+ *  at the end, so every range is reached within one sweep. Ranges of a file
+ *  that touch are merged when they are added, and the missing blocks at the
+ *  front of a range are read in one run of up to PREFETCH_RUN blocks, in
+ *  order. A driver request waiting for the task goes first; one waiting for
+ *  io_lock (a synchronous boot volume read on the CPU core) makes the task
+ *  hold back before each run, for at most PREFETCH_YIELDS runs in a row.
+ */
+#define PREFETCH_HEAD   (64 * 1024)     // From the start of each image
+#if HFS_PIN_BTREES
+#define PREFETCH_BTREES ((loff_t)HFS_PIN_LIMIT * DISK_CACHE_BLOCK)  // At most, of both B-trees
+#else
+#define PREFETCH_BTREES (512 * 1024)
+#endif
+#define PREFETCH_RANGES 12
+#define PREFETCH_RUN    4               // Cache blocks read in one go
+#define PREFETCH_YIELDS 8               // Runs held back in a row for driver requests
+
+struct prefetch_range {
+    file_handle *fh;    // NULL: free
+    uint32 block, end;  // Cache blocks still to read
+    bool head;          // Parse the MDB when done
+};
+
+static prefetch_range prefetch_ranges[PREFETCH_RANGES];    // io_lock held
+
+// Card position of the last read of the I/O task (I/O task only)
+static file_handle *io_head_fh = NULL;
+static uint32 io_head_block = 0;
+static int prefetch_yields = 0;
+
+static perf_counter *const perf_prefetch_runs = PerfCounter("disk.prefetch_runs", PERF_COUNT, PERF_CORE_IO);
+static perf_counter *const perf_prefetch_blocks = PerfCounter("disk.prefetch_blocks", PERF_COUNT, PERF_CORE_IO);
+static perf_counter *const perf_prefetch_yields = PerfCounter("disk.prefetch_yields", PERF_COUNT, PERF_CORE_IO);
+
+static void prefetch_add(file_handle *fh, loff_t offset, loff_t length, bool head)
+{
+    if (offset >= fh->size || length <= 0) {
+        return;
+    }
+    if (length > fh->size - offset) {
+        length = fh->size - offset;
+    }
+    uint32 block = offset / DISK_CACHE_BLOCK;
+    uint32 end = (offset + length + DISK_CACHE_BLOCK - 1) / DISK_CACHE_BLOCK;
+    for (int i = 0; i < PREFETCH_RANGES; i++) {
+        prefetch_range &r = prefetch_ranges[i];
+        if (r.fh == fh && block <= r.end && end >= r.block) {
+            if (block < r.block) r.block = block;
+            if (end > r.end) r.end = end;
+            r.head |= head;
+            return;
+        }
+    }
+    for (int i = 0; i < PREFETCH_RANGES; i++) {
+        prefetch_range &r = prefetch_ranges[i];
+        if (r.fh == NULL) {
+            r.fh = fh;
+            r.block = block;
+            r.end = end;
+            r.head = head;
+            return;
+        }
+    }
+}
+
+// Called by Sys_open() with io_lock held
+static void prefetch_start(file_handle *fh)
+{
+    if (cache_data == NULL || io_task_handle == NULL || fh->is_cdrom || fh->ram_image || fh->flash_image) {
+        return;
+    }
+    prefetch_add(fh, 0, PREFETCH_HEAD, true);
+    task_notify(io_task_stats);
+    xTaskNotifyGive(io_task_handle);
+}
+
+// Called by Sys_close() with io_lock held
+static void prefetch_forget(file_handle *fh)
+{
+    for (int i = 0; i < PREFETCH_RANGES; i++) {
+        if (prefetch_ranges[i].fh == fh) {
+            prefetch_ranges[i].fh = NULL;
+        }
+    }
+}
+
+static inline uint32 be16(const uint8 *p) { return (p[0] << 8) | p[1]; }
+static inline uint32 be32(const uint8 *p) { return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+// Bytes of a file in one complete cached block, NULL if they are not cached
+static const uint8 *cache_peek(file_handle *fh, loff_t offset, uint32 length)
+{
+    int i = cache_find(fh, offset / DISK_CACHE_BLOCK);
+    uint32 in_block = offset % DISK_CACHE_BLOCK;
+    if (i == CACHE_NONE || !cache_blocks[i].complete || in_block + length > cache_blocks[i].length) {
+        return NULL;
+    }
+    return cache_data + i * DISK_CACHE_BLOCK + in_block;
+}
+
+/*
+ *  Start of the HFS volume of an image: 0 for a bare volume, the Apple_HFS
+ *  partition of a partition map (searched like find_hfs_partition() in
+ *  disk.cpp), -1 if the head in the cache shows neither
+ */
+static loff_t hfs_volume_start(file_handle *fh)
+{
+    const uint8 *mdb = cache_peek(fh, 1024, 2);
+    if (mdb && be16(mdb) == 0x4244) {       // 'BD'
+        return 0;
+    }
+    for (int n = 0; n < 64; n++) {
+        const uint8 *map = cache_peek(fh, n * 512, 512);
+        if (map == NULL) {
+            break;
+        }
+        if (be16(map) == 0x504d && memcmp(map + 48, "Apple_HFS", 10) == 0) {     // 'PM'
+            return (loff_t)be32(map + 8) * 512;
+        }
+    }
+    return -1;
+}
+
+#if HFS_PIN_BTREES
+// Keep the blocks of a byte range of a file in the cache from now on
+static void cache_pin_range(file_handle *fh, loff_t offset, loff_t length)
+{
+    if (fh->pin_ranges == HFS_PIN_RANGES) {
+        return;
+    }
+    uint32 block = offset / DISK_CACHE_BLOCK;
+    uint32 end = (offset + length + DISK_CACHE_BLOCK - 1) / DISK_CACHE_BLOCK;
+    fh->pin_block[fh->pin_ranges] = block;
+    fh->pin_end[fh->pin_ranges] = end;
+    fh->pin_ranges++;
+    for (; block < end; block++) {
+        int i = cache_find(fh, block);
+        if (i != CACHE_NONE) {
+            cache_pin(i);
+        }
+    }
+}
+#endif
+
+/*
+ *  Queue (and pin) the extents and catalog B-trees of the image's HFS
+ *  volume, called when a range read for its MDB is done
+ */
+static void prefetch_btrees(file_handle *fh)
+{
+    loff_t volume = hfs_volume_start(fh);
+    if (volume < 0) {
+        return;
+    }
+    const uint8 *mdb = cache_peek(fh, volume + 1024, 0xa2);
+    if (mdb == NULL) {
+        // A partition past the image head: read its MDB first, once
+        if (fh->hfs_probes++ == 0) {
+            prefetch_add(fh, volume + 1024, 512, true);
+        }
+        return;
+    }
+    if (be16(mdb) != 0x4244) {
+        return;
+    }
+    uint32 al_blk_siz = be32(mdb + 0x14);
+    uint32 al_bl_st = be16(mdb + 0x1c);
+    
+    // The extents B-tree first, it is the smaller one
+    static const int ext_rec[] = {0x86, 0x96};  // drXTExtRec, drCTExtRec
+    loff_t budget = PREFETCH_BTREES;
+    for (int n = 0; n < 2; n++) {
+        for (int e = 0; e < 3 && budget > 0; e++) {
+            const uint8 *ext = mdb + ext_rec[n] + e * 4;
+            loff_t start = volume + (loff_t)al_bl_st * 512 + (loff_t)be16(ext) * al_blk_siz;
+            loff_t length = (loff_t)be16(ext + 2) * al_blk_siz;
+            if (length > budget) {
+                length = budget;
+            }
+            if (length == 0) {
+                continue;
+            }
+            prefetch_add(fh, start, length, false);
+#if HFS_PIN_BTREES
+            cache_pin_range(fh, start, length);
+#endif
+            budget -= length;
+        }
+    }
+    const char *name = strrchr(fh->path, '/');
+    Serial.printf("[SYS] %s: HFS volume at %lld, B-trees %u KB %s\n", name ? name + 1 : fh->path,
+                  (long long)volume, (unsigned)((PREFETCH_BTREES - budget) / 1024),
+                  HFS_PIN_BTREES ? "pinned" : "prefetched");
+}
+
+// Elevator order: file, then block
+static inline bool prefetch_before(file_handle *fh1, uint32 block1, file_handle *fh2, uint32 block2)
+{
+    return fh1 != fh2 ? (uintptr_t)fh1 < (uintptr_t)fh2 : block1 < block2;
+}
+
+// The range next after the card position, or the first one (io_lock held)
+static prefetch_range *prefetch_next(void)
+{
+    prefetch_range *ahead = NULL, *first = NULL;
+    for (int i = 0; i < PREFETCH_RANGES; i++) {
+        prefetch_range *r = &prefetch_ranges[i];
+        if (r->fh == NULL) {
+            continue;
+        }
+        if (first == NULL || prefetch_before(r->fh, r->block, first->fh, first->block)) {
+            first = r;
+        }
+        if (!prefetch_before(r->fh, r->block, io_head_fh, io_head_block) &&
+            (ahead == NULL || prefetch_before(r->fh, r->block, ahead->fh, ahead->block))) {
+            ahead = r;
+        }
+    }
+    return ahead ? ahead : first;
+}
+
+/*
+ *  Read the next run of the elevator
+ *  Returns false when there is nothing left
+ */
+static bool prefetch_step(void)
+{
+    // A driver request waiting for io_lock goes first, for a while
+    if (__atomic_load_n(&io_waiting, __ATOMIC_RELAXED) && prefetch_yields < PREFETCH_YIELDS) {
+        prefetch_yields++;
+        perf_inc(perf_prefetch_yields);
+        vTaskDelay(1);
+        return true;
+    }
+    prefetch_yields = 0;
+
+    io_lock_take();
+    prefetch_range *r = prefetch_next();
+    if (r == NULL) {
+        io_lock_give();
+        return false;
+    }
+    while (r->block < r->end && cache_find(r->fh, r->block) != CACHE_NONE) {
+        r->block++;
+    }
+    uint32 n = 0;
+    while (n < PREFETCH_RUN && r->block + n < r->end && cache_find(r->fh, r->block + n) == CACHE_NONE) {
+        n++;
+    }
+    if (n > 0) {
+        if (cache_fill(r->fh, r->block, n) == CACHE_NONE) {
+            r->end = r->block;      // Read error, the driver will see it
+        } else {
+            perf_inc(perf_prefetch_runs);
+            perf_add(perf_prefetch_blocks, n);
+            while (r->block < r->end && cache_find(r->fh, r->block) != CACHE_NONE) {
+                r->block++;
+            }
+        }
+    }
+    io_head_fh = r->fh;
+    io_head_block = r->block;
+    if (r->block >= r->end) {
+        file_handle *fh = r->fh;
+        r->fh = NULL;
+        if (r->head) {
+            prefetch_btrees(fh);
+        }
+    }
+    io_lock_give();
+    return true;
+}
+#endif
+
+static void ioTask(void *param)
+{
+    UNUSED(param);
+    task_run(io_task_stats);
+    for (;;) {
+        task_wait(io_task_stats, 0);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        task_run(io_task_stats);
+        
+#if USE_PREFETCH
+        do {
+#endif
+            if (__atomic_exchange_n(&io_queued, false, __ATOMIC_ACQUIRE)) {
+                io_request &q = io_req;
+                if (q.write) {
+                    q.actual = Sys_write(q.fh, q.buffer, q.offset, q.length);
+                } else {
+                    q.actual = read_data(q.fh, q.buffer, q.offset, q.length);
+                }
+#if USE_PREFETCH
+                io_head_fh = q.fh;
+                io_head_block = (q.offset + q.actual) / DISK_CACHE_BLOCK;
+#endif
+                __atomic_store_n(&io_done, true, __ATOMIC_RELEASE);
+                
+                SetInterruptFlag(INTFLAG_DISK);
+                TriggerInterrupt();
+            }
+#if USE_PREFETCH
+        } while (prefetch_step());
+#endif
+    }
+}
+
+static void io_task_init(void)
+{
+    if (xTaskCreatePinnedToCore(ioTask, "DiskIO", IO_TASK_STACK_SIZE, NULL,
+                                IO_TASK_PRIORITY, &io_task_handle, IO_TASK_CORE) != pdPASS) {
+        Serial.println("[SYS] WARNING: No disk I/O task, asynchronous requests run synchronously");
+        io_task_handle = NULL;
+    }
+}
+
+bool SysStartIO(void *arg, bool write, void *buffer, loff_t offset, size_t length)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (io_task_handle == NULL || io_busy || !fh || !fh->is_open || !buffer || (write && fh->read_only)) {
+        return false;
+    }
+#if FLOPPY_RAM_SIZE
+    // Memory copies, nothing to wait for
+    if (fh->ram_image) {
+        return false;
+    }
+#endif
+#if FLASH_DISK
+    if (fh->flash_image && !write) {
+        return false;
+    }
+#endif
+    
+    io_req.fh = fh;
+    io_req.write = write;
+    io_req.buffer = buffer;
+    io_req.offset = offset;
+    io_req.length = length;
+    io_req.actual = 0;
+    io_done = false;
+    io_busy = true;
+    __atomic_store_n(&io_queued, true, __ATOMIC_RELEASE);
+    task_notify(io_task_stats);
+    xTaskNotifyGive(io_task_handle);
+    return true;
+}
+
+bool SysIOResult(size_t *actual)
+{
+    if (!io_busy || !__atomic_load_n(&io_done, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    *actual = io_req.actual;
+    io_busy = false;
+    return true;
+}
+
+/*
+ *  Wait for the transfer in flight (hibernate, shutdown)
+ *  Returns its byte count, taking the result like SysIOResult()
+ */
+size_t SysWaitIO(void)
+{
+    size_t actual = 0;
+    while (io_busy && !SysIOResult(&actual)) {
+        vTaskDelay(1);
+    }
+    return actual;
+}
+#else
+bool SysStartIO(void *fh, bool write, void *buffer, loff_t offset, size_t length)
+{
+    UNUSED(fh);
+    UNUSED(write);
+    UNUSED(buffer);
+    UNUSED(offset);
+    UNUSED(length);
+    return false;
+}
+
+bool SysIOResult(size_t *actual)
+{
+    UNUSED(actual);
+    return false;
+}
+
+size_t SysWaitIO(void)
+{
+    return 0;
+}
+#endif
+
+#if DISK_TELEMETRY
+static void stats_histogram(const char *name, const telemetry_histogram &h)
+{
+    if (h.samples == 0) return;
+    Serial.printf("[DISK TELEMETRY]   %-8s n=%-7u p50=%-6u p95=%-6u p99=%-6u max=%u\n",
+                  name, h.samples, telemetry_percentile(h, 50),
+                  telemetry_percentile(h, 95), telemetry_percentile(h, 99), h.max);
+}
+
+/*
+ *  Print the counters and latency percentiles of every open image (called
+ *  from Core 1; a request recorded meanwhile may be partly counted)
+ */
+void SysTelemetryDump(void)
+{
+    for (int i = 0; i < 16; i++) {
+        file_handle *fh = open_file_handles[i];
+        if (fh == NULL) continue;
+        const disk_stats &s = fh->stats;
+        uint32 blocks = s.hits + s.misses;
+        Serial.printf("[DISK TELEMETRY] %s: reads=%u (%llu KB) writes=%u (%llu KB) seeks=%u (avg %llu KB) hits=%u/%u\n",
+                      fh->path, s.reads, (unsigned long long)(s.read_bytes / 1024),
+                      s.writes, (unsigned long long)(s.write_bytes / 1024),
+                      s.seeks, (unsigned long long)(s.seeks ? s.seek_bytes / s.seeks / 1024 : 0),
+                      s.hits, blocks);
+        stats_histogram("read_us", s.read_us);
+        stats_histogram("write_us", s.write_us);
+    }
+#if DISK_CACHE_SIZE
+    Serial.printf("[DISK TELEMETRY] cache: %d of %d blocks dirty\n", cache_dirty, CACHE_BLOCKS);
+#endif
+}
+
+/*
+ *  Clear the counters of every open image
+ */
+void SysTelemetryReset(void)
+{
+    io_lock_take();
+    for (int i = 0; i < 16; i++) {
+        file_handle *fh = open_file_handles[i];
+        if (fh != NULL) {
+            memset(&fh->stats, 0, sizeof(fh->stats));
+        }
+    }
+    io_lock_give();
+}
+
+/*
+ *  One line of totals since the last one (next to the IPS report)
+ */
+void SysTelemetryReport(uint32 interval_ms)
+{
+    uint32 reads = perf_delta(perf_reads, stats_last.reads);
+    uint32 writes = perf_delta(perf_writes, stats_last.writes);
+    uint32 read_bytes = perf_delta(perf_read_bytes, stats_last.read_bytes);
+    uint32 write_bytes = perf_delta(perf_write_bytes, stats_last.write_bytes);
+    uint32 hits = perf_delta(perf_hits, stats_last.hits);
+    uint32 misses = perf_delta(perf_misses, stats_last.misses);
+    if (reads + writes > 0 && interval_ms > 0 && ConsoleReports()) {
+        uint32 blocks = hits + misses;
+        Serial.printf("[DISK PERF] reads=%u (%u KB/s) writes=%u (%u KB/s) hit_rate=%u%%\n",
+                      reads, (uint32)((uint64)read_bytes * 1000 / 1024 / interval_ms),
+                      writes, (uint32)((uint64)write_bytes * 1000 / 1024 / interval_ms),
+                      blocks ? hits * 100 / blocks : 0);
+    }
+}
+#else
+void SysTelemetryDump(void)
+{
+}
+
+void SysTelemetryReset(void)
+{
+}
+
+void SysTelemetryReport(uint32 interval_ms)
+{
+    UNUSED(interval_ms);
+}
+#endif
+
 /*
  *  Return size of file/device
  */
@@ -374,11 +2501,33 @@ loff_t SysGetFileSize(void *arg)
 }
 
 /*
- *  Eject disk (no-op)
+ *  Eject disk: the card gets everything written to it first
  */
 void SysEject(void *arg)
 {
-    UNUSED(arg);
+    file_handle *fh = (file_handle *)arg;
+    if (!fh || !fh->is_open) return;
+    if (fh->bincue) {
+        CDStop_bincue(fh->bincue);
+        return;
+    }
+    
+    io_lock_take();
+#if FLOPPY_RAM_SIZE
+    if (fh->ram_image) {
+        ram_image_flush(fh);
+    }
+#endif
+#if DISK_CACHE_SIZE
+    if (cache_data) {
+        cache_flush_range(fh, 0, fh->size);
+    }
+#endif
+    if (fh->is_dirty) {
+        fsync(fh->fd);
+        fh->is_dirty = false;
+    }
+    io_lock_give();
 }
 
 /*
@@ -423,20 +2572,81 @@ bool SysIsDiskInserted(void *arg)
 void SysPreventRemoval(void *arg) { UNUSED(arg); }
 void SysAllowRemoval(void *arg) { UNUSED(arg); }
 
-// CD-ROM stubs
-bool SysCDReadTOC(void *arg, uint8 *toc) { UNUSED(arg); UNUSED(toc); return false; }
-bool SysCDGetPosition(void *arg, uint8 *pos) { UNUSED(arg); UNUSED(pos); return false; }
-bool SysCDPlay(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, uint8 end_m, uint8 end_s, uint8 end_f) {
-    UNUSED(arg); UNUSED(start_m); UNUSED(start_s); UNUSED(start_f);
-    UNUSED(end_m); UNUSED(end_s); UNUSED(end_f); return false;
+/*
+ *  CD audio: BIN/CUE images play their audio tracks (see bincue_esp32.cpp),
+ *  an ISO image is a single data track
+ */
+static inline void *cd_image(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    return (fh && fh->is_open) ? fh->bincue : NULL;
+}
+
+bool SysCDReadTOC(void *arg, uint8 *toc)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (cd_image(arg)) {
+        return readtoc_bincue(fh->bincue, toc);
+    }
+    if (!fh || !fh->is_open || !fh->is_cdrom) {
+        return false;
+    }
+
+    // Track 1 at 00:02:00, lead-out after the image
+    uint32 frames = fh->size / 2048 + 150;
+    static const uint8 track1[8] = {0, 0x14, 1, 0, 0, 0, 2, 0};
+    memcpy(toc + 4, track1, 8);
+    uint8 leadout[8] = {0, 0x14, 0xaa, 0, 0, (uint8)(frames / (60 * 75)), (uint8)((frames / 75) % 60), (uint8)(frames % 75)};
+    memcpy(toc + 12, leadout, 8);
+    toc[0] = 0;
+    toc[1] = 18;
+    toc[2] = 1;
+    toc[3] = 1;
+    return true;
+}
+
+bool SysCDGetPosition(void *arg, uint8 *pos)
+{
+    return cd_image(arg) && GetPosition_bincue(cd_image(arg), pos);
+}
+
+bool SysCDPlay(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, uint8 end_m, uint8 end_s, uint8 end_f)
+{
+    return cd_image(arg) && CDPlay_bincue(cd_image(arg), start_m, start_s, start_f, end_m, end_s, end_f);
+}
+
+bool SysCDPause(void *arg)
+{
+    return cd_image(arg) && CDPause_bincue(cd_image(arg));
+}
+
+bool SysCDResume(void *arg)
+{
+    return cd_image(arg) && CDResume_bincue(cd_image(arg));
+}
+
+bool SysCDStop(void *arg, uint8 lead_out_m, uint8 lead_out_s, uint8 lead_out_f)
+{
+    UNUSED(lead_out_m); UNUSED(lead_out_s); UNUSED(lead_out_f);
+    return cd_image(arg) && CDStop_bincue(cd_image(arg));
+}
+
+bool SysCDScan(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, bool reverse)
+{
+    return cd_image(arg) && CDScan_bincue(cd_image(arg), start_m, start_s, start_f, reverse);
 }
-bool SysCDPause(void *arg) { UNUSED(arg); return false; }
-bool SysCDResume(void *arg) { UNUSED(arg); return false; }
-bool SysCDStop(void *arg, uint8 lead_out_m, uint8 lead_out_s, uint8 lead_out_f) {
-    UNUSED(arg); UNUSED(lead_out_m); UNUSED(lead_out_s); UNUSED(lead_out_f); return false;
+
+void SysCDSetVolume(void *arg, uint8 left, uint8 right)
+{
+    if (cd_image(arg)) {
+        CDSetVol_bincue(cd_image(arg), left, right);
+    }
 }
-bool SysCDScan(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, bool reverse) {
-    UNUSED(arg); UNUSED(start_m); UNUSED(start_s); UNUSED(start_f); UNUSED(reverse); return false;
+
+void SysCDGetVolume(void *arg, uint8 &left, uint8 &right)
+{
+    left = right = 0;
+    if (cd_image(arg)) {
+        CDGetVol_bincue(cd_image(arg), &left, &right);
+    }
 }
-void SysCDSetVolume(void *arg, uint8 left, uint8 right) { UNUSED(arg); UNUSED(left); UNUSED(right); }
-void SysCDGetVolume(void *arg, uint8 &left, uint8 &right) { UNUSED(arg); left = right = 0; }
@@ -44,28 +44,442 @@ using std::vector;
 // No prefetch buffer needed
 #define USE_PREFETCH_BUFFER 0
 
-// ExtFS not supported on ESP32
+// Share the SD card folder named by the "extfs" pref as a Mac volume (see extfs.cpp)
+#ifndef SUPPORTS_EXTFS
+#ifdef HOST_BUILD
 #define SUPPORTS_EXTFS 0
+#else
+#define SUPPORTS_EXTFS 1
+#endif
+#endif
 
-// No UDP tunnel support
+// AppleTalk over UDP between emulators on the WiFi network (lwIP sockets)
+#ifdef HOST_BUILD
 #define SUPPORTS_UDP_TUNNEL 0
+#else
+#define SUPPORTS_UDP_TUNNEL 1
+#define CLOSESOCKET close
+#endif
 
 // Use CPU emulation for periodic tasks (no threads)
 #define USE_CPU_EMUL_SERVICES 1
 
+// Defer N/Z/V/C computation until a flag is read (see m68k.h, gencpu.c)
+#ifndef LAZY_FLAGS
+#define LAZY_FLAGS 1
+#endif
+
+// Let compare/test handlers run a following Bcc, and loop bodies their DBcc (see gencpu.c)
+#ifndef USE_SUPERINSNS
+#define USE_SUPERINSNS 1
+#endif
+
+// Put the handlers marked hot by a frequent.68k profile into IRAM (see gencpu.c)
+#ifndef IRAM_HOT_HANDLERS
+#define IRAM_HOT_HANDLERS 1
+#endif
+
+// Compile the handlers a frequent.68k profile never saw for size, with out of line memory accesses (see cpuop_cold.h)
+#ifndef COMPACT_COLD_HANDLERS
+#define COMPACT_COLD_HANDLERS 1
+#endif
+
+// Raise the handlers' rare exceptions through cold out of line calls, keeping their hot bodies compact (see newcpu.h)
+#ifndef COLD_EXCEPTION_PATHS
+#define COLD_EXCEPTION_PATHS 1
+#endif
+
+// Dispatch through a 16-bit handler index (128KB) instead of a 256KB pointer table
+#ifndef USE_COMPACT_DISPATCH
+#define USE_COMPACT_DISPATCH 1
+#endif
+
+// Copy the handler index gencpu precomputed for each CPU level instead of
+// building it from table68k at boot (see generated/cpudispatch.cpp)
+#ifndef USE_CONST_DISPATCH
+#define USE_CONST_DISPATCH 1
+#endif
+#if USE_CONST_DISPATCH && !USE_COMPACT_DISPATCH
+#error "USE_CONST_DISPATCH requires USE_COMPACT_DISPATCH"
+#endif
+
+// Map 64KB pages to memory banks through a 1-byte index (64KB, internal SRAM)
+// instead of a 256KB pointer table
+#ifndef USE_COMPACT_BANKS
+#define USE_COMPACT_BANKS 1
+#endif
+
+// Frame buffer accesses that miss the RAM/ROM fast paths are done in place
+// instead of through the bank table (see memory.cpp)
+#ifndef USE_FRAME_FASTPATH
+#define USE_FRAME_FASTPATH 1
+#endif
+
+// MOVEM moves its registers through one host pointer when the whole transfer is in RAM (see memory.h, gencpu.c)
+#ifndef MOVEM_FASTPATH
+#define MOVEM_FASTPATH 1
+#endif
+
+// Replace the BlockMove() trap with a native memmove() (see rom_patches.cpp, emul_op.cpp)
+#ifndef USE_NATIVE_BLOCK_MOVE
+#define USE_NATIVE_BLOCK_MOVE 1
+#endif
+
+// Draw common CopyBits()/FillRect()/EraseRect() cases natively (see quickdraw_esp32.cpp)
+#ifndef USE_NATIVE_QUICKDRAW
+#define USE_NATIVE_QUICKDRAW 1
+#endif
+
+// Run FixMul(), FixDiv(), LongMul(), BitAnd() and the other pure Toolbox utilities natively (see fixmath.cpp)
+#ifndef USE_NATIVE_FIXMATH
+#define USE_NATIVE_FIXMATH 1
+#endif
+
+// Answer GetResource()/Get1Resource() natively from a cache of resource map lookups (see rsrc_cache.cpp)
+#ifndef USE_NATIVE_RSRC
+#define USE_NATIVE_RSRC 1
+#endif
+
+// Dispatch Toolbox A-line traps in op_illg() instead of the ROM trap dispatcher (see newcpu.cpp)
+#ifndef NATIVE_TRAP_DISPATCH
+#define NATIVE_TRAP_DISPATCH 1
+#endif
+
+// Run EmulOp handlers on the CPU registers in place, SR made only on request (see newcpu.cpp)
+#ifndef EMULOP_REG_VIEW
+#define EMULOP_REG_VIEW 1
+#endif
+
+// Let the "fastboot" pref replace the ROM's DBRA delay loops with an EmulOp (see rom_patches.cpp)
+#ifndef FAST_BOOT
+#define FAST_BOOT 1
+#endif
+
+// Use hardware mul/mulh/div for MULx.L/DIVx.L instead of the bit loops (see newcpu.cpp)
+#ifndef USE_NATIVE_MULDIV
+#define USE_NATIVE_MULDIV 1
+#endif
+
+// Let each opcode handler tail-call the next one instead of returning to
+// m68k_do_execute; only used where the decode cache is not (see newcpu.h)
+#ifndef USE_THREADED_DISPATCH
+#define USE_THREADED_DISPATCH 0
+#endif
+
+// Leave a nested m68k_execute() at the EXEC_RETURN sentinel without going
+// through m68k_do_specialties() (see newcpu.cpp)
+#ifndef FAST_EXEC_RETURN
+#define FAST_EXEC_RETURN 1
+#endif
+
+// Replay pre-dispatched instruction traces in m68k_do_execute (see newcpu.cpp)
+#ifndef USE_DECODE_CACHE
+#define USE_DECODE_CACHE 1
+#endif
+
+// Translate hot decode cache traces to native RV32 code (see jit_rv32.cpp).
+// Needs executable heap, i.e. CONFIG_ESP_SYSTEM_MEMPROT_FEATURE disabled.
+#ifndef USE_RV32_JIT
+#define USE_RV32_JIT 0
+#endif
+#if USE_RV32_JIT && !USE_DECODE_CACHE
+#error "USE_RV32_JIT requires USE_DECODE_CACHE"
+#endif
+
+// Sample the 68k PC from Core 0 into ROM/RAM/trap histograms (see pc_profiler.cpp)
+#ifndef PC_PROFILER
+#define PC_PROFILER 0
+#endif
+
+// Calls, instructions and time of each A-line trap, printed by the console's 'traps';
+// instrumentation build, runs without the decode cache (see trap_profile.cpp)
+#ifndef TRAP_PROFILE
+#define TRAP_PROFILE 0
+#endif
+
+// Runtime-armed PSRAM ring of executed PCs/registers, flushed to SD (see trace_ring.cpp)
+#ifndef TRACE_RING
+#define TRACE_RING 1
+#endif
+
+// 68k micro-benchmarks run before boot when the "benchmark" pref is set (see cpu_bench.cpp)
+#ifndef CPU_BENCH
+#define CPU_BENCH 1
+#endif
+
+// Random instruction blocks compared between the optimised core and gencpu's plain
+// handlers before boot when the "cpucheck" pref is set (see cpu_check.cpp)
+#ifndef CPU_CHECK
+#define CPU_CHECK 1
+#endif
+
+// Hibernate to a machine state snapshot on SD and resume from it at boot (see savestate.cpp)
+#ifndef SAVE_STATE
+#define SAVE_STATE 1
+#endif
+
+// Let the P4 pixel processing accelerator do the 2x tile scaling (see video_esp32.cpp)
+#ifndef USE_PPA_SCALE
+#define USE_PPA_SCALE 0
+#endif
+
+// Fetch full width band snapshots from PSRAM with the GDMA while the previous band converts (see video_esp32.cpp)
+#ifndef USE_ASYNC_SNAPSHOT
+#define USE_ASYNC_SNAPSHOT 0
+#endif
+
+// Convert dirty bands straight into the MIPI-DSI panel's frame buffer instead of pushing them through M5GFX (see video_esp32.cpp)
+#ifndef USE_DSI_DIRECT
+#define USE_DSI_DIRECT 0
+#endif
+
+// Render from a copy of the frame buffer taken at each VBL, so no frame is pushed half drawn (see video_esp32.cpp)
+#ifndef USE_TEAR_FREE
+#define USE_TEAR_FREE 0
+#endif
+
+// Keep the cursor out of the frame buffer and composite it at push time (see cursor_esp32.cpp)
+#ifndef USE_CURSOR_OVERLAY
+#define USE_CURSOR_OVERLAY 0
+#endif
+
+// Skip pushing dirty tile bands whose pixels hash the same as last time (see video_esp32.cpp)
+#ifndef USE_TILE_HASH
+#define USE_TILE_HASH 1
+#endif
+
+// Apply vertical screen moves (ScrollRect(), CopyBits() within the screen) on the display (see video_esp32.cpp)
+#ifndef USE_DISPLAY_SCROLL
+#define USE_DISPLAY_SCROLL 1
+#endif
+#if USE_TEAR_FREE
+// Scroll moves assume the display follows the live frame buffer
+#undef USE_DISPLAY_SCROLL
+#define USE_DISPLAY_SCROLL 0
+#endif
+
+// Let the idle CPU task convert half of each large band for the video task (see video_esp32.cpp)
+#ifndef USE_RENDER_ASSIST
+#define USE_RENDER_ASSIST 1
+#endif
+
+// Push the dirty rectangles around the mouse pointer before the rest of the frame (see video_esp32.cpp)
+#ifndef USE_POINTER_FIRST
+#define USE_POINTER_FIRST 1
+#endif
+
+// Per-stage video frame time histograms, printed with 'v' on the serial console (see video_esp32.cpp)
+#ifndef VIDEO_TELEMETRY
+#define VIDEO_TELEMETRY 1
+#endif
+
+// Time Manager tasks run from a one-shot esp_timer at their deadline instead of the 60Hz tick (see timer.cpp)
+#ifndef PRECISE_TIMING
+#ifdef HOST_BUILD
+#define PRECISE_TIMING 0
+#else
+#define PRECISE_TIMING 1
+#define PRECISE_TIMING_ESP32 1
+#endif
+#endif
+
+// 60Hz and 1Hz interrupts posted by a periodic esp_timer on Core 0 instead of polled per quantum (see main_esp32.cpp)
+#ifndef HARDWARE_TICK
+#define HARDWARE_TICK 1
+#endif
+
+// Per-image disk request counters and latency histograms, printed with 'd' on the serial console (see sys_esp32.cpp)
+#ifndef DISK_TELEMETRY
+#define DISK_TELEMETRY 1
+#endif
+
+// Input latency histograms (event posted to delivered to the Mac), printed with 'i' on the serial console (see adb.cpp)
+#ifndef INPUT_TELEMETRY
+#define INPUT_TELEMETRY 1
+#endif
+
+// Input recording to SD and replay at the same Mac tick counts, with 'e', 'E' and 'y' on the serial console
+// or the "inputrecord" and "inputreplay" prefs (see adb.cpp)
+#ifndef INPUT_REPLAY
+#define INPUT_REPLAY 1
+#endif
+
+// Memory access counts by kind of memory, size and direction, and the PC's jumps, printed with 'm' on the serial console.
+// Instrumentation build only: every access pays for a counter (see memory.cpp)
+#ifndef MEM_PROFILE
+#define MEM_PROFILE 0
+#endif
+
+// PSRAM block cache of disk image reads, 0 for direct I/O (see sys_esp32.cpp)
+#ifndef DISK_CACHE_SIZE
+#define DISK_CACHE_SIZE (2 * 1024 * 1024)
+#endif
+#ifndef DISK_CACHE_BLOCK
+#define DISK_CACHE_BLOCK (16 * 1024)
+#endif
+// Blocks read at once when a read continues the previous one
+#ifndef DISK_CACHE_READAHEAD
+#define DISK_CACHE_READAHEAD 4
+#endif
+// Dirty blocks at which writers wait for the write back (half wakes the flush task)
+#ifndef DISK_DIRTY_LIMIT
+#define DISK_DIRTY_LIMIT 32
+#endif
+// Largest single write back of adjacent dirty blocks
+#ifndef DISK_FLUSH_RUN
+#define DISK_FLUSH_RUN (64 * 1024)
+#endif
+// Floppy images up to this size are kept in PSRAM while inserted, 0 for none (see sys_esp32.cpp)
+#ifndef FLOPPY_RAM_SIZE
+#define FLOPPY_RAM_SIZE (2 * 1024 * 1024)
+#endif
+// CD-ROM track buffer that reads ahead of sequential reads, 0 for none (see cdrom.cpp)
+#ifndef CDROM_BUFFER_SIZE
+#define CDROM_BUFFER_SIZE (256 * 1024)
+#endif
+// Mount the SD card on the 4-bit SDMMC bus, 0 for SPI only (see sdcard_esp32.cpp)
+#ifndef USE_SDMMC
+#define USE_SDMMC 1
+#endif
+// Open chunked, LZ4 compressed images made by tools/dsk_chunk.py (see sys_esp32.cpp)
+#ifndef USE_CHUNKED_IMAGES
+#define USE_CHUNKED_IMAGES 1
+#endif
+// Run asynchronous disk driver reads and writes on a Core 0 task (see sys_esp32.cpp)
+#ifndef USE_ASYNC_DISK
+#define USE_ASYNC_DISK 1
+#endif
+// Keep the HFS catalog and extents B-trees of the disk images in the block cache, prefetched at open (see sys_esp32.cpp)
+#ifndef HFS_PIN_BTREES
+#define HFS_PIN_BTREES 1
+#endif
+// Open disk images named /usb/... on a USB flash drive or SSD (see usb_msc_esp32.cpp)
+#ifndef USB_MSC_HOST
+#ifdef HOST_BUILD
+#define USB_MSC_HOST 0
+#else
+#define USB_MSC_HOST 1
+#endif
+#endif
+// Stream the screen to tools/remote_view.py over USB (see remote_esp32.cpp)
+#ifndef REMOTE_DISPLAY
+#ifdef HOST_BUILD
+#define REMOTE_DISPLAY 0
+#else
+#define REMOTE_DISPLAY 1
+#endif
+#endif
+// Keep the ROM in the "rom" flash partition and run the patched ROM from a flash mapping (see rom_flash_esp32.cpp)
+#ifndef ROM_FLASH
+#ifdef HOST_BUILD
+#define ROM_FLASH 0
+#else
+#define ROM_FLASH 1
+#endif
+#endif
+// Read the "flashdisk" image from the "sysvol" flash partition, writes to an overlay file on the card (see flash_disk_esp32.cpp)
+#ifndef FLASH_DISK
+#ifdef HOST_BUILD
+#define FLASH_DISK 0
+#else
+#define FLASH_DISK 1
+#endif
+#endif
+// Restart the Mac from the console or a fatal EmulOp without leaving the emulator: ROM, RAM and host tasks stay (see main_esp32.cpp)
+#ifndef WARM_RESTART
+#ifdef HOST_BUILD
+#define WARM_RESTART 0
+#else
+#define WARM_RESTART 1
+#endif
+#endif
+// Clear Mac RAM on Core 0 while the ROM loads and the drivers start, prefetch disk image volume headers (see main_esp32.cpp)
+#ifndef PARALLEL_BOOT
+#ifdef HOST_BUILD
+#define PARALLEL_BOOT 0
+#else
+#define PARALLEL_BOOT 1
+#endif
+#endif
+// Line command console on USB serial, serviced on Core 0: counters, tunables, debug commands (see console_esp32.cpp)
+#ifndef SERIAL_CONSOLE
+#ifdef HOST_BUILD
+#define SERIAL_CONSOLE 0
+#else
+#define SERIAL_CONSOLE 1
+#endif
+#endif
+// Console tunables set per Mac application from "[app:Name]" profile sections, switched live (see app_profile_esp32.cpp)
+#ifndef APP_PROFILES
+#define APP_PROFILES SERIAL_CONSOLE
+#endif
+// On-screen performance HUD composited over the bottom left of the panel, shown on demand (see hud_esp32.cpp)
+#ifndef PERF_HUD
+#ifdef HOST_BUILD
+#define PERF_HUD 0
+#else
+#define PERF_HUD 1
+#endif
+#endif
+// Busy time, run slices and late wakeups of the Core 0 tasks, in the counter registry (see task_stats_esp32.cpp)
+#ifndef TASK_STATS
+#ifdef HOST_BUILD
+#define TASK_STATS 0
+#else
+#define TASK_STATS 1
+#endif
+#endif
+// Place the hot CPU tables into internal SRAM from one plan made at boot, by benefit per byte (see sram_plan_esp32.cpp)
+#ifndef SRAM_PLAN
+#ifdef HOST_BUILD
+#define SRAM_PLAN 0
+#else
+#define SRAM_PLAN 1
+#endif
+#endif
+// Measure SRAM and PSRAM latency and bandwidth at boot and weigh the SRAM plan's slots with them (see sram_plan_esp32.cpp)
+#ifndef SRAM_CALIBRATE
+#define SRAM_CALIBRATE SRAM_PLAN
+#endif
+// Mac frame buffer of the 1/2/4-bit modes in internal SRAM when the plan leaves room (see video_esp32.cpp)
+#ifndef FRAME_SRAM
+#define FRAME_SRAM SRAM_PLAN
+#endif
+// Lower the CPU clock while the Mac is idle, raise it on input or work (see power_esp32.cpp)
+#ifndef POWER_MANAGER
+#ifdef HOST_BUILD
+#define POWER_MANAGER 0
+#else
+#define POWER_MANAGER 1
+#endif
+#endif
+// Keep XPRAM in NVS, committed by the service task when it settles (see xpram_esp32.cpp)
+#ifndef XPRAM_NVS
+#ifdef HOST_BUILD
+#define XPRAM_NVS 0
+#else
+#define XPRAM_NVS 1
+#endif
+#endif
+
 /*
  * ESP32-P4 is little-endian RISC-V
  */
 #undef WORDS_BIGENDIAN
 
 /*
- * Data type sizes for ESP32-P4
+ * Data type sizes for ESP32-P4 (the host build keeps the host's pointer size)
  */
 #define SIZEOF_SHORT 2
 #define SIZEOF_INT 4
+#ifdef HOST_BUILD
+#define SIZEOF_LONG __SIZEOF_LONG__
+#define SIZEOF_VOID_P __SIZEOF_POINTER__
+#else
 #define SIZEOF_LONG 4
-#define SIZEOF_LONG_LONG 8
 #define SIZEOF_VOID_P 4
+#endif
+#define SIZEOF_LONG_LONG 8
 #define SIZEOF_FLOAT 4
 #define SIZEOF_DOUBLE 8
 
@@ -80,8 +494,13 @@ typedef uint32_t uint32;
 typedef int32_t int32;
 typedef uint64_t uint64;
 typedef int64_t int64;
+#ifdef HOST_BUILD
+typedef uintptr_t uintptr;
+typedef intptr_t intptr;
+#else
 typedef uint32_t uintptr;
 typedef int32_t intptr;
+#endif
 
 // File offset type
 typedef int32_t loff_t;
@@ -0,0 +1,69 @@
+/*
+ *  task_stats_esp32.cpp - Run slices and late wakeups of the Core 0 tasks
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The video, input, audio, disk and console tasks share Core 0, and the
+ *  Arduino core's FreeRTOS is not built with run time statistics. Each of
+ *  these tasks marks instead where it blocks (task_wait()) and where it
+ *  runs again (task_run()), which gives per task:
+ *
+ *    busy_us    time from waking up to blocking again; a higher priority
+ *               task or an interrupt that preempts it counts as its own
+ *    slice_us   histogram of the single run slices, p99 and max show the
+ *               ones that hold up the other tasks
+ *    stalls     wakeups more than TASK_STALL_US after the wait timed out or
+ *               the task was notified: it was ready but Core 0 was busy
+ *
+ *  The console's "tasks" command prints them as busy %, and "stats task."
+ *  shows the raw counters.
+ */
+
+#include "sysdeps.h"
+#include "task_stats.h"
+
+#include <stdio.h>
+
+#if TASK_STATS
+
+#define TASK_STATS_MAX      8
+#define TASK_NAME_MAX       32
+
+// Zero-initialized, usable before any constructor has run
+static task_stats tasks[TASK_STATS_MAX];
+static char names[TASK_STATS_MAX][3][TASK_NAME_MAX];
+static int num_tasks;
+
+// Shared by the tasks that find the table full, not listed
+static perf_counter scratch_counter;
+static perf_histogram scratch_histogram;
+static task_stats scratch_task = {"scratch", &scratch_counter, &scratch_counter, &scratch_histogram, 0, 0, 0};
+
+task_stats *TaskStats(const char *name)
+{
+    if (num_tasks == TASK_STATS_MAX)
+        return &scratch_task;
+    task_stats *t = &tasks[num_tasks];
+    char (*n)[TASK_NAME_MAX] = names[num_tasks];
+    snprintf(n[0], TASK_NAME_MAX, "task.%s.busy_us", name);
+    snprintf(n[1], TASK_NAME_MAX, "task.%s.stalls", name);
+    snprintf(n[2], TASK_NAME_MAX, "task.%s.slice_us", name);
+    t->name = name;
+    t->busy_us = PerfCounter(n[0], PERF_COUNT, PERF_CORE_IO);
+    t->stalls = PerfCounter(n[1], PERF_COUNT, PERF_CORE_IO);
+    t->slice_us = PerfHistogram(n[2], PERF_CORE_IO);
+    num_tasks++;
+    return t;
+}
+
+int TaskStatsCount(void)
+{
+    return num_tasks;
+}
+
+task_stats *TaskStatsAt(int i)
+{
+    return &tasks[i];
+}
+
+#endif
@@ -23,6 +23,7 @@
 #include "macos_util.h"
 #include "main.h"
 #include "cpu_emulation.h"
+#include "savestate.h"
 
 #ifdef PRECISE_TIMING_POSIX
 #include <pthread.h>
@@ -34,6 +35,11 @@
 #include <mach/mach.h>
 #endif
 
+#ifdef PRECISE_TIMING_ESP32
+#include <vector>
+#include <esp_timer.h>
+#endif
+
 #define DEBUG 0
 #include "debug.h"
 
@@ -55,6 +61,9 @@ struct TMDesc {
 	uint32 task;		// Mac address of associated TMTask
 	tm_time_t wakeup;	// Time this task is scheduled for execution
 	TMDesc *next;
+#ifdef PRECISE_TIMING_ESP32
+	int heap_index;		// Position in wakeup_heap, -1 = not active
+#endif
 };
 
 static TMDesc *tmDescList;
@@ -86,11 +95,124 @@ static tm_time_t wakeup_time = wakeup_time_max;
 static semaphore_t wakeup_time_sem;
 static void *timer_func(void *arg);
 #endif
+#ifdef PRECISE_TIMING_ESP32
+// Active tasks in a min-heap on the wakeup time, and one esp_timer armed for
+// the earliest. Only the CPU task touches them; the timer callback just
+// raises INTFLAG_TIMER, so no lock is needed.
+static esp_timer_handle_t wakeup_timer = NULL;
+static bool timer_thread_active = false;	// wakeup_timer created
+static std::vector<TMDesc *> wakeup_heap;
+static tm_time_t armed_wakeup = 0;			// Wakeup time wakeup_timer is armed for, 0 = none
+static void timer_func(void *arg);
+#endif
+#endif
+
+
+#ifdef PRECISE_TIMING_ESP32
+/*
+ *  Wakeup heap operations
+ */
+
+static inline void heap_set(int i, TMDesc *desc)
+{
+	wakeup_heap[i] = desc;
+	desc->heap_index = i;
+}
+
+static void heap_up(int i)
+{
+	TMDesc *desc = wakeup_heap[i];
+	while (i > 0) {
+		int parent = (i - 1) / 2;
+		if (timer_cmp_time(wakeup_heap[parent]->wakeup, desc->wakeup) <= 0)
+			break;
+		heap_set(i, wakeup_heap[parent]);
+		i = parent;
+	}
+	heap_set(i, desc);
+}
+
+static void heap_down(int i)
+{
+	int n = wakeup_heap.size();
+	TMDesc *desc = wakeup_heap[i];
+	for (;;) {
+		int child = 2 * i + 1;
+		if (child >= n)
+			break;
+		if (child + 1 < n && timer_cmp_time(wakeup_heap[child + 1]->wakeup, wakeup_heap[child]->wakeup) < 0)
+			child++;
+		if (timer_cmp_time(desc->wakeup, wakeup_heap[child]->wakeup) <= 0)
+			break;
+		heap_set(i, wakeup_heap[child]);
+		i = child;
+	}
+	heap_set(i, desc);
+}
+
+static void heap_insert(TMDesc *desc)
+{
+	wakeup_heap.push_back(desc);
+	heap_up(wakeup_heap.size() - 1);
+}
+
+static void heap_remove(TMDesc *desc)
+{
+	int i = desc->heap_index;
+	if (i < 0)
+		return;
+	desc->heap_index = -1;
+	TMDesc *last = wakeup_heap.back();
+	wakeup_heap.pop_back();
+	if (last != desc) {
+		heap_set(i, last);
+		heap_up(i);
+		heap_down(last->heap_index);
+	}
+}
+
+/*
+ *  Arm wakeup_timer for the earliest active task, or raise the interrupt
+ *  now if that one is already due
+ */
+
+static void arm_wakeup_timer(void)
+{
+	if (!timer_thread_active)
+		return;
+	if (wakeup_heap.empty()) {
+		if (armed_wakeup) {
+			esp_timer_stop(wakeup_timer);
+			armed_wakeup = 0;
+		}
+		return;
+	}
+
+	tm_time_t wakeup = wakeup_heap[0]->wakeup;
+	if (wakeup == armed_wakeup)
+		return;
+	if (armed_wakeup)
+		esp_timer_stop(wakeup_timer);
+
+	tm_time_t now;
+	timer_current_time(now);
+	if (timer_cmp_time(wakeup, now) <= 0) {
+		armed_wakeup = 0;
+		SetInterruptFlag(INTFLAG_TIMER);
+		TriggerInterrupt();
+	} else {
+		esp_timer_start_once(wakeup_timer, wakeup - now);
+		armed_wakeup = wakeup;
+	}
+}
 #endif
 
 
 inline static void free_desc(TMDesc *desc)
 {
+#ifdef PRECISE_TIMING_ESP32
+	heap_remove(desc);
+#endif
 	if (desc == tmDescList) {
 		tmDescList = desc->next;
 	} else {
@@ -282,6 +404,14 @@ void TimerInit(void)
 #ifdef PRECISE_TIMING_POSIX
 	timer_thread_active = timer_thread_init();
 #endif
+#ifdef PRECISE_TIMING_ESP32
+	esp_timer_create_args_t args = {};
+	args.callback = timer_func;
+	args.name = "Time Manager";
+	timer_thread_active = (esp_timer_create(&args, &wakeup_timer) == ESP_OK);
+	if (!timer_thread_active)
+		printf("FATAL: Cannot create Time Manager timer\n");
+#endif
 #endif
 }
 
@@ -309,6 +439,13 @@ void TimerExit(void)
 #endif
 #ifdef PRECISE_TIMING_POSIX
 		timer_thread_kill();
+#endif
+#ifdef PRECISE_TIMING_ESP32
+		esp_timer_stop(wakeup_timer);
+		esp_timer_delete(wakeup_timer);
+		wakeup_timer = NULL;
+		armed_wakeup = 0;
+		timer_thread_active = false;
 #endif
 	}
 #endif
@@ -328,9 +465,62 @@ void TimerReset(void)
 		desc = next;
 	}
 	tmDescList = NULL;
+#ifdef PRECISE_TIMING_ESP32
+	wakeup_heap.clear();
+	arm_wakeup_timer();
+#endif
 }
 
 
+#if SAVE_STATE
+/*
+ *  Installed timer tasks for hibernate/resume. Wakeup times are saved
+ *  relative to the current time, which starts again from zero on resume.
+ */
+
+void TimerStateIO(savestate *s)
+{
+	tm_time_t now;
+	timer_current_time(now);
+
+	uint32 count = 0;
+	for (TMDesc *d = tmDescList; d; d = d->next)
+		count++;
+	savestate_var(s, count);
+
+	if (savestate_loading(s)) {
+		TimerReset();
+		TMDesc **tail = &tmDescList;
+		for (uint32 i = 0; i < count; i++) {
+			TMDesc *desc = new TMDesc;
+			tm_time_t remaining = 0;
+			savestate_var(s, desc->task);
+			savestate_var(s, remaining);
+			timer_add_time(desc->wakeup, now, remaining);
+			desc->next = NULL;
+#ifdef PRECISE_TIMING_ESP32
+			desc->heap_index = -1;
+			if (ReadMacInt16(desc->task + qType) & 0x8000)
+				heap_insert(desc);
+#endif
+			*tail = desc;
+			tail = &desc->next;
+		}
+#ifdef PRECISE_TIMING_ESP32
+		arm_wakeup_timer();
+#endif
+	} else {
+		for (TMDesc *d = tmDescList; d; d = d->next) {
+			tm_time_t remaining = 0;
+			timer_sub_time(remaining, d->wakeup, now);
+			savestate_var(s, d->task);
+			savestate_var(s, remaining);
+		}
+	}
+}
+#endif
+
+
 /*
  *  Insert timer task
  */
@@ -345,6 +535,9 @@ int16 InsTime(uint32 tm, uint16 trap)
 		TMDesc *desc = new TMDesc;
 		desc->task = tm;
 		desc->next = tmDescList;
+#ifdef PRECISE_TIMING_ESP32
+		desc->heap_index = -1;
+#endif
 		tmDescList = desc;
 	}
 	return 0;
@@ -384,7 +577,10 @@ int16 RmvTime(uint32 tm)
 		// Yes, make task inactive and remove it from the Time Manager queue
 		WriteMacInt16(tm + qType, ReadMacInt16(tm + qType) & 0x7fff);
 		dequeue_tm(tm);
-#if PRECISE_TIMING
+#ifdef PRECISE_TIMING_ESP32
+		heap_remove(desc);
+		arm_wakeup_timer();
+#elif PRECISE_TIMING
 		// Look for next task to be called and set wakeup_time
 		wakeup_time = wakeup_time_max;
 		for (TMDesc *d = tmDescList; d; d = d->next)
@@ -498,7 +694,11 @@ int16 PrimeTime(uint32 tm, int32 time)
 #endif
 	WriteMacInt16(tm + qType, ReadMacInt16(tm + qType) | 0x8000);
 	enqueue_tm(tm);
-#if PRECISE_TIMING
+#ifdef PRECISE_TIMING_ESP32
+	heap_remove(desc);
+	heap_insert(desc);
+	arm_wakeup_timer();
+#elif PRECISE_TIMING
 	// Look for next task to be called and set wakeup_time
 	wakeup_time = wakeup_time_max;
 	for (TMDesc *d = tmDescList; d; d = d->next)
@@ -578,6 +778,15 @@ static void *timer_func(void *arg)
 }
 #endif
 
+#ifdef PRECISE_TIMING_ESP32
+// esp_timer callback (esp_timer task on Core 0)
+static void timer_func(void *arg)
+{
+	SetInterruptFlag(INTFLAG_TIMER);
+	TriggerInterrupt();
+}
+#endif
+
 #ifdef PRECISE_TIMING_POSIX
 static void *timer_func(void *arg)
 {
@@ -611,6 +820,37 @@ void TimerInterrupt(void)
 	// Look for active TMTasks that have expired
 	tm_time_t now;
 	timer_current_time(now);
+#ifdef PRECISE_TIMING_ESP32
+	// Take all expired tasks off the heap first: tasks that prime themselves
+	// again run in the next interrupt, as with the list scan
+	static std::vector<uint32> expired;
+	expired.clear();
+	while (!wakeup_heap.empty() && timer_cmp_time(wakeup_heap[0]->wakeup, now) <= 0) {
+		TMDesc *desc = wakeup_heap[0];
+		heap_remove(desc);
+		uint32 tm = desc->task;
+		WriteMacInt16(tm + qType, ReadMacInt16(tm + qType) & 0x7fff);
+		dequeue_tm(tm);
+		expired.push_back(tm);
+	}
+	for (size_t i = 0; i < expired.size(); i++) {
+		uint32 tm = expired[i];
+
+		// Removed by an earlier task?
+		if (find_desc(tm) == NULL)
+			continue;
+		uint32 addr = ReadMacInt32(tm + tmAddr);
+		if (addr) {
+			D(bug("Calling TimeTask %08lx, addr %08lx\n", tm, addr));
+			M68kRegisters r;
+			r.a[0] = addr;
+			r.a[1] = tm;
+			Execute68k(r.a[0], &r);
+			D(bug(" returned from TimeTask\n"));
+		}
+	}
+	arm_wakeup_timer();
+#else
 	TMDesc *desc = tmDescList;
 	while (desc) {
 		TMDesc *next = desc->next;
@@ -634,8 +874,9 @@ void TimerInterrupt(void)
 		}
 		desc = next;
 	}
+#endif
 
-#if PRECISE_TIMING
+#if PRECISE_TIMING && !defined(PRECISE_TIMING_ESP32)
 	// Look for next task to be called and set wakeup_time
 #if PRECISE_TIMING_BEOS
 	while (acquire_sem(wakeup_time_sem) == B_INTERRUPTED) ;
@@ -5,17 +5,24 @@
  */
 
 #include "sysdeps.h"
+#include "main.h"
 #include "timer.h"
+#include "power.h"
+#include "video.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <esp_timer.h>
 
 #define DEBUG 0
 #include "debug.h"
 
 /*
- *  Return microseconds since boot
+ *  Return microseconds since boot (64-bit: micros() wraps after 71 minutes)
  */
 uint64 GetTicks_usec(void)
 {
-    return (uint64)micros();
+    return (uint64)esp_timer_get_time();
 }
 
 /*
@@ -35,19 +42,64 @@ void Delay_usec(uint64 usec)
 
 /*
  *  Suspend emulator thread, wait for wakeup
- *  (Not used in single-threaded ESP32 implementation)
+ *
+ *  Called when the 68k has nothing to do (SynchIdleTime() patch with no
+ *  events pending, or STOP with no interrupt). Rather than spinning through
+ *  the idle loop the CPU task blocks until idle_resume() is called by an
+ *  interrupt source or the next 60Hz tick is due, so the core can drop into
+ *  light sleep. SetInterruptFlag() calls idle_resume() too, so input raised
+ *  on Core 0 wakes the emulator at once. The video task wakes it as well
+ *  when it posts half a band to convert (USE_RENDER_ASSIST); the CPU task
+ *  converts it and goes back to sleep for the rest of the timeout.
  */
+#define IDLE_MIN_SLEEP_US   1000        // Below one FreeRTOS tick, do not block
+
+extern uint32 basilisk_idle_timeout_us(void);
+extern void basilisk_idle_done(uint32 slept_us);
+
+static TaskHandle_t idle_task = NULL;
+static volatile bool idle_sleeping = false;
+
 void idle_wait(void)
 {
-    // In single-threaded mode, just yield briefly
-    yield();
+    uint32 timeout_us = basilisk_idle_timeout_us();
+    if (timeout_us < IDLE_MIN_SLEEP_US) {
+        // Tick (nearly) due: just end the quantum so it gets handled
+        basilisk_idle_done(0);
+        return;
+    }
+    
+    idle_task = xTaskGetCurrentTaskHandle();
+    __atomic_store_n(&idle_sleeping, true, __ATOMIC_SEQ_CST);
+    
+    // An interrupt raised before idle_sleeping was visible sent no notification
+    uint32 slept_us = 0;
+    if (InterruptFlags == 0) {
+        uint32 t0 = micros();
+#if USE_RENDER_ASSIST
+        uint32 waited = 0;
+        while (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS((timeout_us - waited) / 1000)) &&
+               VideoAssist() && InterruptFlags == 0) {
+            waited = micros() - t0;
+            if (waited >= timeout_us)
+                break;
+        }
+#else
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_us / 1000));
+#endif
+        slept_us = micros() - t0;
+    }
+    
+    __atomic_store_n(&idle_sleeping, false, __ATOMIC_SEQ_CST);
+    PowerIdle(slept_us);
+    basilisk_idle_done(slept_us);
 }
 
 /*
- *  Resume execution of emulator thread
- *  (Not used in single-threaded ESP32 implementation)
+ *  Resume execution of emulator thread (any core)
  */
 void idle_resume(void)
 {
-    // No-op in single-threaded mode
+    if (__atomic_load_n(&idle_sleeping, __ATOMIC_SEQ_CST) && idle_task)
+        xTaskNotifyGive(idle_task);
 }
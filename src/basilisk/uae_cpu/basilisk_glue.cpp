@@ -19,6 +19,7 @@
  */
 
 #include "sysdeps.h"
+#include <string.h>
 
 #ifdef ARDUINO
 #include <esp_heap_caps.h>
@@ -35,6 +36,9 @@
 #include "readcpu.h"
 #include "newcpu.h"
 #include "compiler/compemu.h"
+#include "fpu/fpu.h"
+#include "sram_plan.h"
+#include "console.h"
 
 
 // RAM and ROM pointers
@@ -49,6 +53,7 @@ uint32 ROMSize;				// Size of ROM
 // Mac frame buffer
 uint8 *MacFrameBaseHost;	// Frame buffer base (host address space)
 uint32 MacFrameSize;		// Size of frame buffer
+uint32 MacFrameMaxSize;		// Size of frame buffer in the largest mode
 int MacFrameLayout;			// Frame buffer layout
 #endif
 
@@ -63,6 +68,13 @@ bool UseJIT = false;
 // From newcpu.cpp
 extern bool quit_program;
 
+// Opcode dispatch, once per instruction outside decode cache replays
+#if defined(ARDUINO) && USE_COMPACT_DISPATCH
+static sram_slot *const cpufuncidx_sram = SramSlot("cpufuncidx", 65536 * sizeof(uae_u16), 40, 0);
+#elif defined(ARDUINO)
+static sram_slot *const cpufunctbl_sram = SramSlot("cpufunctbl", 65536 * sizeof(cpuop_func *), 40, 0);
+#endif
+
 
 /*
  *  Initialize 680x0 emulation, CheckROM() must have been called first
@@ -70,31 +82,24 @@ extern bool quit_program;
 
 bool Init680x0(void)
 {
-#ifdef ARDUINO
-	// Allocate 256KB opcode table
-	// This table is accessed once per instruction for opcode dispatch
-	// NOTE: mem_banks gets priority for internal SRAM since it's accessed more frequently
-	// (multiple memory operations per instruction)
+#if defined(ARDUINO) && USE_COMPACT_DISPATCH
+	// Allocate the 128KB handler index where the SRAM plan put it (see
+	// build_cpufunctbl in newcpu.cpp); the full 256KB table is only built
+	// temporarily in PSRAM
+	if (cpufuncidx == NULL) {
+		cpufuncidx = (uae_u16 *)SramAlloc(cpufuncidx_sram, 65536 * sizeof(uae_u16));
+		if (cpufuncidx == NULL) {
+			write_log("ERROR: Failed to allocate cpufuncidx!\n");
+			return false;
+		}
+	}
+#elif defined(ARDUINO)
+	// Allocate the 256KB opcode table where the SRAM plan put it
 	if (cpufunctbl == NULL) {
-		// Report available internal SRAM before allocation
-		size_t free_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
-		size_t largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
-		write_log("cpufunctbl allocation: need 256KB, internal SRAM has %d bytes free (largest: %d)\n",
-		          free_before, largest_block);
-		
-		// Try internal SRAM first - cpufunctbl is accessed once per instruction for dispatch
-		// This is the hot path for CPU emulation
-		cpufunctbl = (cpuop_func **)heap_caps_malloc(65536 * sizeof(cpuop_func *), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-		if (cpufunctbl != NULL) {
-			write_log("Allocated cpufunctbl (256KB) in internal SRAM - FAST DISPATCH\n");
-		} else {
-			// Fall back to PSRAM if internal SRAM not available
-			cpufunctbl = (cpuop_func **)heap_caps_malloc(65536 * sizeof(cpuop_func *), MALLOC_CAP_SPIRAM);
-			if (cpufunctbl == NULL) {
-				write_log("ERROR: Failed to allocate cpufunctbl!\n");
-				return false;
-			}
-			write_log("Allocated cpufunctbl (256KB) in PSRAM (fallback)\n");
+		cpufunctbl = (cpuop_func **)SramAlloc(cpufunctbl_sram, 65536 * sizeof(cpuop_func *));
+		if (cpufunctbl == NULL) {
+			write_log("ERROR: Failed to allocate cpufunctbl!\n");
+			return false;
 		}
 	}
 #endif
@@ -130,6 +135,8 @@ bool Init680x0(void)
 #endif
 
 	init_m68k();
+	fpu_set_fast_mode(PrefsFindBool("fpufast"));
+	ConsoleAddTunable("fpufast", (volatile uint32 *)&fpu.fast_mode, 0, 1);
 #if USE_JIT
 	UseJIT = compiler_use_jit();
 	if (UseJIT)
@@ -180,14 +187,31 @@ void Start680x0(void)
 }
 
 
+/*
+ *  Continue 680x0 emulation from the registers restored by SaveStateRestore()
+ */
+
+void Resume680x0(void)
+{
+#if USE_JIT
+    if (UseJIT)
+	m68k_compile_execute();
+    else
+#endif
+	m68k_execute();
+}
+
+
 /*
  *  Trigger interrupt
  */
 
 void TriggerInterrupt(void)
 {
+	// May be called from any task or core: regs.spcflags belongs to the CPU
+	// task, which notices the InterruptFlags set by the caller at its next
+	// batch boundary (or in the STOP loop), so only wake it up here
 	idle_resume();
-	SPCFLAGS_SET( SPCFLAG_INT );
 }
 
 void TriggerNMI(void)
@@ -202,8 +226,66 @@ void TriggerNMI(void)
 
 int intlev(void)
 {
-	return InterruptFlags ? 1 : 0;
+	return __atomic_load_n(&InterruptFlags, __ATOMIC_ACQUIRE) ? 1 : 0;
+}
+
+
+/*
+ *  Address of the running EMUL_OP (the PC moves past it on return)
+ */
+
+uint32 EmulOpAddress(void)
+{
+	return m68k_getpc();
+}
+
+
+/*
+ *  Registers in and out of the nested execution: only those in the masks
+ *  (M68K_REG_D()/M68K_REG_A() bits) are copied, the others keep the values
+ *  of the running EmulOp in the CPU and in *r
+ */
+
+static inline void set_regs(const struct M68kRegisters *r, uint32 mask)
+{
+	for (int i=0; i<8; i++)
+		if (mask & M68K_REG_D(i))
+			m68k_dreg(regs, i) = r->d[i];
+	for (int i=0; i<7; i++)
+		if (mask & M68K_REG_A(i))
+			m68k_areg(regs, i) = r->a[i];
+}
+
+#if EMULOP_REG_VIEW
+/*
+ *  The running EmulOp's registers are the CPU's (see m68k_emulop()): d0-d7
+ *  and a0-a6 are put back after the nested execution, and the registers in
+ *  the out mask are then copied, so *r may be the EmulOp's own registers
+ */
+
+static inline void get_regs(struct M68kRegisters *r, uint32 mask, const uae_u32 *saved)
+{
+	uae_u32 result[15];
+	memcpy(result, regs.regs, sizeof(result));
+	memcpy(regs.regs, saved, sizeof(result));
+	for (int i=0; i<8; i++)
+		if (mask & M68K_REG_D(i))
+			r->d[i] = result[i];
+	for (int i=0; i<7; i++)
+		if (mask & M68K_REG_A(i))
+			r->a[i] = result[8 + i];
+}
+#else
+static inline void get_regs(struct M68kRegisters *r, uint32 mask)
+{
+	for (int i=0; i<8; i++)
+		if (mask & M68K_REG_D(i))
+			r->d[i] = m68k_dreg(regs, i);
+	for (int i=0; i<7; i++)
+		if (mask & M68K_REG_A(i))
+			r->a[i] = m68k_areg(regs, i);
 }
+#endif
 
 
 /*
@@ -211,18 +293,17 @@ int intlev(void)
  *  r->a[7] and r->sr are unused!
  */
 
-void Execute68kTrap(uint16 trap, struct M68kRegisters *r)
+void Execute68kTrapRegs(uint16 trap, struct M68kRegisters *r, uint32 in, uint32 out)
 {
-	int i;
-
 	// Save old PC
 	uaecptr oldpc = m68k_getpc();
+#if EMULOP_REG_VIEW
+	uae_u32 saved[15];
+	memcpy(saved, regs.regs, sizeof(saved));
+#endif
 
 	// Set registers
-	for (i=0; i<8; i++)
-		m68k_dreg(regs, i) = r->d[i];
-	for (i=0; i<7; i++)
-		m68k_areg(regs, i) = r->a[i];
+	set_regs(r, in);
 
 	// Push trap and EXEC_RETURN on stack
 	m68k_areg(regs, 7) -= 2;
@@ -244,13 +325,19 @@ void Execute68kTrap(uint16 trap, struct M68kRegisters *r)
 	fill_prefetch_0();
 
 	// Get registers
-	for (i=0; i<8; i++)
-		r->d[i] = m68k_dreg(regs, i);
-	for (i=0; i<7; i++)
-		r->a[i] = m68k_areg(regs, i);
+#if EMULOP_REG_VIEW
+	get_regs(r, out, saved);
+#else
+	get_regs(r, out);
+#endif
 	quit_program = false;
 }
 
+void Execute68kTrap(uint16 trap, struct M68kRegisters *r)
+{
+	Execute68kTrapRegs(trap, r, M68K_REGS_ALL, M68K_REGS_ALL);
+}
+
 
 /*
  *  Execute 68k subroutine
@@ -258,18 +345,17 @@ void Execute68kTrap(uint16 trap, struct M68kRegisters *r)
  *  r->a[7] and r->sr are unused!
  */
 
-void Execute68k(uint32 addr, struct M68kRegisters *r)
+void Execute68kRegs(uint32 addr, struct M68kRegisters *r, uint32 in, uint32 out)
 {
-	int i;
-
 	// Save old PC
 	uaecptr oldpc = m68k_getpc();
+#if EMULOP_REG_VIEW
+	uae_u32 saved[15];
+	memcpy(saved, regs.regs, sizeof(saved));
+#endif
 
 	// Set registers
-	for (i=0; i<8; i++)
-		m68k_dreg(regs, i) = r->d[i];
-	for (i=0; i<7; i++)
-		m68k_areg(regs, i) = r->a[i];
+	set_regs(r, in);
 
 	// Push EXEC_RETURN and faked return address (points to EXEC_RETURN) on stack
 	m68k_areg(regs, 7) -= 2;
@@ -291,9 +377,15 @@ void Execute68k(uint32 addr, struct M68kRegisters *r)
 	fill_prefetch_0();
 
 	// Get registers
-	for (i=0; i<8; i++)
-		r->d[i] = m68k_dreg(regs, i);
-	for (i=0; i<7; i++)
-		r->a[i] = m68k_areg(regs, i);
+#if EMULOP_REG_VIEW
+	get_regs(r, out, saved);
+#else
+	get_regs(r, out);
+#endif
 	quit_program = false;
 }
+
+void Execute68k(uint32 addr, struct M68kRegisters *r)
+{
+	Execute68kRegs(addr, r, M68K_REGS_ALL, M68K_REGS_ALL);
+}
@@ -0,0 +1,329 @@
+/*
+ *  cpu_bench.cpp - Deterministic 68k CPU micro-benchmarks
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Small 68k kernels are assembled into scratch Mac RAM and run through
+ *  Execute68k() before Mac OS boots, with interrupts masked, the 60Hz tick
+ *  held off and the video task paused, so only the interpreter is measured.
+ *  Each kernel runs BENCH_RUNS times and the fastest run is reported as one
+ *  machine-readable line:
+ *
+ *    [BENCH] name=alu insns=1800007 ns=81234567 ns_per_insn=45.13 cycles_per_insn=16.25 check=1f2e3d4c
+ *
+ *  insns is the interpreter's own count, in which fused pairs and
+ *  accelerated DBRA loops count once, so builds are best compared on ns
+ *  (each kernel is a fixed amount of 68k work). check is a hash of the
+ *  final registers; it must not change between builds of the core.
+ */
+
+#include "sysdeps.h"
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#endif
+#include <time.h>
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "timer.h"
+#include "video.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "cpu_bench.h"
+
+#if CPU_BENCH
+
+#define BENCH_RUNS			3
+#define BENCH_SCRATCH		0x10000		// Mac RAM used by the kernels
+#define BENCH_SCRATCH_SIZE	0x10000
+#define BENCH_CODE			(BENCH_SCRATCH + 0x0000)
+#define BENCH_TABLE			(BENCH_SCRATCH + 0x1000)
+#define BENCH_STACK			(BENCH_SCRATCH + 0x4000)	// Grows down
+#define BENCH_SRC			(BENCH_SCRATCH + 0x4000)
+#define BENCH_DST			(BENCH_SCRATCH + 0x8000)
+#define BENCH_COPY_LONGS	1024
+
+extern int32 emulated_ticks;
+
+// Code emitter
+static uaecptr emit_pc;
+
+static void emit(uae_u16 w)
+{
+	WriteMacInt16(emit_pc, w);
+	emit_pc += 2;
+}
+
+static void emit_long(uae_u32 l)
+{
+	emit(l >> 16);
+	emit(l);
+}
+
+// Backward Bcc/BRA/BSR (op = 0x6000 | cond << 8) or DBcc (op = 0x51c8 | reg)
+static void emit_branch(uae_u16 op, uaecptr target)
+{
+	uae_s32 disp = (uae_s32)(target - (emit_pc + 2));
+	if ((op & 0xf000) == 0x6000 && disp >= -128 && disp < 128 && disp != 0) {
+		emit(op | (disp & 0xff));
+	} else {
+		emit(op);
+		emit(disp);
+	}
+}
+
+// Forward BRA.W/BSR.W, resolved by patch_branch()
+static uaecptr emit_forward(uae_u16 op)
+{
+	uaecptr at = emit_pc;
+	emit(op);
+	emit(0);
+	return at;
+}
+
+static void patch_branch(uaecptr at)
+{
+	WriteMacInt16(at + 2, emit_pc - (at + 2));
+}
+
+/*
+ *  Kernels: each emits its code at BENCH_CODE (ending in RTS) and sets up
+ *  the registers it starts with; d7 is the iteration count
+ */
+
+// Register-only integer ALU work
+static void build_alu(M68kRegisters *r)
+{
+	uaecptr loop = emit_pc;
+	emit(0xd081);					// add.l d1,d0
+	emit(0xb182);					// eor.l d0,d2
+	emit(0xe399);					// rol.l #1,d1
+	emit(0x9682);					// sub.l d2,d3
+	emit(0xc883);					// and.l d3,d4
+	emit(0x8a80);					// or.l d0,d5
+	emit(0x5686);					// addq.l #3,d6
+	emit(0x5387);					// subq.l #1,d7
+	emit_branch(0x6600, loop);		// bne loop
+	emit(0x4e75);					// rts
+	r->d[1] = 0x12345678;
+	r->d[7] = 200000;
+}
+
+// 4KB block copy, MOVE.L (a0)+,(a1)+ in a DBRA loop
+static void build_memcpy(M68kRegisters *r)
+{
+	uaecptr outer = emit_pc;
+	emit(0x2044);					// movea.l d4,a0
+	emit(0x2245);					// movea.l d5,a1
+	emit(0x3006);					// move.w d6,d0
+	uaecptr inner = emit_pc;
+	emit(0x22d8);					// move.l (a0)+,(a1)+
+	emit_branch(0x51c8, inner);		// dbra d0,inner
+	emit(0x5387);					// subq.l #1,d7
+	emit_branch(0x6600, outer);		// bne outer
+	emit(0x4e75);					// rts
+	for (int i = 0; i < BENCH_COPY_LONGS; i++)
+		WriteMacInt32(BENCH_SRC + i * 4, (uae_u32)i * 0x01010101);
+	r->d[4] = BENCH_SRC;
+	r->d[5] = BENCH_DST;
+	r->d[6] = BENCH_COPY_LONGS - 1;
+	r->d[7] = 800;
+}
+
+// Extended precision add/multiply/divide; fp1 returns to its start value
+static void build_fpu(M68kRegisters *r)
+{
+	emit(0xf201); emit(0x4000);		// fmove.l d1,fp0
+	emit(0xf202); emit(0x4100);		// fmove.l d2,fp2
+	emit(0xf203); emit(0x4180);		// fmove.l d3,fp3
+	emit(0xf204); emit(0x4080);		// fmove.l d4,fp1
+	uaecptr loop = emit_pc;
+	emit(0xf200); emit(0x00a2);		// fadd.x fp0,fp1
+	emit(0xf200); emit(0x08a3);		// fmul.x fp2,fp1
+	emit(0xf200); emit(0x0ca0);		// fdiv.x fp3,fp1
+	emit(0xf200); emit(0x00a8);		// fsub.x fp0,fp1
+	emit(0x5387);					// subq.l #1,d7
+	emit_branch(0x6600, loop);		// bne loop
+	emit(0xf200); emit(0x6080);		// fmove.l fp1,d0
+	emit(0x4e75);					// rts
+	r->d[1] = 1;
+	r->d[2] = 3;
+	r->d[3] = 3;
+	r->d[4] = 1000;
+	r->d[7] = 100000;
+}
+
+// Interpreter-style dispatch through a jump table on a pseudo-random
+// selector, with conditional branches and a subroutine call in the cases
+static void build_dispatch(M68kRegisters *r)
+{
+	static const uae_u16 cases[8][2] = {
+		{ 0x5282, 0x4e71 },			// addq.l #1,d2; nop
+		{ 0x5383, 0x4e71 },			// subq.l #1,d3; nop
+		{ 0xd881, 0x4e71 },			// add.l d1,d4; nop
+		{ 0x4a81, 0x6b02 },			// tst.l d1; bmi.s +2 (+ addq below)
+		{ 0, 0 },					// bsr sub
+		{ 0xb682, 0x6e02 },			// cmp.l d2,d3; bgt.s +2 (+ addq below)
+		{ 0xe28c, 0x4e71 },			// lsr.l #1,d4; nop
+		{ 0x4682, 0x4e71 },			// not.l d2; nop
+	};
+	uaecptr fwd_next[8];
+
+	uaecptr loop = emit_pc;
+	emit(0xeb99);					// rol.l #5,d1
+	emit(0x0a81); emit_long(0x9e3779b9);	// eori.l #$9e3779b9,d1
+	emit(0x3001);					// move.w d1,d0
+	emit(0x0240); emit(0x000e);		// andi.w #14,d0
+	emit(0x3032); emit(0x0000);		// move.w (0,a2,d0.w),d0
+	emit(0x4ef2); emit(0x0000);		// jmp (0,a2,d0.w)
+
+	uaecptr fwd_sub = 0;
+	for (int i = 0; i < 8; i++) {
+		WriteMacInt16(BENCH_TABLE + i * 2, emit_pc - BENCH_TABLE);
+		if (i == 4) {
+			fwd_sub = emit_forward(0x6100);	// bsr.w sub
+		} else {
+			emit(cases[i][0]);
+			emit(cases[i][1]);
+			if (i == 3 || i == 5)
+				emit(0x5285);			// addq.l #1,d5
+		}
+		fwd_next[i] = emit_forward(0x6000);	// bra.w next
+	}
+
+	patch_branch(fwd_sub);
+	emit(0x5485);					// sub: addq.l #2,d5
+	emit(0x4e75);					// rts
+
+	for (int i = 0; i < 8; i++)
+		patch_branch(fwd_next[i]);
+	emit(0x5387);					// next: subq.l #1,d7
+	emit_branch(0x6600, loop);		// bne loop
+	emit(0x4e75);					// rts
+	r->d[1] = 0x2545f491;
+	r->a[2] = BENCH_TABLE;
+	r->d[7] = 150000;
+}
+
+// Whole frame buffer fill through the dirty-tracking frame buffer bank
+static void build_fbfill(M68kRegisters *r)
+{
+	uaecptr outer = emit_pc;
+	emit(0x2044);					// movea.l d4,a0
+	emit(0x3006);					// move.w d6,d0
+	uaecptr inner = emit_pc;
+	emit(0x20c1);					// move.l d1,(a0)+
+	emit_branch(0x51c8, inner);		// dbra d0,inner
+	emit(0x4681);					// not.l d1
+	emit(0x5387);					// subq.l #1,d7
+	emit_branch(0x6600, outer);		// bne outer
+	emit(0x4e75);					// rts
+	r->d[1] = 0x00ff00ff;
+	r->d[4] = MacFrameBaseMac;
+	r->d[6] = MacFrameSize / 4 - 1;
+	r->d[7] = 12;
+}
+
+static const struct {
+	const char *name;
+	void (*build)(M68kRegisters *r);
+} bench_kernels[] = {
+	{ "alu", build_alu },
+	{ "memcpy", build_memcpy },
+	{ "fpu", build_fpu },
+	{ "dispatch", build_dispatch },
+	{ "fbfill", build_fbfill },
+};
+
+// Wall-clock nanoseconds (the host build's GetTicks_usec() is emulated time)
+static uae_u64 bench_now_ns(void)
+{
+#ifdef HOST_BUILD
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uae_u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+	return GetTicks_usec() * 1000;
+#endif
+}
+
+static uae_u32 hash_regs(const M68kRegisters *r)
+{
+	uae_u32 h = 2166136261u;
+	for (int i = 0; i < 8; i++)
+		h = (h ^ r->d[i]) * 16777619u;
+	for (int i = 0; i < 7; i++)
+		h = (h ^ r->a[i]) * 16777619u;
+	return h;
+}
+
+void cpu_bench_run(void)
+{
+	if (RAMSize < BENCH_SCRATCH + BENCH_SCRATCH_SIZE || MacFrameSize / 4 > 0x10000) {
+		write_log("[BENCH] Not enough RAM or frame buffer too large, skipped\n");
+		return;
+	}
+#ifdef ARDUINO
+	uae_u8 *saved = (uae_u8 *)heap_caps_malloc(BENCH_SCRATCH_SIZE, MALLOC_CAP_SPIRAM);
+	unsigned mhz = ESP.getCpuFreqMHz();
+#else
+	uae_u8 *saved = (uae_u8 *)malloc(BENCH_SCRATCH_SIZE);
+	unsigned mhz = 0;	// Unknown, cycles_per_insn is reported as 0
+#endif
+	if (saved == NULL) {
+		write_log("[BENCH] Cannot allocate RAM backup, skipped\n");
+		return;
+	}
+	memcpy(saved, RAMBaseHost + BENCH_SCRATCH, BENCH_SCRATCH_SIZE);
+
+	VideoSetPaused(true);
+	m68k_reset();		// Supervisor mode, interrupts masked
+	int32 saved_ticks = emulated_ticks;
+
+	uae_u64 total_insns = 0, total_ns = 0;
+	for (size_t k = 0; k < sizeof(bench_kernels) / sizeof(bench_kernels[0]); k++) {
+		M68kRegisters start, r;
+		memset(&start, 0, sizeof(start));
+		emit_pc = BENCH_CODE;
+		bench_kernels[k].build(&start);
+		FlushCodeCache(RAMBaseHost + BENCH_SCRATCH, BENCH_SCRATCH_SIZE);
+
+		uae_u64 best_ns = ~(uae_u64)0;
+		uae_u32 insns = 0;
+		for (int run = 0; run < BENCH_RUNS; run++) {
+			r = start;
+			m68k_areg(regs, 7) = BENCH_STACK;
+			// Keep cpu_do_check_ticks() (the 60Hz tick) out of the run
+			emulated_ticks = 0x7fffffff;
+			uae_u64 t0 = bench_now_ns();
+			Execute68k(BENCH_CODE, &r);
+			uae_u64 ns = bench_now_ns() - t0;
+			insns = 0x7fffffff - emulated_ticks;
+			if (ns < best_ns)
+				best_ns = ns;
+		}
+		if (best_ns == 0)
+			best_ns = 1;
+
+		double ns_per_insn = (double)best_ns / insns;
+		write_log("[BENCH] name=%s insns=%u ns=%llu ns_per_insn=%.2f cycles_per_insn=%.2f check=%08x\n",
+				  bench_kernels[k].name, insns, (unsigned long long)best_ns, ns_per_insn,
+				  ns_per_insn * mhz / 1000.0, hash_regs(&r));
+		total_insns += insns;
+		total_ns += best_ns;
+	}
+	write_log("[BENCH] name=total insns=%llu ns=%llu mips=%.2f\n", (unsigned long long)total_insns,
+			  (unsigned long long)total_ns, total_insns * 1000.0 / total_ns);
+
+	emulated_ticks = saved_ticks;
+	memcpy(RAMBaseHost + BENCH_SCRATCH, saved, BENCH_SCRATCH_SIZE);
+	free(saved);
+	FlushCodeCache(RAMBaseHost + BENCH_SCRATCH, BENCH_SCRATCH_SIZE);
+	memset(MacFrameBaseHost, 0x80, MacFrameSize);
+	VideoSetPaused(false);
+}
+
+#endif /* CPU_BENCH */
@@ -0,0 +1,18 @@
+/*
+ *  cpu_bench.h - Deterministic 68k CPU micro-benchmarks
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef CPU_BENCH_H
+#define CPU_BENCH_H
+
+#if CPU_BENCH
+
+// Run every kernel and print one "[BENCH]" line per kernel. Called after
+// InitAll() and before Start680x0(); Mac RAM used by the kernels is restored.
+extern void cpu_bench_run(void);
+
+#endif
+
+#endif /* CPU_BENCH_H */
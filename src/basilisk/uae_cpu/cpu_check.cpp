@@ -0,0 +1,497 @@
+/*
+ *  cpu_check.cpp - Differential 68k conformance check of the optimised core
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  The core no longer runs gencpu's handlers one at a time: the decode
+ *  cache replays traces, superinstructions run a compare and its Bcc (or a
+ *  loop body and its DBcc) in one handler, and the RV32 JIT translates hot
+ *  traces. A slip in any of them shows up as a Mac that crashes minutes
+ *  later. This check runs CHECK_BLOCKS random instruction blocks twice
+ *  from the same registers, CCR and data:
+ *
+ *  - through Execute68k(), i.e. whatever the build dispatches with
+ *  - through build_reference_functbl(), gencpu's handlers for the CPU level
+ *    without the fused ones, stepped one instruction at a time
+ *
+ *  and compares d0-d7, a0-a7, the CCR and the data area afterwards. Each
+ *  block is a loop body of CHECK_INSNS instructions run CHECK_PASSES times,
+ *  so the decode cache replays it and the JIT gets it hot. The generator
+ *  sticks to instructions that cannot trap (no division, no odd addresses,
+ *  forward branches only): ALU, immediate and quick forms, MOVE, shifts and
+ *  rotates, unary ops, EXT/SWAP, MULU/MULS, ADDX/SUBX, ABCD/SBCD, Scc, bit
+ *  ops and compare-and-branch pairs, on data registers and on (An), (An)+,
+ *  -(An) and d16(An) into the data area. Mismatches are printed as
+ *
+ *    [CHECK] block=17 d3 ref=00001234 opt=00001235
+ *    [CHECK] block=17 code 41f9 0001 2400 ...
+ *
+ *  followed by a summary line that ends in mismatches=0 on a good build.
+ *  The seed is fixed, so a failing block fails again on the next run.
+ */
+
+#include "sysdeps.h"
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#endif
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "emul_op.h"
+#include "video.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "cpu_check.h"
+
+#if CPU_CHECK
+
+#define CHECK_BLOCKS		1000
+#define CHECK_INSNS			24			// Generated instructions per block
+#define CHECK_PASSES		48			// Loop passes (the JIT translates after 32)
+#define CHECK_MAX_STEPS		100000		// Reference steps before a block counts as runaway
+#define CHECK_MAX_REPORTS	8			// Blocks whose mismatches are printed
+#define CHECK_SEED			0x2545f491
+
+#define CHECK_SCRATCH		0x10000		// Mac RAM used by the blocks
+#define CHECK_SCRATCH_SIZE	0x8000
+#define CHECK_CODE			(CHECK_SCRATCH + 0x0000)
+#define CHECK_DATA			(CHECK_SCRATCH + 0x2000)
+#define CHECK_DATA_SIZE		0x1000
+#define CHECK_STACK			(CHECK_SCRATCH + 0x8000)	// Grows down
+
+extern int32 emulated_ticks;
+
+// Random numbers (xorshift32)
+static uae_u32 rng_state;
+
+static uae_u32 rnd32(void)
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+static int rnd(int n)
+{
+	return rnd32() % n;
+}
+
+// Code emitter
+static uaecptr emit_pc;
+
+static void emit(uae_u16 w)
+{
+	WriteMacInt16(emit_pc, w);
+	emit_pc += 2;
+}
+
+static void emit_long(uae_u32 l)
+{
+	emit(l >> 16);
+	emit(l);
+}
+
+/*
+ *  Effective addresses
+ */
+
+enum {
+	EA_DREG = 1,
+	EA_MEM = 2,			// (An), (An)+, -(An), d16(An) with a0-a3 in the data area
+	EA_IMM = 4
+};
+
+struct check_ea {
+	uae_u16 bits;		// mode << 3 | reg
+	int n;				// Extension words
+	uae_u16 ext[2];
+};
+
+// Destinations never get d7, the loop counter. Byte accesses stay in data
+// registers, so (An)+/-(An) keep a0-a3 even.
+static void pick_ea(check_ea *ea, int size, int kinds, bool dst)
+{
+	if (size == 0)
+		kinds &= ~EA_MEM;
+	int k;
+	do
+		k = 1 << rnd(3);
+	while (!(kinds & k));
+
+	ea->n = 0;
+	if (k == EA_DREG) {
+		ea->bits = dst ? rnd(7) : rnd(8);
+	} else if (k == EA_MEM) {
+		int mode = 2 + rnd(4);
+		ea->bits = mode << 3 | rnd(4);
+		if (mode == 5)
+			ea->ext[ea->n++] = (rnd(128) - 64) * 2;
+	} else {
+		uae_u32 v = rnd32();
+		ea->bits = 0x3c;
+		if (size == 2)
+			ea->ext[ea->n++] = v >> 16;
+		ea->ext[ea->n++] = size == 0 ? (v & 0xff) : (v & 0xffff);
+	}
+}
+
+static void emit_ext(const check_ea *ea)
+{
+	for (int i = 0; i < ea->n; i++)
+		emit(ea->ext[i]);
+}
+
+// MOVE destination field: reg << 9 | mode << 6
+static uae_u16 move_dst(const check_ea *ea)
+{
+	return (ea->bits & 7) << 9 | (ea->bits >> 3) << 6;
+}
+
+/*
+ *  Instruction generator; short_only: a single word, to follow a Bcc.s +2
+ */
+
+static void emit_insn(bool short_only)
+{
+	static const uae_u16 alu_ops[] = { 0xd000, 0x9000, 0xc000, 0x8000, 0xb000 };	// add sub and or cmp
+	static const uae_u16 imm_ops[] = { 0x0000, 0x0200, 0x0400, 0x0600, 0x0a00, 0x0c00 };	// ori andi subi addi eori cmpi
+	static const uae_u16 unary_ops[] = { 0x4000, 0x4200, 0x4400, 0x4600, 0x4a00 };	// negx clr neg not tst
+	static const uae_u16 move_sizes[] = { 0x1000, 0x3000, 0x2000 };
+	const int src_kinds = short_only ? EA_DREG : EA_DREG | EA_MEM | EA_IMM;
+	const int dst_kinds = short_only ? EA_DREG : EA_DREG | EA_MEM;
+	int size = rnd(3);
+	int dn = rnd(7);
+	check_ea src, dst;
+
+	for (;;) {
+		switch (rnd(16)) {
+		case 0:		// ALU <ea>,Dn
+			pick_ea(&src, size, src_kinds, false);
+			emit(alu_ops[rnd(5)] | dn << 9 | size << 6 | src.bits);
+			emit_ext(&src);
+			return;
+		case 1:		// ADD/SUB/AND/OR Dn,<mem>, EOR Dn,<ea>
+			if (short_only || rnd(2)) {
+				pick_ea(&dst, size, dst_kinds, true);
+				emit(0xb100 | rnd(8) << 9 | size << 6 | dst.bits);
+			} else {
+				size = 1 + rnd(2);
+				pick_ea(&dst, size, EA_MEM, true);
+				emit(alu_ops[rnd(4)] | 0x100 | rnd(8) << 9 | size << 6 | dst.bits);
+			}
+			emit_ext(&dst);
+			return;
+		case 2:		// ORI/ANDI/SUBI/ADDI/EORI/CMPI #imm,<ea>
+			if (short_only)
+				continue;
+			pick_ea(&src, size, EA_IMM, false);
+			pick_ea(&dst, size, dst_kinds, true);
+			emit(imm_ops[rnd(6)] | size << 6 | dst.bits);
+			emit_ext(&src);
+			emit_ext(&dst);
+			return;
+		case 3:		// ADDQ/SUBQ
+			pick_ea(&dst, size, dst_kinds, true);
+			emit(0x5000 | rnd(8) << 9 | rnd(2) << 8 | size << 6 | dst.bits);
+			emit_ext(&dst);
+			return;
+		case 4:		// MOVEQ
+			emit(0x7000 | dn << 9 | rnd(256));
+			return;
+		case 5:		// MOVE
+			pick_ea(&src, size, src_kinds, false);
+			pick_ea(&dst, size, dst_kinds, true);
+			emit(move_sizes[size] | move_dst(&dst) | src.bits);
+			emit_ext(&src);
+			emit_ext(&dst);
+			return;
+		case 6:		// ASx/LSx/ROXx/ROx by #1-8 or by a register
+			emit(0xe000 | rnd(8) << 9 | rnd(2) << 8 | size << 6 | rnd(2) << 5 | rnd(4) << 3 | dn);
+			return;
+		case 7:		// NEGX/CLR/NEG/NOT/TST
+			pick_ea(&dst, size, dst_kinds, true);
+			emit(unary_ops[rnd(5)] | size << 6 | dst.bits);
+			emit_ext(&dst);
+			return;
+		case 8:		// EXT.W/EXT.L/SWAP
+			emit((rnd(3) == 0 ? 0x4840 : rnd(2) ? 0x4880 : 0x48c0) | dn);
+			return;
+		case 9:		// MULU.W/MULS.W
+			pick_ea(&src, 1, src_kinds, false);
+			emit((rnd(2) ? 0xc1c0 : 0xc0c0) | dn << 9 | src.bits);
+			emit_ext(&src);
+			return;
+		case 10:	// ADDX/SUBX Dy,Dx
+			emit((rnd(2) ? 0xd100 : 0x9100) | dn << 9 | size << 6 | rnd(8));
+			return;
+		case 11:	// ABCD/SBCD Dy,Dx
+			emit((rnd(2) ? 0xc100 : 0x8100) | dn << 9 | rnd(8));
+			return;
+		case 12:	// Scc Dn
+			emit(0x50c0 | rnd(16) << 8 | dn);
+			return;
+		case 13:	// BTST/BCHG/BCLR/BSET Dm,Dn or #bit,Dn
+			if (short_only || rnd(2)) {
+				emit(0x0100 | rnd(8) << 9 | rnd(4) << 6 | dn);
+			} else {
+				emit(0x0800 | rnd(4) << 6 | dn);
+				emit(rnd(32));
+			}
+			return;
+		case 14:	// CMP Dm,Dn or TST Dn, then Bcc.s over one instruction
+			if (short_only)
+				continue;
+			if (rnd(2))
+				emit(0xb000 | rnd(8) << 9 | size << 6 | rnd(8));
+			else
+				emit(0x4a00 | size << 6 | rnd(8));
+			emit(0x6002 | (2 + rnd(14)) << 8);
+			emit_insn(true);
+			return;
+		case 15:	// Bcc.s over one instruction, on the flags left by the last one
+			if (short_only)
+				continue;
+			emit(0x6002 | (2 + rnd(14)) << 8);
+			emit_insn(true);
+			return;
+		}
+	}
+}
+
+// A block: reload a0-a3, CHECK_INSNS instructions, DBRA d7 back to the
+// start, RTS; returns the number of words
+static int build_block(void)
+{
+	emit_pc = CHECK_CODE;
+	uaecptr loop = emit_pc;
+	for (int i = 0; i < 4; i++) {
+		emit(0x41f9 | i << 9);				// lea CHECK_DATA+x.l,ai
+		emit_long(CHECK_DATA + 0x400 + i * 0x200);
+	}
+	for (int i = 0; i < CHECK_INSNS; i++)
+		emit_insn(false);
+	emit(0x51cf);							// dbra d7,loop
+	emit(loop - emit_pc);
+	emit(0x4e75);							// rts
+	return (emit_pc - CHECK_CODE) / 2;
+}
+
+/*
+ *  Running a block
+ */
+
+struct check_state {
+	M68kRegisters r;
+	uae_u32 a7;
+	uae_u8 ccr;
+	uae_u8 data[CHECK_DATA_SIZE];
+};
+
+static void load_state(const check_state *s, M68kRegisters *r)
+{
+	*r = s->r;
+	memcpy(RAMBaseHost + CHECK_DATA, s->data, CHECK_DATA_SIZE);
+	m68k_areg(regs, 7) = CHECK_STACK;
+	MakeSR();
+	regs.sr = (regs.sr & 0xffe0) | s->ccr;
+	MakeFromSR();
+}
+
+static void save_state(check_state *s, const M68kRegisters *r)
+{
+	s->r = *r;
+	s->a7 = m68k_areg(regs, 7);
+	MakeSR();
+	s->ccr = regs.sr & 0x1f;
+	memcpy(s->data, RAMBaseHost + CHECK_DATA, CHECK_DATA_SIZE);
+}
+
+// Execute68k() with gencpu's plain handlers, one instruction at a time;
+// false if the block did not return
+static bool run_reference(cpuop_func **tbl, uaecptr addr, M68kRegisters *r, uae_u32 *steps)
+{
+	int i;
+	uaecptr oldpc = m68k_getpc();
+
+	for (i = 0; i < 8; i++)
+		m68k_dreg(regs, i) = r->d[i];
+	for (i = 0; i < 7; i++)
+		m68k_areg(regs, i) = r->a[i];
+
+	// Same stack as Execute68k(), stop at the faked return address
+	m68k_areg(regs, 7) -= 2;
+	put_word(m68k_areg(regs, 7), M68K_EXEC_RETURN);
+	m68k_areg(regs, 7) -= 4;
+	put_long(m68k_areg(regs, 7), m68k_areg(regs, 7) + 4);
+	uaecptr ret = m68k_areg(regs, 7) + 4;
+
+	m68k_setpc(addr);
+	fill_prefetch_0();
+	uae_u32 n = 0;
+	while (m68k_getpc() != ret && n < CHECK_MAX_STEPS) {
+		uae_u32 opcode = GET_OPCODE;
+		(*tbl[opcode])(opcode);
+		n++;
+	}
+	bool returned = m68k_getpc() == ret;
+	*steps += n;
+
+	m68k_areg(regs, 7) += 2;
+	m68k_setpc(oldpc);
+	fill_prefetch_0();
+
+	for (i = 0; i < 8; i++)
+		r->d[i] = m68k_dreg(regs, i);
+	for (i = 0; i < 7; i++)
+		r->a[i] = m68k_areg(regs, i);
+	return returned;
+}
+
+/*
+ *  Comparison
+ */
+
+static int compare_u32(int block, const char *name, uae_u32 ref, uae_u32 opt, bool report)
+{
+	if (ref == opt)
+		return 0;
+	if (report)
+		write_log("[CHECK] block=%d %s ref=%08x opt=%08x\n", block, name, ref, opt);
+	return 1;
+}
+
+static int compare(int block, const check_state *ref, const check_state *opt, bool report)
+{
+	static const char *const dnames[8] = { "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7" };
+	static const char *const anames[7] = { "a0", "a1", "a2", "a3", "a4", "a5", "a6" };
+	int diffs = 0;
+
+	for (int i = 0; i < 8; i++)
+		diffs += compare_u32(block, dnames[i], ref->r.d[i], opt->r.d[i], report);
+	for (int i = 0; i < 7; i++)
+		diffs += compare_u32(block, anames[i], ref->r.a[i], opt->r.a[i], report);
+	diffs += compare_u32(block, "a7", ref->a7, opt->a7, report);
+	diffs += compare_u32(block, "ccr", ref->ccr, opt->ccr, report);
+
+	// Memory: the first differing byte and the extent of the differences
+	int first = -1, last = -1;
+	for (int i = 0; i < CHECK_DATA_SIZE; i++) {
+		if (ref->data[i] != opt->data[i]) {
+			if (first < 0)
+				first = i;
+			last = i;
+		}
+	}
+	if (first >= 0) {
+		if (report)
+			write_log("[CHECK] block=%d mem=%08x-%08x ref=%02x opt=%02x\n", block,
+					  CHECK_DATA + first, CHECK_DATA + last, ref->data[first], opt->data[first]);
+		diffs++;
+	}
+	return diffs;
+}
+
+static void report_code(int block, int words)
+{
+	char line[16 * 5 + 1];
+	for (int i = 0; i < words; i += 16) {
+		int len = 0;
+		for (int j = i; j < words && j < i + 16; j++)
+			len += sprintf(line + len, " %04x", ReadMacInt16(CHECK_CODE + j * 2));
+		write_log("[CHECK] block=%d code%s\n", block, line);
+	}
+}
+
+static void random_start(check_state *s)
+{
+	static const uae_u32 edges[] = { 0, 1, 0x7f, 0x80, 0xff, 0x7fff, 0x8000, 0xffff, 0x7fffffff, 0x80000000, 0xffffffff };
+
+	memset(&s->r, 0, sizeof(s->r));
+	for (int i = 0; i < 7; i++)
+		s->r.d[i] = rnd(4) == 0 ? edges[rnd(sizeof(edges) / sizeof(edges[0]))] : rnd32();
+	s->r.d[7] = CHECK_PASSES - 1;
+	s->ccr = rnd(32);
+	for (int i = 0; i < CHECK_DATA_SIZE; i += 4) {
+		uae_u32 v = rnd32();
+		memcpy(s->data + i, &v, 4);
+	}
+}
+
+void cpu_check_run(void)
+{
+	if (RAMSize < CHECK_SCRATCH + CHECK_SCRATCH_SIZE) {
+		write_log("[CHECK] Not enough RAM, skipped\n");
+		return;
+	}
+	cpuop_func **ref_tbl = build_reference_functbl();
+#ifdef ARDUINO
+	uae_u8 *saved = (uae_u8 *)heap_caps_malloc(CHECK_SCRATCH_SIZE, MALLOC_CAP_SPIRAM);
+	check_state *states = (check_state *)heap_caps_malloc(3 * sizeof(check_state), MALLOC_CAP_SPIRAM);
+#else
+	uae_u8 *saved = (uae_u8 *)malloc(CHECK_SCRATCH_SIZE);
+	check_state *states = (check_state *)malloc(3 * sizeof(check_state));
+#endif
+	if (ref_tbl == NULL || saved == NULL || states == NULL) {
+		write_log("[CHECK] Cannot allocate the reference table or RAM backup, skipped\n");
+		free(ref_tbl);
+		free(saved);
+		free(states);
+		return;
+	}
+	check_state *start = &states[0], *ref = &states[1], *opt = &states[2];
+	memcpy(saved, RAMBaseHost + CHECK_SCRATCH, CHECK_SCRATCH_SIZE);
+
+	VideoSetPaused(true);
+	m68k_reset();		// Supervisor mode, interrupts masked
+	int32 saved_ticks = emulated_ticks;
+
+	rng_state = CHECK_SEED;
+	uae_u32 steps = 0;
+	int failed = 0, runaway = 0;
+	for (int block = 0; block < CHECK_BLOCKS; block++) {
+		int words = build_block();
+		FlushCodeCache(RAMBaseHost + CHECK_SCRATCH, CHECK_SCRATCH_SIZE);
+		random_start(start);
+
+		M68kRegisters r;
+		load_state(start, &r);
+		bool returned = run_reference(ref_tbl, CHECK_CODE, &r, &steps);
+		save_state(ref, &r);
+		if (!returned) {
+			// A generator bug, not a core one: don't run it on the optimised path
+			if (runaway++ < CHECK_MAX_REPORTS) {
+				write_log("[CHECK] block=%d did not return\n", block);
+				report_code(block, words);
+			}
+			continue;
+		}
+
+		load_state(start, &r);
+		// Keep cpu_do_check_ticks() (the 60Hz tick) out of the run
+		emulated_ticks = 0x7fffffff;
+		Execute68k(CHECK_CODE, &r);
+		save_state(opt, &r);
+
+		bool report = failed < CHECK_MAX_REPORTS;
+		if (compare(block, ref, opt, report)) {
+			if (report)
+				report_code(block, words);
+			failed++;
+		}
+	}
+	write_log("[CHECK] blocks=%d insns=%u mismatches=%d runaway=%d\n", CHECK_BLOCKS, steps, failed, runaway);
+
+	emulated_ticks = saved_ticks;
+	memcpy(RAMBaseHost + CHECK_SCRATCH, saved, CHECK_SCRATCH_SIZE);
+	free(saved);
+	free(states);
+	free(ref_tbl);
+	FlushCodeCache(RAMBaseHost + CHECK_SCRATCH, CHECK_SCRATCH_SIZE);
+	VideoSetPaused(false);
+}
+
+#endif /* CPU_CHECK */
@@ -0,0 +1,20 @@
+/*
+ *  cpu_check.h - Differential 68k conformance check of the optimised core
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef CPU_CHECK_H
+#define CPU_CHECK_H
+
+#if CPU_CHECK
+
+// Run random instruction blocks through Execute68k() and through gencpu's
+// plain handlers one at a time, and print a "[CHECK]" line per mismatch and
+// a summary. Called after InitAll() and before Start680x0(); Mac RAM used
+// by the blocks is restored.
+extern void cpu_check_run(void);
+
+#endif
+
+#endif /* CPU_CHECK_H */
@@ -44,6 +44,7 @@ extern uint32 ROMSize;			// Size of ROM
 const uint32 MacFrameBaseMac = 0xa0000000;
 extern uint8 *MacFrameBaseHost;	// Frame buffer base (host address space)
 extern uint32 MacFrameSize;		// Size of frame buffer
+extern uint32 MacFrameMaxSize;	// Size of frame buffer in the largest mode
 #endif
 extern int MacFrameLayout;		// Frame buffer layout (see defines below)
 
@@ -52,7 +53,7 @@ enum {
 	FLAYOUT_NONE,				// No frame buffer
 	FLAYOUT_DIRECT,				// Frame buffer is in MacOS layout, no conversion needed
 	FLAYOUT_HOST_555,			// 16 bit, RGB 555, host byte order
-	FLAYOUT_HOST_565,			// 16 bit, RGB 565, host byte order
+	FLAYOUT_HOST_565,			// 16 bit, RGB 565, big-endian (the display's byte order)
 	FLAYOUT_HOST_888			// 32 bit, RGB 888, host byte order
 };
 
@@ -81,6 +82,8 @@ static inline void *Mac2Mac_memcpy(uint32 dest, uint32 src, size_t n) {return me
 extern bool Init680x0(void);	// This routine may want to look at CPUType/FPUType to set up the apropriate emulation
 extern void Exit680x0(void);
 extern void InitFrameBufferMapping(void);
+extern void NativeTrapsInstall(void);							// Called by PatchAfterStartup()
+extern void NativeTrapsReset(void);								// ROM dispatcher until the next NativeTrapsInstall()
 
 // 680x0 dynamic recompilation activation flag
 #if USE_JIT
@@ -92,9 +95,19 @@ const bool UseJIT = false;
 // 680x0 emulation functions
 struct M68kRegisters;
 extern void Start680x0(void);									// Reset and start 680x0
+extern void Resume680x0(void);									// Start 680x0 without a reset (after SaveStateRestore())
 extern "C" void Execute68k(uint32 addr, M68kRegisters *r);		// Execute 68k code from EMUL_OP routine
 extern "C" void Execute68kTrap(uint16 trap, M68kRegisters *r);	// Execute MacOS 68k trap from EMUL_OP routine
 
+// Execute68k()/Execute68kTrap() copying only the registers in the masks
+#define M68K_REG_D(n) (1 << (n))
+#define M68K_REG_A(n) (0x100 << (n))
+#define M68K_REGS_ALL 0x7fff											// d0-d7, a0-a6
+extern "C" void Execute68kRegs(uint32 addr, M68kRegisters *r, uint32 in, uint32 out);
+extern "C" void Execute68kTrapRegs(uint16 trap, M68kRegisters *r, uint32 in, uint32 out);
+extern uint32 EmulOpAddress(void);								// Mac address of the EMUL_OP being executed
+extern void EmulOpMakeSR(void);									// Make r->sr of the EMUL_OP being executed, before reading or changing it
+
 // Interrupt functions
 extern void TriggerInterrupt(void);								// Trigger interrupt level 1 (InterruptFlag must be set first)
 extern void TriggerNMI(void);									// Trigger interrupt level 7
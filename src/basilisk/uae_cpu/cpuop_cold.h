@@ -0,0 +1,39 @@
+/*
+ *  cpuop_cold.h - Compact code for the handlers the profile never saw
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  gencpu emits the 68040 handlers that a frequent.68k profile never saw
+ *  after all the others, and includes this file before them with
+ *  CPUOP_COLD_REGION defined and after them without. In between, memory
+ *  accesses call the out of line accessors of memory.cpp instead of
+ *  inlining the RAM and ROM fast paths, and CPUOP_COLD lets GCC optimize
+ *  the handlers for size and keep them apart from the hot ones. Indexed
+ *  addressing calls get_disp_ea_020_full() instead of the inline brief
+ *  format path of newcpu.h, and MOVEM moves each register through the
+ *  accessors. There is deliberately no include guard.
+ */
+
+#if COMPACT_COLD_HANDLERS
+#ifdef CPUOP_COLD_REGION
+#define get_byte(a)			cold_get_byte(a)
+#define get_word(a)			cold_get_word(a)
+#define get_long(a)			cold_get_long(a)
+#define put_byte(a, v)		cold_put_byte(a, v)
+#define put_word(a, v)		cold_put_word(a, v)
+#define put_long(a, v)		cold_put_long(a, v)
+#define get_disp_ea_020(b, dp)	get_disp_ea_020_full(b, dp)
+#define movem_get_host(a)		((uae_u8 *)NULL)
+#define movem_put_host(a)		((uae_u8 *)NULL)
+#else
+#undef get_byte
+#undef get_word
+#undef get_long
+#undef put_byte
+#undef put_word
+#undef put_long
+#undef get_disp_ea_020
+#undef movem_get_host
+#undef movem_put_host
+#endif
+#endif
@@ -127,6 +127,10 @@ struct fpu_t {
     
     /* Flag set if we emulate an integral 68040 FPU */
     bool        is_integral;
+
+    /* Non-zero if arithmetic is rounded to single precision ("fpufast"),
+       a word so the console and the application profiles can change it */
+    uae_u32     fast_mode;
 };
 
 /* We handle only one global fpu */
@@ -158,6 +162,7 @@ static inline void set_fpiar(uae_u32 new_fpiar)
 extern void fpu_init(bool integral_68040);
 extern void fpu_exit(void);
 extern void fpu_reset(void);
+extern void fpu_set_fast_mode(bool fast);
     
 /* Floating-point arithmetic instructions */
 void fpuop_arithmetic(uae_u32 opcode, uae_u32 extra) REGPARAM;
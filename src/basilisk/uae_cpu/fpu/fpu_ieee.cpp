@@ -21,6 +21,7 @@
 #include "main.h"
 #define FPU_IMPLEMENTATION
 #include "fpu/fpu.h"
+#include "savestate.h"
 
 /* Global FPU context */
 fpu_t fpu;
@@ -103,8 +104,30 @@ PRIVATE inline void FFPU make_quotient(fpu_register const & quotient, uae_u32 si
 }
 
 // to_single
+// Normalized singles, zeros, infinities and NaNs are widened by moving the
+// bits, without a soft-float conversion; denormals go through the float
 PRIVATE inline fpu_register FFPU make_single(uae_u32 value)
 {
+    uae_u32 exp = (value >> 23) & FP_SINGLE_EXP_MAX;
+    if (exp != 0 || (value & 0x007fffff) == 0) {
+        fpu_register result;
+        fp_declare_init_shape(srp, result, double);
+        srp->ieee.negative  = (value >> 31) & 1;
+        if (exp == FP_SINGLE_EXP_MAX)
+            srp->ieee.exponent = FP_DOUBLE_EXP_MAX;
+        else if (exp != 0)
+            srp->ieee.exponent = exp + FP_DOUBLE_EXP_BIAS - FP_SINGLE_EXP_BIAS;
+        else
+            srp->ieee.exponent = 0;
+        srp->ieee.mantissa0 = (value & 0x007fffff) >> 3;
+        srp->ieee.mantissa1 = value << 29;
+        // NaNs come out quiet, as from the conversion
+        if (exp == FP_SINGLE_EXP_MAX && (value & 0x007fffff) != 0)
+            srp->ieee_nan.quiet_nan = 1;
+        fpu_debug(("make_single (%X) = %.04f\n", value, (double)result));
+        return result;
+    }
+
     fpu_single result = 0;
     fp_declare_init_shape(srp, result, single);
     srp->ieee.negative  = (value >> 31) & 1;
@@ -115,8 +138,27 @@ PRIVATE inline fpu_register FFPU make_single(uae_u32 value)
 }
 
 // from_single
+// Values that are exact singles are narrowed by moving the bits; anything
+// that needs rounding goes through the float conversion
 PRIVATE inline uae_u32 FFPU extract_single(fpu_register const & src)
 {
+    if (fp_is_single(src)) {
+        fp_declare_init_shape(sxp, src, double);
+        uae_u32 exp = sxp->ieee.exponent;
+        if (exp == FP_DOUBLE_EXP_MAX)
+            exp = FP_SINGLE_EXP_MAX;
+        else if (exp != 0)
+            exp -= FP_DOUBLE_EXP_BIAS - FP_SINGLE_EXP_BIAS;
+        uae_u32 result = (sxp->ieee.negative << 31)
+                       | (exp << 23)
+                       | (sxp->ieee.mantissa0 << 3)
+                       | (sxp->ieee.mantissa1 >> 29);
+        if (exp == FP_SINGLE_EXP_MAX && (result & 0x007fffff) != 0)
+            result |= 0x00400000;
+        fpu_debug(("extract_single (%.04f) = %X\n", (double)src, result));
+        return result;
+    }
+
     fpu_single input = (fpu_single)src;
     fp_declare_init_shape(sip, input, single);
     uae_u32 result = (sip->ieee.negative << 31)
@@ -209,7 +251,7 @@ PRIVATE inline void FFPU make_extended_no_normalize(
 PRIVATE inline void FFPU extract_extended(fpu_register const & src,
     uae_u32 * wrd1, uae_u32 * wrd2, uae_u32 * wrd3)
 {
-    if (src == 0.0) {
+    if (iszero(src)) {
         *wrd1 = *wrd2 = *wrd3 = 0;
         return;
     }
@@ -986,6 +1028,10 @@ void FFPU fpuop_restore(uae_u32 opcode)
     }
 }
 
+/* Round FADD/FSUB/FMUL/FDIV/FSQRT results to single precision? */
+PRIVATE inline bool FFPU fp_round_single(void)
+    { return FPU fast_mode || get_rounding_precision() == FPCR_PRECISION_SINGLE; }
+
 void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
 {
     int reg;
@@ -1425,7 +1471,7 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
                 break;
             case 0x41:      /* FSSQRT */
                 fpu_debug(("FSQRT %.04f\n", (double)src));
-                FPU registers[reg] = (float)fp_sqrt(src);
+                FPU registers[reg] = fp_single_sqrt(src, FPU fast_mode);
                 make_fpsr(FPU registers[reg]);
                 break;
             case 0x45:      /* FDSQRT */
@@ -1455,7 +1501,7 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
                 break;
             case 0x60:      /* FSDIV */
                 fpu_debug(("FSDIV %.04f\n", (double)src));
-                FPU registers[reg] = (float)(FPU registers[reg] / src);
+                FPU registers[reg] = fp_single_arith(FP_SINGLE_DIV, FPU registers[reg], src, FPU fast_mode);
                 make_fpsr(FPU registers[reg]);
                 break;
             case 0x64:      /* FDDIV */
@@ -1465,7 +1511,7 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
                 break;
             case 0x62:      /* FSADD */
                 fpu_debug(("FSADD %.04f\n", (double)src));
-                FPU registers[reg] = (float)(FPU registers[reg] + src);
+                FPU registers[reg] = fp_single_arith(FP_SINGLE_ADD, FPU registers[reg], src, FPU fast_mode);
                 make_fpsr(FPU registers[reg]);
                 break;
             case 0x66:      /* FDADD */
@@ -1475,7 +1521,7 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
                 break;
             case 0x68:      /* FSSUB */
                 fpu_debug(("FSSUB %.04f\n", (double)src));
-                FPU registers[reg] = (float)(FPU registers[reg] - src);
+                FPU registers[reg] = fp_single_arith(FP_SINGLE_SUB, FPU registers[reg], src, FPU fast_mode);
                 make_fpsr(FPU registers[reg]);
                 break;
             case 0x6c:      /* FDSUB */
@@ -1490,7 +1536,7 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
                 get_source_flags(src);
                 if (fl_dest.in_range && fl_source.in_range) {
                     if ((extra & 0x7f) == 0x63) {
-                        FPU registers[reg] = (float)(FPU registers[reg] * src);
+                        FPU registers[reg] = fp_single_arith(FP_SINGLE_MUL, FPU registers[reg], src, FPU fast_mode);
                     }
                     else {
                         FPU registers[reg] = (double)(FPU registers[reg] * src);
@@ -1553,7 +1599,10 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
             break;
         case 0x04:      /* FSQRT */
             fpu_debug(("FSQRT %.04f\n", (double)src));
-            FPU registers[reg] = fp_sqrt(src);
+            if (fp_round_single())
+                FPU registers[reg] = fp_single_sqrt(src, FPU fast_mode);
+            else
+                FPU registers[reg] = fp_sqrt(src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x06:      /* FLOGNP1 */
@@ -1588,42 +1637,50 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
             break;
         case 0x0e:      /* FSIN */
             fpu_debug(("FSIN %.04f\n", (double)src));
-            FPU registers[reg] = fp_sin(src);
+            if (!FPU fast_mode || !fp_fast_sin(src, FPU registers[reg]))
+                FPU registers[reg] = fp_sin(src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x0f:      /* FTAN */
             fpu_debug(("FTAN %.04f\n", (double)src));
-            FPU registers[reg] = fp_tan(src);
+            if (!FPU fast_mode || !fp_fast_tan(src, FPU registers[reg]))
+                FPU registers[reg] = fp_tan(src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x10:      /* FETOX */
             fpu_debug(("FETOX %.04f\n", (double)src));
-            FPU registers[reg] = fp_exp(src);
+            if (!FPU fast_mode || !fp_fast_exp(src, FPU registers[reg]))
+                FPU registers[reg] = fp_exp(src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x11:      /* FTWOTOX */
             fpu_debug(("FTWOTOX %.04f\n", (double)src));
-            FPU registers[reg] = fp_pow(2.0, src);
+            if (!FPU fast_mode || !fp_fast_exp2(src, FPU registers[reg]))
+                FPU registers[reg] = fp_pow(2.0, src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x12:      /* FTENTOX */
             fpu_debug(("FTENTOX %.04f\n", (double)src));
-            FPU registers[reg] = fp_pow(10.0, src);
+            if (!FPU fast_mode || !fp_fast_exp10(src, FPU registers[reg]))
+                FPU registers[reg] = fp_pow(10.0, src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x14:      /* FLOGN */
             fpu_debug(("FLOGN %.04f\n", (double)src));
-            FPU registers[reg] = fp_log(src);
+            if (!FPU fast_mode || !fp_fast_log(src, FPU registers[reg]))
+                FPU registers[reg] = fp_log(src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x15:      /* FLOG10 */
             fpu_debug(("FLOG10 %.04f\n", (double)src));
-            FPU registers[reg] = fp_log10(src);
+            if (!FPU fast_mode || !fp_fast_log10(src, FPU registers[reg]))
+                FPU registers[reg] = fp_log10(src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x16:      /* FLOG2 */
             fpu_debug(("FLOG2 %.04f\n", (double)src));
-            FPU registers[reg] = fp_log(src) / fp_log(2.0);
+            if (!FPU fast_mode || !fp_fast_log2(src, FPU registers[reg]))
+                FPU registers[reg] = fp_log(src) / fp_log(2.0);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x18:      /* FABS */
@@ -1648,7 +1705,8 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
             break;
         case 0x1d:      /* FCOS */
             fpu_debug(("FCOS %.04f\n", (double)src));
-            FPU registers[reg] = fp_cos(src);
+            if (!FPU fast_mode || !fp_fast_cos(src, FPU registers[reg]))
+                FPU registers[reg] = fp_cos(src);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x1e:      /* FGETEXP */
@@ -1677,7 +1735,10 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
             break;
         case 0x20:      /* FDIV */
             fpu_debug(("FDIV %.04f\n", (double)src));
-            FPU registers[reg] /= src;
+            if (fp_round_single())
+                FPU registers[reg] = fp_single_arith(FP_SINGLE_DIV, FPU registers[reg], src, FPU fast_mode);
+            else
+                FPU registers[reg] /= src;
             make_fpsr(FPU registers[reg]);
             break;
         case 0x21:      /* FMOD */
@@ -1695,7 +1756,10 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
             get_dest_flags(FPU registers[reg]);
             get_source_flags(src);
             if (fl_dest.in_range && fl_source.in_range) {
-                FPU registers[reg] *= src;
+                if (fp_round_single())
+                    FPU registers[reg] = fp_single_arith(FP_SINGLE_MUL, FPU registers[reg], src, FPU fast_mode);
+                else
+                    FPU registers[reg] *= src;
             }
             else if (fl_dest.nan || fl_source.nan || 
                      (fl_dest.zero && fl_source.infinity) ||
@@ -1724,7 +1788,7 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
             break;
         case 0x24:      /* FSGLDIV */
             fpu_debug(("FSGLDIV %.04f\n", (double)src));
-            FPU registers[reg] = (float)(FPU registers[reg] / src);
+            FPU registers[reg] = fp_single_arith(FP_SINGLE_DIV, FPU registers[reg], src, FPU fast_mode);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x25:      /* FREM */
@@ -1763,17 +1827,23 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
             break;
         case 0x27:      /* FSGLMUL */
             fpu_debug(("FSGLMUL %.04f\n", (double)src));
-            FPU registers[reg] = (float)(FPU registers[reg] * src);
+            FPU registers[reg] = fp_single_arith(FP_SINGLE_MUL, FPU registers[reg], src, FPU fast_mode);
             make_fpsr(FPU registers[reg]);
             break;
         case 0x28:      /* FSUB */
             fpu_debug(("FSUB %.04f\n", (double)src));
-            FPU registers[reg] -= src;
+            if (fp_round_single())
+                FPU registers[reg] = fp_single_arith(FP_SINGLE_SUB, FPU registers[reg], src, FPU fast_mode);
+            else
+                FPU registers[reg] -= src;
             make_fpsr(FPU registers[reg]);
             break;
         case 0x22:      /* FADD */
             fpu_debug(("FADD %.04f\n", (double)src));
-            FPU registers[reg] += src;
+            if (fp_round_single())
+                FPU registers[reg] = fp_single_arith(FP_SINGLE_ADD, FPU registers[reg], src, FPU fast_mode);
+            else
+                FPU registers[reg] += src;
             make_fpsr(FPU registers[reg]);
             break;
         case 0x30:      /* FSINCOS */
@@ -1785,9 +1855,18 @@ void FFPU fpuop_arithmetic(uae_u32 opcode, uae_u32 extra)
         case 0x36:
         case 0x37:
             fpu_debug(("FSINCOS %.04f\n", (double)src));
-            // Cosine must be calculated first if same register
-            FPU registers[extra & 7] = fp_cos(src);
-            FPU registers[reg] = fp_sin(src);
+            {
+                fpu_single s, c;
+                // Cosine must be calculated first if same register
+                if (FPU fast_mode && fp_fast_sincos(src, s, c)) {
+                    FPU registers[extra & 7] = c;
+                    FPU registers[reg] = s;
+                }
+                else {
+                    FPU registers[extra & 7] = fp_cos(src);
+                    FPU registers[reg] = fp_sin(src);
+                }
+            }
             make_fpsr(FPU registers[reg]);
             break;
         case 0x38:      /* FCMP */
@@ -1847,6 +1926,15 @@ PUBLIC void FFPU fpu_init(bool integral_68040)
            integral_68040 ? "yes" : "no");
 }
 
+/* Fast mode: FADD/FSUB/FMUL/FDIV/FSQRT round to single precision and run on
+   the hardware FPU. Survives fpu_reset(). */
+PUBLIC void FFPU fpu_set_fast_mode(bool fast)
+{
+    FPU fast_mode = fast;
+    if (fast)
+        printf("[FPU] Fast mode: single precision arithmetic\n");
+}
+
 PUBLIC void FFPU fpu_exit(void)
 {
     fpu_debug(("fpu_exit\n"));
@@ -1858,3 +1946,28 @@ PUBLIC void FFPU fpu_reset(void)
     fpu_exit();
     fpu_init(FPU is_integral);
 }
+
+#if SAVE_STATE
+/* Registers and control registers for hibernate/resume. The fast mode is a
+   preference and stays as set for this boot. */
+void FPUStateIO(savestate *s)
+{
+    uae_u32 fpcr = get_fpcr();
+    uae_u32 fpsr = get_fpsr();
+    uae_u32 fpiar = get_fpiar();
+    fpu_register result = FPU result;
+
+    savestate_var(s, FPU registers);
+    savestate_var(s, fpcr);
+    savestate_var(s, fpsr);
+    savestate_var(s, fpiar);
+    savestate_var(s, result);
+
+    if (savestate_loading(s)) {
+        set_fpcr(fpcr);
+        set_fpsr(fpsr);
+        set_fpiar(fpiar);
+        FPU result = result;    // Condition codes exactly, set_fpsr() only approximates them
+    }
+}
+#endif
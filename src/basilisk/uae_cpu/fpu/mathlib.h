@@ -231,6 +231,252 @@ PRIVATE inline uae_u32 FFPU get_quotient_sign(fpu_register const & ra, fpu_regis
     return ((sap->ieee.negative ^ sbp->ieee.negative) ? FPSR_QUOTIENT_SIGN : 0);
 }
 
+/* -------------------------------------------------------------------------- */
+/* --- Single precision arithmetic                                        --- */
+/* -------------------------------------------------------------------------- */
+
+// The ESP32-P4 FPU only implements single precision; double arithmetic is
+// done by libgcc soft-float calls. When an operation rounds its result to
+// single precision and both operands are exact singles, the hardware float
+// operation gives the same result (for +, -, *, / and sqrt rounding the
+// exact result to double and then to single is the same as rounding it to
+// single directly, since 53 >= 2 * 24 + 2).
+
+// Is r exactly representable as a normalized single (or zero, inf, NaN)?
+PRIVATE inline bool FFPU fp_is_single(fpu_register const & r)
+{
+    fp_declare_init_shape(sxp, r, double);
+    if ((sxp->ieee.mantissa1 & 0x1fffffff) != 0)
+        return false;
+    uae_u32 exp = sxp->ieee.exponent;
+    if (exp == 0)
+        return sxp->ieee.mantissa0 == 0 && sxp->ieee.mantissa1 == 0;
+    return exp == FP_DOUBLE_EXP_MAX
+        || (exp - (FP_DOUBLE_EXP_BIAS - FP_SINGLE_EXP_BIAS) - 1) < FP_SINGLE_EXP_MAX - 1;
+}
+
+enum { FP_SINGLE_ADD, FP_SINGLE_SUB, FP_SINGLE_MUL, FP_SINGLE_DIV };
+
+// a op b rounded to single precision; with force set, inexact operands are
+// rounded to single first instead of taking the double path
+PRIVATE inline fpu_register FFPU fp_single_arith(int op, fpu_register const & a, fpu_register const & b, bool force)
+{
+    if (force || (fp_is_single(a) && fp_is_single(b))) {
+        fpu_single sa = (fpu_single)a, sb = (fpu_single)b;
+        switch (op) {
+        case FP_SINGLE_ADD: return sa + sb;
+        case FP_SINGLE_SUB: return sa - sb;
+        case FP_SINGLE_MUL: return sa * sb;
+        default:            return sa / sb;
+        }
+    }
+    switch (op) {
+    case FP_SINGLE_ADD: return (fpu_single)(a + b);
+    case FP_SINGLE_SUB: return (fpu_single)(a - b);
+    case FP_SINGLE_MUL: return (fpu_single)(a * b);
+    default:            return (fpu_single)(a / b);
+    }
+}
+
+PRIVATE inline fpu_register FFPU fp_single_sqrt(fpu_register const & a, bool force)
+{
+    if (force || fp_is_single(a))
+        return sqrtf((fpu_single)a);
+    return (fpu_single)sqrt(a);
+}
+
+/* -------------------------------------------------------------------------- */
+/* --- Single precision transcendental kernels (fast mode)                --- */
+/* -------------------------------------------------------------------------- */
+
+// Range reduction plus minimax polynomials (Cephes single precision
+// coefficients), evaluated on the hardware FPU. exp and log results are
+// within 2 ulp of the single precision result; sin and cos are within
+// 1e-7 absolute (2 ulp for |x| < 64). Each kernel returns false for
+// arguments it does not cover (NaN, infinities, out of range), which
+// take the double precision libm path.
+
+#define FP_FAST_TRIG_MAX    8192.0f     // Beyond this the pi/2 reduction loses bits
+
+// Build 2^k for -126 <= k <= 127
+PRIVATE inline fpu_single FFPU fp_fast_pow2i(int k)
+{
+    fpu_single_shape s;
+    s.ieee.mantissa = 0;
+    s.ieee.exponent = k + FP_SINGLE_EXP_BIAS;
+    s.ieee.negative = 0;
+    return s.value;
+}
+
+// Round to the nearest integer (ties away from zero)
+PRIVATE inline int FFPU fp_fast_round(fpu_single x)
+{
+    return (int)(x + (x < 0 ? -0.5f : 0.5f));
+}
+
+// e^r - 1 - r for |r| <= ln(2)/2
+PRIVATE inline fpu_single FFPU fp_fast_expm1_poly(fpu_single r)
+{
+    fpu_single p = 1.9875691500E-4f;
+    p = p * r + 1.3981999507E-3f;
+    p = p * r + 8.3334519073E-3f;
+    p = p * r + 4.1665795894E-2f;
+    p = p * r + 1.6666665459E-1f;
+    p = p * r + 5.0000001201E-1f;
+    return p * r * r;
+}
+
+// e^r * 2^k, with k checked so that the result is a normalized single
+PRIVATE inline bool FFPU fp_fast_exp_scale(fpu_single r, int k, fpu_register & res)
+{
+    if (k < -125 || k > 127)
+        return false;
+    res = (fp_fast_expm1_poly(r) + r + 1.0f) * fp_fast_pow2i(k);
+    return true;
+}
+
+PRIVATE inline bool FFPU fp_fast_exp(fpu_register const & x, fpu_register & res)
+{
+    fpu_single xf = (fpu_single)x;
+    if (!(fabsf(xf) <= 88.0f))
+        return false;
+    int k = fp_fast_round(xf * 1.44269504088896341f);
+    // x - k*ln(2), with ln(2) split so that k*0.693359375 is exact
+    fpu_single r = xf - k * 0.693359375f - k * -2.12194440e-4f;
+    return fp_fast_exp_scale(r, k, res);
+}
+
+PRIVATE inline bool FFPU fp_fast_exp2(fpu_register const & x, fpu_register & res)
+{
+    fpu_single xf = (fpu_single)x;
+    if (!(fabsf(xf) <= 127.0f))
+        return false;
+    int k = fp_fast_round(xf);
+    return fp_fast_exp_scale((xf - k) * 0.693147180559945309f, k, res);
+}
+
+PRIVATE inline bool FFPU fp_fast_exp10(fpu_register const & x, fpu_register & res)
+{
+    fpu_single xf = (fpu_single)x;
+    if (!(fabsf(xf) <= 38.0f))
+        return false;
+    int k = fp_fast_round(xf * 3.32192809488736234787f);
+    // (x - k*log10(2)) * ln(10), with log10(2) split as above
+    fpu_single r = (xf - k * 3.00781250000000000000E-1f - k * 2.48745663981195213739E-4f) * 2.30258509299404568402f;
+    return fp_fast_exp_scale(r, k, res);
+}
+
+// Split a positive normalized single x into 2^e * (1 + f), sqrt(1/2) <= 1 + f < sqrt(2),
+// and return ln(1 + f)
+PRIVATE inline bool FFPU fp_fast_log_reduce(fpu_register const & x, int & e, fpu_single & lf)
+{
+    fp_declare_init_shape(sxp, x, double);
+    uae_u32 exp = sxp->ieee.exponent;
+    if (sxp->ieee.negative || (exp - (FP_DOUBLE_EXP_BIAS - FP_SINGLE_EXP_BIAS) - 1) >= FP_SINGLE_EXP_MAX - 1)
+        return false;
+    fpu_single_shape s;
+    s.value = (fpu_single)x;
+    e = (int)s.ieee.exponent - FP_SINGLE_EXP_BIAS;
+    s.ieee.exponent = FP_SINGLE_EXP_BIAS;
+    fpu_single m = s.value;
+    if (m > 1.41421356237309504880f) {
+        m *= 0.5f;
+        e++;
+    }
+    fpu_single f = m - 1.0f;
+    fpu_single z = f * f;
+    fpu_single p = 7.0376836292E-2f;
+    p = p * f - 1.1514610310E-1f;
+    p = p * f + 1.1676998740E-1f;
+    p = p * f - 1.2420140846E-1f;
+    p = p * f + 1.4249322787E-1f;
+    p = p * f - 1.6668057665E-1f;
+    p = p * f + 2.0000714765E-1f;
+    p = p * f - 2.4999993993E-1f;
+    p = p * f + 3.3333331174E-1f;
+    lf = f + (p * f * z - 0.5f * z);
+    return true;
+}
+
+PRIVATE inline bool FFPU fp_fast_log(fpu_register const & x, fpu_register & res)
+{
+    int e;
+    fpu_single lf;
+    if (!fp_fast_log_reduce(x, e, lf))
+        return false;
+    res = (lf + e * -2.12194440e-4f) + e * 0.693359375f;
+    return true;
+}
+
+PRIVATE inline bool FFPU fp_fast_log2(fpu_register const & x, fpu_register & res)
+{
+    int e;
+    fpu_single lf;
+    if (!fp_fast_log_reduce(x, e, lf))
+        return false;
+    res = lf * 1.44269504088896340736f + e;
+    return true;
+}
+
+PRIVATE inline bool FFPU fp_fast_log10(fpu_register const & x, fpu_register & res)
+{
+    int e;
+    fpu_single lf;
+    if (!fp_fast_log_reduce(x, e, lf))
+        return false;
+    res = (lf * 0.434294481903251827651f + e * 2.48745663981195213739E-4f) + e * 3.00781250000000000000E-1f;
+    return true;
+}
+
+// sin(x) and cos(x) for |x| <= FP_FAST_TRIG_MAX
+PRIVATE inline bool FFPU fp_fast_sincos(fpu_register const & x, fpu_single & s, fpu_single & c)
+{
+    fpu_single xf = (fpu_single)x;
+    if (!(fabsf(xf) <= FP_FAST_TRIG_MAX))
+        return false;
+    // x = j*pi/2 + r, |r| <= pi/4, with pi/2 split into three parts
+    int j = fp_fast_round(xf * 0.636619772367581343076f);
+    fpu_single r = ((xf - j * 1.5703125f) - j * 4.837512969970703125E-4f) - j * 7.54978995489188216E-8f;
+    fpu_single z = r * r;
+    fpu_single sr = ((-1.9515295891E-4f * z + 8.3321608736E-3f) * z - 1.6666654611E-1f) * z * r + r;
+    fpu_single cr = ((2.443315711809948E-5f * z - 1.388731625493765E-3f) * z + 4.166664568298827E-2f) * z * z
+                  - 0.5f * z + 1.0f;
+    switch (j & 3) {
+    case 0: s = sr;  c = cr;  break;
+    case 1: s = cr;  c = -sr; break;
+    case 2: s = -sr; c = -cr; break;
+    default: s = -cr; c = sr; break;
+    }
+    return true;
+}
+
+PRIVATE inline bool FFPU fp_fast_sin(fpu_register const & x, fpu_register & res)
+{
+    fpu_single s, c;
+    if (!fp_fast_sincos(x, s, c))
+        return false;
+    res = s;
+    return true;
+}
+
+PRIVATE inline bool FFPU fp_fast_cos(fpu_register const & x, fpu_register & res)
+{
+    fpu_single s, c;
+    if (!fp_fast_sincos(x, s, c))
+        return false;
+    res = c;
+    return true;
+}
+
+PRIVATE inline bool FFPU fp_fast_tan(fpu_register const & x, fpu_register & res)
+{
+    fpu_single s, c;
+    if (!fp_fast_sincos(x, s, c))
+        return false;
+    res = s / c;
+    return true;
+}
+
 /* -------------------------------------------------------------------------- */
 /* --- Math functions - use standard C library                            --- */
 /* -------------------------------------------------------------------------- */
@@ -42,9 +42,14 @@ void REGPARAM2 CPUFUNC(op_0_0)(uae_u32 opcode) /* OR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -61,9 +66,14 @@ void REGPARAM2 CPUFUNC(op_10_0)(uae_u32 opcode) /* OR.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -81,9 +91,14 @@ void REGPARAM2 CPUFUNC(op_18_0)(uae_u32 opcode) /* OR.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -101,9 +116,14 @@ void REGPARAM2 CPUFUNC(op_20_0)(uae_u32 opcode) /* OR.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -120,9 +140,14 @@ void REGPARAM2 CPUFUNC(op_28_0)(uae_u32 opcode) /* OR.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -140,9 +165,14 @@ void REGPARAM2 CPUFUNC(op_30_0)(uae_u32 opcode) /* OR.B #<data>.B,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -153,9 +183,14 @@ void REGPARAM2 CPUFUNC(op_38_0)(uae_u32 opcode) /* OR.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -167,9 +202,14 @@ void REGPARAM2 CPUFUNC(op_39_0)(uae_u32 opcode) /* OR.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -196,9 +236,14 @@ void REGPARAM2 CPUFUNC(op_40_0)(uae_u32 opcode) /* OR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -215,9 +260,14 @@ void REGPARAM2 CPUFUNC(op_50_0)(uae_u32 opcode) /* OR.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -235,9 +285,14 @@ void REGPARAM2 CPUFUNC(op_58_0)(uae_u32 opcode) /* OR.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -255,9 +310,14 @@ void REGPARAM2 CPUFUNC(op_60_0)(uae_u32 opcode) /* OR.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -274,9 +334,14 @@ void REGPARAM2 CPUFUNC(op_68_0)(uae_u32 opcode) /* OR.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -294,9 +359,14 @@ void REGPARAM2 CPUFUNC(op_70_0)(uae_u32 opcode) /* OR.W #<data>.W,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -307,9 +377,14 @@ void REGPARAM2 CPUFUNC(op_78_0)(uae_u32 opcode) /* OR.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -321,9 +396,14 @@ void REGPARAM2 CPUFUNC(op_79_0)(uae_u32 opcode) /* OR.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -331,7 +411,7 @@ void REGPARAM2 CPUFUNC(op_79_0)(uae_u32 opcode) /* OR.W #<data>.W,(xxx).L */
 void REGPARAM2 CPUFUNC(op_7c_0)(uae_u32 opcode) /* ORSR.W #<data>.W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel18; }
+{if (!regs.s) { op_exception(8,0); goto endlabel18; }
 {	MakeSR();
 {	uae_s16 src = get_iword(2);
 	regs.sr |= src;
@@ -351,9 +431,14 @@ void REGPARAM2 CPUFUNC(op_80_0)(uae_u32 opcode) /* OR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -370,9 +455,14 @@ void REGPARAM2 CPUFUNC(op_90_0)(uae_u32 opcode) /* OR.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -390,9 +480,14 @@ void REGPARAM2 CPUFUNC(op_98_0)(uae_u32 opcode) /* OR.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -410,9 +505,14 @@ void REGPARAM2 CPUFUNC(op_a0_0)(uae_u32 opcode) /* OR.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -429,9 +529,14 @@ void REGPARAM2 CPUFUNC(op_a8_0)(uae_u32 opcode) /* OR.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -449,9 +554,14 @@ void REGPARAM2 CPUFUNC(op_b0_0)(uae_u32 opcode) /* OR.L #<data>.L,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -462,9 +572,14 @@ void REGPARAM2 CPUFUNC(op_b8_0)(uae_u32 opcode) /* OR.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -476,9 +591,14 @@ void REGPARAM2 CPUFUNC(op_b9_0)(uae_u32 opcode) /* OR.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -499,7 +619,7 @@ void REGPARAM2 CPUFUNC(op_d0_0)(uae_u32 opcode) /* CHK2.B #<data>.W,(An) */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s8)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel27; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel27; }
 }
 }}}m68k_incpc(4);
 endlabel27: ;
@@ -521,7 +641,7 @@ void REGPARAM2 CPUFUNC(op_e8_0)(uae_u32 opcode) /* CHK2.B #<data>.W,(d16,An) */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s8)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel28; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel28; }
 }
 }}}m68k_incpc(6);
 endlabel28: ;
@@ -544,7 +664,7 @@ void REGPARAM2 CPUFUNC(op_f0_0)(uae_u32 opcode) /* CHK2.B #<data>.W,(d8,An,Xn) *
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s8)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel29; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel29; }
 }
 }}}}endlabel29: ;
 	cpuop_end();
@@ -560,7 +680,7 @@ void REGPARAM2 CPUFUNC(op_f8_0)(uae_u32 opcode) /* CHK2.B #<data>.W,(xxx).W */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s8)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel30; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel30; }
 }
 }}}m68k_incpc(6);
 endlabel30: ;
@@ -577,7 +697,7 @@ void REGPARAM2 CPUFUNC(op_f9_0)(uae_u32 opcode) /* CHK2.B #<data>.W,(xxx).L */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s8)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel31; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel31; }
 }
 }}}m68k_incpc(8);
 endlabel31: ;
@@ -596,7 +716,7 @@ void REGPARAM2 CPUFUNC(op_fa_0)(uae_u32 opcode) /* CHK2.B #<data>.W,(d16,PC) */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s8)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel32; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel32; }
 }
 }}}m68k_incpc(6);
 endlabel32: ;
@@ -616,7 +736,7 @@ void REGPARAM2 CPUFUNC(op_fb_0)(uae_u32 opcode) /* CHK2.B #<data>.W,(d8,PC,Xn) *
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s8)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel33; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel33; }
 }
 }}}}endlabel33: ;
 	cpuop_end();
@@ -641,6 +761,29 @@ void REGPARAM2 CPUFUNC(op_100_0)(uae_u32 opcode) /* BTST.L Dn,Dn */
 }}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_100_0_fuse)(uae_u32 opcode) /* BTST.L Dn,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 #ifndef NOFLAGS
 void REGPARAM2 CPUFUNC(op_108_0)(uae_u32 opcode) /* MVPMR.W (d16,An),Dn */
 {
@@ -684,6 +827,30 @@ void REGPARAM2 CPUFUNC(op_110_0)(uae_u32 opcode) /* BTST.B Dn,(An) */
 }}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_110_0_fuse)(uae_u32 opcode) /* BTST.B Dn,(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_118_0)(uae_u32 opcode) /* BTST.B Dn,(An)+ */
 {
 	cpuop_begin();
@@ -706,6 +873,31 @@ void REGPARAM2 CPUFUNC(op_118_0)(uae_u32 opcode) /* BTST.B Dn,(An)+ */
 }}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_118_0_fuse)(uae_u32 opcode) /* BTST.B Dn,(An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_120_0)(uae_u32 opcode) /* BTST.B Dn,-(An) */
 {
 	cpuop_begin();
@@ -728,6 +920,31 @@ void REGPARAM2 CPUFUNC(op_120_0)(uae_u32 opcode) /* BTST.B Dn,-(An) */
 }}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_120_0_fuse)(uae_u32 opcode) /* BTST.B Dn,-(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_128_0)(uae_u32 opcode) /* BTST.B Dn,(d16,An) */
 {
 	cpuop_begin();
@@ -749,6 +966,30 @@ void REGPARAM2 CPUFUNC(op_128_0)(uae_u32 opcode) /* BTST.B Dn,(d16,An) */
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_128_0_fuse)(uae_u32 opcode) /* BTST.B Dn,(d16,An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_130_0)(uae_u32 opcode) /* BTST.B Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
@@ -770,6 +1011,30 @@ void REGPARAM2 CPUFUNC(op_130_0)(uae_u32 opcode) /* BTST.B Dn,(d8,An,Xn) */
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_130_0_fuse)(uae_u32 opcode) /* BTST.B Dn,(d8,An,Xn) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{m68k_incpc(2);
+{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_138_0)(uae_u32 opcode) /* BTST.B Dn,(xxx).W */
 {
 	cpuop_begin();
@@ -786,6 +1051,25 @@ void REGPARAM2 CPUFUNC(op_138_0)(uae_u32 opcode) /* BTST.B Dn,(xxx).W */
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_138_0_fuse)(uae_u32 opcode) /* BTST.B Dn,(xxx).W + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_139_0)(uae_u32 opcode) /* BTST.B Dn,(xxx).L */
 {
 	cpuop_begin();
@@ -802,6 +1086,25 @@ void REGPARAM2 CPUFUNC(op_139_0)(uae_u32 opcode) /* BTST.B Dn,(xxx).L */
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_139_0_fuse)(uae_u32 opcode) /* BTST.B Dn,(xxx).L + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_13a_0)(uae_u32 opcode) /* BTST.B Dn,(d16,PC) */
 {
 	cpuop_begin();
@@ -820,6 +1123,27 @@ void REGPARAM2 CPUFUNC(op_13a_0)(uae_u32 opcode) /* BTST.B Dn,(d16,PC) */
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_13a_0_fuse)(uae_u32 opcode) /* BTST.B Dn,(d16,PC) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_13b_0)(uae_u32 opcode) /* BTST.B Dn,(d8,PC,Xn) */
 {
 	cpuop_begin();
@@ -838,6 +1162,27 @@ void REGPARAM2 CPUFUNC(op_13b_0)(uae_u32 opcode) /* BTST.B Dn,(d8,PC,Xn) */
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_13b_0_fuse)(uae_u32 opcode) /* BTST.B Dn,(d8,PC,Xn) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_13c_0)(uae_u32 opcode) /* BTST.B Dn,#<data>.B */
 {
 	cpuop_begin();
@@ -853,6 +1198,24 @@ void REGPARAM2 CPUFUNC(op_13c_0)(uae_u32 opcode) /* BTST.B Dn,#<data>.B */
 }}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_13c_0_fuse)(uae_u32 opcode) /* BTST.B Dn,#<data>.B + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = get_ibyte(2);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_140_0)(uae_u32 opcode) /* BCHG.L Dn,Dn */
 {
 	cpuop_begin();
@@ -1577,9 +1940,14 @@ void REGPARAM2 CPUFUNC(op_200_0)(uae_u32 opcode) /* AND.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -1596,9 +1964,14 @@ void REGPARAM2 CPUFUNC(op_210_0)(uae_u32 opcode) /* AND.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1616,9 +1989,14 @@ void REGPARAM2 CPUFUNC(op_218_0)(uae_u32 opcode) /* AND.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1636,9 +2014,14 @@ void REGPARAM2 CPUFUNC(op_220_0)(uae_u32 opcode) /* AND.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1655,9 +2038,14 @@ void REGPARAM2 CPUFUNC(op_228_0)(uae_u32 opcode) /* AND.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1675,9 +2063,14 @@ void REGPARAM2 CPUFUNC(op_230_0)(uae_u32 opcode) /* AND.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1688,9 +2081,14 @@ void REGPARAM2 CPUFUNC(op_238_0)(uae_u32 opcode) /* AND.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1702,9 +2100,14 @@ void REGPARAM2 CPUFUNC(op_239_0)(uae_u32 opcode) /* AND.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1731,9 +2134,14 @@ void REGPARAM2 CPUFUNC(op_240_0)(uae_u32 opcode) /* AND.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -1750,9 +2158,14 @@ void REGPARAM2 CPUFUNC(op_250_0)(uae_u32 opcode) /* AND.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1770,9 +2183,14 @@ void REGPARAM2 CPUFUNC(op_258_0)(uae_u32 opcode) /* AND.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1790,9 +2208,14 @@ void REGPARAM2 CPUFUNC(op_260_0)(uae_u32 opcode) /* AND.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -1809,9 +2232,14 @@ void REGPARAM2 CPUFUNC(op_268_0)(uae_u32 opcode) /* AND.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1829,9 +2257,14 @@ void REGPARAM2 CPUFUNC(op_270_0)(uae_u32 opcode) /* AND.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1842,9 +2275,14 @@ void REGPARAM2 CPUFUNC(op_278_0)(uae_u32 opcode) /* AND.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1856,9 +2294,14 @@ void REGPARAM2 CPUFUNC(op_279_0)(uae_u32 opcode) /* AND.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1866,13 +2309,13 @@ void REGPARAM2 CPUFUNC(op_279_0)(uae_u32 opcode) /* AND.W #<data>.W,(xxx).L */
 void REGPARAM2 CPUFUNC(op_27c_0)(uae_u32 opcode) /* ANDSR.W #<data>.W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel96; }
+{if (!regs.s) { op_exception(8,0); goto endlabel107; }
 {	MakeSR();
 {	uae_s16 src = get_iword(2);
 	regs.sr &= src;
 	MakeFromSR();
 }}}m68k_incpc(4);
-endlabel96: ;
+endlabel107: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_280_0)(uae_u32 opcode) /* AND.L #<data>.L,Dn */
@@ -1886,9 +2329,14 @@ void REGPARAM2 CPUFUNC(op_280_0)(uae_u32 opcode) /* AND.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -1905,9 +2353,14 @@ void REGPARAM2 CPUFUNC(op_290_0)(uae_u32 opcode) /* AND.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1925,9 +2378,14 @@ void REGPARAM2 CPUFUNC(op_298_0)(uae_u32 opcode) /* AND.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1945,9 +2403,14 @@ void REGPARAM2 CPUFUNC(op_2a0_0)(uae_u32 opcode) /* AND.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -1964,9 +2427,14 @@ void REGPARAM2 CPUFUNC(op_2a8_0)(uae_u32 opcode) /* AND.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -1984,9 +2452,14 @@ void REGPARAM2 CPUFUNC(op_2b0_0)(uae_u32 opcode) /* AND.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -1997,9 +2470,14 @@ void REGPARAM2 CPUFUNC(op_2b8_0)(uae_u32 opcode) /* AND.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -2011,9 +2489,14 @@ void REGPARAM2 CPUFUNC(op_2b9_0)(uae_u32 opcode) /* AND.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -2034,10 +2517,10 @@ void REGPARAM2 CPUFUNC(op_2d0_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(An) */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s16)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel105; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel116; }
 }
 }}}m68k_incpc(4);
-endlabel105: ;
+endlabel116: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_2e8_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(d16,An) */
@@ -2056,10 +2539,10 @@ void REGPARAM2 CPUFUNC(op_2e8_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(d16,An) */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s16)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel106; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel117; }
 }
 }}}m68k_incpc(6);
-endlabel106: ;
+endlabel117: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_2f0_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(d8,An,Xn) */
@@ -2079,9 +2562,9 @@ void REGPARAM2 CPUFUNC(op_2f0_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(d8,An,Xn)
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s16)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel107; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel118; }
 }
-}}}}endlabel107: ;
+}}}}endlabel118: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_2f8_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(xxx).W */
@@ -2095,10 +2578,10 @@ void REGPARAM2 CPUFUNC(op_2f8_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(xxx).W */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s16)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel108; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel119; }
 }
 }}}m68k_incpc(6);
-endlabel108: ;
+endlabel119: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_2f9_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(xxx).L */
@@ -2112,10 +2595,10 @@ void REGPARAM2 CPUFUNC(op_2f9_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(xxx).L */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s16)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel109; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel120; }
 }
 }}}m68k_incpc(8);
-endlabel109: ;
+endlabel120: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_2fa_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(d16,PC) */
@@ -2131,10 +2614,10 @@ void REGPARAM2 CPUFUNC(op_2fa_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(d16,PC) */
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s16)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel110; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel121; }
 }
 }}}m68k_incpc(6);
-endlabel110: ;
+endlabel121: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_2fb_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(d8,PC,Xn) */
@@ -2151,9 +2634,9 @@ void REGPARAM2 CPUFUNC(op_2fb_0)(uae_u32 opcode) /* CHK2.W #<data>.W,(d8,PC,Xn)
 	if ((extra & 0x8000) == 0) reg = (uae_s32)(uae_s16)reg;
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel111; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel122; }
 }
-}}}}endlabel111: ;
+}}}}endlabel122: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
@@ -2167,6 +2650,11 @@ void REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2175,6 +2663,7 @@ void REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2191,6 +2680,11 @@ void REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2199,6 +2693,7 @@ void REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2216,6 +2711,11 @@ void REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2224,6 +2724,7 @@ void REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB.B #<data>.B,(An)+ */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2241,6 +2742,11 @@ void REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2249,6 +2755,7 @@ void REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB.B #<data>.B,-(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2265,6 +2772,11 @@ void REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2273,6 +2785,7 @@ void REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d16,An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2290,6 +2803,11 @@ void REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2298,6 +2816,7 @@ void REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -2308,6 +2827,11 @@ void REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2316,6 +2840,7 @@ void REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).W */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2327,6 +2852,11 @@ void REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2335,6 +2865,7 @@ void REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB.B #<data>.B,(xxx).L */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -2350,6 +2881,11 @@ void REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2358,6 +2894,7 @@ void REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2374,6 +2911,11 @@ void REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2382,6 +2924,7 @@ void REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2399,6 +2942,11 @@ void REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2407,6 +2955,7 @@ void REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB.W #<data>.W,(An)+ */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2424,6 +2973,11 @@ void REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2432,6 +2986,7 @@ void REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB.W #<data>.W,-(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2448,6 +3003,11 @@ void REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2456,6 +3016,7 @@ void REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d16,An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2473,6 +3034,11 @@ void REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2481,6 +3047,7 @@ void REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -2491,6 +3058,11 @@ void REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2499,6 +3071,7 @@ void REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).W */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2510,6 +3083,11 @@ void REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -2518,6 +3096,7 @@ void REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB.W #<data>.W,(xxx).L */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -2533,6 +3112,11 @@ void REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2541,6 +3125,7 @@ void REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2557,6 +3142,11 @@ void REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2565,6 +3155,7 @@ void REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2582,6 +3173,11 @@ void REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2590,6 +3186,7 @@ void REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB.L #<data>.L,(An)+ */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2607,6 +3204,11 @@ void REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2615,6 +3217,7 @@ void REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB.L #<data>.L,-(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2631,6 +3234,11 @@ void REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2639,6 +3247,7 @@ void REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d16,An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -2656,6 +3265,11 @@ void REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2664,6 +3278,7 @@ void REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -2674,6 +3289,11 @@ void REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2682,6 +3302,7 @@ void REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).W */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -2693,6 +3314,11 @@ void REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -2701,6 +3327,7 @@ void REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB.L #<data>.L,(xxx).L */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(10);
 	cpuop_end();
@@ -2720,10 +3347,10 @@ void REGPARAM2 CPUFUNC(op_4d0_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(An) */
 	lower=get_long(dsta); upper = get_long(dsta+4);
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel136; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel147; }
 }
 }}}m68k_incpc(4);
-endlabel136: ;
+endlabel147: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4e8_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(d16,An) */
@@ -2741,10 +3368,10 @@ void REGPARAM2 CPUFUNC(op_4e8_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(d16,An) */
 	lower=get_long(dsta); upper = get_long(dsta+4);
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel137; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel148; }
 }
 }}}m68k_incpc(6);
-endlabel137: ;
+endlabel148: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4f0_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(d8,An,Xn) */
@@ -2763,9 +3390,9 @@ void REGPARAM2 CPUFUNC(op_4f0_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(d8,An,Xn)
 	lower=get_long(dsta); upper = get_long(dsta+4);
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel138; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel149; }
 }
-}}}}endlabel138: ;
+}}}}endlabel149: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4f8_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(xxx).W */
@@ -2778,10 +3405,10 @@ void REGPARAM2 CPUFUNC(op_4f8_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(xxx).W */
 	lower=get_long(dsta); upper = get_long(dsta+4);
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel139; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel150; }
 }
 }}}m68k_incpc(6);
-endlabel139: ;
+endlabel150: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4f9_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(xxx).L */
@@ -2794,10 +3421,10 @@ void REGPARAM2 CPUFUNC(op_4f9_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(xxx).L */
 	lower=get_long(dsta); upper = get_long(dsta+4);
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel140; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel151; }
 }
 }}}m68k_incpc(8);
-endlabel140: ;
+endlabel151: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4fa_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(d16,PC) */
@@ -2812,10 +3439,10 @@ void REGPARAM2 CPUFUNC(op_4fa_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(d16,PC) */
 	lower=get_long(dsta); upper = get_long(dsta+4);
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel141; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel152; }
 }
 }}}m68k_incpc(6);
-endlabel141: ;
+endlabel152: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4fb_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(d8,PC,Xn) */
@@ -2831,9 +3458,9 @@ void REGPARAM2 CPUFUNC(op_4fb_0)(uae_u32 opcode) /* CHK2.L #<data>.W,(d8,PC,Xn)
 	lower=get_long(dsta); upper = get_long(dsta+4);
 	SET_ZFLG (upper == reg || lower == reg);
 	SET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);
-	if ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto endlabel142; }
+	if ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto endlabel153; }
 }
-}}}}endlabel142: ;
+}}}}endlabel153: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
@@ -2847,6 +3474,11 @@ void REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2855,6 +3487,7 @@ void REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2871,6 +3504,11 @@ void REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2879,6 +3517,7 @@ void REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2896,6 +3535,11 @@ void REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2904,6 +3548,7 @@ void REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD.B #<data>.B,(An)+ */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2921,6 +3566,11 @@ void REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2929,6 +3579,7 @@ void REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD.B #<data>.B,-(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -2945,6 +3596,11 @@ void REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2953,6 +3609,7 @@ void REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d16,An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -2970,6 +3627,11 @@ void REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2978,6 +3640,7 @@ void REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -2988,6 +3651,11 @@ void REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -2996,6 +3664,7 @@ void REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).W */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -3007,6 +3676,11 @@ void REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -3015,6 +3689,7 @@ void REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD.B #<data>.B,(xxx).L */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -3030,6 +3705,11 @@ void REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3038,6 +3718,7 @@ void REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -3054,6 +3735,11 @@ void REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3062,6 +3748,7 @@ void REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -3079,6 +3766,11 @@ void REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3087,6 +3779,7 @@ void REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD.W #<data>.W,(An)+ */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -3104,6 +3797,11 @@ void REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3112,6 +3810,7 @@ void REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD.W #<data>.W,-(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -3128,6 +3827,11 @@ void REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3136,6 +3840,7 @@ void REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d16,An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -3153,6 +3858,11 @@ void REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3161,6 +3871,7 @@ void REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -3171,6 +3882,11 @@ void REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3179,6 +3895,7 @@ void REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).W */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -3190,6 +3907,11 @@ void REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -3198,6 +3920,7 @@ void REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD.W #<data>.W,(xxx).L */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -3213,6 +3936,11 @@ void REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3221,6 +3949,7 @@ void REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -3237,6 +3966,11 @@ void REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3245,6 +3979,7 @@ void REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -3262,6 +3997,11 @@ void REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3270,6 +4010,7 @@ void REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD.L #<data>.L,(An)+ */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -3287,6 +4028,11 @@ void REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3295,6 +4041,7 @@ void REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD.L #<data>.L,-(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -3311,6 +4058,11 @@ void REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3319,6 +4071,7 @@ void REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d16,An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -3336,6 +4089,11 @@ void REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3344,6 +4102,7 @@ void REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -3354,6 +4113,11 @@ void REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3362,6 +4126,7 @@ void REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).W */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -3373,6 +4138,11 @@ void REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -3381,6 +4151,7 @@ void REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD.L #<data>.L,(xxx).L */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(10);
 	cpuop_end();
@@ -3509,6 +4280,24 @@ void REGPARAM2 CPUFUNC(op_800_0)(uae_u32 opcode) /* BTST.L #<data>.W,Dn */
 }}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_800_0_fuse)(uae_u32 opcode) /* BTST.L #<data>.W,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_810_0)(uae_u32 opcode) /* BTST.B #<data>.W,(An) */
 {
 	cpuop_begin();
@@ -3525,6 +4314,25 @@ void REGPARAM2 CPUFUNC(op_810_0)(uae_u32 opcode) /* BTST.B #<data>.W,(An) */
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_810_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_818_0)(uae_u32 opcode) /* BTST.B #<data>.W,(An)+ */
 {
 	cpuop_begin();
@@ -3542,6 +4350,26 @@ void REGPARAM2 CPUFUNC(op_818_0)(uae_u32 opcode) /* BTST.B #<data>.W,(An)+ */
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_818_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,(An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_820_0)(uae_u32 opcode) /* BTST.B #<data>.W,-(An) */
 {
 	cpuop_begin();
@@ -3559,6 +4387,26 @@ void REGPARAM2 CPUFUNC(op_820_0)(uae_u32 opcode) /* BTST.B #<data>.W,-(An) */
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_820_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,-(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_828_0)(uae_u32 opcode) /* BTST.B #<data>.W,(d16,An) */
 {
 	cpuop_begin();
@@ -3575,6 +4423,25 @@ void REGPARAM2 CPUFUNC(op_828_0)(uae_u32 opcode) /* BTST.B #<data>.W,(d16,An) */
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_828_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,(d16,An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_830_0)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
@@ -3591,6 +4458,25 @@ void REGPARAM2 CPUFUNC(op_830_0)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,An,Xn)
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_830_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,An,Xn) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{m68k_incpc(4);
+{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_838_0)(uae_u32 opcode) /* BTST.B #<data>.W,(xxx).W */
 {
 	cpuop_begin();
@@ -3602,6 +4488,20 @@ void REGPARAM2 CPUFUNC(op_838_0)(uae_u32 opcode) /* BTST.B #<data>.W,(xxx).W */
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_838_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,(xxx).W + Bcc */
+{
+	cpuop_begin();
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_839_0)(uae_u32 opcode) /* BTST.B #<data>.W,(xxx).L */
 {
 	cpuop_begin();
@@ -3613,6 +4513,20 @@ void REGPARAM2 CPUFUNC(op_839_0)(uae_u32 opcode) /* BTST.B #<data>.W,(xxx).L */
 }}}}m68k_incpc(8);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_839_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,(xxx).L + Bcc */
+{
+	cpuop_begin();
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(8);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_83a_0)(uae_u32 opcode) /* BTST.B #<data>.W,(d16,PC) */
 {
 	cpuop_begin();
@@ -3626,6 +4540,22 @@ void REGPARAM2 CPUFUNC(op_83a_0)(uae_u32 opcode) /* BTST.B #<data>.W,(d16,PC) */
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_83a_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,(d16,PC) + Bcc */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_83b_0)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,PC,Xn) */
 {
 	cpuop_begin();
@@ -3639,6 +4569,22 @@ void REGPARAM2 CPUFUNC(op_83b_0)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,PC,Xn)
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_83b_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,PC,Xn) + Bcc */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{m68k_incpc(4);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_83c_0)(uae_u32 opcode) /* BTST.B #<data>.W,#<data>.B */
 {
 	cpuop_begin();
@@ -3649,6 +4595,19 @@ void REGPARAM2 CPUFUNC(op_83c_0)(uae_u32 opcode) /* BTST.B #<data>.W,#<data>.B *
 }}}m68k_incpc(6);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_83c_0_fuse)(uae_u32 opcode) /* BTST.B #<data>.W,#<data>.B + Bcc */
+{
+	cpuop_begin();
+{{	uae_s16 src = get_iword(2);
+{	uae_s8 dst = get_ibyte(4);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_840_0)(uae_u32 opcode) /* BCHG.L #<data>.W,Dn */
 {
 	cpuop_begin();
@@ -4155,9 +5114,14 @@ void REGPARAM2 CPUFUNC(op_a00_0)(uae_u32 opcode) /* EOR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -4174,9 +5138,14 @@ void REGPARAM2 CPUFUNC(op_a10_0)(uae_u32 opcode) /* EOR.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4194,9 +5163,14 @@ void REGPARAM2 CPUFUNC(op_a18_0)(uae_u32 opcode) /* EOR.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4214,9 +5188,14 @@ void REGPARAM2 CPUFUNC(op_a20_0)(uae_u32 opcode) /* EOR.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4233,9 +5212,14 @@ void REGPARAM2 CPUFUNC(op_a28_0)(uae_u32 opcode) /* EOR.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4253,9 +5237,14 @@ void REGPARAM2 CPUFUNC(op_a30_0)(uae_u32 opcode) /* EOR.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4266,9 +5255,14 @@ void REGPARAM2 CPUFUNC(op_a38_0)(uae_u32 opcode) /* EOR.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4280,9 +5274,14 @@ void REGPARAM2 CPUFUNC(op_a39_0)(uae_u32 opcode) /* EOR.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4309,9 +5308,14 @@ void REGPARAM2 CPUFUNC(op_a40_0)(uae_u32 opcode) /* EOR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -4328,9 +5332,14 @@ void REGPARAM2 CPUFUNC(op_a50_0)(uae_u32 opcode) /* EOR.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4348,9 +5357,14 @@ void REGPARAM2 CPUFUNC(op_a58_0)(uae_u32 opcode) /* EOR.W #<data>.W,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4368,9 +5382,14 @@ void REGPARAM2 CPUFUNC(op_a60_0)(uae_u32 opcode) /* EOR.W #<data>.W,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -4387,9 +5406,14 @@ void REGPARAM2 CPUFUNC(op_a68_0)(uae_u32 opcode) /* EOR.W #<data>.W,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4407,9 +5431,14 @@ void REGPARAM2 CPUFUNC(op_a70_0)(uae_u32 opcode) /* EOR.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4420,9 +5449,14 @@ void REGPARAM2 CPUFUNC(op_a78_0)(uae_u32 opcode) /* EOR.W #<data>.W,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4434,9 +5468,14 @@ void REGPARAM2 CPUFUNC(op_a79_0)(uae_u32 opcode) /* EOR.W #<data>.W,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4447,13 +5486,13 @@ void REGPARAM2 CPUFUNC(op_a79_0)(uae_u32 opcode) /* EOR.W #<data>.W,(xxx).L */
 void REGPARAM2 CPUFUNC(op_a7c_0)(uae_u32 opcode) /* EORSR.W #<data>.W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel234; }
+{if (!regs.s) { op_exception(8,0); goto endlabel256; }
 {	MakeSR();
 {	uae_s16 src = get_iword(2);
 	regs.sr ^= src;
 	MakeFromSR();
 }}}m68k_incpc(4);
-endlabel234: ;
+endlabel256: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_a80_0)(uae_u32 opcode) /* EOR.L #<data>.L,Dn */
@@ -4467,9 +5506,14 @@ void REGPARAM2 CPUFUNC(op_a80_0)(uae_u32 opcode) /* EOR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -4486,9 +5530,14 @@ void REGPARAM2 CPUFUNC(op_a90_0)(uae_u32 opcode) /* EOR.L #<data>.L,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4506,9 +5555,14 @@ void REGPARAM2 CPUFUNC(op_a98_0)(uae_u32 opcode) /* EOR.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4526,9 +5580,14 @@ void REGPARAM2 CPUFUNC(op_aa0_0)(uae_u32 opcode) /* EOR.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -4545,9 +5604,14 @@ void REGPARAM2 CPUFUNC(op_aa8_0)(uae_u32 opcode) /* EOR.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4565,9 +5629,14 @@ void REGPARAM2 CPUFUNC(op_ab0_0)(uae_u32 opcode) /* EOR.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -4578,9 +5647,14 @@ void REGPARAM2 CPUFUNC(op_ab8_0)(uae_u32 opcode) /* EOR.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -4592,9 +5666,14 @@ void REGPARAM2 CPUFUNC(op_ab9_0)(uae_u32 opcode) /* EOR.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -4613,6 +5692,10 @@ void REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4620,6 +5703,7 @@ void REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -4640,6 +5724,10 @@ void REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4647,6 +5735,7 @@ void REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -4667,6 +5756,10 @@ void REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS.B #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4674,6 +5767,7 @@ void REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS.B #<data>.W,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -4693,6 +5787,10 @@ void REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4700,6 +5798,7 @@ void REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -4720,6 +5819,10 @@ void REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4727,6 +5830,7 @@ void REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS.B #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}	cpuop_end();
@@ -4740,6 +5844,10 @@ void REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4747,6 +5855,7 @@ void REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -4761,6 +5870,10 @@ void REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4768,6 +5881,7 @@ void REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS.B #<data>.W,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(8);
@@ -4784,6 +5898,37 @@ void REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c00_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4791,9 +5936,12 @@ void REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An) */
 {
 	cpuop_begin();
@@ -4806,6 +5954,38 @@ void REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c10_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4813,9 +5993,12 @@ void REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ */
 {
 	cpuop_begin();
@@ -4829,6 +6012,39 @@ void REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c18_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4836,9 +6052,12 @@ void REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP.B #<data>.B,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) */
 {
 	cpuop_begin();
@@ -4852,6 +6071,39 @@ void REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c20_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4859,9 +6111,12 @@ void REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP.B #<data>.B,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) */
 {
 	cpuop_begin();
@@ -4874,6 +6129,38 @@ void REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c28_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4881,9 +6168,12 @@ void REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) */
 {
 	cpuop_begin();
@@ -4897,6 +6187,10 @@ void REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4904,8 +6198,39 @@ void REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c30_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{m68k_incpc(4);
+{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W */
 {
 	cpuop_begin();
@@ -4913,6 +6238,33 @@ void REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c38_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W + Bcc */
+{
+	cpuop_begin();
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4920,9 +6272,12 @@ void REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L */
 {
 	cpuop_begin();
@@ -4930,6 +6285,33 @@ void REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(8);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c39_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L + Bcc */
+{
+	cpuop_begin();
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4937,9 +6319,12 @@ void REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP.B #<data>.B,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(8);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) */
 {
 	cpuop_begin();
@@ -4949,6 +6334,35 @@ void REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c3a_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) + Bcc */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4956,9 +6370,12 @@ void REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d16,PC) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) */
 {
 	cpuop_begin();
@@ -4969,6 +6386,10 @@ void REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -4976,8 +6397,36 @@ void REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c3b_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) + Bcc */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = get_ibyte(2);
+{m68k_incpc(4);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {
 	cpuop_begin();
@@ -4989,6 +6438,37 @@ void REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c40_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -4996,9 +6476,12 @@ void REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An) */
 {
 	cpuop_begin();
@@ -5011,6 +6494,10 @@ void REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5018,10 +6505,12 @@ void REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c50_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,(An) + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -5032,8 +6521,11 @@ void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
-	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5041,10 +6533,13 @@ void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
+#endif
+void REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -5053,10 +6548,14 @@ void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
 	uae_u32 dstreg = opcode & 7;
 #endif
 {{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
-	m68k_areg (regs, dstreg) = dsta;
+	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5064,10 +6563,12 @@ void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c58_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,(An)+ + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -5076,9 +6577,14 @@ void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
 	uae_u32 dstreg = opcode & 7;
 #endif
 {{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5086,10 +6592,13 @@ void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) */
+#endif
+void REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -5098,10 +6607,14 @@ void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 	uae_u32 dstreg = opcode & 7;
 #endif
 {{	uae_s16 src = get_iword(2);
-{m68k_incpc(4);
-{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 {	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5109,15 +6622,28 @@ void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c60_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,-(An) + Bcc */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 {{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 {	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5125,16 +6651,28 @@ void REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L */
+#endif
+void REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 {{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_ilong(4);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5142,18 +6680,27 @@ void REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+#endif
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c68_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,An) + Bcc */
 {
 	cpuop_begin();
-	uae_u32 dstreg = 2;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 {{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = m68k_getpc () + 4;
-	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5161,19 +6708,29 @@ void REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) */
+#endif
+void REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
-	uae_u32 dstreg = 3;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 {{	uae_s16 src = get_iword(2);
 {m68k_incpc(4);
-{	uaecptr tmppc = m68k_getpc();
-	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
+{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5181,9 +6738,11 @@ void REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c70_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -5191,31 +6750,322 @@ void REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+{{	uae_s16 src = get_iword(2);
+{m68k_incpc(4);
+{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An) */
+#endif
+void REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c78_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).W + Bcc */
+{
+	cpuop_begin();
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L */
+{
+	cpuop_begin();
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(8);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c79_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,(xxx).L + Bcc */
+{
+	cpuop_begin();
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(8);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c7a_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,(d16,PC) + Bcc */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{m68k_incpc(4);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c7b_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) + Bcc */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{m68k_incpc(4);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c80_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c90_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5223,9 +7073,12 @@ void REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ */
 {
 	cpuop_begin();
@@ -5239,6 +7092,39 @@ void REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_c98_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5246,9 +7132,12 @@ void REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP.L #<data>.L,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) */
 {
 	cpuop_begin();
@@ -5262,6 +7151,39 @@ void REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_ca0_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5269,9 +7191,12 @@ void REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP.L #<data>.L,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) */
 {
 	cpuop_begin();
@@ -5284,6 +7209,38 @@ void REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(8);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_ca8_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5291,9 +7248,12 @@ void REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(8);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) */
 {
 	cpuop_begin();
@@ -5307,6 +7267,10 @@ void REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5314,8 +7278,39 @@ void REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_cb0_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{m68k_incpc(6);
+{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W */
 {
 	cpuop_begin();
@@ -5323,6 +7318,33 @@ void REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(8);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_cb8_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W + Bcc */
+{
+	cpuop_begin();
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5330,9 +7352,12 @@ void REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(8);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L */
 {
 	cpuop_begin();
@@ -5340,6 +7365,33 @@ void REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(10);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_cb9_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L + Bcc */
+{
+	cpuop_begin();
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5347,9 +7399,12 @@ void REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP.L #<data>.L,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(10);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) */
 {
 	cpuop_begin();
@@ -5359,6 +7414,35 @@ void REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) */
 	dsta += (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(8);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_cba_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) + Bcc */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 2;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_getpc () + 6;
+	dsta += (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5366,9 +7450,12 @@ void REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d16,PC) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(8);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) */
 {
 	cpuop_begin();
@@ -5379,6 +7466,10 @@ void REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -5386,8 +7477,36 @@ void REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_cbb_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) + Bcc */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{{	uae_s32 src = get_ilong(2);
+{m68k_incpc(6);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr dsta = get_disp_ea_020(tmppc, next_iword());
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An) */
 {
 	cpuop_begin();
@@ -5402,6 +7521,10 @@ void REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5409,6 +7532,7 @@ void REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -5429,6 +7553,10 @@ void REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5436,6 +7564,7 @@ void REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -5456,6 +7585,10 @@ void REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS.W #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5463,6 +7596,7 @@ void REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS.W #<data>.W,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -5482,6 +7616,10 @@ void REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5489,6 +7627,7 @@ void REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -5509,6 +7648,10 @@ void REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5516,6 +7659,7 @@ void REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS.W #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}	cpuop_end();
@@ -5529,6 +7673,10 @@ void REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5536,6 +7684,7 @@ void REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -5550,6 +7699,10 @@ void REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5557,6 +7710,7 @@ void REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS.W #<data>.W,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(8);
@@ -5570,6 +7724,10 @@ void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
 	uae_u32 rn2 = regs.regs[(extra >> 12) & 15];
 	uae_u16 dst1 = get_word(rn1), dst2 = get_word(rn2);
 {uae_u32 newv = ((uae_s16)(dst1)) - ((uae_s16)(m68k_dreg(regs, (extra >> 16) & 7)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, (extra >> 16) & 7), dst1, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s16)(dst1)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5577,8 +7735,13 @@ void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, (extra >> 16) & 7))) > ((uae_u16)(dst1)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG) {
 {uae_u32 newv = ((uae_s16)(dst2)) - ((uae_s16)(m68k_dreg(regs, extra & 7)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, m68k_dreg(regs, extra & 7), dst2, newv);
+#else
 {	int flgs = ((uae_s16)(m68k_dreg(regs, extra & 7))) < 0;
 	int flgo = ((uae_s16)(dst2)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -5586,6 +7749,7 @@ void REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2.W #<data>.L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, extra & 7))) > ((uae_u16)(dst2)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG) {
 	put_word(rn1, m68k_dreg(regs, (extra >> 22) & 7));
 	put_word(rn1, m68k_dreg(regs, (extra >> 6) & 7));
@@ -5606,7 +7770,7 @@ void REGPARAM2 CPUFUNC(op_e10_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(An) */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel288; }
+{if (!regs.s) { op_exception(8,0); goto endlabel340; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5620,7 +7784,7 @@ void REGPARAM2 CPUFUNC(op_e10_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(An) */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xff) | ((src) & 0xff);
 	}
 }}}}}}m68k_incpc(4);
-endlabel288: ;
+endlabel340: ;
 	cpuop_end();
 }
 
@@ -5634,7 +7798,7 @@ void REGPARAM2 CPUFUNC(op_e18_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(An)+ */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel289; }
+{if (!regs.s) { op_exception(8,0); goto endlabel341; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5650,7 +7814,7 @@ void REGPARAM2 CPUFUNC(op_e18_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(An)+ */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xff) | ((src) & 0xff);
 	}
 }}}}}}m68k_incpc(4);
-endlabel289: ;
+endlabel341: ;
 	cpuop_end();
 }
 
@@ -5664,7 +7828,7 @@ void REGPARAM2 CPUFUNC(op_e20_0)(uae_u32 opcode) /* MOVES.B #<data>.W,-(An) */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel290; }
+{if (!regs.s) { op_exception(8,0); goto endlabel342; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5680,7 +7844,7 @@ void REGPARAM2 CPUFUNC(op_e20_0)(uae_u32 opcode) /* MOVES.B #<data>.W,-(An) */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xff) | ((src) & 0xff);
 	}
 }}}}}}m68k_incpc(4);
-endlabel290: ;
+endlabel342: ;
 	cpuop_end();
 }
 
@@ -5694,7 +7858,7 @@ void REGPARAM2 CPUFUNC(op_e28_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(d16,An) *
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel291; }
+{if (!regs.s) { op_exception(8,0); goto endlabel343; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5708,7 +7872,7 @@ void REGPARAM2 CPUFUNC(op_e28_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(d16,An) *
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xff) | ((src) & 0xff);
 	}
 }}}}}}m68k_incpc(8);
-endlabel291: ;
+endlabel343: ;
 	cpuop_end();
 }
 
@@ -5722,7 +7886,7 @@ void REGPARAM2 CPUFUNC(op_e30_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(d8,An,Xn)
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel292; }
+{if (!regs.s) { op_exception(8,0); goto endlabel344; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5736,7 +7900,7 @@ void REGPARAM2 CPUFUNC(op_e30_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(d8,An,Xn)
 	} else {
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xff) | ((src) & 0xff);
 	}
-}}}}}}}endlabel292: ;
+}}}}}}}endlabel344: ;
 	cpuop_end();
 }
 
@@ -5745,7 +7909,7 @@ void REGPARAM2 CPUFUNC(op_e30_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(d8,An,Xn)
 void REGPARAM2 CPUFUNC(op_e38_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(xxx).W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel293; }
+{if (!regs.s) { op_exception(8,0); goto endlabel345; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5759,7 +7923,7 @@ void REGPARAM2 CPUFUNC(op_e38_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(xxx).W */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xff) | ((src) & 0xff);
 	}
 }}}}}}m68k_incpc(8);
-endlabel293: ;
+endlabel345: ;
 	cpuop_end();
 }
 
@@ -5768,7 +7932,7 @@ endlabel293: ;
 void REGPARAM2 CPUFUNC(op_e39_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(xxx).L */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel294; }
+{if (!regs.s) { op_exception(8,0); goto endlabel346; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5782,7 +7946,7 @@ void REGPARAM2 CPUFUNC(op_e39_0)(uae_u32 opcode) /* MOVES.B #<data>.W,(xxx).L */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xff) | ((src) & 0xff);
 	}
 }}}}}}m68k_incpc(12);
-endlabel294: ;
+endlabel346: ;
 	cpuop_end();
 }
 
@@ -5796,7 +7960,7 @@ void REGPARAM2 CPUFUNC(op_e50_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(An) */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel295; }
+{if (!regs.s) { op_exception(8,0); goto endlabel347; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5810,7 +7974,7 @@ void REGPARAM2 CPUFUNC(op_e50_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(An) */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xffff) | ((src) & 0xffff);
 	}
 }}}}}}m68k_incpc(4);
-endlabel295: ;
+endlabel347: ;
 	cpuop_end();
 }
 
@@ -5824,7 +7988,7 @@ void REGPARAM2 CPUFUNC(op_e58_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(An)+ */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel296; }
+{if (!regs.s) { op_exception(8,0); goto endlabel348; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5840,7 +8004,7 @@ void REGPARAM2 CPUFUNC(op_e58_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(An)+ */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xffff) | ((src) & 0xffff);
 	}
 }}}}}}m68k_incpc(4);
-endlabel296: ;
+endlabel348: ;
 	cpuop_end();
 }
 
@@ -5854,7 +8018,7 @@ void REGPARAM2 CPUFUNC(op_e60_0)(uae_u32 opcode) /* MOVES.W #<data>.W,-(An) */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel297; }
+{if (!regs.s) { op_exception(8,0); goto endlabel349; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5870,7 +8034,7 @@ void REGPARAM2 CPUFUNC(op_e60_0)(uae_u32 opcode) /* MOVES.W #<data>.W,-(An) */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xffff) | ((src) & 0xffff);
 	}
 }}}}}}m68k_incpc(4);
-endlabel297: ;
+endlabel349: ;
 	cpuop_end();
 }
 
@@ -5884,7 +8048,7 @@ void REGPARAM2 CPUFUNC(op_e68_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(d16,An) *
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel298; }
+{if (!regs.s) { op_exception(8,0); goto endlabel350; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5898,7 +8062,7 @@ void REGPARAM2 CPUFUNC(op_e68_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(d16,An) *
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xffff) | ((src) & 0xffff);
 	}
 }}}}}}m68k_incpc(8);
-endlabel298: ;
+endlabel350: ;
 	cpuop_end();
 }
 
@@ -5912,7 +8076,7 @@ void REGPARAM2 CPUFUNC(op_e70_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(d8,An,Xn)
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel299; }
+{if (!regs.s) { op_exception(8,0); goto endlabel351; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5926,7 +8090,7 @@ void REGPARAM2 CPUFUNC(op_e70_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(d8,An,Xn)
 	} else {
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xffff) | ((src) & 0xffff);
 	}
-}}}}}}}endlabel299: ;
+}}}}}}}endlabel351: ;
 	cpuop_end();
 }
 
@@ -5935,7 +8099,7 @@ void REGPARAM2 CPUFUNC(op_e70_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(d8,An,Xn)
 void REGPARAM2 CPUFUNC(op_e78_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(xxx).W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel300; }
+{if (!regs.s) { op_exception(8,0); goto endlabel352; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5949,7 +8113,7 @@ void REGPARAM2 CPUFUNC(op_e78_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(xxx).W */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xffff) | ((src) & 0xffff);
 	}
 }}}}}}m68k_incpc(8);
-endlabel300: ;
+endlabel352: ;
 	cpuop_end();
 }
 
@@ -5958,7 +8122,7 @@ endlabel300: ;
 void REGPARAM2 CPUFUNC(op_e79_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(xxx).L */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel301; }
+{if (!regs.s) { op_exception(8,0); goto endlabel353; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -5972,7 +8136,7 @@ void REGPARAM2 CPUFUNC(op_e79_0)(uae_u32 opcode) /* MOVES.W #<data>.W,(xxx).L */
 	m68k_dreg(regs, (extra >> 12) & 7) = (m68k_dreg(regs, (extra >> 12) & 7) & ~0xffff) | ((src) & 0xffff);
 	}
 }}}}}}m68k_incpc(12);
-endlabel301: ;
+endlabel353: ;
 	cpuop_end();
 }
 
@@ -5986,7 +8150,7 @@ void REGPARAM2 CPUFUNC(op_e90_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(An) */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel302; }
+{if (!regs.s) { op_exception(8,0); goto endlabel354; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -6000,7 +8164,7 @@ void REGPARAM2 CPUFUNC(op_e90_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(An) */
 	m68k_dreg(regs, (extra >> 12) & 7) = (src);
 	}
 }}}}}}m68k_incpc(4);
-endlabel302: ;
+endlabel354: ;
 	cpuop_end();
 }
 
@@ -6014,7 +8178,7 @@ void REGPARAM2 CPUFUNC(op_e98_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(An)+ */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel303; }
+{if (!regs.s) { op_exception(8,0); goto endlabel355; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -6030,7 +8194,7 @@ void REGPARAM2 CPUFUNC(op_e98_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(An)+ */
 	m68k_dreg(regs, (extra >> 12) & 7) = (src);
 	}
 }}}}}}m68k_incpc(4);
-endlabel303: ;
+endlabel355: ;
 	cpuop_end();
 }
 
@@ -6044,7 +8208,7 @@ void REGPARAM2 CPUFUNC(op_ea0_0)(uae_u32 opcode) /* MOVES.L #<data>.W,-(An) */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel304; }
+{if (!regs.s) { op_exception(8,0); goto endlabel356; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -6060,7 +8224,7 @@ void REGPARAM2 CPUFUNC(op_ea0_0)(uae_u32 opcode) /* MOVES.L #<data>.W,-(An) */
 	m68k_dreg(regs, (extra >> 12) & 7) = (src);
 	}
 }}}}}}m68k_incpc(4);
-endlabel304: ;
+endlabel356: ;
 	cpuop_end();
 }
 
@@ -6074,7 +8238,7 @@ void REGPARAM2 CPUFUNC(op_ea8_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(d16,An) *
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel305; }
+{if (!regs.s) { op_exception(8,0); goto endlabel357; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -6088,7 +8252,7 @@ void REGPARAM2 CPUFUNC(op_ea8_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(d16,An) *
 	m68k_dreg(regs, (extra >> 12) & 7) = (src);
 	}
 }}}}}}m68k_incpc(8);
-endlabel305: ;
+endlabel357: ;
 	cpuop_end();
 }
 
@@ -6102,7 +8266,7 @@ void REGPARAM2 CPUFUNC(op_eb0_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(d8,An,Xn)
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel306; }
+{if (!regs.s) { op_exception(8,0); goto endlabel358; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -6116,7 +8280,7 @@ void REGPARAM2 CPUFUNC(op_eb0_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(d8,An,Xn)
 	} else {
 	m68k_dreg(regs, (extra >> 12) & 7) = (src);
 	}
-}}}}}}}endlabel306: ;
+}}}}}}}endlabel358: ;
 	cpuop_end();
 }
 
@@ -6125,7 +8289,7 @@ void REGPARAM2 CPUFUNC(op_eb0_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(d8,An,Xn)
 void REGPARAM2 CPUFUNC(op_eb8_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(xxx).W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel307; }
+{if (!regs.s) { op_exception(8,0); goto endlabel359; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -6139,7 +8303,7 @@ void REGPARAM2 CPUFUNC(op_eb8_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(xxx).W */
 	m68k_dreg(regs, (extra >> 12) & 7) = (src);
 	}
 }}}}}}m68k_incpc(8);
-endlabel307: ;
+endlabel359: ;
 	cpuop_end();
 }
 
@@ -6148,7 +8312,7 @@ endlabel307: ;
 void REGPARAM2 CPUFUNC(op_eb9_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(xxx).L */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel308; }
+{if (!regs.s) { op_exception(8,0); goto endlabel360; }
 {{	uae_s16 extra = get_iword(2);
 	if (extra & 0x800)
 {	uae_u32 src = regs.regs[(extra >> 12) & 15];
@@ -6162,7 +8326,7 @@ void REGPARAM2 CPUFUNC(op_eb9_0)(uae_u32 opcode) /* MOVES.L #<data>.W,(xxx).L */
 	m68k_dreg(regs, (extra >> 12) & 7) = (src);
 	}
 }}}}}}m68k_incpc(12);
-endlabel308: ;
+endlabel360: ;
 	cpuop_end();
 }
 
@@ -6181,6 +8345,10 @@ void REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6188,6 +8356,7 @@ void REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -6208,6 +8377,10 @@ void REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An)+ */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6215,6 +8388,7 @@ void REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -6235,6 +8409,10 @@ void REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS.L #<data>.W,-(An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6242,6 +8420,7 @@ void REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS.L #<data>.W,-(An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -6261,6 +8440,10 @@ void REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d16,An) */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6268,6 +8451,7 @@ void REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d16,An) */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -6288,6 +8472,10 @@ void REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d8,An,Xn) *
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6295,6 +8483,7 @@ void REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS.L #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}	cpuop_end();
@@ -6308,6 +8497,10 @@ void REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).W */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6315,6 +8508,7 @@ void REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).W */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -6329,6 +8523,10 @@ void REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).L */
 {	int ru = (src >> 6) & 7;
 	int rc = src & 7;
 {uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(m68k_dreg(regs, rc)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, rc), dst, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6336,6 +8534,7 @@ void REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS.L #<data>.W,(xxx).L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(8);
@@ -6349,6 +8548,10 @@ void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
 	uae_u32 rn2 = regs.regs[(extra >> 12) & 15];
 	uae_u32 dst1 = get_long(rn1), dst2 = get_long(rn2);
 {uae_u32 newv = ((uae_s32)(dst1)) - ((uae_s32)(m68k_dreg(regs, (extra >> 16) & 7)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, (extra >> 16) & 7), dst1, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s32)(dst1)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6356,8 +8559,13 @@ void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, (extra >> 16) & 7))) > ((uae_u32)(dst1)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG) {
 {uae_u32 newv = ((uae_s32)(dst2)) - ((uae_s32)(m68k_dreg(regs, extra & 7)));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, m68k_dreg(regs, extra & 7), dst2, newv);
+#else
 {	int flgs = ((uae_s32)(m68k_dreg(regs, extra & 7))) < 0;
 	int flgo = ((uae_s32)(dst2)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -6365,6 +8573,7 @@ void REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2.L #<data>.L */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, extra & 7))) > ((uae_u32)(dst2)));
 	SET_NFLG (flgn != 0);
+#endif
 	if (GET_ZFLG) {
 	put_long(rn1, m68k_dreg(regs, (extra >> 22) & 7));
 	put_long(rn1, m68k_dreg(regs, (extra >> 6) & 7));
@@ -6390,9 +8599,14 @@ void REGPARAM2 CPUFUNC(op_1000_0)(uae_u32 opcode) /* MOVE.B Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -6412,9 +8626,14 @@ void REGPARAM2 CPUFUNC(op_1010_0)(uae_u32 opcode) /* MOVE.B (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6435,9 +8654,14 @@ void REGPARAM2 CPUFUNC(op_1018_0)(uae_u32 opcode) /* MOVE.B (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6458,9 +8682,14 @@ void REGPARAM2 CPUFUNC(op_1020_0)(uae_u32 opcode) /* MOVE.B -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6480,9 +8709,14 @@ void REGPARAM2 CPUFUNC(op_1028_0)(uae_u32 opcode) /* MOVE.B (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6503,9 +8737,14 @@ void REGPARAM2 CPUFUNC(op_1030_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -6519,9 +8758,14 @@ void REGPARAM2 CPUFUNC(op_1038_0)(uae_u32 opcode) /* MOVE.B (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6536,9 +8780,14 @@ void REGPARAM2 CPUFUNC(op_1039_0)(uae_u32 opcode) /* MOVE.B (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -6554,9 +8803,14 @@ void REGPARAM2 CPUFUNC(op_103a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6573,9 +8827,14 @@ void REGPARAM2 CPUFUNC(op_103b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -6588,9 +8847,14 @@ void REGPARAM2 CPUFUNC(op_103c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s8 src = get_ibyte(2);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -6610,9 +8874,14 @@ void REGPARAM2 CPUFUNC(op_1080_0)(uae_u32 opcode) /* MOVE.B Dn,(An) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -6633,9 +8902,14 @@ void REGPARAM2 CPUFUNC(op_1090_0)(uae_u32 opcode) /* MOVE.B (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6657,9 +8931,14 @@ void REGPARAM2 CPUFUNC(op_1098_0)(uae_u32 opcode) /* MOVE.B (An)+,(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6681,9 +8960,14 @@ void REGPARAM2 CPUFUNC(op_10a0_0)(uae_u32 opcode) /* MOVE.B -(An),(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6704,9 +8988,14 @@ void REGPARAM2 CPUFUNC(op_10a8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6728,9 +9017,14 @@ void REGPARAM2 CPUFUNC(op_10b0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6745,9 +9039,14 @@ void REGPARAM2 CPUFUNC(op_10b8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6763,9 +9062,14 @@ void REGPARAM2 CPUFUNC(op_10b9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -6782,9 +9086,14 @@ void REGPARAM2 CPUFUNC(op_10ba_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6802,9 +9111,14 @@ void REGPARAM2 CPUFUNC(op_10bb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6818,9 +9132,14 @@ void REGPARAM2 CPUFUNC(op_10bc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(An) */
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -6841,13 +9160,52 @@ void REGPARAM2 CPUFUNC(op_10c0_0)(uae_u32 opcode) /* MOVE.B Dn,(An)+ */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+	put_byte(dsta,src);
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_10c0_0_fuse)(uae_u32 opcode) /* MOVE.B Dn,(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_10d0_0)(uae_u32 opcode) /* MOVE.B (An),(An)+ */
 {
 	cpuop_begin();
@@ -6865,13 +9223,53 @@ void REGPARAM2 CPUFUNC(op_10d0_0)(uae_u32 opcode) /* MOVE.B (An),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_10d0_0_fuse)(uae_u32 opcode) /* MOVE.B (An),(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_10d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(An)+ */
 {
 	cpuop_begin();
@@ -6890,13 +9288,54 @@ void REGPARAM2 CPUFUNC(op_10d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_10d8_0_fuse)(uae_u32 opcode) /* MOVE.B (An)+,(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_10e0_0)(uae_u32 opcode) /* MOVE.B -(An),(An)+ */
 {
 	cpuop_begin();
@@ -6915,9 +9354,14 @@ void REGPARAM2 CPUFUNC(op_10e0_0)(uae_u32 opcode) /* MOVE.B -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -6939,9 +9383,14 @@ void REGPARAM2 CPUFUNC(op_10e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -6964,9 +9413,14 @@ void REGPARAM2 CPUFUNC(op_10f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -6982,9 +9436,14 @@ void REGPARAM2 CPUFUNC(op_10f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7001,9 +9460,14 @@ void REGPARAM2 CPUFUNC(op_10f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7021,9 +9485,14 @@ void REGPARAM2 CPUFUNC(op_10fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7042,9 +9511,14 @@ void REGPARAM2 CPUFUNC(op_10fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7059,9 +9533,14 @@ void REGPARAM2 CPUFUNC(op_10fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(An)+ */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7082,9 +9561,14 @@ void REGPARAM2 CPUFUNC(op_1100_0)(uae_u32 opcode) /* MOVE.B Dn,-(An) */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -7106,9 +9590,14 @@ void REGPARAM2 CPUFUNC(op_1110_0)(uae_u32 opcode) /* MOVE.B (An),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7131,9 +9620,14 @@ void REGPARAM2 CPUFUNC(op_1118_0)(uae_u32 opcode) /* MOVE.B (An)+,-(An) */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7156,9 +9650,14 @@ void REGPARAM2 CPUFUNC(op_1120_0)(uae_u32 opcode) /* MOVE.B -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -7180,9 +9679,14 @@ void REGPARAM2 CPUFUNC(op_1128_0)(uae_u32 opcode) /* MOVE.B (d16,An),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7205,9 +9709,14 @@ void REGPARAM2 CPUFUNC(op_1130_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7223,9 +9732,14 @@ void REGPARAM2 CPUFUNC(op_1138_0)(uae_u32 opcode) /* MOVE.B (xxx).W,-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7242,9 +9756,14 @@ void REGPARAM2 CPUFUNC(op_1139_0)(uae_u32 opcode) /* MOVE.B (xxx).L,-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7262,9 +9781,14 @@ void REGPARAM2 CPUFUNC(op_113a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7283,9 +9807,14 @@ void REGPARAM2 CPUFUNC(op_113b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7300,9 +9829,14 @@ void REGPARAM2 CPUFUNC(op_113c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,-(An) */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7322,9 +9856,14 @@ void REGPARAM2 CPUFUNC(op_1140_0)(uae_u32 opcode) /* MOVE.B Dn,(d16,An) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7345,9 +9884,14 @@ void REGPARAM2 CPUFUNC(op_1150_0)(uae_u32 opcode) /* MOVE.B (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7369,9 +9913,14 @@ void REGPARAM2 CPUFUNC(op_1158_0)(uae_u32 opcode) /* MOVE.B (An)+,(d16,An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7393,9 +9942,14 @@ void REGPARAM2 CPUFUNC(op_1160_0)(uae_u32 opcode) /* MOVE.B -(An),(d16,An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7416,9 +9970,14 @@ void REGPARAM2 CPUFUNC(op_1168_0)(uae_u32 opcode) /* MOVE.B (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7440,9 +9999,14 @@ void REGPARAM2 CPUFUNC(op_1170_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7458,9 +10022,14 @@ void REGPARAM2 CPUFUNC(op_1178_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7476,9 +10045,14 @@ void REGPARAM2 CPUFUNC(op_1179_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -7495,9 +10069,14 @@ void REGPARAM2 CPUFUNC(op_117a_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7515,9 +10094,14 @@ void REGPARAM2 CPUFUNC(op_117b_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7532,9 +10116,14 @@ void REGPARAM2 CPUFUNC(op_117c_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(d16,An) *
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7555,9 +10144,14 @@ void REGPARAM2 CPUFUNC(op_1180_0)(uae_u32 opcode) /* MOVE.B Dn,(d8,An,Xn) */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}	cpuop_end();
 }
@@ -7578,9 +10172,14 @@ void REGPARAM2 CPUFUNC(op_1190_0)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7602,9 +10201,14 @@ void REGPARAM2 CPUFUNC(op_1198_0)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7626,9 +10230,14 @@ void REGPARAM2 CPUFUNC(op_11a0_0)(uae_u32 opcode) /* MOVE.B -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7649,9 +10258,14 @@ void REGPARAM2 CPUFUNC(op_11a8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(d8,An,Xn)
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7672,9 +10286,14 @@ void REGPARAM2 CPUFUNC(op_11b0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -7690,9 +10309,14 @@ void REGPARAM2 CPUFUNC(op_11b8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(d8,An,Xn) *
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7708,9 +10332,14 @@ void REGPARAM2 CPUFUNC(op_11b9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(d8,An,Xn) *
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7727,9 +10356,14 @@ void REGPARAM2 CPUFUNC(op_11ba_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(d8,An,Xn)
 {	uae_s8 src = get_byte(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -7746,9 +10380,14 @@ void REGPARAM2 CPUFUNC(op_11bb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -7763,9 +10402,14 @@ void REGPARAM2 CPUFUNC(op_11bc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(d8,An,Xn)
 {{	uae_s8 src = get_ibyte(2);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}	cpuop_end();
 }
@@ -7779,9 +10423,14 @@ void REGPARAM2 CPUFUNC(op_11c0_0)(uae_u32 opcode) /* MOVE.B Dn,(xxx).W */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -7797,9 +10446,14 @@ void REGPARAM2 CPUFUNC(op_11d0_0)(uae_u32 opcode) /* MOVE.B (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7816,9 +10470,14 @@ void REGPARAM2 CPUFUNC(op_11d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(xxx).W */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7835,9 +10494,14 @@ void REGPARAM2 CPUFUNC(op_11e0_0)(uae_u32 opcode) /* MOVE.B -(An),(xxx).W */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -7853,9 +10517,14 @@ void REGPARAM2 CPUFUNC(op_11e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7872,9 +10541,14 @@ void REGPARAM2 CPUFUNC(op_11f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7885,9 +10559,14 @@ void REGPARAM2 CPUFUNC(op_11f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7898,9 +10577,14 @@ void REGPARAM2 CPUFUNC(op_11f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -7912,9 +10596,14 @@ void REGPARAM2 CPUFUNC(op_11fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7927,9 +10616,14 @@ void REGPARAM2 CPUFUNC(op_11fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -7939,9 +10633,14 @@ void REGPARAM2 CPUFUNC(op_11fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(xxx).W */
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7956,9 +10655,14 @@ void REGPARAM2 CPUFUNC(op_13c0_0)(uae_u32 opcode) /* MOVE.B Dn,(xxx).L */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -7974,9 +10678,14 @@ void REGPARAM2 CPUFUNC(op_13d0_0)(uae_u32 opcode) /* MOVE.B (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -7993,9 +10702,14 @@ void REGPARAM2 CPUFUNC(op_13d8_0)(uae_u32 opcode) /* MOVE.B (An)+,(xxx).L */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8012,9 +10726,14 @@ void REGPARAM2 CPUFUNC(op_13e0_0)(uae_u32 opcode) /* MOVE.B -(An),(xxx).L */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8030,9 +10749,14 @@ void REGPARAM2 CPUFUNC(op_13e8_0)(uae_u32 opcode) /* MOVE.B (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8049,9 +10773,14 @@ void REGPARAM2 CPUFUNC(op_13f0_0)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -8062,9 +10791,14 @@ void REGPARAM2 CPUFUNC(op_13f8_0)(uae_u32 opcode) /* MOVE.B (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8075,9 +10809,14 @@ void REGPARAM2 CPUFUNC(op_13f9_0)(uae_u32 opcode) /* MOVE.B (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -8089,9 +10828,14 @@ void REGPARAM2 CPUFUNC(op_13fa_0)(uae_u32 opcode) /* MOVE.B (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -8104,9 +10848,14 @@ void REGPARAM2 CPUFUNC(op_13fb_0)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -8116,9 +10865,14 @@ void REGPARAM2 CPUFUNC(op_13fc_0)(uae_u32 opcode) /* MOVE.B #<data>.B,(xxx).L */
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -8137,9 +10891,14 @@ void REGPARAM2 CPUFUNC(op_2000_0)(uae_u32 opcode) /* MOVE.L Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8158,9 +10917,14 @@ void REGPARAM2 CPUFUNC(op_2008_0)(uae_u32 opcode) /* MOVE.L An,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8180,9 +10944,14 @@ void REGPARAM2 CPUFUNC(op_2010_0)(uae_u32 opcode) /* MOVE.L (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8203,9 +10972,14 @@ void REGPARAM2 CPUFUNC(op_2018_0)(uae_u32 opcode) /* MOVE.L (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8226,9 +11000,14 @@ void REGPARAM2 CPUFUNC(op_2020_0)(uae_u32 opcode) /* MOVE.L -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8248,9 +11027,14 @@ void REGPARAM2 CPUFUNC(op_2028_0)(uae_u32 opcode) /* MOVE.L (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8271,9 +11055,14 @@ void REGPARAM2 CPUFUNC(op_2030_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -8287,9 +11076,14 @@ void REGPARAM2 CPUFUNC(op_2038_0)(uae_u32 opcode) /* MOVE.L (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8304,9 +11098,14 @@ void REGPARAM2 CPUFUNC(op_2039_0)(uae_u32 opcode) /* MOVE.L (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8322,9 +11121,14 @@ void REGPARAM2 CPUFUNC(op_203a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8341,9 +11145,14 @@ void REGPARAM2 CPUFUNC(op_203b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -8356,9 +11165,14 @@ void REGPARAM2 CPUFUNC(op_203c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = get_ilong(2);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -8630,9 +11444,14 @@ void REGPARAM2 CPUFUNC(op_2080_0)(uae_u32 opcode) /* MOVE.L Dn,(An) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8652,9 +11471,14 @@ void REGPARAM2 CPUFUNC(op_2088_0)(uae_u32 opcode) /* MOVE.L An,(An) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8675,9 +11499,14 @@ void REGPARAM2 CPUFUNC(op_2090_0)(uae_u32 opcode) /* MOVE.L (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8699,9 +11528,14 @@ void REGPARAM2 CPUFUNC(op_2098_0)(uae_u32 opcode) /* MOVE.L (An)+,(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8723,9 +11557,14 @@ void REGPARAM2 CPUFUNC(op_20a0_0)(uae_u32 opcode) /* MOVE.L -(An),(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -8746,9 +11585,14 @@ void REGPARAM2 CPUFUNC(op_20a8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8770,9 +11614,14 @@ void REGPARAM2 CPUFUNC(op_20b0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -8787,9 +11636,14 @@ void REGPARAM2 CPUFUNC(op_20b8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8805,9 +11659,14 @@ void REGPARAM2 CPUFUNC(op_20b9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -8824,9 +11683,14 @@ void REGPARAM2 CPUFUNC(op_20ba_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -8844,9 +11708,14 @@ void REGPARAM2 CPUFUNC(op_20bb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -8860,9 +11729,14 @@ void REGPARAM2 CPUFUNC(op_20bc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(An) */
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -8883,13 +11757,52 @@ void REGPARAM2 CPUFUNC(op_20c0_0)(uae_u32 opcode) /* MOVE.L Dn,(An)+ */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_20c0_0_fuse)(uae_u32 opcode) /* MOVE.L Dn,(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_20c8_0)(uae_u32 opcode) /* MOVE.L An,(An)+ */
 {
 	cpuop_begin();
@@ -8906,9 +11819,14 @@ void REGPARAM2 CPUFUNC(op_20c8_0)(uae_u32 opcode) /* MOVE.L An,(An)+ */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -8930,13 +11848,53 @@ void REGPARAM2 CPUFUNC(op_20d0_0)(uae_u32 opcode) /* MOVE.L (An),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_20d0_0_fuse)(uae_u32 opcode) /* MOVE.L (An),(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_20d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(An)+ */
 {
 	cpuop_begin();
@@ -8955,13 +11913,54 @@ void REGPARAM2 CPUFUNC(op_20d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_20d8_0_fuse)(uae_u32 opcode) /* MOVE.L (An)+,(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_20e0_0)(uae_u32 opcode) /* MOVE.L -(An),(An)+ */
 {
 	cpuop_begin();
@@ -8980,9 +11979,14 @@ void REGPARAM2 CPUFUNC(op_20e0_0)(uae_u32 opcode) /* MOVE.L -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9004,9 +12008,14 @@ void REGPARAM2 CPUFUNC(op_20e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9029,9 +12038,14 @@ void REGPARAM2 CPUFUNC(op_20f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9047,9 +12061,14 @@ void REGPARAM2 CPUFUNC(op_20f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9066,9 +12085,14 @@ void REGPARAM2 CPUFUNC(op_20f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9086,9 +12110,14 @@ void REGPARAM2 CPUFUNC(op_20fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9107,9 +12136,14 @@ void REGPARAM2 CPUFUNC(op_20fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9124,9 +12158,14 @@ void REGPARAM2 CPUFUNC(op_20fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(An)+ */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -9147,9 +12186,14 @@ void REGPARAM2 CPUFUNC(op_2100_0)(uae_u32 opcode) /* MOVE.L Dn,-(An) */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -9170,9 +12214,14 @@ void REGPARAM2 CPUFUNC(op_2108_0)(uae_u32 opcode) /* MOVE.L An,-(An) */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -9194,9 +12243,14 @@ void REGPARAM2 CPUFUNC(op_2110_0)(uae_u32 opcode) /* MOVE.L (An),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9219,9 +12273,14 @@ void REGPARAM2 CPUFUNC(op_2118_0)(uae_u32 opcode) /* MOVE.L (An)+,-(An) */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9244,9 +12303,14 @@ void REGPARAM2 CPUFUNC(op_2120_0)(uae_u32 opcode) /* MOVE.L -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -9268,9 +12332,14 @@ void REGPARAM2 CPUFUNC(op_2128_0)(uae_u32 opcode) /* MOVE.L (d16,An),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9293,9 +12362,14 @@ void REGPARAM2 CPUFUNC(op_2130_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9311,9 +12385,14 @@ void REGPARAM2 CPUFUNC(op_2138_0)(uae_u32 opcode) /* MOVE.L (xxx).W,-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9330,9 +12409,14 @@ void REGPARAM2 CPUFUNC(op_2139_0)(uae_u32 opcode) /* MOVE.L (xxx).L,-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9350,9 +12434,14 @@ void REGPARAM2 CPUFUNC(op_213a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9371,9 +12460,14 @@ void REGPARAM2 CPUFUNC(op_213b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9388,9 +12482,14 @@ void REGPARAM2 CPUFUNC(op_213c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,-(An) */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -9410,9 +12509,14 @@ void REGPARAM2 CPUFUNC(op_2140_0)(uae_u32 opcode) /* MOVE.L Dn,(d16,An) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9432,9 +12536,14 @@ void REGPARAM2 CPUFUNC(op_2148_0)(uae_u32 opcode) /* MOVE.L An,(d16,An) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9455,9 +12564,14 @@ void REGPARAM2 CPUFUNC(op_2150_0)(uae_u32 opcode) /* MOVE.L (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9482,9 +12596,14 @@ void REGPARAM2 CPUFUNC(op_2158_0)(uae_u32 opcode) /* MOVE.L (An)+,(d16,An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9506,9 +12625,14 @@ void REGPARAM2 CPUFUNC(op_2160_0)(uae_u32 opcode) /* MOVE.L -(An),(d16,An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9529,9 +12653,14 @@ void REGPARAM2 CPUFUNC(op_2168_0)(uae_u32 opcode) /* MOVE.L (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9553,9 +12682,14 @@ void REGPARAM2 CPUFUNC(op_2170_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -9571,9 +12705,14 @@ void REGPARAM2 CPUFUNC(op_2178_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9589,9 +12728,14 @@ void REGPARAM2 CPUFUNC(op_2179_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -9608,9 +12752,14 @@ void REGPARAM2 CPUFUNC(op_217a_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -9628,9 +12777,14 @@ void REGPARAM2 CPUFUNC(op_217b_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -9645,9 +12799,14 @@ void REGPARAM2 CPUFUNC(op_217c_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(d16,An) *
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -9668,9 +12827,14 @@ void REGPARAM2 CPUFUNC(op_2180_0)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9690,9 +12854,14 @@ void REGPARAM2 CPUFUNC(op_2188_0)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9713,9 +12882,14 @@ void REGPARAM2 CPUFUNC(op_2190_0)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9737,9 +12911,14 @@ void REGPARAM2 CPUFUNC(op_2198_0)(uae_u32 opcode) /* MOVE.L (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += 4;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9761,9 +12940,14 @@ void REGPARAM2 CPUFUNC(op_21a0_0)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9784,9 +12968,14 @@ void REGPARAM2 CPUFUNC(op_21a8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn)
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9807,9 +12996,14 @@ void REGPARAM2 CPUFUNC(op_21b0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -9825,9 +13019,14 @@ void REGPARAM2 CPUFUNC(op_21b8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(d8,An,Xn) *
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9843,9 +13042,14 @@ void REGPARAM2 CPUFUNC(op_21b9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(d8,An,Xn) *
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9862,9 +13066,14 @@ void REGPARAM2 CPUFUNC(op_21ba_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(d8,An,Xn)
 {	uae_s32 src = get_long(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -9881,9 +13090,14 @@ void REGPARAM2 CPUFUNC(op_21bb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -9898,9 +13112,14 @@ void REGPARAM2 CPUFUNC(op_21bc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(d8,An,Xn)
 {{	uae_s32 src = get_ilong(2);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}	cpuop_end();
 }
@@ -9914,9 +13133,14 @@ void REGPARAM2 CPUFUNC(op_21c0_0)(uae_u32 opcode) /* MOVE.L Dn,(xxx).W */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9931,9 +13155,14 @@ void REGPARAM2 CPUFUNC(op_21c8_0)(uae_u32 opcode) /* MOVE.L An,(xxx).W */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -9949,9 +13178,14 @@ void REGPARAM2 CPUFUNC(op_21d0_0)(uae_u32 opcode) /* MOVE.L (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9968,9 +13202,14 @@ void REGPARAM2 CPUFUNC(op_21d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(xxx).W */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -9987,9 +13226,14 @@ void REGPARAM2 CPUFUNC(op_21e0_0)(uae_u32 opcode) /* MOVE.L -(An),(xxx).W */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10005,9 +13249,14 @@ void REGPARAM2 CPUFUNC(op_21e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10024,9 +13273,14 @@ void REGPARAM2 CPUFUNC(op_21f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -10037,9 +13291,14 @@ void REGPARAM2 CPUFUNC(op_21f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10050,9 +13309,14 @@ void REGPARAM2 CPUFUNC(op_21f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10064,9 +13328,14 @@ void REGPARAM2 CPUFUNC(op_21fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10079,9 +13348,14 @@ void REGPARAM2 CPUFUNC(op_21fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -10091,9 +13365,14 @@ void REGPARAM2 CPUFUNC(op_21fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(xxx).W */
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -10108,9 +13387,14 @@ void REGPARAM2 CPUFUNC(op_23c0_0)(uae_u32 opcode) /* MOVE.L Dn,(xxx).L */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -10125,9 +13409,14 @@ void REGPARAM2 CPUFUNC(op_23c8_0)(uae_u32 opcode) /* MOVE.L An,(xxx).L */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -10143,9 +13432,14 @@ void REGPARAM2 CPUFUNC(op_23d0_0)(uae_u32 opcode) /* MOVE.L (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10162,9 +13456,14 @@ void REGPARAM2 CPUFUNC(op_23d8_0)(uae_u32 opcode) /* MOVE.L (An)+,(xxx).L */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10181,9 +13480,14 @@ void REGPARAM2 CPUFUNC(op_23e0_0)(uae_u32 opcode) /* MOVE.L -(An),(xxx).L */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10199,9 +13503,14 @@ void REGPARAM2 CPUFUNC(op_23e8_0)(uae_u32 opcode) /* MOVE.L (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10218,9 +13527,14 @@ void REGPARAM2 CPUFUNC(op_23f0_0)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -10231,9 +13545,14 @@ void REGPARAM2 CPUFUNC(op_23f8_0)(uae_u32 opcode) /* MOVE.L (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10244,9 +13563,14 @@ void REGPARAM2 CPUFUNC(op_23f9_0)(uae_u32 opcode) /* MOVE.L (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -10258,9 +13582,14 @@ void REGPARAM2 CPUFUNC(op_23fa_0)(uae_u32 opcode) /* MOVE.L (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -10273,9 +13602,14 @@ void REGPARAM2 CPUFUNC(op_23fb_0)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -10285,9 +13619,14 @@ void REGPARAM2 CPUFUNC(op_23fc_0)(uae_u32 opcode) /* MOVE.L #<data>.L,(xxx).L */
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(10);
 	cpuop_end();
@@ -10306,9 +13645,14 @@ void REGPARAM2 CPUFUNC(op_3000_0)(uae_u32 opcode) /* MOVE.W Dn,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10327,9 +13671,14 @@ void REGPARAM2 CPUFUNC(op_3008_0)(uae_u32 opcode) /* MOVE.W An,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10349,9 +13698,14 @@ void REGPARAM2 CPUFUNC(op_3010_0)(uae_u32 opcode) /* MOVE.W (An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10372,9 +13726,14 @@ void REGPARAM2 CPUFUNC(op_3018_0)(uae_u32 opcode) /* MOVE.W (An)+,Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10395,9 +13754,14 @@ void REGPARAM2 CPUFUNC(op_3020_0)(uae_u32 opcode) /* MOVE.W -(An),Dn */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10417,9 +13781,14 @@ void REGPARAM2 CPUFUNC(op_3028_0)(uae_u32 opcode) /* MOVE.W (d16,An),Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10440,9 +13809,14 @@ void REGPARAM2 CPUFUNC(op_3030_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),Dn */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -10456,9 +13830,14 @@ void REGPARAM2 CPUFUNC(op_3038_0)(uae_u32 opcode) /* MOVE.W (xxx).W,Dn */
 #endif
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10473,9 +13852,14 @@ void REGPARAM2 CPUFUNC(op_3039_0)(uae_u32 opcode) /* MOVE.W (xxx).L,Dn */
 #endif
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10491,9 +13875,14 @@ void REGPARAM2 CPUFUNC(op_303a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),Dn */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10510,9 +13899,14 @@ void REGPARAM2 CPUFUNC(op_303b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),Dn */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -10525,9 +13919,14 @@ void REGPARAM2 CPUFUNC(op_303c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = get_iword(2);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -10799,9 +14198,14 @@ void REGPARAM2 CPUFUNC(op_3080_0)(uae_u32 opcode) /* MOVE.W Dn,(An) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10821,9 +14225,14 @@ void REGPARAM2 CPUFUNC(op_3088_0)(uae_u32 opcode) /* MOVE.W An,(An) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -10844,9 +14253,14 @@ void REGPARAM2 CPUFUNC(op_3090_0)(uae_u32 opcode) /* MOVE.W (An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10868,9 +14282,14 @@ void REGPARAM2 CPUFUNC(op_3098_0)(uae_u32 opcode) /* MOVE.W (An)+,(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10892,9 +14311,14 @@ void REGPARAM2 CPUFUNC(op_30a0_0)(uae_u32 opcode) /* MOVE.W -(An),(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -10915,9 +14339,14 @@ void REGPARAM2 CPUFUNC(op_30a8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10939,9 +14368,14 @@ void REGPARAM2 CPUFUNC(op_30b0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -10956,9 +14390,14 @@ void REGPARAM2 CPUFUNC(op_30b8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -10974,9 +14413,14 @@ void REGPARAM2 CPUFUNC(op_30b9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -10993,9 +14437,14 @@ void REGPARAM2 CPUFUNC(op_30ba_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11013,9 +14462,14 @@ void REGPARAM2 CPUFUNC(op_30bb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11029,9 +14483,14 @@ void REGPARAM2 CPUFUNC(op_30bc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(An) */
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11052,13 +14511,52 @@ void REGPARAM2 CPUFUNC(op_30c0_0)(uae_u32 opcode) /* MOVE.W Dn,(An)+ */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_30c0_0_fuse)(uae_u32 opcode) /* MOVE.W Dn,(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_30c8_0)(uae_u32 opcode) /* MOVE.W An,(An)+ */
 {
 	cpuop_begin();
@@ -11075,9 +14573,14 @@ void REGPARAM2 CPUFUNC(op_30c8_0)(uae_u32 opcode) /* MOVE.W An,(An)+ */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11099,13 +14602,53 @@ void REGPARAM2 CPUFUNC(op_30d0_0)(uae_u32 opcode) /* MOVE.W (An),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_30d0_0_fuse)(uae_u32 opcode) /* MOVE.W (An),(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_30d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(An)+ */
 {
 	cpuop_begin();
@@ -11124,13 +14667,54 @@ void REGPARAM2 CPUFUNC(op_30d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(An)+ */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_30d8_0_fuse)(uae_u32 opcode) /* MOVE.W (An)+,(An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_30e0_0)(uae_u32 opcode) /* MOVE.W -(An),(An)+ */
 {
 	cpuop_begin();
@@ -11149,9 +14733,14 @@ void REGPARAM2 CPUFUNC(op_30e0_0)(uae_u32 opcode) /* MOVE.W -(An),(An)+ */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11173,9 +14762,14 @@ void REGPARAM2 CPUFUNC(op_30e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11198,9 +14792,14 @@ void REGPARAM2 CPUFUNC(op_30f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11216,9 +14815,14 @@ void REGPARAM2 CPUFUNC(op_30f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11235,9 +14839,14 @@ void REGPARAM2 CPUFUNC(op_30f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11255,9 +14864,14 @@ void REGPARAM2 CPUFUNC(op_30fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11276,9 +14890,14 @@ void REGPARAM2 CPUFUNC(op_30fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11293,9 +14912,14 @@ void REGPARAM2 CPUFUNC(op_30fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(An)+ */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11316,9 +14940,14 @@ void REGPARAM2 CPUFUNC(op_3100_0)(uae_u32 opcode) /* MOVE.W Dn,-(An) */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11339,9 +14968,14 @@ void REGPARAM2 CPUFUNC(op_3108_0)(uae_u32 opcode) /* MOVE.W An,-(An) */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -11363,9 +14997,14 @@ void REGPARAM2 CPUFUNC(op_3110_0)(uae_u32 opcode) /* MOVE.W (An),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11388,9 +15027,14 @@ void REGPARAM2 CPUFUNC(op_3118_0)(uae_u32 opcode) /* MOVE.W (An)+,-(An) */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11413,9 +15057,14 @@ void REGPARAM2 CPUFUNC(op_3120_0)(uae_u32 opcode) /* MOVE.W -(An),-(An) */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -11437,9 +15086,14 @@ void REGPARAM2 CPUFUNC(op_3128_0)(uae_u32 opcode) /* MOVE.W (d16,An),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11462,9 +15116,14 @@ void REGPARAM2 CPUFUNC(op_3130_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11480,9 +15139,14 @@ void REGPARAM2 CPUFUNC(op_3138_0)(uae_u32 opcode) /* MOVE.W (xxx).W,-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11499,9 +15163,14 @@ void REGPARAM2 CPUFUNC(op_3139_0)(uae_u32 opcode) /* MOVE.W (xxx).L,-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11519,9 +15188,14 @@ void REGPARAM2 CPUFUNC(op_313a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11540,9 +15214,14 @@ void REGPARAM2 CPUFUNC(op_313b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11557,9 +15236,14 @@ void REGPARAM2 CPUFUNC(op_313c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,-(An) */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11579,9 +15263,14 @@ void REGPARAM2 CPUFUNC(op_3140_0)(uae_u32 opcode) /* MOVE.W Dn,(d16,An) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11601,9 +15290,14 @@ void REGPARAM2 CPUFUNC(op_3148_0)(uae_u32 opcode) /* MOVE.W An,(d16,An) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -11624,9 +15318,14 @@ void REGPARAM2 CPUFUNC(op_3150_0)(uae_u32 opcode) /* MOVE.W (An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11648,9 +15347,14 @@ void REGPARAM2 CPUFUNC(op_3158_0)(uae_u32 opcode) /* MOVE.W (An)+,(d16,An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11672,9 +15376,14 @@ void REGPARAM2 CPUFUNC(op_3160_0)(uae_u32 opcode) /* MOVE.W -(An),(d16,An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -11695,9 +15404,14 @@ void REGPARAM2 CPUFUNC(op_3168_0)(uae_u32 opcode) /* MOVE.W (d16,An),(d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11719,9 +15433,14 @@ void REGPARAM2 CPUFUNC(op_3170_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d16,An)
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -11737,9 +15456,14 @@ void REGPARAM2 CPUFUNC(op_3178_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(d16,An) */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11755,9 +15479,14 @@ void REGPARAM2 CPUFUNC(op_3179_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(d16,An) */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -11774,9 +15503,14 @@ void REGPARAM2 CPUFUNC(op_317a_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(d16,An) */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -11794,9 +15528,14 @@ void REGPARAM2 CPUFUNC(op_317b_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -11811,9 +15550,14 @@ void REGPARAM2 CPUFUNC(op_317c_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(d16,An) *
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -11834,9 +15578,14 @@ void REGPARAM2 CPUFUNC(op_3180_0)(uae_u32 opcode) /* MOVE.W Dn,(d8,An,Xn) */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -11856,9 +15605,14 @@ void REGPARAM2 CPUFUNC(op_3188_0)(uae_u32 opcode) /* MOVE.W An,(d8,An,Xn) */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -11879,9 +15633,14 @@ void REGPARAM2 CPUFUNC(op_3190_0)(uae_u32 opcode) /* MOVE.W (An),(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11903,9 +15662,14 @@ void REGPARAM2 CPUFUNC(op_3198_0)(uae_u32 opcode) /* MOVE.W (An)+,(d8,An,Xn) */
 	m68k_areg(regs, srcreg) += 2;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11927,9 +15691,14 @@ void REGPARAM2 CPUFUNC(op_31a0_0)(uae_u32 opcode) /* MOVE.W -(An),(d8,An,Xn) */
 	m68k_areg (regs, srcreg) = srca;
 {m68k_incpc(2);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11950,9 +15719,14 @@ void REGPARAM2 CPUFUNC(op_31a8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(d8,An,Xn)
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -11973,9 +15747,14 @@ void REGPARAM2 CPUFUNC(op_31b0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d8,An,Xn
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -11991,9 +15770,14 @@ void REGPARAM2 CPUFUNC(op_31b8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(d8,An,Xn) *
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12009,9 +15793,14 @@ void REGPARAM2 CPUFUNC(op_31b9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(d8,An,Xn) *
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(6);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12028,9 +15817,14 @@ void REGPARAM2 CPUFUNC(op_31ba_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(d8,An,Xn)
 {	uae_s16 src = get_word(srca);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -12047,9 +15841,14 @@ void REGPARAM2 CPUFUNC(op_31bb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}}	cpuop_end();
 }
@@ -12064,9 +15863,14 @@ void REGPARAM2 CPUFUNC(op_31bc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(d8,An,Xn)
 {{	uae_s16 src = get_iword(2);
 {m68k_incpc(4);
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}	cpuop_end();
 }
@@ -12080,9 +15884,14 @@ void REGPARAM2 CPUFUNC(op_31c0_0)(uae_u32 opcode) /* MOVE.W Dn,(xxx).W */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -12097,9 +15906,14 @@ void REGPARAM2 CPUFUNC(op_31c8_0)(uae_u32 opcode) /* MOVE.W An,(xxx).W */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -12115,9 +15929,14 @@ void REGPARAM2 CPUFUNC(op_31d0_0)(uae_u32 opcode) /* MOVE.W (An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12134,9 +15953,14 @@ void REGPARAM2 CPUFUNC(op_31d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(xxx).W */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12153,9 +15977,14 @@ void REGPARAM2 CPUFUNC(op_31e0_0)(uae_u32 opcode) /* MOVE.W -(An),(xxx).W */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -12171,9 +16000,14 @@ void REGPARAM2 CPUFUNC(op_31e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(xxx).W */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12190,9 +16024,14 @@ void REGPARAM2 CPUFUNC(op_31f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).W *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -12203,9 +16042,14 @@ void REGPARAM2 CPUFUNC(op_31f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12216,9 +16060,14 @@ void REGPARAM2 CPUFUNC(op_31f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(xxx).W */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12230,9 +16079,14 @@ void REGPARAM2 CPUFUNC(op_31fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(xxx).W */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12245,9 +16099,14 @@ void REGPARAM2 CPUFUNC(op_31fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -12257,9 +16116,14 @@ void REGPARAM2 CPUFUNC(op_31fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(xxx).W */
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12274,9 +16138,14 @@ void REGPARAM2 CPUFUNC(op_33c0_0)(uae_u32 opcode) /* MOVE.W Dn,(xxx).L */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12291,9 +16160,14 @@ void REGPARAM2 CPUFUNC(op_33c8_0)(uae_u32 opcode) /* MOVE.W An,(xxx).L */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -12309,9 +16183,14 @@ void REGPARAM2 CPUFUNC(op_33d0_0)(uae_u32 opcode) /* MOVE.W (An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12328,9 +16207,14 @@ void REGPARAM2 CPUFUNC(op_33d8_0)(uae_u32 opcode) /* MOVE.W (An)+,(xxx).L */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12347,9 +16231,14 @@ void REGPARAM2 CPUFUNC(op_33e0_0)(uae_u32 opcode) /* MOVE.W -(An),(xxx).L */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -12365,9 +16254,14 @@ void REGPARAM2 CPUFUNC(op_33e8_0)(uae_u32 opcode) /* MOVE.W (d16,An),(xxx).L */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12384,9 +16278,14 @@ void REGPARAM2 CPUFUNC(op_33f0_0)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).L *
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -12397,9 +16296,14 @@ void REGPARAM2 CPUFUNC(op_33f8_0)(uae_u32 opcode) /* MOVE.W (xxx).W,(xxx).L */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12410,9 +16314,14 @@ void REGPARAM2 CPUFUNC(op_33f9_0)(uae_u32 opcode) /* MOVE.W (xxx).L,(xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(6);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(10);
 	cpuop_end();
@@ -12424,9 +16333,14 @@ void REGPARAM2 CPUFUNC(op_33fa_0)(uae_u32 opcode) /* MOVE.W (d16,PC),(xxx).L */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -12439,9 +16353,14 @@ void REGPARAM2 CPUFUNC(op_33fb_0)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(0);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -12451,9 +16370,14 @@ void REGPARAM2 CPUFUNC(op_33fc_0)(uae_u32 opcode) /* MOVE.W #<data>.W,(xxx).L */
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -12992,11 +16916,11 @@ void REGPARAM2 CPUFUNC(op_40c0_0)(uae_u32 opcode) /* MVSR2.W Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel645; }
+{if (!regs.s) { op_exception(8,0); goto endlabel706; }
 {{	MakeSR();
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((regs.sr) & 0xffff);
 }}}m68k_incpc(2);
-endlabel645: ;
+endlabel706: ;
 	cpuop_end();
 }
 
@@ -13010,12 +16934,12 @@ void REGPARAM2 CPUFUNC(op_40d0_0)(uae_u32 opcode) /* MVSR2.W (An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel646; }
+{if (!regs.s) { op_exception(8,0); goto endlabel707; }
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	MakeSR();
 	put_word(srca,regs.sr);
 }}}m68k_incpc(2);
-endlabel646: ;
+endlabel707: ;
 	cpuop_end();
 }
 
@@ -13029,13 +16953,13 @@ void REGPARAM2 CPUFUNC(op_40d8_0)(uae_u32 opcode) /* MVSR2.W (An)+ */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel647; }
+{if (!regs.s) { op_exception(8,0); goto endlabel708; }
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 2;
 	MakeSR();
 	put_word(srca,regs.sr);
 }}}m68k_incpc(2);
-endlabel647: ;
+endlabel708: ;
 	cpuop_end();
 }
 
@@ -13049,13 +16973,13 @@ void REGPARAM2 CPUFUNC(op_40e0_0)(uae_u32 opcode) /* MVSR2.W -(An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel648; }
+{if (!regs.s) { op_exception(8,0); goto endlabel709; }
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
 	MakeSR();
 	put_word(srca,regs.sr);
 }}}m68k_incpc(2);
-endlabel648: ;
+endlabel709: ;
 	cpuop_end();
 }
 
@@ -13069,12 +16993,12 @@ void REGPARAM2 CPUFUNC(op_40e8_0)(uae_u32 opcode) /* MVSR2.W (d16,An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel649; }
+{if (!regs.s) { op_exception(8,0); goto endlabel710; }
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 	MakeSR();
 	put_word(srca,regs.sr);
 }}}m68k_incpc(4);
-endlabel649: ;
+endlabel710: ;
 	cpuop_end();
 }
 
@@ -13088,12 +17012,12 @@ void REGPARAM2 CPUFUNC(op_40f0_0)(uae_u32 opcode) /* MVSR2.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel650; }
+{if (!regs.s) { op_exception(8,0); goto endlabel711; }
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 	MakeSR();
 	put_word(srca,regs.sr);
-}}}}endlabel650: ;
+}}}}endlabel711: ;
 	cpuop_end();
 }
 
@@ -13102,12 +17026,12 @@ void REGPARAM2 CPUFUNC(op_40f0_0)(uae_u32 opcode) /* MVSR2.W (d8,An,Xn) */
 void REGPARAM2 CPUFUNC(op_40f8_0)(uae_u32 opcode) /* MVSR2.W (xxx).W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel651; }
+{if (!regs.s) { op_exception(8,0); goto endlabel712; }
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	MakeSR();
 	put_word(srca,regs.sr);
 }}}m68k_incpc(4);
-endlabel651: ;
+endlabel712: ;
 	cpuop_end();
 }
 
@@ -13116,12 +17040,12 @@ endlabel651: ;
 void REGPARAM2 CPUFUNC(op_40f9_0)(uae_u32 opcode) /* MVSR2.W (xxx).L */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel652; }
+{if (!regs.s) { op_exception(8,0); goto endlabel713; }
 {{	uaecptr srca = get_ilong(2);
 	MakeSR();
 	put_word(srca,regs.sr);
 }}}m68k_incpc(6);
-endlabel652: ;
+endlabel713: ;
 	cpuop_end();
 }
 
@@ -13142,10 +17066,10 @@ void REGPARAM2 CPUFUNC(op_4100_0)(uae_u32 opcode) /* CHK.L Dn,Dn */
 {	uaecptr oldpc = m68k_getpc();
 {	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel653; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel653; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel714; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel714; }
 }}}m68k_incpc(2);
-endlabel653: ;
+endlabel714: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4110_0)(uae_u32 opcode) /* CHK.L (An),Dn */
@@ -13165,10 +17089,10 @@ void REGPARAM2 CPUFUNC(op_4110_0)(uae_u32 opcode) /* CHK.L (An),Dn */
 {	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel654; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel654; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel715; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel715; }
 }}}}m68k_incpc(2);
-endlabel654: ;
+endlabel715: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4118_0)(uae_u32 opcode) /* CHK.L (An)+,Dn */
@@ -13189,10 +17113,10 @@ void REGPARAM2 CPUFUNC(op_4118_0)(uae_u32 opcode) /* CHK.L (An)+,Dn */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel655; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel655; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel716; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel716; }
 }}}}m68k_incpc(2);
-endlabel655: ;
+endlabel716: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4120_0)(uae_u32 opcode) /* CHK.L -(An),Dn */
@@ -13213,10 +17137,10 @@ void REGPARAM2 CPUFUNC(op_4120_0)(uae_u32 opcode) /* CHK.L -(An),Dn */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel656; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel656; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel717; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel717; }
 }}}}m68k_incpc(2);
-endlabel656: ;
+endlabel717: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4128_0)(uae_u32 opcode) /* CHK.L (d16,An),Dn */
@@ -13236,10 +17160,10 @@ void REGPARAM2 CPUFUNC(op_4128_0)(uae_u32 opcode) /* CHK.L (d16,An),Dn */
 {	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel657; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel657; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel718; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel718; }
 }}}}m68k_incpc(4);
-endlabel657: ;
+endlabel718: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4130_0)(uae_u32 opcode) /* CHK.L (d8,An,Xn),Dn */
@@ -13260,9 +17184,9 @@ void REGPARAM2 CPUFUNC(op_4130_0)(uae_u32 opcode) /* CHK.L (d8,An,Xn),Dn */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel658; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel658; }
-}}}}}endlabel658: ;
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel719; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel719; }
+}}}}}endlabel719: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4138_0)(uae_u32 opcode) /* CHK.L (xxx).W,Dn */
@@ -13277,10 +17201,10 @@ void REGPARAM2 CPUFUNC(op_4138_0)(uae_u32 opcode) /* CHK.L (xxx).W,Dn */
 {	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel659; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel659; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel720; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel720; }
 }}}}m68k_incpc(4);
-endlabel659: ;
+endlabel720: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4139_0)(uae_u32 opcode) /* CHK.L (xxx).L,Dn */
@@ -13295,10 +17219,10 @@ void REGPARAM2 CPUFUNC(op_4139_0)(uae_u32 opcode) /* CHK.L (xxx).L,Dn */
 {	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel660; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel660; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel721; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel721; }
 }}}}m68k_incpc(6);
-endlabel660: ;
+endlabel721: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_413a_0)(uae_u32 opcode) /* CHK.L (d16,PC),Dn */
@@ -13314,10 +17238,10 @@ void REGPARAM2 CPUFUNC(op_413a_0)(uae_u32 opcode) /* CHK.L (d16,PC),Dn */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel661; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel661; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel722; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel722; }
 }}}}m68k_incpc(4);
-endlabel661: ;
+endlabel722: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_413b_0)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
@@ -13334,9 +17258,9 @@ void REGPARAM2 CPUFUNC(op_413b_0)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel662; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel662; }
-}}}}}endlabel662: ;
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel723; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel723; }
+}}}}}endlabel723: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_413c_0)(uae_u32 opcode) /* CHK.L #<data>.L,Dn */
@@ -13350,10 +17274,10 @@ void REGPARAM2 CPUFUNC(op_413c_0)(uae_u32 opcode) /* CHK.L #<data>.L,Dn */
 {	uaecptr oldpc = m68k_getpc();
 {	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel663; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel663; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel724; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel724; }
 }}}m68k_incpc(6);
-endlabel663: ;
+endlabel724: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4180_0)(uae_u32 opcode) /* CHK.W Dn,Dn */
@@ -13372,10 +17296,10 @@ void REGPARAM2 CPUFUNC(op_4180_0)(uae_u32 opcode) /* CHK.W Dn,Dn */
 {	uaecptr oldpc = m68k_getpc();
 {	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel664; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel664; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel725; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel725; }
 }}}m68k_incpc(2);
-endlabel664: ;
+endlabel725: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4190_0)(uae_u32 opcode) /* CHK.W (An),Dn */
@@ -13395,10 +17319,10 @@ void REGPARAM2 CPUFUNC(op_4190_0)(uae_u32 opcode) /* CHK.W (An),Dn */
 {	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel665; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel665; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel726; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel726; }
 }}}}m68k_incpc(2);
-endlabel665: ;
+endlabel726: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4198_0)(uae_u32 opcode) /* CHK.W (An)+,Dn */
@@ -13419,10 +17343,10 @@ void REGPARAM2 CPUFUNC(op_4198_0)(uae_u32 opcode) /* CHK.W (An)+,Dn */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel666; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel666; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel727; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel727; }
 }}}}m68k_incpc(2);
-endlabel666: ;
+endlabel727: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41a0_0)(uae_u32 opcode) /* CHK.W -(An),Dn */
@@ -13443,10 +17367,10 @@ void REGPARAM2 CPUFUNC(op_41a0_0)(uae_u32 opcode) /* CHK.W -(An),Dn */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel667; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel667; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel728; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel728; }
 }}}}m68k_incpc(2);
-endlabel667: ;
+endlabel728: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41a8_0)(uae_u32 opcode) /* CHK.W (d16,An),Dn */
@@ -13466,10 +17390,10 @@ void REGPARAM2 CPUFUNC(op_41a8_0)(uae_u32 opcode) /* CHK.W (d16,An),Dn */
 {	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel668; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel668; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel729; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel729; }
 }}}}m68k_incpc(4);
-endlabel668: ;
+endlabel729: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41b0_0)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
@@ -13490,9 +17414,9 @@ void REGPARAM2 CPUFUNC(op_41b0_0)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel669; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel669; }
-}}}}}endlabel669: ;
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel730; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel730; }
+}}}}}endlabel730: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41b8_0)(uae_u32 opcode) /* CHK.W (xxx).W,Dn */
@@ -13507,10 +17431,10 @@ void REGPARAM2 CPUFUNC(op_41b8_0)(uae_u32 opcode) /* CHK.W (xxx).W,Dn */
 {	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel670; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel670; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel731; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel731; }
 }}}}m68k_incpc(4);
-endlabel670: ;
+endlabel731: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41b9_0)(uae_u32 opcode) /* CHK.W (xxx).L,Dn */
@@ -13525,10 +17449,10 @@ void REGPARAM2 CPUFUNC(op_41b9_0)(uae_u32 opcode) /* CHK.W (xxx).L,Dn */
 {	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel671; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel671; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel732; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel732; }
 }}}}m68k_incpc(6);
-endlabel671: ;
+endlabel732: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41ba_0)(uae_u32 opcode) /* CHK.W (d16,PC),Dn */
@@ -13544,10 +17468,10 @@ void REGPARAM2 CPUFUNC(op_41ba_0)(uae_u32 opcode) /* CHK.W (d16,PC),Dn */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel672; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel672; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel733; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel733; }
 }}}}m68k_incpc(4);
-endlabel672: ;
+endlabel733: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41bb_0)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
@@ -13564,9 +17488,9 @@ void REGPARAM2 CPUFUNC(op_41bb_0)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel673; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel673; }
-}}}}}endlabel673: ;
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel734; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel734; }
+}}}}}endlabel734: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41bc_0)(uae_u32 opcode) /* CHK.W #<data>.W,Dn */
@@ -13580,10 +17504,10 @@ void REGPARAM2 CPUFUNC(op_41bc_0)(uae_u32 opcode) /* CHK.W #<data>.W,Dn */
 {	uaecptr oldpc = m68k_getpc();
 {	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel674; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel674; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel735; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel735; }
 }}}m68k_incpc(4);
-endlabel674: ;
+endlabel735: ;
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -13723,9 +17647,14 @@ void REGPARAM2 CPUFUNC(op_4200_0)(uae_u32 opcode) /* CLR.B Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
+{{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13739,9 +17668,14 @@ void REGPARAM2 CPUFUNC(op_4210_0)(uae_u32 opcode) /* CLR.B (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13756,13 +17690,46 @@ void REGPARAM2 CPUFUNC(op_4218_0)(uae_u32 opcode) /* CLR.B (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4218_0_fuse)(uae_u32 opcode) /* CLR.B (An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
+	put_byte(srca,0);
+}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_4220_0)(uae_u32 opcode) /* CLR.B -(An) */
 {
 	cpuop_begin();
@@ -13773,9 +17740,14 @@ void REGPARAM2 CPUFUNC(op_4220_0)(uae_u32 opcode) /* CLR.B -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13789,9 +17761,14 @@ void REGPARAM2 CPUFUNC(op_4228_0)(uae_u32 opcode) /* CLR.B (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13806,9 +17783,14 @@ void REGPARAM2 CPUFUNC(op_4230_0)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	put_byte(srca,0);
 }}}	cpuop_end();
 }
@@ -13816,9 +17798,14 @@ void REGPARAM2 CPUFUNC(op_4238_0)(uae_u32 opcode) /* CLR.B (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13827,9 +17814,14 @@ void REGPARAM2 CPUFUNC(op_4239_0)(uae_u32 opcode) /* CLR.B (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -13842,9 +17834,14 @@ void REGPARAM2 CPUFUNC(op_4240_0)(uae_u32 opcode) /* CLR.W Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
+{{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13858,9 +17855,14 @@ void REGPARAM2 CPUFUNC(op_4250_0)(uae_u32 opcode) /* CLR.W (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	put_word(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13875,13 +17877,46 @@ void REGPARAM2 CPUFUNC(op_4258_0)(uae_u32 opcode) /* CLR.W (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
+	put_word(srca,0);
+}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4258_0_fuse)(uae_u32 opcode) /* CLR.W (An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	put_word(srca,0);
 }}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4260_0)(uae_u32 opcode) /* CLR.W -(An) */
 {
 	cpuop_begin();
@@ -13892,9 +17927,14 @@ void REGPARAM2 CPUFUNC(op_4260_0)(uae_u32 opcode) /* CLR.W -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	put_word(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13908,9 +17948,14 @@ void REGPARAM2 CPUFUNC(op_4268_0)(uae_u32 opcode) /* CLR.W (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13925,9 +17970,14 @@ void REGPARAM2 CPUFUNC(op_4270_0)(uae_u32 opcode) /* CLR.W (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	put_word(srca,0);
 }}}	cpuop_end();
 }
@@ -13935,9 +17985,14 @@ void REGPARAM2 CPUFUNC(op_4278_0)(uae_u32 opcode) /* CLR.W (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -13946,9 +18001,14 @@ void REGPARAM2 CPUFUNC(op_4279_0)(uae_u32 opcode) /* CLR.W (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	put_word(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -13961,9 +18021,14 @@ void REGPARAM2 CPUFUNC(op_4280_0)(uae_u32 opcode) /* CLR.L Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	CLEAR_CZNV;
+{{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13977,9 +18042,14 @@ void REGPARAM2 CPUFUNC(op_4290_0)(uae_u32 opcode) /* CLR.L (An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -13994,13 +18064,46 @@ void REGPARAM2 CPUFUNC(op_4298_0)(uae_u32 opcode) /* CLR.L (An)+ */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4298_0_fuse)(uae_u32 opcode) /* CLR.L (An)+ + DBcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
+	put_long(srca,0);
+}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
+	cpuop_end();
+}
+#endif
 #endif
 
 #ifdef PART_4
@@ -14014,9 +18117,14 @@ void REGPARAM2 CPUFUNC(op_42a0_0)(uae_u32 opcode) /* CLR.L -(An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	put_long(srca,0);
 }}m68k_incpc(2);
 	cpuop_end();
@@ -14030,9 +18138,14 @@ void REGPARAM2 CPUFUNC(op_42a8_0)(uae_u32 opcode) /* CLR.L (d16,An) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -14047,9 +18160,14 @@ void REGPARAM2 CPUFUNC(op_42b0_0)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
 #endif
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	put_long(srca,0);
 }}}	cpuop_end();
 }
@@ -14057,9 +18175,14 @@ void REGPARAM2 CPUFUNC(op_42b8_0)(uae_u32 opcode) /* CLR.L (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -14068,9 +18191,14 @@ void REGPARAM2 CPUFUNC(op_42b9_0)(uae_u32 opcode) /* CLR.L (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	put_long(srca,0);
 }}m68k_incpc(6);
 	cpuop_end();
@@ -14212,6 +18340,11 @@ void REGPARAM2 CPUFUNC(op_4400_0)(uae_u32 opcode) /* NEG.B Dn */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14220,6 +18353,7 @@ void REGPARAM2 CPUFUNC(op_4400_0)(uae_u32 opcode) /* NEG.B Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14235,6 +18369,11 @@ void REGPARAM2 CPUFUNC(op_4410_0)(uae_u32 opcode) /* NEG.B (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14243,6 +18382,7 @@ void REGPARAM2 CPUFUNC(op_4410_0)(uae_u32 opcode) /* NEG.B (An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14259,6 +18399,11 @@ void REGPARAM2 CPUFUNC(op_4418_0)(uae_u32 opcode) /* NEG.B (An)+ */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14267,6 +18412,7 @@ void REGPARAM2 CPUFUNC(op_4418_0)(uae_u32 opcode) /* NEG.B (An)+ */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14283,6 +18429,11 @@ void REGPARAM2 CPUFUNC(op_4420_0)(uae_u32 opcode) /* NEG.B -(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14291,6 +18442,7 @@ void REGPARAM2 CPUFUNC(op_4420_0)(uae_u32 opcode) /* NEG.B -(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14306,6 +18458,11 @@ void REGPARAM2 CPUFUNC(op_4428_0)(uae_u32 opcode) /* NEG.B (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14314,6 +18471,7 @@ void REGPARAM2 CPUFUNC(op_4428_0)(uae_u32 opcode) /* NEG.B (d16,An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -14330,6 +18488,11 @@ void REGPARAM2 CPUFUNC(op_4430_0)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14338,6 +18501,7 @@ void REGPARAM2 CPUFUNC(op_4430_0)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(srca,dst);
 }}}}}}}	cpuop_end();
 }
@@ -14347,6 +18511,11 @@ void REGPARAM2 CPUFUNC(op_4438_0)(uae_u32 opcode) /* NEG.B (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14355,6 +18524,7 @@ void REGPARAM2 CPUFUNC(op_4438_0)(uae_u32 opcode) /* NEG.B (xxx).W */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -14365,6 +18535,11 @@ void REGPARAM2 CPUFUNC(op_4439_0)(uae_u32 opcode) /* NEG.B (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -14373,6 +18548,7 @@ void REGPARAM2 CPUFUNC(op_4439_0)(uae_u32 opcode) /* NEG.B (xxx).L */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -14387,6 +18563,11 @@ void REGPARAM2 CPUFUNC(op_4440_0)(uae_u32 opcode) /* NEG.W Dn */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14395,6 +18576,7 @@ void REGPARAM2 CPUFUNC(op_4440_0)(uae_u32 opcode) /* NEG.W Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14410,6 +18592,11 @@ void REGPARAM2 CPUFUNC(op_4450_0)(uae_u32 opcode) /* NEG.W (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14418,6 +18605,7 @@ void REGPARAM2 CPUFUNC(op_4450_0)(uae_u32 opcode) /* NEG.W (An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14434,6 +18622,11 @@ void REGPARAM2 CPUFUNC(op_4458_0)(uae_u32 opcode) /* NEG.W (An)+ */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14442,6 +18635,7 @@ void REGPARAM2 CPUFUNC(op_4458_0)(uae_u32 opcode) /* NEG.W (An)+ */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14458,6 +18652,11 @@ void REGPARAM2 CPUFUNC(op_4460_0)(uae_u32 opcode) /* NEG.W -(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14466,6 +18665,7 @@ void REGPARAM2 CPUFUNC(op_4460_0)(uae_u32 opcode) /* NEG.W -(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14481,6 +18681,11 @@ void REGPARAM2 CPUFUNC(op_4468_0)(uae_u32 opcode) /* NEG.W (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14489,6 +18694,7 @@ void REGPARAM2 CPUFUNC(op_4468_0)(uae_u32 opcode) /* NEG.W (d16,An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -14505,6 +18711,11 @@ void REGPARAM2 CPUFUNC(op_4470_0)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14513,6 +18724,7 @@ void REGPARAM2 CPUFUNC(op_4470_0)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(srca,dst);
 }}}}}}}	cpuop_end();
 }
@@ -14522,6 +18734,11 @@ void REGPARAM2 CPUFUNC(op_4478_0)(uae_u32 opcode) /* NEG.W (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14530,6 +18747,7 @@ void REGPARAM2 CPUFUNC(op_4478_0)(uae_u32 opcode) /* NEG.W (xxx).W */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -14540,6 +18758,11 @@ void REGPARAM2 CPUFUNC(op_4479_0)(uae_u32 opcode) /* NEG.W (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -14548,6 +18771,7 @@ void REGPARAM2 CPUFUNC(op_4479_0)(uae_u32 opcode) /* NEG.W (xxx).L */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(srca,dst);
 }}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -14562,6 +18786,11 @@ void REGPARAM2 CPUFUNC(op_4480_0)(uae_u32 opcode) /* NEG.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14570,6 +18799,7 @@ void REGPARAM2 CPUFUNC(op_4480_0)(uae_u32 opcode) /* NEG.L Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14585,6 +18815,11 @@ void REGPARAM2 CPUFUNC(op_4490_0)(uae_u32 opcode) /* NEG.L (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14593,6 +18828,7 @@ void REGPARAM2 CPUFUNC(op_4490_0)(uae_u32 opcode) /* NEG.L (An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14609,6 +18845,11 @@ void REGPARAM2 CPUFUNC(op_4498_0)(uae_u32 opcode) /* NEG.L (An)+ */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14617,6 +18858,7 @@ void REGPARAM2 CPUFUNC(op_4498_0)(uae_u32 opcode) /* NEG.L (An)+ */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14633,6 +18875,11 @@ void REGPARAM2 CPUFUNC(op_44a0_0)(uae_u32 opcode) /* NEG.L -(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14641,6 +18888,7 @@ void REGPARAM2 CPUFUNC(op_44a0_0)(uae_u32 opcode) /* NEG.L -(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(srca,dst);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -14656,6 +18904,11 @@ void REGPARAM2 CPUFUNC(op_44a8_0)(uae_u32 opcode) /* NEG.L (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14664,6 +18917,7 @@ void REGPARAM2 CPUFUNC(op_44a8_0)(uae_u32 opcode) /* NEG.L (d16,An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -14680,6 +18934,11 @@ void REGPARAM2 CPUFUNC(op_44b0_0)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14688,6 +18947,7 @@ void REGPARAM2 CPUFUNC(op_44b0_0)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(srca,dst);
 }}}}}}}	cpuop_end();
 }
@@ -14697,6 +18957,11 @@ void REGPARAM2 CPUFUNC(op_44b8_0)(uae_u32 opcode) /* NEG.L (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14705,6 +18970,7 @@ void REGPARAM2 CPUFUNC(op_44b8_0)(uae_u32 opcode) /* NEG.L (xxx).W */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -14715,6 +18981,11 @@ void REGPARAM2 CPUFUNC(op_44b9_0)(uae_u32 opcode) /* NEG.L (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -14723,6 +18994,7 @@ void REGPARAM2 CPUFUNC(op_44b9_0)(uae_u32 opcode) /* NEG.L (xxx).L */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(srca,dst);
 }}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -14901,9 +19173,14 @@ void REGPARAM2 CPUFUNC(op_4600_0)(uae_u32 opcode) /* NOT.B Dn */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -14919,9 +19196,14 @@ void REGPARAM2 CPUFUNC(op_4610_0)(uae_u32 opcode) /* NOT.B (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14938,9 +19220,14 @@ void REGPARAM2 CPUFUNC(op_4618_0)(uae_u32 opcode) /* NOT.B (An)+ */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14957,9 +19244,14 @@ void REGPARAM2 CPUFUNC(op_4620_0)(uae_u32 opcode) /* NOT.B -(An) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -14975,9 +19267,14 @@ void REGPARAM2 CPUFUNC(op_4628_0)(uae_u32 opcode) /* NOT.B (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -14994,9 +19291,14 @@ void REGPARAM2 CPUFUNC(op_4630_0)(uae_u32 opcode) /* NOT.B (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	put_byte(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15006,9 +19308,14 @@ void REGPARAM2 CPUFUNC(op_4638_0)(uae_u32 opcode) /* NOT.B (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15019,9 +19326,14 @@ void REGPARAM2 CPUFUNC(op_4639_0)(uae_u32 opcode) /* NOT.B (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15036,9 +19348,14 @@ void REGPARAM2 CPUFUNC(op_4640_0)(uae_u32 opcode) /* NOT.W Dn */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15054,9 +19371,14 @@ void REGPARAM2 CPUFUNC(op_4650_0)(uae_u32 opcode) /* NOT.W (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15073,9 +19395,14 @@ void REGPARAM2 CPUFUNC(op_4658_0)(uae_u32 opcode) /* NOT.W (An)+ */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15092,9 +19419,14 @@ void REGPARAM2 CPUFUNC(op_4660_0)(uae_u32 opcode) /* NOT.W -(An) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15110,9 +19442,14 @@ void REGPARAM2 CPUFUNC(op_4668_0)(uae_u32 opcode) /* NOT.W (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15129,9 +19466,14 @@ void REGPARAM2 CPUFUNC(op_4670_0)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	put_word(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15141,9 +19483,14 @@ void REGPARAM2 CPUFUNC(op_4678_0)(uae_u32 opcode) /* NOT.W (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15154,9 +19501,14 @@ void REGPARAM2 CPUFUNC(op_4679_0)(uae_u32 opcode) /* NOT.W (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15171,9 +19523,14 @@ void REGPARAM2 CPUFUNC(op_4680_0)(uae_u32 opcode) /* NOT.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15189,9 +19546,14 @@ void REGPARAM2 CPUFUNC(op_4690_0)(uae_u32 opcode) /* NOT.L (An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15208,9 +19570,14 @@ void REGPARAM2 CPUFUNC(op_4698_0)(uae_u32 opcode) /* NOT.L (An)+ */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15227,9 +19594,14 @@ void REGPARAM2 CPUFUNC(op_46a0_0)(uae_u32 opcode) /* NOT.L -(An) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -15245,9 +19617,14 @@ void REGPARAM2 CPUFUNC(op_46a8_0)(uae_u32 opcode) /* NOT.L (d16,An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15264,9 +19641,14 @@ void REGPARAM2 CPUFUNC(op_46b0_0)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	put_long(srca,dst);
 }}}}}	cpuop_end();
 }
@@ -15276,9 +19658,14 @@ void REGPARAM2 CPUFUNC(op_46b8_0)(uae_u32 opcode) /* NOT.L (xxx).W */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -15289,9 +19676,14 @@ void REGPARAM2 CPUFUNC(op_46b9_0)(uae_u32 opcode) /* NOT.L (xxx).L */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -15304,12 +19696,12 @@ void REGPARAM2 CPUFUNC(op_46c0_0)(uae_u32 opcode) /* MV2SR.W Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel773; }
+{if (!regs.s) { op_exception(8,0); goto endlabel837; }
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 	regs.sr = src;
 	MakeFromSR();
 }}}m68k_incpc(2);
-endlabel773: ;
+endlabel837: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46d0_0)(uae_u32 opcode) /* MV2SR.W (An) */
@@ -15320,13 +19712,13 @@ void REGPARAM2 CPUFUNC(op_46d0_0)(uae_u32 opcode) /* MV2SR.W (An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel774; }
+{if (!regs.s) { op_exception(8,0); goto endlabel838; }
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(2);
-endlabel774: ;
+endlabel838: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46d8_0)(uae_u32 opcode) /* MV2SR.W (An)+ */
@@ -15337,14 +19729,14 @@ void REGPARAM2 CPUFUNC(op_46d8_0)(uae_u32 opcode) /* MV2SR.W (An)+ */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel775; }
+{if (!regs.s) { op_exception(8,0); goto endlabel839; }
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(2);
-endlabel775: ;
+endlabel839: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46e0_0)(uae_u32 opcode) /* MV2SR.W -(An) */
@@ -15355,14 +19747,14 @@ void REGPARAM2 CPUFUNC(op_46e0_0)(uae_u32 opcode) /* MV2SR.W -(An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel776; }
+{if (!regs.s) { op_exception(8,0); goto endlabel840; }
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(2);
-endlabel776: ;
+endlabel840: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46e8_0)(uae_u32 opcode) /* MV2SR.W (d16,An) */
@@ -15373,13 +19765,13 @@ void REGPARAM2 CPUFUNC(op_46e8_0)(uae_u32 opcode) /* MV2SR.W (d16,An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel777; }
+{if (!regs.s) { op_exception(8,0); goto endlabel841; }
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(4);
-endlabel777: ;
+endlabel841: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46f0_0)(uae_u32 opcode) /* MV2SR.W (d8,An,Xn) */
@@ -15390,74 +19782,74 @@ void REGPARAM2 CPUFUNC(op_46f0_0)(uae_u32 opcode) /* MV2SR.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel778; }
+{if (!regs.s) { op_exception(8,0); goto endlabel842; }
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
-}}}}}endlabel778: ;
+}}}}}endlabel842: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46f8_0)(uae_u32 opcode) /* MV2SR.W (xxx).W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel779; }
+{if (!regs.s) { op_exception(8,0); goto endlabel843; }
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(4);
-endlabel779: ;
+endlabel843: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46f9_0)(uae_u32 opcode) /* MV2SR.W (xxx).L */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel780; }
+{if (!regs.s) { op_exception(8,0); goto endlabel844; }
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(6);
-endlabel780: ;
+endlabel844: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46fa_0)(uae_u32 opcode) /* MV2SR.W (d16,PC) */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel781; }
+{if (!regs.s) { op_exception(8,0); goto endlabel845; }
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(4);
-endlabel781: ;
+endlabel845: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46fb_0)(uae_u32 opcode) /* MV2SR.W (d8,PC,Xn) */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel782; }
+{if (!regs.s) { op_exception(8,0); goto endlabel846; }
 {{m68k_incpc(2);
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
-}}}}}endlabel782: ;
+}}}}}endlabel846: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46fc_0)(uae_u32 opcode) /* MV2SR.W #<data>.W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel783; }
+{if (!regs.s) { op_exception(8,0); goto endlabel847; }
 {{	uae_s16 src = get_iword(2);
 	regs.sr = src;
 	MakeFromSR();
 }}}m68k_incpc(4);
-endlabel783: ;
+endlabel847: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4800_0)(uae_u32 opcode) /* NBCD.B Dn */
@@ -15682,9 +20074,14 @@ void REGPARAM2 CPUFUNC(op_4840_0)(uae_u32 opcode) /* SWAP.W Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15822,9 +20219,14 @@ void REGPARAM2 CPUFUNC(op_4880_0)(uae_u32 opcode) /* EXT.W Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15841,8 +20243,16 @@ void REGPARAM2 CPUFUNC(op_4890_0)(uae_u32 opcode) /* MVMLE.W #<data>.W,(An) */
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg);
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_word((uae_u16 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_word((uae_u16 *)m, m68k_areg(regs, movem_index1[amask])); m += 2; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -15860,8 +20270,17 @@ void REGPARAM2 CPUFUNC(op_48a0_0)(uae_u32 opcode) /* MVMLE.W #<data>.W,-(An) */
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg) - 0;
 {	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca - MOVEM_MAX_BYTES);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host + MOVEM_MAX_BYTES;
+	while (amask) { m -= 2; do_put_mem_word((uae_u16 *)m, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { m -= 2; do_put_mem_word((uae_u16 *)m, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	movem_put_done(m, movem_host + MOVEM_MAX_BYTES - m);
+	srca -= movem_host + MOVEM_MAX_BYTES - m;
+	} else {
 	while (amask) { srca -= 2; put_word(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
 	while (dmask) { srca -= 2; put_word(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	}
 	m68k_areg(regs, dstreg) = srca;
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -15880,8 +20299,16 @@ void REGPARAM2 CPUFUNC(op_48a8_0)(uae_u32 opcode) /* MVMLE.W #<data>.W,(d16,An)
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_word((uae_u16 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_word((uae_u16 *)m, m68k_areg(regs, movem_index1[amask])); m += 2; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -15900,8 +20327,16 @@ void REGPARAM2 CPUFUNC(op_48b0_0)(uae_u32 opcode) /* MVMLE.W #<data>.W,(d8,An,Xn
 {m68k_incpc(4);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_word((uae_u16 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_word((uae_u16 *)m, m68k_areg(regs, movem_index1[amask])); m += 2; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	}
 }}}}	cpuop_end();
 }
 
@@ -15913,8 +20348,16 @@ void REGPARAM2 CPUFUNC(op_48b8_0)(uae_u32 opcode) /* MVMLE.W #<data>.W,(xxx).W *
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_word((uae_u16 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_word((uae_u16 *)m, m68k_areg(regs, movem_index1[amask])); m += 2; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -15927,8 +20370,16 @@ void REGPARAM2 CPUFUNC(op_48b9_0)(uae_u32 opcode) /* MVMLE.W #<data>.W,(xxx).L *
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = get_ilong(4);
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_word((uae_u16 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_word((uae_u16 *)m, m68k_areg(regs, movem_index1[amask])); m += 2; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(8);
 	cpuop_end();
 }
@@ -15944,9 +20395,14 @@ void REGPARAM2 CPUFUNC(op_48c0_0)(uae_u32 opcode) /* EXT.L Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -15963,8 +20419,16 @@ void REGPARAM2 CPUFUNC(op_48d0_0)(uae_u32 opcode) /* MVMLE.L #<data>.W,(An) */
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg);
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_long((uae_u32 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_long((uae_u32 *)m, m68k_areg(regs, movem_index1[amask])); m += 4; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -15982,8 +20446,17 @@ void REGPARAM2 CPUFUNC(op_48e0_0)(uae_u32 opcode) /* MVMLE.L #<data>.W,-(An) */
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg) - 0;
 {	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca - MOVEM_MAX_BYTES);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host + MOVEM_MAX_BYTES;
+	while (amask) { m -= 4; do_put_mem_long((uae_u32 *)m, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { m -= 4; do_put_mem_long((uae_u32 *)m, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	movem_put_done(m, movem_host + MOVEM_MAX_BYTES - m);
+	srca -= movem_host + MOVEM_MAX_BYTES - m;
+	} else {
 	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
 	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	}
 	m68k_areg(regs, dstreg) = srca;
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -16002,8 +20475,16 @@ void REGPARAM2 CPUFUNC(op_48e8_0)(uae_u32 opcode) /* MVMLE.L #<data>.W,(d16,An)
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_long((uae_u32 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_long((uae_u32 *)m, m68k_areg(regs, movem_index1[amask])); m += 4; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16022,8 +20503,16 @@ void REGPARAM2 CPUFUNC(op_48f0_0)(uae_u32 opcode) /* MVMLE.L #<data>.W,(d8,An,Xn
 {m68k_incpc(4);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_long((uae_u32 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_long((uae_u32 *)m, m68k_areg(regs, movem_index1[amask])); m += 4; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	}
 }}}}	cpuop_end();
 }
 
@@ -16035,8 +20524,16 @@ void REGPARAM2 CPUFUNC(op_48f8_0)(uae_u32 opcode) /* MVMLE.L #<data>.W,(xxx).W *
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_long((uae_u32 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_long((uae_u32 *)m, m68k_areg(regs, movem_index1[amask])); m += 4; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -16049,8 +20546,16 @@ void REGPARAM2 CPUFUNC(op_48f9_0)(uae_u32 opcode) /* MVMLE.L #<data>.W,(xxx).L *
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = get_ilong(4);
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_long((uae_u32 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_long((uae_u32 *)m, m68k_areg(regs, movem_index1[amask])); m += 4; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(8);
 	cpuop_end();
 }
@@ -16066,9 +20571,14 @@ void REGPARAM2 CPUFUNC(op_49c0_0)(uae_u32 opcode) /* EXT.B Dn */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -16082,12 +20592,40 @@ void REGPARAM2 CPUFUNC(op_4a00_0)(uae_u32 opcode) /* TST.B Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a00_0_fuse)(uae_u32 opcode) /* TST.B Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a10_0)(uae_u32 opcode) /* TST.B (An) */
 {
 	cpuop_begin();
@@ -16098,12 +20636,41 @@ void REGPARAM2 CPUFUNC(op_4a10_0)(uae_u32 opcode) /* TST.B (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a10_0_fuse)(uae_u32 opcode) /* TST.B (An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a18_0)(uae_u32 opcode) /* TST.B (An)+ */
 {
 	cpuop_begin();
@@ -16115,12 +20682,42 @@ void REGPARAM2 CPUFUNC(op_4a18_0)(uae_u32 opcode) /* TST.B (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a18_0_fuse)(uae_u32 opcode) /* TST.B (An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a20_0)(uae_u32 opcode) /* TST.B -(An) */
 {
 	cpuop_begin();
@@ -16132,12 +20729,42 @@ void REGPARAM2 CPUFUNC(op_4a20_0)(uae_u32 opcode) /* TST.B -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a20_0_fuse)(uae_u32 opcode) /* TST.B -(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a28_0)(uae_u32 opcode) /* TST.B (d16,An) */
 {
 	cpuop_begin();
@@ -16148,12 +20775,41 @@ void REGPARAM2 CPUFUNC(op_4a28_0)(uae_u32 opcode) /* TST.B (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a28_0_fuse)(uae_u32 opcode) /* TST.B (d16,An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a30_0)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
 {
 	cpuop_begin();
@@ -16165,45 +20821,147 @@ void REGPARAM2 CPUFUNC(op_4a30_0)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a30_0_fuse)(uae_u32 opcode) /* TST.B (d8,An,Xn) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST.B (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a38_0_fuse)(uae_u32 opcode) /* TST.B (xxx).W + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a39_0)(uae_u32 opcode) /* TST.B (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a39_0_fuse)(uae_u32 opcode) /* TST.B (xxx).L + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a3a_0)(uae_u32 opcode) /* TST.B (d16,PC) */
 {
 	cpuop_begin();
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a3a_0_fuse)(uae_u32 opcode) /* TST.B (d16,PC) + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a3b_0)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
 {
 	cpuop_begin();
@@ -16211,21 +20969,69 @@ void REGPARAM2 CPUFUNC(op_4a3b_0)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a3b_0_fuse)(uae_u32 opcode) /* TST.B (d8,PC,Xn) + Bcc */
+{
+	cpuop_begin();
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_4a3c_0)(uae_u32 opcode) /* TST.B #<data>.B */
 {
 	cpuop_begin();
 {{	uae_s8 src = get_ibyte(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
+}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a3c_0_fuse)(uae_u32 opcode) /* TST.B #<data>.B + Bcc */
+{
+	cpuop_begin();
+{{	uae_s8 src = get_ibyte(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a40_0)(uae_u32 opcode) /* TST.W Dn */
 {
 	cpuop_begin();
@@ -16235,12 +21041,40 @@ void REGPARAM2 CPUFUNC(op_4a40_0)(uae_u32 opcode) /* TST.W Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a40_0_fuse)(uae_u32 opcode) /* TST.W Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a48_0)(uae_u32 opcode) /* TST.W An */
 {
 	cpuop_begin();
@@ -16250,12 +21084,40 @@ void REGPARAM2 CPUFUNC(op_4a48_0)(uae_u32 opcode) /* TST.W An */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a48_0_fuse)(uae_u32 opcode) /* TST.W An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a50_0)(uae_u32 opcode) /* TST.W (An) */
 {
 	cpuop_begin();
@@ -16266,12 +21128,41 @@ void REGPARAM2 CPUFUNC(op_4a50_0)(uae_u32 opcode) /* TST.W (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a50_0_fuse)(uae_u32 opcode) /* TST.W (An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a58_0)(uae_u32 opcode) /* TST.W (An)+ */
 {
 	cpuop_begin();
@@ -16283,12 +21174,42 @@ void REGPARAM2 CPUFUNC(op_4a58_0)(uae_u32 opcode) /* TST.W (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a58_0_fuse)(uae_u32 opcode) /* TST.W (An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a60_0)(uae_u32 opcode) /* TST.W -(An) */
 {
 	cpuop_begin();
@@ -16300,12 +21221,42 @@ void REGPARAM2 CPUFUNC(op_4a60_0)(uae_u32 opcode) /* TST.W -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a60_0_fuse)(uae_u32 opcode) /* TST.W -(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a68_0)(uae_u32 opcode) /* TST.W (d16,An) */
 {
 	cpuop_begin();
@@ -16316,12 +21267,41 @@ void REGPARAM2 CPUFUNC(op_4a68_0)(uae_u32 opcode) /* TST.W (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a68_0_fuse)(uae_u32 opcode) /* TST.W (d16,An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a70_0)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
 {
 	cpuop_begin();
@@ -16333,45 +21313,147 @@ void REGPARAM2 CPUFUNC(op_4a70_0)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a70_0_fuse)(uae_u32 opcode) /* TST.W (d8,An,Xn) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST.W (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a78_0_fuse)(uae_u32 opcode) /* TST.W (xxx).W + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a79_0)(uae_u32 opcode) /* TST.W (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a79_0_fuse)(uae_u32 opcode) /* TST.W (xxx).L + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a7a_0)(uae_u32 opcode) /* TST.W (d16,PC) */
 {
 	cpuop_begin();
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a7a_0_fuse)(uae_u32 opcode) /* TST.W (d16,PC) + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a7b_0)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
 {
 	cpuop_begin();
@@ -16379,21 +21461,69 @@ void REGPARAM2 CPUFUNC(op_4a7b_0)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a7b_0_fuse)(uae_u32 opcode) /* TST.W (d8,PC,Xn) + Bcc */
+{
+	cpuop_begin();
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_4a7c_0)(uae_u32 opcode) /* TST.W #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 src = get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
+}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a7c_0_fuse)(uae_u32 opcode) /* TST.W #<data>.W + Bcc */
+{
+	cpuop_begin();
+{{	uae_s16 src = get_iword(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a80_0)(uae_u32 opcode) /* TST.L Dn */
 {
 	cpuop_begin();
@@ -16403,13 +21533,19 @@ void REGPARAM2 CPUFUNC(op_4a80_0)(uae_u32 opcode) /* TST.L Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST.L An */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a80_0_fuse)(uae_u32 opcode) /* TST.L Dn + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -16417,14 +21553,21 @@ void REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST.L An */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s32 src = m68k_areg(regs, srcreg);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST.L (An) */
+#endif
+void REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST.L An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -16432,14 +21575,86 @@ void REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST.L (An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s32 src = get_long(srca);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a88_0_fuse)(uae_u32 opcode) /* TST.L An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST.L (An) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a90_0_fuse)(uae_u32 opcode) /* TST.L (An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4a98_0)(uae_u32 opcode) /* TST.L (An)+ */
 {
 	cpuop_begin();
@@ -16451,12 +21666,42 @@ void REGPARAM2 CPUFUNC(op_4a98_0)(uae_u32 opcode) /* TST.L (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4a98_0_fuse)(uae_u32 opcode) /* TST.L (An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_4aa0_0)(uae_u32 opcode) /* TST.L -(An) */
 {
 	cpuop_begin();
@@ -16468,12 +21713,42 @@ void REGPARAM2 CPUFUNC(op_4aa0_0)(uae_u32 opcode) /* TST.L -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4aa0_0_fuse)(uae_u32 opcode) /* TST.L -(An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4aa8_0)(uae_u32 opcode) /* TST.L (d16,An) */
 {
 	cpuop_begin();
@@ -16484,12 +21759,41 @@ void REGPARAM2 CPUFUNC(op_4aa8_0)(uae_u32 opcode) /* TST.L (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4aa8_0_fuse)(uae_u32 opcode) /* TST.L (d16,An) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4ab0_0)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
 {
 	cpuop_begin();
@@ -16501,45 +21805,147 @@ void REGPARAM2 CPUFUNC(op_4ab0_0)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4ab0_0_fuse)(uae_u32 opcode) /* TST.L (d8,An,Xn) + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST.L (xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4ab8_0_fuse)(uae_u32 opcode) /* TST.L (xxx).W + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4ab9_0)(uae_u32 opcode) /* TST.L (xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4ab9_0_fuse)(uae_u32 opcode) /* TST.L (xxx).L + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4aba_0)(uae_u32 opcode) /* TST.L (d16,PC) */
 {
 	cpuop_begin();
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4aba_0_fuse)(uae_u32 opcode) /* TST.L (d16,PC) + Bcc */
+{
+	cpuop_begin();
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4abb_0)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
 {
 	cpuop_begin();
@@ -16547,21 +21953,69 @@ void REGPARAM2 CPUFUNC(op_4abb_0)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4abb_0_fuse)(uae_u32 opcode) /* TST.L (d8,PC,Xn) + Bcc */
+{
+	cpuop_begin();
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_4abc_0)(uae_u32 opcode) /* TST.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 src = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
+}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_4abc_0_fuse)(uae_u32 opcode) /* TST.L #<data>.L + Bcc */
+{
+	cpuop_begin();
+{{	uae_s32 src = get_ilong(2);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_4ac0_0)(uae_u32 opcode) /* TAS.B Dn */
 {
 	cpuop_begin();
@@ -16571,9 +22025,14 @@ void REGPARAM2 CPUFUNC(op_4ac0_0)(uae_u32 opcode) /* TAS.B Dn */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -16589,9 +22048,14 @@ void REGPARAM2 CPUFUNC(op_4ad0_0)(uae_u32 opcode) /* TAS.B (An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16608,9 +22072,14 @@ void REGPARAM2 CPUFUNC(op_4ad8_0)(uae_u32 opcode) /* TAS.B (An)+ */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16627,9 +22096,14 @@ void REGPARAM2 CPUFUNC(op_4ae0_0)(uae_u32 opcode) /* TAS.B -(An) */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -16645,9 +22119,14 @@ void REGPARAM2 CPUFUNC(op_4ae8_0)(uae_u32 opcode) /* TAS.B (d16,An) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -16664,9 +22143,14 @@ void REGPARAM2 CPUFUNC(op_4af0_0)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
 {{m68k_incpc(2);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}}	cpuop_end();
@@ -16676,9 +22160,14 @@ void REGPARAM2 CPUFUNC(op_4af8_0)(uae_u32 opcode) /* TAS.B (xxx).W */
 	cpuop_begin();
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -16689,9 +22178,14 @@ void REGPARAM2 CPUFUNC(op_4af9_0)(uae_u32 opcode) /* TAS.B (xxx).L */
 	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(6);
@@ -17019,8 +22513,16 @@ void REGPARAM2 CPUFUNC(op_4c90_0)(uae_u32 opcode) /* MVMEL.W #<data>.W,(An) */
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = m68k_areg(regs, dstreg);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -17038,8 +22540,16 @@ void REGPARAM2 CPUFUNC(op_4c98_0)(uae_u32 opcode) /* MVMEL.W #<data>.W,(An)+ */
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = m68k_areg(regs, dstreg);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 	m68k_areg(regs, dstreg) = srca;
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -17058,8 +22568,16 @@ void REGPARAM2 CPUFUNC(op_4ca8_0)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d16,An)
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -17078,8 +22596,16 @@ void REGPARAM2 CPUFUNC(op_4cb0_0)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d8,An,Xn
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {m68k_incpc(4);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}}	cpuop_end();
 }
 
@@ -17091,8 +22617,16 @@ void REGPARAM2 CPUFUNC(op_4cb8_0)(uae_u32 opcode) /* MVMEL.W #<data>.W,(xxx).W *
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -17105,8 +22639,16 @@ void REGPARAM2 CPUFUNC(op_4cb9_0)(uae_u32 opcode) /* MVMEL.W #<data>.W,(xxx).L *
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = get_ilong(4);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(8);
 	cpuop_end();
 }
@@ -17121,8 +22663,16 @@ void REGPARAM2 CPUFUNC(op_4cba_0)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d16,PC)
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = m68k_getpc () + 4;
 	srca += (uae_s32)(uae_s16)get_iword(4);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -17138,8 +22688,16 @@ void REGPARAM2 CPUFUNC(op_4cbb_0)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d8,PC,Xn
 {m68k_incpc(4);
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}}	cpuop_end();
 }
 
@@ -17156,8 +22714,16 @@ void REGPARAM2 CPUFUNC(op_4cd0_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(An) */
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = m68k_areg(regs, dstreg);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -17175,8 +22741,16 @@ void REGPARAM2 CPUFUNC(op_4cd8_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(An)+ */
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = m68k_areg(regs, dstreg);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 	m68k_areg(regs, dstreg) = srca;
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -17195,8 +22769,16 @@ void REGPARAM2 CPUFUNC(op_4ce8_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d16,An)
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -17215,8 +22797,16 @@ void REGPARAM2 CPUFUNC(op_4cf0_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d8,An,Xn
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {m68k_incpc(4);
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}}	cpuop_end();
 }
 
@@ -17228,8 +22818,16 @@ void REGPARAM2 CPUFUNC(op_4cf8_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(xxx).W *
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -17242,8 +22840,16 @@ void REGPARAM2 CPUFUNC(op_4cf9_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(xxx).L *
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = get_ilong(4);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(8);
 	cpuop_end();
 }
@@ -17258,8 +22864,16 @@ void REGPARAM2 CPUFUNC(op_4cfa_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d16,PC)
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = m68k_getpc () + 4;
 	srca += (uae_s32)(uae_s16)get_iword(4);
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -17275,8 +22889,16 @@ void REGPARAM2 CPUFUNC(op_4cfb_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d8,PC,Xn
 {m68k_incpc(4);
 {	uaecptr tmppc = m68k_getpc();
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}}	cpuop_end();
 }
 
@@ -17347,11 +22969,11 @@ void REGPARAM2 CPUFUNC(op_4e60_0)(uae_u32 opcode) /* MVR2USP.L An */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel901; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1000; }
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 	regs.usp = src;
 }}}m68k_incpc(2);
-endlabel901: ;
+endlabel1000: ;
 	cpuop_end();
 }
 
@@ -17365,10 +22987,10 @@ void REGPARAM2 CPUFUNC(op_4e68_0)(uae_u32 opcode) /* MVUSP2R.L An */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel902; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1001; }
 {{	m68k_areg(regs, srcreg) = (regs.usp);
 }}}m68k_incpc(2);
-endlabel902: ;
+endlabel1001: ;
 	cpuop_end();
 }
 
@@ -17377,9 +22999,9 @@ endlabel902: ;
 void REGPARAM2 CPUFUNC(op_4e70_0)(uae_u32 opcode) /* RESET.L  */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel903; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1002; }
 {}}m68k_incpc(2);
-endlabel903: ;
+endlabel1002: ;
 	cpuop_end();
 }
 
@@ -17396,19 +23018,19 @@ void REGPARAM2 CPUFUNC(op_4e71_0)(uae_u32 opcode) /* NOP.L  */
 void REGPARAM2 CPUFUNC(op_4e72_0)(uae_u32 opcode) /* STOP.L #<data>.W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel905; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1004; }
 {{	uae_s16 src = get_iword(2);
 	regs.sr = src;
 	MakeFromSR();
 	m68k_setstopped(1);
 }}}m68k_incpc(4);
-endlabel905: ;
+endlabel1004: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4e73_0)(uae_u32 opcode) /* RTE.L  */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel906; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1005; }
 {	uae_u16 newsr; uae_u32 newpc; for (;;) {
 {	uaecptr sra = m68k_areg(regs, 7);
 {	uae_s16 sr = get_word(sra);
@@ -17429,12 +23051,12 @@ void REGPARAM2 CPUFUNC(op_4e73_0)(uae_u32 opcode) /* RTE.L  */
 	else if ((format & 0xF000) == 0x9000) { m68k_areg(regs, 7) += 12; break; }
 	else if ((format & 0xF000) == 0xa000) { m68k_areg(regs, 7) += 24; break; }
 	else if ((format & 0xF000) == 0xb000) { m68k_areg(regs, 7) += 84; break; }
-	else { Exception(14,0); goto endlabel906; }
+	else { op_exception(14,0); goto endlabel1005; }
 	regs.sr = newsr; MakeFromSR();
 }
 }}}}}}	regs.sr = newsr; MakeFromSR();
 	m68k_setpc_rte(newpc);
-}}endlabel906: ;
+}}endlabel1005: ;
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -17465,8 +23087,8 @@ void REGPARAM2 CPUFUNC(op_4e76_0)(uae_u32 opcode) /* TRAPV.L  */
 {
 	cpuop_begin();
 {m68k_incpc(2);
-	if (GET_VFLG) { Exception(7,m68k_getpc()); goto endlabel909; }
-}endlabel909: ;
+	if (GET_VFLG) { op_exception(7,m68k_getpc()); goto endlabel1008; }
+}endlabel1008: ;
 	cpuop_end();
 }
 
@@ -17490,13 +23112,13 @@ void REGPARAM2 CPUFUNC(op_4e77_0)(uae_u32 opcode) /* RTR.L  */
 void REGPARAM2 CPUFUNC(op_4e7a_0)(uae_u32 opcode) /* MOVEC2.L #<data>.W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel911; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1010; }
 {{	uae_s16 src = get_iword(2);
 {	int regno = (src >> 12) & 15;
 	uae_u32 *regp = regs.regs + regno;
-	if (! m68k_movec2(src & 0xFFF, regp)) goto endlabel911;
+	if (! m68k_movec2(src & 0xFFF, regp)) goto endlabel1010;
 }}}}m68k_incpc(4);
-endlabel911: ;
+endlabel1010: ;
 	cpuop_end();
 }
 
@@ -17505,13 +23127,13 @@ endlabel911: ;
 void REGPARAM2 CPUFUNC(op_4e7b_0)(uae_u32 opcode) /* MOVE2C.L #<data>.W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel912; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1011; }
 {{	uae_s16 src = get_iword(2);
 {	int regno = (src >> 12) & 15;
 	uae_u32 *regp = regs.regs + regno;
-	if (! m68k_move2c(src & 0xFFF, regp)) goto endlabel912;
+	if (! m68k_move2c(src & 0xFFF, regp)) goto endlabel1011;
 }}}}m68k_incpc(4);
-endlabel912: ;
+endlabel1011: ;
 	cpuop_end();
 }
 
@@ -17710,6 +23332,46 @@ void REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD.B #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+#endif
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_5000_0_fuse)(uae_u32 opcode) /* ADD.B #<data>,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17718,10 +23380,13 @@ void REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD.B #<data>,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD.B #<data>,(An) */
 {
 	cpuop_begin();
@@ -17739,6 +23404,11 @@ void REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD.B #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17747,6 +23417,7 @@ void REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD.B #<data>,(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -17769,6 +23440,11 @@ void REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD.B #<data>,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17777,6 +23453,7 @@ void REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD.B #<data>,(An)+ */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -17799,6 +23476,11 @@ void REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD.B #<data>,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17807,6 +23489,7 @@ void REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD.B #<data>,-(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -17828,6 +23511,11 @@ void REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD.B #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17836,6 +23524,7 @@ void REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD.B #<data>,(d16,An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -17858,6 +23547,11 @@ void REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17866,6 +23560,7 @@ void REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -17881,6 +23576,11 @@ void REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17889,6 +23589,7 @@ void REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).W */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -17905,6 +23606,11 @@ void REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -17913,6 +23619,7 @@ void REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD.B #<data>,(xxx).L */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -17936,6 +23643,11 @@ void REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD.W #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -17944,10 +23656,48 @@ void REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD.W #<data>,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_5040_0_fuse)(uae_u32 opcode) /* ADD.W #<data>,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+#endif
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 #ifndef NOFLAGS
 void REGPARAM2 CPUFUNC(op_5048_0)(uae_u32 opcode) /* ADDA.W #<data>,An */
 {
@@ -17988,6 +23738,11 @@ void REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD.W #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -17996,6 +23751,7 @@ void REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD.W #<data>,(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18018,6 +23774,11 @@ void REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD.W #<data>,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18026,6 +23787,7 @@ void REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD.W #<data>,(An)+ */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18048,6 +23810,11 @@ void REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD.W #<data>,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18056,6 +23823,7 @@ void REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD.W #<data>,-(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18077,6 +23845,11 @@ void REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD.W #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18085,6 +23858,7 @@ void REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD.W #<data>,(d16,An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -18107,6 +23881,11 @@ void REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18115,6 +23894,7 @@ void REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -18130,6 +23910,11 @@ void REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18138,6 +23923,7 @@ void REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).W */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -18154,6 +23940,11 @@ void REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18162,6 +23953,7 @@ void REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD.W #<data>,(xxx).L */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -18182,6 +23974,11 @@ void REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD.L #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18190,10 +23987,48 @@ void REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD.L #<data>,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_5080_0_fuse)(uae_u32 opcode) /* ADD.L #<data>,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+#endif
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 #ifndef NOFLAGS
 void REGPARAM2 CPUFUNC(op_5088_0)(uae_u32 opcode) /* ADDA.L #<data>,An */
 {
@@ -18234,6 +24069,11 @@ void REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD.L #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18242,6 +24082,7 @@ void REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD.L #<data>,(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18264,6 +24105,11 @@ void REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD.L #<data>,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18272,6 +24118,7 @@ void REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD.L #<data>,(An)+ */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18294,6 +24141,11 @@ void REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD.L #<data>,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18302,6 +24154,7 @@ void REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD.L #<data>,-(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18323,6 +24176,11 @@ void REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD.L #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18331,6 +24189,7 @@ void REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD.L #<data>,(d16,An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -18353,6 +24212,11 @@ void REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18361,6 +24225,7 @@ void REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -18376,6 +24241,11 @@ void REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18384,6 +24254,7 @@ void REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).W */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -18400,6 +24271,11 @@ void REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -18408,6 +24284,7 @@ void REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD.L #<data>,(xxx).L */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -18443,11 +24320,11 @@ void REGPARAM2 CPUFUNC(op_50c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel954: ;
+endlabel1056: ;
 	cpuop_end();
 }
 
@@ -18568,9 +24445,9 @@ void REGPARAM2 CPUFUNC(op_50fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(0)) { Exception(7,m68k_getpc()); goto endlabel962; }
+	if (cctrue(0)) { op_exception(7,m68k_getpc()); goto endlabel1064; }
 }}m68k_incpc(4);
-endlabel962: ;
+endlabel1064: ;
 	cpuop_end();
 }
 
@@ -18580,9 +24457,9 @@ void REGPARAM2 CPUFUNC(op_50fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(0)) { Exception(7,m68k_getpc()); goto endlabel963; }
+	if (cctrue(0)) { op_exception(7,m68k_getpc()); goto endlabel1065; }
 }}m68k_incpc(6);
-endlabel963: ;
+endlabel1065: ;
 	cpuop_end();
 }
 
@@ -18591,9 +24468,9 @@ endlabel963: ;
 void REGPARAM2 CPUFUNC(op_50fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(0)) { Exception(7,m68k_getpc()); goto endlabel964; }
+{	if (cctrue(0)) { op_exception(7,m68k_getpc()); goto endlabel1066; }
 }m68k_incpc(2);
-endlabel964: ;
+endlabel1066: ;
 	cpuop_end();
 }
 
@@ -18614,6 +24491,11 @@ void REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB.B #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18622,10 +24504,48 @@ void REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB.B #<data>,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_5100_0_fuse)(uae_u32 opcode) /* SUB.B #<data>,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+#endif
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB.B #<data>,(An) */
 {
 	cpuop_begin();
@@ -18643,6 +24563,11 @@ void REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB.B #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18651,6 +24576,7 @@ void REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB.B #<data>,(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18673,6 +24599,11 @@ void REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB.B #<data>,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18681,6 +24612,7 @@ void REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB.B #<data>,(An)+ */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18703,6 +24635,11 @@ void REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB.B #<data>,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18711,6 +24648,7 @@ void REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB.B #<data>,-(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18732,6 +24670,11 @@ void REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB.B #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18740,6 +24683,7 @@ void REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB.B #<data>,(d16,An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -18762,6 +24706,11 @@ void REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18770,6 +24719,7 @@ void REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -18785,6 +24735,11 @@ void REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18793,6 +24748,7 @@ void REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).W */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -18809,6 +24765,11 @@ void REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -18817,6 +24778,7 @@ void REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB.B #<data>,(xxx).L */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -18837,6 +24799,46 @@ void REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB.W #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+#endif
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_5140_0_fuse)(uae_u32 opcode) /* SUB.W #<data>,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18845,10 +24847,13 @@ void REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB.W #<data>,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 #ifndef NOFLAGS
 void REGPARAM2 CPUFUNC(op_5148_0)(uae_u32 opcode) /* SUBA.W #<data>,An */
 {
@@ -18889,6 +24894,11 @@ void REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB.W #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18897,6 +24907,7 @@ void REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB.W #<data>,(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18919,6 +24930,11 @@ void REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB.W #<data>,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18927,6 +24943,7 @@ void REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB.W #<data>,(An)+ */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18949,6 +24966,11 @@ void REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB.W #<data>,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18957,6 +24979,7 @@ void REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB.W #<data>,-(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -18978,6 +25001,11 @@ void REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB.W #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -18986,6 +25014,7 @@ void REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB.W #<data>,(d16,An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -19008,6 +25037,11 @@ void REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -19016,6 +25050,7 @@ void REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -19031,6 +25066,11 @@ void REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -19039,6 +25079,7 @@ void REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).W */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -19055,6 +25096,11 @@ void REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -19063,6 +25109,7 @@ void REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB.W #<data>,(xxx).L */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -19083,6 +25130,11 @@ void REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB.L #<data>,Dn */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19091,10 +25143,48 @@ void REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB.L #<data>,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_5180_0_fuse)(uae_u32 opcode) /* SUB.L #<data>,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+#endif
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 #ifndef NOFLAGS
 void REGPARAM2 CPUFUNC(op_5188_0)(uae_u32 opcode) /* SUBA.L #<data>,An */
 {
@@ -19135,6 +25225,11 @@ void REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB.L #<data>,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19143,6 +25238,7 @@ void REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB.L #<data>,(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -19165,6 +25261,11 @@ void REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB.L #<data>,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19173,6 +25274,7 @@ void REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB.L #<data>,(An)+ */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -19195,6 +25297,11 @@ void REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB.L #<data>,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19203,6 +25310,7 @@ void REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB.L #<data>,-(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -19224,6 +25332,11 @@ void REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB.L #<data>,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19232,6 +25345,7 @@ void REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB.L #<data>,(d16,An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -19254,6 +25368,11 @@ void REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19262,6 +25381,7 @@ void REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -19277,6 +25397,11 @@ void REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19285,6 +25410,7 @@ void REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).W */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -19301,6 +25427,11 @@ void REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -19309,6 +25440,7 @@ void REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB.L #<data>,(xxx).L */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -19344,11 +25476,11 @@ void REGPARAM2 CPUFUNC(op_51c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel992: ;
+endlabel1097: ;
 	cpuop_end();
 }
 
@@ -19469,9 +25601,9 @@ void REGPARAM2 CPUFUNC(op_51fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(1)) { Exception(7,m68k_getpc()); goto endlabel1000; }
+	if (cctrue(1)) { op_exception(7,m68k_getpc()); goto endlabel1105; }
 }}m68k_incpc(4);
-endlabel1000: ;
+endlabel1105: ;
 	cpuop_end();
 }
 
@@ -19481,9 +25613,9 @@ void REGPARAM2 CPUFUNC(op_51fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(1)) { Exception(7,m68k_getpc()); goto endlabel1001; }
+	if (cctrue(1)) { op_exception(7,m68k_getpc()); goto endlabel1106; }
 }}m68k_incpc(6);
-endlabel1001: ;
+endlabel1106: ;
 	cpuop_end();
 }
 
@@ -19492,9 +25624,9 @@ endlabel1001: ;
 void REGPARAM2 CPUFUNC(op_51fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(1)) { Exception(7,m68k_getpc()); goto endlabel1002; }
+{	if (cctrue(1)) { op_exception(7,m68k_getpc()); goto endlabel1107; }
 }m68k_incpc(2);
-endlabel1002: ;
+endlabel1107: ;
 	cpuop_end();
 }
 
@@ -19530,11 +25662,11 @@ void REGPARAM2 CPUFUNC(op_52c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1004: ;
+endlabel1109: ;
 	cpuop_end();
 }
 
@@ -19655,9 +25787,9 @@ void REGPARAM2 CPUFUNC(op_52fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(2)) { Exception(7,m68k_getpc()); goto endlabel1012; }
+	if (cctrue(2)) { op_exception(7,m68k_getpc()); goto endlabel1117; }
 }}m68k_incpc(4);
-endlabel1012: ;
+endlabel1117: ;
 	cpuop_end();
 }
 
@@ -19667,9 +25799,9 @@ void REGPARAM2 CPUFUNC(op_52fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(2)) { Exception(7,m68k_getpc()); goto endlabel1013; }
+	if (cctrue(2)) { op_exception(7,m68k_getpc()); goto endlabel1118; }
 }}m68k_incpc(6);
-endlabel1013: ;
+endlabel1118: ;
 	cpuop_end();
 }
 
@@ -19678,9 +25810,9 @@ endlabel1013: ;
 void REGPARAM2 CPUFUNC(op_52fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(2)) { Exception(7,m68k_getpc()); goto endlabel1014; }
+{	if (cctrue(2)) { op_exception(7,m68k_getpc()); goto endlabel1119; }
 }m68k_incpc(2);
-endlabel1014: ;
+endlabel1119: ;
 	cpuop_end();
 }
 
@@ -19716,11 +25848,11 @@ void REGPARAM2 CPUFUNC(op_53c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1016: ;
+endlabel1121: ;
 	cpuop_end();
 }
 
@@ -19841,9 +25973,9 @@ void REGPARAM2 CPUFUNC(op_53fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(3)) { Exception(7,m68k_getpc()); goto endlabel1024; }
+	if (cctrue(3)) { op_exception(7,m68k_getpc()); goto endlabel1129; }
 }}m68k_incpc(4);
-endlabel1024: ;
+endlabel1129: ;
 	cpuop_end();
 }
 
@@ -19853,9 +25985,9 @@ void REGPARAM2 CPUFUNC(op_53fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(3)) { Exception(7,m68k_getpc()); goto endlabel1025; }
+	if (cctrue(3)) { op_exception(7,m68k_getpc()); goto endlabel1130; }
 }}m68k_incpc(6);
-endlabel1025: ;
+endlabel1130: ;
 	cpuop_end();
 }
 
@@ -19864,9 +25996,9 @@ endlabel1025: ;
 void REGPARAM2 CPUFUNC(op_53fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(3)) { Exception(7,m68k_getpc()); goto endlabel1026; }
+{	if (cctrue(3)) { op_exception(7,m68k_getpc()); goto endlabel1131; }
 }m68k_incpc(2);
-endlabel1026: ;
+endlabel1131: ;
 	cpuop_end();
 }
 
@@ -19902,11 +26034,11 @@ void REGPARAM2 CPUFUNC(op_54c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1028: ;
+endlabel1133: ;
 	cpuop_end();
 }
 
@@ -20027,9 +26159,9 @@ void REGPARAM2 CPUFUNC(op_54fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(4)) { Exception(7,m68k_getpc()); goto endlabel1036; }
+	if (cctrue(4)) { op_exception(7,m68k_getpc()); goto endlabel1141; }
 }}m68k_incpc(4);
-endlabel1036: ;
+endlabel1141: ;
 	cpuop_end();
 }
 
@@ -20039,9 +26171,9 @@ void REGPARAM2 CPUFUNC(op_54fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(4)) { Exception(7,m68k_getpc()); goto endlabel1037; }
+	if (cctrue(4)) { op_exception(7,m68k_getpc()); goto endlabel1142; }
 }}m68k_incpc(6);
-endlabel1037: ;
+endlabel1142: ;
 	cpuop_end();
 }
 
@@ -20050,9 +26182,9 @@ endlabel1037: ;
 void REGPARAM2 CPUFUNC(op_54fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(4)) { Exception(7,m68k_getpc()); goto endlabel1038; }
+{	if (cctrue(4)) { op_exception(7,m68k_getpc()); goto endlabel1143; }
 }m68k_incpc(2);
-endlabel1038: ;
+endlabel1143: ;
 	cpuop_end();
 }
 
@@ -20088,11 +26220,11 @@ void REGPARAM2 CPUFUNC(op_55c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1040: ;
+endlabel1145: ;
 	cpuop_end();
 }
 
@@ -20213,9 +26345,9 @@ void REGPARAM2 CPUFUNC(op_55fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(5)) { Exception(7,m68k_getpc()); goto endlabel1048; }
+	if (cctrue(5)) { op_exception(7,m68k_getpc()); goto endlabel1153; }
 }}m68k_incpc(4);
-endlabel1048: ;
+endlabel1153: ;
 	cpuop_end();
 }
 
@@ -20225,9 +26357,9 @@ void REGPARAM2 CPUFUNC(op_55fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(5)) { Exception(7,m68k_getpc()); goto endlabel1049; }
+	if (cctrue(5)) { op_exception(7,m68k_getpc()); goto endlabel1154; }
 }}m68k_incpc(6);
-endlabel1049: ;
+endlabel1154: ;
 	cpuop_end();
 }
 
@@ -20236,9 +26368,9 @@ endlabel1049: ;
 void REGPARAM2 CPUFUNC(op_55fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(5)) { Exception(7,m68k_getpc()); goto endlabel1050; }
+{	if (cctrue(5)) { op_exception(7,m68k_getpc()); goto endlabel1155; }
 }m68k_incpc(2);
-endlabel1050: ;
+endlabel1155: ;
 	cpuop_end();
 }
 
@@ -20274,11 +26406,11 @@ void REGPARAM2 CPUFUNC(op_56c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1052: ;
+endlabel1157: ;
 	cpuop_end();
 }
 
@@ -20399,9 +26531,9 @@ void REGPARAM2 CPUFUNC(op_56fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(6)) { Exception(7,m68k_getpc()); goto endlabel1060; }
+	if (cctrue(6)) { op_exception(7,m68k_getpc()); goto endlabel1165; }
 }}m68k_incpc(4);
-endlabel1060: ;
+endlabel1165: ;
 	cpuop_end();
 }
 
@@ -20411,9 +26543,9 @@ void REGPARAM2 CPUFUNC(op_56fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(6)) { Exception(7,m68k_getpc()); goto endlabel1061; }
+	if (cctrue(6)) { op_exception(7,m68k_getpc()); goto endlabel1166; }
 }}m68k_incpc(6);
-endlabel1061: ;
+endlabel1166: ;
 	cpuop_end();
 }
 
@@ -20422,9 +26554,9 @@ endlabel1061: ;
 void REGPARAM2 CPUFUNC(op_56fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(6)) { Exception(7,m68k_getpc()); goto endlabel1062; }
+{	if (cctrue(6)) { op_exception(7,m68k_getpc()); goto endlabel1167; }
 }m68k_incpc(2);
-endlabel1062: ;
+endlabel1167: ;
 	cpuop_end();
 }
 
@@ -20460,11 +26592,11 @@ void REGPARAM2 CPUFUNC(op_57c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1064: ;
+endlabel1169: ;
 	cpuop_end();
 }
 
@@ -20585,9 +26717,9 @@ void REGPARAM2 CPUFUNC(op_57fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(7)) { Exception(7,m68k_getpc()); goto endlabel1072; }
+	if (cctrue(7)) { op_exception(7,m68k_getpc()); goto endlabel1177; }
 }}m68k_incpc(4);
-endlabel1072: ;
+endlabel1177: ;
 	cpuop_end();
 }
 
@@ -20597,9 +26729,9 @@ void REGPARAM2 CPUFUNC(op_57fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(7)) { Exception(7,m68k_getpc()); goto endlabel1073; }
+	if (cctrue(7)) { op_exception(7,m68k_getpc()); goto endlabel1178; }
 }}m68k_incpc(6);
-endlabel1073: ;
+endlabel1178: ;
 	cpuop_end();
 }
 
@@ -20608,9 +26740,9 @@ endlabel1073: ;
 void REGPARAM2 CPUFUNC(op_57fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(7)) { Exception(7,m68k_getpc()); goto endlabel1074; }
+{	if (cctrue(7)) { op_exception(7,m68k_getpc()); goto endlabel1179; }
 }m68k_incpc(2);
-endlabel1074: ;
+endlabel1179: ;
 	cpuop_end();
 }
 
@@ -20646,11 +26778,11 @@ void REGPARAM2 CPUFUNC(op_58c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1076: ;
+endlabel1181: ;
 	cpuop_end();
 }
 
@@ -20771,9 +26903,9 @@ void REGPARAM2 CPUFUNC(op_58fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(8)) { Exception(7,m68k_getpc()); goto endlabel1084; }
+	if (cctrue(8)) { op_exception(7,m68k_getpc()); goto endlabel1189; }
 }}m68k_incpc(4);
-endlabel1084: ;
+endlabel1189: ;
 	cpuop_end();
 }
 
@@ -20783,9 +26915,9 @@ void REGPARAM2 CPUFUNC(op_58fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(8)) { Exception(7,m68k_getpc()); goto endlabel1085; }
+	if (cctrue(8)) { op_exception(7,m68k_getpc()); goto endlabel1190; }
 }}m68k_incpc(6);
-endlabel1085: ;
+endlabel1190: ;
 	cpuop_end();
 }
 
@@ -20794,9 +26926,9 @@ endlabel1085: ;
 void REGPARAM2 CPUFUNC(op_58fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(8)) { Exception(7,m68k_getpc()); goto endlabel1086; }
+{	if (cctrue(8)) { op_exception(7,m68k_getpc()); goto endlabel1191; }
 }m68k_incpc(2);
-endlabel1086: ;
+endlabel1191: ;
 	cpuop_end();
 }
 
@@ -20832,11 +26964,11 @@ void REGPARAM2 CPUFUNC(op_59c8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1088: ;
+endlabel1193: ;
 	cpuop_end();
 }
 
@@ -20957,9 +27089,9 @@ void REGPARAM2 CPUFUNC(op_59fa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(9)) { Exception(7,m68k_getpc()); goto endlabel1096; }
+	if (cctrue(9)) { op_exception(7,m68k_getpc()); goto endlabel1201; }
 }}m68k_incpc(4);
-endlabel1096: ;
+endlabel1201: ;
 	cpuop_end();
 }
 
@@ -20969,9 +27101,9 @@ void REGPARAM2 CPUFUNC(op_59fb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(9)) { Exception(7,m68k_getpc()); goto endlabel1097; }
+	if (cctrue(9)) { op_exception(7,m68k_getpc()); goto endlabel1202; }
 }}m68k_incpc(6);
-endlabel1097: ;
+endlabel1202: ;
 	cpuop_end();
 }
 
@@ -20980,9 +27112,9 @@ endlabel1097: ;
 void REGPARAM2 CPUFUNC(op_59fc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(9)) { Exception(7,m68k_getpc()); goto endlabel1098; }
+{	if (cctrue(9)) { op_exception(7,m68k_getpc()); goto endlabel1203; }
 }m68k_incpc(2);
-endlabel1098: ;
+endlabel1203: ;
 	cpuop_end();
 }
 
@@ -21018,11 +27150,11 @@ void REGPARAM2 CPUFUNC(op_5ac8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1100: ;
+endlabel1205: ;
 	cpuop_end();
 }
 
@@ -21143,9 +27275,9 @@ void REGPARAM2 CPUFUNC(op_5afa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(10)) { Exception(7,m68k_getpc()); goto endlabel1108; }
+	if (cctrue(10)) { op_exception(7,m68k_getpc()); goto endlabel1213; }
 }}m68k_incpc(4);
-endlabel1108: ;
+endlabel1213: ;
 	cpuop_end();
 }
 
@@ -21155,9 +27287,9 @@ void REGPARAM2 CPUFUNC(op_5afb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(10)) { Exception(7,m68k_getpc()); goto endlabel1109; }
+	if (cctrue(10)) { op_exception(7,m68k_getpc()); goto endlabel1214; }
 }}m68k_incpc(6);
-endlabel1109: ;
+endlabel1214: ;
 	cpuop_end();
 }
 
@@ -21166,9 +27298,9 @@ endlabel1109: ;
 void REGPARAM2 CPUFUNC(op_5afc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(10)) { Exception(7,m68k_getpc()); goto endlabel1110; }
+{	if (cctrue(10)) { op_exception(7,m68k_getpc()); goto endlabel1215; }
 }m68k_incpc(2);
-endlabel1110: ;
+endlabel1215: ;
 	cpuop_end();
 }
 
@@ -21204,11 +27336,11 @@ void REGPARAM2 CPUFUNC(op_5bc8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1112: ;
+endlabel1217: ;
 	cpuop_end();
 }
 
@@ -21329,9 +27461,9 @@ void REGPARAM2 CPUFUNC(op_5bfa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(11)) { Exception(7,m68k_getpc()); goto endlabel1120; }
+	if (cctrue(11)) { op_exception(7,m68k_getpc()); goto endlabel1225; }
 }}m68k_incpc(4);
-endlabel1120: ;
+endlabel1225: ;
 	cpuop_end();
 }
 
@@ -21341,9 +27473,9 @@ void REGPARAM2 CPUFUNC(op_5bfb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(11)) { Exception(7,m68k_getpc()); goto endlabel1121; }
+	if (cctrue(11)) { op_exception(7,m68k_getpc()); goto endlabel1226; }
 }}m68k_incpc(6);
-endlabel1121: ;
+endlabel1226: ;
 	cpuop_end();
 }
 
@@ -21352,9 +27484,9 @@ endlabel1121: ;
 void REGPARAM2 CPUFUNC(op_5bfc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(11)) { Exception(7,m68k_getpc()); goto endlabel1122; }
+{	if (cctrue(11)) { op_exception(7,m68k_getpc()); goto endlabel1227; }
 }m68k_incpc(2);
-endlabel1122: ;
+endlabel1227: ;
 	cpuop_end();
 }
 
@@ -21390,11 +27522,11 @@ void REGPARAM2 CPUFUNC(op_5cc8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1124: ;
+endlabel1229: ;
 	cpuop_end();
 }
 
@@ -21515,9 +27647,9 @@ void REGPARAM2 CPUFUNC(op_5cfa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(12)) { Exception(7,m68k_getpc()); goto endlabel1132; }
+	if (cctrue(12)) { op_exception(7,m68k_getpc()); goto endlabel1237; }
 }}m68k_incpc(4);
-endlabel1132: ;
+endlabel1237: ;
 	cpuop_end();
 }
 
@@ -21527,9 +27659,9 @@ void REGPARAM2 CPUFUNC(op_5cfb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(12)) { Exception(7,m68k_getpc()); goto endlabel1133; }
+	if (cctrue(12)) { op_exception(7,m68k_getpc()); goto endlabel1238; }
 }}m68k_incpc(6);
-endlabel1133: ;
+endlabel1238: ;
 	cpuop_end();
 }
 
@@ -21538,9 +27670,9 @@ endlabel1133: ;
 void REGPARAM2 CPUFUNC(op_5cfc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(12)) { Exception(7,m68k_getpc()); goto endlabel1134; }
+{	if (cctrue(12)) { op_exception(7,m68k_getpc()); goto endlabel1239; }
 }m68k_incpc(2);
-endlabel1134: ;
+endlabel1239: ;
 	cpuop_end();
 }
 
@@ -21576,11 +27708,11 @@ void REGPARAM2 CPUFUNC(op_5dc8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1136: ;
+endlabel1241: ;
 	cpuop_end();
 }
 
@@ -21701,9 +27833,9 @@ void REGPARAM2 CPUFUNC(op_5dfa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(13)) { Exception(7,m68k_getpc()); goto endlabel1144; }
+	if (cctrue(13)) { op_exception(7,m68k_getpc()); goto endlabel1249; }
 }}m68k_incpc(4);
-endlabel1144: ;
+endlabel1249: ;
 	cpuop_end();
 }
 
@@ -21713,9 +27845,9 @@ void REGPARAM2 CPUFUNC(op_5dfb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(13)) { Exception(7,m68k_getpc()); goto endlabel1145; }
+	if (cctrue(13)) { op_exception(7,m68k_getpc()); goto endlabel1250; }
 }}m68k_incpc(6);
-endlabel1145: ;
+endlabel1250: ;
 	cpuop_end();
 }
 
@@ -21724,9 +27856,9 @@ endlabel1145: ;
 void REGPARAM2 CPUFUNC(op_5dfc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(13)) { Exception(7,m68k_getpc()); goto endlabel1146; }
+{	if (cctrue(13)) { op_exception(7,m68k_getpc()); goto endlabel1251; }
 }m68k_incpc(2);
-endlabel1146: ;
+endlabel1251: ;
 	cpuop_end();
 }
 
@@ -21762,11 +27894,11 @@ void REGPARAM2 CPUFUNC(op_5ec8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1148: ;
+endlabel1253: ;
 	cpuop_end();
 }
 
@@ -21887,9 +28019,9 @@ void REGPARAM2 CPUFUNC(op_5efa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(14)) { Exception(7,m68k_getpc()); goto endlabel1156; }
+	if (cctrue(14)) { op_exception(7,m68k_getpc()); goto endlabel1261; }
 }}m68k_incpc(4);
-endlabel1156: ;
+endlabel1261: ;
 	cpuop_end();
 }
 
@@ -21899,9 +28031,9 @@ void REGPARAM2 CPUFUNC(op_5efb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(14)) { Exception(7,m68k_getpc()); goto endlabel1157; }
+	if (cctrue(14)) { op_exception(7,m68k_getpc()); goto endlabel1262; }
 }}m68k_incpc(6);
-endlabel1157: ;
+endlabel1262: ;
 	cpuop_end();
 }
 
@@ -21910,9 +28042,9 @@ endlabel1157: ;
 void REGPARAM2 CPUFUNC(op_5efc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(14)) { Exception(7,m68k_getpc()); goto endlabel1158; }
+{	if (cctrue(14)) { op_exception(7,m68k_getpc()); goto endlabel1263; }
 }m68k_incpc(2);
-endlabel1158: ;
+endlabel1263: ;
 	cpuop_end();
 }
 
@@ -21948,11 +28080,11 @@ void REGPARAM2 CPUFUNC(op_5fc8_0)(uae_u32 opcode) /* DBcc.W Dn,#<data>.W */
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
-return;
+	cpuop_return();
 		}
 	}
 }}}m68k_incpc(4);
-endlabel1160: ;
+endlabel1265: ;
 	cpuop_end();
 }
 
@@ -22076,9 +28208,9 @@ void REGPARAM2 CPUFUNC(op_5ffa_0)(uae_u32 opcode) /* TRAPcc.L #<data>.W */
 {
 	cpuop_begin();
 {{	uae_s16 dummy = get_iword(2);
-	if (cctrue(15)) { Exception(7,m68k_getpc()); goto endlabel1168; }
+	if (cctrue(15)) { op_exception(7,m68k_getpc()); goto endlabel1273; }
 }}m68k_incpc(4);
-endlabel1168: ;
+endlabel1273: ;
 	cpuop_end();
 }
 
@@ -22088,9 +28220,9 @@ void REGPARAM2 CPUFUNC(op_5ffb_0)(uae_u32 opcode) /* TRAPcc.L #<data>.L */
 {
 	cpuop_begin();
 {{	uae_s32 dummy = get_ilong(2);
-	if (cctrue(15)) { Exception(7,m68k_getpc()); goto endlabel1169; }
+	if (cctrue(15)) { op_exception(7,m68k_getpc()); goto endlabel1274; }
 }}m68k_incpc(6);
-endlabel1169: ;
+endlabel1274: ;
 	cpuop_end();
 }
 
@@ -22099,9 +28231,9 @@ endlabel1169: ;
 void REGPARAM2 CPUFUNC(op_5ffc_0)(uae_u32 opcode) /* TRAPcc.L  */
 {
 	cpuop_begin();
-{	if (cctrue(15)) { Exception(7,m68k_getpc()); goto endlabel1170; }
+{	if (cctrue(15)) { op_exception(7,m68k_getpc()); goto endlabel1275; }
 }m68k_incpc(2);
-endlabel1170: ;
+endlabel1275: ;
 	cpuop_end();
 }
 
@@ -22113,10 +28245,10 @@ void REGPARAM2 CPUFUNC(op_6000_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(0)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1171: ;
+endlabel1276: ;
 	cpuop_end();
 }
 
@@ -22133,10 +28265,10 @@ void REGPARAM2 CPUFUNC(op_6001_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(0)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1172: ;
+endlabel1277: ;
 	cpuop_end();
 }
 
@@ -22148,10 +28280,10 @@ void REGPARAM2 CPUFUNC(op_60ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(0)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1173: ;
+endlabel1278: ;
 	cpuop_end();
 }
 
@@ -22201,10 +28333,10 @@ void REGPARAM2 CPUFUNC(op_6200_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(2)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1177: ;
+endlabel1282: ;
 	cpuop_end();
 }
 
@@ -22221,10 +28353,10 @@ void REGPARAM2 CPUFUNC(op_6201_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(2)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1178: ;
+endlabel1283: ;
 	cpuop_end();
 }
 
@@ -22236,10 +28368,10 @@ void REGPARAM2 CPUFUNC(op_62ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(2)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1179: ;
+endlabel1284: ;
 	cpuop_end();
 }
 
@@ -22251,10 +28383,10 @@ void REGPARAM2 CPUFUNC(op_6300_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(3)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1180: ;
+endlabel1285: ;
 	cpuop_end();
 }
 
@@ -22271,10 +28403,10 @@ void REGPARAM2 CPUFUNC(op_6301_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(3)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1181: ;
+endlabel1286: ;
 	cpuop_end();
 }
 
@@ -22286,10 +28418,10 @@ void REGPARAM2 CPUFUNC(op_63ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(3)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1182: ;
+endlabel1287: ;
 	cpuop_end();
 }
 
@@ -22301,10 +28433,10 @@ void REGPARAM2 CPUFUNC(op_6400_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(4)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1183: ;
+endlabel1288: ;
 	cpuop_end();
 }
 
@@ -22321,10 +28453,10 @@ void REGPARAM2 CPUFUNC(op_6401_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(4)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1184: ;
+endlabel1289: ;
 	cpuop_end();
 }
 
@@ -22336,10 +28468,10 @@ void REGPARAM2 CPUFUNC(op_64ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(4)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1185: ;
+endlabel1290: ;
 	cpuop_end();
 }
 
@@ -22351,10 +28483,10 @@ void REGPARAM2 CPUFUNC(op_6500_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(5)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1186: ;
+endlabel1291: ;
 	cpuop_end();
 }
 
@@ -22371,10 +28503,10 @@ void REGPARAM2 CPUFUNC(op_6501_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(5)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1187: ;
+endlabel1292: ;
 	cpuop_end();
 }
 
@@ -22386,10 +28518,10 @@ void REGPARAM2 CPUFUNC(op_65ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(5)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1188: ;
+endlabel1293: ;
 	cpuop_end();
 }
 
@@ -22401,10 +28533,10 @@ void REGPARAM2 CPUFUNC(op_6600_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(6)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1189: ;
+endlabel1294: ;
 	cpuop_end();
 }
 
@@ -22421,10 +28553,10 @@ void REGPARAM2 CPUFUNC(op_6601_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(6)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1190: ;
+endlabel1295: ;
 	cpuop_end();
 }
 
@@ -22436,10 +28568,10 @@ void REGPARAM2 CPUFUNC(op_66ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(6)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1191: ;
+endlabel1296: ;
 	cpuop_end();
 }
 
@@ -22451,10 +28583,10 @@ void REGPARAM2 CPUFUNC(op_6700_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(7)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1192: ;
+endlabel1297: ;
 	cpuop_end();
 }
 
@@ -22471,10 +28603,10 @@ void REGPARAM2 CPUFUNC(op_6701_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(7)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1193: ;
+endlabel1298: ;
 	cpuop_end();
 }
 
@@ -22486,10 +28618,10 @@ void REGPARAM2 CPUFUNC(op_67ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(7)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1194: ;
+endlabel1299: ;
 	cpuop_end();
 }
 
@@ -22501,10 +28633,10 @@ void REGPARAM2 CPUFUNC(op_6800_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(8)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1195: ;
+endlabel1300: ;
 	cpuop_end();
 }
 
@@ -22521,10 +28653,10 @@ void REGPARAM2 CPUFUNC(op_6801_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(8)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1196: ;
+endlabel1301: ;
 	cpuop_end();
 }
 
@@ -22536,10 +28668,10 @@ void REGPARAM2 CPUFUNC(op_68ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(8)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1197: ;
+endlabel1302: ;
 	cpuop_end();
 }
 
@@ -22551,10 +28683,10 @@ void REGPARAM2 CPUFUNC(op_6900_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(9)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1198: ;
+endlabel1303: ;
 	cpuop_end();
 }
 
@@ -22571,10 +28703,10 @@ void REGPARAM2 CPUFUNC(op_6901_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(9)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1199: ;
+endlabel1304: ;
 	cpuop_end();
 }
 
@@ -22586,10 +28718,10 @@ void REGPARAM2 CPUFUNC(op_69ff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(9)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1200: ;
+endlabel1305: ;
 	cpuop_end();
 }
 
@@ -22601,10 +28733,10 @@ void REGPARAM2 CPUFUNC(op_6a00_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(10)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1201: ;
+endlabel1306: ;
 	cpuop_end();
 }
 
@@ -22621,10 +28753,10 @@ void REGPARAM2 CPUFUNC(op_6a01_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(10)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1202: ;
+endlabel1307: ;
 	cpuop_end();
 }
 
@@ -22636,10 +28768,10 @@ void REGPARAM2 CPUFUNC(op_6aff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(10)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1203: ;
+endlabel1308: ;
 	cpuop_end();
 }
 
@@ -22651,10 +28783,10 @@ void REGPARAM2 CPUFUNC(op_6b00_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(11)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1204: ;
+endlabel1309: ;
 	cpuop_end();
 }
 
@@ -22671,10 +28803,10 @@ void REGPARAM2 CPUFUNC(op_6b01_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(11)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1205: ;
+endlabel1310: ;
 	cpuop_end();
 }
 
@@ -22686,10 +28818,10 @@ void REGPARAM2 CPUFUNC(op_6bff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(11)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1206: ;
+endlabel1311: ;
 	cpuop_end();
 }
 
@@ -22701,10 +28833,10 @@ void REGPARAM2 CPUFUNC(op_6c00_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(12)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1207: ;
+endlabel1312: ;
 	cpuop_end();
 }
 
@@ -22721,10 +28853,10 @@ void REGPARAM2 CPUFUNC(op_6c01_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(12)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1208: ;
+endlabel1313: ;
 	cpuop_end();
 }
 
@@ -22736,10 +28868,10 @@ void REGPARAM2 CPUFUNC(op_6cff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(12)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1209: ;
+endlabel1314: ;
 	cpuop_end();
 }
 
@@ -22751,10 +28883,10 @@ void REGPARAM2 CPUFUNC(op_6d00_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(13)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1210: ;
+endlabel1315: ;
 	cpuop_end();
 }
 
@@ -22771,10 +28903,10 @@ void REGPARAM2 CPUFUNC(op_6d01_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(13)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1211: ;
+endlabel1316: ;
 	cpuop_end();
 }
 
@@ -22786,10 +28918,10 @@ void REGPARAM2 CPUFUNC(op_6dff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(13)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1212: ;
+endlabel1317: ;
 	cpuop_end();
 }
 
@@ -22801,10 +28933,10 @@ void REGPARAM2 CPUFUNC(op_6e00_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(14)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1213: ;
+endlabel1318: ;
 	cpuop_end();
 }
 
@@ -22821,10 +28953,10 @@ void REGPARAM2 CPUFUNC(op_6e01_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(14)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1214: ;
+endlabel1319: ;
 	cpuop_end();
 }
 
@@ -22836,10 +28968,10 @@ void REGPARAM2 CPUFUNC(op_6eff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(14)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1215: ;
+endlabel1320: ;
 	cpuop_end();
 }
 
@@ -22851,10 +28983,10 @@ void REGPARAM2 CPUFUNC(op_6f00_0)(uae_u32 opcode) /* Bcc.W #<data>.W */
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(15)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(4);
-endlabel1216: ;
+endlabel1321: ;
 	cpuop_end();
 }
 
@@ -22871,10 +29003,10 @@ void REGPARAM2 CPUFUNC(op_6f01_0)(uae_u32 opcode) /* Bcc.B #<data> */
 {{	uae_u32 src = srcreg;
 	if (!cctrue(15)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(2);
-endlabel1217: ;
+endlabel1322: ;
 	cpuop_end();
 }
 
@@ -22886,10 +29018,10 @@ void REGPARAM2 CPUFUNC(op_6fff_0)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {{	uae_s32 src = get_ilong(2);
 	if (!cctrue(15)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel1218: ;
+endlabel1323: ;
 	cpuop_end();
 }
 
@@ -22908,9 +29040,14 @@ void REGPARAM2 CPUFUNC(op_7000_0)(uae_u32 opcode) /* MOVE.L #<data>,Dn */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -22954,9 +29091,14 @@ void REGPARAM2 CPUFUNC(op_8000_0)(uae_u32 opcode) /* OR.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -22978,9 +29120,14 @@ void REGPARAM2 CPUFUNC(op_8010_0)(uae_u32 opcode) /* OR.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23003,9 +29150,14 @@ void REGPARAM2 CPUFUNC(op_8018_0)(uae_u32 opcode) /* OR.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23028,9 +29180,14 @@ void REGPARAM2 CPUFUNC(op_8020_0)(uae_u32 opcode) /* OR.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23052,9 +29209,14 @@ void REGPARAM2 CPUFUNC(op_8028_0)(uae_u32 opcode) /* OR.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23077,9 +29239,14 @@ void REGPARAM2 CPUFUNC(op_8030_0)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -23095,9 +29262,14 @@ void REGPARAM2 CPUFUNC(op_8038_0)(uae_u32 opcode) /* OR.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23114,9 +29286,14 @@ void REGPARAM2 CPUFUNC(op_8039_0)(uae_u32 opcode) /* OR.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23134,9 +29311,14 @@ void REGPARAM2 CPUFUNC(op_803a_0)(uae_u32 opcode) /* OR.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23155,9 +29337,14 @@ void REGPARAM2 CPUFUNC(op_803b_0)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -23172,9 +29359,14 @@ void REGPARAM2 CPUFUNC(op_803c_0)(uae_u32 opcode) /* OR.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -23195,9 +29387,14 @@ void REGPARAM2 CPUFUNC(op_8040_0)(uae_u32 opcode) /* OR.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -23219,9 +29416,14 @@ void REGPARAM2 CPUFUNC(op_8050_0)(uae_u32 opcode) /* OR.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23244,9 +29446,14 @@ void REGPARAM2 CPUFUNC(op_8058_0)(uae_u32 opcode) /* OR.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23269,9 +29476,14 @@ void REGPARAM2 CPUFUNC(op_8060_0)(uae_u32 opcode) /* OR.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23293,9 +29505,14 @@ void REGPARAM2 CPUFUNC(op_8068_0)(uae_u32 opcode) /* OR.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23318,9 +29535,14 @@ void REGPARAM2 CPUFUNC(op_8070_0)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -23336,9 +29558,14 @@ void REGPARAM2 CPUFUNC(op_8078_0)(uae_u32 opcode) /* OR.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23355,9 +29582,14 @@ void REGPARAM2 CPUFUNC(op_8079_0)(uae_u32 opcode) /* OR.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23375,9 +29607,14 @@ void REGPARAM2 CPUFUNC(op_807a_0)(uae_u32 opcode) /* OR.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23396,9 +29633,14 @@ void REGPARAM2 CPUFUNC(op_807b_0)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -23413,9 +29655,14 @@ void REGPARAM2 CPUFUNC(op_807c_0)(uae_u32 opcode) /* OR.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -23436,9 +29683,14 @@ void REGPARAM2 CPUFUNC(op_8080_0)(uae_u32 opcode) /* OR.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -23460,9 +29712,14 @@ void REGPARAM2 CPUFUNC(op_8090_0)(uae_u32 opcode) /* OR.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23485,9 +29742,14 @@ void REGPARAM2 CPUFUNC(op_8098_0)(uae_u32 opcode) /* OR.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23510,9 +29772,14 @@ void REGPARAM2 CPUFUNC(op_80a0_0)(uae_u32 opcode) /* OR.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -23534,9 +29801,14 @@ void REGPARAM2 CPUFUNC(op_80a8_0)(uae_u32 opcode) /* OR.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23559,9 +29831,14 @@ void REGPARAM2 CPUFUNC(op_80b0_0)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -23577,9 +29854,14 @@ void REGPARAM2 CPUFUNC(op_80b8_0)(uae_u32 opcode) /* OR.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23596,9 +29878,14 @@ void REGPARAM2 CPUFUNC(op_80b9_0)(uae_u32 opcode) /* OR.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -23616,9 +29903,14 @@ void REGPARAM2 CPUFUNC(op_80ba_0)(uae_u32 opcode) /* OR.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -23637,9 +29929,14 @@ void REGPARAM2 CPUFUNC(op_80bb_0)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -23654,9 +29951,14 @@ void REGPARAM2 CPUFUNC(op_80bc_0)(uae_u32 opcode) /* OR.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -23678,19 +29980,24 @@ void REGPARAM2 CPUFUNC(op_80c0_0)(uae_u32 opcode) /* DIVU.W Dn,Dn */
 {	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1255; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1360; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}endlabel1255: ;
+}}}endlabel1360: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80d0_0)(uae_u32 opcode) /* DIVU.W (An),Dn */
@@ -23711,19 +30018,24 @@ void REGPARAM2 CPUFUNC(op_80d0_0)(uae_u32 opcode) /* DIVU.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1256; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1361; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1256: ;
+}}}}endlabel1361: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80d8_0)(uae_u32 opcode) /* DIVU.W (An)+,Dn */
@@ -23745,19 +30057,24 @@ void REGPARAM2 CPUFUNC(op_80d8_0)(uae_u32 opcode) /* DIVU.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1257; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1362; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1257: ;
+}}}}endlabel1362: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80e0_0)(uae_u32 opcode) /* DIVU.W -(An),Dn */
@@ -23779,19 +30096,24 @@ void REGPARAM2 CPUFUNC(op_80e0_0)(uae_u32 opcode) /* DIVU.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1258; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1363; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1258: ;
+}}}}endlabel1363: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80e8_0)(uae_u32 opcode) /* DIVU.W (d16,An),Dn */
@@ -23812,19 +30134,24 @@ void REGPARAM2 CPUFUNC(op_80e8_0)(uae_u32 opcode) /* DIVU.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1259; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1364; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1259: ;
+}}}}endlabel1364: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80f0_0)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
@@ -23845,19 +30172,24 @@ void REGPARAM2 CPUFUNC(op_80f0_0)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1260; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1365; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}}endlabel1260: ;
+}}}}}endlabel1365: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80f8_0)(uae_u32 opcode) /* DIVU.W (xxx).W,Dn */
@@ -23873,19 +30205,24 @@ void REGPARAM2 CPUFUNC(op_80f8_0)(uae_u32 opcode) /* DIVU.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1261; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1366; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1261: ;
+}}}}endlabel1366: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80f9_0)(uae_u32 opcode) /* DIVU.W (xxx).L,Dn */
@@ -23901,19 +30238,24 @@ void REGPARAM2 CPUFUNC(op_80f9_0)(uae_u32 opcode) /* DIVU.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(6);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1262; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1367; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1262: ;
+}}}}endlabel1367: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80fa_0)(uae_u32 opcode) /* DIVU.W (d16,PC),Dn */
@@ -23930,19 +30272,24 @@ void REGPARAM2 CPUFUNC(op_80fa_0)(uae_u32 opcode) /* DIVU.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1263; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1368; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1263: ;
+}}}}endlabel1368: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80fb_0)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
@@ -23959,19 +30306,24 @@ void REGPARAM2 CPUFUNC(op_80fb_0)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1264; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1369; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}}endlabel1264: ;
+}}}}}endlabel1369: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80fc_0)(uae_u32 opcode) /* DIVU.W #<data>.W,Dn */
@@ -23986,19 +30338,24 @@ void REGPARAM2 CPUFUNC(op_80fc_0)(uae_u32 opcode) /* DIVU.W #<data>.W,Dn */
 {	uae_s16 src = get_iword(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel1265; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel1370; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}endlabel1265: ;
+}}}endlabel1370: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_8100_0)(uae_u32 opcode) /* SBCD.B Dn,Dn */
@@ -24080,9 +30437,14 @@ void REGPARAM2 CPUFUNC(op_8110_0)(uae_u32 opcode) /* OR.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24105,9 +30467,14 @@ void REGPARAM2 CPUFUNC(op_8118_0)(uae_u32 opcode) /* OR.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24130,9 +30497,14 @@ void REGPARAM2 CPUFUNC(op_8120_0)(uae_u32 opcode) /* OR.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24154,9 +30526,14 @@ void REGPARAM2 CPUFUNC(op_8128_0)(uae_u32 opcode) /* OR.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24179,9 +30556,14 @@ void REGPARAM2 CPUFUNC(op_8130_0)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24197,9 +30579,14 @@ void REGPARAM2 CPUFUNC(op_8138_0)(uae_u32 opcode) /* OR.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24216,9 +30603,14 @@ void REGPARAM2 CPUFUNC(op_8139_0)(uae_u32 opcode) /* OR.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24287,9 +30679,14 @@ void REGPARAM2 CPUFUNC(op_8150_0)(uae_u32 opcode) /* OR.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24312,9 +30709,14 @@ void REGPARAM2 CPUFUNC(op_8158_0)(uae_u32 opcode) /* OR.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24337,9 +30739,14 @@ void REGPARAM2 CPUFUNC(op_8160_0)(uae_u32 opcode) /* OR.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24361,9 +30768,14 @@ void REGPARAM2 CPUFUNC(op_8168_0)(uae_u32 opcode) /* OR.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24386,9 +30798,14 @@ void REGPARAM2 CPUFUNC(op_8170_0)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24404,9 +30821,14 @@ void REGPARAM2 CPUFUNC(op_8178_0)(uae_u32 opcode) /* OR.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24423,9 +30845,14 @@ void REGPARAM2 CPUFUNC(op_8179_0)(uae_u32 opcode) /* OR.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24496,9 +30923,14 @@ void REGPARAM2 CPUFUNC(op_8190_0)(uae_u32 opcode) /* OR.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24521,9 +30953,14 @@ void REGPARAM2 CPUFUNC(op_8198_0)(uae_u32 opcode) /* OR.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24546,9 +30983,14 @@ void REGPARAM2 CPUFUNC(op_81a0_0)(uae_u32 opcode) /* OR.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -24570,9 +31012,14 @@ void REGPARAM2 CPUFUNC(op_81a8_0)(uae_u32 opcode) /* OR.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24595,9 +31042,14 @@ void REGPARAM2 CPUFUNC(op_81b0_0)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -24613,9 +31065,14 @@ void REGPARAM2 CPUFUNC(op_81b8_0)(uae_u32 opcode) /* OR.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -24632,9 +31089,14 @@ void REGPARAM2 CPUFUNC(op_81b9_0)(uae_u32 opcode) /* OR.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -24656,20 +31118,25 @@ void REGPARAM2 CPUFUNC(op_81c0_0)(uae_u32 opcode) /* DIVS.W Dn,Dn */
 {	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1293; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1398; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}endlabel1293: ;
+}}}endlabel1398: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81d0_0)(uae_u32 opcode) /* DIVS.W (An),Dn */
@@ -24690,20 +31157,25 @@ void REGPARAM2 CPUFUNC(op_81d0_0)(uae_u32 opcode) /* DIVS.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1294; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1399; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1294: ;
+}}}}endlabel1399: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81d8_0)(uae_u32 opcode) /* DIVS.W (An)+,Dn */
@@ -24725,20 +31197,25 @@ void REGPARAM2 CPUFUNC(op_81d8_0)(uae_u32 opcode) /* DIVS.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1295; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1400; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1295: ;
+}}}}endlabel1400: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81e0_0)(uae_u32 opcode) /* DIVS.W -(An),Dn */
@@ -24760,20 +31237,25 @@ void REGPARAM2 CPUFUNC(op_81e0_0)(uae_u32 opcode) /* DIVS.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(2);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1296; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1401; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1296: ;
+}}}}endlabel1401: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81e8_0)(uae_u32 opcode) /* DIVS.W (d16,An),Dn */
@@ -24794,20 +31276,25 @@ void REGPARAM2 CPUFUNC(op_81e8_0)(uae_u32 opcode) /* DIVS.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1297; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1402; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1297: ;
+}}}}endlabel1402: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81f0_0)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
@@ -24828,20 +31315,25 @@ void REGPARAM2 CPUFUNC(op_81f0_0)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
 {	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1298; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1403; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}}endlabel1298: ;
+}}}}}endlabel1403: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81f8_0)(uae_u32 opcode) /* DIVS.W (xxx).W,Dn */
@@ -24857,20 +31349,25 @@ void REGPARAM2 CPUFUNC(op_81f8_0)(uae_u32 opcode) /* DIVS.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1299; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1404; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1299: ;
+}}}}endlabel1404: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81f9_0)(uae_u32 opcode) /* DIVS.W (xxx).L,Dn */
@@ -24886,20 +31383,25 @@ void REGPARAM2 CPUFUNC(op_81f9_0)(uae_u32 opcode) /* DIVS.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(6);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1300; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1405; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1300: ;
+}}}}endlabel1405: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81fa_0)(uae_u32 opcode) /* DIVS.W (d16,PC),Dn */
@@ -24916,20 +31418,25 @@ void REGPARAM2 CPUFUNC(op_81fa_0)(uae_u32 opcode) /* DIVS.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1301; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1406; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel1301: ;
+}}}}endlabel1406: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81fb_0)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
@@ -24946,20 +31453,25 @@ void REGPARAM2 CPUFUNC(op_81fb_0)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1302; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1407; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}}endlabel1302: ;
+}}}}}endlabel1407: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81fc_0)(uae_u32 opcode) /* DIVS.W #<data>.W,Dn */
@@ -24974,20 +31486,25 @@ void REGPARAM2 CPUFUNC(op_81fc_0)(uae_u32 opcode) /* DIVS.W #<data>.W,Dn */
 {	uae_s16 src = get_iword(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel1303; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel1408; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}endlabel1303: ;
+}}}endlabel1408: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB.B Dn,Dn */
@@ -25006,6 +31523,11 @@ void REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25014,6 +31536,7 @@ void REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB.B Dn,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25035,6 +31558,11 @@ void REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25043,6 +31571,7 @@ void REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB.B (An),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25065,6 +31594,11 @@ void REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25073,6 +31607,7 @@ void REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB.B (An)+,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25095,6 +31630,11 @@ void REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25103,6 +31643,7 @@ void REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB.B -(An),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25124,6 +31665,11 @@ void REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25132,6 +31678,7 @@ void REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB.B (d16,An),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25154,6 +31701,11 @@ void REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25162,6 +31714,7 @@ void REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	cpuop_end();
 }
@@ -25177,6 +31730,11 @@ void REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25185,6 +31743,7 @@ void REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB.B (xxx).W,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25201,6 +31760,11 @@ void REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25209,6 +31773,7 @@ void REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB.B (xxx).L,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -25226,6 +31791,11 @@ void REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25234,6 +31804,7 @@ void REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB.B (d16,PC),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25252,6 +31823,11 @@ void REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25260,6 +31836,7 @@ void REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	cpuop_end();
 }
@@ -25274,6 +31851,11 @@ void REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -25282,6 +31864,7 @@ void REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB.B #<data>.B,Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25302,6 +31885,11 @@ void REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25310,6 +31898,7 @@ void REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB.W Dn,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25330,6 +31919,11 @@ void REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25338,6 +31932,7 @@ void REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB.W An,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25359,6 +31954,11 @@ void REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25367,6 +31967,7 @@ void REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB.W (An),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25389,6 +31990,11 @@ void REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25397,6 +32003,7 @@ void REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB.W (An)+,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25419,6 +32026,11 @@ void REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25427,6 +32039,7 @@ void REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB.W -(An),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25448,6 +32061,11 @@ void REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25456,6 +32074,7 @@ void REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB.W (d16,An),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25478,6 +32097,11 @@ void REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25486,6 +32110,7 @@ void REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	cpuop_end();
 }
@@ -25501,6 +32126,11 @@ void REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25509,6 +32139,7 @@ void REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB.W (xxx).W,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25525,6 +32156,11 @@ void REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25533,6 +32169,7 @@ void REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB.W (xxx).L,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -25550,6 +32187,11 @@ void REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25558,6 +32200,7 @@ void REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB.W (d16,PC),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25576,6 +32219,11 @@ void REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25584,6 +32232,7 @@ void REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	cpuop_end();
 }
@@ -25598,6 +32247,11 @@ void REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -25606,6 +32260,7 @@ void REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB.W #<data>.W,Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25626,6 +32281,11 @@ void REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25634,6 +32294,7 @@ void REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB.L Dn,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25654,6 +32315,11 @@ void REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB.L An,Dn */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25662,6 +32328,7 @@ void REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB.L An,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25683,6 +32350,11 @@ void REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25691,6 +32363,7 @@ void REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB.L (An),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25713,6 +32386,11 @@ void REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25721,6 +32399,7 @@ void REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB.L (An)+,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25743,6 +32422,11 @@ void REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25751,6 +32435,7 @@ void REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB.L -(An),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -25772,6 +32457,11 @@ void REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25780,6 +32470,7 @@ void REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB.L (d16,An),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25802,6 +32493,11 @@ void REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25810,6 +32506,7 @@ void REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}	cpuop_end();
 }
@@ -25825,6 +32522,11 @@ void REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25833,6 +32535,7 @@ void REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB.L (xxx).W,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25849,6 +32552,11 @@ void REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25857,6 +32565,7 @@ void REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB.L (xxx).L,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -25874,6 +32583,11 @@ void REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25882,6 +32596,7 @@ void REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB.L (d16,PC),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -25900,6 +32615,11 @@ void REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25908,6 +32628,7 @@ void REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}	cpuop_end();
 }
@@ -25922,6 +32643,11 @@ void REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -25930,6 +32656,7 @@ void REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB.L #<data>.L,Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -26275,6 +33002,11 @@ void REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26283,6 +33015,7 @@ void REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB.B Dn,(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26305,6 +33038,11 @@ void REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26313,6 +33051,7 @@ void REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB.B Dn,(An)+ */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26335,6 +33074,11 @@ void REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26343,6 +33087,7 @@ void REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB.B Dn,-(An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26364,6 +33109,11 @@ void REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26372,6 +33122,7 @@ void REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB.B Dn,(d16,An) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -26394,6 +33145,11 @@ void REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26402,6 +33158,7 @@ void REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -26417,6 +33174,11 @@ void REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26425,6 +33187,7 @@ void REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).W */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -26441,6 +33204,11 @@ void REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -26449,6 +33217,7 @@ void REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB.B Dn,(xxx).L */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -26530,6 +33299,11 @@ void REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26538,6 +33312,7 @@ void REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB.W Dn,(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26560,6 +33335,11 @@ void REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26568,6 +33348,7 @@ void REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB.W Dn,(An)+ */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26590,6 +33371,11 @@ void REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26598,6 +33384,7 @@ void REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB.W Dn,-(An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26619,6 +33406,11 @@ void REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26627,6 +33419,7 @@ void REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB.W Dn,(d16,An) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -26649,6 +33442,11 @@ void REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26657,6 +33455,7 @@ void REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -26672,6 +33471,11 @@ void REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26680,6 +33484,7 @@ void REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).W */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -26696,6 +33501,11 @@ void REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -26704,6 +33514,7 @@ void REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB.W Dn,(xxx).L */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -26785,6 +33596,11 @@ void REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26793,6 +33609,7 @@ void REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB.L Dn,(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26815,6 +33632,11 @@ void REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26823,6 +33645,7 @@ void REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB.L Dn,(An)+ */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26845,6 +33668,11 @@ void REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26853,6 +33681,7 @@ void REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB.L Dn,-(An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -26874,6 +33703,11 @@ void REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26882,6 +33716,7 @@ void REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB.L Dn,(d16,An) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -26904,6 +33739,11 @@ void REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26912,6 +33752,7 @@ void REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -26927,6 +33768,11 @@ void REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26935,6 +33781,7 @@ void REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).W */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -26951,6 +33798,11 @@ void REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -26959,6 +33811,7 @@ void REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB.L Dn,(xxx).L */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -27243,6 +34096,42 @@ void REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b000_0_fuse)(uae_u32 opcode) /* CMP.B Dn,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27250,9 +34139,12 @@ void REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP.B Dn,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP.B (An),Dn */
 {
 	cpuop_begin();
@@ -27270,6 +34162,43 @@ void REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b010_0_fuse)(uae_u32 opcode) /* CMP.B (An),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27277,9 +34206,12 @@ void REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP.B (An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP.B (An)+,Dn */
 {
 	cpuop_begin();
@@ -27298,6 +34230,47 @@ void REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b018_0_fuse)(uae_u32 opcode) /* CMP.B (An)+,Dn + DBcc/Bcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27305,9 +34278,13 @@ void REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP.B (An)+,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP.B -(An),Dn */
 {
 	cpuop_begin();
@@ -27326,6 +34303,44 @@ void REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b020_0_fuse)(uae_u32 opcode) /* CMP.B -(An),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27333,9 +34348,12 @@ void REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP.B -(An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP.B (d16,An),Dn */
 {
 	cpuop_begin();
@@ -27353,6 +34371,43 @@ void REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b028_0_fuse)(uae_u32 opcode) /* CMP.B (d16,An),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27360,9 +34415,12 @@ void REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP.B (d16,An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 {
 	cpuop_begin();
@@ -27381,6 +34439,10 @@ void REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27388,8 +34450,44 @@ void REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b030_0_fuse)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP.B (xxx).W,Dn */
 {
 	cpuop_begin();
@@ -27402,6 +34500,38 @@ void REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b038_0_fuse)(uae_u32 opcode) /* CMP.B (xxx).W,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27409,9 +34539,12 @@ void REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP.B (xxx).W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP.B (xxx).L,Dn */
 {
 	cpuop_begin();
@@ -27424,6 +34557,38 @@ void REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b039_0_fuse)(uae_u32 opcode) /* CMP.B (xxx).L,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27431,9 +34596,12 @@ void REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP.B (xxx).L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP.B (d16,PC),Dn */
 {
 	cpuop_begin();
@@ -27447,6 +34615,39 @@ void REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b03a_0_fuse)(uae_u32 opcode) /* CMP.B (d16,PC),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27454,9 +34655,12 @@ void REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP.B (d16,PC),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
@@ -27471,6 +34675,10 @@ void REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27478,8 +34686,40 @@ void REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b03b_0_fuse)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {
 	cpuop_begin();
@@ -27491,6 +34731,37 @@ void REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b03c_0_fuse)(uae_u32 opcode) /* CMP.B #<data>.B,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -27498,9 +34769,12 @@ void REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP.B #<data>.B,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP.W Dn,Dn */
 {
 	cpuop_begin();
@@ -27517,6 +34791,42 @@ void REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b040_0_fuse)(uae_u32 opcode) /* CMP.W Dn,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27524,10 +34834,13 @@ void REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP.W Dn,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
 #endif
+#endif
 
 #ifdef PART_7
 void REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP.W An,Dn */
@@ -27546,6 +34859,10 @@ void REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27553,10 +34870,12 @@ void REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP.W An,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b048_0_fuse)(uae_u32 opcode) /* CMP.W An,Dn + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27569,10 +34888,13 @@ void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s16 src = get_word(srca);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27580,10 +34902,13 @@ void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+#endif
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP.W (An),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27598,9 +34923,12 @@ void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27608,10 +34936,12 @@ void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b050_0_fuse)(uae_u32 opcode) /* CMP.W (An),Dn + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27624,11 +34954,14 @@ void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27636,10 +34969,13 @@ void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP.W (An)+,Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27652,10 +34988,15 @@ void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27663,12 +35004,16 @@ void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+#endif
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b058_0_fuse)(uae_u32 opcode) /* CMP.W (An)+,Dn + DBcc/Bcc */
 {
 	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -27679,11 +35024,16 @@ void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{m68k_incpc(2);
-{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27691,20 +35041,35 @@ void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+#endif
+}}}}}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
+	m68k_fuse_bcc ();
+	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP.W (xxx).W,Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP.W -(An),Dn */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27712,21 +35077,33 @@ void REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP.W (xxx).W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+#endif
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP.W (xxx).L,Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b060_0_fuse)(uae_u32 opcode) /* CMP.W -(An),Dn + Bcc */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_ilong(2);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 {	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27734,22 +35111,33 @@ void REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP.W (xxx).L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+#endif
+}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP.W (d16,PC),Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP.W (d16,An),Dn */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_getpc () + 2;
-	srca += (uae_s32)(uae_s16)get_iword(2);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27757,23 +35145,32 @@ void REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP.W (d16,PC),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b068_0_fuse)(uae_u32 opcode) /* CMP.W (d16,An),Dn + Bcc */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{m68k_incpc(2);
-{	uaecptr tmppc = m68k_getpc();
-	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27781,19 +35178,34 @@ void REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s16 src = get_iword(2);
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -27801,25 +35213,1078 @@ void REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
-	cpuop_end();
+#endif
+}}}}}}}}	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP.L Dn,Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b070_0_fuse)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP.W (xxx).W,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b078_0_fuse)(uae_u32 opcode) /* CMP.W (xxx).W,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP.W (xxx).L,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b079_0_fuse)(uae_u32 opcode) /* CMP.W (xxx).L,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP.W (d16,PC),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b07a_0_fuse)(uae_u32 opcode) /* CMP.W (d16,PC),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b07b_0_fuse)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP.W #<data>.W,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b07c_0_fuse)(uae_u32 opcode) /* CMP.W #<data>.W,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP.L Dn,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b080_0_fuse)(uae_u32 opcode) /* CMP.L Dn,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b088_0_fuse)(uae_u32 opcode) /* CMP.L An,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b090_0_fuse)(uae_u32 opcode) /* CMP.L (An),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b098_0_fuse)(uae_u32 opcode) /* CMP.L (An)+,Dn + DBcc/Bcc */
+{
+	cpuop_begin();
+	uae_u8 *fuse_start = regs.pc_p;
+	int fuse_budget = FUSE_LOOP_BUDGET;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+fuse_again:;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	if (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0a0_0_fuse)(uae_u32 opcode) /* CMP.L -(An),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0a8_0_fuse)(uae_u32 opcode) /* CMP.L (d16,An),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0b0_0_fuse)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP.L (xxx).W,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0b8_0_fuse)(uae_u32 opcode) /* CMP.L (xxx).W,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP.L (xxx).L,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0b9_0_fuse)(uae_u32 opcode) /* CMP.L (xxx).L,Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP.L (d16,PC),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0ba_0_fuse)(uae_u32 opcode) /* CMP.L (d16,PC),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0bb_0_fuse)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
+void REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0bc_0_fuse)(uae_u32 opcode) /* CMP.L #<data>.L,Dn + Bcc */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27827,10 +36292,13 @@ void REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP.L Dn,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+#endif
+}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27843,9 +36311,13 @@ void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s32 src = m68k_areg(regs, srcreg);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27853,10 +36325,12 @@ void REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP.L An,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0c0_0_fuse)(uae_u32 opcode) /* CMPA.W Dn,An + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27869,10 +36343,13 @@ void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27880,10 +36357,13 @@ void REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP.L (An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+#endif
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27896,11 +36376,13 @@ void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s32 src = get_long(srca);
-	m68k_areg(regs, srcreg) += 4;
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27908,10 +36390,12 @@ void REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP.L (An)+,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+#endif
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0c8_0_fuse)(uae_u32 opcode) /* CMPA.W An,An + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27924,11 +36408,13 @@ void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
-{	uae_s32 src = get_long(srca);
-	m68k_areg (regs, srcreg) = srca;
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27936,10 +36422,13 @@ void REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP.L -(An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+#endif
+}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27952,10 +36441,14 @@ void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27963,10 +36456,12 @@ void REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP.L (d16,An),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+#endif
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0d0_0_fuse)(uae_u32 opcode) /* CMPA.W (An),An + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -27979,11 +36474,14 @@ void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{m68k_incpc(2);
-{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -27991,20 +36489,34 @@ void REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+#endif
+}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP.L (xxx).W,Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA.W (An)+,An */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28012,21 +36524,33 @@ void REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP.L (xxx).W,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+#endif
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP.L (xxx).L,Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0d8_0_fuse)(uae_u32 opcode) /* CMPA.W (An)+,An + Bcc */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_ilong(2);
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28034,22 +36558,34 @@ void REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP.L (xxx).L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+#endif
+}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP.L (d16,PC),Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA.W -(An),An */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_getpc () + 2;
-	srca += (uae_s32)(uae_s16)get_iword(2);
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28057,23 +36593,33 @@ void REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP.L (d16,PC),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+#endif
+}}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0e0_0_fuse)(uae_u32 opcode) /* CMPA.W -(An),An + Bcc */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{m68k_incpc(2);
-{	uaecptr tmppc = m68k_getpc();
-	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28081,19 +36627,33 @@ void REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+#endif
+}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
+#endif
+void REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA.W (d16,An),An */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28101,10 +36661,12 @@ void REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP.L #<data>.L,Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+#endif
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0e8_0_fuse)(uae_u32 opcode) /* CMPA.W (d16,An),An + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -28117,9 +36679,14 @@ void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28127,10 +36694,13 @@ void REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA.W Dn,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
+#endif
+void REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -28143,9 +36713,15 @@ void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s16 src = m68k_areg(regs, srcreg);
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28153,10 +36729,11 @@ void REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA.W An,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
-	cpuop_end();
+#endif
+}}}}}}}}	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0f0_0_fuse)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -28169,10 +36746,15 @@ void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28180,27 +36762,27 @@ void REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA.W (An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA.W (An)+,An */
+#endif
+void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	m68k_areg(regs, srcreg) += 2;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28208,27 +36790,27 @@ void REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA.W (An)+,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+#endif
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA.W -(An),An */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0f8_0_fuse)(uae_u32 opcode) /* CMPA.W (xxx).W,An + Bcc */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28236,26 +36818,28 @@ void REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA.W -(An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA.W (d16,An),An */
+#endif
+void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28263,27 +36847,27 @@ void REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA.W (d16,An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+#endif
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0f9_0_fuse)(uae_u32 opcode) /* CMPA.W (xxx).L,An + Bcc */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{m68k_incpc(2);
-{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28291,9 +36875,13 @@ void REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+#endif
+}}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
+	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
+#endif
+void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -28301,10 +36889,15 @@ void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28312,10 +36905,12 @@ void REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA.W (xxx).W,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0fa_0_fuse)(uae_u32 opcode) /* CMPA.W (d16,PC),An + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -28323,10 +36918,15 @@ void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_ilong(2);
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28334,10 +36934,13 @@ void REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA.W (xxx).L,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
+#endif
+void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -28345,11 +36948,16 @@ void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_getpc () + 2;
-	srca += (uae_s32)(uae_s16)get_iword(2);
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28357,10 +36965,11 @@ void REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA.W (d16,PC),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
+#endif
+}}}}}}}}	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0fb_0_fuse)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An + Bcc */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -28374,6 +36983,10 @@ void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28381,8 +36994,11 @@ void REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
-}}}}}}}}	cpuop_end();
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA.W #<data>.W,An */
 {
 	cpuop_begin();
@@ -28394,6 +37010,37 @@ void REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA.W #<data>.W,An */
 {{	uae_s16 src = get_iword(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b0fc_0_fuse)(uae_u32 opcode) /* CMPA.W #<data>.W,An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28401,9 +37048,12 @@ void REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA.W #<data>.W,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b100_0)(uae_u32 opcode) /* EOR.B Dn,Dn */
 {
 	cpuop_begin();
@@ -28420,9 +37070,14 @@ void REGPARAM2 CPUFUNC(op_b100_0)(uae_u32 opcode) /* EOR.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28447,6 +37102,46 @@ void REGPARAM2 CPUFUNC(op_b108_0)(uae_u32 opcode) /* CMPM.B (An)+,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b108_0_fuse)(uae_u32 opcode) /* CMPM.B (An)+,(An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -28454,9 +37149,12 @@ void REGPARAM2 CPUFUNC(op_b108_0)(uae_u32 opcode) /* CMPM.B (An)+,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b110_0)(uae_u32 opcode) /* EOR.B Dn,(An) */
 {
 	cpuop_begin();
@@ -28474,9 +37172,14 @@ void REGPARAM2 CPUFUNC(op_b110_0)(uae_u32 opcode) /* EOR.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28499,9 +37202,14 @@ void REGPARAM2 CPUFUNC(op_b118_0)(uae_u32 opcode) /* EOR.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28524,9 +37232,14 @@ void REGPARAM2 CPUFUNC(op_b120_0)(uae_u32 opcode) /* EOR.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28548,9 +37261,14 @@ void REGPARAM2 CPUFUNC(op_b128_0)(uae_u32 opcode) /* EOR.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28573,9 +37291,14 @@ void REGPARAM2 CPUFUNC(op_b130_0)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -28591,9 +37314,14 @@ void REGPARAM2 CPUFUNC(op_b138_0)(uae_u32 opcode) /* EOR.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28610,9 +37338,14 @@ void REGPARAM2 CPUFUNC(op_b139_0)(uae_u32 opcode) /* EOR.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -28633,9 +37366,14 @@ void REGPARAM2 CPUFUNC(op_b140_0)(uae_u32 opcode) /* EOR.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28660,6 +37398,46 @@ void REGPARAM2 CPUFUNC(op_b148_0)(uae_u32 opcode) /* CMPM.W (An)+,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b148_0_fuse)(uae_u32 opcode) /* CMPM.W (An)+,(An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -28667,9 +37445,12 @@ void REGPARAM2 CPUFUNC(op_b148_0)(uae_u32 opcode) /* CMPM.W (An)+,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b150_0)(uae_u32 opcode) /* EOR.W Dn,(An) */
 {
 	cpuop_begin();
@@ -28687,9 +37468,14 @@ void REGPARAM2 CPUFUNC(op_b150_0)(uae_u32 opcode) /* EOR.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28712,9 +37498,14 @@ void REGPARAM2 CPUFUNC(op_b158_0)(uae_u32 opcode) /* EOR.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28737,9 +37528,14 @@ void REGPARAM2 CPUFUNC(op_b160_0)(uae_u32 opcode) /* EOR.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28761,9 +37557,14 @@ void REGPARAM2 CPUFUNC(op_b168_0)(uae_u32 opcode) /* EOR.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28786,9 +37587,14 @@ void REGPARAM2 CPUFUNC(op_b170_0)(uae_u32 opcode) /* EOR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -28804,9 +37610,14 @@ void REGPARAM2 CPUFUNC(op_b178_0)(uae_u32 opcode) /* EOR.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28823,9 +37634,14 @@ void REGPARAM2 CPUFUNC(op_b179_0)(uae_u32 opcode) /* EOR.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -28846,9 +37662,14 @@ void REGPARAM2 CPUFUNC(op_b180_0)(uae_u32 opcode) /* EOR.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -28873,6 +37694,46 @@ void REGPARAM2 CPUFUNC(op_b188_0)(uae_u32 opcode) /* CMPM.L (An)+,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b188_0_fuse)(uae_u32 opcode) /* CMPM.L (An)+,(An)+ + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -28880,9 +37741,12 @@ void REGPARAM2 CPUFUNC(op_b188_0)(uae_u32 opcode) /* CMPM.L (An)+,(An)+ */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b190_0)(uae_u32 opcode) /* EOR.L Dn,(An) */
 {
 	cpuop_begin();
@@ -28900,9 +37764,14 @@ void REGPARAM2 CPUFUNC(op_b190_0)(uae_u32 opcode) /* EOR.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28925,9 +37794,14 @@ void REGPARAM2 CPUFUNC(op_b198_0)(uae_u32 opcode) /* EOR.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28950,9 +37824,14 @@ void REGPARAM2 CPUFUNC(op_b1a0_0)(uae_u32 opcode) /* EOR.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -28974,9 +37853,14 @@ void REGPARAM2 CPUFUNC(op_b1a8_0)(uae_u32 opcode) /* EOR.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -28999,9 +37883,14 @@ void REGPARAM2 CPUFUNC(op_b1b0_0)(uae_u32 opcode) /* EOR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -29017,9 +37906,14 @@ void REGPARAM2 CPUFUNC(op_b1b8_0)(uae_u32 opcode) /* EOR.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29036,9 +37930,14 @@ void REGPARAM2 CPUFUNC(op_b1b9_0)(uae_u32 opcode) /* EOR.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29059,6 +37958,42 @@ void REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA.L Dn,An */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1c0_0_fuse)(uae_u32 opcode) /* CMPA.L Dn,An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29066,9 +38001,12 @@ void REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA.L Dn,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA.L An,An */
 {
 	cpuop_begin();
@@ -29085,6 +38023,42 @@ void REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA.L An,An */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1c8_0_fuse)(uae_u32 opcode) /* CMPA.L An,An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29092,9 +38066,12 @@ void REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA.L An,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA.L (An),An */
 {
 	cpuop_begin();
@@ -29112,6 +38089,43 @@ void REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA.L (An),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1d0_0_fuse)(uae_u32 opcode) /* CMPA.L (An),An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29119,9 +38133,12 @@ void REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA.L (An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA.L (An)+,An */
 {
 	cpuop_begin();
@@ -29140,6 +38157,10 @@ void REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA.L (An)+,An */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29147,9 +38168,46 @@ void REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA.L (An)+,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1d8_0_fuse)(uae_u32 opcode) /* CMPA.L (An)+,An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA.L -(An),An */
 {
 	cpuop_begin();
@@ -29168,6 +38226,44 @@ void REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA.L -(An),An */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(2);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1e0_0_fuse)(uae_u32 opcode) /* CMPA.L -(An),An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29175,9 +38271,12 @@ void REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA.L -(An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(2);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA.L (d16,An),An */
 {
 	cpuop_begin();
@@ -29195,6 +38294,10 @@ void REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA.L (d16,An),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29202,9 +38305,45 @@ void REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA.L (d16,An),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1e8_0_fuse)(uae_u32 opcode) /* CMPA.L (d16,An),An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 {
 	cpuop_begin();
@@ -29223,6 +38362,10 @@ void REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29230,8 +38373,44 @@ void REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1f0_0_fuse)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA.L (xxx).W,An */
 {
 	cpuop_begin();
@@ -29244,6 +38423,38 @@ void REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA.L (xxx).W,An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1f8_0_fuse)(uae_u32 opcode) /* CMPA.L (xxx).W,An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29251,9 +38462,12 @@ void REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA.L (xxx).W,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA.L (xxx).L,An */
 {
 	cpuop_begin();
@@ -29266,6 +38480,38 @@ void REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA.L (xxx).L,An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1f9_0_fuse)(uae_u32 opcode) /* CMPA.L (xxx).L,An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29273,9 +38519,12 @@ void REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA.L (xxx).L,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA.L (d16,PC),An */
 {
 	cpuop_begin();
@@ -29289,6 +38538,39 @@ void REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA.L (d16,PC),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1fa_0_fuse)(uae_u32 opcode) /* CMPA.L (d16,PC),An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29296,9 +38578,12 @@ void REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA.L (d16,PC),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 {
 	cpuop_begin();
@@ -29313,6 +38598,10 @@ void REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29320,8 +38609,40 @@ void REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}}	cpuop_end();
 }
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1fb_0_fuse)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{m68k_incpc(2);
+{	uaecptr tmppc = m68k_getpc();
+	uaecptr srca = get_disp_ea_020(tmppc, next_iword());
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}}}	m68k_fuse_bcc ();
+	cpuop_end();
+}
+#endif
 void REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA.L #<data>.L,An */
 {
 	cpuop_begin();
@@ -29333,6 +38654,37 @@ void REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA.L #<data>.L,An */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+#endif
+}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+#if USE_SUPERINSNS
+void REGPARAM2 CPUFUNC(op_b1fc_0_fuse)(uae_u32 opcode) /* CMPA.L #<data>.L,An + Bcc */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -29340,9 +38692,12 @@ void REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA.L #<data>.L,An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}m68k_incpc(6);
+	m68k_fuse_bcc ();
 	cpuop_end();
 }
+#endif
 void REGPARAM2 CPUFUNC(op_c000_0)(uae_u32 opcode) /* AND.B Dn,Dn */
 {
 	cpuop_begin();
@@ -29359,9 +38714,14 @@ void REGPARAM2 CPUFUNC(op_c000_0)(uae_u32 opcode) /* AND.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29383,9 +38743,14 @@ void REGPARAM2 CPUFUNC(op_c010_0)(uae_u32 opcode) /* AND.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29408,9 +38773,14 @@ void REGPARAM2 CPUFUNC(op_c018_0)(uae_u32 opcode) /* AND.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29433,9 +38803,14 @@ void REGPARAM2 CPUFUNC(op_c020_0)(uae_u32 opcode) /* AND.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29457,9 +38832,14 @@ void REGPARAM2 CPUFUNC(op_c028_0)(uae_u32 opcode) /* AND.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29482,9 +38862,14 @@ void REGPARAM2 CPUFUNC(op_c030_0)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -29500,9 +38885,14 @@ void REGPARAM2 CPUFUNC(op_c038_0)(uae_u32 opcode) /* AND.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29519,9 +38909,14 @@ void REGPARAM2 CPUFUNC(op_c039_0)(uae_u32 opcode) /* AND.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29539,9 +38934,14 @@ void REGPARAM2 CPUFUNC(op_c03a_0)(uae_u32 opcode) /* AND.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29560,9 +38960,14 @@ void REGPARAM2 CPUFUNC(op_c03b_0)(uae_u32 opcode) /* AND.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	cpuop_end();
 }
@@ -29577,9 +38982,14 @@ void REGPARAM2 CPUFUNC(op_c03c_0)(uae_u32 opcode) /* AND.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -29600,9 +39010,14 @@ void REGPARAM2 CPUFUNC(op_c040_0)(uae_u32 opcode) /* AND.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29624,9 +39039,14 @@ void REGPARAM2 CPUFUNC(op_c050_0)(uae_u32 opcode) /* AND.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29649,9 +39069,14 @@ void REGPARAM2 CPUFUNC(op_c058_0)(uae_u32 opcode) /* AND.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29674,9 +39099,14 @@ void REGPARAM2 CPUFUNC(op_c060_0)(uae_u32 opcode) /* AND.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29698,9 +39128,14 @@ void REGPARAM2 CPUFUNC(op_c068_0)(uae_u32 opcode) /* AND.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29723,9 +39158,14 @@ void REGPARAM2 CPUFUNC(op_c070_0)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -29741,9 +39181,14 @@ void REGPARAM2 CPUFUNC(op_c078_0)(uae_u32 opcode) /* AND.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29760,9 +39205,14 @@ void REGPARAM2 CPUFUNC(op_c079_0)(uae_u32 opcode) /* AND.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -29780,9 +39230,14 @@ void REGPARAM2 CPUFUNC(op_c07a_0)(uae_u32 opcode) /* AND.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29801,9 +39256,14 @@ void REGPARAM2 CPUFUNC(op_c07b_0)(uae_u32 opcode) /* AND.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	cpuop_end();
 }
@@ -29818,9 +39278,14 @@ void REGPARAM2 CPUFUNC(op_c07c_0)(uae_u32 opcode) /* AND.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -29841,9 +39306,14 @@ void REGPARAM2 CPUFUNC(op_c080_0)(uae_u32 opcode) /* AND.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 	cpuop_end();
@@ -29865,9 +39335,14 @@ void REGPARAM2 CPUFUNC(op_c090_0)(uae_u32 opcode) /* AND.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29890,9 +39365,14 @@ void REGPARAM2 CPUFUNC(op_c098_0)(uae_u32 opcode) /* AND.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29915,9 +39395,14 @@ void REGPARAM2 CPUFUNC(op_c0a0_0)(uae_u32 opcode) /* AND.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -29939,9 +39424,14 @@ void REGPARAM2 CPUFUNC(op_c0a8_0)(uae_u32 opcode) /* AND.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -29964,9 +39454,14 @@ void REGPARAM2 CPUFUNC(op_c0b0_0)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -29982,9 +39477,14 @@ void REGPARAM2 CPUFUNC(op_c0b8_0)(uae_u32 opcode) /* AND.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30001,9 +39501,14 @@ void REGPARAM2 CPUFUNC(op_c0b9_0)(uae_u32 opcode) /* AND.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30021,9 +39526,14 @@ void REGPARAM2 CPUFUNC(op_c0ba_0)(uae_u32 opcode) /* AND.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30042,9 +39552,14 @@ void REGPARAM2 CPUFUNC(op_c0bb_0)(uae_u32 opcode) /* AND.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}	cpuop_end();
 }
@@ -30059,9 +39574,14 @@ void REGPARAM2 CPUFUNC(op_c0bc_0)(uae_u32 opcode) /* AND.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -30082,9 +39602,14 @@ void REGPARAM2 CPUFUNC(op_c0c0_0)(uae_u32 opcode) /* MULU.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30106,9 +39631,14 @@ void REGPARAM2 CPUFUNC(op_c0d0_0)(uae_u32 opcode) /* MULU.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30131,9 +39661,14 @@ void REGPARAM2 CPUFUNC(op_c0d8_0)(uae_u32 opcode) /* MULU.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30156,9 +39691,14 @@ void REGPARAM2 CPUFUNC(op_c0e0_0)(uae_u32 opcode) /* MULU.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30180,9 +39720,14 @@ void REGPARAM2 CPUFUNC(op_c0e8_0)(uae_u32 opcode) /* MULU.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30205,9 +39750,14 @@ void REGPARAM2 CPUFUNC(op_c0f0_0)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -30223,9 +39773,14 @@ void REGPARAM2 CPUFUNC(op_c0f8_0)(uae_u32 opcode) /* MULU.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30242,9 +39797,14 @@ void REGPARAM2 CPUFUNC(op_c0f9_0)(uae_u32 opcode) /* MULU.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 	cpuop_end();
@@ -30262,9 +39822,14 @@ void REGPARAM2 CPUFUNC(op_c0fa_0)(uae_u32 opcode) /* MULU.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -30283,9 +39848,14 @@ void REGPARAM2 CPUFUNC(op_c0fb_0)(uae_u32 opcode) /* MULU.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -30300,9 +39870,14 @@ void REGPARAM2 CPUFUNC(op_c0fc_0)(uae_u32 opcode) /* MULU.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30388,9 +39963,14 @@ void REGPARAM2 CPUFUNC(op_c110_0)(uae_u32 opcode) /* AND.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30413,9 +39993,14 @@ void REGPARAM2 CPUFUNC(op_c118_0)(uae_u32 opcode) /* AND.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30438,9 +40023,14 @@ void REGPARAM2 CPUFUNC(op_c120_0)(uae_u32 opcode) /* AND.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30462,9 +40052,14 @@ void REGPARAM2 CPUFUNC(op_c128_0)(uae_u32 opcode) /* AND.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30487,9 +40082,14 @@ void REGPARAM2 CPUFUNC(op_c130_0)(uae_u32 opcode) /* AND.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30505,9 +40105,14 @@ void REGPARAM2 CPUFUNC(op_c138_0)(uae_u32 opcode) /* AND.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30524,9 +40129,14 @@ void REGPARAM2 CPUFUNC(op_c139_0)(uae_u32 opcode) /* AND.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30594,9 +40204,14 @@ void REGPARAM2 CPUFUNC(op_c150_0)(uae_u32 opcode) /* AND.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30619,9 +40234,14 @@ void REGPARAM2 CPUFUNC(op_c158_0)(uae_u32 opcode) /* AND.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30644,9 +40264,14 @@ void REGPARAM2 CPUFUNC(op_c160_0)(uae_u32 opcode) /* AND.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30668,9 +40293,14 @@ void REGPARAM2 CPUFUNC(op_c168_0)(uae_u32 opcode) /* AND.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30693,9 +40323,14 @@ void REGPARAM2 CPUFUNC(op_c170_0)(uae_u32 opcode) /* AND.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30711,9 +40346,14 @@ void REGPARAM2 CPUFUNC(op_c178_0)(uae_u32 opcode) /* AND.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30730,9 +40370,14 @@ void REGPARAM2 CPUFUNC(op_c179_0)(uae_u32 opcode) /* AND.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30777,9 +40422,14 @@ void REGPARAM2 CPUFUNC(op_c190_0)(uae_u32 opcode) /* AND.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30802,9 +40452,14 @@ void REGPARAM2 CPUFUNC(op_c198_0)(uae_u32 opcode) /* AND.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30827,9 +40482,14 @@ void REGPARAM2 CPUFUNC(op_c1a0_0)(uae_u32 opcode) /* AND.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30851,9 +40511,14 @@ void REGPARAM2 CPUFUNC(op_c1a8_0)(uae_u32 opcode) /* AND.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30876,9 +40541,14 @@ void REGPARAM2 CPUFUNC(op_c1b0_0)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}}	cpuop_end();
 }
@@ -30894,9 +40564,14 @@ void REGPARAM2 CPUFUNC(op_c1b8_0)(uae_u32 opcode) /* AND.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -30913,9 +40588,14 @@ void REGPARAM2 CPUFUNC(op_c1b9_0)(uae_u32 opcode) /* AND.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -30936,9 +40616,14 @@ void REGPARAM2 CPUFUNC(op_c1c0_0)(uae_u32 opcode) /* MULS.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 	cpuop_end();
@@ -30960,9 +40645,14 @@ void REGPARAM2 CPUFUNC(op_c1d0_0)(uae_u32 opcode) /* MULS.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -30985,9 +40675,14 @@ void REGPARAM2 CPUFUNC(op_c1d8_0)(uae_u32 opcode) /* MULS.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31010,9 +40705,14 @@ void REGPARAM2 CPUFUNC(op_c1e0_0)(uae_u32 opcode) /* MULS.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31034,9 +40734,14 @@ void REGPARAM2 CPUFUNC(op_c1e8_0)(uae_u32 opcode) /* MULS.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31059,9 +40764,14 @@ void REGPARAM2 CPUFUNC(op_c1f0_0)(uae_u32 opcode) /* MULS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -31077,9 +40787,14 @@ void REGPARAM2 CPUFUNC(op_c1f8_0)(uae_u32 opcode) /* MULS.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31096,9 +40811,14 @@ void REGPARAM2 CPUFUNC(op_c1f9_0)(uae_u32 opcode) /* MULS.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 	cpuop_end();
@@ -31116,9 +40836,14 @@ void REGPARAM2 CPUFUNC(op_c1fa_0)(uae_u32 opcode) /* MULS.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31137,9 +40862,14 @@ void REGPARAM2 CPUFUNC(op_c1fb_0)(uae_u32 opcode) /* MULS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}	cpuop_end();
 }
@@ -31154,9 +40884,14 @@ void REGPARAM2 CPUFUNC(op_c1fc_0)(uae_u32 opcode) /* MULS.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -31177,6 +40912,11 @@ void REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD.B Dn,Dn */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31185,6 +40925,7 @@ void REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD.B Dn,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31206,6 +40947,11 @@ void REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD.B (An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31214,6 +40960,7 @@ void REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD.B (An),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31236,6 +40983,11 @@ void REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD.B (An)+,Dn */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31244,6 +40996,7 @@ void REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD.B (An)+,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31266,6 +41019,11 @@ void REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD.B -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31274,6 +41032,7 @@ void REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD.B -(An),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31295,6 +41054,11 @@ void REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD.B (d16,An),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31303,6 +41067,7 @@ void REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD.B (d16,An),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31325,6 +41090,11 @@ void REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31333,6 +41103,7 @@ void REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	cpuop_end();
 }
@@ -31348,6 +41119,11 @@ void REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD.B (xxx).W,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31356,6 +41132,7 @@ void REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD.B (xxx).W,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31372,6 +41149,11 @@ void REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD.B (xxx).L,Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31380,6 +41162,7 @@ void REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD.B (xxx).L,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -31397,6 +41180,11 @@ void REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD.B (d16,PC),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31405,6 +41193,7 @@ void REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD.B (d16,PC),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31423,6 +41212,11 @@ void REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31431,6 +41225,7 @@ void REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	cpuop_end();
 }
@@ -31445,6 +41240,11 @@ void REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -31453,6 +41253,7 @@ void REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD.B #<data>.B,Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31473,6 +41274,11 @@ void REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD.W Dn,Dn */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31481,6 +41287,7 @@ void REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD.W Dn,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31501,6 +41308,11 @@ void REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD.W An,Dn */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31509,6 +41321,7 @@ void REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD.W An,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31530,6 +41343,11 @@ void REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD.W (An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31538,6 +41356,7 @@ void REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD.W (An),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31560,6 +41379,11 @@ void REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD.W (An)+,Dn */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31568,6 +41392,7 @@ void REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD.W (An)+,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31590,6 +41415,11 @@ void REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD.W -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31598,6 +41428,7 @@ void REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD.W -(An),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31619,6 +41450,11 @@ void REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD.W (d16,An),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31627,6 +41463,7 @@ void REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD.W (d16,An),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31649,6 +41486,11 @@ void REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31657,6 +41499,7 @@ void REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	cpuop_end();
 }
@@ -31672,6 +41515,11 @@ void REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD.W (xxx).W,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31680,6 +41528,7 @@ void REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD.W (xxx).W,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31696,6 +41545,11 @@ void REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD.W (xxx).L,Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31704,6 +41558,7 @@ void REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD.W (xxx).L,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -31721,6 +41576,11 @@ void REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD.W (d16,PC),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31729,6 +41589,7 @@ void REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD.W (d16,PC),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31747,6 +41608,11 @@ void REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31755,6 +41621,7 @@ void REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	cpuop_end();
 }
@@ -31769,6 +41636,11 @@ void REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -31777,6 +41649,7 @@ void REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31797,6 +41670,11 @@ void REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD.L Dn,Dn */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31805,6 +41683,7 @@ void REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD.L Dn,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31825,6 +41704,11 @@ void REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD.L An,Dn */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31833,6 +41717,7 @@ void REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD.L An,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31854,6 +41739,11 @@ void REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD.L (An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31862,6 +41752,7 @@ void REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD.L (An),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31884,6 +41775,11 @@ void REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD.L (An)+,Dn */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31892,6 +41788,7 @@ void REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD.L (An)+,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31914,6 +41811,11 @@ void REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD.L -(An),Dn */
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31922,6 +41824,7 @@ void REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD.L -(An),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -31943,6 +41846,11 @@ void REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD.L (d16,An),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31951,6 +41859,7 @@ void REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD.L (d16,An),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -31973,6 +41882,11 @@ void REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -31981,6 +41895,7 @@ void REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}	cpuop_end();
 }
@@ -31996,6 +41911,11 @@ void REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD.L (xxx).W,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32004,6 +41924,7 @@ void REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD.L (xxx).W,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -32020,6 +41941,11 @@ void REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD.L (xxx).L,Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32028,6 +41954,7 @@ void REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD.L (xxx).L,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -32045,6 +41972,11 @@ void REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD.L (d16,PC),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32053,6 +41985,7 @@ void REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD.L (d16,PC),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -32071,6 +42004,11 @@ void REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32079,6 +42017,7 @@ void REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}	cpuop_end();
 }
@@ -32093,6 +42032,11 @@ void REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32101,6 +42045,7 @@ void REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD.L #<data>.L,Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -32446,6 +42391,11 @@ void REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD.B Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32454,6 +42404,7 @@ void REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD.B Dn,(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -32476,6 +42427,11 @@ void REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD.B Dn,(An)+ */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32484,6 +42440,7 @@ void REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD.B Dn,(An)+ */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -32506,6 +42463,11 @@ void REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD.B Dn,-(An) */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32514,6 +42476,7 @@ void REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD.B Dn,-(An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -32535,6 +42498,11 @@ void REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD.B Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32543,6 +42511,7 @@ void REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD.B Dn,(d16,An) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -32565,6 +42534,11 @@ void REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32573,6 +42547,7 @@ void REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -32588,6 +42563,11 @@ void REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32596,6 +42576,7 @@ void REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).W */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -32612,6 +42593,11 @@ void REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -32620,6 +42606,7 @@ void REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD.B Dn,(xxx).L */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -32701,6 +42688,11 @@ void REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD.W Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32709,6 +42701,7 @@ void REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD.W Dn,(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -32731,6 +42724,11 @@ void REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD.W Dn,(An)+ */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32739,6 +42737,7 @@ void REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD.W Dn,(An)+ */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -32761,6 +42760,11 @@ void REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD.W Dn,-(An) */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32769,6 +42773,7 @@ void REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD.W Dn,-(An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -32790,6 +42795,11 @@ void REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD.W Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32798,6 +42808,7 @@ void REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD.W Dn,(d16,An) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -32820,6 +42831,11 @@ void REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32828,6 +42844,7 @@ void REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -32843,6 +42860,11 @@ void REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32851,6 +42873,7 @@ void REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).W */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -32867,6 +42890,11 @@ void REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -32875,6 +42903,7 @@ void REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD.W Dn,(xxx).L */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -32956,6 +42985,11 @@ void REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD.L Dn,(An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32964,6 +42998,7 @@ void REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD.L Dn,(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -32986,6 +43021,11 @@ void REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD.L Dn,(An)+ */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -32994,6 +43034,7 @@ void REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD.L Dn,(An)+ */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -33016,6 +43057,11 @@ void REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD.L Dn,-(An) */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg (regs, dstreg) = dsta;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33024,6 +43070,7 @@ void REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD.L Dn,-(An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 	cpuop_end();
@@ -33045,6 +43092,11 @@ void REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD.L Dn,(d16,An) */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33053,6 +43105,7 @@ void REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD.L Dn,(d16,An) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -33075,6 +43128,11 @@ void REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33083,6 +43141,7 @@ void REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}}	cpuop_end();
 }
@@ -33098,6 +43157,11 @@ void REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).W */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33106,6 +43170,7 @@ void REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).W */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -33122,6 +43187,11 @@ void REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).L */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -33130,6 +43200,7 @@ void REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD.L Dn,(xxx).L */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -34264,9 +44335,14 @@ void REGPARAM2 CPUFUNC(op_e0d0_0)(uae_u32 opcode) /* ASRW.W (An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34288,9 +44364,14 @@ void REGPARAM2 CPUFUNC(op_e0d8_0)(uae_u32 opcode) /* ASRW.W (An)+ */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34312,9 +44393,14 @@ void REGPARAM2 CPUFUNC(op_e0e0_0)(uae_u32 opcode) /* ASRW.W -(An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34335,9 +44421,14 @@ void REGPARAM2 CPUFUNC(op_e0e8_0)(uae_u32 opcode) /* ASRW.W (d16,An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34359,9 +44450,14 @@ void REGPARAM2 CPUFUNC(op_e0f0_0)(uae_u32 opcode) /* ASRW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34376,9 +44472,14 @@ void REGPARAM2 CPUFUNC(op_e0f8_0)(uae_u32 opcode) /* ASRW.W (xxx).W */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -34394,9 +44495,14 @@ void REGPARAM2 CPUFUNC(op_e0f9_0)(uae_u32 opcode) /* ASRW.W (xxx).L */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35263,9 +45369,14 @@ void REGPARAM2 CPUFUNC(op_e1d0_0)(uae_u32 opcode) /* ASLW.W (An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35289,9 +45400,14 @@ void REGPARAM2 CPUFUNC(op_e1d8_0)(uae_u32 opcode) /* ASLW.W (An)+ */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35315,9 +45431,14 @@ void REGPARAM2 CPUFUNC(op_e1e0_0)(uae_u32 opcode) /* ASLW.W -(An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35340,9 +45461,14 @@ void REGPARAM2 CPUFUNC(op_e1e8_0)(uae_u32 opcode) /* ASLW.W (d16,An) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35366,9 +45492,14 @@ void REGPARAM2 CPUFUNC(op_e1f0_0)(uae_u32 opcode) /* ASLW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35385,9 +45516,14 @@ void REGPARAM2 CPUFUNC(op_e1f8_0)(uae_u32 opcode) /* ASLW.W (xxx).W */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35405,9 +45541,14 @@ void REGPARAM2 CPUFUNC(op_e1f9_0)(uae_u32 opcode) /* ASLW.W (xxx).L */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35429,9 +45570,14 @@ void REGPARAM2 CPUFUNC(op_e2d0_0)(uae_u32 opcode) /* LSRW.W (An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35452,9 +45598,14 @@ void REGPARAM2 CPUFUNC(op_e2d8_0)(uae_u32 opcode) /* LSRW.W (An)+ */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35475,9 +45626,14 @@ void REGPARAM2 CPUFUNC(op_e2e0_0)(uae_u32 opcode) /* LSRW.W -(An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35497,9 +45653,14 @@ void REGPARAM2 CPUFUNC(op_e2e8_0)(uae_u32 opcode) /* LSRW.W (d16,An) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35520,9 +45681,14 @@ void REGPARAM2 CPUFUNC(op_e2f0_0)(uae_u32 opcode) /* LSRW.W (d8,An,Xn) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35536,9 +45702,14 @@ void REGPARAM2 CPUFUNC(op_e2f8_0)(uae_u32 opcode) /* LSRW.W (xxx).W */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35553,9 +45724,14 @@ void REGPARAM2 CPUFUNC(op_e2f9_0)(uae_u32 opcode) /* LSRW.W (xxx).L */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35575,9 +45751,14 @@ void REGPARAM2 CPUFUNC(op_e3d0_0)(uae_u32 opcode) /* LSLW.W (An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35598,9 +45779,14 @@ void REGPARAM2 CPUFUNC(op_e3d8_0)(uae_u32 opcode) /* LSLW.W (An)+ */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35621,9 +45807,14 @@ void REGPARAM2 CPUFUNC(op_e3e0_0)(uae_u32 opcode) /* LSLW.W -(An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35643,9 +45834,14 @@ void REGPARAM2 CPUFUNC(op_e3e8_0)(uae_u32 opcode) /* LSLW.W (d16,An) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35666,9 +45862,14 @@ void REGPARAM2 CPUFUNC(op_e3f0_0)(uae_u32 opcode) /* LSLW.W (d8,An,Xn) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35682,9 +45883,14 @@ void REGPARAM2 CPUFUNC(op_e3f8_0)(uae_u32 opcode) /* LSLW.W (xxx).W */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35699,9 +45905,14 @@ void REGPARAM2 CPUFUNC(op_e3f9_0)(uae_u32 opcode) /* LSLW.W (xxx).L */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35722,9 +45933,14 @@ void REGPARAM2 CPUFUNC(op_e4d0_0)(uae_u32 opcode) /* ROXRW.W (An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35746,9 +45962,14 @@ void REGPARAM2 CPUFUNC(op_e4d8_0)(uae_u32 opcode) /* ROXRW.W (An)+ */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35770,9 +45991,14 @@ void REGPARAM2 CPUFUNC(op_e4e0_0)(uae_u32 opcode) /* ROXRW.W -(An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35793,9 +46019,14 @@ void REGPARAM2 CPUFUNC(op_e4e8_0)(uae_u32 opcode) /* ROXRW.W (d16,An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35817,9 +46048,14 @@ void REGPARAM2 CPUFUNC(op_e4f0_0)(uae_u32 opcode) /* ROXRW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35834,9 +46070,14 @@ void REGPARAM2 CPUFUNC(op_e4f8_0)(uae_u32 opcode) /* ROXRW.W (xxx).W */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35852,9 +46093,14 @@ void REGPARAM2 CPUFUNC(op_e4f9_0)(uae_u32 opcode) /* ROXRW.W (xxx).L */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35875,9 +46121,14 @@ void REGPARAM2 CPUFUNC(op_e5d0_0)(uae_u32 opcode) /* ROXLW.W (An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35899,9 +46150,14 @@ void REGPARAM2 CPUFUNC(op_e5d8_0)(uae_u32 opcode) /* ROXLW.W (An)+ */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35923,9 +46179,14 @@ void REGPARAM2 CPUFUNC(op_e5e0_0)(uae_u32 opcode) /* ROXLW.W -(An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35946,9 +46207,14 @@ void REGPARAM2 CPUFUNC(op_e5e8_0)(uae_u32 opcode) /* ROXLW.W (d16,An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35970,9 +46236,14 @@ void REGPARAM2 CPUFUNC(op_e5f0_0)(uae_u32 opcode) /* ROXLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35987,9 +46258,14 @@ void REGPARAM2 CPUFUNC(op_e5f8_0)(uae_u32 opcode) /* ROXLW.W (xxx).W */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -36005,9 +46281,14 @@ void REGPARAM2 CPUFUNC(op_e5f9_0)(uae_u32 opcode) /* ROXLW.W (xxx).L */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -36028,9 +46309,14 @@ void REGPARAM2 CPUFUNC(op_e6d0_0)(uae_u32 opcode) /* RORW.W (An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36051,9 +46337,14 @@ void REGPARAM2 CPUFUNC(op_e6d8_0)(uae_u32 opcode) /* RORW.W (An)+ */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36074,9 +46365,14 @@ void REGPARAM2 CPUFUNC(op_e6e0_0)(uae_u32 opcode) /* RORW.W -(An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36096,9 +46392,14 @@ void REGPARAM2 CPUFUNC(op_e6e8_0)(uae_u32 opcode) /* RORW.W (d16,An) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36119,9 +46420,14 @@ void REGPARAM2 CPUFUNC(op_e6f0_0)(uae_u32 opcode) /* RORW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}}	cpuop_end();
@@ -36135,9 +46441,14 @@ void REGPARAM2 CPUFUNC(op_e6f8_0)(uae_u32 opcode) /* RORW.W (xxx).W */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36152,9 +46463,14 @@ void REGPARAM2 CPUFUNC(op_e6f9_0)(uae_u32 opcode) /* RORW.W (xxx).L */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -36174,9 +46490,14 @@ void REGPARAM2 CPUFUNC(op_e7d0_0)(uae_u32 opcode) /* ROLW.W (An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36197,9 +46518,14 @@ void REGPARAM2 CPUFUNC(op_e7d8_0)(uae_u32 opcode) /* ROLW.W (An)+ */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36220,9 +46546,14 @@ void REGPARAM2 CPUFUNC(op_e7e0_0)(uae_u32 opcode) /* ROLW.W -(An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -36242,9 +46573,14 @@ void REGPARAM2 CPUFUNC(op_e7e8_0)(uae_u32 opcode) /* ROLW.W (d16,An) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36265,9 +46601,14 @@ void REGPARAM2 CPUFUNC(op_e7f0_0)(uae_u32 opcode) /* ROLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}}	cpuop_end();
@@ -36281,9 +46622,14 @@ void REGPARAM2 CPUFUNC(op_e7f8_0)(uae_u32 opcode) /* ROLW.W (xxx).W */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -36298,9 +46644,14 @@ void REGPARAM2 CPUFUNC(op_e7f9_0)(uae_u32 opcode) /* ROLW.W (xxx).L */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -38193,13 +48544,13 @@ void REGPARAM2 CPUFUNC(op_f310_0)(uae_u32 opcode) /* FSAVE.L (An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1829; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1996; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_save(opcode);
-}}endlabel1829: ;
+}}endlabel1996: ;
 	cpuop_end();
 }
 
@@ -38213,13 +48564,13 @@ void REGPARAM2 CPUFUNC(op_f320_0)(uae_u32 opcode) /* FSAVE.L -(An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1830; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1997; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_save(opcode);
-}}endlabel1830: ;
+}}endlabel1997: ;
 	cpuop_end();
 }
 
@@ -38233,13 +48584,13 @@ void REGPARAM2 CPUFUNC(op_f328_0)(uae_u32 opcode) /* FSAVE.L (d16,An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1831; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1998; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_save(opcode);
-}}endlabel1831: ;
+}}endlabel1998: ;
 	cpuop_end();
 }
 
@@ -38253,13 +48604,13 @@ void REGPARAM2 CPUFUNC(op_f330_0)(uae_u32 opcode) /* FSAVE.L (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1832; }
+{if (!regs.s) { op_exception(8,0); goto endlabel1999; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_save(opcode);
-}}endlabel1832: ;
+}}endlabel1999: ;
 	cpuop_end();
 }
 
@@ -38268,13 +48619,13 @@ void REGPARAM2 CPUFUNC(op_f330_0)(uae_u32 opcode) /* FSAVE.L (d8,An,Xn) */
 void REGPARAM2 CPUFUNC(op_f338_0)(uae_u32 opcode) /* FSAVE.L (xxx).W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel1833; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2000; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_save(opcode);
-}}endlabel1833: ;
+}}endlabel2000: ;
 	cpuop_end();
 }
 
@@ -38283,13 +48634,13 @@ void REGPARAM2 CPUFUNC(op_f338_0)(uae_u32 opcode) /* FSAVE.L (xxx).W */
 void REGPARAM2 CPUFUNC(op_f339_0)(uae_u32 opcode) /* FSAVE.L (xxx).L */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel1834; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2001; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_save(opcode);
-}}endlabel1834: ;
+}}endlabel2001: ;
 	cpuop_end();
 }
 
@@ -38303,13 +48654,13 @@ void REGPARAM2 CPUFUNC(op_f350_0)(uae_u32 opcode) /* FRESTORE.L (An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1835; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2002; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_restore(opcode);
-}}endlabel1835: ;
+}}endlabel2002: ;
 	cpuop_end();
 }
 
@@ -38323,13 +48674,13 @@ void REGPARAM2 CPUFUNC(op_f358_0)(uae_u32 opcode) /* FRESTORE.L (An)+ */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1836; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2003; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_restore(opcode);
-}}endlabel1836: ;
+}}endlabel2003: ;
 	cpuop_end();
 }
 
@@ -38343,13 +48694,13 @@ void REGPARAM2 CPUFUNC(op_f368_0)(uae_u32 opcode) /* FRESTORE.L (d16,An) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1837; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2004; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_restore(opcode);
-}}endlabel1837: ;
+}}endlabel2004: ;
 	cpuop_end();
 }
 
@@ -38363,13 +48714,13 @@ void REGPARAM2 CPUFUNC(op_f370_0)(uae_u32 opcode) /* FRESTORE.L (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1838; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2005; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_restore(opcode);
-}}endlabel1838: ;
+}}endlabel2005: ;
 	cpuop_end();
 }
 
@@ -38378,13 +48729,13 @@ void REGPARAM2 CPUFUNC(op_f370_0)(uae_u32 opcode) /* FRESTORE.L (d8,An,Xn) */
 void REGPARAM2 CPUFUNC(op_f378_0)(uae_u32 opcode) /* FRESTORE.L (xxx).W */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel1839; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2006; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_restore(opcode);
-}}endlabel1839: ;
+}}endlabel2006: ;
 	cpuop_end();
 }
 
@@ -38393,13 +48744,13 @@ void REGPARAM2 CPUFUNC(op_f378_0)(uae_u32 opcode) /* FRESTORE.L (xxx).W */
 void REGPARAM2 CPUFUNC(op_f379_0)(uae_u32 opcode) /* FRESTORE.L (xxx).L */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel1840; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2007; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_restore(opcode);
-}}endlabel1840: ;
+}}endlabel2007: ;
 	cpuop_end();
 }
 
@@ -38408,13 +48759,13 @@ void REGPARAM2 CPUFUNC(op_f379_0)(uae_u32 opcode) /* FRESTORE.L (xxx).L */
 void REGPARAM2 CPUFUNC(op_f37a_0)(uae_u32 opcode) /* FRESTORE.L (d16,PC) */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel1841; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2008; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_restore(opcode);
-}}endlabel1841: ;
+}}endlabel2008: ;
 	cpuop_end();
 }
 
@@ -38423,13 +48774,13 @@ void REGPARAM2 CPUFUNC(op_f37a_0)(uae_u32 opcode) /* FRESTORE.L (d16,PC) */
 void REGPARAM2 CPUFUNC(op_f37b_0)(uae_u32 opcode) /* FRESTORE.L (d8,PC,Xn) */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel1842; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2009; }
 {m68k_incpc(2);
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
 	fpuop_restore(opcode);
-}}endlabel1842: ;
+}}endlabel2009: ;
 	cpuop_end();
 }
 
@@ -38448,11 +48799,11 @@ void REGPARAM2 CPUFUNC(op_f408_0)(uae_u32 opcode) /* CINVL.L #<data>,An */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1843; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2010; }
 {	if (srcreg&0x2)
 		flush_icache(31);
 }}m68k_incpc(2);
-endlabel1843: ;
+endlabel2010: ;
 	cpuop_end();
 }
 
@@ -38471,11 +48822,11 @@ void REGPARAM2 CPUFUNC(op_f410_0)(uae_u32 opcode) /* CINVP.L #<data>,An */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1844; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2011; }
 {	if (srcreg&0x2)
 		flush_icache(32);
 }}m68k_incpc(2);
-endlabel1844: ;
+endlabel2011: ;
 	cpuop_end();
 }
 
@@ -38489,11 +48840,11 @@ void REGPARAM2 CPUFUNC(op_f418_0)(uae_u32 opcode) /* CINVA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1845; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2012; }
 {	if (srcreg&0x2)
 		flush_icache(33);
 }}m68k_incpc(2);
-endlabel1845: ;
+endlabel2012: ;
 	cpuop_end();
 }
 
@@ -38507,11 +48858,11 @@ void REGPARAM2 CPUFUNC(op_f419_0)(uae_u32 opcode) /* CINVA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1846; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2013; }
 {	if (srcreg&0x2)
 		flush_icache(33);
 }}m68k_incpc(2);
-endlabel1846: ;
+endlabel2013: ;
 	cpuop_end();
 }
 
@@ -38525,11 +48876,11 @@ void REGPARAM2 CPUFUNC(op_f41a_0)(uae_u32 opcode) /* CINVA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1847; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2014; }
 {	if (srcreg&0x2)
 		flush_icache(33);
 }}m68k_incpc(2);
-endlabel1847: ;
+endlabel2014: ;
 	cpuop_end();
 }
 
@@ -38543,11 +48894,11 @@ void REGPARAM2 CPUFUNC(op_f41b_0)(uae_u32 opcode) /* CINVA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1848; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2015; }
 {	if (srcreg&0x2)
 		flush_icache(33);
 }}m68k_incpc(2);
-endlabel1848: ;
+endlabel2015: ;
 	cpuop_end();
 }
 
@@ -38561,11 +48912,11 @@ void REGPARAM2 CPUFUNC(op_f41c_0)(uae_u32 opcode) /* CINVA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1849; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2016; }
 {	if (srcreg&0x2)
 		flush_icache(33);
 }}m68k_incpc(2);
-endlabel1849: ;
+endlabel2016: ;
 	cpuop_end();
 }
 
@@ -38579,11 +48930,11 @@ void REGPARAM2 CPUFUNC(op_f41d_0)(uae_u32 opcode) /* CINVA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1850; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2017; }
 {	if (srcreg&0x2)
 		flush_icache(33);
 }}m68k_incpc(2);
-endlabel1850: ;
+endlabel2017: ;
 	cpuop_end();
 }
 
@@ -38597,11 +48948,11 @@ void REGPARAM2 CPUFUNC(op_f41e_0)(uae_u32 opcode) /* CINVA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1851; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2018; }
 {	if (srcreg&0x2)
 		flush_icache(33);
 }}m68k_incpc(2);
-endlabel1851: ;
+endlabel2018: ;
 	cpuop_end();
 }
 
@@ -38615,11 +48966,11 @@ void REGPARAM2 CPUFUNC(op_f41f_0)(uae_u32 opcode) /* CINVA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1852; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2019; }
 {	if (srcreg&0x2)
 		flush_icache(33);
 }}m68k_incpc(2);
-endlabel1852: ;
+endlabel2019: ;
 	cpuop_end();
 }
 
@@ -38638,11 +48989,11 @@ void REGPARAM2 CPUFUNC(op_f428_0)(uae_u32 opcode) /* CPUSHL.L #<data>,An */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1853; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2020; }
 {	if (srcreg&0x2)
 		flush_icache(41);
 }}m68k_incpc(2);
-endlabel1853: ;
+endlabel2020: ;
 	cpuop_end();
 }
 
@@ -38661,11 +49012,11 @@ void REGPARAM2 CPUFUNC(op_f430_0)(uae_u32 opcode) /* CPUSHP.L #<data>,An */
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1854; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2021; }
 {	if (srcreg&0x2)
 		flush_icache(42);
 }}m68k_incpc(2);
-endlabel1854: ;
+endlabel2021: ;
 	cpuop_end();
 }
 
@@ -38679,11 +49030,11 @@ void REGPARAM2 CPUFUNC(op_f438_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1855; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2022; }
 {	if (srcreg&0x2)
 		flush_icache(43);
 }}m68k_incpc(2);
-endlabel1855: ;
+endlabel2022: ;
 	cpuop_end();
 }
 
@@ -38697,11 +49048,11 @@ void REGPARAM2 CPUFUNC(op_f439_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1856; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2023; }
 {	if (srcreg&0x2)
 		flush_icache(43);
 }}m68k_incpc(2);
-endlabel1856: ;
+endlabel2023: ;
 	cpuop_end();
 }
 
@@ -38715,11 +49066,11 @@ void REGPARAM2 CPUFUNC(op_f43a_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1857; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2024; }
 {	if (srcreg&0x2)
 		flush_icache(43);
 }}m68k_incpc(2);
-endlabel1857: ;
+endlabel2024: ;
 	cpuop_end();
 }
 
@@ -38733,11 +49084,11 @@ void REGPARAM2 CPUFUNC(op_f43b_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1858; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2025; }
 {	if (srcreg&0x2)
 		flush_icache(43);
 }}m68k_incpc(2);
-endlabel1858: ;
+endlabel2025: ;
 	cpuop_end();
 }
 
@@ -38751,11 +49102,11 @@ void REGPARAM2 CPUFUNC(op_f43c_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1859; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2026; }
 {	if (srcreg&0x2)
 		flush_icache(43);
 }}m68k_incpc(2);
-endlabel1859: ;
+endlabel2026: ;
 	cpuop_end();
 }
 
@@ -38769,11 +49120,11 @@ void REGPARAM2 CPUFUNC(op_f43d_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1860; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2027; }
 {	if (srcreg&0x2)
 		flush_icache(43);
 }}m68k_incpc(2);
-endlabel1860: ;
+endlabel2027: ;
 	cpuop_end();
 }
 
@@ -38787,11 +49138,11 @@ void REGPARAM2 CPUFUNC(op_f43e_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1861; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2028; }
 {	if (srcreg&0x2)
 		flush_icache(43);
 }}m68k_incpc(2);
-endlabel1861: ;
+endlabel2028: ;
 	cpuop_end();
 }
 
@@ -38805,11 +49156,11 @@ void REGPARAM2 CPUFUNC(op_f43f_0)(uae_u32 opcode) /* CPUSHA.L #<data> */
 #else
 	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel1862; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2029; }
 {	if (srcreg&0x2)
 		flush_icache(43);
 }}m68k_incpc(2);
-endlabel1862: ;
+endlabel2029: ;
 	cpuop_end();
 }
 
@@ -39397,9 +49748,14 @@ void REGPARAM2 CPUFUNC(op_30_3)(uae_u32 opcode) /* OR.B #<data>.B,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39416,9 +49772,14 @@ void REGPARAM2 CPUFUNC(op_70_3)(uae_u32 opcode) /* OR.W #<data>.W,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39435,9 +49796,14 @@ void REGPARAM2 CPUFUNC(op_b0_3)(uae_u32 opcode) /* OR.L #<data>.L,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -39622,9 +49988,14 @@ void REGPARAM2 CPUFUNC(op_230_3)(uae_u32 opcode) /* AND.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39641,9 +50012,14 @@ void REGPARAM2 CPUFUNC(op_270_3)(uae_u32 opcode) /* AND.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39660,9 +50036,14 @@ void REGPARAM2 CPUFUNC(op_2b0_3)(uae_u32 opcode) /* AND.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -39679,6 +50060,11 @@ void REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -39687,6 +50073,7 @@ void REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) *
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -39703,6 +50090,11 @@ void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -39711,6 +50103,7 @@ void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) *
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -39727,6 +50120,11 @@ void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -39735,6 +50133,7 @@ void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) *
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -39751,6 +50150,11 @@ void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -39759,6 +50163,7 @@ void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) *
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -39775,6 +50180,11 @@ void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -39783,6 +50193,7 @@ void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) *
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
@@ -39799,6 +50210,11 @@ void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -39807,6 +50223,7 @@ void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) *
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
@@ -39951,9 +50368,14 @@ void REGPARAM2 CPUFUNC(op_a30_3)(uae_u32 opcode) /* EOR.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39970,9 +50392,14 @@ void REGPARAM2 CPUFUNC(op_a70_3)(uae_u32 opcode) /* EOR.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -39992,9 +50419,14 @@ void REGPARAM2 CPUFUNC(op_ab0_3)(uae_u32 opcode) /* EOR.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40011,6 +50443,10 @@ void REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -40018,6 +50454,7 @@ void REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -40030,6 +50467,10 @@ void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -40037,6 +50478,7 @@ void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -40052,6 +50494,10 @@ void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -40059,6 +50505,7 @@ void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -40071,6 +50518,10 @@ void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -40078,6 +50529,7 @@ void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -40093,6 +50545,10 @@ void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -40100,6 +50556,7 @@ void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
@@ -40112,6 +50569,10 @@ void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -40119,6 +50580,7 @@ void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) *
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
@@ -40137,9 +50599,14 @@ void REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40155,9 +50622,14 @@ void REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40178,9 +50650,14 @@ void REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40197,9 +50674,14 @@ void REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40221,9 +50703,14 @@ void REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40241,9 +50728,14 @@ void REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An)+ */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40265,9 +50757,14 @@ void REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40285,9 +50782,14 @@ void REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),-(An) */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40308,9 +50810,14 @@ void REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40327,9 +50834,14 @@ void REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40349,9 +50861,14 @@ void REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE.B Dn,(d8,An,Xn) */
 #endif
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40372,9 +50889,14 @@ void REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40396,9 +50918,14 @@ void REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40420,9 +50947,14 @@ void REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE.B -(An),(d8,An,Xn) */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40443,9 +50975,14 @@ void REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE.B (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40466,9 +51003,14 @@ void REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40484,9 +51026,14 @@ void REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE.B (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40502,9 +51049,14 @@ void REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE.B (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40521,9 +51073,14 @@ void REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE.B (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40540,9 +51097,14 @@ void REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40557,9 +51119,14 @@ void REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE.B #<data>.B,(d8,An,Xn)
 #endif
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -40575,9 +51142,14 @@ void REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40589,9 +51161,14 @@ void REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40607,9 +51184,14 @@ void REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40621,9 +51203,14 @@ void REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -40643,9 +51230,14 @@ void REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40661,9 +51253,14 @@ void REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40726,9 +51323,14 @@ void REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40745,9 +51347,14 @@ void REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40769,9 +51376,14 @@ void REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40789,9 +51401,14 @@ void REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An)+ */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40813,9 +51430,14 @@ void REGPARAM2 CPUFUNC(op_2130_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40833,9 +51455,14 @@ void REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),-(An) */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40859,9 +51486,14 @@ void REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40878,9 +51510,14 @@ void REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -40900,9 +51537,14 @@ void REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40922,9 +51564,14 @@ void REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
 #endif
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -40945,9 +51592,14 @@ void REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40969,9 +51621,14 @@ void REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE.L (An)+,(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -40993,9 +51650,14 @@ void REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41016,9 +51678,14 @@ void REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41039,9 +51706,14 @@ void REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41057,9 +51729,14 @@ void REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE.L (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41075,9 +51752,14 @@ void REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE.L (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41094,9 +51776,14 @@ void REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE.L (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41113,9 +51800,14 @@ void REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41130,9 +51822,14 @@ void REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE.L #<data>.L,(d8,An,Xn)
 #endif
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 	cpuop_end();
@@ -41148,9 +51845,14 @@ void REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41162,9 +51864,14 @@ void REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41180,9 +51887,14 @@ void REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41194,9 +51906,14 @@ void REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41216,9 +51933,14 @@ void REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),Dn */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41234,9 +51956,14 @@ void REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),Dn */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
+{
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
+	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41299,9 +52026,14 @@ void REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41318,9 +52050,14 @@ void REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An) */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41342,9 +52079,14 @@ void REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41362,9 +52104,14 @@ void REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An)+ */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41386,9 +52133,14 @@ void REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41406,9 +52158,14 @@ void REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),-(An) */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41429,9 +52186,14 @@ void REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d16,An)
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41448,9 +52210,14 @@ void REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d16,An)
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41470,9 +52237,14 @@ void REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE.W Dn,(d8,An,Xn) */
 #endif
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -41492,9 +52264,14 @@ void REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE.W An,(d8,An,Xn) */
 #endif
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
@@ -41515,9 +52292,14 @@ void REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE.W (An),(d8,An,Xn) */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41539,9 +52321,14 @@ void REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE.W (An)+,(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41563,9 +52350,14 @@ void REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE.W -(An),(d8,An,Xn) */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -41586,9 +52378,14 @@ void REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE.W (d16,An),(d8,An,Xn)
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41609,9 +52406,14 @@ void REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d8,An,Xn
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41627,9 +52429,14 @@ void REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE.W (xxx).W,(d8,An,Xn) *
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41645,9 +52452,14 @@ void REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE.W (xxx).L,(d8,An,Xn) *
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41664,9 +52476,14 @@ void REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE.W (d16,PC),(d8,An,Xn)
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41683,9 +52500,14 @@ void REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d8,An,Xn
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41700,9 +52522,14 @@ void REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE.W #<data>.W,(d8,An,Xn)
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
@@ -41718,9 +52545,14 @@ void REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).W *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41732,9 +52564,14 @@ void REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).W *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
@@ -41750,9 +52587,14 @@ void REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).L *
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41764,9 +52606,14 @@ void REGPARAM2 CPUFUNC(op_33fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).L *
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 	cpuop_end();
@@ -41849,12 +52696,12 @@ void REGPARAM2 CPUFUNC(op_40f0_3)(uae_u32 opcode) /* MVSR2.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel2002; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2169; }
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	MakeSR();
 	put_word(srca,regs.sr);
 }}}m68k_incpc(4);
-endlabel2002: ;
+endlabel2169: ;
 	cpuop_end();
 }
 
@@ -41876,10 +52723,10 @@ void REGPARAM2 CPUFUNC(op_4130_3)(uae_u32 opcode) /* CHK.L (d8,An,Xn),Dn */
 {	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2003; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2003; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel2170; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel2170; }
 }}}}m68k_incpc(4);
-endlabel2003: ;
+endlabel2170: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_413b_3)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
@@ -41895,10 +52742,10 @@ void REGPARAM2 CPUFUNC(op_413b_3)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2004; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2004; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel2171; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel2171; }
 }}}}m68k_incpc(4);
-endlabel2004: ;
+endlabel2171: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41b0_3)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
@@ -41918,10 +52765,10 @@ void REGPARAM2 CPUFUNC(op_41b0_3)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
 {	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2005; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2005; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel2172; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel2172; }
 }}}}m68k_incpc(4);
-endlabel2005: ;
+endlabel2172: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_41bb_3)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
@@ -41937,10 +52784,10 @@ void REGPARAM2 CPUFUNC(op_41bb_3)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2006; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2006; }
+	if ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto endlabel2173; }
+	else if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto endlabel2173; }
 }}}}m68k_incpc(4);
-endlabel2006: ;
+endlabel2173: ;
 	cpuop_end();
 }
 #ifndef NOFLAGS
@@ -41990,9 +52837,14 @@ void REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(0)) == 0);
 	SET_NFLG (((uae_s8)(0)) < 0);
+#endif
 	put_byte(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42006,9 +52858,14 @@ void REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR.W (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(0)) == 0);
 	SET_NFLG (((uae_s16)(0)) < 0);
+#endif
 	put_word(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42025,9 +52882,14 @@ void REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, 0);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(0)) == 0);
 	SET_NFLG (((uae_s32)(0)) < 0);
+#endif
 	put_long(srca,0);
 }}m68k_incpc(4);
 	cpuop_end();
@@ -42060,6 +52922,11 @@ void REGPARAM2 CPUFUNC(op_4430_3)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, 0, dst);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
@@ -42068,6 +52935,7 @@ void REGPARAM2 CPUFUNC(op_4430_3)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -42083,6 +52951,11 @@ void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, 0, dst);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
@@ -42091,6 +52964,7 @@ void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -42106,6 +52980,11 @@ void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, 0, dst);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
@@ -42114,6 +52993,7 @@ void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(srca,dst);
 }}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -42159,9 +53039,14 @@ void REGPARAM2 CPUFUNC(op_4630_3)(uae_u32 opcode) /* NOT.B (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(dst)) == 0);
 	SET_NFLG (((uae_s8)(dst)) < 0);
+#endif
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42177,9 +53062,14 @@ void REGPARAM2 CPUFUNC(op_4670_3)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(dst)) == 0);
 	SET_NFLG (((uae_s16)(dst)) < 0);
+#endif
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42195,9 +53085,14 @@ void REGPARAM2 CPUFUNC(op_46b0_3)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, dst);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(dst)) == 0);
 	SET_NFLG (((uae_s32)(dst)) < 0);
+#endif
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -42210,26 +53105,26 @@ void REGPARAM2 CPUFUNC(op_46f0_3)(uae_u32 opcode) /* MV2SR.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel2021; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2188; }
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(4);
-endlabel2021: ;
+endlabel2188: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_46fb_3)(uae_u32 opcode) /* MV2SR.W (d8,PC,Xn) */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel2022; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2189; }
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 	regs.sr = src;
 	MakeFromSR();
 }}}}m68k_incpc(4);
-endlabel2022: ;
+endlabel2189: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_4830_3)(uae_u32 opcode) /* NBCD.B (d8,An,Xn) */
@@ -42302,8 +53197,16 @@ void REGPARAM2 CPUFUNC(op_48b0_3)(uae_u32 opcode) /* MVMLE.W #<data>.W,(d8,An,Xn
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_word((uae_u16 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_word((uae_u16 *)m, m68k_areg(regs, movem_index1[amask])); m += 2; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -42321,8 +53224,16 @@ void REGPARAM2 CPUFUNC(op_48f0_3)(uae_u32 opcode) /* MVMLE.L #<data>.W,(d8,An,Xn
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	uae_u8 *movem_host = movem_put_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { do_put_mem_long((uae_u32 *)m, m68k_dreg(regs, movem_index1[dmask])); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { do_put_mem_long((uae_u32 *)m, m68k_areg(regs, movem_index1[amask])); m += 4; amask = movem_next[amask]; }
+	movem_put_done(movem_host, m - movem_host);
+	} else {
 	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -42338,9 +53249,14 @@ void REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42350,9 +53266,14 @@ void REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42366,9 +53287,14 @@ void REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42378,9 +53304,14 @@ void REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42394,9 +53325,14 @@ void REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42406,9 +53342,14 @@ void REGPARAM2 CPUFUNC(op_4abb_3)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 }}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -42422,9 +53363,14 @@ void REGPARAM2 CPUFUNC(op_4af0_3)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -42442,8 +53388,16 @@ void REGPARAM2 CPUFUNC(op_4cb0_3)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d8,An,Xn
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -42458,8 +53412,16 @@ void REGPARAM2 CPUFUNC(op_4cbb_3)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d8,PC,Xn
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr tmppc = m68k_getpc() + 4;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m); m += 2; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -42477,8 +53439,16 @@ void REGPARAM2 CPUFUNC(op_4cf0_3)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d8,An,Xn
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -42493,8 +53463,16 @@ void REGPARAM2 CPUFUNC(op_4cfb_3)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d8,PC,Xn
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
 {	uaecptr tmppc = m68k_getpc() + 4;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+{	uae_u8 *movem_host = movem_get_host(srca);
+	if (likely(movem_host != NULL)) {
+	uae_u8 *m = movem_host;
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = do_get_mem_long((uae_u32 *)m); m += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = do_get_mem_long((uae_u32 *)m); m += 4; amask = movem_next[amask]; }
+	srca += m - movem_host;
+	} else {
+	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
 	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	}
 }}}m68k_incpc(6);
 	cpuop_end();
 }
@@ -42569,6 +53547,11 @@ void REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -42577,6 +53560,7 @@ void REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -42601,6 +53585,11 @@ void REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -42609,6 +53598,7 @@ void REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -42630,6 +53620,11 @@ void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -42638,6 +53633,7 @@ void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -42676,6 +53672,11 @@ void REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -42684,6 +53685,7 @@ void REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -42705,6 +53707,11 @@ void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -42713,6 +53720,7 @@ void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -42734,6 +53742,11 @@ void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -42742,6 +53755,7 @@ void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43009,17 +54023,15 @@ void REGPARAM2 CPUFUNC(op_60ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(0)) goto endlabel2065;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2065;
+	if (!cctrue(0)) goto endlabel2232;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2232;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(0)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2065: ;
+endlabel2232: ;
 	cpuop_end();
 }
 
@@ -43029,17 +54041,15 @@ void REGPARAM2 CPUFUNC(op_62ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(2)) goto endlabel2066;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2066;
+	if (!cctrue(2)) goto endlabel2233;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2233;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(2)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2066: ;
+endlabel2233: ;
 	cpuop_end();
 }
 
@@ -43049,17 +54059,15 @@ void REGPARAM2 CPUFUNC(op_63ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(3)) goto endlabel2067;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2067;
+	if (!cctrue(3)) goto endlabel2234;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2234;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(3)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2067: ;
+endlabel2234: ;
 	cpuop_end();
 }
 
@@ -43069,17 +54077,15 @@ void REGPARAM2 CPUFUNC(op_64ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(4)) goto endlabel2068;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2068;
+	if (!cctrue(4)) goto endlabel2235;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2235;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(4)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2068: ;
+endlabel2235: ;
 	cpuop_end();
 }
 
@@ -43089,17 +54095,15 @@ void REGPARAM2 CPUFUNC(op_65ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(5)) goto endlabel2069;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2069;
+	if (!cctrue(5)) goto endlabel2236;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2236;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(5)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2069: ;
+endlabel2236: ;
 	cpuop_end();
 }
 
@@ -43109,17 +54113,15 @@ void REGPARAM2 CPUFUNC(op_66ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(6)) goto endlabel2070;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2070;
+	if (!cctrue(6)) goto endlabel2237;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2237;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(6)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2070: ;
+endlabel2237: ;
 	cpuop_end();
 }
 
@@ -43129,17 +54131,15 @@ void REGPARAM2 CPUFUNC(op_67ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(7)) goto endlabel2071;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2071;
+	if (!cctrue(7)) goto endlabel2238;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2238;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(7)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2071: ;
+endlabel2238: ;
 	cpuop_end();
 }
 
@@ -43149,17 +54149,15 @@ void REGPARAM2 CPUFUNC(op_68ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(8)) goto endlabel2072;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2072;
+	if (!cctrue(8)) goto endlabel2239;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2239;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(8)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2072: ;
+endlabel2239: ;
 	cpuop_end();
 }
 
@@ -43169,17 +54167,15 @@ void REGPARAM2 CPUFUNC(op_69ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(9)) goto endlabel2073;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2073;
+	if (!cctrue(9)) goto endlabel2240;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2240;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(9)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2073: ;
+endlabel2240: ;
 	cpuop_end();
 }
 
@@ -43189,17 +54185,15 @@ void REGPARAM2 CPUFUNC(op_6aff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(10)) goto endlabel2074;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2074;
+	if (!cctrue(10)) goto endlabel2241;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2241;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(10)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2074: ;
+endlabel2241: ;
 	cpuop_end();
 }
 
@@ -43209,17 +54203,15 @@ void REGPARAM2 CPUFUNC(op_6bff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(11)) goto endlabel2075;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2075;
+	if (!cctrue(11)) goto endlabel2242;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2242;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(11)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2075: ;
+endlabel2242: ;
 	cpuop_end();
 }
 
@@ -43229,17 +54221,15 @@ void REGPARAM2 CPUFUNC(op_6cff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(12)) goto endlabel2076;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2076;
+	if (!cctrue(12)) goto endlabel2243;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2243;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(12)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2076: ;
+endlabel2243: ;
 	cpuop_end();
 }
 
@@ -43249,17 +54239,15 @@ void REGPARAM2 CPUFUNC(op_6dff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(13)) goto endlabel2077;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2077;
+	if (!cctrue(13)) goto endlabel2244;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2244;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(13)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2077: ;
+endlabel2244: ;
 	cpuop_end();
 }
 
@@ -43269,17 +54257,15 @@ void REGPARAM2 CPUFUNC(op_6eff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(14)) goto endlabel2078;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2078;
+	if (!cctrue(14)) goto endlabel2245;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2245;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(14)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2078: ;
+endlabel2245: ;
 	cpuop_end();
 }
 
@@ -43289,17 +54275,15 @@ void REGPARAM2 CPUFUNC(op_6fff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
 {
 	cpuop_begin();
 {	m68k_incpc(2);
-	if (!cctrue(15)) goto endlabel2079;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2079;
+	if (!cctrue(15)) goto endlabel2246;
+		op_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto endlabel2246;
 {	uae_s32 src = get_ilong(2);
 	if (!cctrue(15)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
-return;
+	cpuop_return();
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2079: ;
+endlabel2246: ;
 	cpuop_end();
 }
 
@@ -43321,9 +54305,14 @@ void REGPARAM2 CPUFUNC(op_8030_3)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43341,9 +54330,14 @@ void REGPARAM2 CPUFUNC(op_803b_3)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43365,9 +54359,14 @@ void REGPARAM2 CPUFUNC(op_8070_3)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43385,9 +54384,14 @@ void REGPARAM2 CPUFUNC(op_807b_3)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43409,9 +54413,14 @@ void REGPARAM2 CPUFUNC(op_80b0_3)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43429,9 +54438,14 @@ void REGPARAM2 CPUFUNC(op_80bb_3)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43454,19 +54468,24 @@ void REGPARAM2 CPUFUNC(op_80f0_3)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2086; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel2253; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel2086: ;
+}}}}endlabel2253: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_80fb_3)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
@@ -43483,19 +54502,24 @@ void REGPARAM2 CPUFUNC(op_80fb_3)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2087; } else {
+	if (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto endlabel2254; } else {
 	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel2087: ;
+}}}}endlabel2254: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
@@ -43515,9 +54539,14 @@ void REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43539,9 +54568,14 @@ void REGPARAM2 CPUFUNC(op_8170_3)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43563,9 +54597,14 @@ void REGPARAM2 CPUFUNC(op_81b0_3)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -43588,20 +54627,25 @@ void REGPARAM2 CPUFUNC(op_81f0_3)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2091; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel2258; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel2091: ;
+}}}}endlabel2258: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_81fb_3)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
@@ -43618,20 +54662,25 @@ void REGPARAM2 CPUFUNC(op_81fb_3)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2092; } else {
+	if (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto endlabel2259; } else {
 	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
 	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(newv)) == 0);
 	SET_NFLG (((uae_s16)(newv)) < 0);
+#endif
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
 	}
-}}}}endlabel2092: ;
+}}}}endlabel2259: ;
 	cpuop_end();
 }
 void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
@@ -43651,6 +54700,11 @@ void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -43659,6 +54713,7 @@ void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43676,6 +54731,11 @@ void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -43684,6 +54744,7 @@ void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43705,6 +54766,11 @@ void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -43713,6 +54779,7 @@ void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43730,6 +54797,11 @@ void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -43738,6 +54810,7 @@ void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43759,6 +54832,11 @@ void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -43767,6 +54845,7 @@ void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43784,6 +54863,11 @@ void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -43792,6 +54876,7 @@ void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43857,6 +54942,11 @@ void REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -43865,6 +54955,7 @@ void REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43886,6 +54977,11 @@ void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -43894,6 +54990,7 @@ void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43915,6 +55012,11 @@ void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -43923,6 +55025,7 @@ void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -43988,6 +55091,10 @@ void REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -43995,6 +55102,7 @@ void REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44011,6 +55119,10 @@ void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -44018,6 +55130,7 @@ void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44041,6 +55154,10 @@ void REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44048,6 +55165,7 @@ void REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44064,6 +55182,10 @@ void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44071,6 +55193,7 @@ void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44091,6 +55214,10 @@ void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44098,6 +55225,7 @@ void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44114,6 +55242,10 @@ void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44121,6 +55253,7 @@ void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44141,6 +55274,10 @@ void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44148,6 +55285,7 @@ void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44164,6 +55302,10 @@ void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44171,6 +55313,7 @@ void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44191,9 +55334,14 @@ void REGPARAM2 CPUFUNC(op_b130_3)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44215,9 +55363,14 @@ void REGPARAM2 CPUFUNC(op_b170_3)(uae_u32 opcode) /* EOR.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44239,9 +55392,14 @@ void REGPARAM2 CPUFUNC(op_b1b0_3)(uae_u32 opcode) /* EOR.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44263,6 +55421,10 @@ void REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44270,6 +55432,7 @@ void REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44286,6 +55449,10 @@ void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_LAZY_FLAGS (LAZY_SUB_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44293,6 +55460,7 @@ void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	SET_NFLG (flgn != 0);
+#endif
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
@@ -44313,9 +55481,14 @@ void REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44333,9 +55506,14 @@ void REGPARAM2 CPUFUNC(op_c03b_3)(uae_u32 opcode) /* AND.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44357,9 +55535,14 @@ void REGPARAM2 CPUFUNC(op_c070_3)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44377,9 +55560,14 @@ void REGPARAM2 CPUFUNC(op_c07b_3)(uae_u32 opcode) /* AND.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44401,9 +55589,14 @@ void REGPARAM2 CPUFUNC(op_c0b0_3)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44421,9 +55614,14 @@ void REGPARAM2 CPUFUNC(op_c0bb_3)(uae_u32 opcode) /* AND.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44445,9 +55643,14 @@ void REGPARAM2 CPUFUNC(op_c0f0_3)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44465,9 +55668,14 @@ void REGPARAM2 CPUFUNC(op_c0fb_3)(uae_u32 opcode) /* MULU.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44489,9 +55697,14 @@ void REGPARAM2 CPUFUNC(op_c130_3)(uae_u32 opcode) /* AND.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_B, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
+#endif
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44513,9 +55726,14 @@ void REGPARAM2 CPUFUNC(op_c170_3)(uae_u32 opcode) /* AND.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
+#endif
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44537,9 +55755,14 @@ void REGPARAM2 CPUFUNC(op_c1b0_3)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, src);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
+#endif
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
@@ -44561,9 +55784,14 @@ void REGPARAM2 CPUFUNC(op_c1f0_3)(uae_u32 opcode) /* MULS.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44581,9 +55809,14 @@ void REGPARAM2 CPUFUNC(op_c1fb_3)(uae_u32 opcode) /* MULS.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_L, newv);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_NFLG (((uae_s32)(newv)) < 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44605,6 +55838,11 @@ void REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -44613,6 +55851,7 @@ void REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44630,6 +55869,11 @@ void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -44638,6 +55882,7 @@ void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44659,6 +55904,11 @@ void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44667,6 +55917,7 @@ void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44684,6 +55935,11 @@ void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44692,6 +55948,7 @@ void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44713,6 +55970,11 @@ void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44721,6 +55983,7 @@ void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44738,6 +56001,11 @@ void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44746,6 +56014,7 @@ void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44811,6 +56080,11 @@ void REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_B, src, dst, newv);
+#else
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
@@ -44819,6 +56093,7 @@ void REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44840,6 +56115,11 @@ void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_W, src, dst, newv);
+#else
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
@@ -44848,6 +56128,7 @@ void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44869,6 +56150,11 @@ void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+
+#if LAZY_FLAGS
+{	SET_XFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_LAZY_FLAGS (LAZY_ADD_L, src, dst, newv);
+#else
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
@@ -44877,6 +56163,7 @@ void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
+#endif
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 	cpuop_end();
@@ -44942,9 +56229,14 @@ void REGPARAM2 CPUFUNC(op_e0f0_3)(uae_u32 opcode) /* ASRW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -44965,9 +56257,14 @@ void REGPARAM2 CPUFUNC(op_e1f0_3)(uae_u32 opcode) /* ASLW.W (d8,An,Xn) */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -44989,9 +56286,14 @@ void REGPARAM2 CPUFUNC(op_e2f0_3)(uae_u32 opcode) /* LSRW.W (d8,An,Xn) */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45011,9 +56313,14 @@ void REGPARAM2 CPUFUNC(op_e3f0_3)(uae_u32 opcode) /* LSLW.W (d8,An,Xn) */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45034,9 +56341,14 @@ void REGPARAM2 CPUFUNC(op_e4f0_3)(uae_u32 opcode) /* ROXRW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45057,9 +56369,14 @@ void REGPARAM2 CPUFUNC(op_e5f0_3)(uae_u32 opcode) /* ROXLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -45080,9 +56397,14 @@ void REGPARAM2 CPUFUNC(op_e6f0_3)(uae_u32 opcode) /* RORW.W (d8,An,Xn) */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -45102,9 +56424,14 @@ void REGPARAM2 CPUFUNC(op_e7f0_3)(uae_u32 opcode) /* ROLW.W (d8,An,Xn) */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
+
+#if LAZY_FLAGS
+	SET_LAZY_LOGICAL (LAZY_LOGICAL_W, val);
+#else
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(val)) == 0);
 	SET_NFLG (((uae_s16)(val)) < 0);
+#endif
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -45268,7 +56595,7 @@ void REGPARAM2 CPUFUNC(op_40f9_4)(uae_u32 opcode) /* MVSR2.W (xxx).L */
 void REGPARAM2 CPUFUNC(op_4e73_4)(uae_u32 opcode) /* RTE.L  */
 {
 	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel2161; }
+{if (!regs.s) { op_exception(8,0); goto endlabel2328; }
 {{	uaecptr sra = m68k_areg(regs, 7);
 {	uae_s16 sr = get_word(sra);
 	m68k_areg(regs, 7) += 2;
@@ -45277,7 +56604,7 @@ void REGPARAM2 CPUFUNC(op_4e73_4)(uae_u32 opcode) /* RTE.L  */
 	m68k_areg(regs, 7) += 4;
 	regs.sr = sr; m68k_setpc_rte(pc);
 	MakeFromSR();
-}}}}}}endlabel2161: ;
+}}}}}}endlabel2328: ;
 	cpuop_end();
 }
 #endif
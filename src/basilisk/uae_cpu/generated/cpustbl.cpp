@@ -1884,6 +1884,177 @@ struct cputbl CPUFUNC(op_smalltbl_0)[] = {
 { CPUFUNC_FF(op_f618_0), 0, 63000 }, /* MOVE16.L (xxx).L,(An) */
 { CPUFUNC_FF(op_f620_0), 0, 63008 }, /* MOVE16.L (An)+,(An)+ */
 { 0, 0, 0 }};
+#if USE_SUPERINSNS
+struct cputbl CPUFUNC(op_fusetbl_0)[] = {
+{ CPUFUNC(op_100_0_fuse), 0, 256 }, /* BTST.L Dn,Dn */
+{ CPUFUNC(op_110_0_fuse), 0, 272 }, /* BTST.B Dn,(An) */
+{ CPUFUNC(op_118_0_fuse), 0, 280 }, /* BTST.B Dn,(An)+ */
+{ CPUFUNC(op_120_0_fuse), 0, 288 }, /* BTST.B Dn,-(An) */
+{ CPUFUNC(op_128_0_fuse), 0, 296 }, /* BTST.B Dn,(d16,An) */
+{ CPUFUNC(op_130_0_fuse), 0, 304 }, /* BTST.B Dn,(d8,An,Xn) */
+{ CPUFUNC(op_138_0_fuse), 0, 312 }, /* BTST.B Dn,(xxx).W */
+{ CPUFUNC(op_139_0_fuse), 0, 313 }, /* BTST.B Dn,(xxx).L */
+{ CPUFUNC(op_13a_0_fuse), 0, 314 }, /* BTST.B Dn,(d16,PC) */
+{ CPUFUNC(op_13b_0_fuse), 0, 315 }, /* BTST.B Dn,(d8,PC,Xn) */
+{ CPUFUNC(op_13c_0_fuse), 0, 316 }, /* BTST.B Dn,#<data>.B */
+{ CPUFUNC(op_800_0_fuse), 0, 2048 }, /* BTST.L #<data>.W,Dn */
+{ CPUFUNC(op_810_0_fuse), 0, 2064 }, /* BTST.B #<data>.W,(An) */
+{ CPUFUNC(op_818_0_fuse), 0, 2072 }, /* BTST.B #<data>.W,(An)+ */
+{ CPUFUNC(op_820_0_fuse), 0, 2080 }, /* BTST.B #<data>.W,-(An) */
+{ CPUFUNC(op_828_0_fuse), 0, 2088 }, /* BTST.B #<data>.W,(d16,An) */
+{ CPUFUNC(op_830_0_fuse), 0, 2096 }, /* BTST.B #<data>.W,(d8,An,Xn) */
+{ CPUFUNC(op_838_0_fuse), 0, 2104 }, /* BTST.B #<data>.W,(xxx).W */
+{ CPUFUNC(op_839_0_fuse), 0, 2105 }, /* BTST.B #<data>.W,(xxx).L */
+{ CPUFUNC(op_83a_0_fuse), 0, 2106 }, /* BTST.B #<data>.W,(d16,PC) */
+{ CPUFUNC(op_83b_0_fuse), 0, 2107 }, /* BTST.B #<data>.W,(d8,PC,Xn) */
+{ CPUFUNC(op_83c_0_fuse), 0, 2108 }, /* BTST.B #<data>.W,#<data>.B */
+{ CPUFUNC(op_c00_0_fuse), 0, 3072 }, /* CMP.B #<data>.B,Dn */
+{ CPUFUNC(op_c10_0_fuse), 0, 3088 }, /* CMP.B #<data>.B,(An) */
+{ CPUFUNC(op_c18_0_fuse), 0, 3096 }, /* CMP.B #<data>.B,(An)+ */
+{ CPUFUNC(op_c20_0_fuse), 0, 3104 }, /* CMP.B #<data>.B,-(An) */
+{ CPUFUNC(op_c28_0_fuse), 0, 3112 }, /* CMP.B #<data>.B,(d16,An) */
+{ CPUFUNC(op_c30_0_fuse), 0, 3120 }, /* CMP.B #<data>.B,(d8,An,Xn) */
+{ CPUFUNC(op_c38_0_fuse), 0, 3128 }, /* CMP.B #<data>.B,(xxx).W */
+{ CPUFUNC(op_c39_0_fuse), 0, 3129 }, /* CMP.B #<data>.B,(xxx).L */
+{ CPUFUNC(op_c3a_0_fuse), 0, 3130 }, /* CMP.B #<data>.B,(d16,PC) */
+{ CPUFUNC(op_c3b_0_fuse), 0, 3131 }, /* CMP.B #<data>.B,(d8,PC,Xn) */
+{ CPUFUNC(op_c40_0_fuse), 0, 3136 }, /* CMP.W #<data>.W,Dn */
+{ CPUFUNC(op_c50_0_fuse), 0, 3152 }, /* CMP.W #<data>.W,(An) */
+{ CPUFUNC(op_c58_0_fuse), 0, 3160 }, /* CMP.W #<data>.W,(An)+ */
+{ CPUFUNC(op_c60_0_fuse), 0, 3168 }, /* CMP.W #<data>.W,-(An) */
+{ CPUFUNC(op_c68_0_fuse), 0, 3176 }, /* CMP.W #<data>.W,(d16,An) */
+{ CPUFUNC(op_c70_0_fuse), 0, 3184 }, /* CMP.W #<data>.W,(d8,An,Xn) */
+{ CPUFUNC(op_c78_0_fuse), 0, 3192 }, /* CMP.W #<data>.W,(xxx).W */
+{ CPUFUNC(op_c79_0_fuse), 0, 3193 }, /* CMP.W #<data>.W,(xxx).L */
+{ CPUFUNC(op_c7a_0_fuse), 0, 3194 }, /* CMP.W #<data>.W,(d16,PC) */
+{ CPUFUNC(op_c7b_0_fuse), 0, 3195 }, /* CMP.W #<data>.W,(d8,PC,Xn) */
+{ CPUFUNC(op_c80_0_fuse), 0, 3200 }, /* CMP.L #<data>.L,Dn */
+{ CPUFUNC(op_c90_0_fuse), 0, 3216 }, /* CMP.L #<data>.L,(An) */
+{ CPUFUNC(op_c98_0_fuse), 0, 3224 }, /* CMP.L #<data>.L,(An)+ */
+{ CPUFUNC(op_ca0_0_fuse), 0, 3232 }, /* CMP.L #<data>.L,-(An) */
+{ CPUFUNC(op_ca8_0_fuse), 0, 3240 }, /* CMP.L #<data>.L,(d16,An) */
+{ CPUFUNC(op_cb0_0_fuse), 0, 3248 }, /* CMP.L #<data>.L,(d8,An,Xn) */
+{ CPUFUNC(op_cb8_0_fuse), 0, 3256 }, /* CMP.L #<data>.L,(xxx).W */
+{ CPUFUNC(op_cb9_0_fuse), 0, 3257 }, /* CMP.L #<data>.L,(xxx).L */
+{ CPUFUNC(op_cba_0_fuse), 0, 3258 }, /* CMP.L #<data>.L,(d16,PC) */
+{ CPUFUNC(op_cbb_0_fuse), 0, 3259 }, /* CMP.L #<data>.L,(d8,PC,Xn) */
+{ CPUFUNC(op_10c0_0_fuse), 0, 4288 }, /* MOVE.B Dn,(An)+ */
+{ CPUFUNC(op_10d0_0_fuse), 0, 4304 }, /* MOVE.B (An),(An)+ */
+{ CPUFUNC(op_10d8_0_fuse), 0, 4312 }, /* MOVE.B (An)+,(An)+ */
+{ CPUFUNC(op_20c0_0_fuse), 0, 8384 }, /* MOVE.L Dn,(An)+ */
+{ CPUFUNC(op_20d0_0_fuse), 0, 8400 }, /* MOVE.L (An),(An)+ */
+{ CPUFUNC(op_20d8_0_fuse), 0, 8408 }, /* MOVE.L (An)+,(An)+ */
+{ CPUFUNC(op_30c0_0_fuse), 0, 12480 }, /* MOVE.W Dn,(An)+ */
+{ CPUFUNC(op_30d0_0_fuse), 0, 12496 }, /* MOVE.W (An),(An)+ */
+{ CPUFUNC(op_30d8_0_fuse), 0, 12504 }, /* MOVE.W (An)+,(An)+ */
+{ CPUFUNC(op_4218_0_fuse), 0, 16920 }, /* CLR.B (An)+ */
+{ CPUFUNC(op_4258_0_fuse), 0, 16984 }, /* CLR.W (An)+ */
+{ CPUFUNC(op_4298_0_fuse), 0, 17048 }, /* CLR.L (An)+ */
+{ CPUFUNC(op_4a00_0_fuse), 0, 18944 }, /* TST.B Dn */
+{ CPUFUNC(op_4a10_0_fuse), 0, 18960 }, /* TST.B (An) */
+{ CPUFUNC(op_4a18_0_fuse), 0, 18968 }, /* TST.B (An)+ */
+{ CPUFUNC(op_4a20_0_fuse), 0, 18976 }, /* TST.B -(An) */
+{ CPUFUNC(op_4a28_0_fuse), 0, 18984 }, /* TST.B (d16,An) */
+{ CPUFUNC(op_4a30_0_fuse), 0, 18992 }, /* TST.B (d8,An,Xn) */
+{ CPUFUNC(op_4a38_0_fuse), 0, 19000 }, /* TST.B (xxx).W */
+{ CPUFUNC(op_4a39_0_fuse), 0, 19001 }, /* TST.B (xxx).L */
+{ CPUFUNC(op_4a3a_0_fuse), 0, 19002 }, /* TST.B (d16,PC) */
+{ CPUFUNC(op_4a3b_0_fuse), 0, 19003 }, /* TST.B (d8,PC,Xn) */
+{ CPUFUNC(op_4a3c_0_fuse), 0, 19004 }, /* TST.B #<data>.B */
+{ CPUFUNC(op_4a40_0_fuse), 0, 19008 }, /* TST.W Dn */
+{ CPUFUNC(op_4a48_0_fuse), 0, 19016 }, /* TST.W An */
+{ CPUFUNC(op_4a50_0_fuse), 0, 19024 }, /* TST.W (An) */
+{ CPUFUNC(op_4a58_0_fuse), 0, 19032 }, /* TST.W (An)+ */
+{ CPUFUNC(op_4a60_0_fuse), 0, 19040 }, /* TST.W -(An) */
+{ CPUFUNC(op_4a68_0_fuse), 0, 19048 }, /* TST.W (d16,An) */
+{ CPUFUNC(op_4a70_0_fuse), 0, 19056 }, /* TST.W (d8,An,Xn) */
+{ CPUFUNC(op_4a78_0_fuse), 0, 19064 }, /* TST.W (xxx).W */
+{ CPUFUNC(op_4a79_0_fuse), 0, 19065 }, /* TST.W (xxx).L */
+{ CPUFUNC(op_4a7a_0_fuse), 0, 19066 }, /* TST.W (d16,PC) */
+{ CPUFUNC(op_4a7b_0_fuse), 0, 19067 }, /* TST.W (d8,PC,Xn) */
+{ CPUFUNC(op_4a7c_0_fuse), 0, 19068 }, /* TST.W #<data>.W */
+{ CPUFUNC(op_4a80_0_fuse), 0, 19072 }, /* TST.L Dn */
+{ CPUFUNC(op_4a88_0_fuse), 0, 19080 }, /* TST.L An */
+{ CPUFUNC(op_4a90_0_fuse), 0, 19088 }, /* TST.L (An) */
+{ CPUFUNC(op_4a98_0_fuse), 0, 19096 }, /* TST.L (An)+ */
+{ CPUFUNC(op_4aa0_0_fuse), 0, 19104 }, /* TST.L -(An) */
+{ CPUFUNC(op_4aa8_0_fuse), 0, 19112 }, /* TST.L (d16,An) */
+{ CPUFUNC(op_4ab0_0_fuse), 0, 19120 }, /* TST.L (d8,An,Xn) */
+{ CPUFUNC(op_4ab8_0_fuse), 0, 19128 }, /* TST.L (xxx).W */
+{ CPUFUNC(op_4ab9_0_fuse), 0, 19129 }, /* TST.L (xxx).L */
+{ CPUFUNC(op_4aba_0_fuse), 0, 19130 }, /* TST.L (d16,PC) */
+{ CPUFUNC(op_4abb_0_fuse), 0, 19131 }, /* TST.L (d8,PC,Xn) */
+{ CPUFUNC(op_4abc_0_fuse), 0, 19132 }, /* TST.L #<data>.L */
+{ CPUFUNC(op_5000_0_fuse), 0, 20480 }, /* ADD.B #<data>,Dn */
+{ CPUFUNC(op_5040_0_fuse), 0, 20544 }, /* ADD.W #<data>,Dn */
+{ CPUFUNC(op_5080_0_fuse), 0, 20608 }, /* ADD.L #<data>,Dn */
+{ CPUFUNC(op_5100_0_fuse), 0, 20736 }, /* SUB.B #<data>,Dn */
+{ CPUFUNC(op_5140_0_fuse), 0, 20800 }, /* SUB.W #<data>,Dn */
+{ CPUFUNC(op_5180_0_fuse), 0, 20864 }, /* SUB.L #<data>,Dn */
+{ CPUFUNC(op_b000_0_fuse), 0, 45056 }, /* CMP.B Dn,Dn */
+{ CPUFUNC(op_b010_0_fuse), 0, 45072 }, /* CMP.B (An),Dn */
+{ CPUFUNC(op_b018_0_fuse), 0, 45080 }, /* CMP.B (An)+,Dn */
+{ CPUFUNC(op_b020_0_fuse), 0, 45088 }, /* CMP.B -(An),Dn */
+{ CPUFUNC(op_b028_0_fuse), 0, 45096 }, /* CMP.B (d16,An),Dn */
+{ CPUFUNC(op_b030_0_fuse), 0, 45104 }, /* CMP.B (d8,An,Xn),Dn */
+{ CPUFUNC(op_b038_0_fuse), 0, 45112 }, /* CMP.B (xxx).W,Dn */
+{ CPUFUNC(op_b039_0_fuse), 0, 45113 }, /* CMP.B (xxx).L,Dn */
+{ CPUFUNC(op_b03a_0_fuse), 0, 45114 }, /* CMP.B (d16,PC),Dn */
+{ CPUFUNC(op_b03b_0_fuse), 0, 45115 }, /* CMP.B (d8,PC,Xn),Dn */
+{ CPUFUNC(op_b03c_0_fuse), 0, 45116 }, /* CMP.B #<data>.B,Dn */
+{ CPUFUNC(op_b040_0_fuse), 0, 45120 }, /* CMP.W Dn,Dn */
+{ CPUFUNC(op_b048_0_fuse), 0, 45128 }, /* CMP.W An,Dn */
+{ CPUFUNC(op_b050_0_fuse), 0, 45136 }, /* CMP.W (An),Dn */
+{ CPUFUNC(op_b058_0_fuse), 0, 45144 }, /* CMP.W (An)+,Dn */
+{ CPUFUNC(op_b060_0_fuse), 0, 45152 }, /* CMP.W -(An),Dn */
+{ CPUFUNC(op_b068_0_fuse), 0, 45160 }, /* CMP.W (d16,An),Dn */
+{ CPUFUNC(op_b070_0_fuse), 0, 45168 }, /* CMP.W (d8,An,Xn),Dn */
+{ CPUFUNC(op_b078_0_fuse), 0, 45176 }, /* CMP.W (xxx).W,Dn */
+{ CPUFUNC(op_b079_0_fuse), 0, 45177 }, /* CMP.W (xxx).L,Dn */
+{ CPUFUNC(op_b07a_0_fuse), 0, 45178 }, /* CMP.W (d16,PC),Dn */
+{ CPUFUNC(op_b07b_0_fuse), 0, 45179 }, /* CMP.W (d8,PC,Xn),Dn */
+{ CPUFUNC(op_b07c_0_fuse), 0, 45180 }, /* CMP.W #<data>.W,Dn */
+{ CPUFUNC(op_b080_0_fuse), 0, 45184 }, /* CMP.L Dn,Dn */
+{ CPUFUNC(op_b088_0_fuse), 0, 45192 }, /* CMP.L An,Dn */
+{ CPUFUNC(op_b090_0_fuse), 0, 45200 }, /* CMP.L (An),Dn */
+{ CPUFUNC(op_b098_0_fuse), 0, 45208 }, /* CMP.L (An)+,Dn */
+{ CPUFUNC(op_b0a0_0_fuse), 0, 45216 }, /* CMP.L -(An),Dn */
+{ CPUFUNC(op_b0a8_0_fuse), 0, 45224 }, /* CMP.L (d16,An),Dn */
+{ CPUFUNC(op_b0b0_0_fuse), 0, 45232 }, /* CMP.L (d8,An,Xn),Dn */
+{ CPUFUNC(op_b0b8_0_fuse), 0, 45240 }, /* CMP.L (xxx).W,Dn */
+{ CPUFUNC(op_b0b9_0_fuse), 0, 45241 }, /* CMP.L (xxx).L,Dn */
+{ CPUFUNC(op_b0ba_0_fuse), 0, 45242 }, /* CMP.L (d16,PC),Dn */
+{ CPUFUNC(op_b0bb_0_fuse), 0, 45243 }, /* CMP.L (d8,PC,Xn),Dn */
+{ CPUFUNC(op_b0bc_0_fuse), 0, 45244 }, /* CMP.L #<data>.L,Dn */
+{ CPUFUNC(op_b0c0_0_fuse), 0, 45248 }, /* CMPA.W Dn,An */
+{ CPUFUNC(op_b0c8_0_fuse), 0, 45256 }, /* CMPA.W An,An */
+{ CPUFUNC(op_b0d0_0_fuse), 0, 45264 }, /* CMPA.W (An),An */
+{ CPUFUNC(op_b0d8_0_fuse), 0, 45272 }, /* CMPA.W (An)+,An */
+{ CPUFUNC(op_b0e0_0_fuse), 0, 45280 }, /* CMPA.W -(An),An */
+{ CPUFUNC(op_b0e8_0_fuse), 0, 45288 }, /* CMPA.W (d16,An),An */
+{ CPUFUNC(op_b0f0_0_fuse), 0, 45296 }, /* CMPA.W (d8,An,Xn),An */
+{ CPUFUNC(op_b0f8_0_fuse), 0, 45304 }, /* CMPA.W (xxx).W,An */
+{ CPUFUNC(op_b0f9_0_fuse), 0, 45305 }, /* CMPA.W (xxx).L,An */
+{ CPUFUNC(op_b0fa_0_fuse), 0, 45306 }, /* CMPA.W (d16,PC),An */
+{ CPUFUNC(op_b0fb_0_fuse), 0, 45307 }, /* CMPA.W (d8,PC,Xn),An */
+{ CPUFUNC(op_b0fc_0_fuse), 0, 45308 }, /* CMPA.W #<data>.W,An */
+{ CPUFUNC(op_b108_0_fuse), 0, 45320 }, /* CMPM.B (An)+,(An)+ */
+{ CPUFUNC(op_b148_0_fuse), 0, 45384 }, /* CMPM.W (An)+,(An)+ */
+{ CPUFUNC(op_b188_0_fuse), 0, 45448 }, /* CMPM.L (An)+,(An)+ */
+{ CPUFUNC(op_b1c0_0_fuse), 0, 45504 }, /* CMPA.L Dn,An */
+{ CPUFUNC(op_b1c8_0_fuse), 0, 45512 }, /* CMPA.L An,An */
+{ CPUFUNC(op_b1d0_0_fuse), 0, 45520 }, /* CMPA.L (An),An */
+{ CPUFUNC(op_b1d8_0_fuse), 0, 45528 }, /* CMPA.L (An)+,An */
+{ CPUFUNC(op_b1e0_0_fuse), 0, 45536 }, /* CMPA.L -(An),An */
+{ CPUFUNC(op_b1e8_0_fuse), 0, 45544 }, /* CMPA.L (d16,An),An */
+{ CPUFUNC(op_b1f0_0_fuse), 0, 45552 }, /* CMPA.L (d8,An,Xn),An */
+{ CPUFUNC(op_b1f8_0_fuse), 0, 45560 }, /* CMPA.L (xxx).W,An */
+{ CPUFUNC(op_b1f9_0_fuse), 0, 45561 }, /* CMPA.L (xxx).L,An */
+{ CPUFUNC(op_b1fa_0_fuse), 0, 45562 }, /* CMPA.L (d16,PC),An */
+{ CPUFUNC(op_b1fb_0_fuse), 0, 45563 }, /* CMPA.L (d8,PC,Xn),An */
+{ CPUFUNC(op_b1fc_0_fuse), 0, 45564 }, /* CMPA.L #<data>.L,An */
+{ 0, 0, 0 }};
+#endif
 struct cputbl CPUFUNC(op_smalltbl_1)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
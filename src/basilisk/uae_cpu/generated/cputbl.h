@@ -66,28 +66,72 @@ extern cpuop_func op_fb_0_nf;
 extern cpuop_func op_fb_0_ff;
 extern cpuop_func op_100_0_nf;
 extern cpuop_func op_100_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_100_0_fuse_nf;
+extern cpuop_func op_100_0_fuse_ff;
+#endif
 extern cpuop_func op_108_0_nf;
 extern cpuop_func op_108_0_ff;
 extern cpuop_func op_110_0_nf;
 extern cpuop_func op_110_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_110_0_fuse_nf;
+extern cpuop_func op_110_0_fuse_ff;
+#endif
 extern cpuop_func op_118_0_nf;
 extern cpuop_func op_118_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_118_0_fuse_nf;
+extern cpuop_func op_118_0_fuse_ff;
+#endif
 extern cpuop_func op_120_0_nf;
 extern cpuop_func op_120_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_120_0_fuse_nf;
+extern cpuop_func op_120_0_fuse_ff;
+#endif
 extern cpuop_func op_128_0_nf;
 extern cpuop_func op_128_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_128_0_fuse_nf;
+extern cpuop_func op_128_0_fuse_ff;
+#endif
 extern cpuop_func op_130_0_nf;
 extern cpuop_func op_130_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_130_0_fuse_nf;
+extern cpuop_func op_130_0_fuse_ff;
+#endif
 extern cpuop_func op_138_0_nf;
 extern cpuop_func op_138_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_138_0_fuse_nf;
+extern cpuop_func op_138_0_fuse_ff;
+#endif
 extern cpuop_func op_139_0_nf;
 extern cpuop_func op_139_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_139_0_fuse_nf;
+extern cpuop_func op_139_0_fuse_ff;
+#endif
 extern cpuop_func op_13a_0_nf;
 extern cpuop_func op_13a_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_13a_0_fuse_nf;
+extern cpuop_func op_13a_0_fuse_ff;
+#endif
 extern cpuop_func op_13b_0_nf;
 extern cpuop_func op_13b_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_13b_0_fuse_nf;
+extern cpuop_func op_13b_0_fuse_ff;
+#endif
 extern cpuop_func op_13c_0_nf;
 extern cpuop_func op_13c_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_13c_0_fuse_nf;
+extern cpuop_func op_13c_0_fuse_ff;
+#endif
 extern cpuop_func op_140_0_nf;
 extern cpuop_func op_140_0_ff;
 extern cpuop_func op_148_0_nf;
@@ -350,26 +394,70 @@ extern cpuop_func op_6fb_0_nf;
 extern cpuop_func op_6fb_0_ff;
 extern cpuop_func op_800_0_nf;
 extern cpuop_func op_800_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_800_0_fuse_nf;
+extern cpuop_func op_800_0_fuse_ff;
+#endif
 extern cpuop_func op_810_0_nf;
 extern cpuop_func op_810_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_810_0_fuse_nf;
+extern cpuop_func op_810_0_fuse_ff;
+#endif
 extern cpuop_func op_818_0_nf;
 extern cpuop_func op_818_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_818_0_fuse_nf;
+extern cpuop_func op_818_0_fuse_ff;
+#endif
 extern cpuop_func op_820_0_nf;
 extern cpuop_func op_820_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_820_0_fuse_nf;
+extern cpuop_func op_820_0_fuse_ff;
+#endif
 extern cpuop_func op_828_0_nf;
 extern cpuop_func op_828_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_828_0_fuse_nf;
+extern cpuop_func op_828_0_fuse_ff;
+#endif
 extern cpuop_func op_830_0_nf;
 extern cpuop_func op_830_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_830_0_fuse_nf;
+extern cpuop_func op_830_0_fuse_ff;
+#endif
 extern cpuop_func op_838_0_nf;
 extern cpuop_func op_838_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_838_0_fuse_nf;
+extern cpuop_func op_838_0_fuse_ff;
+#endif
 extern cpuop_func op_839_0_nf;
 extern cpuop_func op_839_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_839_0_fuse_nf;
+extern cpuop_func op_839_0_fuse_ff;
+#endif
 extern cpuop_func op_83a_0_nf;
 extern cpuop_func op_83a_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_83a_0_fuse_nf;
+extern cpuop_func op_83a_0_fuse_ff;
+#endif
 extern cpuop_func op_83b_0_nf;
 extern cpuop_func op_83b_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_83b_0_fuse_nf;
+extern cpuop_func op_83b_0_fuse_ff;
+#endif
 extern cpuop_func op_83c_0_nf;
 extern cpuop_func op_83c_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_83c_0_fuse_nf;
+extern cpuop_func op_83c_0_fuse_ff;
+#endif
 extern cpuop_func op_840_0_nf;
 extern cpuop_func op_840_0_ff;
 extern cpuop_func op_850_0_nf;
@@ -498,64 +586,184 @@ extern cpuop_func op_af9_0_nf;
 extern cpuop_func op_af9_0_ff;
 extern cpuop_func op_c00_0_nf;
 extern cpuop_func op_c00_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c00_0_fuse_nf;
+extern cpuop_func op_c00_0_fuse_ff;
+#endif
 extern cpuop_func op_c10_0_nf;
 extern cpuop_func op_c10_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c10_0_fuse_nf;
+extern cpuop_func op_c10_0_fuse_ff;
+#endif
 extern cpuop_func op_c18_0_nf;
 extern cpuop_func op_c18_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c18_0_fuse_nf;
+extern cpuop_func op_c18_0_fuse_ff;
+#endif
 extern cpuop_func op_c20_0_nf;
 extern cpuop_func op_c20_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c20_0_fuse_nf;
+extern cpuop_func op_c20_0_fuse_ff;
+#endif
 extern cpuop_func op_c28_0_nf;
 extern cpuop_func op_c28_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c28_0_fuse_nf;
+extern cpuop_func op_c28_0_fuse_ff;
+#endif
 extern cpuop_func op_c30_0_nf;
 extern cpuop_func op_c30_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c30_0_fuse_nf;
+extern cpuop_func op_c30_0_fuse_ff;
+#endif
 extern cpuop_func op_c38_0_nf;
 extern cpuop_func op_c38_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c38_0_fuse_nf;
+extern cpuop_func op_c38_0_fuse_ff;
+#endif
 extern cpuop_func op_c39_0_nf;
 extern cpuop_func op_c39_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c39_0_fuse_nf;
+extern cpuop_func op_c39_0_fuse_ff;
+#endif
 extern cpuop_func op_c3a_0_nf;
 extern cpuop_func op_c3a_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c3a_0_fuse_nf;
+extern cpuop_func op_c3a_0_fuse_ff;
+#endif
 extern cpuop_func op_c3b_0_nf;
 extern cpuop_func op_c3b_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c3b_0_fuse_nf;
+extern cpuop_func op_c3b_0_fuse_ff;
+#endif
 extern cpuop_func op_c40_0_nf;
 extern cpuop_func op_c40_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c40_0_fuse_nf;
+extern cpuop_func op_c40_0_fuse_ff;
+#endif
 extern cpuop_func op_c50_0_nf;
 extern cpuop_func op_c50_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c50_0_fuse_nf;
+extern cpuop_func op_c50_0_fuse_ff;
+#endif
 extern cpuop_func op_c58_0_nf;
 extern cpuop_func op_c58_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c58_0_fuse_nf;
+extern cpuop_func op_c58_0_fuse_ff;
+#endif
 extern cpuop_func op_c60_0_nf;
 extern cpuop_func op_c60_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c60_0_fuse_nf;
+extern cpuop_func op_c60_0_fuse_ff;
+#endif
 extern cpuop_func op_c68_0_nf;
 extern cpuop_func op_c68_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c68_0_fuse_nf;
+extern cpuop_func op_c68_0_fuse_ff;
+#endif
 extern cpuop_func op_c70_0_nf;
 extern cpuop_func op_c70_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c70_0_fuse_nf;
+extern cpuop_func op_c70_0_fuse_ff;
+#endif
 extern cpuop_func op_c78_0_nf;
 extern cpuop_func op_c78_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c78_0_fuse_nf;
+extern cpuop_func op_c78_0_fuse_ff;
+#endif
 extern cpuop_func op_c79_0_nf;
 extern cpuop_func op_c79_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c79_0_fuse_nf;
+extern cpuop_func op_c79_0_fuse_ff;
+#endif
 extern cpuop_func op_c7a_0_nf;
 extern cpuop_func op_c7a_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c7a_0_fuse_nf;
+extern cpuop_func op_c7a_0_fuse_ff;
+#endif
 extern cpuop_func op_c7b_0_nf;
 extern cpuop_func op_c7b_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c7b_0_fuse_nf;
+extern cpuop_func op_c7b_0_fuse_ff;
+#endif
 extern cpuop_func op_c80_0_nf;
 extern cpuop_func op_c80_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c80_0_fuse_nf;
+extern cpuop_func op_c80_0_fuse_ff;
+#endif
 extern cpuop_func op_c90_0_nf;
 extern cpuop_func op_c90_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c90_0_fuse_nf;
+extern cpuop_func op_c90_0_fuse_ff;
+#endif
 extern cpuop_func op_c98_0_nf;
 extern cpuop_func op_c98_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_c98_0_fuse_nf;
+extern cpuop_func op_c98_0_fuse_ff;
+#endif
 extern cpuop_func op_ca0_0_nf;
 extern cpuop_func op_ca0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_ca0_0_fuse_nf;
+extern cpuop_func op_ca0_0_fuse_ff;
+#endif
 extern cpuop_func op_ca8_0_nf;
 extern cpuop_func op_ca8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_ca8_0_fuse_nf;
+extern cpuop_func op_ca8_0_fuse_ff;
+#endif
 extern cpuop_func op_cb0_0_nf;
 extern cpuop_func op_cb0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_cb0_0_fuse_nf;
+extern cpuop_func op_cb0_0_fuse_ff;
+#endif
 extern cpuop_func op_cb8_0_nf;
 extern cpuop_func op_cb8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_cb8_0_fuse_nf;
+extern cpuop_func op_cb8_0_fuse_ff;
+#endif
 extern cpuop_func op_cb9_0_nf;
 extern cpuop_func op_cb9_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_cb9_0_fuse_nf;
+extern cpuop_func op_cb9_0_fuse_ff;
+#endif
 extern cpuop_func op_cba_0_nf;
 extern cpuop_func op_cba_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_cba_0_fuse_nf;
+extern cpuop_func op_cba_0_fuse_ff;
+#endif
 extern cpuop_func op_cbb_0_nf;
 extern cpuop_func op_cbb_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_cbb_0_fuse_nf;
+extern cpuop_func op_cbb_0_fuse_ff;
+#endif
 extern cpuop_func op_cd0_0_nf;
 extern cpuop_func op_cd0_0_ff;
 extern cpuop_func op_cd8_0_nf;
@@ -676,10 +884,22 @@ extern cpuop_func op_10bc_0_nf;
 extern cpuop_func op_10bc_0_ff;
 extern cpuop_func op_10c0_0_nf;
 extern cpuop_func op_10c0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_10c0_0_fuse_nf;
+extern cpuop_func op_10c0_0_fuse_ff;
+#endif
 extern cpuop_func op_10d0_0_nf;
 extern cpuop_func op_10d0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_10d0_0_fuse_nf;
+extern cpuop_func op_10d0_0_fuse_ff;
+#endif
 extern cpuop_func op_10d8_0_nf;
 extern cpuop_func op_10d8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_10d8_0_fuse_nf;
+extern cpuop_func op_10d8_0_fuse_ff;
+#endif
 extern cpuop_func op_10e0_0_nf;
 extern cpuop_func op_10e0_0_ff;
 extern cpuop_func op_10e8_0_nf;
@@ -880,12 +1100,24 @@ extern cpuop_func op_20bc_0_nf;
 extern cpuop_func op_20bc_0_ff;
 extern cpuop_func op_20c0_0_nf;
 extern cpuop_func op_20c0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_20c0_0_fuse_nf;
+extern cpuop_func op_20c0_0_fuse_ff;
+#endif
 extern cpuop_func op_20c8_0_nf;
 extern cpuop_func op_20c8_0_ff;
 extern cpuop_func op_20d0_0_nf;
 extern cpuop_func op_20d0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_20d0_0_fuse_nf;
+extern cpuop_func op_20d0_0_fuse_ff;
+#endif
 extern cpuop_func op_20d8_0_nf;
 extern cpuop_func op_20d8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_20d8_0_fuse_nf;
+extern cpuop_func op_20d8_0_fuse_ff;
+#endif
 extern cpuop_func op_20e0_0_nf;
 extern cpuop_func op_20e0_0_ff;
 extern cpuop_func op_20e8_0_nf;
@@ -1096,12 +1328,24 @@ extern cpuop_func op_30bc_0_nf;
 extern cpuop_func op_30bc_0_ff;
 extern cpuop_func op_30c0_0_nf;
 extern cpuop_func op_30c0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_30c0_0_fuse_nf;
+extern cpuop_func op_30c0_0_fuse_ff;
+#endif
 extern cpuop_func op_30c8_0_nf;
 extern cpuop_func op_30c8_0_ff;
 extern cpuop_func op_30d0_0_nf;
 extern cpuop_func op_30d0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_30d0_0_fuse_nf;
+extern cpuop_func op_30d0_0_fuse_ff;
+#endif
 extern cpuop_func op_30d8_0_nf;
 extern cpuop_func op_30d8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_30d8_0_fuse_nf;
+extern cpuop_func op_30d8_0_fuse_ff;
+#endif
 extern cpuop_func op_30e0_0_nf;
 extern cpuop_func op_30e0_0_ff;
 extern cpuop_func op_30e8_0_nf;
@@ -1366,6 +1610,10 @@ extern cpuop_func op_4210_0_nf;
 extern cpuop_func op_4210_0_ff;
 extern cpuop_func op_4218_0_nf;
 extern cpuop_func op_4218_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4218_0_fuse_nf;
+extern cpuop_func op_4218_0_fuse_ff;
+#endif
 extern cpuop_func op_4220_0_nf;
 extern cpuop_func op_4220_0_ff;
 extern cpuop_func op_4228_0_nf;
@@ -1382,6 +1630,10 @@ extern cpuop_func op_4250_0_nf;
 extern cpuop_func op_4250_0_ff;
 extern cpuop_func op_4258_0_nf;
 extern cpuop_func op_4258_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4258_0_fuse_nf;
+extern cpuop_func op_4258_0_fuse_ff;
+#endif
 extern cpuop_func op_4260_0_nf;
 extern cpuop_func op_4260_0_ff;
 extern cpuop_func op_4268_0_nf;
@@ -1398,6 +1650,10 @@ extern cpuop_func op_4290_0_nf;
 extern cpuop_func op_4290_0_ff;
 extern cpuop_func op_4298_0_nf;
 extern cpuop_func op_4298_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4298_0_fuse_nf;
+extern cpuop_func op_4298_0_fuse_ff;
+#endif
 extern cpuop_func op_42a0_0_nf;
 extern cpuop_func op_42a0_0_ff;
 extern cpuop_func op_42a8_0_nf;
@@ -1632,74 +1888,214 @@ extern cpuop_func op_49c0_0_nf;
 extern cpuop_func op_49c0_0_ff;
 extern cpuop_func op_4a00_0_nf;
 extern cpuop_func op_4a00_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a00_0_fuse_nf;
+extern cpuop_func op_4a00_0_fuse_ff;
+#endif
 extern cpuop_func op_4a10_0_nf;
 extern cpuop_func op_4a10_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a10_0_fuse_nf;
+extern cpuop_func op_4a10_0_fuse_ff;
+#endif
 extern cpuop_func op_4a18_0_nf;
 extern cpuop_func op_4a18_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a18_0_fuse_nf;
+extern cpuop_func op_4a18_0_fuse_ff;
+#endif
 extern cpuop_func op_4a20_0_nf;
 extern cpuop_func op_4a20_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a20_0_fuse_nf;
+extern cpuop_func op_4a20_0_fuse_ff;
+#endif
 extern cpuop_func op_4a28_0_nf;
 extern cpuop_func op_4a28_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a28_0_fuse_nf;
+extern cpuop_func op_4a28_0_fuse_ff;
+#endif
 extern cpuop_func op_4a30_0_nf;
 extern cpuop_func op_4a30_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a30_0_fuse_nf;
+extern cpuop_func op_4a30_0_fuse_ff;
+#endif
 extern cpuop_func op_4a38_0_nf;
 extern cpuop_func op_4a38_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a38_0_fuse_nf;
+extern cpuop_func op_4a38_0_fuse_ff;
+#endif
 extern cpuop_func op_4a39_0_nf;
 extern cpuop_func op_4a39_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a39_0_fuse_nf;
+extern cpuop_func op_4a39_0_fuse_ff;
+#endif
 extern cpuop_func op_4a3a_0_nf;
 extern cpuop_func op_4a3a_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a3a_0_fuse_nf;
+extern cpuop_func op_4a3a_0_fuse_ff;
+#endif
 extern cpuop_func op_4a3b_0_nf;
 extern cpuop_func op_4a3b_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a3b_0_fuse_nf;
+extern cpuop_func op_4a3b_0_fuse_ff;
+#endif
 extern cpuop_func op_4a3c_0_nf;
 extern cpuop_func op_4a3c_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a3c_0_fuse_nf;
+extern cpuop_func op_4a3c_0_fuse_ff;
+#endif
 extern cpuop_func op_4a40_0_nf;
 extern cpuop_func op_4a40_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a40_0_fuse_nf;
+extern cpuop_func op_4a40_0_fuse_ff;
+#endif
 extern cpuop_func op_4a48_0_nf;
 extern cpuop_func op_4a48_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a48_0_fuse_nf;
+extern cpuop_func op_4a48_0_fuse_ff;
+#endif
 extern cpuop_func op_4a50_0_nf;
 extern cpuop_func op_4a50_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a50_0_fuse_nf;
+extern cpuop_func op_4a50_0_fuse_ff;
+#endif
 extern cpuop_func op_4a58_0_nf;
 extern cpuop_func op_4a58_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a58_0_fuse_nf;
+extern cpuop_func op_4a58_0_fuse_ff;
+#endif
 extern cpuop_func op_4a60_0_nf;
 extern cpuop_func op_4a60_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a60_0_fuse_nf;
+extern cpuop_func op_4a60_0_fuse_ff;
+#endif
 extern cpuop_func op_4a68_0_nf;
 extern cpuop_func op_4a68_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a68_0_fuse_nf;
+extern cpuop_func op_4a68_0_fuse_ff;
+#endif
 extern cpuop_func op_4a70_0_nf;
 extern cpuop_func op_4a70_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a70_0_fuse_nf;
+extern cpuop_func op_4a70_0_fuse_ff;
+#endif
 extern cpuop_func op_4a78_0_nf;
 extern cpuop_func op_4a78_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a78_0_fuse_nf;
+extern cpuop_func op_4a78_0_fuse_ff;
+#endif
 extern cpuop_func op_4a79_0_nf;
 extern cpuop_func op_4a79_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a79_0_fuse_nf;
+extern cpuop_func op_4a79_0_fuse_ff;
+#endif
 extern cpuop_func op_4a7a_0_nf;
 extern cpuop_func op_4a7a_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a7a_0_fuse_nf;
+extern cpuop_func op_4a7a_0_fuse_ff;
+#endif
 extern cpuop_func op_4a7b_0_nf;
 extern cpuop_func op_4a7b_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a7b_0_fuse_nf;
+extern cpuop_func op_4a7b_0_fuse_ff;
+#endif
 extern cpuop_func op_4a7c_0_nf;
 extern cpuop_func op_4a7c_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a7c_0_fuse_nf;
+extern cpuop_func op_4a7c_0_fuse_ff;
+#endif
 extern cpuop_func op_4a80_0_nf;
 extern cpuop_func op_4a80_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a80_0_fuse_nf;
+extern cpuop_func op_4a80_0_fuse_ff;
+#endif
 extern cpuop_func op_4a88_0_nf;
 extern cpuop_func op_4a88_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a88_0_fuse_nf;
+extern cpuop_func op_4a88_0_fuse_ff;
+#endif
 extern cpuop_func op_4a90_0_nf;
 extern cpuop_func op_4a90_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a90_0_fuse_nf;
+extern cpuop_func op_4a90_0_fuse_ff;
+#endif
 extern cpuop_func op_4a98_0_nf;
 extern cpuop_func op_4a98_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4a98_0_fuse_nf;
+extern cpuop_func op_4a98_0_fuse_ff;
+#endif
 extern cpuop_func op_4aa0_0_nf;
 extern cpuop_func op_4aa0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4aa0_0_fuse_nf;
+extern cpuop_func op_4aa0_0_fuse_ff;
+#endif
 extern cpuop_func op_4aa8_0_nf;
 extern cpuop_func op_4aa8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4aa8_0_fuse_nf;
+extern cpuop_func op_4aa8_0_fuse_ff;
+#endif
 extern cpuop_func op_4ab0_0_nf;
 extern cpuop_func op_4ab0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4ab0_0_fuse_nf;
+extern cpuop_func op_4ab0_0_fuse_ff;
+#endif
 extern cpuop_func op_4ab8_0_nf;
 extern cpuop_func op_4ab8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4ab8_0_fuse_nf;
+extern cpuop_func op_4ab8_0_fuse_ff;
+#endif
 extern cpuop_func op_4ab9_0_nf;
 extern cpuop_func op_4ab9_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4ab9_0_fuse_nf;
+extern cpuop_func op_4ab9_0_fuse_ff;
+#endif
 extern cpuop_func op_4aba_0_nf;
 extern cpuop_func op_4aba_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4aba_0_fuse_nf;
+extern cpuop_func op_4aba_0_fuse_ff;
+#endif
 extern cpuop_func op_4abb_0_nf;
 extern cpuop_func op_4abb_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4abb_0_fuse_nf;
+extern cpuop_func op_4abb_0_fuse_ff;
+#endif
 extern cpuop_func op_4abc_0_nf;
 extern cpuop_func op_4abc_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_4abc_0_fuse_nf;
+extern cpuop_func op_4abc_0_fuse_ff;
+#endif
 extern cpuop_func op_4ac0_0_nf;
 extern cpuop_func op_4ac0_0_ff;
 extern cpuop_func op_4ad0_0_nf;
@@ -1852,6 +2248,10 @@ extern cpuop_func op_4efb_0_nf;
 extern cpuop_func op_4efb_0_ff;
 extern cpuop_func op_5000_0_nf;
 extern cpuop_func op_5000_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_5000_0_fuse_nf;
+extern cpuop_func op_5000_0_fuse_ff;
+#endif
 extern cpuop_func op_5010_0_nf;
 extern cpuop_func op_5010_0_ff;
 extern cpuop_func op_5018_0_nf;
@@ -1868,6 +2268,10 @@ extern cpuop_func op_5039_0_nf;
 extern cpuop_func op_5039_0_ff;
 extern cpuop_func op_5040_0_nf;
 extern cpuop_func op_5040_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_5040_0_fuse_nf;
+extern cpuop_func op_5040_0_fuse_ff;
+#endif
 extern cpuop_func op_5048_0_nf;
 extern cpuop_func op_5048_0_ff;
 extern cpuop_func op_5050_0_nf;
@@ -1886,6 +2290,10 @@ extern cpuop_func op_5079_0_nf;
 extern cpuop_func op_5079_0_ff;
 extern cpuop_func op_5080_0_nf;
 extern cpuop_func op_5080_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_5080_0_fuse_nf;
+extern cpuop_func op_5080_0_fuse_ff;
+#endif
 extern cpuop_func op_5088_0_nf;
 extern cpuop_func op_5088_0_ff;
 extern cpuop_func op_5090_0_nf;
@@ -1928,6 +2336,10 @@ extern cpuop_func op_50fc_0_nf;
 extern cpuop_func op_50fc_0_ff;
 extern cpuop_func op_5100_0_nf;
 extern cpuop_func op_5100_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_5100_0_fuse_nf;
+extern cpuop_func op_5100_0_fuse_ff;
+#endif
 extern cpuop_func op_5110_0_nf;
 extern cpuop_func op_5110_0_ff;
 extern cpuop_func op_5118_0_nf;
@@ -1944,6 +2356,10 @@ extern cpuop_func op_5139_0_nf;
 extern cpuop_func op_5139_0_ff;
 extern cpuop_func op_5140_0_nf;
 extern cpuop_func op_5140_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_5140_0_fuse_nf;
+extern cpuop_func op_5140_0_fuse_ff;
+#endif
 extern cpuop_func op_5148_0_nf;
 extern cpuop_func op_5148_0_ff;
 extern cpuop_func op_5150_0_nf;
@@ -1962,6 +2378,10 @@ extern cpuop_func op_5179_0_nf;
 extern cpuop_func op_5179_0_ff;
 extern cpuop_func op_5180_0_nf;
 extern cpuop_func op_5180_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_5180_0_fuse_nf;
+extern cpuop_func op_5180_0_fuse_ff;
+#endif
 extern cpuop_func op_5188_0_nf;
 extern cpuop_func op_5188_0_ff;
 extern cpuop_func op_5190_0_nf;
@@ -2778,102 +3198,294 @@ extern cpuop_func op_91fc_0_nf;
 extern cpuop_func op_91fc_0_ff;
 extern cpuop_func op_b000_0_nf;
 extern cpuop_func op_b000_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b000_0_fuse_nf;
+extern cpuop_func op_b000_0_fuse_ff;
+#endif
 extern cpuop_func op_b010_0_nf;
 extern cpuop_func op_b010_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b010_0_fuse_nf;
+extern cpuop_func op_b010_0_fuse_ff;
+#endif
 extern cpuop_func op_b018_0_nf;
 extern cpuop_func op_b018_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b018_0_fuse_nf;
+extern cpuop_func op_b018_0_fuse_ff;
+#endif
 extern cpuop_func op_b020_0_nf;
 extern cpuop_func op_b020_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b020_0_fuse_nf;
+extern cpuop_func op_b020_0_fuse_ff;
+#endif
 extern cpuop_func op_b028_0_nf;
 extern cpuop_func op_b028_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b028_0_fuse_nf;
+extern cpuop_func op_b028_0_fuse_ff;
+#endif
 extern cpuop_func op_b030_0_nf;
 extern cpuop_func op_b030_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b030_0_fuse_nf;
+extern cpuop_func op_b030_0_fuse_ff;
+#endif
 extern cpuop_func op_b038_0_nf;
 extern cpuop_func op_b038_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b038_0_fuse_nf;
+extern cpuop_func op_b038_0_fuse_ff;
+#endif
 extern cpuop_func op_b039_0_nf;
 extern cpuop_func op_b039_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b039_0_fuse_nf;
+extern cpuop_func op_b039_0_fuse_ff;
+#endif
 extern cpuop_func op_b03a_0_nf;
 extern cpuop_func op_b03a_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b03a_0_fuse_nf;
+extern cpuop_func op_b03a_0_fuse_ff;
+#endif
 extern cpuop_func op_b03b_0_nf;
 extern cpuop_func op_b03b_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b03b_0_fuse_nf;
+extern cpuop_func op_b03b_0_fuse_ff;
+#endif
 extern cpuop_func op_b03c_0_nf;
 extern cpuop_func op_b03c_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b03c_0_fuse_nf;
+extern cpuop_func op_b03c_0_fuse_ff;
+#endif
 extern cpuop_func op_b040_0_nf;
 extern cpuop_func op_b040_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b040_0_fuse_nf;
+extern cpuop_func op_b040_0_fuse_ff;
+#endif
 extern cpuop_func op_b048_0_nf;
 extern cpuop_func op_b048_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b048_0_fuse_nf;
+extern cpuop_func op_b048_0_fuse_ff;
+#endif
 extern cpuop_func op_b050_0_nf;
 extern cpuop_func op_b050_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b050_0_fuse_nf;
+extern cpuop_func op_b050_0_fuse_ff;
+#endif
 extern cpuop_func op_b058_0_nf;
 extern cpuop_func op_b058_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b058_0_fuse_nf;
+extern cpuop_func op_b058_0_fuse_ff;
+#endif
 extern cpuop_func op_b060_0_nf;
 extern cpuop_func op_b060_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b060_0_fuse_nf;
+extern cpuop_func op_b060_0_fuse_ff;
+#endif
 extern cpuop_func op_b068_0_nf;
 extern cpuop_func op_b068_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b068_0_fuse_nf;
+extern cpuop_func op_b068_0_fuse_ff;
+#endif
 extern cpuop_func op_b070_0_nf;
 extern cpuop_func op_b070_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b070_0_fuse_nf;
+extern cpuop_func op_b070_0_fuse_ff;
+#endif
 extern cpuop_func op_b078_0_nf;
 extern cpuop_func op_b078_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b078_0_fuse_nf;
+extern cpuop_func op_b078_0_fuse_ff;
+#endif
 extern cpuop_func op_b079_0_nf;
 extern cpuop_func op_b079_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b079_0_fuse_nf;
+extern cpuop_func op_b079_0_fuse_ff;
+#endif
 extern cpuop_func op_b07a_0_nf;
 extern cpuop_func op_b07a_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b07a_0_fuse_nf;
+extern cpuop_func op_b07a_0_fuse_ff;
+#endif
 extern cpuop_func op_b07b_0_nf;
 extern cpuop_func op_b07b_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b07b_0_fuse_nf;
+extern cpuop_func op_b07b_0_fuse_ff;
+#endif
 extern cpuop_func op_b07c_0_nf;
 extern cpuop_func op_b07c_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b07c_0_fuse_nf;
+extern cpuop_func op_b07c_0_fuse_ff;
+#endif
 extern cpuop_func op_b080_0_nf;
 extern cpuop_func op_b080_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b080_0_fuse_nf;
+extern cpuop_func op_b080_0_fuse_ff;
+#endif
 extern cpuop_func op_b088_0_nf;
 extern cpuop_func op_b088_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b088_0_fuse_nf;
+extern cpuop_func op_b088_0_fuse_ff;
+#endif
 extern cpuop_func op_b090_0_nf;
 extern cpuop_func op_b090_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b090_0_fuse_nf;
+extern cpuop_func op_b090_0_fuse_ff;
+#endif
 extern cpuop_func op_b098_0_nf;
 extern cpuop_func op_b098_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b098_0_fuse_nf;
+extern cpuop_func op_b098_0_fuse_ff;
+#endif
 extern cpuop_func op_b0a0_0_nf;
 extern cpuop_func op_b0a0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0a0_0_fuse_nf;
+extern cpuop_func op_b0a0_0_fuse_ff;
+#endif
 extern cpuop_func op_b0a8_0_nf;
 extern cpuop_func op_b0a8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0a8_0_fuse_nf;
+extern cpuop_func op_b0a8_0_fuse_ff;
+#endif
 extern cpuop_func op_b0b0_0_nf;
 extern cpuop_func op_b0b0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0b0_0_fuse_nf;
+extern cpuop_func op_b0b0_0_fuse_ff;
+#endif
 extern cpuop_func op_b0b8_0_nf;
 extern cpuop_func op_b0b8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0b8_0_fuse_nf;
+extern cpuop_func op_b0b8_0_fuse_ff;
+#endif
 extern cpuop_func op_b0b9_0_nf;
 extern cpuop_func op_b0b9_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0b9_0_fuse_nf;
+extern cpuop_func op_b0b9_0_fuse_ff;
+#endif
 extern cpuop_func op_b0ba_0_nf;
 extern cpuop_func op_b0ba_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0ba_0_fuse_nf;
+extern cpuop_func op_b0ba_0_fuse_ff;
+#endif
 extern cpuop_func op_b0bb_0_nf;
 extern cpuop_func op_b0bb_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0bb_0_fuse_nf;
+extern cpuop_func op_b0bb_0_fuse_ff;
+#endif
 extern cpuop_func op_b0bc_0_nf;
 extern cpuop_func op_b0bc_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0bc_0_fuse_nf;
+extern cpuop_func op_b0bc_0_fuse_ff;
+#endif
 extern cpuop_func op_b0c0_0_nf;
 extern cpuop_func op_b0c0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0c0_0_fuse_nf;
+extern cpuop_func op_b0c0_0_fuse_ff;
+#endif
 extern cpuop_func op_b0c8_0_nf;
 extern cpuop_func op_b0c8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0c8_0_fuse_nf;
+extern cpuop_func op_b0c8_0_fuse_ff;
+#endif
 extern cpuop_func op_b0d0_0_nf;
 extern cpuop_func op_b0d0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0d0_0_fuse_nf;
+extern cpuop_func op_b0d0_0_fuse_ff;
+#endif
 extern cpuop_func op_b0d8_0_nf;
 extern cpuop_func op_b0d8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0d8_0_fuse_nf;
+extern cpuop_func op_b0d8_0_fuse_ff;
+#endif
 extern cpuop_func op_b0e0_0_nf;
 extern cpuop_func op_b0e0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0e0_0_fuse_nf;
+extern cpuop_func op_b0e0_0_fuse_ff;
+#endif
 extern cpuop_func op_b0e8_0_nf;
 extern cpuop_func op_b0e8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0e8_0_fuse_nf;
+extern cpuop_func op_b0e8_0_fuse_ff;
+#endif
 extern cpuop_func op_b0f0_0_nf;
 extern cpuop_func op_b0f0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0f0_0_fuse_nf;
+extern cpuop_func op_b0f0_0_fuse_ff;
+#endif
 extern cpuop_func op_b0f8_0_nf;
 extern cpuop_func op_b0f8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0f8_0_fuse_nf;
+extern cpuop_func op_b0f8_0_fuse_ff;
+#endif
 extern cpuop_func op_b0f9_0_nf;
 extern cpuop_func op_b0f9_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0f9_0_fuse_nf;
+extern cpuop_func op_b0f9_0_fuse_ff;
+#endif
 extern cpuop_func op_b0fa_0_nf;
 extern cpuop_func op_b0fa_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0fa_0_fuse_nf;
+extern cpuop_func op_b0fa_0_fuse_ff;
+#endif
 extern cpuop_func op_b0fb_0_nf;
 extern cpuop_func op_b0fb_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0fb_0_fuse_nf;
+extern cpuop_func op_b0fb_0_fuse_ff;
+#endif
 extern cpuop_func op_b0fc_0_nf;
 extern cpuop_func op_b0fc_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b0fc_0_fuse_nf;
+extern cpuop_func op_b0fc_0_fuse_ff;
+#endif
 extern cpuop_func op_b100_0_nf;
 extern cpuop_func op_b100_0_ff;
 extern cpuop_func op_b108_0_nf;
 extern cpuop_func op_b108_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b108_0_fuse_nf;
+extern cpuop_func op_b108_0_fuse_ff;
+#endif
 extern cpuop_func op_b110_0_nf;
 extern cpuop_func op_b110_0_ff;
 extern cpuop_func op_b118_0_nf;
@@ -2892,6 +3504,10 @@ extern cpuop_func op_b140_0_nf;
 extern cpuop_func op_b140_0_ff;
 extern cpuop_func op_b148_0_nf;
 extern cpuop_func op_b148_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b148_0_fuse_nf;
+extern cpuop_func op_b148_0_fuse_ff;
+#endif
 extern cpuop_func op_b150_0_nf;
 extern cpuop_func op_b150_0_ff;
 extern cpuop_func op_b158_0_nf;
@@ -2910,6 +3526,10 @@ extern cpuop_func op_b180_0_nf;
 extern cpuop_func op_b180_0_ff;
 extern cpuop_func op_b188_0_nf;
 extern cpuop_func op_b188_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b188_0_fuse_nf;
+extern cpuop_func op_b188_0_fuse_ff;
+#endif
 extern cpuop_func op_b190_0_nf;
 extern cpuop_func op_b190_0_ff;
 extern cpuop_func op_b198_0_nf;
@@ -2926,28 +3546,76 @@ extern cpuop_func op_b1b9_0_nf;
 extern cpuop_func op_b1b9_0_ff;
 extern cpuop_func op_b1c0_0_nf;
 extern cpuop_func op_b1c0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1c0_0_fuse_nf;
+extern cpuop_func op_b1c0_0_fuse_ff;
+#endif
 extern cpuop_func op_b1c8_0_nf;
 extern cpuop_func op_b1c8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1c8_0_fuse_nf;
+extern cpuop_func op_b1c8_0_fuse_ff;
+#endif
 extern cpuop_func op_b1d0_0_nf;
 extern cpuop_func op_b1d0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1d0_0_fuse_nf;
+extern cpuop_func op_b1d0_0_fuse_ff;
+#endif
 extern cpuop_func op_b1d8_0_nf;
 extern cpuop_func op_b1d8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1d8_0_fuse_nf;
+extern cpuop_func op_b1d8_0_fuse_ff;
+#endif
 extern cpuop_func op_b1e0_0_nf;
 extern cpuop_func op_b1e0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1e0_0_fuse_nf;
+extern cpuop_func op_b1e0_0_fuse_ff;
+#endif
 extern cpuop_func op_b1e8_0_nf;
 extern cpuop_func op_b1e8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1e8_0_fuse_nf;
+extern cpuop_func op_b1e8_0_fuse_ff;
+#endif
 extern cpuop_func op_b1f0_0_nf;
 extern cpuop_func op_b1f0_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1f0_0_fuse_nf;
+extern cpuop_func op_b1f0_0_fuse_ff;
+#endif
 extern cpuop_func op_b1f8_0_nf;
 extern cpuop_func op_b1f8_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1f8_0_fuse_nf;
+extern cpuop_func op_b1f8_0_fuse_ff;
+#endif
 extern cpuop_func op_b1f9_0_nf;
 extern cpuop_func op_b1f9_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1f9_0_fuse_nf;
+extern cpuop_func op_b1f9_0_fuse_ff;
+#endif
 extern cpuop_func op_b1fa_0_nf;
 extern cpuop_func op_b1fa_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1fa_0_fuse_nf;
+extern cpuop_func op_b1fa_0_fuse_ff;
+#endif
 extern cpuop_func op_b1fb_0_nf;
 extern cpuop_func op_b1fb_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1fb_0_fuse_nf;
+extern cpuop_func op_b1fb_0_fuse_ff;
+#endif
 extern cpuop_func op_b1fc_0_nf;
 extern cpuop_func op_b1fc_0_ff;
+#if USE_SUPERINSNS
+extern cpuop_func op_b1fc_0_fuse_nf;
+extern cpuop_func op_b1fc_0_fuse_ff;
+#endif
 extern cpuop_func op_c000_0_nf;
 extern cpuop_func op_c000_0_ff;
 extern cpuop_func op_c010_0_nf;
@@ -0,0 +1,232 @@
+/*
+ *  jit_rv32.cpp - Threaded-code block translator for RISC-V hosts
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Hot decode cache traces (see newcpu.cpp) are turned into straight-line
+ *  RV32I code that loads each opcode as an immediate and calls its gencpu
+ *  handler directly. Between handlers the code performs the same checks as
+ *  the interpreted replay (expected PC, cache epoch, special flags) and
+ *  returns to the interpreter as soon as one fails, so every instruction
+ *  keeps its normal handler semantics. Only the dispatch is compiled.
+ */
+
+#include "sysdeps.h"
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#if __has_include(<esp_cache.h>)
+#include <esp_cache.h>
+#define HAS_ESP_CACHE 1
+#endif
+#endif
+
+#include "cpu_emulation.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "jit_rv32.h"
+
+#if USE_RV32_JIT
+
+#include <stddef.h>
+
+#define JIT_CODE_SIZE	(64 * 1024)
+
+static uae_u32 *jit_code = NULL;		// Executable buffer
+static uae_u32 *jit_code_ptr = NULL;	// Next free word
+static uae_u32 *jit_code_end = NULL;
+
+#if defined(__riscv)
+
+// Register numbers
+enum {
+	R_ZERO = 0, R_RA = 1, R_SP = 2, R_T0 = 5, R_T1 = 6, R_T2 = 7,
+	R_S0 = 8, R_S1 = 9, R_A0 = 10, R_S2 = 18
+};
+
+// Instruction encoders
+static inline uae_u32 rv_i(int opc, int f3, int rd, int rs1, uae_s32 imm)
+{
+	return ((uae_u32)(imm & 0xfff) << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | opc;
+}
+
+static inline uae_u32 rv_s(int f3, int rs1, int rs2, uae_s32 imm)
+{
+	return ((uae_u32)((imm >> 5) & 0x7f) << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | ((imm & 0x1f) << 7) | 0x23;
+}
+
+static inline uae_u32 rv_b(int f3, int rs1, int rs2, uae_s32 imm)
+{
+	return ((uae_u32)((imm >> 12) & 1) << 31) | (((imm >> 5) & 0x3f) << 25) | (rs2 << 20) | (rs1 << 15) |
+		   (f3 << 12) | (((imm >> 1) & 0xf) << 8) | (((imm >> 11) & 1) << 7) | 0x63;
+}
+
+#define RV_ADDI(rd, rs1, imm)	rv_i(0x13, 0, rd, rs1, imm)
+#define RV_ANDI(rd, rs1, imm)	rv_i(0x13, 7, rd, rs1, imm)
+#define RV_LW(rd, rs1, imm)		rv_i(0x03, 2, rd, rs1, imm)
+#define RV_JALR(rd, rs1, imm)	rv_i(0x67, 0, rd, rs1, imm)
+#define RV_SW(rs2, rs1, imm)	rv_s(2, rs1, rs2, imm)
+#define RV_LUI(rd, imm20)		(((uae_u32)(imm20) << 12) | ((rd) << 7) | 0x37)
+#define RV_BNE_PLACEHOLDER(rs1, rs2)	rv_b(1, rs1, rs2, 0)
+
+static inline void emit(uae_u32 insn)
+{
+	*jit_code_ptr++ = insn;
+}
+
+// Load a 32-bit constant
+static void emit_li(int rd, uae_u32 value)
+{
+	uae_s32 lo = value & 0xfff;
+	if (lo >= 0x800)
+		lo -= 0x1000;
+	uae_u32 hi = ((value - lo) >> 12) & 0xfffff;
+	if (hi == 0)
+		emit(RV_ADDI(rd, R_ZERO, lo));
+	else {
+		emit(RV_LUI(rd, hi));
+		if (lo)
+			emit(RV_ADDI(rd, rd, lo));
+	}
+}
+
+// Words needed in the worst case: prologue, per instruction checks and call, epilogue
+#define JIT_PROLOGUE_WORDS	11
+#define JIT_INSN_WORDS		17
+#define JIT_EPILOGUE_WORDS	7
+
+static void sync_icache(void *start, size_t size)
+{
+#if HAS_ESP_CACHE
+	// Write back the data side before instruction fetch sees the buffer
+	esp_cache_msync(start, size, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+#endif
+	__asm__ __volatile__ ("fence.i" ::: "memory");
+}
+
+jit_block_func jit_rv32_compile(uae_u8 *page, const uae_u16 *offset, const uae_u16 *opcode,
+                                cpuop_func * const *handler, int count, const uae_u32 *epoch)
+{
+	if (jit_code == NULL)
+		return NULL;
+	if (count > JIT_MAX_TRACE_LEN)
+		count = JIT_MAX_TRACE_LEN;
+	if (jit_code_ptr + JIT_PROLOGUE_WORDS + count * JIT_INSN_WORDS + JIT_EPILOGUE_WORDS > jit_code_end)
+		return NULL;
+
+	uae_u32 *start = jit_code_ptr;
+	uae_u32 *exits[JIT_MAX_TRACE_LEN * 3];
+	int num_exits = 0;
+	const int pc_p_off = offsetof(struct regstruct, pc_p);
+	const int spcflags_off = offsetof(struct regstruct, spcflags);
+
+	// Prologue: s0 = &regs, s1 = instructions executed, s2 = epoch on entry
+	emit(RV_ADDI(R_SP, R_SP, -16));
+	emit(RV_SW(R_RA, R_SP, 12));
+	emit(RV_SW(R_S0, R_SP, 8));
+	emit(RV_SW(R_S1, R_SP, 4));
+	emit(RV_SW(R_S2, R_SP, 0));
+	emit_li(R_S0, (uae_u32)(uintptr)&regs);
+	emit_li(R_T0, (uae_u32)(uintptr)epoch);
+	emit(RV_LW(R_S2, R_T0, 0));
+	emit(RV_ADDI(R_S1, R_ZERO, 0));
+
+	for (int i = 0; i < count; i++) {
+		if (i > 0) {
+			// Still on the recorded path, and nothing retired the trace?
+			emit(RV_LW(R_T0, R_S0, pc_p_off));
+			emit_li(R_T1, (uae_u32)(uintptr)(page + offset[i]));
+			exits[num_exits++] = jit_code_ptr;
+			emit(RV_BNE_PLACEHOLDER(R_T0, R_T1));
+			emit_li(R_T0, (uae_u32)(uintptr)epoch);
+			emit(RV_LW(R_T0, R_T0, 0));
+			exits[num_exits++] = jit_code_ptr;
+			emit(RV_BNE_PLACEHOLDER(R_T0, R_S2));
+		}
+		emit_li(R_A0, opcode[i]);
+		emit_li(R_T2, (uae_u32)(uintptr)handler[i]);
+		emit(RV_JALR(R_RA, R_T2, 0));
+		emit(RV_ADDI(R_S1, R_S1, 1));
+		if (i < count - 1) {
+			emit(RV_LW(R_T0, R_S0, spcflags_off));
+			emit(RV_ANDI(R_T0, R_T0, SPCFLAG_ALL_BUT_EXEC_RETURN));
+			exits[num_exits++] = jit_code_ptr;
+			emit(RV_BNE_PLACEHOLDER(R_T0, R_ZERO));
+		}
+	}
+
+	// Epilogue: return the instruction count
+	uae_u32 *exit_label = jit_code_ptr;
+	emit(RV_ADDI(R_A0, R_S1, 0));
+	emit(RV_LW(R_RA, R_SP, 12));
+	emit(RV_LW(R_S0, R_SP, 8));
+	emit(RV_LW(R_S1, R_SP, 4));
+	emit(RV_LW(R_S2, R_SP, 0));
+	emit(RV_ADDI(R_SP, R_SP, 16));
+	emit(RV_JALR(R_ZERO, R_RA, 0));
+
+	// Patch the early exits now that the epilogue address is known
+	for (int i = 0; i < num_exits; i++) {
+		uae_u32 insn = *exits[i];
+		uae_s32 disp = (uae_s32)((uae_u8 *)exit_label - (uae_u8 *)exits[i]);
+		*exits[i] = rv_b(1, (insn >> 15) & 0x1f, (insn >> 20) & 0x1f, disp);
+	}
+
+	sync_icache(start, (jit_code_ptr - start) * sizeof(uae_u32));
+	return (jit_block_func)start;
+}
+
+#else
+
+// Not a RISC-V host: nothing to translate to, the interpreter handles everything
+jit_block_func jit_rv32_compile(uae_u8 *page, const uae_u16 *offset, const uae_u16 *opcode,
+                                cpuop_func * const *handler, int count, const uae_u32 *epoch)
+{
+	return NULL;
+}
+
+#endif
+
+/*
+ *  Allocate the executable code buffer
+ */
+bool jit_rv32_init(void)
+{
+#if defined(__riscv)
+	if (jit_code == NULL) {
+#ifdef ARDUINO
+		jit_code = (uae_u32 *)heap_caps_malloc(JIT_CODE_SIZE, MALLOC_CAP_EXEC | MALLOC_CAP_32BIT);
+#endif
+		if (jit_code == NULL) {
+			write_log("JIT disabled: no executable memory (memory protection enabled?)\n");
+			return false;
+		}
+		write_log("Allocated JIT code buffer (%d KB) in IRAM\n", JIT_CODE_SIZE / 1024);
+	}
+	jit_rv32_reset();
+	return true;
+#else
+	return false;
+#endif
+}
+
+void jit_rv32_exit(void)
+{
+	if (jit_code) {
+		free(jit_code);
+		jit_code = jit_code_ptr = jit_code_end = NULL;
+	}
+}
+
+/*
+ *  Discard all translated code
+ */
+void jit_rv32_reset(void)
+{
+	jit_code_ptr = jit_code;
+	jit_code_end = jit_code ? jit_code + JIT_CODE_SIZE / sizeof(uae_u32) : NULL;
+}
+
+#endif /* USE_RV32_JIT */
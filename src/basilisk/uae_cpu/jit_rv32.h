@@ -0,0 +1,29 @@
+/*
+ *  jit_rv32.h - Threaded-code block translator for RISC-V hosts
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef JIT_RV32_H
+#define JIT_RV32_H
+
+#if USE_RV32_JIT
+
+// Longest trace the translator accepts (matches DCACHE_TRACE_LEN)
+#define JIT_MAX_TRACE_LEN 8
+
+// Compiled trace: runs the instructions and returns how many were executed
+typedef int (*jit_block_func)(void);
+
+extern bool jit_rv32_init(void);
+extern void jit_rv32_exit(void);
+
+// Translate a decode cache trace. Returns NULL when the code buffer is full;
+// the caller must then drop every block it holds and call jit_rv32_reset().
+extern jit_block_func jit_rv32_compile(uae_u8 *page, const uae_u16 *offset, const uae_u16 *opcode,
+                                       cpuop_func * const *handler, int count, const uae_u32 *epoch);
+extern void jit_rv32_reset(void);
+
+#endif
+
+#endif /* JIT_RV32_H */
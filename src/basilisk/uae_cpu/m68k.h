@@ -1011,6 +1011,8 @@ static inline uae_u32 sparc_v9_flag_addx_32(flag_struct *flags, uae_u32 src, uae
 
 #endif
 
+#define cctrue_lazy cctrue
+
 #else
 
 struct flag_struct {
@@ -1019,6 +1021,14 @@ struct flag_struct {
     unsigned int n;
     unsigned int v; 
     unsigned int x;
+#if LAZY_FLAGS
+    /* Pending N/Z/V/C computation recorded by the last flag-setting
+       ALU instruction, LAZY_NONE once c/z/n/v are up to date */
+    unsigned int lazy;
+    uae_u32 lazy_src;
+    uae_u32 lazy_dst;
+    uae_u32 lazy_res;
+#endif
 };
 
 extern struct flag_struct regflags;
@@ -1029,6 +1039,45 @@ extern struct flag_struct regflags;
 #define VFLG (regflags.v)
 #define XFLG (regflags.x)
 
+#if LAZY_FLAGS
+
+enum {
+    LAZY_NONE,
+    LAZY_LOGICAL_B, LAZY_LOGICAL_W, LAZY_LOGICAL_L,	/* MOVE, TST, AND, OR, ... */
+    LAZY_ADD_B, LAZY_ADD_W, LAZY_ADD_L,
+    LAZY_SUB_B, LAZY_SUB_W, LAZY_SUB_L				/* SUB and CMP */
+};
+
+extern void m68k_flags_sync (void);
+
+#define FLAGS_SYNC (regflags.lazy != LAZY_NONE ? m68k_flags_sync () : (void)0)
+
+#define SET_LAZY_LOGICAL(k, r) (regflags.lazy = (k), regflags.lazy_res = (r))
+#define SET_LAZY_FLAGS(k, s, d, r) \
+    (regflags.lazy = (k), regflags.lazy_src = (s), regflags.lazy_dst = (d), regflags.lazy_res = (r))
+
+/* Setting one flag needs the others materialised first; X is never deferred */
+#define SET_CFLG(x) (FLAGS_SYNC, CFLG = (x))
+#define SET_NFLG(x) (FLAGS_SYNC, NFLG = (x))
+#define SET_VFLG(x) (FLAGS_SYNC, VFLG = (x))
+#define SET_ZFLG(x) (FLAGS_SYNC, ZFLG = (x))
+#define SET_XFLG(x) (XFLG = (x))
+
+#define GET_CFLG (FLAGS_SYNC, CFLG)
+#define GET_NFLG (FLAGS_SYNC, NFLG)
+#define GET_VFLG (FLAGS_SYNC, VFLG)
+#define GET_ZFLG (FLAGS_SYNC, ZFLG)
+#define GET_XFLG XFLG
+
+#define CLEAR_CZNV do { \
+ regflags.lazy = LAZY_NONE; \
+ CFLG = ZFLG = NFLG = VFLG = 0; \
+} while (0)
+
+#else
+
+#define FLAGS_SYNC ((void)0)
+
 #define SET_CFLG(x) (CFLG = (x))
 #define SET_NFLG(x) (NFLG = (x))
 #define SET_VFLG(x) (VFLG = (x))
@@ -1048,10 +1097,13 @@ extern struct flag_struct regflags;
  SET_VFLG (0); \
 } while (0)
 
+#endif /* LAZY_FLAGS */
+
 #define COPY_CARRY (SET_XFLG (GET_CFLG))
 
 static __inline__ int cctrue(const int cc)
 {
+    FLAGS_SYNC;
     switch(cc){
      case 0: return 1;                       /* T */
      case 1: return 0;                       /* F */
@@ -1073,6 +1125,59 @@ static __inline__ int cctrue(const int cc)
     return 0;
 }
 
+#if LAZY_FLAGS
+/* Test a condition straight from a pending compare or logical result,
+   without materialising the flags (used by the fused Bcc/DBcc tails) */
+static __inline__ int cctrue_lazy(const int cc)
+{
+    int shift;
+    switch (regflags.lazy) {
+     case LAZY_LOGICAL_B: case LAZY_SUB_B: shift = 24; break;
+     case LAZY_LOGICAL_W: case LAZY_SUB_W: shift = 16; break;
+     case LAZY_LOGICAL_L: case LAZY_SUB_L: shift = 0; break;
+     default: return cctrue(cc);
+    }
+    /* Moving the operands to the top of the word keeps their ordering */
+    uae_s32 r = (uae_s32)(regflags.lazy_res << shift);
+    if (regflags.lazy <= LAZY_LOGICAL_L) {
+        switch(cc){
+         case 0: case 4: case 8: return 1;   /* T, CC, VC */
+         case 1: case 5: case 9: return 0;   /* F, CS, VS */
+         case 2: case 6: return r != 0;      /* HI, NE */
+         case 3: case 7: return r == 0;      /* LS, EQ */
+         case 10: case 12: return r >= 0;    /* PL, GE */
+         case 11: case 13: return r < 0;     /* MI, LT */
+         case 14: return r > 0;              /* GT */
+         case 15: return r <= 0;             /* LE */
+        }
+        return 0;
+    }
+    uae_u32 s = regflags.lazy_src << shift;
+    uae_u32 d = regflags.lazy_dst << shift;
+    switch(cc){
+     case 0: return 1;                       /* T */
+     case 1: return 0;                       /* F */
+     case 2: return d > s;                   /* HI */
+     case 3: return d <= s;                  /* LS */
+     case 4: return d >= s;                  /* CC */
+     case 5: return d < s;                   /* CS */
+     case 6: return r != 0;                  /* NE */
+     case 7: return r == 0;                  /* EQ */
+     case 8: return (((s ^ d) & (r ^ d)) >> 31) == 0; /* VC */
+     case 9: return (((s ^ d) & (r ^ d)) >> 31) != 0; /* VS */
+     case 10:return r >= 0;                  /* PL */
+     case 11:return r < 0;                   /* MI */
+     case 12:return (uae_s32)d >= (uae_s32)s; /* GE */
+     case 13:return (uae_s32)d < (uae_s32)s; /* LT */
+     case 14:return (uae_s32)d > (uae_s32)s; /* GT */
+     case 15:return (uae_s32)d <= (uae_s32)s; /* LE */
+    }
+    return 0;
+}
+#else
+#define cctrue_lazy cctrue
+#endif
+
 #endif /* OPTIMIZED_FLAGS */
 
 #endif /* M68K_FLAGS_H */
@@ -27,6 +27,7 @@
 
 #ifdef ARDUINO
 #include <esp_heap_caps.h>
+#include <esp_attr.h>
 #endif
 
 #include "cpu_emulation.h"
@@ -37,12 +38,39 @@
 #include "memory.h"
 #include "readcpu.h"
 #include "newcpu.h"
+#include "sram_plan.h"
+#include "perf_registry.h"
 
 #if !REAL_ADDRESSING && !DIRECT_ADDRESSING
 
 static bool illegal_mem = false;
 
-#ifdef SAVE_MEMORY_BANKS
+// Limits of the inline paths (memory.h), set by memory_init()
+uae_u32 mem_ram_end = 0;
+uae_u32 mem_ram_write_end = 0;
+uae_u32 mem_addr_mask = 0xffffffff;
+
+#if USE_COMPACT_BANKS
+// 64KB page index - dynamically allocated in internal SRAM on ESP32
+uae_u8 *mem_bank_index = NULL;
+addrbank *mem_bank_slots[MEM_BANK_SLOTS];
+static int mem_bank_count = 0;
+
+// Slot of a bank in mem_bank_slots, added on first use
+uae_u8 mem_bank_slot(addrbank *bank)
+{
+	for (int i = 0; i < mem_bank_count; i++)
+		if (mem_bank_slots[i] == bank)
+			return i;
+	if (mem_bank_count == MEM_BANK_SLOTS) {
+		// Slot 0 is dummy_bank (mapped first by memory_init)
+		write_log("[MEM] ERROR: More than %d memory banks, page mapped to dummy_bank\n", MEM_BANK_SLOTS);
+		return 0;
+	}
+	mem_bank_slots[mem_bank_count] = bank;
+	return mem_bank_count++;
+}
+#elif defined(SAVE_MEMORY_BANKS)
 // 256KB pointer array - dynamically allocated in PSRAM on ESP32
 addrbank **mem_banks = NULL;
 #else
@@ -84,6 +112,9 @@ void byteput (uaecptr addr, uae_u32 b)
 
 /* A dummy bank that only contains zeros */
 
+// Accesses that fell through to dummy_bank (unmapped space, VIA, SCC...)
+static perf_counter *const perf_dummy = PerfCounter("mem.dummy", PERF_COUNT, PERF_CORE_CPU);
+
 static uae_u32 REGPARAM2 dummy_lget (uaecptr) REGPARAM;
 static uae_u32 REGPARAM2 dummy_wget (uaecptr) REGPARAM;
 static uae_u32 REGPARAM2 dummy_bget (uaecptr) REGPARAM;
@@ -93,6 +124,7 @@ static void REGPARAM2 dummy_bput (uaecptr, uae_u32) REGPARAM;
 
 uae_u32 REGPARAM2 dummy_lget (uaecptr addr)
 {
+    perf_inc(perf_dummy);
     if (illegal_mem)
 	write_log ("Illegal lget at %08x\n", addr);
 
@@ -101,6 +133,7 @@ uae_u32 REGPARAM2 dummy_lget (uaecptr addr)
 
 uae_u32 REGPARAM2 dummy_wget (uaecptr addr)
 {
+    perf_inc(perf_dummy);
     if (illegal_mem)
 	write_log ("Illegal wget at %08x\n", addr);
 
@@ -109,6 +142,7 @@ uae_u32 REGPARAM2 dummy_wget (uaecptr addr)
 
 uae_u32 REGPARAM2 dummy_bget (uaecptr addr)
 {
+    perf_inc(perf_dummy);
     if (illegal_mem)
 	write_log ("Illegal bget at %08x\n", addr);
 
@@ -117,16 +151,19 @@ uae_u32 REGPARAM2 dummy_bget (uaecptr addr)
 
 void REGPARAM2 dummy_lput (uaecptr addr, uae_u32 l)
 {
+    perf_inc(perf_dummy);
     if (illegal_mem)
 	write_log ("Illegal lput at %08x\n", addr);
 }
 void REGPARAM2 dummy_wput (uaecptr addr, uae_u32 w)
 {
+    perf_inc(perf_dummy);
     if (illegal_mem)
 	write_log ("Illegal wput at %08x\n", addr);
 }
 void REGPARAM2 dummy_bput (uaecptr addr, uae_u32 b)
 {
+    perf_inc(perf_dummy);
     if (illegal_mem)
 	write_log ("Illegal bput at %08x\n", addr);
 }
@@ -167,6 +204,7 @@ void REGPARAM2 ram_lput(uaecptr addr, uae_u32 l)
     uae_u32 *m;
     m = (uae_u32 *)(RAMBaseDiff + addr);
     do_put_mem_long(m, l);
+    dcache_note_write(addr, 4);
 }
 
 void REGPARAM2 ram_wput(uaecptr addr, uae_u32 w)
@@ -174,11 +212,13 @@ void REGPARAM2 ram_wput(uaecptr addr, uae_u32 w)
     uae_u16 *m;
     m = (uae_u16 *)(RAMBaseDiff + addr);
     do_put_mem_word(m, w);
+    dcache_note_write(addr, 2);
 }
 
 void REGPARAM2 ram_bput(uaecptr addr, uae_u32 b)
 {
 	*(uae_u8 *)(RAMBaseDiff + addr) = b;
+	dcache_note_write(addr, 1);
 }
 
 uae_u8 *REGPARAM2 ram_xlate(uaecptr addr)
@@ -220,6 +260,7 @@ void REGPARAM2 ram24_lput(uaecptr addr, uae_u32 l)
     uae_u32 *m;
     m = (uae_u32 *)(RAMBaseDiff + (addr & 0xffffff));
     do_put_mem_long(m, l);
+    dcache_note_write(addr & 0xffffff, 4);
 }
 
 void REGPARAM2 ram24_wput(uaecptr addr, uae_u32 w)
@@ -227,11 +268,13 @@ void REGPARAM2 ram24_wput(uaecptr addr, uae_u32 w)
     uae_u16 *m;
     m = (uae_u16 *)(RAMBaseDiff + (addr & 0xffffff));
     do_put_mem_word(m, w);
+    dcache_note_write(addr & 0xffffff, 2);
 }
 
 void REGPARAM2 ram24_bput(uaecptr addr, uae_u32 b)
 {
 	*(uae_u8 *)(RAMBaseDiff + (addr & 0xffffff)) = b;
+	dcache_note_write(addr & 0xffffff, 1);
 }
 
 uae_u8 *REGPARAM2 ram24_xlate(uaecptr addr)
@@ -340,8 +383,10 @@ static void REGPARAM2 frame_host_555_wput(uaecptr, uae_u32) REGPARAM;
 
 static uae_u32 REGPARAM2 frame_host_565_lget(uaecptr) REGPARAM;
 static uae_u32 REGPARAM2 frame_host_565_wget(uaecptr) REGPARAM;
+static uae_u32 REGPARAM2 frame_host_565_bget(uaecptr) REGPARAM;
 static void REGPARAM2 frame_host_565_lput(uaecptr, uae_u32) REGPARAM;
 static void REGPARAM2 frame_host_565_wput(uaecptr, uae_u32) REGPARAM;
+static void REGPARAM2 frame_host_565_bput(uaecptr, uae_u32) REGPARAM;
 
 static uae_u32 REGPARAM2 frame_host_888_lget(uaecptr) REGPARAM;
 static void REGPARAM2 frame_host_888_lput(uaecptr, uae_u32) REGPARAM;
@@ -423,36 +468,56 @@ void REGPARAM2 frame_host_555_wput(uaecptr addr, uae_u32 w)
     *m = w;
 }
 
+/*
+ *  The 16 bit frame buffer is kept as big-endian RGB 565, the byte order the
+ *  display takes, so the video task pushes it without a conversion. Mac
+ *  pixels are xRRRRRGGGGGBBBBB; the top bit of green is repeated in the new
+ *  low bit. Reads give back the Mac pixel, with x clear.
+ */
 uae_u32 REGPARAM2 frame_host_565_lget(uaecptr addr)
 {
     uae_u32 *m, l;
     m = (uae_u32 *)(FrameBaseDiff + addr);
-    l = *m;
-    l = (l & 0x001f001f) | ((l >> 1) & 0x7fe07fe0);
-    return swap_words(l);
+    l = do_get_mem_long(m);
+    return ((l >> 1) & 0x7fe07fe0) | (l & 0x001f001f);
 }
 
 uae_u32 REGPARAM2 frame_host_565_wget(uaecptr addr)
 {
     uae_u16 *m, w;
     m = (uae_u16 *)(FrameBaseDiff + addr);
-    w = *m;
-    return (w & 0x1f) | ((w >> 1) & 0x7fe0);
+    w = do_get_mem_word(m);
+    return ((w >> 1) & 0x7fe0) | (w & 0x001f);
+}
+
+uae_u32 REGPARAM2 frame_host_565_bget(uaecptr addr)
+{
+    uae_u32 w = frame_host_565_wget(addr & ~1);
+    return (addr & 1) ? (w & 0xff) : (w >> 8);
 }
 
 void REGPARAM2 frame_host_565_lput(uaecptr addr, uae_u32 l)
 {
     uae_u32 *m;
     m = (uae_u32 *)(FrameBaseDiff + addr);
-    l = (l & 0x001f001f) | ((l << 1) & 0xffc0ffc0);
-    *m = swap_words(l);
+    do_put_mem_long(m, ((l << 1) & 0xffc0ffc0) | ((l >> 4) & 0x00200020) | (l & 0x001f001f));
+    VideoMarkDirtyRange(addr - MacFrameBaseMac, 4);
 }
 
 void REGPARAM2 frame_host_565_wput(uaecptr addr, uae_u32 w)
 {
     uae_u16 *m;
     m = (uae_u16 *)(FrameBaseDiff + addr);
-    *m = (w & 0x1f) | ((w << 1) & 0xffc0);
+    do_put_mem_word(m, ((w << 1) & 0xffc0) | ((w >> 4) & 0x0020) | (w & 0x001f));
+    VideoMarkDirtyRange(addr - MacFrameBaseMac, 2);
+}
+
+void REGPARAM2 frame_host_565_bput(uaecptr addr, uae_u32 b)
+{
+    // Half a pixel: merge it into the other half
+    uae_u32 w = frame_host_565_wget(addr & ~1);
+    w = (addr & 1) ? ((w & 0xff00) | (b & 0xff)) : ((w & 0x00ff) | ((b & 0xff) << 8));
+    frame_host_565_wput(addr & ~1, w);
 }
 
 uae_u32 REGPARAM2 frame_host_888_lget(uaecptr addr)
@@ -498,6 +563,7 @@ void REGPARAM2 fram24_lput(uaecptr addr, uae_u32 l)
     uae_u32 *m;
     m = (uae_u32 *)(RAMBaseDiff + (addr & 0xffffff));
     do_put_mem_long(m, l);
+    dcache_note_write(addr & 0xffffff, 4);
 }
 
 void REGPARAM2 fram24_wput(uaecptr addr, uae_u32 w)
@@ -514,6 +580,7 @@ void REGPARAM2 fram24_wput(uaecptr addr, uae_u32 w)
     uae_u16 *m;
     m = (uae_u16 *)(RAMBaseDiff + (addr & 0xffffff));
     do_put_mem_word(m, w);
+    dcache_note_write(addr & 0xffffff, 2);
 }
 
 void REGPARAM2 fram24_bput(uaecptr addr, uae_u32 b)
@@ -526,6 +593,7 @@ void REGPARAM2 fram24_bput(uaecptr addr, uae_u32 b)
     }
 
     *(uae_u8 *)(RAMBaseDiff + (addr & 0xffffff)) = b;
+    dcache_note_write(addr & 0xffffff, 1);
 }
 
 /* Default memory access functions */
@@ -581,8 +649,8 @@ addrbank frame_host_555_bank = {
 };
 
 addrbank frame_host_565_bank = {
-    frame_host_565_lget, frame_host_565_wget, frame_direct_bget,
-    frame_host_565_lput, frame_host_565_wput, frame_direct_bput,
+    frame_host_565_lget, frame_host_565_wget, frame_host_565_bget,
+    frame_host_565_lput, frame_host_565_wput, frame_host_565_bput,
     frame_xlate
 };
 
@@ -598,33 +666,133 @@ addrbank fram24_bank = {
     ram24_xlate
 };
 
+#if USE_FRAME_FASTPATH && !defined(NO_INLINE_MEMORY_ACCESS)
+/*
+ *  Slow paths of the inline accessors in memory.h. The FLAYOUT_DIRECT frame
+ *  buffer is the main target outside RAM and ROM (every QuickDraw blit to
+ *  the screen), so it is read and written here in place, marking dirty
+ *  tiles like frame_direct_bank, without the bank table lookup and the
+ *  function pointer call.
+ */
+
+#ifdef ARDUINO
+#define SLOWPATH_ATTR IRAM_ATTR
+#else
+#define SLOWPATH_ATTR
+#endif
+
+static uae_u32 frame_fast_base = 0;		// MacFrameBaseMac
+static uae_u32 frame_fast_size = 0;		// MacFrameSize, 0 unless FLAYOUT_DIRECT
+static uae_u8 *frame_fast_host = NULL;	// MacFrameBaseHost
+
+// Is [off, off + n) inside the frame buffer?
+#define frame_fast_hit(off, n) ((off) < frame_fast_size && (off) + ((n) - 1) < frame_fast_size)
+
+// Is addr in a page of dummy_bank (slot 0)? That includes the VIA, SCC and
+// IWM registers, whose drivers the ROM patches replace: reads are 0 and
+// writes are dropped without calling the bank handler.
+#if USE_COMPACT_BANKS
+#define unmapped_page(addr) (mem_bank_index[bankindex(addr)] == 0)
+#else
+#define unmapped_page(addr) false
+#endif
+
+SLOWPATH_ATTR uae_u32 longget_slowpath(uaecptr addr)
+{
+	uae_u32 off = addr - frame_fast_base;
+	if (frame_fast_hit(off, 4))
+		return do_get_mem_long((uae_u32 *)(frame_fast_host + off));
+	if (unmapped_page(addr))
+		return 0;
+	return call_mem_get_func(get_mem_bank(addr).lget, addr);
+}
+
+SLOWPATH_ATTR uae_u32 wordget_slowpath(uaecptr addr)
+{
+	uae_u32 off = addr - frame_fast_base;
+	if (frame_fast_hit(off, 2))
+		return do_get_mem_word((uae_u16 *)(frame_fast_host + off));
+	if (unmapped_page(addr))
+		return 0;
+	return call_mem_get_func(get_mem_bank(addr).wget, addr);
+}
+
+SLOWPATH_ATTR uae_u32 byteget_slowpath(uaecptr addr)
+{
+	uae_u32 off = addr - frame_fast_base;
+	if (off < frame_fast_size)
+		return frame_fast_host[off];
+	if (unmapped_page(addr))
+		return 0;
+	return call_mem_get_func(get_mem_bank(addr).bget, addr);
+}
+
+SLOWPATH_ATTR void longput_slowpath(uaecptr addr, uae_u32 l)
+{
+	uae_u32 off = addr - frame_fast_base;
+	if (frame_fast_hit(off, 4)) {
+		do_put_mem_long((uae_u32 *)(frame_fast_host + off), l);
+		VideoMarkDirtyRange(off, 4);
+		return;
+	}
+	if (unmapped_page(addr))
+		return;
+	call_mem_put_func(get_mem_bank(addr).lput, addr, l);
+}
+
+SLOWPATH_ATTR void wordput_slowpath(uaecptr addr, uae_u32 w)
+{
+	uae_u32 off = addr - frame_fast_base;
+	if (frame_fast_hit(off, 2)) {
+		do_put_mem_word((uae_u16 *)(frame_fast_host + off), w);
+		VideoMarkDirtyRange(off, 2);
+		return;
+	}
+	if (unmapped_page(addr))
+		return;
+	call_mem_put_func(get_mem_bank(addr).wput, addr, w);
+}
+
+SLOWPATH_ATTR void byteput_slowpath(uaecptr addr, uae_u32 b)
+{
+	uae_u32 off = addr - frame_fast_base;
+	if (off < frame_fast_size) {
+		frame_fast_host[off] = b;
+		VideoMarkDirtyOffset(off);
+		return;
+	}
+	if (unmapped_page(addr))
+		return;
+	call_mem_put_func(get_mem_bank(addr).bput, addr, b);
+}
+#endif
+
+// Page to bank lookup, on every memory access that misses the fast paths
+#if USE_COMPACT_BANKS
+static sram_slot *const mem_bank_index_sram = SramSlot("mem_bank_index", 65536, 20, 0);
+#elif defined(SAVE_MEMORY_BANKS)
+static sram_slot *const mem_banks_sram = SramSlot("mem_banks", 65536 * sizeof(addrbank *), 20, 0);
+#endif
+
 void memory_init(void)
 {
-#if defined(ARDUINO) && defined(SAVE_MEMORY_BANKS)
-	// Allocate 256KB memory bank pointer array
-	// This is accessed on EVERY memory operation (multiple times per instruction)
-	// Gets PRIORITY for internal SRAM since it's the hottest path
+#if USE_COMPACT_BANKS
+	// Allocate the 64KB page index where the SRAM plan put it
+	if (mem_bank_index == NULL) {
+		mem_bank_index = (uae_u8 *)SramAlloc(mem_bank_index_sram, 65536);
+		if (mem_bank_index == NULL) {
+			write_log("ERROR: Failed to allocate mem_bank_index!\n");
+			return;
+		}
+	}
+	mem_bank_count = 0;
+#elif defined(SAVE_MEMORY_BANKS)
+	// Allocate the 256KB bank pointer table where the SRAM plan put it
 	if (mem_banks == NULL) {
-		// Report available internal SRAM before allocation
-		size_t free_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
-		size_t largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
-		write_log("mem_banks allocation: need 256KB, internal SRAM has %d bytes free (largest: %d)\n",
-		          free_before, largest_block);
-		
-		// Try PSRAM first - cpufunctbl gets priority for internal SRAM
-		// (cpufunctbl dispatch is per-instruction, mem_banks is per-memory-access but
-		// memory functions themselves do the heavy lifting)
-		mem_banks = (addrbank **)heap_caps_malloc(65536 * sizeof(addrbank *), MALLOC_CAP_SPIRAM);
-		if (mem_banks != NULL) {
-			write_log("Allocated mem_banks (256KB) in PSRAM (cpufunctbl has SRAM priority)\n");
-		} else {
-			// Fall back to internal SRAM if PSRAM fails
-			mem_banks = (addrbank **)heap_caps_malloc(65536 * sizeof(addrbank *), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-			if (mem_banks == NULL) {
-				write_log("ERROR: Failed to allocate mem_banks!\n");
-				return;
-			}
-			write_log("Allocated mem_banks (256KB) in internal SRAM (fallback)\n");
+		mem_banks = (addrbank **)SramAlloc(mem_banks_sram, 65536 * sizeof(addrbank *));
+		if (mem_banks == NULL) {
+			write_log("ERROR: Failed to allocate mem_banks!\n");
+			return;
 		}
 	}
 #endif
@@ -632,9 +800,19 @@ void memory_init(void)
 	for(long i=0; i<65536; i++)
 		put_mem_bank(i<<16, &dummy_bank);
 
+#if USE_FRAME_FASTPATH && !defined(NO_INLINE_MEMORY_ACCESS)
+	frame_fast_size = 0;
+#endif
+
 	// Limit RAM size to not overlap ROM
 	uint32 ram_size = RAMSize > ROMBaseMac ? ROMBaseMac : RAMSize;
 
+	// Inline paths of memory.h: all of RAM, but the screen page of 24-bit
+	// mode is written through fram24_bank
+	mem_ram_end = RAMBaseMac + ram_size;
+	mem_ram_write_end = TwentyFourBitAddressing ? mem_ram_end - 0x10000 : mem_ram_end;
+	mem_addr_mask = TwentyFourBitAddressing ? 0x00ffffff : 0xffffffff;
+
 	RAMBaseDiff = (uintptr)RAMBaseHost - (uintptr)RAMBaseMac;
 	ROMBaseDiff = (uintptr)ROMBaseHost - (uintptr)ROMBaseMac;
 	FrameBaseDiff = (uintptr)MacFrameBaseHost - (uintptr)MacFrameBaseMac;
@@ -653,16 +831,21 @@ void memory_init(void)
                 // Map frame buffer
 		switch (MacFrameLayout) {
 			case FLAYOUT_DIRECT:
-				map_banks(&frame_direct_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+				map_banks(&frame_direct_bank, MacFrameBaseMac >> 16, (MacFrameSize + 0xffff) >> 16);
+#if USE_FRAME_FASTPATH && !defined(NO_INLINE_MEMORY_ACCESS)
+				frame_fast_base = MacFrameBaseMac;
+				frame_fast_host = MacFrameBaseHost;
+				frame_fast_size = MacFrameSize;
+#endif
 				break;
 			case FLAYOUT_HOST_555:
-				map_banks(&frame_host_555_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+				map_banks(&frame_host_555_bank, MacFrameBaseMac >> 16, (MacFrameSize + 0xffff) >> 16);
 				break;
 			case FLAYOUT_HOST_565:
-				map_banks(&frame_host_565_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+				map_banks(&frame_host_565_bank, MacFrameBaseMac >> 16, (MacFrameSize + 0xffff) >> 16);
 				break;
 			case FLAYOUT_HOST_888:
-				map_banks(&frame_host_888_bank, MacFrameBaseMac >> 16, (MacFrameSize >> 16) + 1);
+				map_banks(&frame_host_888_bank, MacFrameBaseMac >> 16, (MacFrameSize + 0xffff) >> 16);
 				break;
 		}
 	}
@@ -684,6 +867,19 @@ void map_banks(addrbank *bank, int start, int size)
 	    put_mem_bank((bnr + hioffs) << 16, bank);
 }
 
+/*
+ *  Move the ROM to another host copy with the same contents (the flash
+ *  mapping of rom_flash_esp32.cpp, or back to PSRAM). The PC is translated
+ *  again so the CPU does not go on fetching from the old copy.
+ */
+void memory_set_rom_host(uae_u8 *host)
+{
+	uaecptr pc = m68k_getpc();
+	ROMBaseHost = host;
+	ROMBaseDiff = (uintptr)ROMBaseHost - (uintptr)ROMBaseMac;
+	m68k_setpc(pc);
+}
+
 /*
  *  get_virtual_address - Convert host address to Mac address
  *  This is only called in virtual addressing mode
@@ -720,5 +916,112 @@ uae_u32 get_virtual_address(uae_u8 *addr)
     return 0;
 }
 
+#if MEM_PROFILE
+/*
+ *  Memory access profile (instrumentation build, see memory.h)
+ *
+ *  The inline accessors count each access by the kind of memory it hits,
+ *  its size and its direction. Instruction fetches read through regs.pc_p
+ *  and never get here, so m68k_setpc() counts the jumps instead: the kind
+ *  of their target, the ones that leave the 64KB bank of the old PC and
+ *  the ones to an odd address. All counters belong to the CPU task.
+ */
+
+uae_u32 mem_profile_count[MEMP_KINDS][3][2];
+uae_u32 mem_profile_unaligned;
+uae_u32 mem_profile_split;
+static uae_u32 mem_profile_jumps[MEMP_KINDS];
+static uae_u32 mem_profile_jumps_cross;
+static uae_u32 mem_profile_jumps_odd;
+
+static const char *const mem_profile_names[MEMP_KINDS] = {"RAM", "ROM", "frame", "hw", "dummy"};
+
+// Kind of memory at addr, from its bank handlers
+int mem_profile_kind(uaecptr addr)
+{
+    if (addr < RAMSize)
+        return MEMP_RAM;
+    if (addr >= ROMBaseMac && addr < ROMBaseMac + ROMSize)
+        return MEMP_ROM;
+    if (addr >= MacFrameBaseMac && addr < MacFrameBaseMac + MacFrameSize)
+        return MEMP_FRAME;
+    mem_get_func lget = get_mem_bank(addr).lget;
+    if (lget == dummy_bank.lget)
+        return MEMP_DUMMY;
+    if (lget == ram_bank.lget || lget == ram24_bank.lget)
+        return MEMP_RAM;
+    if (lget == rom_bank.lget || lget == rom24_bank.lget)
+        return MEMP_ROM;
+    if (lget == frame_direct_bank.lget || lget == frame_host_555_bank.lget ||
+        lget == frame_host_565_bank.lget || lget == frame_host_888_bank.lget ||
+        lget == fram24_bank.lget)
+        return MEMP_FRAME;
+    return MEMP_HW;
+}
+
+void mem_profile_jump(uaecptr from, uaecptr to)
+{
+    mem_profile_jumps[mem_profile_kind(to)]++;
+    if (bankindex(from) != bankindex(to))
+        mem_profile_jumps_cross++;
+    if (to & 1)
+        mem_profile_jumps_odd++;
+}
+
+static float mem_profile_share(uae_u32 n, uae_u32 total)
+{
+    return total ? n * 100.0f / total : 0.0f;
+}
+
+void MemProfileDump(void)
+{
+    static const char *const sizes = "bwl";
+    uae_u32 total = 0, jumps = 0;
+    for (int k = 0; k < MEMP_KINDS; k++) {
+        for (int s = 0; s < 3; s++)
+            total += mem_profile_count[k][s][0] + mem_profile_count[k][s][1];
+        jumps += mem_profile_jumps[k];
+    }
+
+    write_log("[MEM PROFILE] %u accesses\n", total);
+    for (int k = 0; k < MEMP_KINDS; k++) {
+        write_log("[MEM PROFILE] %-5s", mem_profile_names[k]);
+        for (int s = 0; s < 3; s++)
+            write_log("  %c r=%-10u w=%-10u", sizes[s], mem_profile_count[k][s][0], mem_profile_count[k][s][1]);
+        uae_u32 n = 0;
+        for (int s = 0; s < 3; s++)
+            n += mem_profile_count[k][s][0] + mem_profile_count[k][s][1];
+        write_log("  %5.1f%%\n", mem_profile_share(n, total));
+    }
+    write_log("[MEM PROFILE] unaligned=%u split=%u\n", mem_profile_unaligned, mem_profile_split);
+    write_log("[MEM PROFILE] jumps=%u", jumps);
+    for (int k = 0; k < MEMP_KINDS; k++)
+        write_log(" %s=%u", mem_profile_names[k], mem_profile_jumps[k]);
+    write_log(" cross_bank=%u (%.1f%%) odd=%u\n", mem_profile_jumps_cross,
+              mem_profile_share(mem_profile_jumps_cross, jumps), mem_profile_jumps_odd);
+}
+
+void MemProfileReset(void)
+{
+    memset(mem_profile_count, 0, sizeof(mem_profile_count));
+    memset(mem_profile_jumps, 0, sizeof(mem_profile_jumps));
+    mem_profile_unaligned = mem_profile_split = 0;
+    mem_profile_jumps_cross = mem_profile_jumps_odd = 0;
+}
+#endif
+
 #endif /* !REAL_ADDRESSING && !DIRECT_ADDRESSING */
 
+#if COMPACT_COLD_HANDLERS
+/*
+ *  Out of line accessors for the cold handlers (see cpuop_cold.h)
+ */
+
+uae_u32 cold_get_byte(uaecptr addr) { return get_byte(addr); }
+uae_u32 cold_get_word(uaecptr addr) { return get_word(addr); }
+uae_u32 cold_get_long(uaecptr addr) { return get_long(addr); }
+void cold_put_byte(uaecptr addr, uae_u32 b) { put_byte(addr, b); }
+void cold_put_word(uaecptr addr, uae_u32 w) { put_word(addr, w); }
+void cold_put_long(uaecptr addr, uae_u32 l) { put_long(addr, l); }
+#endif
+
@@ -71,7 +71,16 @@ extern uae_u8 *REGPARAM2 default_xlate(uaecptr addr) REGPARAM;
 
 #define bankindex(addr) (((uaecptr)(addr)) >> 16)
 
-#ifdef SAVE_MEMORY_BANKS
+#if USE_COMPACT_BANKS
+// Bank number per 64KB page (64KB, internal SRAM on ESP32) into a table of
+// the few distinct banks
+#define MEM_BANK_SLOTS 16
+extern uae_u8 *mem_bank_index;
+extern addrbank *mem_bank_slots[MEM_BANK_SLOTS];
+extern uae_u8 mem_bank_slot(addrbank *bank);
+#define get_mem_bank(addr) (*mem_bank_slots[mem_bank_index[bankindex(addr)]])
+#define put_mem_bank(addr, b) (mem_bank_index[bankindex(addr)] = mem_bank_slot(b))
+#elif defined(SAVE_MEMORY_BANKS)
 // Note: mem_banks is dynamically allocated in PSRAM on ESP32
 extern addrbank **mem_banks;
 #define get_mem_bank(addr) (*mem_banks[bankindex(addr)])
@@ -84,6 +93,7 @@ extern addrbank mem_banks[65536];
 
 extern void memory_init(void);
 extern void map_banks(addrbank *bank, int first, int count);
+extern void memory_set_rom_host(uae_u8 *host);
 
 #ifndef NO_INLINE_MEMORY_ACCESS
 
@@ -101,6 +111,13 @@ extern void map_banks(addrbank *bank, int first, int count);
  * - RAM: 0x00000000 to RAMSize (typically 8MB)
  * - ROM: ROMBaseMac to ROMBaseMac + ROMSize (varies by ROM type)
  * - Frame buffer: MacFrameBaseMac (0xa0000000)
+ *
+ * With 24-bit addressing the CPU ignores the high byte, and the Memory
+ * Manager keeps flags there in master pointers: an address that misses RAM
+ * is tried again without it (mem_fast_addr()), so tagged RAM and ROM
+ * addresses stay inline as well. The last 64KB page of RAM then mirrors
+ * the classic screen (fram24_bank): it is read inline but written through
+ * the bank, which copies to the frame buffer and marks the dirty tiles.
  */
 
 // Branch prediction hints (may already be defined in sysdeps.h)
@@ -119,77 +136,177 @@ extern uint32 ROMBaseMac;
 extern uint8 *ROMBaseHost;
 extern uint32 ROMSize;
 
+// Limits of the inline paths, set by memory_init(): RAM below mem_ram_end
+// is read inline and RAM below mem_ram_write_end is written inline;
+// mem_addr_mask is 0x00ffffff with 24-bit addressing, 0xffffffff without
+extern uae_u32 mem_ram_end;
+extern uae_u32 mem_ram_write_end;
+extern uae_u32 mem_addr_mask;
+
+// Address to test against RAM and ROM: only one that misses RAM pays for
+// the mask, so 32-bit RAM accesses cost what they did
+static inline uaecptr mem_fast_addr(uaecptr addr) {
+    return likely(addr < mem_ram_end) ? addr : addr & mem_addr_mask;
+}
+
+#if USE_DECODE_CACHE
+// RAM pages holding decode cache traces (see newcpu.cpp). A write that
+// touches a flagged page retires the traces recorded from it. The page
+// number is masked: with more RAM than the tables cover the cache is off,
+// and a store above them must still read inside them.
+#define DCACHE_PAGE_SHIFT 12
+#define DCACHE_RAM_PAGES ((32 * 1024 * 1024) >> DCACHE_PAGE_SHIFT)   // Largest RAM size offered by the boot GUI (RAM_MAX_SIZE)
+extern uae_u8 dcache_code_pages[];
+extern void m68k_dcache_invalidate(uaecptr start, uae_u32 size);
+extern void m68k_dcache_flush(void);
+
+#define dcache_note_write(addr, size) \
+    do { \
+        if (unlikely(dcache_code_pages[((addr) >> DCACHE_PAGE_SHIFT) & (DCACHE_RAM_PAGES - 1)] | \
+                     dcache_code_pages[(((addr) + (size) - 1) >> DCACHE_PAGE_SHIFT) & (DCACHE_RAM_PAGES - 1)])) \
+            m68k_dcache_invalidate((addr), (size)); \
+    } while (0)
+#else
+#define dcache_note_write(addr, size) do { } while (0)
+#endif
+
+#if MEM_PROFILE
+// Access counts for the 'm' debug command (see memory.cpp), CPU task only
+enum { MEMP_RAM, MEMP_ROM, MEMP_FRAME, MEMP_HW, MEMP_DUMMY, MEMP_KINDS };
+extern uae_u32 mem_profile_count[MEMP_KINDS][3][2];    // [kind][byte, word, long][read, write]
+extern uae_u32 mem_profile_unaligned;                   // Word and long accesses at odd addresses
+extern uae_u32 mem_profile_split;                       // Accesses spanning two 64KB banks
+extern int mem_profile_kind(uaecptr addr);
+extern void mem_profile_jump(uaecptr from, uaecptr to);
+extern void MemProfileDump(void);
+extern void MemProfileReset(void);
+
+#define mem_profile(kind, size, write, addr) \
+    do { \
+        mem_profile_count[kind][(size) >> 1][write]++; \
+        if ((size) > 1) { \
+            if ((addr) & 1) mem_profile_unaligned++; \
+            if (((addr) & 0xffff) > 0x10000 - (size)) mem_profile_split++; \
+        } \
+    } while (0)
+#else
+#define mem_profile(kind, size, write, addr) do { } while (0)
+#endif
+
+#if USE_FRAME_FASTPATH
+// Out-of-line paths for addresses the inline checks below don't cover:
+// the FLAYOUT_DIRECT frame buffer is accessed in place, everything else
+// (the other layouts, hardware, unmapped) goes through the bank table
+extern uae_u32 longget_slowpath(uaecptr addr);
+extern uae_u32 wordget_slowpath(uaecptr addr);
+extern uae_u32 byteget_slowpath(uaecptr addr);
+extern void longput_slowpath(uaecptr addr, uae_u32 l);
+extern void wordput_slowpath(uaecptr addr, uae_u32 w);
+extern void byteput_slowpath(uaecptr addr, uae_u32 b);
+#else
+#define longget_slowpath(addr) call_mem_get_func(get_mem_bank(addr).lget, addr)
+#define wordget_slowpath(addr) call_mem_get_func(get_mem_bank(addr).wget, addr)
+#define byteget_slowpath(addr) call_mem_get_func(get_mem_bank(addr).bget, addr)
+#define longput_slowpath(addr, l) call_mem_put_func(get_mem_bank(addr).lput, addr, l)
+#define wordput_slowpath(addr, w) call_mem_put_func(get_mem_bank(addr).wput, addr, w)
+#define byteput_slowpath(addr, b) call_mem_put_func(get_mem_bank(addr).bput, addr, b)
+#endif
+
 // Fast-path long (32-bit) read
 static inline uae_u32 longget_fastpath(uaecptr addr) {
     // Fast path for RAM (most common case)
-    // RAM is at address 0, so just check if addr < RAMSize
-    if (likely(addr < RAMSize)) {
-        uae_u32 *m = (uae_u32 *)(RAMBaseHost + addr);
+    // RAM is at address 0, so just check if a < mem_ram_end
+    uaecptr a = mem_fast_addr(addr);
+    if (likely(a < mem_ram_end)) {
+        mem_profile(MEMP_RAM, 4, 0, a);
+        uae_u32 *m = (uae_u32 *)(RAMBaseHost + a);
         return do_get_mem_long(m);
     }
     // Fast path for ROM
-    if (addr >= ROMBaseMac && addr < ROMBaseMac + ROMSize) {
-        uae_u32 *m = (uae_u32 *)(ROMBaseHost + (addr - ROMBaseMac));
+    if (a - ROMBaseMac < ROMSize) {
+        mem_profile(MEMP_ROM, 4, 0, a);
+        uae_u32 *m = (uae_u32 *)(ROMBaseHost + (a - ROMBaseMac));
         return do_get_mem_long(m);
     }
-    // Fall back to bank lookup for other addresses (frame buffer, hardware, etc.)
-    return call_mem_get_func(get_mem_bank(addr).lget, addr);
+    // Frame buffer, hardware, etc.
+    mem_profile(mem_profile_kind(addr), 4, 0, addr);
+    return longget_slowpath(addr);
 }
 
 // Fast-path word (16-bit) read
 static inline uae_u32 wordget_fastpath(uaecptr addr) {
-    if (likely(addr < RAMSize)) {
-        uae_u16 *m = (uae_u16 *)(RAMBaseHost + addr);
+    uaecptr a = mem_fast_addr(addr);
+    if (likely(a < mem_ram_end)) {
+        mem_profile(MEMP_RAM, 2, 0, a);
+        uae_u16 *m = (uae_u16 *)(RAMBaseHost + a);
         return do_get_mem_word(m);
     }
-    if (addr >= ROMBaseMac && addr < ROMBaseMac + ROMSize) {
-        uae_u16 *m = (uae_u16 *)(ROMBaseHost + (addr - ROMBaseMac));
+    if (a - ROMBaseMac < ROMSize) {
+        mem_profile(MEMP_ROM, 2, 0, a);
+        uae_u16 *m = (uae_u16 *)(ROMBaseHost + (a - ROMBaseMac));
         return do_get_mem_word(m);
     }
-    return call_mem_get_func(get_mem_bank(addr).wget, addr);
+    mem_profile(mem_profile_kind(addr), 2, 0, addr);
+    return wordget_slowpath(addr);
 }
 
 // Fast-path byte (8-bit) read
 static inline uae_u32 byteget_fastpath(uaecptr addr) {
-    if (likely(addr < RAMSize)) {
-        return *(uae_u8 *)(RAMBaseHost + addr);
+    uaecptr a = mem_fast_addr(addr);
+    if (likely(a < mem_ram_end)) {
+        mem_profile(MEMP_RAM, 1, 0, a);
+        return *(uae_u8 *)(RAMBaseHost + a);
     }
-    if (addr >= ROMBaseMac && addr < ROMBaseMac + ROMSize) {
-        return *(uae_u8 *)(ROMBaseHost + (addr - ROMBaseMac));
+    if (a - ROMBaseMac < ROMSize) {
+        mem_profile(MEMP_ROM, 1, 0, a);
+        return *(uae_u8 *)(ROMBaseHost + (a - ROMBaseMac));
     }
-    return call_mem_get_func(get_mem_bank(addr).bget, addr);
+    mem_profile(mem_profile_kind(addr), 1, 0, addr);
+    return byteget_slowpath(addr);
 }
 
 // Fast-path long (32-bit) write
 static inline void longput_fastpath(uaecptr addr, uae_u32 l) {
     // Fast path for RAM writes (most common case)
-    if (likely(addr < RAMSize)) {
-        uae_u32 *m = (uae_u32 *)(RAMBaseHost + addr);
+    uaecptr a = mem_fast_addr(addr);
+    if (likely(a < mem_ram_write_end)) {
+        mem_profile(MEMP_RAM, 4, 1, a);
+        uae_u32 *m = (uae_u32 *)(RAMBaseHost + a);
         do_put_mem_long(m, l);
+        dcache_note_write(a, 4);
         return;
     }
     // ROM writes go to bank handler (which will log/ignore them)
-    // Frame buffer and hardware writes also go through bank handler
-    call_mem_put_func(get_mem_bank(addr).lput, addr, l);
+    // Frame buffer and hardware writes also leave the inline path
+    mem_profile(mem_profile_kind(addr), 4, 1, addr);
+    longput_slowpath(addr, l);
 }
 
 // Fast-path word (16-bit) write
 static inline void wordput_fastpath(uaecptr addr, uae_u32 w) {
-    if (likely(addr < RAMSize)) {
-        uae_u16 *m = (uae_u16 *)(RAMBaseHost + addr);
+    uaecptr a = mem_fast_addr(addr);
+    if (likely(a < mem_ram_write_end)) {
+        mem_profile(MEMP_RAM, 2, 1, a);
+        uae_u16 *m = (uae_u16 *)(RAMBaseHost + a);
         do_put_mem_word(m, w);
+        dcache_note_write(a, 2);
         return;
     }
-    call_mem_put_func(get_mem_bank(addr).wput, addr, w);
+    mem_profile(mem_profile_kind(addr), 2, 1, addr);
+    wordput_slowpath(addr, w);
 }
 
 // Fast-path byte (8-bit) write
 static inline void byteput_fastpath(uaecptr addr, uae_u32 b) {
-    if (likely(addr < RAMSize)) {
-        *(uae_u8 *)(RAMBaseHost + addr) = b;
+    uaecptr a = mem_fast_addr(addr);
+    if (likely(a < mem_ram_write_end)) {
+        mem_profile(MEMP_RAM, 1, 1, a);
+        *(uae_u8 *)(RAMBaseHost + a) = b;
+        dcache_note_write(a, 1);
         return;
     }
-    call_mem_put_func(get_mem_bank(addr).bput, addr, b);
+    mem_profile(mem_profile_kind(addr), 1, 1, addr);
+    byteput_slowpath(addr, b);
 }
 
 // Use fast-path functions for all memory access
@@ -306,9 +423,60 @@ static __inline__ uae_u8 *get_real_address(uaecptr addr)
 {
     return get_mem_bank(addr).xlateaddr(addr);
 }
+// Translation for new PC values (m68k_setpc). Nearly every control transfer
+// lands in RAM or ROM, so test those ranges inline like the data fast paths
+// above and only go through the PSRAM bank table and xlateaddr otherwise.
+static __inline__ uae_u8 *get_pc_real_address(uaecptr addr)
+{
+    uaecptr a = mem_fast_addr(addr);
+    if (likely(a < mem_ram_end))
+        return RAMBaseHost + a;
+    if (a - ROMBaseMac < ROMSize)
+        return ROMBaseHost + (a - ROMBaseMac);
+    return get_mem_bank(addr).xlateaddr(addr);
+}
 /* gb-- deliberately not implemented since it shall not be used... */
 extern uae_u32 get_virtual_address(uae_u8 *addr);
 #endif /* DIRECT_ADDRESSING || REAL_ADDRESSING */
 
+// MOVEM block transfers (see genmovemel() in gencpu.c): the host address of
+// the MOVEM_MAX_BYTES at addr if they are all RAM read (written) inline, else
+// NULL. One range check covers the whole register list.
+#define MOVEM_MAX_BYTES 64
+
+#if MOVEM_FASTPATH && !REAL_ADDRESSING && !DIRECT_ADDRESSING && !defined(NO_INLINE_MEMORY_ACCESS)
+static __inline__ uae_u8 *movem_get_host(uaecptr addr)
+{
+    uaecptr a = mem_fast_addr(addr);
+    return likely(a <= mem_ram_end - MOVEM_MAX_BYTES) ? RAMBaseHost + a : NULL;
+}
+static __inline__ uae_u8 *movem_put_host(uaecptr addr)
+{
+    uaecptr a = mem_fast_addr(addr);
+    return likely(a <= mem_ram_write_end - MOVEM_MAX_BYTES) ? RAMBaseHost + a : NULL;
+}
+// After the stores, for the decode cache
+static __inline__ void movem_put_done(uae_u8 *host, uae_u32 size)
+{
+    uaecptr a = host - RAMBaseHost;
+    if (size)
+        dcache_note_write(a, size);
+}
+#else
+static __inline__ uae_u8 *movem_get_host(uaecptr addr) { return NULL; }
+static __inline__ uae_u8 *movem_put_host(uaecptr addr) { return NULL; }
+static __inline__ void movem_put_done(uae_u8 *host, uae_u32 size) { }
+#endif
+
+#if COMPACT_COLD_HANDLERS
+// Out of line accessors for the cold handlers (see cpuop_cold.h)
+extern uae_u32 cold_get_byte(uaecptr addr);
+extern uae_u32 cold_get_word(uaecptr addr);
+extern uae_u32 cold_get_long(uaecptr addr);
+extern void cold_put_byte(uaecptr addr, uae_u32 b);
+extern void cold_put_word(uaecptr addr, uae_u32 w);
+extern void cold_put_long(uaecptr addr, uae_u32 l);
+#endif
+
 #endif /* MEMORY_H */
 
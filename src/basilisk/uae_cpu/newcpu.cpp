@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
 
 #include "sysdeps.h"
 
@@ -35,6 +36,7 @@
 #include "cpu_emulation.h"
 #include "main.h"
 #include "emul_op.h"
+#include "timer.h"
 
 extern int intlev(void);	// From baisilisk_glue.cpp
 
@@ -44,6 +46,14 @@ extern int intlev(void);	// From baisilisk_glue.cpp
 #include "newcpu.h"
 #include "compiler/compemu.h"
 #include "fpu/fpu.h"
+#include "jit_rv32.h"
+#include "pc_profiler.h"
+#include "trace_ring.h"
+#include "console.h"
+#include "savestate.h"
+#include "sram_plan.h"
+#include "prefs.h"
+#include "perf_registry.h"
 
 #if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
 B2_mutex *spcflags_lock = NULL;
@@ -52,6 +62,56 @@ B2_mutex *spcflags_lock = NULL;
 bool quit_program = false;
 struct flag_struct regflags;
 
+#if LAZY_FLAGS
+/*
+ *  Work out N/Z/V/C from the operation recorded by the last ALU instruction
+ */
+#define LAZY_LOGICAL(S) do { \
+	ZFLG = (S)res == 0; \
+	NFLG = (S)res < 0; \
+	CFLG = VFLG = 0; \
+} while (0)
+
+#define LAZY_ADD(S, U) do { \
+	int flgs = (S)src < 0, flgo = (S)dst < 0, flgn = (S)res < 0; \
+	ZFLG = (S)res == 0; \
+	NFLG = flgn; \
+	VFLG = (flgs ^ flgn) & (flgo ^ flgn); \
+	CFLG = (U)~dst < (U)src; \
+} while (0)
+
+#define LAZY_SUB(S, U) do { \
+	int flgs = (S)src < 0, flgo = (S)dst < 0, flgn = (S)res < 0; \
+	ZFLG = (S)res == 0; \
+	NFLG = flgn; \
+	VFLG = (flgs ^ flgo) & (flgn ^ flgo); \
+	CFLG = (U)src > (U)dst; \
+} while (0)
+
+#ifdef ARDUINO
+IRAM_ATTR
+#endif
+void m68k_flags_sync (void)
+{
+	uae_u32 src = regflags.lazy_src;
+	uae_u32 dst = regflags.lazy_dst;
+	uae_u32 res = regflags.lazy_res;
+
+	switch (regflags.lazy) {
+	case LAZY_LOGICAL_B:	LAZY_LOGICAL(uae_s8); break;
+	case LAZY_LOGICAL_W:	LAZY_LOGICAL(uae_s16); break;
+	case LAZY_LOGICAL_L:	LAZY_LOGICAL(uae_s32); break;
+	case LAZY_ADD_B:		LAZY_ADD(uae_s8, uae_u8); break;
+	case LAZY_ADD_W:		LAZY_ADD(uae_s16, uae_u16); break;
+	case LAZY_ADD_L:		LAZY_ADD(uae_s32, uae_u32); break;
+	case LAZY_SUB_B:		LAZY_SUB(uae_s8, uae_u8); break;
+	case LAZY_SUB_W:		LAZY_SUB(uae_s16, uae_u16); break;
+	case LAZY_SUB_L:		LAZY_SUB(uae_s32, uae_u32); break;
+	}
+	regflags.lazy = LAZY_NONE;
+}
+#endif
+
 /* Opcode of faulting instruction */
 uae_u16 last_op_for_exception_3;
 /* PC at fault time */
@@ -126,6 +186,12 @@ const int movem_next[256] = {
 // 256KB opcode lookup table - dynamically allocated in PSRAM on ESP32
 cpuop_func **cpufunctbl = NULL;
 
+#if USE_COMPACT_DISPATCH
+uae_u16 *cpufuncidx = NULL;			// 128KB, allocated by Init680x0()
+cpuop_func **cpufuncptr = NULL;		// Distinct handlers
+static int cpufuncptr_count = 0;
+#endif
+
 #if FLIGHT_RECORDER
 struct rec_step {
 	uae_u32 pc;
@@ -196,32 +262,66 @@ static void dump_regs(void)
 }
 #endif
 
+// With USE_CONST_DISPATCH, table68k is only built when the instruction
+// counts or the disassembler first need it
+static void need_table68k (void)
+{
+	if (table68k == NULL) {
+		read_table68k ();
+		do_merges ();
+	}
+}
+
+// 2 writes frequent.68k for gencpu (handler order, IRAM placement and
+// superinstruction selection). Build with USE_SUPERINSNS=0 so fused pairs
+// count separately. On ESP32 the file goes to the SD card and is rewritten
+// about once a minute; copy it to uae_cpu/generated before regenerating.
+#ifndef COUNT_INSTRS
 #define COUNT_INSTRS 0
+#endif
 
 #if COUNT_INSTRS
-static unsigned long int instrcount[65536];
-static uae_u16 opcodenums[65536];
+static unsigned long int *instrcount;	// 256KB, kept out of internal SRAM
+#define COUNT_DUMP_QUANTA 3000
 
 static int compfn (const void *el1, const void *el2)
 {
-	return instrcount[*(const uae_u16 *)el1] < instrcount[*(const uae_u16 *)el2];
+	unsigned long int c1 = instrcount[*(const uae_u16 *)el1];
+	unsigned long int c2 = instrcount[*(const uae_u16 *)el2];
+	return c1 < c2 ? 1 : c1 > c2 ? -1 : 0;
 }
 
-static char *icountfilename (void)
+static const char *icountfilename (void)
 {
+#ifdef ARDUINO
+	return COUNT_INSTRS == 2 ? "/sd/frequent.68k" : "/sd/insncount";
+#else
 	char *name = getenv ("INSNCOUNT");
 	if (name)
 		return name;
 	return COUNT_INSTRS == 2 ? "frequent.68k" : "insncount";
+#endif
 }
 
 void dump_counts (void)
 {
-	FILE *f = fopen (icountfilename (), "w");
-	unsigned long int total;
+	unsigned long int total = 0;
 	int i;
 
+	if (instrcount == NULL)
+		return;
+	FILE *f = fopen (icountfilename (), "w");
+	uae_u16 *opcodenums = (uae_u16 *)malloc (65536 * sizeof(uae_u16));
+	if (f == NULL || opcodenums == NULL) {
+		write_log ("[CPU] Cannot write instruction count file %s\n", icountfilename ());
+		if (f)
+			fclose (f);
+		free (opcodenums);
+		return;
+	}
+
 	write_log ("Writing instruction count file...\n");
+	need_table68k ();
 	for (i = 0; i < 65536; i++) {
 		opcodenums[i] = i;
 		total += instrcount[i];
@@ -241,6 +341,7 @@ void dump_counts (void)
 		fprintf (f, "%04x: %lu %s\n", opcodenums[i], cnt, lookup->name);
 	}
 	fclose (f);
+	free (opcodenums);
 }
 #else
 void dump_counts (void)
@@ -250,6 +351,10 @@ void dump_counts (void)
 
 int broken_in;
 
+#if USE_CONST_DISPATCH && defined(HAVE_GET_WORD_UNSWAPPED)
+#error "gencpu's precomputed dispatch tables are indexed by swapped opcodes"
+#endif
+
 static __inline__ unsigned int cft_map (unsigned int f)
 {
 #ifndef HAVE_GET_WORD_UNSWAPPED
@@ -266,34 +371,143 @@ void REGPARAM2 op_illg_1 (uae_u32 opcode)
 	op_illg (cft_map (opcode));
 }
 
+#if USE_COMPACT_DISPATCH
+// The pointer table is small enough to always live in internal SRAM
+static bool set_cpufuncptr (cpuop_func *const *ptrs, int count)
+{
+	free(cpufuncptr);
+#ifdef ARDUINO
+	cpufuncptr = (cpuop_func **)heap_caps_malloc(count * sizeof(cpuop_func *), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+	cpufuncptr = (cpuop_func **)malloc(count * sizeof(cpuop_func *));
+#endif
+	if (cpufuncptr == NULL)
+		return false;
+	memcpy(cpufuncptr, ptrs, count * sizeof(cpuop_func *));
+	cpufuncptr_count = count;
+	return true;
+}
+#endif
+
+#if USE_COMPACT_DISPATCH && !USE_CONST_DISPATCH
+/*
+ *  Turn the full cpufunctbl into the handler index and pointer tables
+ */
+static bool compact_cpufunctbl (void)
+{
+	// Open addressing hash from handler to index, only needed while we build
+	const int hash_size = 8192;
+	uae_u16 *hash = (uae_u16 *)malloc(hash_size * sizeof(uae_u16));
+	cpuop_func **ptrs = (cpuop_func **)malloc(hash_size * sizeof(cpuop_func *));
+	if (hash == NULL || ptrs == NULL) {
+		free(hash);
+		free(ptrs);
+		return false;
+	}
+	memset(hash, 0xff, hash_size * sizeof(uae_u16));
+
+	int count = 0;
+	for (int opcode = 0; opcode < 65536; opcode++) {
+		cpuop_func *f = cpufunctbl[opcode];
+		unsigned int h = ((uintptr)f >> 2) & (hash_size - 1);
+		while (hash[h] != 0xffff && ptrs[hash[h]] != f)
+			h = (h + 1) & (hash_size - 1);
+		if (hash[h] == 0xffff) {
+			if (count == hash_size / 2) {
+				write_log("[CPU] Too many distinct opcode handlers for compact dispatch\n");
+				free(hash);
+				free(ptrs);
+				return false;
+			}
+			ptrs[count] = f;
+			hash[h] = count++;
+		}
+		cpufuncidx[opcode] = hash[h];
+	}
+	free(hash);
+
+	bool ok = set_cpufuncptr(ptrs, count);
+	free(ptrs);
+	if (!ok)
+		return false;
+	write_log("Compact dispatch: %d handlers (%d bytes) + 128KB index\n", count, (int)(count * sizeof(cpuop_func *)));
+	return true;
+}
+#endif
+
+static unsigned int get_cpu_level (void)
+{
+	if (CPUType == 4)
+		return 4;		// 68040 with FPU
+	if (FPUType)
+		return 3;		// 68020 with FPU
+	if (CPUType >= 2)
+		return 2;		// 68020
+	if (CPUType == 1)
+		return 1;
+	return 0;			// 68000 (default)
+}
+
+#if !USE_CONST_DISPATCH || CPU_CHECK
+static struct cputbl *get_smalltbl (unsigned int cpu_level)
+{
+	return (cpu_level == 4 ? op_smalltbl_0_ff
+			: cpu_level == 3 ? op_smalltbl_1_ff
+			: cpu_level == 2 ? op_smalltbl_2_ff
+			: cpu_level == 1 ? op_smalltbl_3_ff
+			: op_smalltbl_4_ff);
+}
+#endif
+
 static void build_cpufunctbl (void)
 {
 	int i;
 	unsigned long opcode;
-	unsigned int cpu_level = 0;		// 68000 (default)
-	if (CPUType == 4)
-		cpu_level = 4;		// 68040 with FPU
-	else {
-		if (FPUType)
-			cpu_level = 3;	// 68020 with FPU
-		else if (CPUType >= 2)
-			cpu_level = 2;	// 68020
-		else if (CPUType == 1)
-			cpu_level = 1;
-	}
-	struct cputbl *tbl = (
-				cpu_level == 4 ? op_smalltbl_0_ff
-				: cpu_level == 3 ? op_smalltbl_1_ff
-				: cpu_level == 2 ? op_smalltbl_2_ff
-				: cpu_level == 1 ? op_smalltbl_3_ff
-				: op_smalltbl_4_ff);
+	unsigned int cpu_level = get_cpu_level ();
+
+#if USE_CONST_DISPATCH
+	// Copy the index gencpu precomputed for this level (see
+	// generated/cpudispatch.cpp); table68k is not needed
+	const struct cpudispatch *d = &op_dispatch_ff[4 - cpu_level];
+	if (cpufuncidx == NULL)
+		cpufuncidx = (uae_u16 *)malloc(65536 * sizeof(uae_u16));
+	if (cpufuncidx == NULL || !set_cpufuncptr(d->handlers, d->count)) {
+		write_log("ERROR: Failed to allocate opcode tables!\n");
+		abort();
+	}
+	memcpy(cpufuncidx, d->index, 65536 * sizeof(uae_u16));
+	write_log("Compact dispatch: %d handlers (%d bytes) + 128KB index, precomputed\n", d->count, (int)(d->count * sizeof(cpuop_func *)));
+#else
+	struct cputbl *tbl = get_smalltbl (cpu_level);
 
+#if USE_COMPACT_DISPATCH
+	// Build the full table in PSRAM, then compact it
+	if (cpufuncidx == NULL)
+		cpufuncidx = (uae_u16 *)malloc(65536 * sizeof(uae_u16));
+#ifdef ARDUINO
+	cpufunctbl = (cpuop_func **)heap_caps_malloc(65536 * sizeof(cpuop_func *), MALLOC_CAP_SPIRAM);
+#else
+	cpufunctbl = (cpuop_func **)malloc(65536 * sizeof(cpuop_func *));
+#endif
+	if (cpufuncidx == NULL || cpufunctbl == NULL) {
+		write_log("ERROR: Failed to allocate opcode tables!\n");
+		abort();
+	}
+#endif
 	for (opcode = 0; opcode < 65536; opcode++)
 		cpufunctbl[cft_map (opcode)] = op_illg_1;
 	for (i = 0; tbl[i].handler != NULL; i++) {
 		if (! tbl[i].specific)
 			cpufunctbl[cft_map (tbl[i].opcode)] = tbl[i].handler;
 	}
+#if USE_SUPERINSNS
+	// Swap in the fused handlers before they are copied to the merged opcodes
+	if (cpu_level == 4) {
+		for (i = 0; op_fusetbl_0_ff[i].handler != NULL; i++)
+			cpufunctbl[cft_map (op_fusetbl_0_ff[i].opcode)] = op_fusetbl_0_ff[i].handler;
+		write_log ("Superinstructions: %d fused handlers\n", i);
+	}
+#endif
 	for (opcode = 0; opcode < 65536; opcode++) {
 		cpuop_func *f;
 
@@ -311,7 +525,300 @@ static void build_cpufunctbl (void)
 		if (tbl[i].specific)
 			cpufunctbl[cft_map (tbl[i].opcode)] = tbl[i].handler;
 	}
+#if USE_COMPACT_DISPATCH
+	if (!compact_cpufunctbl()) {
+		write_log("ERROR: Failed to build compact opcode dispatch!\n");
+		abort();
+	}
+	free(cpufunctbl);
+	cpufunctbl = NULL;
+#endif
+#endif
+}
+
+#if CPU_CHECK
+/*
+ * Full opcode table of gencpu's own handlers for the current CPU level,
+ * without the superinstructions, for the conformance check to step
+ * through one instruction at a time (see cpu_check.cpp). Indexed like
+ * cpufunctbl; free() it when done. Builds table68k if it is not there yet.
+ */
+cpuop_func **build_reference_functbl (void)
+{
+	int i;
+	unsigned long opcode;
+	unsigned int cpu_level = get_cpu_level ();
+	struct cputbl *tbl = get_smalltbl (cpu_level);
+#ifdef ARDUINO
+	cpuop_func **t = (cpuop_func **)heap_caps_malloc(65536 * sizeof(cpuop_func *), MALLOC_CAP_SPIRAM);
+#else
+	cpuop_func **t = (cpuop_func **)malloc(65536 * sizeof(cpuop_func *));
+#endif
+	if (t == NULL)
+		return NULL;
+
+	need_table68k ();
+	for (opcode = 0; opcode < 65536; opcode++)
+		t[cft_map (opcode)] = op_illg_1;
+	for (i = 0; tbl[i].handler != NULL; i++) {
+		if (! tbl[i].specific)
+			t[cft_map (tbl[i].opcode)] = tbl[i].handler;
+	}
+	for (opcode = 0; opcode < 65536; opcode++) {
+		if (table68k[opcode].mnemo == i_ILLG || table68k[opcode].clev > cpu_level)
+			continue;
+		if (table68k[opcode].handler != -1)
+			t[cft_map (opcode)] = t[cft_map (table68k[opcode].handler)];
+	}
+	for (i = 0; tbl[i].handler != NULL; i++) {
+		if (tbl[i].specific)
+			t[cft_map (tbl[i].opcode)] = tbl[i].handler;
+	}
+	return t;
 }
+#endif
+
+#if USE_DECODE_CACHE
+/*
+ * Decode cache
+ *
+ * Every instruction normally costs an opcode fetch, a byte swap and a load
+ * from the 256KB cpufunctbl before the handler runs. The decode cache keeps
+ * short traces of instructions that were already dispatched, keyed by the
+ * 68k PC of the first one: for each instruction it remembers where it
+ * started, its opcode and its handler. A hit replays the trace directly,
+ * checking before each instruction that the PC is where the trace expects
+ * it, so taken branches simply end the replay. Extension words are still
+ * fetched by the handlers themselves.
+ *
+ * A trace never leaves the 4KB page it started in. RAM pages with traces
+ * are flagged in dcache_code_pages and any write to them bumps the page
+ * generation, which retires all of its traces at once (dcache_note_write()
+ * in memory.h). ROM only changes through FlushCodeCache(), which empties
+ * the whole cache. dcache_epoch moves whenever a trace is stored or retired
+ * so a replay notices when a nested execution (EmulOps) or a self-modifying
+ * store pulled its entry from under it.
+ *
+ * With USE_RV32_JIT, traces that keep hitting are handed to jit_rv32.cpp,
+ * which turns the replay into native code performing the same checks.
+ */
+#define DCACHE_ENTRIES		512		// Direct mapped, must be a power of two
+#define DCACHE_TRACE_LEN	8
+#define DCACHE_PAGE_SIZE	(1 << DCACHE_PAGE_SHIFT)
+#define DCACHE_PAGE_MASK	(DCACHE_PAGE_SIZE - 1)
+#define DCACHE_EMPTY		0xffffffff
+
+struct dcache_entry {
+	uaecptr		pc;							// PC of the first instruction, DCACHE_EMPTY if unused
+	uae_u16		gen;						// Page generation the trace was recorded under
+	uae_u8		count;						// Number of instructions in the trace
+	uae_u8		hits;						// Replays since recording (JIT hotness)
+	uae_u16		offset[DCACHE_TRACE_LEN];	// Start of each instruction within the page
+	uae_u16		opcode[DCACHE_TRACE_LEN];
+	cpuop_func	*handler[DCACHE_TRACE_LEN];
+#if USE_RV32_JIT
+	jit_block_func native;					// Translated trace, NULL until hot
+#endif
+};
+
+// Entries live in internal SRAM; without it the cache stays off (a PSRAM
+// lookup is no cheaper than the normal dispatch it would replace)
+static struct dcache_entry *dcache = NULL;
+static sram_slot *const dcache_sram = SramSlot("dcache", DCACHE_ENTRIES * sizeof(struct dcache_entry), 100, SRAM_ONLY);
+static uae_u32 dcache_epoch = 0;
+static uae_u16 dcache_rom_gen = 0;
+
+#if USE_RV32_JIT
+#define JIT_HOT_THRESHOLD	32		// Replays before a trace is translated
+static bool jit_enabled = false;
+static int jit_depth = 0;			// Translated blocks currently on the stack
+#endif
+
+// One spare element so a write ending at the top of RAM can be checked
+DRAM_ATTR uae_u8 dcache_code_pages[DCACHE_RAM_PAGES + 1];
+static DRAM_ATTR uae_u16 dcache_page_gen[DCACHE_RAM_PAGES + 1];
+
+static void dcache_exit(void);
+
+static void dcache_init(void)
+{
+	// The page tables only cover DCACHE_RAM_PAGES (a host --ramsize may be larger)
+	if (RAMSize > ((uae_u32)DCACHE_RAM_PAGES << DCACHE_PAGE_SHIFT)) {
+		write_log("Decode cache disabled: %u MB of RAM, page tables for %u MB\n",
+				  (unsigned)(RAMSize >> 20), (unsigned)(DCACHE_RAM_PAGES >> (20 - DCACHE_PAGE_SHIFT)));
+		dcache_exit();
+		return;
+	}
+	if (dcache == NULL) {
+		dcache = (struct dcache_entry *)SramAlloc(dcache_sram, DCACHE_ENTRIES * sizeof(struct dcache_entry));
+		if (dcache == NULL) {
+			write_log("Decode cache disabled: no internal SRAM for %d bytes\n", (int)(DCACHE_ENTRIES * sizeof(struct dcache_entry)));
+			return;
+		}
+	}
+#if USE_RV32_JIT
+	jit_enabled = jit_rv32_init();
+#endif
+	m68k_dcache_flush();
+}
+
+static void dcache_exit(void)
+{
+#if USE_RV32_JIT
+	jit_rv32_exit();
+	jit_enabled = false;
+#endif
+	if (dcache) {
+		free(dcache);
+		dcache = NULL;
+	}
+}
+
+/*
+ *  Drop every trace
+ */
+void m68k_dcache_flush(void)
+{
+	if (dcache) {
+		for (int i = 0; i < DCACHE_ENTRIES; i++) {
+			dcache[i].pc = DCACHE_EMPTY;
+#if USE_RV32_JIT
+			dcache[i].native = NULL;
+#endif
+		}
+	}
+	memset(dcache_code_pages, 0, sizeof(dcache_code_pages));
+	dcache_rom_gen++;
+	dcache_epoch++;
+}
+
+/*
+ *  Retire traces recorded from RAM pages overlapping [start, start + size)
+ */
+void m68k_dcache_invalidate(uaecptr start, uae_u32 size)
+{
+	if (size == 0)
+		return;
+	uae_u32 first = start >> DCACHE_PAGE_SHIFT;
+	uae_u32 last = (start + size - 1) >> DCACHE_PAGE_SHIFT;
+	if (last > DCACHE_RAM_PAGES)
+		last = DCACHE_RAM_PAGES;
+	bool retired = false, wrapped = false;
+	for (uae_u32 page = first; page <= last; page++) {
+		if (dcache_code_pages[page]) {
+			dcache_code_pages[page] = 0;
+			if (++dcache_page_gen[page] == 0)
+				wrapped = true;
+			retired = true;
+		}
+	}
+	// A generation back at 0 after 65536 rewrites would match traces of
+	// that page recorded long ago again
+	if (wrapped)
+		m68k_dcache_flush();
+	// Data moves (BlockMove()) mostly touch pages without traces
+	else if (retired)
+		dcache_epoch++;
+}
+
+#if USE_RV32_JIT
+/*
+ *  Translate a hot trace. Code buffer space is only reclaimed here, when no
+ *  translated block is running, by dropping every translation at once.
+ */
+static void dcache_compile(struct dcache_entry *e, uae_u8 *page)
+{
+	jit_block_func f = jit_rv32_compile(page, e->offset, e->opcode, e->handler, e->count, &dcache_epoch);
+	if (f == NULL) {
+		for (int i = 0; i < DCACHE_ENTRIES; i++)
+			dcache[i].native = NULL;
+		jit_rv32_reset();
+		f = jit_rv32_compile(page, e->offset, e->opcode, e->handler, e->count, &dcache_epoch);
+	}
+	e->native = f;
+}
+#endif
+
+/*
+ *  Execute one trace starting at the current PC, replaying it from the
+ *  cache or interpreting and recording it. Returns the number of
+ *  instructions executed.
+ */
+static ALWAYS_INLINE int dcache_execute(void)
+{
+	uaecptr pc = m68k_getpc();
+	uae_u16 *genp;
+	int n = 0;
+
+	if (likely(pc < RAMSize))
+		genp = &dcache_page_gen[pc >> DCACHE_PAGE_SHIFT];
+	else if (pc - ROMBaseMac < ROMSize)
+		genp = &dcache_rom_gen;
+	else {
+		// Code outside RAM and ROM is too rare to be worth tracking
+		uae_u32 opcode = GET_OPCODE;
+		(*cpu_handler(opcode))(opcode);
+		return 1;
+	}
+
+	uae_u8 *page = regs.pc_p - (pc & DCACHE_PAGE_MASK);
+	struct dcache_entry *e = &dcache[(pc >> 1) & (DCACHE_ENTRIES - 1)];
+	uae_u32 epoch = dcache_epoch;
+
+	if (likely(e->pc == pc && e->gen == *genp)) {
+#if USE_RV32_JIT
+		if (e->native) {
+			jit_depth++;
+			n = e->native();
+			jit_depth--;
+			return n;
+		}
+		if (++e->hits == JIT_HOT_THRESHOLD && jit_enabled && jit_depth == 0)
+			dcache_compile(e, page);
+#endif
+		do {
+			(*e->handler[n])(e->opcode[n]);
+			n++;
+		} while (n < e->count
+				 && regs.pc_p == page + e->offset[n]
+				 && dcache_epoch == epoch
+				 && !SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN));
+		return n;
+	}
+
+	// Miss: interpret normally, recording the trace as we go
+	struct dcache_entry t;
+	t.pc = pc;
+	t.gen = *genp;
+	if (genp != &dcache_rom_gen)
+		dcache_code_pages[pc >> DCACHE_PAGE_SHIFT] = 1;
+	for (;;) {
+		uae_u32 opcode = GET_OPCODE;
+		cpuop_func *f = cpu_handler(opcode);
+		t.offset[n] = regs.pc_p - page;
+		t.opcode[n] = opcode;
+		t.handler[n] = f;
+		(*f)(opcode);
+		n++;
+		if (n == DCACHE_TRACE_LEN || SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+			break;
+		if ((uintptr)(regs.pc_p - page) >= DCACHE_PAGE_SIZE || dcache_epoch != epoch)
+			break;
+	}
+
+	// Only keep the trace if nothing it covers changed while it was recorded
+	if (dcache_epoch == epoch && t.gen == *genp) {
+		t.count = n;
+		t.hits = 0;
+#if USE_RV32_JIT
+		t.native = NULL;
+#endif
+		*e = t;
+		dcache_epoch++;
+	}
+	return n;
+}
+#endif
 
 void init_m68k (void)
 {
@@ -334,24 +841,36 @@ void init_m68k (void)
 
 #if COUNT_INSTRS
 	{
-		FILE *f = fopen (icountfilename (), "r");
-		memset (instrcount, 0, sizeof instrcount);
+		FILE *f;
+		if (instrcount == NULL) {
+#ifdef ARDUINO
+			instrcount = (unsigned long int *)heap_caps_calloc(65536, sizeof(unsigned long int), MALLOC_CAP_SPIRAM);
+#else
+			instrcount = (unsigned long int *)calloc(65536, sizeof(unsigned long int));
+#endif
+		}
+		f = instrcount ? fopen (icountfilename (), "r") : NULL;
 		if (f) {
 			uae_u32 opcode, count, total;
 			char name[20];
 			write_log ("Reading instruction count file...\n");
 			fscanf (f, "Total: %lu\n", &total);
 			while (fscanf (f, "%lx: %lu %s\n", &opcode, &count, name) == 3) {
-				instrcount[opcode] = count;
+				if (opcode < 65536)
+					instrcount[opcode] = count;
 			}
 			fclose(f);
 		}
 	}
 #endif
-	read_table68k ();
-	do_merges ();
+#if !USE_CONST_DISPATCH
+	need_table68k ();
+#endif
 
 	build_cpufunctbl ();
+#if USE_DECODE_CACHE
+	dcache_init ();
+#endif
 
 #if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
 	spcflags_lock = B2_create_mutex();
@@ -361,6 +880,9 @@ void init_m68k (void)
 
 void exit_m68k (void)
 {
+#if USE_DECODE_CACHE
+	dcache_exit ();
+#endif
 	fpu_exit ();
 #if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
 	B2_delete_mutex(spcflags_lock);
@@ -684,7 +1206,7 @@ d8r_common:
 	return 0;
 }
 
-uae_u32 get_disp_ea_020 (uae_u32 base, uae_u32 dp)
+uae_u32 get_disp_ea_020_full (uae_u32 base, uae_u32 dp)
 {
 	int reg = (dp >> 12) & 15;
 	uae_s32 regd = regs.regs[reg];
@@ -880,6 +1402,22 @@ kludge_me_do:
 	SPCFLAGS_CLEAR( SPCFLAG_TRACE | SPCFLAG_DOTRACE );
 }
 
+#if COLD_EXCEPTION_PATHS
+/* Rare exceptions of the opcode handlers, see newcpu.h */
+void op_exception(int nr, uaecptr oldpc)
+{
+	Exception(nr, oldpc);
+}
+
+void op_address_error(uae_u32 opcode, uaecptr fault, uaecptr addr)
+{
+	last_op_for_exception_3 = opcode;
+	last_fault_for_exception_3 = fault;
+	last_addr_for_exception_3 = addr;
+	Exception(3, 0);
+}
+#endif
+
 static void Interrupt(int nr)
 {
 	assert(nr < 8 && nr >= 0);
@@ -992,7 +1530,7 @@ int m68k_movec2 (int regno, uae_u32 *regp)
 	return 1;
 }
 
-#if !defined(uae_s64)
+#if !USE_NATIVE_MULDIV
 static __inline__ int
 div_unsigned(uae_u32 src_hi, uae_u32 src_lo, uae_u32 div, uae_u32 *quot, uae_u32 *rem)
 {
@@ -1021,61 +1559,71 @@ div_unsigned(uae_u32 src_hi, uae_u32 src_lo, uae_u32 div, uae_u32 *quot, uae_u32
 
 void m68k_divl (uae_u32 opcode, uae_u32 src, uae_u16 extra, uaecptr oldpc)
 {
-#if defined(uae_s64)
+#if USE_NATIVE_MULDIV
+	// 32-bit dividends (and 64-bit ones that fit in 32 bits) take a single
+	// hardware div/rem; only a true 64/32 divide goes through libgcc
 	if (src == 0) {
 		Exception (5, oldpc);
 		return;
 	}
 	if (extra & 0x800) {
 		/* signed variant */
-		uae_s64 a = (uae_s64)(uae_s32)m68k_dreg(regs, (extra >> 12) & 7);
-		uae_s64 quot, rem;
-
-		if (extra & 0x400) {
-			a &= 0xffffffffu;
-			a |= (uae_s64)m68k_dreg(regs, extra & 7) << 32;
-		}
-		rem = a % (uae_s64)(uae_s32)src;
-		quot = a / (uae_s64)(uae_s32)src;
-		if ((quot & UVAL64(0xffffffff80000000)) != 0
-				&& (quot & UVAL64(0xffffffff80000000)) != UVAL64(0xffffffff80000000))
-		{
-			SET_VFLG (1);
-			SET_NFLG (1);
-			SET_CFLG (0);
+		uae_s32 lo = (uae_s32)m68k_dreg(regs, (extra >> 12) & 7);
+		uae_s32 hi = (extra & 0x400) ? (uae_s32)m68k_dreg(regs, extra & 7) : (lo >> 31);
+		uae_s32 quot, rem;
+
+		if (likely(hi == (lo >> 31))) {
+			if (unlikely(lo == (uae_s32)0x80000000 && (uae_s32)src == -1))
+				goto overflow;
+			quot = lo / (uae_s32)src;
+			rem = lo % (uae_s32)src;
 		} else {
-			if (((uae_s32)rem < 0) != ((uae_s64)a < 0)) rem = -rem;
-			SET_VFLG (0);
-			SET_CFLG (0);
-			SET_ZFLG (((uae_s32)quot) == 0);
-			SET_NFLG (((uae_s32)quot) < 0);
-			m68k_dreg(regs, extra & 7) = (uae_u32)rem;
-			m68k_dreg(regs, (extra >> 12) & 7) = (uae_u32)quot;
+			// Divide magnitudes so that -2^63 / -1 cannot trap or overflow
+			uae_s64 a = (uae_s64)(((uae_u64)(uae_u32)hi << 32) | (uae_u32)lo);
+			bool neg = (hi ^ (uae_s32)src) < 0;
+			uae_u64 ua = a < 0 ? -(uae_u64)a : (uae_u64)a;
+			uae_u32 us = (uae_s32)src < 0 ? -src : src;
+			uae_u64 uq = ua / us;
+			if (uq > (neg ? 0x80000000u : 0x7fffffffu))
+				goto overflow;
+			quot = neg ? -(uae_s32)(uae_u32)uq : (uae_s32)uq;
+			rem = (uae_s32)(a - (uae_s64)quot * (uae_s32)src);
 		}
+		SET_VFLG (0);
+		SET_CFLG (0);
+		SET_ZFLG (quot == 0);
+		SET_NFLG (quot < 0);
+		m68k_dreg(regs, extra & 7) = (uae_u32)rem;
+		m68k_dreg(regs, (extra >> 12) & 7) = (uae_u32)quot;
 	} else {
 		/* unsigned */
-		uae_u64 a = (uae_u64)(uae_u32)m68k_dreg(regs, (extra >> 12) & 7);
-		uae_u64 quot, rem;
+		uae_u32 lo = (uae_u32)m68k_dreg(regs, (extra >> 12) & 7);
+		uae_u32 hi = (extra & 0x400) ? (uae_u32)m68k_dreg(regs, extra & 7) : 0;
+		uae_u32 quot, rem;
 
-		if (extra & 0x400) {
-			a &= 0xffffffffu;
-			a |= (uae_u64)m68k_dreg(regs, extra & 7) << 32;
-		}
-		rem = a % (uae_u64)src;
-		quot = a / (uae_u64)src;
-		if (quot > 0xffffffffu) {
-			SET_VFLG (1);
-			SET_NFLG (1);
-			SET_CFLG (0);
+		if (likely(hi == 0)) {
+			quot = lo / src;
+			rem = lo % src;
 		} else {
-			SET_VFLG (0);
-			SET_CFLG (0);
-			SET_ZFLG (((uae_s32)quot) == 0);
-			SET_NFLG (((uae_s32)quot) < 0);
-			m68k_dreg(regs, extra & 7) = (uae_u32)rem;
-			m68k_dreg(regs, (extra >> 12) & 7) = (uae_u32)quot;
+			if (hi >= src)
+				goto overflow;
+			uae_u64 a = ((uae_u64)hi << 32) | lo;
+			quot = (uae_u32)(a / src);
+			rem = lo - quot * src;
 		}
+		SET_VFLG (0);
+		SET_CFLG (0);
+		SET_ZFLG (quot == 0);
+		SET_NFLG (((uae_s32)quot) < 0);
+		m68k_dreg(regs, extra & 7) = rem;
+		m68k_dreg(regs, (extra >> 12) & 7) = quot;
 	}
+	return;
+
+overflow:
+	SET_VFLG (1);
+	SET_NFLG (1);
+	SET_CFLG (0);
 #else
 	if (src == 0) {
 		Exception (5, oldpc);
@@ -1101,7 +1649,7 @@ void m68k_divl (uae_u32 opcode, uae_u32 src, uae_u16 extra, uaecptr oldpc)
 		}
 		if ((uae_s32)src < 0) src = -src;
 		if (div_unsigned(hi, lo, src, &quot, &rem) ||
-				(sign & 0x80000000) ? quot > 0x80000000 : quot > 0x7fffffff) {
+				((sign & 0x80000000) ? quot > 0x80000000 : quot > 0x7fffffff)) {
 			SET_VFLG (1);
 			SET_NFLG (1);
 			SET_CFLG (0);
@@ -1140,7 +1688,7 @@ void m68k_divl (uae_u32 opcode, uae_u32 src, uae_u16 extra, uaecptr oldpc)
 #endif
 }
 
-#if !defined(uae_s64)
+#if !USE_NATIVE_MULDIV
 static __inline__ void
 mul_unsigned(uae_u32 src1, uae_u32 src2, uae_u32 *dst_hi, uae_u32 *dst_lo)
 {
@@ -1163,7 +1711,8 @@ mul_unsigned(uae_u32 src1, uae_u32 src2, uae_u32 *dst_hi, uae_u32 *dst_lo)
 
 void m68k_mull (uae_u32 opcode, uae_u32 src, uae_u16 extra)
 {
-#if defined(uae_s64)
+#if USE_NATIVE_MULDIV
+	// 32x32->64 products compile to mul/mulh(u) on RV32IM
 	if (extra & 0x800) {
 		/* signed variant */
 		uae_s64 a = (uae_s64)(uae_s32)m68k_dreg(regs, (extra >> 12) & 7);
@@ -1253,8 +1802,8 @@ static const char* ccnames[] =
 
 // If value is greater than zero, this means we are still processing an EmulOp
 // because the counter is incremented only in m68k_execute(), i.e. interpretive
-// execution only
-static int m68k_execute_depth = 0;
+// execution only. At 1 the CPU runs top level code (see savestate.cpp).
+int m68k_execute_depth = 0;
 
 void m68k_reset (void)
 {
@@ -1294,12 +1843,111 @@ void m68k_reset (void)
 #endif
 }
 
+#if SAVE_STATE
+/*
+ *  Registers and control registers for hibernate/resume. Called between two
+ *  instructions of the outermost m68k_execute(), so the PC is all there is
+ *  of the instruction stream.
+ */
+void CPUStateIO(savestate *s)
+{
+	uaecptr pc = m68k_getpc();
+	spcflags_t spcflags = regs.spcflags & ~SPCFLAG_BRK;
+	MakeSR();
+
+	savestate_var(s, pc);
+	savestate_var(s, regs.regs);
+	savestate_var(s, regs.usp);
+	savestate_var(s, regs.isp);
+	savestate_var(s, regs.msp);
+	savestate_var(s, regs.sr);
+	savestate_var(s, regs.s);
+	savestate_var(s, regs.m);
+	savestate_var(s, regs.stopped);
+	savestate_var(s, regs.vbr);
+	savestate_var(s, regs.sfc);
+	savestate_var(s, regs.dfc);
+	savestate_var(s, spcflags);
+	savestate_var(s, caar);
+	savestate_var(s, cacr);
+	savestate_var(s, tc);
+	savestate_var(s, itt0);
+	savestate_var(s, itt1);
+	savestate_var(s, dtt0);
+	savestate_var(s, dtt1);
+	savestate_var(s, mmusr);
+	savestate_var(s, urp);
+	savestate_var(s, srp);
+
+	if (savestate_loading(s)) {
+		// regs.s and regs.m already match the SR, so the stacks stay put
+		SPCFLAGS_INIT( spcflags );
+		MakeFromSR();
+		m68k_setpc(pc);
+		fill_prefetch_0();
+	}
+}
+#endif
+
 void m68k_emulop_return(void)
 {
 	SPCFLAGS_SET( SPCFLAG_BRK );
 	quit_program = true;
 }
 
+#if EMULOP_REG_VIEW
+/*
+ *  EmulOp handlers get the CPU registers in place: M68kRegisters is laid out
+ *  like the start of regstruct, d0-d7, a0-a7 and sr. Copying the registers in
+ *  and out and converting the SR both ways cost more than many handlers.
+ *  r->sr is only made when the handler calls EmulOpMakeSR(), and only then
+ *  taken back. Otherwise the SR is the one the EMUL_OP was reached with,
+ *  whatever 68k code the handler ran through Execute68k() (see
+ *  basilisk_glue.cpp, which also keeps the registers across it): the flags
+ *  are copied back, and an interrupt mask, trace or supervisor state the
+ *  nested code left changed goes back through MakeFromSR(), which switches
+ *  the stacks and checks for interrupts like the copied SR did. Interrupts
+ *  posted while the handler ran are checked after it in any case.
+ */
+
+static_assert(offsetof(struct M68kRegisters, d) == offsetof(struct regstruct, regs), "M68kRegisters view of regs");
+static_assert(offsetof(struct M68kRegisters, a) == offsetof(struct regstruct, regs) + 8 * sizeof(uae_u32), "M68kRegisters view of regs");
+static_assert(offsetof(struct M68kRegisters, sr) == offsetof(struct regstruct, sr), "M68kRegisters view of regs");
+
+static bool emulop_sr_made = false;
+
+void EmulOpMakeSR(void)
+{
+	MakeSR();
+	emulop_sr_made = true;
+}
+
+void m68k_emulop(uae_u32 opcode)
+{
+	struct flag_struct flags = regflags;
+	int intmask = regs.intmask;
+	flagtype t1 = regs.t1, t0 = regs.t0, s = regs.s, m = regs.m;
+	bool outer_sr_made = emulop_sr_made;	// EMUL_OPs nest through Execute68k()
+	emulop_sr_made = false;
+	EmulOp(opcode, (struct M68kRegisters *)&regs);
+	if (emulop_sr_made)
+		MakeFromSR();
+	else {
+		regflags = flags;
+		if (unlikely(regs.intmask != intmask || regs.t1 != t1 || regs.t0 != t0 || regs.s != s || regs.m != m)) {
+			MakeSR();
+			regs.sr = (regs.sr & 0x00ff) | (t1 << 15) | (t0 << 14) | (s << 13) | (m << 12) | (intmask << 8);
+			MakeFromSR();
+		} else if (__atomic_load_n(&InterruptFlags, __ATOMIC_ACQUIRE))
+			SPCFLAGS_SET( SPCFLAG_INT );
+	}
+	emulop_sr_made = outer_sr_made;
+}
+#else
+void EmulOpMakeSR(void)
+{
+}
+
 void m68k_emulop(uae_u32 opcode)
 {
 	struct M68kRegisters r;
@@ -1319,12 +1967,120 @@ void m68k_emulop(uae_u32 opcode)
 	regs.sr = r.sr;
 	MakeFromSR();
 }
+#endif
+
+#if NATIVE_TRAP_DISPATCH
+/*
+ *  Native Toolbox trap dispatch
+ *
+ *  An A-line trap used to go through Exception(): an exception frame on the
+ *  stack, the vector fetch, then the ROM dispatcher decoding the trap word,
+ *  reading the Toolbox trap table and rebuilding the stack as if the routine
+ *  had been called with JSR. For a Toolbox trap (bit 11 set) op_illg() now
+ *  does that last step itself: it pushes the return address, unless bit 10
+ *  (autopop) is set, and jumps to the table entry. Patched traps work as
+ *  before, SetToolTrapAddress() writes the same table.
+ *
+ *  OS traps still take the ROM path: their dispatcher saves registers,
+ *  passes the trap word in d1 and returns through RTE, and patches may know
+ *  its stack layout. So does everything outside the plain case, which the
+ *  ROM handles as before:
+ *
+ *  - user mode or tracing (the exception would switch stacks or trace)
+ *  - an A-line vector other than the one seen at startup (a debugger)
+ *  - a trap table that did not match GetToolTrapAddress() at startup
+ *  - the "nonativetraps" pref, or "set nativetraps 0" on the console
+ */
+
+#define TOOL_TRAP_TABLE		0x0e00		// 1024 Toolbox trap addresses
+#define TOOL_TRAPS			0x400
+
+static uaecptr aline_vector = 0;		// ROM A-line handler, 0: not installed
+static volatile uae_u32 native_traps = 1;
+static perf_counter *const perf_traps_native = PerfCounter("cpu.traps_native", PERF_COUNT, PERF_CORE_CPU);
+static perf_counter *const perf_traps_rom = PerfCounter("cpu.traps_rom", PERF_COUNT, PERF_CORE_CPU);
+
+static inline bool native_tool_trap(uae_u32 opcode, uaecptr pc)
+{
+	if (!(opcode & 0x0800) || !regs.s || regs.t1 || regs.t0 || !native_traps)
+		return false;
+	if (aline_vector == 0 || get_long(regs.vbr + 0x28) != aline_vector)
+		return false;
+
+	uaecptr routine = get_long(TOOL_TRAP_TABLE + (opcode & (TOOL_TRAPS - 1)) * 4);
+	if (!(opcode & 0x0400)) {
+		m68k_areg(regs, 7) -= 4;
+		put_long(m68k_areg(regs, 7), pc + 2);
+	}
+	m68k_setpc(routine);
+	SPCFLAGS_SET( SPCFLAG_JIT_END_COMPILE );
+	fill_prefetch_0 ();
+	return true;
+}
+
+void NativeTrapsInstall(void)
+{
+	if (aline_vector || PrefsFindBool("nonativetraps"))
+		return;
+
+	// The table must be where the ROM dispatcher reads it
+	M68kRegisters r;
+	for (int i = 0; i < TOOL_TRAPS; i++) {
+		r.d[0] = 0xa800 | i;
+		Execute68kTrap(0xa746, &r);		// GetToolTrapAddress()
+		if (r.a[0] != get_long(TOOL_TRAP_TABLE + i * 4)) {
+			write_log("[TRAPS] Toolbox trap %04x not in the table at %04x, ROM dispatcher kept\n", 0xa800 | i, TOOL_TRAP_TABLE);
+			return;
+		}
+	}
+
+	aline_vector = get_long(regs.vbr + 0x28);
+	ConsoleAddTunable("nativetraps", &native_traps, 0, 1);
+	write_log("[TRAPS] Native Toolbox trap dispatch, ROM dispatcher at %08x\n", aline_vector);
+}
+
+void NativeTrapsReset(void)
+{
+	aline_vector = 0;
+}
+#else
+#define native_tool_trap(opcode, pc) false
+
+void NativeTrapsInstall(void)
+{
+}
+
+void NativeTrapsReset(void)
+{
+}
+#endif
 
 void REGPARAM2 op_illg (uae_u32 opcode)
 {
 	uaecptr pc = m68k_getpc ();
 
 	if ((opcode & 0xF000) == 0xA000) {
+#if PC_PROFILER
+		pc_profiler_trap = opcode;
+#endif
+#if TRAP_PROFILE
+		trap_profile_enter(opcode, pc);
+#endif
+#if SERIAL_CONSOLE
+		if (unlikely(CONSOLE_TRAP_MARK(opcode)))
+			ConsoleTrapMark(opcode);
+#endif
+#if TRACE_RING
+		if (opcode == 0xA9C9)	// SysError(): keep the history leading up to the bomb
+			trace_ring_freeze();
+#endif
+		if (native_tool_trap(opcode, pc)) {
+			perf_inc(perf_traps_native);
+			return;
+		}
+#if NATIVE_TRAP_DISPATCH
+		perf_inc(perf_traps_rom);
+#endif
 		Exception(0xA,0);
 		return;
 	}
@@ -1419,6 +2175,13 @@ int m68k_do_specialties (void)
 				regs.stopped = 0;
 				SPCFLAGS_CLEAR( SPCFLAG_STOP );
 			}
+		} else {
+			// Nothing pending: sleep until an interrupt source wakes us
+			// or the next tick is due, then let the tick run
+			idle_wait();
+			cpu_do_check_ticks();
+			if (__atomic_load_n(&InterruptFlags, __ATOMIC_ACQUIRE))
+				SPCFLAGS_SET( SPCFLAG_INT );
 		}
 	}
 	if (SPCFLAGS_TEST( SPCFLAG_TRACE ))
@@ -1452,7 +2215,13 @@ int m68k_do_specialties (void)
 // values improve performance but reduce interrupt responsiveness.
 // 32 instructions = good balance of performance vs responsiveness
 // Higher values (64, 128) give diminishing returns but less responsive interrupts
+// While an interrupt is waiting to be taken, batches shrink to
+// EXEC_BATCH_PENDING (the quantum in main_esp32.cpp shrinks as well)
 #define EXEC_BATCH_SIZE 32
+#define EXEC_BATCH_PENDING 8
+
+// Threaded dispatch needs no work between two instructions
+#define THREADED_DISPATCH (USE_THREADED_DISPATCH && !FLIGHT_RECORDER && !COUNT_INSTRS && !TRAP_PROFILE)
 
 // External tick counter (defined in main_esp32.cpp via newcpu.h)
 extern int32 emulated_ticks;
@@ -1463,56 +2232,133 @@ IRAM_ATTR
 #endif
 void m68k_do_execute (void)
 {
+#if USE_THREADED_DISPATCH
+	// An EmulOp handler can get here through Execute68k() in the middle of
+	// a chain; the chain goes on afterwards with its own budget
+	uae_s32 outer_budget = regs.thread_budget;
+#endif
 	for (;;) {
 		// Execute a batch of instructions before checking ticks/flags
 		// This reduces the overhead of the tick check from every instruction
 		// to every EXEC_BATCH_SIZE instructions
-		int batch_count = EXEC_BATCH_SIZE;
+		// Interrupt sources only post to InterruptFlags (see spcflags.h); raise
+		// SPCFLAG_INT here when the request can be taken. A masked request is
+		// picked up by MakeFromSR() when the mask is lowered.
+		uae_u32 pending = __atomic_load_n(&InterruptFlags, __ATOMIC_ACQUIRE);
+		if (unlikely(pending) && regs.intmask == 0 && !SPCFLAGS_TEST(SPCFLAG_INT | SPCFLAG_DOINT))
+			SPCFLAGS_SET(SPCFLAG_INT);
+		int batch_count = pending ? EXEC_BATCH_PENDING : EXEC_BATCH_SIZE;
 		int instructions_executed = 0;
 		
-		do {
+#if TRACE_RING
+		// Armed recorder: run the batch through the recording interpreter loop
+		if (unlikely(trace_ring_level)) {
+			instructions_executed = trace_ring_execute(batch_count);
+			batch_count = 0;
+		}
+#endif
+		while (batch_count > 0) {
+#if USE_DECODE_CACHE && !FLIGHT_RECORDER && !COUNT_INSTRS && !TRAP_PROFILE
+			if (likely(dcache != NULL)) {
+				int n = dcache_execute();
+				instructions_executed += n;
+				batch_count -= n;
+				if (unlikely(SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))) {
+					break;
+				}
+				continue;
+			}
+#endif
+#if THREADED_DISPATCH
+			{
+				// The handlers chain the batch themselves (cpuop_end() in
+				// newcpu.h); the budget left gives the count
+				regs.thread_budget = batch_count;
+				uae_u32 opcode = GET_OPCODE;
+				(*cpu_handler(opcode))(opcode);
+				int n = batch_count - (regs.thread_budget & ~THREAD_BUDGET_STOP) + 1;
+				regs.thread_budget = 0;
+				instructions_executed += n;
+				batch_count -= n;
+				if (unlikely(SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))) {
+					break;
+				}
+				continue;
+			}
+#endif
 			uae_u32 opcode = GET_OPCODE;
 #if FLIGHT_RECORDER
 			m68k_record_step(m68k_getpc());
 #endif
-			(*cpufunctbl[opcode])(opcode);
+#if COUNT_INSTRS
+			if (instrcount)
+				instrcount[cft_map (opcode)]++;
+#endif
+			(*cpu_handler(opcode))(opcode);
+#if TRAP_PROFILE
+			trap_profile_insns++;
+#endif
 			instructions_executed++;
+			batch_count--;
 			
 			// Early exit if special flags are set (interrupts, etc.)
 			// This check is very fast (single memory read + compare)
 			if (unlikely(SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))) {
 				break;
 			}
-		} while (--batch_count > 0);
+		}
 		
 		// Decrement tick counter by number of instructions actually executed
 		// This maintains accurate instruction counting for IPS monitoring
 		emulated_ticks -= instructions_executed;
 		if (emulated_ticks <= 0) {
 			cpu_do_check_ticks();
+#if COUNT_INSTRS
+			static int count_quanta = 0;
+			if (++count_quanta == COUNT_DUMP_QUANTA) {
+				count_quanta = 0;
+				dump_counts();
+			}
+#endif
 		}
 		
 		// Handle special conditions (interrupts, trace, etc.)
 		if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN)) {
-			if (m68k_do_specialties())
+#if FAST_EXEC_RETURN
+			// The EXEC_RETURN sentinel: back to Execute68k() at once. The
+			// other flags stay set for the loop that ran the EmulOp, so an
+			// interrupt is not taken on the sentinel's stack frame.
+			if (quit_program) {
+				SPCFLAGS_CLEAR( SPCFLAG_BRK );
+#if USE_THREADED_DISPATCH
+				regs.thread_budget = outer_budget;
+				if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+					SPCFLAGS_STOP_THREAD();
+#endif
 				return;
+			}
+#endif
+			if (m68k_do_specialties()) {
+#if USE_THREADED_DISPATCH
+				regs.thread_budget = outer_budget;
+				if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN))
+					SPCFLAGS_STOP_THREAD();
+#endif
+				return;
+			}
 		}
 	}
 }
 
 void m68k_execute (void)
 {
-#if USE_JIT
 	++m68k_execute_depth;
-#endif
 	for (;;) {
 		if (quit_program)
 			break;
 		m68k_do_execute();
 	}
-#if USE_JIT
 	--m68k_execute_depth;
-#endif
 }
 
 static void m68k_verify (uaecptr addr, uaecptr *nextpc)
@@ -1520,11 +2366,12 @@ static void m68k_verify (uaecptr addr, uaecptr *nextpc)
 	uae_u32 opcode, val;
 	struct instr *dp;
 
+	need_table68k ();
 	opcode = get_iword_1(0);
 	last_op_for_exception_3 = opcode;
 	m68kpc_offset = 2;
 
-	if (cpufunctbl[cft_map (opcode)] == op_illg_1) {
+	if (cpu_handler(cft_map (opcode)) == op_illg_1) {
 		opcode = 0x4AFC;
 	}
 	dp = table68k + opcode;
@@ -1546,6 +2393,7 @@ static void m68k_verify (uaecptr addr, uaecptr *nextpc)
 void m68k_disasm (uaecptr addr, uaecptr *nextpc, int cnt)
 {
 	uaecptr newpc = 0;
+	need_table68k ();
 	m68kpc_offset = addr - m68k_getpc ();
 	while (cnt-- > 0) {
 		char instrname[20],*ccpt;
@@ -1559,7 +2407,7 @@ void m68k_disasm (uaecptr addr, uaecptr *nextpc, int cnt)
 		}
 		opcode = get_iword_1 (m68kpc_offset);
 		m68kpc_offset += 2;
-		if (cpufunctbl[cft_map (opcode)] == op_illg_1) {
+		if (cpu_handler(cft_map (opcode)) == op_illg_1) {
 			opcode = 0x4AFC;
 		}
 		dp = table68k + opcode;
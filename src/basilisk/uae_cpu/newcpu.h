@@ -30,6 +30,7 @@
 #include "m68k.h"
 #include "readcpu.h"
 #include "spcflags.h"
+#include "trap_profile.h"
 
 #if ENABLE_MON
 #include "mon.h"
@@ -57,7 +58,49 @@ extern int broken_in;
 #endif
 
 #define cpuop_begin()		do { cpuop_tag("begin"); } while (0)
+
+#if USE_THREADED_DISPATCH
+/* Threaded dispatch: a handler that completes runs the handler of the next
+   instruction itself, as a tail call, while the budget m68k_do_execute()
+   set lasts. SPCFLAGS_SET() sets the budget's sign bit, so the one test
+   covers both the batch and the flags. Everywhere else (decode cache, trace
+   ring, nested calls) the budget is 0 and handlers return as before. */
+#define cpuop_end()			do { \
+	cpuop_tag("end"); \
+	if (regs.thread_budget > 1) { \
+		regs.thread_budget--; \
+		uae_u32 next_opcode = GET_OPCODE; \
+		(*cpu_handler(next_opcode))(next_opcode); \
+		return; \
+	} \
+} while (0)
+#else
 #define cpuop_end()			do { cpuop_tag("end"); } while (0)
+#endif
+/* Taken branches leave the handler early */
+#define cpuop_return()		do { cpuop_end(); return; } while (0)
+
+/* Handlers gencpu picked from a frequent.68k profile are placed in IRAM.
+   CPUOP_HOT_UNFUSED marks a plain handler whose fused variant is the one
+   installed when USE_SUPERINSNS is set */
+#if defined(ARDUINO) && IRAM_HOT_HANDLERS
+#include <esp_attr.h>
+#define CPUOP_HOT			IRAM_ATTR
+#else
+#define CPUOP_HOT
+#endif
+#if USE_SUPERINSNS
+#define CPUOP_HOT_UNFUSED
+#else
+#define CPUOP_HOT_UNFUSED	CPUOP_HOT
+#endif
+
+/* Handlers the profile never saw, see cpuop_cold.h */
+#if COMPACT_COLD_HANDLERS
+#define CPUOP_COLD			__attribute__((cold))
+#else
+#define CPUOP_COLD
+#endif
 
 typedef void REGPARAM2 cpuop_func (uae_u32) REGPARAM;
  
@@ -70,6 +113,22 @@ struct cputbl {
 // Note: cpufunctbl is dynamically allocated in PSRAM on ESP32
 extern cpuop_func **cpufunctbl;
 
+#if USE_COMPACT_DISPATCH
+// Two-level dispatch: a 16-bit handler index per opcode (128KB) plus a
+// table of the distinct handlers. cpufunctbl only exists while
+// build_cpufunctbl() runs.
+extern uae_u16 *cpufuncidx;
+extern cpuop_func **cpufuncptr;
+#define cpu_handler(opcode)	(cpufuncptr[cpufuncidx[opcode]])
+#else
+#define cpu_handler(opcode)	(cpufunctbl[opcode])
+#endif
+
+#if CPU_CHECK
+// gencpu's handlers without superinstructions (see cpu_check.cpp)
+extern cpuop_func **build_reference_functbl (void);
+#endif
+
 #if USE_JIT
 typedef void compop_func (uae_u32) REGPARAM;
 
@@ -87,6 +146,7 @@ typedef char flagtype;
 
 struct regstruct {
     uae_u32		regs[16];
+    uae_u16		sr;			/* Right after regs[], as in M68kRegisters (see m68k_emulop()) */
 
     uae_u32		pc;
     uae_u8 *	pc_p;
@@ -94,10 +154,12 @@ struct regstruct {
 
 	spcflags_t	spcflags;
     int			intmask;
+#if USE_THREADED_DISPATCH
+    uae_s32		thread_budget;	/* Handlers left to chain, see cpuop_end() */
+#endif
 
     uae_u32		vbr, sfc, dfc;
     uaecptr		usp, isp, msp;
-    uae_u16		sr;
     flagtype	t1;
     flagtype	t0;
     flagtype	s;
@@ -197,11 +259,18 @@ static __inline__ void m68k_setpc (uaecptr newpc)
 #if ENABLE_MON
 	uae_u32 previous_pc = m68k_getpc();
 #endif
+#if MEM_PROFILE && !REAL_ADDRESSING && !DIRECT_ADDRESSING
+	mem_profile_jump(m68k_getpc(), newpc);
+#endif
+#if TRAP_PROFILE
+	if (unlikely(newpc == trap_profile_ret))
+		trap_profile_return();
+#endif
 
 #if REAL_ADDRESSING || DIRECT_ADDRESSING
 	regs.pc_p = get_real_address(newpc);
 #else
-	regs.pc_p = regs.pc_oldp = get_real_address(newpc);
+	regs.pc_p = regs.pc_oldp = get_pc_real_address(newpc);
 	regs.pc = newpc;
 #endif
 
@@ -279,6 +348,61 @@ static __inline__ void m68k_do_jsr(uaecptr oldpc, uaecptr dest)
 		    m68k_setpc(dest);
 }
 
+#if USE_SUPERINSNS
+/*
+ *  Superinstruction tails, appended by gencpu to the "_fuse" handler
+ *  variants (see op_fusetbl_0). They run the instruction that follows
+ *  without another trip through the dispatch loop, and give up whenever
+ *  a special flag asks the loop to look at interrupts or tracing.
+ */
+#define FUSE_LOOP_BUDGET 16
+
+/* Compare/test followed by Bcc.B or Bcc.W (BRA, BSR and Bcc.L are left alone) */
+static __inline__ void m68k_fuse_bcc (void)
+{
+	uae_u32 next = get_iword (0);
+	if ((next & 0xf000) != 0x6000 || (next & 0x0e00) == 0 || regs.spcflags)
+		return;
+	uae_s32 disp = (uae_s8)next;
+	int len = 2;
+	if (disp == 0) {
+		disp = (uae_s16)get_iword (2);
+		len = 4;
+	} else if (disp == -1)
+		return;
+	if (cctrue_lazy ((next >> 8) & 15))
+		m68k_incpc (disp + 2);
+	else
+		m68k_incpc (len);
+}
+
+/* One-instruction loop body followed by a DBcc back to it. Returns
+   true when the body should run again, which also requires that the
+   body did not overwrite its own opcode */
+static __inline__ int m68k_fuse_dbcc (uae_u32 opcode, uae_u8 *start, int *budget)
+{
+	uae_u32 next = get_iword (0);
+	if ((next & 0xf0f8) != 0x50c8 || (uae_s32)(uae_s16)get_iword (2) != (uae_s32)(start - regs.pc_p) - 2)
+		return 0;
+	if (do_get_mem_word ((uae_u16 *)start) != opcode)
+		return 0;
+	if (regs.spcflags || --*budget == 0)
+		return 0;
+	if (cctrue_lazy ((next >> 8) & 15)) {
+		m68k_incpc (4);
+		return 0;
+	}
+	uae_s16 count = m68k_dreg (regs, next & 7);
+	m68k_dreg (regs, next & 7) = (m68k_dreg (regs, next & 7) & ~0xffff) | ((count - 1) & 0xffff);
+	if (count == 0) {
+		m68k_incpc (4);
+		return 0;
+	}
+	m68k_incpc (start - regs.pc_p);
+	return 1;
+}
+#endif
+
 static __inline__ void m68k_setstopped (int stop)
 {
     regs.stopped = stop;
@@ -288,13 +412,28 @@ static __inline__ void m68k_setstopped (int stop)
     SPCFLAGS_SET( SPCFLAG_STOP );
 }
 
-extern uae_u32 get_disp_ea_020 (uae_u32 base, uae_u32 dp);
+extern uae_u32 get_disp_ea_020_full (uae_u32 base, uae_u32 dp);
+
+/* 68020 (d8,An,Xn*scale) and (d8,PC,Xn*scale): the brief extension format
+   is nearly every indexed access of compiled code, so it is computed inline
+   in the handlers. The full format (bit 8: base and outer displacements,
+   memory indirection) fetches more extension words and stays out of line. */
+static __inline__ uae_u32 get_disp_ea_020 (uae_u32 base, uae_u32 dp)
+{
+    if (__builtin_expect (dp & 0x100, 0))
+	return get_disp_ea_020_full (base, dp);
+    uae_s32 regd = regs.regs[(dp >> 12) & 15];
+    if ((dp & 0x800) == 0)
+	regd = (uae_s32)(uae_s16)regd;
+    return base + (uae_s32)(uae_s8)dp + (regd << ((dp >> 9) & 3));
+}
 extern uae_u32 get_disp_ea_000 (uae_u32 base, uae_u32 dp);
 
 extern uae_s32 ShowEA (int reg, amodes mode, wordsizes size, char *buf);
 
 extern void MakeSR (void);
 extern void MakeFromSR (void);
+extern int m68k_execute_depth;
 extern void Exception (int, uaecptr);
 extern void dump_counts (void);
 extern int m68k_move2c (int, uae_u32 *);
@@ -320,6 +459,25 @@ extern uaecptr last_addr_for_exception_3;
 /* Address that generated the exception */
 extern uaecptr last_fault_for_exception_3;
 
+/* Exceptions the handlers raise on rare paths (privilege violation, divide
+   by zero, CHK, TRAPV/TRAPcc, format error, odd address), with the address
+   error state set in one call. Cold and out of line, GCC lays the branches
+   to them out of the handlers' hot bodies and keeps the calls apart in
+   .text.unlikely */
+#if COLD_EXCEPTION_PATHS
+extern void op_exception(int nr, uaecptr oldpc) __attribute__((cold, noinline));
+extern void op_address_error(uae_u32 opcode, uaecptr fault, uaecptr addr) __attribute__((cold, noinline));
+#else
+#define op_exception(nr, oldpc)		Exception(nr, oldpc)
+static inline void op_address_error(uae_u32 opcode, uaecptr fault, uaecptr addr)
+{
+	last_op_for_exception_3 = opcode;
+	last_fault_for_exception_3 = fault;
+	last_addr_for_exception_3 = addr;
+	Exception(3, 0);
+}
+#endif
+
 #define CPU_OP_NAME(a) op ## a
 
 /* 68020 + 68881 */
@@ -332,6 +490,21 @@ extern struct cputbl op_smalltbl_2_ff[];
 extern struct cputbl op_smalltbl_3_ff[];
 /* 68000 slow but compatible.  */
 extern struct cputbl op_smalltbl_4_ff[];
+#if USE_SUPERINSNS
+/* Fused variants of op_smalltbl_0 handlers */
+extern struct cputbl op_fusetbl_0_ff[];
+#endif
+
+#if USE_CONST_DISPATCH
+/* Compact dispatch of each op_smalltbl, precomputed by gencpu */
+struct cpudispatch {
+    cpuop_func *const *handlers;	/* Distinct handlers, op_illg_1 first */
+    const uae_u16 *index;			/* Handler of each opcode */
+    int count;
+};
+extern const struct cpudispatch op_dispatch_ff[];
+extern cpuop_func op_illg_1;
+#endif
 
 #if FLIGHT_RECORDER
 extern void m68k_record_step(uaecptr) REGPARAM;
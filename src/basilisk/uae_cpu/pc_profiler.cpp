@@ -0,0 +1,173 @@
+/*
+ *  pc_profiler.cpp - Statistical 68k PC sampling profiler
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  An esp_timer callback (dispatched by the timer task on Core 0) samples
+ *  the PC of the CPU running on Core 1 and the last A-line trap it went
+ *  through. Samples are binned into PSRAM histograms: ROM by offset (so hot
+ *  spots can be looked up in a ROM map), RAM by block, and traps by number.
+ *  The PC is read without synchronisation; a sample taken in the middle of
+ *  a jump may be off, which is noise at these sample counts.
+ */
+
+#include "sysdeps.h"
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#endif
+
+#include "cpu_emulation.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "pc_profiler.h"
+
+#if PC_PROFILER
+
+#define PROF_SAMPLE_US		250		// 4kHz
+#define PROF_ROM_SHIFT		4		// 16 byte ROM bins
+#define PROF_RAM_SHIFT		8		// 256 byte RAM bins
+#define PROF_TRAPS			0x1000	// A-line trap numbers
+#define PROF_TOP			20		// Entries printed per histogram
+
+volatile uae_u16 pc_profiler_trap = 0;
+
+static uae_u32 *prof_rom = NULL;
+static uae_u32 *prof_ram = NULL;
+static uae_u32 *prof_trap = NULL;
+static uae_u32 prof_rom_bins, prof_ram_bins;
+static volatile uae_u32 prof_samples = 0;
+static volatile uae_u32 prof_other = 0;		// Frame buffer, hardware, torn reads
+
+#ifdef ARDUINO
+static esp_timer_handle_t prof_timer = NULL;
+#endif
+
+static void prof_sample(void *arg)
+{
+	uaecptr pc = m68k_getpc();
+	prof_samples++;
+	if (pc - ROMBaseMac < ROMSize)
+		prof_rom[(pc - ROMBaseMac) >> PROF_ROM_SHIFT]++;
+	else if (pc < RAMSize)
+		prof_ram[pc >> PROF_RAM_SHIFT]++;
+	else
+		prof_other++;
+	prof_trap[pc_profiler_trap & (PROF_TRAPS - 1)]++;
+}
+
+bool pc_profiler_init(void)
+{
+	prof_rom_bins = (ROMSize >> PROF_ROM_SHIFT) + 1;
+	prof_ram_bins = (RAMSize >> PROF_RAM_SHIFT) + 1;
+#ifdef ARDUINO
+	prof_rom = (uae_u32 *)heap_caps_calloc(prof_rom_bins, sizeof(uae_u32), MALLOC_CAP_SPIRAM);
+	prof_ram = (uae_u32 *)heap_caps_calloc(prof_ram_bins, sizeof(uae_u32), MALLOC_CAP_SPIRAM);
+	prof_trap = (uae_u32 *)heap_caps_calloc(PROF_TRAPS, sizeof(uae_u32), MALLOC_CAP_SPIRAM);
+#else
+	prof_rom = (uae_u32 *)calloc(prof_rom_bins, sizeof(uae_u32));
+	prof_ram = (uae_u32 *)calloc(prof_ram_bins, sizeof(uae_u32));
+	prof_trap = (uae_u32 *)calloc(PROF_TRAPS, sizeof(uae_u32));
+#endif
+	if (prof_rom == NULL || prof_ram == NULL || prof_trap == NULL) {
+		write_log("[PROF] Cannot allocate histograms\n");
+		pc_profiler_exit();
+		return false;
+	}
+
+#ifdef ARDUINO
+	esp_timer_create_args_t args = {};
+	args.callback = prof_sample;
+	args.dispatch_method = ESP_TIMER_TASK;
+	args.name = "pc_profiler";
+	args.skip_unhandled_events = true;
+	if (esp_timer_create(&args, &prof_timer) != ESP_OK || esp_timer_start_periodic(prof_timer, PROF_SAMPLE_US) != ESP_OK) {
+		write_log("[PROF] Cannot start sample timer\n");
+		pc_profiler_exit();
+		return false;
+	}
+#endif
+	write_log("[PROF] Sampling PC every %dus (%d KB histograms in PSRAM), send 'p' to dump, 'r' to reset\n",
+			  PROF_SAMPLE_US, (int)((prof_rom_bins + prof_ram_bins + PROF_TRAPS) * sizeof(uae_u32) / 1024));
+	return true;
+}
+
+void pc_profiler_exit(void)
+{
+#ifdef ARDUINO
+	if (prof_timer) {
+		esp_timer_stop(prof_timer);
+		esp_timer_delete(prof_timer);
+		prof_timer = NULL;
+	}
+#endif
+	free(prof_rom);
+	free(prof_ram);
+	free(prof_trap);
+	prof_rom = prof_ram = prof_trap = NULL;
+}
+
+void pc_profiler_reset(void)
+{
+	if (prof_rom == NULL)
+		return;
+	memset(prof_rom, 0, prof_rom_bins * sizeof(uae_u32));
+	memset(prof_ram, 0, prof_ram_bins * sizeof(uae_u32));
+	memset(prof_trap, 0, PROF_TRAPS * sizeof(uae_u32));
+	prof_samples = prof_other = 0;
+	write_log("[PROF] Histograms cleared\n");
+}
+
+/*
+ *  Print the PROF_TOP largest bins of a histogram
+ */
+static void dump_top(const char *what, const uae_u32 *hist, uae_u32 bins, uae_u32 base, int shift, uae_u32 total)
+{
+	uae_u32 top_bin[PROF_TOP], top_count[PROF_TOP];
+	int n = 0;
+	for (uae_u32 i = 0; i < bins; i++) {
+		uae_u32 c = hist[i];
+		if (c == 0 || (n == PROF_TOP && c <= top_count[n - 1]))
+			continue;
+		int j = (n < PROF_TOP) ? n++ : n - 1;
+		while (j > 0 && top_count[j - 1] < c) {
+			top_bin[j] = top_bin[j - 1];
+			top_count[j] = top_count[j - 1];
+			j--;
+		}
+		top_bin[j] = i;
+		top_count[j] = c;
+	}
+	for (int i = 0; i < n; i++)
+		write_log("[PROF] %s %08x %8u %5.1f%%\n", what, base + (top_bin[i] << shift), top_count[i],
+				  top_count[i] * 100.0 / total);
+}
+
+void pc_profiler_dump(void)
+{
+	if (prof_rom == NULL)
+		return;
+	uae_u32 total = prof_samples;
+	if (total == 0) {
+		write_log("[PROF] No samples\n");
+		return;
+	}
+	uae_u32 rom = 0, ram = 0;
+	for (uae_u32 i = 0; i < prof_rom_bins; i++)
+		rom += prof_rom[i];
+	for (uae_u32 i = 0; i < prof_ram_bins; i++)
+		ram += prof_ram[i];
+	write_log("[PROF] %u samples: ROM %.1f%%, RAM %.1f%%, other %.1f%%\n", total,
+			  rom * 100.0 / total, ram * 100.0 / total, prof_other * 100.0 / total);
+	write_log("[PROF] Hottest ROM offsets (%d byte bins):\n", 1 << PROF_ROM_SHIFT);
+	dump_top("rom+", prof_rom, prof_rom_bins, 0, PROF_ROM_SHIFT, total);
+	write_log("[PROF] Hottest RAM blocks (%d byte bins):\n", 1 << PROF_RAM_SHIFT);
+	dump_top("ram ", prof_ram, prof_ram_bins, 0, PROF_RAM_SHIFT, total);
+	write_log("[PROF] Last A-line trap at sample time:\n");
+	dump_top("trap", prof_trap, PROF_TRAPS, 0xa000, 0, total);
+}
+
+#endif /* PC_PROFILER */
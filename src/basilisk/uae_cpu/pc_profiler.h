@@ -0,0 +1,24 @@
+/*
+ *  pc_profiler.h - Statistical 68k PC sampling profiler
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef PC_PROFILER_H
+#define PC_PROFILER_H
+
+#if PC_PROFILER
+
+// Last A-line trap dispatched by op_illg(), attributed to every sample
+extern volatile uae_u16 pc_profiler_trap;
+
+extern bool pc_profiler_init(void);
+extern void pc_profiler_exit(void);
+
+// Print the hottest ROM offsets, RAM blocks and traps, or clear the histograms
+extern void pc_profiler_dump(void);
+extern void pc_profiler_reset(void);
+
+#endif
+
+#endif /* PC_PROFILER_H */
@@ -27,6 +27,7 @@
 
 #include "sysdeps.h"
 #include "readcpu.h"
+#include "sram_plan.h"
 
 #ifdef ARDUINO
 #include <esp_heap_caps.h>
@@ -815,17 +816,15 @@ static void build_insn (int insn)
 }
 
 
+// Read when the handler tables are built and by the disassembler; listed
+// in the SRAM plan, never worth SRAM
+static sram_slot *const table68k_sram = SramSlot("table68k", 65536 * sizeof (struct instr), 0, 0);
+
 void read_table68k (void)
 {
     int i;
 
-#ifdef ARDUINO
-    // Allocate in PSRAM on ESP32 (~1.5MB)
-    table68k = (struct instr *)heap_caps_malloc (65536 * sizeof (struct instr), MALLOC_CAP_SPIRAM);
-    write_log("Allocated table68k (%d bytes) in PSRAM\n", 65536 * sizeof(struct instr));
-#else
-    table68k = (struct instr *)malloc (65536 * sizeof (struct instr));
-#endif
+    table68k = (struct instr *)SramAlloc (table68k_sram, 65536 * sizeof (struct instr));
     for (i = 0; i < 65536; i++) {
 	table68k[i].mnemo = i_ILLG;
 	table68k[i].handler = -1;
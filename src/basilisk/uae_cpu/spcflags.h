@@ -53,40 +53,48 @@ enum {
 	SPCFLAG_ALL_BUT_EXEC_RETURN	= SPCFLAG_ALL & ~SPCFLAG_JIT_EXEC_RETURN
 };
 
-#if defined(ARDUINO_ARCH_ESP32) || defined(ESP32)
-/* Atomic read for ESP32 dual-core safety */
-#define SPCFLAGS_TEST(m) \
-	((__atomic_load_n(&regs.spcflags, __ATOMIC_SEQ_CST) & (m)) != 0)
-#else
 #define SPCFLAGS_TEST(m) \
 	((regs.spcflags & (m)) != 0)
+
+#if USE_THREADED_DISPATCH
+/* Any flag ends a threaded dispatch chain at the next handler end; the
+   count of handlers run stays in the low bits (see cpuop_end() in newcpu.h) */
+#define THREAD_BUDGET_STOP		((uae_s32)(-0x7fffffff - 1))
+#define SPCFLAGS_STOP_THREAD()	(regs.thread_budget |= THREAD_BUDGET_STOP)
+#else
+#define SPCFLAGS_STOP_THREAD()	((void)0)
 #endif
 
-/* Macro only used in m68k_reset() */
+/* Macro only used in m68k_reset() and CPUStateIO() */
 #define SPCFLAGS_INIT(m) do { \
 	regs.spcflags = (m); \
+	SPCFLAGS_STOP_THREAD(); \
 } while (0)
 
 #if defined(ARDUINO_ARCH_ESP32) || defined(ESP32)
 
 /*
- * ESP32 dual-core atomic operations using GCC builtins
- * Required for thread-safety when 60Hz timer runs on different core than CPU emulation
+ * On ESP32 regs.spcflags is only ever written by the CPU task, so no locking
+ * or atomics are needed. Other tasks and the other core post interrupt
+ * requests through InterruptFlags instead (SetInterruptFlag() with release
+ * ordering), which m68k_do_execute() picks up once per batch.
  */
 #define HAVE_HARDWARE_LOCKS
 
 #define SPCFLAGS_SET(m) do { \
-	__atomic_or_fetch(&regs.spcflags, (m), __ATOMIC_SEQ_CST); \
+	regs.spcflags |= (m); \
+	SPCFLAGS_STOP_THREAD(); \
 } while (0)
 
 #define SPCFLAGS_CLEAR(m) do { \
-	__atomic_and_fetch(&regs.spcflags, ~(m), __ATOMIC_SEQ_CST); \
+	regs.spcflags &= ~(m); \
 } while (0)
 
 #elif !(ENABLE_EXCLUSIVE_SPCFLAGS)
 
 #define SPCFLAGS_SET(m) do { \
 	regs.spcflags |= (m); \
+	SPCFLAGS_STOP_THREAD(); \
 } while (0)
 
 #define SPCFLAGS_CLEAR(m) do { \
@@ -99,6 +107,7 @@ enum {
 
 #define SPCFLAGS_SET(m) do { \
 	__asm__ __volatile__("lock\n\torl %1,%0" : "=m" (regs.spcflags) : "i" ((m))); \
+	SPCFLAGS_STOP_THREAD(); \
 } while (0)
 
 #define SPCFLAGS_CLEAR(m) do { \
@@ -115,6 +124,7 @@ extern B2_mutex *spcflags_lock;
 #define SPCFLAGS_SET(m) do { 				\
 	B2_lock_mutex(spcflags_lock);			\
 	regs.spcflags |= (m);					\
+	SPCFLAGS_STOP_THREAD();					\
 	B2_unlock_mutex(spcflags_lock);		\
 } while (0)
 
@@ -0,0 +1,203 @@
+/*
+ *  trace_ring.cpp - PSRAM flight recorder for 68k execution traces
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Unlike FLIGHT_RECORDER, which is a compile-time option that records every
+ *  instruction of every build, this recorder is always compiled in and armed
+ *  at runtime. m68k_do_execute() tests trace_ring_level once per batch; while
+ *  it is zero the normal (decode cache) path runs and the recorder costs one
+ *  load per batch. While armed, batches go through trace_ring_execute(), the
+ *  plain interpreter loop with a record written per instruction.
+ *
+ *  The ring holds fixed 8-byte records, so the oldest complete record is
+ *  always found at head & mask:
+ *    step:  pc = instruction address (even), data = sr << 16 | opcode
+ *    delta: pc = 1 | reg << 1 (0-7 = d0-d7, 8-15 = a0-a7), data = new value
+ *  Delta records follow the step of the instruction that wrote the register.
+ *  Every TRACE_SNAPSHOT_STEPS instructions all registers are emitted, so a
+ *  wrapped ring still starts with known register contents within that window.
+ *  Superinstructions of the fused handlers are recorded as one step.
+ */
+
+#include "sysdeps.h"
+
+#include <stdio.h>
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#endif
+
+#include "cpu_emulation.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "trace_ring.h"
+
+#if TRACE_RING
+
+#ifndef TRACE_RING_ENTRIES
+#define TRACE_RING_ENTRIES		(1 << 16)	// 512 KB of PSRAM
+#endif
+#define TRACE_RING_MASK			(TRACE_RING_ENTRIES - 1)
+#define TRACE_SNAPSHOT_STEPS	4096
+
+#ifdef ARDUINO
+#define TRACE_FILE "/sd/trace.68k"
+#else
+#define TRACE_FILE "trace.68k"
+#endif
+
+struct trace_rec {
+	uae_u32 pc;
+	uae_u32 data;
+};
+
+volatile int trace_ring_level = 0;
+
+static trace_rec *ring = NULL;
+static uae_u32 ring_head = 0;			// Total records written
+static uae_u32 shadow[16];				// Register values as last recorded
+static int snapshot_countdown = 0;
+static volatile bool flush_pending = false;
+
+static inline void record(uae_u32 pc, uae_u32 data)
+{
+	trace_rec *r = &ring[ring_head++ & TRACE_RING_MASK];
+	r->pc = pc;
+	r->data = data;
+}
+
+static inline void record_deltas(void)
+{
+	if (--snapshot_countdown <= 0) {
+		snapshot_countdown = TRACE_SNAPSHOT_STEPS;
+		for (int i = 0; i < 16; i++) {
+			shadow[i] = regs.regs[i];
+			record(1 | (i << 1), shadow[i]);
+		}
+		return;
+	}
+	for (int i = 0; i < 16; i++) {
+		if (regs.regs[i] != shadow[i]) {
+			shadow[i] = regs.regs[i];
+			record(1 | (i << 1), shadow[i]);
+		}
+	}
+}
+
+int trace_ring_execute(int count)
+{
+	int level = trace_ring_level;
+	int n = 0;
+	do {
+		uae_u32 opcode = GET_OPCODE;
+		if (level >= 2) {
+			MakeSR();
+			record(m68k_getpc(), (regs.sr << 16) | opcode);
+		} else
+			record(m68k_getpc(), opcode);
+		(*cpu_handler(opcode))(opcode);
+		if (level >= 2)
+			record_deltas();
+		n++;
+	} while (n < count && !SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN));
+	return n;
+}
+
+void trace_ring_arm(int level)
+{
+	if (level > 0 && ring == NULL) {
+#ifdef ARDUINO
+		ring = (trace_rec *)heap_caps_malloc(TRACE_RING_ENTRIES * sizeof(trace_rec), MALLOC_CAP_SPIRAM);
+#else
+		ring = (trace_rec *)malloc(TRACE_RING_ENTRIES * sizeof(trace_rec));
+#endif
+		if (ring == NULL) {
+			write_log("[TRACE] Cannot allocate %d KB trace ring\n", (int)(TRACE_RING_ENTRIES * sizeof(trace_rec) / 1024));
+			return;
+		}
+		ring_head = 0;
+	}
+	snapshot_countdown = 0;
+	trace_ring_level = level;
+	if (level > 0)
+		write_log("[TRACE] Recording %s into %d entry ring\n", level >= 2 ? "PC and registers" : "PC", TRACE_RING_ENTRIES);
+	else
+		write_log("[TRACE] Recording stopped\n");
+}
+
+static const char *reg_name(int reg)
+{
+	static const char *names[16] = {
+		"d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7",
+		"a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7"
+	};
+	return names[reg & 15];
+}
+
+void trace_ring_flush(void)
+{
+	if (ring == NULL || ring_head == 0) {
+		write_log("[TRACE] Nothing recorded\n");
+		return;
+	}
+
+	// Keep the CPU from overwriting the records while they are written out
+	int level = trace_ring_level;
+	trace_ring_level = 0;
+
+	FILE *f = fopen(TRACE_FILE, "w");
+	if (f == NULL) {
+		write_log("[TRACE] Cannot open %s\n", TRACE_FILE);
+		trace_ring_level = level;
+		return;
+	}
+	uae_u32 count = ring_head < TRACE_RING_ENTRIES ? ring_head : TRACE_RING_ENTRIES;
+	uae_u32 first = ring_head - count;
+	uae_u32 steps = 0;
+	bool in_step = false;
+	fprintf(f, "# %u records, oldest first\n", count);
+	for (uae_u32 i = first; i != ring_head; i++) {
+		const trace_rec *r = &ring[i & TRACE_RING_MASK];
+		if (r->pc & 1) {
+			if (in_step)		// Orphaned deltas of an overwritten step are dropped
+				fprintf(f, " %s=%08x", reg_name(r->pc >> 1), r->data);
+			continue;
+		}
+		if (in_step)
+			fputc('\n', f);
+		if (r->data >> 16)
+			fprintf(f, "%08x %04x sr=%04x", r->pc, r->data & 0xffff, r->data >> 16);
+		else
+			fprintf(f, "%08x %04x", r->pc, r->data & 0xffff);
+		in_step = true;
+		steps++;
+	}
+	if (in_step)
+		fputc('\n', f);
+	fclose(f);
+	write_log("[TRACE] Wrote %u instructions to %s\n", steps, TRACE_FILE);
+
+	trace_ring_level = level;
+}
+
+void trace_ring_freeze(void)
+{
+	if (trace_ring_level == 0)
+		return;
+	trace_ring_level = 0;
+	flush_pending = true;
+}
+
+void trace_ring_service(void)
+{
+	if (flush_pending) {
+		flush_pending = false;
+		write_log("[TRACE] SysError, recording stopped\n");
+		trace_ring_flush();
+	}
+}
+
+#endif /* TRACE_RING */
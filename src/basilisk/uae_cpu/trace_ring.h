@@ -0,0 +1,33 @@
+/*
+ *  trace_ring.h - PSRAM flight recorder for 68k execution traces
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef TRACE_RING_H
+#define TRACE_RING_H
+
+#if TRACE_RING
+
+// Recording level, sampled by m68k_do_execute() once per batch:
+// 0 = off, 1 = PC/opcode, 2 = PC/opcode/SR plus changed registers
+extern volatile int trace_ring_level;
+
+// Execute up to count instructions, recording each one; returns the number run
+extern int trace_ring_execute(int count);
+
+// Start recording at the given level (allocates the ring on first use), 0 stops
+extern void trace_ring_arm(int level);
+
+// Write the ring to the SD card, oldest record first
+extern void trace_ring_flush(void);
+
+// Stop recording and flush from the main loop (called when Mac OS calls SysError())
+extern void trace_ring_freeze(void);
+
+// Carry out a flush requested by trace_ring_freeze() (called from the main loop)
+extern void trace_ring_service(void);
+
+#endif
+
+#endif /* TRACE_RING_H */
@@ -0,0 +1,209 @@
+/*
+ *  trap_profile.cpp - A-line trap calls, instructions and time
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Most of the Mac's time goes into Toolbox and OS traps. op_illg() opens
+ *  an entry for each A-line trap it dispatches, with the return address
+ *  (the instruction after the trap), the stack pointer, the instruction
+ *  count and the time. Both trap dispatchers of the ROM come back to the
+ *  return address, the Toolbox one through the routine's RTS or JMP (A0),
+ *  the OS one through RTE, so m68k_setpc() closes the innermost entry when
+ *  the PC gets there with the stack no deeper than at the call. The
+ *  counts are inclusive: a trap that calls other traps counts their
+ *  instructions and time as well.
+ *
+ *  A trap that never comes back to its return address (an autopop trap, a
+ *  longjmp out of a Mac OS call) is dropped at the next trap entered with
+ *  the stack above its own. Traps nested deeper than TRAP_DEPTH are
+ *  counted but not timed.
+ *
+ *  The instructions are counted one by one in m68k_do_execute(), so this
+ *  build runs without the decode cache and its times are those of the
+ *  plain interpreter; compare traps with each other, not with a normal
+ *  build. The console's "traps [n]" prints the top n by time.
+ */
+
+#include "sysdeps.h"
+
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#else
+#include <time.h>
+#endif
+
+#include "cpu_emulation.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "trap_profile.h"
+
+#if TRAP_PROFILE
+
+#define TRAP_NUMBERS		0x1000		// Trap numbers, the low 12 bits of the opcode
+#define TRAP_DEPTH			32			// Open traps tracked
+#define TRAP_SP_SLACK		8			// The return jump may run before its stack is popped
+#define TRAP_TOP_MAX		64			// Largest top list printed
+
+struct trap_stat {
+	uae_u32 calls;
+	uae_u32 insns;
+	uae_u64 us;
+};
+
+struct trap_frame {
+	uae_u16 trap;
+	uaecptr ret;
+	uaecptr sp;
+	uae_u32 insns;
+	uae_u64 start;
+};
+
+uaecptr trap_profile_ret = 1;
+uae_u32 trap_profile_insns = 0;
+
+static trap_stat *trap_stats = NULL;		// PSRAM, TRAP_NUMBERS entries
+static trap_frame trap_stack[TRAP_DEPTH];
+static int trap_depth = 0;
+static uae_u32 trap_lost = 0;				// Entries dropped, never returned
+static uae_u32 trap_untimed = 0;			// Calls deeper than TRAP_DEPTH
+static volatile bool trap_clear = false;
+static uae_u64 trap_since = 0;				// Start of the counts
+
+static uae_u64 trap_now_us(void)
+{
+#ifdef ARDUINO
+	return esp_timer_get_time();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uae_u64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+bool trap_profile_init(void)
+{
+#ifdef ARDUINO
+	trap_stats = (trap_stat *)heap_caps_calloc(TRAP_NUMBERS, sizeof(trap_stat), MALLOC_CAP_SPIRAM);
+#else
+	trap_stats = (trap_stat *)calloc(TRAP_NUMBERS, sizeof(trap_stat));
+#endif
+	if (trap_stats == NULL) {
+		write_log("[TRAPS] Cannot allocate the trap table\n");
+		return false;
+	}
+	trap_since = trap_now_us();
+	write_log("[TRAPS] Counting A-line traps (%d KB in PSRAM), 'traps' on the console prints them\n",
+			  (int)(TRAP_NUMBERS * sizeof(trap_stat) / 1024));
+	return true;
+}
+
+void trap_profile_exit(void)
+{
+	trap_profile_ret = 1;
+	trap_depth = 0;
+	free(trap_stats);
+	trap_stats = NULL;
+}
+
+void trap_profile_enter(uae_u16 opcode, uaecptr pc)
+{
+	if (trap_stats == NULL)
+		return;
+	if (trap_clear) {
+		memset(trap_stats, 0, TRAP_NUMBERS * sizeof(trap_stat));
+		trap_depth = 0;
+		trap_lost = trap_untimed = 0;
+		trap_since = trap_now_us();
+		trap_clear = false;
+	}
+
+	// Open traps whose caller's stack is gone never came back
+	uaecptr sp = m68k_areg(regs, 7);
+	while (trap_depth > 0 && sp > trap_stack[trap_depth - 1].sp) {
+		trap_depth--;
+		trap_lost++;
+	}
+
+	trap_stats[opcode & (TRAP_NUMBERS - 1)].calls++;
+	if (trap_depth == TRAP_DEPTH) {
+		trap_untimed++;
+		return;
+	}
+	trap_frame *f = &trap_stack[trap_depth++];
+	f->trap = opcode;
+	f->ret = pc + 2;
+	f->sp = sp;
+	f->insns = trap_profile_insns;
+	f->start = trap_now_us();
+	trap_profile_ret = f->ret;
+}
+
+void trap_profile_return(void)
+{
+	if (trap_depth == 0)
+		return;
+	trap_frame *f = &trap_stack[trap_depth - 1];
+
+	// The same return address further down a recursion
+	if (m68k_areg(regs, 7) + TRAP_SP_SLACK < f->sp)
+		return;
+
+	trap_stat *s = &trap_stats[f->trap & (TRAP_NUMBERS - 1)];
+	s->insns += trap_profile_insns - f->insns;
+	s->us += trap_now_us() - f->start;
+	trap_depth--;
+	trap_profile_ret = trap_depth ? trap_stack[trap_depth - 1].ret : 1;
+}
+
+void trap_profile_reset(void)
+{
+	trap_clear = true;
+}
+
+/*
+ *  Print the top traps by time; read while the CPU task runs, so a count
+ *  may be one call behind
+ */
+void trap_profile_dump(int top)
+{
+	if (trap_stats == NULL)
+		return;
+	if (top <= 0 || top > TRAP_TOP_MAX)
+		top = TRAP_TOP_MAX;
+
+	int top_trap[TRAP_TOP_MAX];
+	uae_u64 top_us[TRAP_TOP_MAX];
+	uae_u64 run_us = trap_now_us() - trap_since;
+	uae_u32 total_calls = 0;
+	int n = 0;
+	for (int i = 0; i < TRAP_NUMBERS; i++) {
+		uae_u64 us = trap_stats[i].us;
+		total_calls += trap_stats[i].calls;
+		if (trap_stats[i].calls == 0 || (n == top && us <= top_us[n - 1]))
+			continue;
+		int j = (n < top) ? n++ : n - 1;
+		while (j > 0 && top_us[j - 1] < us) {
+			top_trap[j] = top_trap[j - 1];
+			top_us[j] = top_us[j - 1];
+			j--;
+		}
+		top_trap[j] = i;
+		top_us[j] = us;
+	}
+
+	write_log("[TRAPS] %u calls in %.1f s, lost %u, untimed %u; nested traps counted in their callers\n",
+			  total_calls, run_us / 1e6, trap_lost, trap_untimed);
+	write_log("[TRAPS] trap       calls      insns  insns/call         us   us/call   time\n");
+	for (int i = 0; i < n; i++) {
+		const trap_stat &s = trap_stats[top_trap[i]];
+		uae_u32 calls = s.calls ? s.calls : 1;
+		write_log("[TRAPS] a%03x %10u %10u %11u %10llu %9.1f %5.1f%%\n", top_trap[i], s.calls, s.insns,
+				  s.insns / calls, (unsigned long long)top_us[i], (double)top_us[i] / calls,
+				  run_us ? top_us[i] * 100.0 / run_us : 0.0);
+	}
+}
+
+#endif /* TRAP_PROFILE */
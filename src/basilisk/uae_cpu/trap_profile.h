@@ -0,0 +1,33 @@
+/*
+ *  trap_profile.h - A-line trap calls, instructions and time
+ *
+ *  BasiliskII ESP32 Port
+ */
+
+#ifndef TRAP_PROFILE_H
+#define TRAP_PROFILE_H
+
+#if TRAP_PROFILE
+
+// Return PC of the innermost open trap, 1 if none (checked by m68k_setpc())
+extern uaecptr trap_profile_ret;
+
+// Instructions executed, counted by m68k_do_execute()
+extern uae_u32 trap_profile_insns;
+
+extern bool trap_profile_init(void);
+extern void trap_profile_exit(void);
+
+// CPU task: A-line opcode at pc dispatched by op_illg(), PC back at the
+// return address of the innermost open trap
+extern void trap_profile_enter(uae_u16 opcode, uaecptr pc);
+extern void trap_profile_return(void);
+
+// Any task: print the top traps by time, or have the CPU task clear the
+// counts at the next trap
+extern void trap_profile_dump(int top);
+extern void trap_profile_reset(void);
+
+#endif
+
+#endif /* TRAP_PROFILE_H */
@@ -0,0 +1,239 @@
+/*
+ *  usb_msc_esp32.cpp - Disk images on a USB flash drive or SSD
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  All disk images used to come from the SD card. The Tab5's USB host port
+ *  is a high-speed port, so a USB SSD or flash drive can outrun the SD bus
+ *  for large applications and CD images, and keeps disk traffic off the
+ *  boot card. A disk or cdrom pref starting with /usb/ names an image on
+ *  the first FAT partition of a USB drive, e.g. "disk /usb/System.dsk".
+ *
+ *  The IDF's usb_host_msc driver mounts the drive at USB_MOUNT_POINT
+ *  through FatFs, so Sys_open() gets a VFS file descriptor as it does on
+ *  the card, and the block cache, the flush task and the disk I/O task
+ *  work unchanged. The driver is started only when a pref names a USB
+ *  image. The disks are opened before the input task starts EspUsbHost,
+ *  so this module installs the USB host library itself and handles its
+ *  events on Core 0; EspUsbHost then registers its HID client with the
+ *  library already installed. The drive enumerates while the boot goes on,
+ *  and the first USB image opened waits for it (USB_MSC_WAIT_MS at most).
+ *
+ *  A drive pulled while the Mac runs is unmounted, and reads and writes of
+ *  its images fail from then on.
+ */
+
+#include "sysdeps.h"
+#include "prefs.h"
+#include "perf_registry.h"
+#include "usb_msc.h"
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/event_groups.h"
+
+#if USB_MSC_HOST
+
+#if __has_include(<usb/msc_host_vfs.h>)
+#include <usb/usb_host.h>
+#include <usb/msc_host.h>
+#include <usb/msc_host_vfs.h>
+#include <esp_vfs_fat.h>
+#define HAVE_MSC_DRIVER 1
+#else
+#define HAVE_MSC_DRIVER 0
+#endif
+
+#define USB_MSC_WAIT_MS         3000    // First USB image opened waits this long for the drive
+#define USB_MSC_MAX_FILES       8
+#define USB_TASK_STACK_SIZE     4096
+#define USB_TASK_PRIORITY       5       // The host library's events are short and latency bound
+#define USB_MSC_TASK_PRIORITY   2       // Same as the disk I/O task
+#define USB_TASK_CORE           0
+
+#define MSC_MOUNTED     (1 << 0)
+
+static EventGroupHandle_t msc_events = NULL;    // NULL: driver not started
+static bool wait_expired = false;               // Set by the CPU task
+
+#if HAVE_MSC_DRIVER
+static perf_counter *const perf_mounts = PerfCounter("usb.mounts", PERF_COUNT, PERF_CORE_IO);
+
+static QueueHandle_t msc_queue = NULL;          // msc_host_event_t from the driver's task
+static msc_host_device_handle_t msc_device = NULL;
+static msc_host_vfs_handle_t msc_vfs = NULL;
+
+
+/*
+ *  USB host library events (only when this module installed the library)
+ */
+
+static void usbHostTask(void *param)
+{
+    UNUSED(param);
+    for (;;) {
+        uint32_t flags;
+        usb_host_lib_handle_events(portMAX_DELAY, &flags);
+    }
+}
+
+
+/*
+ *  Mass storage driver events: the driver's callback only queues them, the
+ *  mount and unmount run on this task
+ */
+
+static void msc_event(const msc_host_event_t *event, void *arg)
+{
+    UNUSED(arg);
+    xQueueSend(msc_queue, event, 0);
+}
+
+static void mount(uint8_t address)
+{
+    if (msc_device != NULL) {
+        Serial.printf("[USB] Drive at address %d ignored, one drive at a time\n", address);
+        return;
+    }
+    esp_err_t err = msc_host_install_device(address, &msc_device);
+    if (err == ESP_OK) {
+        esp_vfs_fat_mount_config_t config = {};
+        config.format_if_mount_failed = false;
+        config.max_files = USB_MSC_MAX_FILES;
+        err = msc_host_vfs_register(msc_device, USB_MOUNT_POINT, &config, &msc_vfs);
+        if (err != ESP_OK) {
+            msc_host_uninstall_device(msc_device);
+            msc_device = NULL;
+        }
+    }
+    if (err != ESP_OK) {
+        Serial.printf("[USB] ERROR: Cannot mount the drive (%s)\n", esp_err_to_name(err));
+        return;
+    }
+
+    msc_host_device_info_t info;
+    if (msc_host_get_device_info(msc_device, &info) == ESP_OK) {
+        Serial.printf("[USB] Drive mounted at %s, %llu MB\n", USB_MOUNT_POINT,
+                      (unsigned long long)info.sector_count * info.sector_size / (1024 * 1024));
+    }
+    perf_inc(perf_mounts);
+    xEventGroupSetBits(msc_events, MSC_MOUNTED);
+}
+
+static void unmount(msc_host_device_handle_t device)
+{
+    if (device != msc_device) {
+        return;
+    }
+    xEventGroupClearBits(msc_events, MSC_MOUNTED);
+    msc_host_vfs_unregister(msc_vfs);
+    msc_host_uninstall_device(msc_device);
+    msc_vfs = NULL;
+    msc_device = NULL;
+    Serial.println("[USB] WARNING: Drive removed, its images fail from now on");
+}
+
+static void mscTask(void *param)
+{
+    UNUSED(param);
+    for (;;) {
+        msc_host_event_t event;
+        if (xQueueReceive(msc_queue, &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (event.event == msc_host_event_t::MSC_DEVICE_CONNECTED) {
+            mount(event.device.address);
+        } else if (event.event == msc_host_event_t::MSC_DEVICE_DISCONNECTED) {
+            unmount(event.device.handle);
+        }
+    }
+}
+#endif
+
+
+/*
+ *  Interface
+ */
+
+bool UsbMscPath(const char *name)
+{
+    size_t n = sizeof(USB_MOUNT_POINT) - 1;
+    return name != NULL && strncmp(name, USB_MOUNT_POINT, n) == 0 && name[n] == '/';
+}
+
+// True if a disk or cdrom pref names an image on the USB drive
+static bool usb_images(void)
+{
+    static const char *const items[] = {"disk", "cdrom"};
+    for (int i = 0; i < 2; i++) {
+        const char *name;
+        for (int j = 0; (name = PrefsFindString(items[i], j)) != NULL; j++) {
+            if (UsbMscPath(name))
+                return true;
+        }
+    }
+    return false;
+}
+
+void UsbMscInit(void)
+{
+    if (msc_events != NULL || !usb_images())
+        return;
+#if HAVE_MSC_DRIVER
+    // Install the host library unless someone did already, and serve it
+    usb_host_config_t host_config = {};
+    host_config.skip_phy_setup = false;
+    host_config.intr_flags = ESP_INTR_FLAG_LEVEL1;
+    esp_err_t err = usb_host_install(&host_config);
+    if (err == ESP_OK) {
+        xTaskCreatePinnedToCore(usbHostTask, "UsbHost", USB_TASK_STACK_SIZE, NULL,
+                                USB_TASK_PRIORITY, NULL, USB_TASK_CORE);
+    } else if (err != ESP_ERR_INVALID_STATE) {
+        Serial.printf("[USB] ERROR: No USB host (%s)\n", esp_err_to_name(err));
+        return;
+    }
+
+    msc_queue = xQueueCreate(4, sizeof(msc_host_event_t));
+    if (msc_queue == NULL ||
+        xTaskCreatePinnedToCore(mscTask, "UsbMsc", USB_TASK_STACK_SIZE, NULL,
+                                USB_MSC_TASK_PRIORITY, NULL, USB_TASK_CORE) != pdPASS) {
+        Serial.println("[USB] ERROR: Cannot start the mass storage task");
+        return;
+    }
+    msc_events = xEventGroupCreate();
+
+    msc_host_driver_config_t msc_config = {};
+    msc_config.create_backround_task = true;
+    msc_config.task_priority = USB_TASK_PRIORITY;
+    msc_config.stack_size = USB_TASK_STACK_SIZE;
+    msc_config.core_id = USB_TASK_CORE;
+    msc_config.callback = msc_event;
+    err = msc_host_install(&msc_config);
+    if (err != ESP_OK) {
+        Serial.printf("[USB] ERROR: No mass storage driver (%s)\n", esp_err_to_name(err));
+        return;
+    }
+    Serial.println("[USB] Mass storage driver started, waiting for the drive");
+#else
+    Serial.println("[USB] WARNING: Images on /usb need the usb_host_msc component, not in this build");
+#endif
+}
+
+bool UsbMscReady(void)
+{
+    if (msc_events == NULL)
+        return false;
+    TickType_t wait = wait_expired ? 0 : pdMS_TO_TICKS(USB_MSC_WAIT_MS);
+    EventBits_t bits = xEventGroupWaitBits(msc_events, MSC_MOUNTED, pdFALSE, pdTRUE, wait);
+    if ((bits & MSC_MOUNTED) == 0) {
+        if (!wait_expired)
+            Serial.println("[USB] WARNING: No USB drive mounted, its images are not opened");
+        wait_expired = true;
+        return false;
+    }
+    return true;
+}
+
+#endif
@@ -36,6 +36,8 @@
 #include "slot_rom.h"
 #include "video.h"
 #include "video_defs.h"
+#include "savestate.h"
+#include "rom_flash.h"
 
 #define DEBUG 0
 #include "debug.h"
@@ -360,6 +362,21 @@ int16 monitor_desc::set_gamma_table(uint32 user_table)
 }
 
 
+/*
+ *  Patch one slot ROM byte, returns true if it changed
+ */
+
+static bool patch_rom_byte(uint32 offset, uint8 value)
+{
+	if (ROMBaseHost[offset] == value)
+		return false;
+	if (!ROMFlashUnmap())	// A ROM mapped from flash is read-only
+		return false;
+	ROMBaseHost[offset] = value;
+	return true;
+}
+
+
 /*
  *  Switch video mode
  */
@@ -393,10 +410,11 @@ void monitor_desc::switch_mode(vector<video_mode>::const_iterator it, uint32 par
 	r.d[0] = 0x0006;
 	Execute68kTrap(0xa06e, &r); // SFindStruct()
 	uint32 minor_base = ReadMacInt32(slot_param + spPointer) - ROMBaseMac;
-	ROMBaseHost[minor_base + 0] = mac_frame_base >> 24;
-	ROMBaseHost[minor_base + 1] = mac_frame_base >> 16;
-	ROMBaseHost[minor_base + 2] = mac_frame_base >> 8;
-	ROMBaseHost[minor_base + 3] = mac_frame_base;
+	bool changed = false;
+	changed |= patch_rom_byte(minor_base + 0, mac_frame_base >> 24);
+	changed |= patch_rom_byte(minor_base + 1, mac_frame_base >> 16);
+	changed |= patch_rom_byte(minor_base + 2, mac_frame_base >> 8);
+	changed |= patch_rom_byte(minor_base + 3, mac_frame_base);
 
 	// Patch video mode parameter table
 	WriteMacInt32(slot_param + spPointer, rsrc);
@@ -407,15 +425,16 @@ void monitor_desc::switch_mode(vector<video_mode>::const_iterator it, uint32 par
 	r.d[0] = 0x0006;
 	Execute68kTrap(0xa06e, &r); // SFindStruct()
 	uint32 p = ReadMacInt32(slot_param + spPointer) - ROMBaseMac;
-	ROMBaseHost[p +  8] = mode.bytes_per_row >> 8;
-	ROMBaseHost[p +  9] = mode.bytes_per_row;
-	ROMBaseHost[p + 14] = mode.y >> 8;
-	ROMBaseHost[p + 15] = mode.y;
-	ROMBaseHost[p + 16] = mode.x >> 8;
-	ROMBaseHost[p + 17] = mode.x;
+	changed |= patch_rom_byte(p +  8, mode.bytes_per_row >> 8);
+	changed |= patch_rom_byte(p +  9, mode.bytes_per_row);
+	changed |= patch_rom_byte(p + 14, mode.y >> 8);
+	changed |= patch_rom_byte(p + 15, mode.y);
+	changed |= patch_rom_byte(p + 16, mode.x >> 8);
+	changed |= patch_rom_byte(p + 17, mode.x);
 
 	// Recalculate slot ROM checksum
-	ChecksumSlotROM();
+	if (changed)
+		ChecksumSlotROM();
 
 	// Update sResource
 	WriteMacInt8(slot_param + spID, ReadMacInt8(dce + dCtlSlotId));
@@ -448,6 +467,56 @@ void monitor_desc::switch_mode(vector<video_mode>::const_iterator it, uint32 par
 }
 
 
+#if SAVE_STATE
+/*
+ *  Driver state for hibernate/resume. Restoring switches the platform code
+ *  to the saved mode and palette; the gamma table and the Slot Manager
+ *  parameter block live in Mac RAM.
+ */
+
+void monitor_desc::state_io(savestate *s)
+{
+	uint32 mode_index = current_mode - modes.begin();
+	savestate_var(s, mode_index);
+	savestate_var(s, mac_frame_base);
+	savestate_var(s, palette);
+	savestate_var(s, luminance_mapping);
+	savestate_var(s, interrupts_enabled);
+	savestate_var(s, dm_present);
+	savestate_var(s, gamma_table);
+	savestate_var(s, alloc_gamma_table_size);
+	savestate_var(s, current_apple_mode);
+	savestate_var(s, current_id);
+	savestate_var(s, preferred_apple_mode);
+	savestate_var(s, preferred_id);
+	savestate_var(s, slot_param);
+
+	if (savestate_loading(s)) {
+		if (mode_index >= modes.size()) {
+			savestate_fail(s, "unknown video mode");
+			return;
+		}
+		current_mode = modes.begin() + mode_index;
+		switch_to_current_mode();
+		set_palette(palette, 256);
+	}
+}
+
+void VideoStateIO(savestate *s)
+{
+	uint32 count = VideoMonitors.size();
+	savestate_var(s, count);
+	if (count != VideoMonitors.size()) {
+		savestate_fail(s, "monitors changed");
+		return;
+	}
+	vector<monitor_desc *>::const_iterator i, end = VideoMonitors.end();
+	for (i = VideoMonitors.begin(); i != end; ++i)
+		(*i)->state_io(s);
+}
+#endif
+
+
 /*
  *  Driver Open() routine
  */
@@ -9,28 +9,64 @@
  *  1. 8-bit indexed frame buffer - minimizes PSRAM bandwidth
  *     - mac_frame_buffer: CPU writes here (8-bit indexed, 230KB)
  *     - Conversion to RGB565 happens at display write time
+ *     - Thousands of colors (16-bit) are stored as display-order RGB565 by
+ *       frame_host_565_bank in memory.cpp, so tiles need no palette lookup
  *  2. Write-time dirty tracking - CPU marks tiles dirty as it writes
  *     - No per-frame comparison needed (eliminates ~460KB PSRAM traffic)
  *     - Dirty tiles tracked via atomic bitmap operations
  *  3. Tile-based partial updates - only updates changed screen regions
- *     - Screen divided into 16x9 grid of 40x40 pixel tiles (144 tiles total)
+ *     - Display divided into 16x9 grid of 80x80 pixel tiles (144 tiles total),
+ *       40x40 Mac pixels at 640x360 and 80x80 at native 1280x720
  *     - Only renders and pushes tiles that have changed
  *     - Falls back to full update if >80% of tiles are dirty (reduces API overhead)
  *     - Working buffers placed in internal SRAM for fast access
+ *     - Adjacent dirty tiles are merged into rectangles, pushed in wide bands
+ *       with one setAddrWindow()/DMA each instead of one per tile
+ *     - Bands rewritten with the same pixels are recognised by a hash and skipped
+ *  4. Optional PPA scaling (USE_PPA_SCALE) - the pixel processing accelerator
+ *     doubles each tile while Core 0 only expands the palette
+ *  5. Optional cursor overlay (USE_CURSOR_OVERLAY) - the cursor is not in the
+ *     frame buffer, it is composited into the bands pushed under it
+ *  6. Two resolutions - 640x360 with every pixel doubled, or native 1280x720
+ *     in 1 to 8 bits. The renderer is a template on the scale factor, so the
+ *     native kernels have no doubling code at all.
+ *  7. Optional tear-free presentation (USE_TEAR_FREE) - the CPU copies the
+ *     dirty bands to a second buffer at each VBL and the video task renders
+ *     from that, so every pushed frame is one the Mac finished drawing
+ *  8. 1/2/4-bit frame buffer in internal SRAM (FRAME_SRAM) - when the SRAM
+ *     plan gives the "framebuffer" slot room, a mode of up to FRAME_SRAM_SIZE
+ *     moves the Mac frame buffer there on the mode switch, so neither the
+ *     CPU's drawing nor the VBL copies go to PSRAM
+ *  9. Optional direct panel rendering (USE_DSI_DIRECT) - bands are converted
+ *     straight into the DSI panel's frame buffer instead of a band buffer
+ *     that M5GFX copies there
  *  
  *  TUNING PARAMETERS (defined below):
- *  - TILE_WIDTH/TILE_HEIGHT: Tile size in Mac pixels (40x40 default)
+ *  - TILE_DISPLAY_SIZE: Tile size in display pixels (80x80 default)
  *  - DIRTY_THRESHOLD_PERCENT: Threshold for switching to full update (80% default)
- *  - VIDEO_SIGNAL_INTERVAL: Frame rate target in main_esp32.cpp (~15 FPS)
+ *  - FAST_FRAME_MS/SLOW_FRAME_MS: Frame pacing for small and large updates
+ *  - VIDEO_SIGNAL_INTERVAL: How often main_esp32.cpp looks for pending updates
+ *  The frame pacing and the signal interval can be set by a performance
+ *  profile ("fastframems", "slowframems" and "videoms" prefs).
  */
 
 #include "sysdeps.h"
 #include "cpu_emulation.h"
 #include "main.h"
+#include "timer.h"
 #include "adb.h"
 #include "prefs.h"
 #include "video.h"
 #include "video_defs.h"
+#include "input.h"
+#include "macos_util.h"
+#include "telemetry.h"
+#include "console.h"
+#include "perf_registry.h"
+#include "hud.h"
+#include "task_stats.h"
+#include "remote.h"
+#include "sram_plan.h"
 
 #include <M5Unified.h>
 #include <M5GFX.h>
@@ -57,29 +93,72 @@
 // Cache line size for ESP32-P4 (64 bytes)
 #define CACHE_LINE_SIZE 64
 
+// Pixel processing accelerator (scale/rotate/mirror engine)
+#if USE_PPA_SCALE
+#include "driver/ppa.h"
+#endif
+
+// Asynchronous memory copies through the AXI GDMA
+#if USE_ASYNC_SNAPSHOT
+#include "esp_async_memcpy.h"
+#endif
+
+// Frame buffer of the DSI panel, behind M5GFX
+#if USE_DSI_DIRECT
+#include <lgfx/v1/panel/Panel_FrameBufferBase.hpp>
+#include <esp_memory_utils.h>
+#endif
+
 #define DEBUG 1
 #include "debug.h"
 
-// Display configuration - 640x360 with 2x pixel doubling for 1280x720 display
-#define MAC_SCREEN_WIDTH  640
-#define MAC_SCREEN_HEIGHT 360
-#define MAC_SCREEN_DEPTH  VDEPTH_8BIT  // 8-bit indexed color
-#define PIXEL_SCALE       2            // 2x scaling to fill 1280x720
-
 // Physical display dimensions
 #define DISPLAY_WIDTH     1280
 #define DISPLAY_HEIGHT    720
 
+// Mac screen configurations: 640x360 with 2x pixel doubling (all depths) or
+// native 1280x720 (up to 8-bit). The deepest mode of each, 640x360 at 16-bit
+// and 1280x720 at 8-bit, has 1280 bytes per row.
+#define MAC_SCREEN_DEPTH  VDEPTH_8BIT  // 8-bit indexed color
+#define MAC_MAX_BYTES_PER_ROW DISPLAY_WIDTH
+#define MAC_MAX_HEIGHT    DISPLAY_HEIGHT
+#define RES_ID_DOUBLED    0x80         // 640x360, pixels doubled
+#define RES_ID_NATIVE     0x81         // 1280x720, native
+
 // Tile-based dirty tracking configuration
-// Tile size: 40x40 Mac pixels (80x80 display pixels after 2x scaling)
-// Grid: 16 columns x 9 rows = 144 tiles total
-// Coverage: 640x360 exactly (40*16=640, 40*9=360)
-#define TILE_WIDTH        40
-#define TILE_HEIGHT       40
+// Tile size: 80x80 display pixels, 40x40 Mac pixels at 2x, 80x80 at 1x
+// Grid: 16 columns x 9 rows = 144 tiles total, covering the display exactly
+#define TILE_DISPLAY_SIZE 80
 #define TILES_X           16
 #define TILES_Y           9
 #define TOTAL_TILES       (TILES_X * TILES_Y)  // 144 tiles
 
+// Second level of dirty tracking: each tile keeps a mask of the row bands
+// written inside it, so a caret blink only re-renders the rows it touched
+#define TILE_BANDS        10           // 8 display rows per band
+#define TILE_BANDS_ALL    ((1u << TILE_BANDS) - 1)
+
+/*
+ *  Mac screen geometry at a scale factor (display pixels per Mac pixel)
+ *  The renderer is instantiated for each scale, so the geometry is constant
+ *  in the kernels; the write-time dirty marking uses the current_* copies.
+ */
+template <int SCALE> struct screen_geometry {
+    static const int width = DISPLAY_WIDTH / SCALE;             // Mac pixels
+    static const int height = DISPLAY_HEIGHT / SCALE;
+    static const int tile_width = TILE_DISPLAY_SIZE / SCALE;    // Multiple of 8
+    static const int tile_height = TILE_DISPLAY_SIZE / SCALE;
+    static const int band_rows = tile_height / TILE_BANDS;      // Mac rows per band
+};
+
+// Dirty rectangle output band: adjacent dirty tiles are merged into rectangles,
+// pushed in bands of at most this many display pixels (16 full width display
+// rows, 40KB per buffer)
+#define RECT_BAND_PIXELS  (DISPLAY_WIDTH * 16)
+
+// Band snapshot size: a 2x band at 16-bit, or half of a native 8-bit band
+#define BAND_SNAPSHOT_BYTES (RECT_BAND_PIXELS / 2)
+
 // Dirty tile threshold - if more than this percentage of tiles are dirty,
 // do a full update instead of partial
 // NOTE: Set to 101 to ALWAYS use tile mode - tile updates are actually faster
@@ -87,15 +166,37 @@
 // double-buffered DMA while streaming mode processes rows sequentially
 #define DIRTY_THRESHOLD_PERCENT  101
 
+// Frame pacing: after a frame of at most FAST_FRAME_TILES dirty tiles (the
+// cursor, a blinking caret, small animations) the next one may follow after
+// FAST_FRAME_MS (60 FPS), after larger ones SLOW_FRAME_MS (24 FPS). With
+// nothing dirty the task sleeps until signalled, or IDLE_WAIT_MS at most.
+#define FAST_FRAME_MS     16
+#define SLOW_FRAME_MS     42
+#define FAST_FRAME_TILES  8
+#define IDLE_WAIT_MS      1000
+static volatile uint32 fast_frame_ms = FAST_FRAME_MS;
+static volatile uint32 slow_frame_ms = SLOW_FRAME_MS;
+
 // Video task configuration
 #define VIDEO_TASK_STACK_SIZE  8192
 #define VIDEO_TASK_PRIORITY    1
 #define VIDEO_TASK_CORE        0  // Run on Core 0, leaving Core 1 for CPU emulation
 
-// Frame buffer for Mac emulation (CPU writes here)
+// Frame buffer for Mac emulation (CPU writes here), one of the two below
 static uint8 *mac_frame_buffer = NULL;
 static uint32 frame_buffer_size = 0;
 
+// PSRAM buffer for every mode, and the SRAM one for the small modes (NULL
+// if the plan left no room). Both live until VideoExit(): the video task may
+// still read the one just left.
+#define FRAME_SRAM_SIZE (128 * 1024)    // 4-bit 640x360 and 1-bit 1280x720, in whole 64KB banks
+static uint8 *frame_psram = NULL;
+static uint32 frame_psram_size = 0;
+static uint8 *frame_sram = NULL;
+#if FRAME_SRAM
+static sram_slot *const frame_sram_slot = SramSlot("framebuffer", FRAME_SRAM_SIZE, 8, SRAM_ONLY | SRAM_STREAM);
+#endif
+
 // Frame synchronization
 static volatile bool frame_ready = false;
 static portMUX_TYPE frame_spinlock = portMUX_INITIALIZER_UNLOCKED;
@@ -111,30 +212,104 @@ DRAM_ATTR static uint16 palette_rgb565[256];
 // Flag to track if palette has changed - avoids unnecessary copies in video task
 static volatile bool palette_changed = true;
 
+// Palette entries changed by set_palette() since the video task last copied
+// the palette (one bit per index, guarded by frame_spinlock)
+static uint32 palette_changed_mask[256 / 32];
+
+#if USE_CURSOR_OVERLAY
+// Cursor sprite of the overlay (see cursor_esp32.cpp). VideoSetCursor()
+// publishes it from the CPU side, the video task takes it once per frame.
+#define CURSOR_SIZE 16
+struct cursor_sprite {
+    uint16 data[CURSOR_SIZE];   // Bit 15 is the leftmost pixel
+    uint16 mask[CURSOR_SIZE];
+    int x, y;                   // Mac pixel of the top left corner
+    bool visible;
+};
+static cursor_sprite cursor_pending;            // Latest state (guarded by frame_spinlock)
+static volatile bool cursor_changed = false;
+static cursor_sprite cursor_shown;              // State composited by the video task
+#endif
+
+// Display updates stopped while the CPU benchmark runs (VideoSetPaused)
+static volatile bool video_paused = false;
+
+#if USE_DISPLAY_SCROLL
+// Vertical moves within the screen (ScrollRect(), CopyBits() from the screen
+// to itself) waiting to be applied to the display by the video task. A move
+// is only queued while its source area on the display is up to date.
+#define MAX_SCROLL_MOVES 8
+struct scroll_move {
+    int16 x0, y0, x1, y1;   // Destination in Mac pixels (end exclusive)
+    int16 dy;               // Rows moved down (negative: up)
+};
+static scroll_move scroll_moves[MAX_SCROLL_MOVES];     // Guarded by frame_spinlock
+static int scroll_move_count = 0;
+static volatile bool video_frame_busy = false;         // dirty_bands collected but not all pushed yet
+#endif
+
+#if USE_TEAR_FREE
+// Copy of the frame buffer as of the last VBL, the video task's only source.
+// The CPU copies into it and the video task reads it, never at the same time.
+enum {
+    PRESENT_IDLE,
+    PRESENT_COPYING,        // CPU copying the dirty bands of a VBL
+    PRESENT_RENDERING       // Video task rendering a frame
+};
+static uint8 *present_buffer = NULL;
+static volatile int present_state = PRESENT_IDLE;
+static uint32 present_dirty_bands[TOTAL_TILES];        // Copied, not yet collected by the video task
+#endif
+
 // Dirty tile bitmap - in internal SRAM for fast access during video frame processing
 DRAM_ATTR static uint32 dirty_tiles[(TOTAL_TILES + 31) / 32];          // Bitmap of dirty tiles (read by video task)
 
-// Write-time dirty tracking bitmap - marked when CPU writes to framebuffer
+// Row bands of each dirty tile (read by video task), TILE_BANDS_ALL after a full update
+DRAM_ATTR static uint32 dirty_bands[TOTAL_TILES];
+
+// Write-time dirty tracking - marked when CPU writes to framebuffer
+// One word per tile with a bit per row band; a tile is dirty when any bit is set.
 // This is double-buffered to avoid race conditions between CPU writes and video task reads
-DRAM_ATTR static uint32 write_dirty_tiles[(TOTAL_TILES + 31) / 32];    // Tiles dirtied by CPU writes
+DRAM_ATTR static uint32 write_dirty_bands[TOTAL_TILES];                // Row bands dirtied by CPU writes
+
+// Palette indices used by each tile (one bit per index), so a palette change
+// only repaints the tiles showing a changed color. Recorded from every band
+// snapshot in the indexed depths; rebuilt from scratch when a tile is
+// rendered whole, otherwise only extended, so it may hold stale colors but
+// never misses one.
+DRAM_ATTR static uint32 tile_colors[TOTAL_TILES][256 / 32];
+
+#if USE_TILE_HASH
+// Hash of each tile row band as last pushed to the display, to skip bands
+// that were rewritten with the same pixels (menu bar redraws, cursor restore)
+DRAM_ATTR static uint32 tile_band_hash[TOTAL_TILES * TILE_BANDS];
+#endif
 
 // Per-tile render lock bitmap - set while video task is snapshotting a tile
 // If CPU tries to write while this is set, the tile is re-marked dirty for next frame
 // This prevents torn data from race conditions during snapshot
 DRAM_ATTR static uint32 tile_render_active[(TOTAL_TILES + 31) / 32];   // Tiles currently being rendered
 
+// Dirty tiles merged into rectangles (rebuilt every frame): tile columns,
+// but Mac rows, trimmed to the dirty row bands
+struct dirty_rect {
+    uint8 x, w;         // First tile column and width in tiles
+    uint16 y0, y1;      // First Mac row and end row (exclusive)
+};
+DRAM_ATTR static dirty_rect dirty_rects[TOTAL_TILES];
+
 // Double-buffered row buffers for streaming full-frame renders with async DMA
 // Processes 4 Mac rows at a time (becomes 8 display rows with 2x scaling)
 // Size: 1280 pixels * 8 rows * 2 bytes = 20,480 bytes (20KB) per buffer
 // Double-buffering allows rendering to one buffer while DMA pushes the other
 // In internal SRAM for fast access during full-frame renders
 #define STREAMING_ROW_COUNT 8
-DRAM_ATTR static uint16 streaming_row_buffer_a[DISPLAY_WIDTH * STREAMING_ROW_COUNT];
-DRAM_ATTR static uint16 streaming_row_buffer_b[DISPLAY_WIDTH * STREAMING_ROW_COUNT];
+DRAM_ATTR static uint16 streaming_row_buffer_a[DISPLAY_WIDTH * STREAMING_ROW_COUNT] __attribute__((aligned(4)));
+DRAM_ATTR static uint16 streaming_row_buffer_b[DISPLAY_WIDTH * STREAMING_ROW_COUNT] __attribute__((aligned(4)));
 static uint16 *render_buffer = streaming_row_buffer_a;
 static uint16 *push_buffer = streaming_row_buffer_b;
 
-static volatile bool force_full_update = true;               // Force full update on first frame or palette change
+static volatile bool force_full_update = true;               // Force full update on first frame or mode change
 static int dirty_tile_count = 0;                             // Count of dirty tiles for threshold check
 
 // Display dimensions (from M5.Display)
@@ -147,23 +322,139 @@ static video_mode current_mode;
 // Current video state cache - updated on mode switch for fast access during rendering
 // These are used by the render loops and dirty tracking to handle different bit depths
 static volatile video_depth current_depth = VDEPTH_8BIT;  // Current color depth
-static volatile uint32 current_bytes_per_row = MAC_SCREEN_WIDTH;  // Bytes per row in frame buffer
+static volatile uint32 current_bytes_per_row = DISPLAY_WIDTH / 2;  // Bytes per row in frame buffer
 static volatile int current_pixels_per_byte = 1;  // Pixels packed per byte (8=1bit, 4=2bit, 2=4bit, 1=8bit)
 static volatile int current_bit_shift = 0;  // Bits to shift per pixel (7=1bit, 6=2bit, 4=4bit, 0=8bit)
 static volatile uint8 current_pixel_mask = 0xFF;  // Mask for extracting pixel value
+static volatile int current_bytes_per_pixel = 1;  // 2 in 16-bit mode, 1 otherwise
+static volatile int current_scale = 2;  // Display pixels per Mac pixel (2 at 640x360, 1 native)
+static volatile int current_width = DISPLAY_WIDTH / 2;  // Mac screen size
+static volatile int current_height = DISPLAY_HEIGHT / 2;
+static volatile int current_tile_width = TILE_DISPLAY_SIZE / 2;  // Tile size in Mac pixels
+static volatile int current_tile_height = TILE_DISPLAY_SIZE / 2;
+static volatile int current_band_rows = TILE_DISPLAY_SIZE / 2 / TILE_BANDS;  // Mac rows per band
+
+// The globals above belong to the CPU side (dirty tracking). The video task
+// renders with frame_mode, which it takes from pending_mode at the start of
+// a frame, under frame_spinlock and together with the palette: a mode switch
+// lands whole on a frame boundary instead of changing the depth or the row
+// stride under a frame being rendered. The version tells a new mode.
+typedef void (*row_decoder)(const uint8 *src, uint8 *dst, int width);
+struct frame_mode_desc {
+    uint32 version;
+    video_depth depth;
+    uint32 bytes_per_row;
+    int pixels_per_byte;
+    int scale;                  // Display pixels per Mac pixel
+    row_decoder decode;         // Frame buffer row to 8-bit indices, NULL in 16-bit mode
+    uint8 *base;                // mac_frame_buffer and its size for this mode
+    uint32 size;
+};
+static frame_mode_desc pending_mode;            // Guarded by frame_spinlock
+static volatile uint32 pending_mode_version = 0;    // pending_mode.version, read without the lock
+static frame_mode_desc frame_mode;              // Mode of the frame being rendered (video task)
+static row_decoder rowDecoder(video_depth depth);
+
+// Palette the Mac last had in each indexed depth, brought back when it
+// switches to that depth again (CPU side)
+static uint16 depth_palettes[VDEPTH_8BIT + 1][256];
+static bool depth_palette_valid[VDEPTH_8BIT + 1];
+static video_depth palette_depth = VDEPTH_8BIT;    // Depth of the colors in palette_rgb565
+
+// Write-time dirty tracking lookup tables - rebuilt by updateVideoStateCache()
+// Turn a frame buffer offset into a tile index without a divide: the row comes
+// from a reciprocal multiply, then one table gives the tile row base and the
+// other the tile column of each byte in the row. The tile width is a multiple
+// of 8, so a byte never straddles two tile columns in any packed depth.
+#define DIRTY_TILE_NONE 0xFF
+DRAM_ATTR static uint8 dirty_row_tile[MAC_MAX_HEIGHT];      // Row -> tile_y * TILES_X
+DRAM_ATTR static uint16 dirty_row_band[MAC_MAX_HEIGHT];     // Row -> its band bit within the tile
+DRAM_ATTR static uint8 dirty_col_tile[MAC_MAX_BYTES_PER_ROW];  // Byte in row -> tile_x, or DIRTY_TILE_NONE
+static uint32 dirty_row_recip = 0;                          // 2^32 / bytes_per_row, rounded up
 
 // ============================================================================
 // Performance profiling counters (lightweight, always enabled)
 // ============================================================================
-static volatile uint32_t perf_detect_us = 0;        // Time to detect dirty tiles
-static volatile uint32_t perf_render_us = 0;        // Time to render and push frame
-static volatile uint32_t perf_frame_count = 0;      // Frames rendered
-static volatile uint32_t perf_partial_count = 0;    // Partial updates
-static volatile uint32_t perf_full_count = 0;       // Full updates
-static volatile uint32_t perf_skip_count = 0;       // Skipped frames (no changes)
-static volatile uint32_t perf_last_report_ms = 0;   // Last time stats were printed
+// Registry counters, written by the video task only
+static perf_counter *const perf_detect_us = PerfCounter("video.detect_us", PERF_COUNT, PERF_CORE_IO);       // Time to detect dirty tiles
+static perf_counter *const perf_render_us = PerfCounter("video.render_us", PERF_COUNT, PERF_CORE_IO);       // Time to render and push frame
+static perf_counter *const perf_frame_count = PerfCounter("video.frames", PERF_COUNT, PERF_CORE_IO);        // Frames rendered
+static perf_counter *const perf_partial_count = PerfCounter("video.partial", PERF_COUNT, PERF_CORE_IO);     // Partial updates
+static perf_counter *const perf_full_count = PerfCounter("video.full", PERF_COUNT, PERF_CORE_IO);           // Full updates
+static perf_counter *const perf_skip_count = PerfCounter("video.skipped", PERF_COUNT, PERF_CORE_IO);        // Skipped frames (no changes)
+static perf_counter *const perf_same_count = PerfCounter("video.same_bands", PERF_COUNT, PERF_CORE_IO);     // Dirty bands not pushed, same pixels as before
+static perf_counter *const perf_scroll_count = PerfCounter("video.scrolls", PERF_COUNT, PERF_CORE_IO);      // Scroll moves applied on the display
+static perf_counter *const perf_tile_count = PerfCounter("video.tiles", PERF_COUNT, PERF_CORE_IO);          // Dirty tiles of the rendered frames
+static perf_counter *const perf_mode_count = PerfCounter("video.modes", PERF_COUNT, PERF_CORE_IO);          // Mode switches taken by the video task
+static perf_counter *const perf_mode_aborts = PerfCounter("video.mode_aborts", PERF_COUNT, PERF_CORE_IO);   // Frames cut short by a mode switch
+#if USE_RENDER_ASSIST
+static perf_counter *const perf_assist_bands = PerfCounter("video.assist_bands", PERF_COUNT, PERF_CORE_IO); // Bands converted half by the CPU task
+#endif
+#if USE_POINTER_FIRST
+static perf_counter *const perf_pointer_rects = PerfCounter("video.pointer_rects", PERF_COUNT, PERF_CORE_IO); // Rectangles pushed first, at the pointer
+#endif
+#if USE_DSI_DIRECT
+static perf_counter *const perf_panel_bands = PerfCounter("video.panel_bands", PERF_COUNT, PERF_CORE_IO);   // Bands converted straight into the panel's frame buffer
+#endif
+static task_stats *const video_task_stats = TaskStats("video");                                             // Run slices of the video task
+static struct {
+    uint32 detect_us, render_us, frames, partial, full, skip, same, scroll;
+} perf_last;                                        // Counters at the last report
+static uint32_t perf_last_report_ms = 0;            // Last time stats were printed
 #define PERF_REPORT_INTERVAL_MS 5000                // Report every 5 seconds
 
+#if VIDEO_TELEMETRY
+// ============================================================================
+// Frame time histograms (VIDEO_TELEMETRY), printed with 'v' on the serial console
+// ============================================================================
+enum {
+    TELEMETRY_COLLECT,      // Dirty tile collection, palette and cursor marking (us)
+    TELEMETRY_SNAPSHOT,     // Band snapshots from the frame buffer (us)
+    TELEMETRY_CONVERT,      // Color recording, hashing, rendering, cursor (us)
+    TELEMETRY_DMA,          // Address window setup and waiting for the DMA (us)
+    TELEMETRY_FRAME,        // Whole frame, collect to last DMA (us)
+    TELEMETRY_TILES,        // Dirty tiles per frame
+    TELEMETRY_COUNT
+};
+
+// In the registry, written by the video task only
+static perf_histogram *const telemetry[TELEMETRY_COUNT] = {
+    PerfHistogram("video.collect_us", PERF_CORE_IO),
+    PerfHistogram("video.snapshot_us", PERF_CORE_IO),
+    PerfHistogram("video.convert_us", PERF_CORE_IO),
+    PerfHistogram("video.dma_us", PERF_CORE_IO),
+    PerfHistogram("video.frame_us", PERF_CORE_IO),
+    PerfHistogram("video.tiles", PERF_CORE_IO)
+};
+
+// Stage times of the frame being rendered, summed over its bands
+static uint32 frame_snapshot_us, frame_convert_us, frame_dma_us;
+#endif
+
+#if INPUT_TELEMETRY
+// ============================================================================
+// Input to photon (INPUT_TELEMETRY), printed with 'i' on the serial console
+// ============================================================================
+// ADBInterrupt() arms the probe with the posting time of an event it hands
+// to the Mac (motion, press or key down) while none is armed. The first
+// frame collected after that which changes the screen ends it when its
+// last DMA has completed: the Mac's response is on the panel. A change
+// already pending when the event arrived ends it as well, so a sample can
+// be short. An event nothing answers within PHOTON_TIMEOUT_US is dropped.
+#define PHOTON_TIMEOUT_US   1000000
+
+static volatile uint32 photon_posted = 0;      // Armed event's posting time, 0: none
+static volatile int photon_which = 0;          // Its ADB_LATENCY_* kind
+
+// In the registry, written by the video task only
+static perf_histogram *const photon[ADB_LATENCY_COUNT] = {
+    PerfHistogram("input.photon_move_us", PERF_CORE_IO),
+    PerfHistogram("input.photon_button_us", PERF_CORE_IO),
+    PerfHistogram("input.photon_key_us", PERF_CORE_IO)
+};
+static perf_counter *const perf_photon_lost = PerfCounter("input.photon_lost", PERF_COUNT, PERF_CORE_IO);
+#endif
+
 // Monitor descriptor for ESP32
 class ESP32_monitor_desc : public monitor_desc {
 public:
@@ -178,6 +469,11 @@ public:
 // Pointer to our monitor
 static ESP32_monitor_desc *the_monitor = NULL;
 
+#if USE_PPA_SCALE
+// PPA scale client, NULL if the accelerator is not available (software scaling)
+static ppa_client_handle_t ppa_srm_client = NULL;
+#endif
+
 /*
  *  Convert RGB888 to swap565 format for M5GFX writePixels
  *  
@@ -195,8 +491,11 @@ static inline uint16 rgb888_to_rgb565(uint8 r, uint8 g, uint8 b)
  *  Set palette for indexed color modes
  *  Thread-safe: uses spinlock since palette can be updated from CPU emulation
  *  
- *  When palette changes, we force a full screen update since all pixels
- *  may look different even though the framebuffer data hasn't changed.
+ *  The frame buffer data hasn't changed, but the pixels of the changed
+ *  entries look different: the entries that really changed are recorded in
+ *  palette_changed_mask, and the video task repaints the tiles using them
+ *  (markPaletteDirtyTiles()). Color cycling and fades then redraw only the
+ *  tiles showing the cycled colors instead of the whole screen.
  */
 void ESP32_monitor_desc::set_palette(uint8 *pal, int num)
 {
@@ -207,13 +506,14 @@ void ESP32_monitor_desc::set_palette(uint8 *pal, int num)
         uint8 r = pal[i * 3 + 0];
         uint8 g = pal[i * 3 + 1];
         uint8 b = pal[i * 3 + 2];
-        palette_rgb565[i] = rgb888_to_rgb565(r, g, b);
+        uint16 color = rgb888_to_rgb565(r, g, b);
+        if (palette_rgb565[i] != color) {
+            palette_rgb565[i] = color;
+            palette_changed_mask[i / 32] |= 1u << (i % 32);
+        }
     }
     palette_changed = true;
     portEXIT_CRITICAL(&frame_spinlock);
-    
-    // Force a full screen update since palette affects all pixels
-    force_full_update = true;
 }
 
 /*
@@ -227,13 +527,29 @@ void ESP32_monitor_desc::set_gamma(uint8 *gamma, int num)
     UNUSED(num);
 }
 
+/*
+ *  First pixel of a byte in a frame buffer row, in the current depth (the
+ *  byte holds current_pixels_per_byte pixels from there, or half of one)
+ */
+static inline int bytePixel(int byte_in_row)
+{
+    return byte_in_row * current_pixels_per_byte / current_bytes_per_pixel;
+}
+
 /*
  *  Helper to update the video state cache based on depth
  */
-static void updateVideoStateCache(video_depth depth, uint32 bytes_per_row)
+static void updateVideoStateCache(video_depth depth, uint32 bytes_per_row, int scale)
 {
     current_depth = depth;
     current_bytes_per_row = bytes_per_row;
+    current_bytes_per_pixel = 1;
+    current_scale = scale;
+    current_width = DISPLAY_WIDTH / scale;
+    current_height = DISPLAY_HEIGHT / scale;
+    current_tile_width = TILE_DISPLAY_SIZE / scale;
+    current_tile_height = TILE_DISPLAY_SIZE / scale;
+    current_band_rows = current_tile_height / TILE_BANDS;
     
     switch (depth) {
         case VDEPTH_1BIT:
@@ -251,6 +567,12 @@ static void updateVideoStateCache(video_depth depth, uint32 bytes_per_row)
             current_bit_shift = 4;
             current_pixel_mask = 0x0F;
             break;
+        case VDEPTH_16BIT:
+            current_pixels_per_byte = 1;
+            current_bytes_per_pixel = 2;
+            current_bit_shift = 0;
+            current_pixel_mask = 0xFF;
+            break;
         case VDEPTH_8BIT:
         default:
             current_pixels_per_byte = 1;
@@ -259,41 +581,52 @@ static void updateVideoStateCache(video_depth depth, uint32 bytes_per_row)
             break;
     }
     
-    Serial.printf("[VIDEO] Mode cache updated: depth=%d, bpr=%d, ppb=%d\n", 
-                  (int)depth, (int)bytes_per_row, current_pixels_per_byte);
+    // Rebuild the dirty tracking tables. The reciprocal gives an exact row for
+    // every offset below 2^32 / bytes_per_row, far beyond the frame buffer.
+    dirty_row_recip = 0xFFFFFFFFu / bytes_per_row + 1;
+    for (int y = 0; y < MAC_MAX_HEIGHT; y++) {
+        dirty_row_tile[y] = (y < current_height) ? (y / current_tile_height) * TILES_X : 0;
+        dirty_row_band[y] = 1u << ((y % current_tile_height) / current_band_rows);
+    }
+    for (int x = 0; x < MAC_MAX_BYTES_PER_ROW; x++) {
+        int pixel = bytePixel(x);
+        dirty_col_tile[x] = (x < (int)bytes_per_row && pixel < current_width) ? pixel / current_tile_width : DIRTY_TILE_NONE;
+    }
+    
+    Serial.printf("[VIDEO] Mode cache updated: %dx%d, depth=%d, bpr=%d, ppb=%d\n", 
+                  current_width, current_height, (int)depth, (int)bytes_per_row, current_pixels_per_byte);
 }
 
 /*
- *  Initialize palette with default colors for the specified depth
+ *  Fill a palette with the default colors for the specified depth
  *  
  *  This sets up appropriate default colors:
  *  - 1-bit: Black and white (standard Mac B&W)
  *  - 2-bit: 4-color grayscale (white, light gray, dark gray, black)
  *  - 4-bit: Classic Mac 16-color palette
  *  - 8-bit: Mac 256-color palette (6x6x6 color cube + grayscale ramp)
+ *  - 16-bit: no palette, pixels are RGB565 already
  *  
  *  Classic Mac convention: index 0 = white, highest index = black
  */
-static void initDefaultPalette(video_depth depth)
+static void initDefaultPalette(video_depth depth, uint16 *palette)
 {
-    portENTER_CRITICAL(&frame_spinlock);
-    
     switch (depth) {
         case VDEPTH_1BIT:
             // 1-bit: Black and white
             // Index 0 = white, Index 1 = black
-            palette_rgb565[0] = rgb888_to_rgb565(255, 255, 255);  // White
-            palette_rgb565[1] = rgb888_to_rgb565(0, 0, 0);        // Black
+            palette[0] = rgb888_to_rgb565(255, 255, 255);  // White
+            palette[1] = rgb888_to_rgb565(0, 0, 0);        // Black
             Serial.println("[VIDEO] Initialized 1-bit B&W palette");
             break;
             
         case VDEPTH_2BIT:
             // 2-bit: 4 levels of gray
             // Index 0 = white, Index 3 = black
-            palette_rgb565[0] = rgb888_to_rgb565(255, 255, 255);  // White
-            palette_rgb565[1] = rgb888_to_rgb565(170, 170, 170);  // Light gray
-            palette_rgb565[2] = rgb888_to_rgb565(85, 85, 85);     // Dark gray
-            palette_rgb565[3] = rgb888_to_rgb565(0, 0, 0);        // Black
+            palette[0] = rgb888_to_rgb565(255, 255, 255);  // White
+            palette[1] = rgb888_to_rgb565(170, 170, 170);  // Light gray
+            palette[2] = rgb888_to_rgb565(85, 85, 85);     // Dark gray
+            palette[3] = rgb888_to_rgb565(0, 0, 0);        // Black
             Serial.println("[VIDEO] Initialized 2-bit grayscale palette");
             break;
             
@@ -320,12 +653,16 @@ static void initDefaultPalette(video_depth depth)
                     {0, 0, 0}         // 15: Black
                 };
                 for (int i = 0; i < 16; i++) {
-                    palette_rgb565[i] = rgb888_to_rgb565(mac16[i][0], mac16[i][1], mac16[i][2]);
+                    palette[i] = rgb888_to_rgb565(mac16[i][0], mac16[i][1], mac16[i][2]);
                 }
             }
             Serial.println("[VIDEO] Initialized 4-bit 16-color palette");
             break;
             
+        case VDEPTH_16BIT:
+            // Direct color: the gamma ramp Mac OS loads is not used
+            break;
+            
         case VDEPTH_8BIT:
         default:
             // 8-bit: Mac 256-color palette
@@ -342,7 +679,7 @@ static void initDefaultPalette(video_depth depth)
                             uint8 rv = r * 51;
                             uint8 gv = g * 51;
                             uint8 bv = b * 51;
-                            palette_rgb565[idx++] = rgb888_to_rgb565(rv, gv, bv);
+                            palette[idx++] = rgb888_to_rgb565(rv, gv, bv);
                         }
                     }
                 }
@@ -351,17 +688,55 @@ static void initDefaultPalette(video_depth depth)
                 // This provides smooth grays for UI elements
                 for (int i = 0; i < 40; i++) {
                     uint8 gray = (i * 255) / 39;
-                    palette_rgb565[idx++] = rgb888_to_rgb565(gray, gray, gray);
+                    palette[idx++] = rgb888_to_rgb565(gray, gray, gray);
                 }
             }
             Serial.println("[VIDEO] Initialized 8-bit 256-color palette");
             break;
     }
-    
+}
+
+/*
+ *  Hand a new mode to the video task, with the palette it starts with
+ *  (NULL: the palette stays), all in one step for the next frame. The
+ *  video task repaints the whole screen once for it.
+ */
+static void publishFrameMode(video_depth depth, uint32 bytes_per_row, int scale, const uint16 *palette)
+{
+    portENTER_CRITICAL(&frame_spinlock);
+    pending_mode.version++;
+    pending_mode.depth = depth;
+    pending_mode.bytes_per_row = bytes_per_row;
+    pending_mode.pixels_per_byte = current_pixels_per_byte;
+    pending_mode.scale = scale;
+    pending_mode.decode = rowDecoder(depth);
+    pending_mode.base = mac_frame_buffer;
+    pending_mode.size = frame_buffer_size;
+    pending_mode_version = pending_mode.version;
+    if (palette) {
+        memcpy(palette_rgb565, palette, sizeof(palette_rgb565));
+        memset(palette_changed_mask, 0xFF, sizeof(palette_changed_mask));
+    }
+    palette_changed = true;
     portEXIT_CRITICAL(&frame_spinlock);
-    
-    // Force a full screen update since palette changed
-    force_full_update = true;
+}
+
+/*
+ *  Put the Mac frame buffer in internal SRAM if the mode fits there, in
+ *  PSRAM otherwise, with the screen carried over (CPU side, before the
+ *  mapping is rebuilt)
+ */
+static void placeFrameBuffer(uint32 mode_size)
+{
+    uint8 *base = (frame_sram && mode_size <= FRAME_SRAM_SIZE) ? frame_sram : frame_psram;
+    if (base == mac_frame_buffer) return;
+    uint32 size = (base == frame_sram) ? FRAME_SRAM_SIZE : frame_psram_size;
+    memcpy(base, mac_frame_buffer, mode_size <= frame_buffer_size ? mode_size : frame_buffer_size);
+    mac_frame_buffer = base;
+    frame_buffer_size = size;
+    MacFrameBaseHost = base;
+    MacFrameSize = size;
+    D(bug("[VIDEO] Frame buffer in %s\n", base == frame_sram ? "internal SRAM" : "PSRAM"));
 }
 
 /*
@@ -373,25 +748,65 @@ void ESP32_monitor_desc::switch_to_current_mode(void)
     D(bug("[VIDEO] switch_to_current_mode: %dx%d, depth=%d, bpr=%d\n", 
           mode.x, mode.y, mode.depth, mode.bytes_per_row));
     
-    // Update the video state cache for rendering
-    updateVideoStateCache(mode.depth, mode.bytes_per_row);
-    
-    // Initialize default palette for this depth
-    // MacOS will set its own palette shortly after, but this ensures
-    // the display looks reasonable immediately after the mode switch
-    initDefaultPalette(mode.depth);
+    // Update the video state cache for the dirty tracking
+    updateVideoStateCache(mode.depth, mode.bytes_per_row, DISPLAY_WIDTH / mode.x);
+    InputSetScreenSize(mode.x, mode.y);
+    
+    // Thousands of colors go through frame_host_565_bank, which stores
+    // display-order RGB565; the indexed depths are accessed in place
+    MacFrameLayout = (mode.depth == VDEPTH_16BIT) ? FLAYOUT_HOST_565 : FLAYOUT_DIRECT;
+    placeFrameBuffer(mode.bytes_per_row * mode.y);
+    InitFrameBufferMapping();
+    
+    // Keep the palette of the depth being left, and start the new depth
+    // with the one it had before: back in 256 colors the screen shows the
+    // right colors at once, and the SetEntries() MacOS sends next changes
+    // nothing. A depth seen for the first time starts with the defaults.
+    uint16 palette[256];
+    const uint16 *new_palette = NULL;
+    if (mode.depth <= VDEPTH_8BIT && mode.depth != palette_depth) {
+        memcpy(depth_palettes[palette_depth], palette_rgb565, sizeof(palette_rgb565));
+        depth_palette_valid[palette_depth] = true;
+        if (depth_palette_valid[mode.depth]) {
+            memcpy(palette, depth_palettes[mode.depth], sizeof(palette));
+        } else {
+            initDefaultPalette(mode.depth, palette);
+        }
+        palette_depth = mode.depth;
+        new_palette = palette;
+    }
+    publishFrameMode(mode.depth, mode.bytes_per_row, current_scale, new_palette);
     
     // Update frame buffer base address
     set_mac_frame_base(MacFrameBaseMac);
-    
-    // Force a full screen update on mode change (already done by initDefaultPalette)
-    force_full_update = true;
 }
 
 // ============================================================================
 // Packed pixel decoding helpers for 1/2/4-bit modes
 // ============================================================================
 
+/*
+ *  Packed byte to 8-bit palette indices, leftmost pixel in the lowest
+ *  address, so a byte decodes with 32-bit stores (initDecodeTables())
+ */
+DRAM_ATTR static uint32 decode_1bit[256][2];    // 8 indices
+DRAM_ATTR static uint32 decode_2bit[256];       // 4 indices
+DRAM_ATTR static uint16 decode_4bit[256];       // 2 indices
+
+static void initDecodeTables(void)
+{
+    for (int b = 0; b < 256; b++) {
+        uint8 px[8];
+        for (int i = 0; i < 8; i++) px[i] = (b >> (7 - i)) & 0x01;
+        memcpy(decode_1bit[b], px, 8);
+        for (int i = 0; i < 4; i++) px[i] = (b >> (6 - i * 2)) & 0x03;
+        memcpy(&decode_2bit[b], px, 4);
+        px[0] = b >> 4;
+        px[1] = b & 0x0F;
+        memcpy(&decode_4bit[b], px, 2);
+    }
+}
+
 /*
  *  Decode a row of packed pixels to 8-bit palette indices
  *  
@@ -401,46 +816,71 @@ void ESP32_monitor_desc::switch_to_current_mode(void)
  *  - 4-bit: 2 pixels per byte, MSB first (bits 7-4 = leftmost pixel)
  *  - 8-bit: 1 pixel per byte (no decoding needed)
  *  
+ *  Whole source bytes are looked up in the decode tables and stored 32 bits
+ *  at a time; only a partial last byte is decoded per pixel. There is one
+ *  kernel per depth, the mode descriptor carries the one of its depth
+ *  (rowDecoder()), so the render loops do not switch on the depth per row.
+ *  
  *  @param src       Source row in frame buffer (packed)
- *  @param dst       Destination buffer for 8-bit indices (must hold width pixels)
+ *  @param dst       Destination buffer for 8-bit indices (4-byte aligned, must hold width pixels)
  *  @param width     Number of pixels to decode
- *  @param depth     Current video depth
  */
-static void decodePackedRow(const uint8 *src, uint8 *dst, int width, video_depth depth)
+static void decodeRow1bit(const uint8 *src, uint8 *dst, int width)
+{
+    // 8 pixels per byte, two stores
+    uint32 *out = (uint32 *)dst;
+    int bytes = width / 8;
+    for (int i = 0; i < bytes; i++) {
+        const uint32 *p = decode_1bit[src[i]];
+        out[0] = p[0];
+        out[1] = p[1];
+        out += 2;
+    }
+    for (int x = bytes * 8; x < width; x++) {
+        dst[x] = (src[x / 8] >> (7 - (x % 8))) & 0x01;
+    }
+}
+
+static void decodeRow2bit(const uint8 *src, uint8 *dst, int width)
+{
+    // 4 pixels per byte, one store
+    uint32 *out = (uint32 *)dst;
+    int bytes = width / 4;
+    for (int i = 0; i < bytes; i++) {
+        out[i] = decode_2bit[src[i]];
+    }
+    for (int x = bytes * 4; x < width; x++) {
+        dst[x] = (src[x / 4] >> (6 - (x % 4) * 2)) & 0x03;
+    }
+}
+
+static void decodeRow4bit(const uint8 *src, uint8 *dst, int width)
+{
+    // 2 pixels per byte, one store per byte pair (little endian)
+    uint32 *out = (uint32 *)dst;
+    int pairs = width / 4;
+    for (int i = 0; i < pairs; i++) {
+        out[i] = decode_4bit[src[i * 2]] | ((uint32)decode_4bit[src[i * 2 + 1]] << 16);
+    }
+    for (int x = pairs * 4; x < width; x++) {
+        dst[x] = (x % 2 == 0) ? src[x / 2] >> 4 : src[x / 2] & 0x0F;
+    }
+}
+
+static void decodeRow8bit(const uint8 *src, uint8 *dst, int width)
+{
+    // Direct copy, no decoding needed
+    memcpy(dst, src, width);
+}
+
+static row_decoder rowDecoder(video_depth depth)
 {
     switch (depth) {
-        case VDEPTH_1BIT: {
-            // 8 pixels per byte, MSB first
-            for (int x = 0; x < width; x++) {
-                int byte_idx = x / 8;
-                int bit_idx = 7 - (x % 8);  // MSB first
-                dst[x] = (src[byte_idx] >> bit_idx) & 0x01;
-            }
-            break;
-        }
-        case VDEPTH_2BIT: {
-            // 4 pixels per byte, MSB first
-            for (int x = 0; x < width; x++) {
-                int byte_idx = x / 4;
-                int shift = 6 - ((x % 4) * 2);  // MSB first: 6, 4, 2, 0
-                dst[x] = (src[byte_idx] >> shift) & 0x03;
-            }
-            break;
-        }
-        case VDEPTH_4BIT: {
-            // 2 pixels per byte, MSB first
-            for (int x = 0; x < width; x++) {
-                int byte_idx = x / 2;
-                int shift = (x % 2 == 0) ? 4 : 0;  // MSB first: high nibble, low nibble
-                dst[x] = (src[byte_idx] >> shift) & 0x0F;
-            }
-            break;
-        }
-        case VDEPTH_8BIT:
-        default:
-            // Direct copy, no decoding needed
-            memcpy(dst, src, width);
-            break;
+        case VDEPTH_1BIT: return decodeRow1bit;
+        case VDEPTH_2BIT: return decodeRow2bit;
+        case VDEPTH_4BIT: return decodeRow4bit;
+        case VDEPTH_8BIT: return decodeRow8bit;
+        default:          return NULL;
     }
 }
 
@@ -489,6 +929,29 @@ static inline bool isTileDirty(int tile_idx)
     return (dirty_tiles[tile_idx / 32] & (1 << (tile_idx % 32))) != 0;
 }
 
+/*
+ *  Mask of the row bands from Mac row y0 to y1 (inclusive) within tile row tile_y
+ */
+static inline uint32 dirtyBandMask(int tile_y, int y0, int y1)
+{
+    int tile_height = current_tile_height;
+    int band_rows = current_band_rows;
+    int top = tile_y * tile_height;
+    int first = (y0 <= top) ? 0 : (y0 - top) / band_rows;
+    int last = (y1 >= top + tile_height - 1) ? TILE_BANDS - 1 : (y1 - top) / band_rows;
+    return (TILE_BANDS_ALL >> (TILE_BANDS - 1 - last)) & ~((1u << first) - 1);
+}
+
+/*
+ *  Mark row bands of a tile dirty
+ *  Unconditionally - even if being rendered, so that tiles written during
+ *  rendering are re-rendered next frame
+ */
+static inline void markTileBands(int tile_idx, uint32 bands)
+{
+    __atomic_or_fetch(&write_dirty_bands[tile_idx], bands, __ATOMIC_RELAXED);
+}
+
 /*
  *  Tile render lock functions - used to prevent race conditions during snapshot
  *  When a tile is being rendered (snapshotted), CPU writes to that tile will
@@ -509,12 +972,32 @@ static inline bool isTileRenderActive(int tile_idx)
     return (__atomic_load_n(&tile_render_active[tile_idx / 32], __ATOMIC_ACQUIRE) & (1u << (tile_idx % 32))) != 0;
 }
 
+/*
+ *  Tile index of a frame buffer byte, or -1 if it is off screen
+ *  Also returns the bit of the byte's row band in band
+ */
+static inline int dirtyTileIndex(uint32 offset, uint32 &band)
+{
+    if (offset >= frame_buffer_size) return -1;
+    
+    // Row by reciprocal multiply, then byte within the row
+    uint32 y = ((uint64)offset * dirty_row_recip) >> 32;
+    if (y >= (uint32)current_height) return -1;
+    uint32 byte_in_row = offset - y * current_bytes_per_row;
+    
+    // Bytes past the visible width (row padding) have no tile
+    uint32 tile_x = dirty_col_tile[byte_in_row];
+    if (tile_x == DIRTY_TILE_NONE) return -1;
+    band = dirty_row_band[y];
+    return dirty_row_tile[y] + tile_x;
+}
+
 /*
  *  Mark a tile as dirty at write-time (called from frame buffer put functions)
  *  This is MUCH faster than per-frame comparison as it only runs on actual writes.
  *  
- *  Handles packed pixel modes by mapping byte offset to pixel coordinates using
- *  current_bytes_per_row and current_pixels_per_byte.
+ *  Handles packed pixel modes through the dirty_row_tile/dirty_col_tile tables,
+ *  which updateVideoStateCache() builds from the bytes per row and pixels per byte.
  *  
  *  RACE CONDITION HANDLING:
  *  If the video task is currently rendering (snapshotting) this tile, the snapshot
@@ -528,45 +1011,46 @@ static inline bool isTileRenderActive(int tile_idx)
  */
 void VideoMarkDirtyOffset(uint32 offset)
 {
-    if (offset >= frame_buffer_size) return;
-    
-    // Get current bytes per row (volatile)
-    uint32 bpr = current_bytes_per_row;
-    int ppb = current_pixels_per_byte;
-    
-    // Calculate row from byte offset
-    int y = offset / bpr;
-    if (y >= MAC_SCREEN_HEIGHT) return;
+    uint32 band;
+    int tile_idx = dirtyTileIndex(offset, band);
+    if (tile_idx < 0) return;
     
-    // Calculate byte position within row
-    int byte_in_row = offset % bpr;
-    
-    // Calculate pixel range that this byte affects
-    int pixel_start = byte_in_row * ppb;
-    int pixel_end = pixel_start + ppb - 1;
-    
-    // Clamp to screen width
-    if (pixel_start >= MAC_SCREEN_WIDTH) return;
-    if (pixel_end >= MAC_SCREEN_WIDTH) pixel_end = MAC_SCREEN_WIDTH - 1;
+    // Mark the row band dirty (unconditionally - even if being rendered)
+    // This ensures tiles written during rendering are re-rendered next frame
+    markTileBands(tile_idx, band);
+}
+
+/*
+ *  Mark the row bands of the tiles under Mac pixels (x0, y0)-(x1, y1)
+ *  (inclusive) dirty: one band mask per tile row, one OR per covered tile
+ */
+static void markDirtyPixels(int x0, int y0, int x1, int y1)
+{
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= current_width) x1 = current_width - 1;
+    if (y1 >= current_height) y1 = current_height - 1;
+    if (x0 > x1 || y0 > y1) return;
+    
+    int tile_x_start = x0 / current_tile_width;
+    int tile_x_end = x1 / current_tile_width;
+    if (tile_x_end >= TILES_X) tile_x_end = TILES_X - 1;
     
-    // Calculate tile range
-    int tile_x_start = pixel_start / TILE_WIDTH;
-    int tile_x_end = pixel_end / TILE_WIDTH;
-    int tile_y = y / TILE_HEIGHT;
+    int tile_y_start = y0 / current_tile_height;
+    int tile_y_end = y1 / current_tile_height;
+    if (tile_y_end >= TILES_Y) tile_y_end = TILES_Y - 1;
     
-    // Mark all affected tiles dirty (unconditionally - even if being rendered)
-    // This ensures tiles written during rendering are re-rendered next frame
-    for (int tile_x = tile_x_start; tile_x <= tile_x_end; tile_x++) {
-        int tile_idx = tile_y * TILES_X + tile_x;
-        if (tile_idx < TOTAL_TILES) {
-            __atomic_or_fetch(&write_dirty_tiles[tile_idx / 32], (1u << (tile_idx % 32)), __ATOMIC_RELAXED);
+    for (int tile_y = tile_y_start; tile_y <= tile_y_end; tile_y++) {
+        uint32 bands = dirtyBandMask(tile_y, y0, y1);
+        for (int tile_x = tile_x_start; tile_x <= tile_x_end; tile_x++) {
+            markTileBands(tile_y * TILES_X + tile_x, bands);
         }
     }
 }
 
 /*
  *  Mark a range of tiles as dirty at write-time
- *  Used for multi-byte writes (lput, wput)
+ *  Used for multi-byte writes (lput, wput) and BlockMove()
  *  
  *  For packed pixel modes, a multi-byte write can span many pixels across
  *  potentially multiple rows and tiles.
@@ -578,226 +1062,1455 @@ void VideoMarkDirtyOffset(uint32 offset)
  */
 void VideoMarkDirtyRange(uint32 offset, uint32 size)
 {
-    if (offset >= frame_buffer_size) return;
+    if (offset >= frame_buffer_size || size == 0) return;
     
     // Clamp size to framebuffer bounds
     if (offset + size > frame_buffer_size) {
         size = frame_buffer_size - offset;
     }
     
+    // Small writes (lput, wput) reach at most two tiles, usually one: mark the
+    // bands of the first and last byte, with a single OR when they share a tile
+    if (size <= 4) {
+        uint32 first_band, last_band;
+        int first = dirtyTileIndex(offset, first_band);
+        int last = dirtyTileIndex(offset + size - 1, last_band);
+        if (first >= 0 && first == last) {
+            markTileBands(first, first_band | last_band);
+            return;
+        }
+        if (first >= 0) {
+            markTileBands(first, first_band);
+        }
+        if (last >= 0) {
+            markTileBands(last, last_band);
+        }
+        return;
+    }
+    
     // Get current bytes per row (volatile)
     uint32 bpr = current_bytes_per_row;
-    int ppb = current_pixels_per_byte;
     
-    // Calculate start and end rows
+    // Rows and pixel columns of the first and last byte
     int start_y = offset / bpr;
     int end_y = (offset + size - 1) / bpr;
+    int pixel_col_start = bytePixel(offset % bpr);
+    int pixel_col_end = bytePixel((offset + size - 1) % bpr) + current_pixels_per_byte - 1;
     
-    // For small writes or writes within a single row, just mark individual bytes
-    if (end_y == start_y && size <= 4) {
-        // Simple case: mark start and end bytes
-        VideoMarkDirtyOffset(offset);
-        if (size > 1) {
-            VideoMarkDirtyOffset(offset + size - 1);
-        }
+    if (end_y == start_y) {
+        markDirtyPixels(pixel_col_start, start_y, pixel_col_end, end_y);
         return;
     }
     
-    // For larger writes spanning multiple rows, calculate affected tile columns
-    // This is more efficient than marking every byte individually
-    int start_byte_in_row = offset % bpr;
-    int end_byte_in_row = (offset + size - 1) % bpr;
-    
-    // Calculate pixel columns affected
-    int pixel_col_start = start_byte_in_row * ppb;
-    int pixel_col_end = (end_byte_in_row + 1) * ppb - 1;
-    
-    // For writes spanning multiple rows, the middle rows are fully affected
-    // So we need to consider columns from 0 to end for complex cases
-    if (end_y > start_y) {
-        // Multi-row write: could affect any column
-        pixel_col_start = 0;
-        pixel_col_end = MAC_SCREEN_WIDTH - 1;
+    // Across rows: the end of the first row, the whole rows between, and the
+    // start of the last row, so a move over a row boundary does not dirty
+    // every column of both rows
+    markDirtyPixels(pixel_col_start, start_y, current_width - 1, start_y);
+    if (end_y - start_y > 1) {
+        markDirtyPixels(0, start_y + 1, current_width - 1, end_y - 1);
     }
+    markDirtyPixels(0, end_y, pixel_col_end, end_y);
+}
+
+/*
+ *  Mark the tiles under a rectangle dirty (native QuickDraw fast paths)
+ *  
+ *  @param offset     Byte offset of the top left pixel in the Mac framebuffer
+ *  @param width      Rectangle width in bytes
+ *  @param height     Rectangle height in rows
+ *  @param row_bytes  Bytes per row of the Mac framebuffer
+ */
+void VideoMarkDirtyRect(uint32 offset, uint32 width, uint32 height, uint32 row_bytes)
+{
+    if (offset >= frame_buffer_size || width == 0 || height == 0 || row_bytes == 0) return;
     
-    // Calculate tile ranges
-    int tile_x_start = pixel_col_start / TILE_WIDTH;
-    int tile_x_end = pixel_col_end / TILE_WIDTH;
-    if (tile_x_end >= TILES_X) tile_x_end = TILES_X - 1;
-    
-    int tile_y_start = start_y / TILE_HEIGHT;
-    int tile_y_end = end_y / TILE_HEIGHT;
-    if (tile_y_end >= TILES_Y) tile_y_end = TILES_Y - 1;
-    
-    // Mark all affected tiles dirty
-    for (int tile_y = tile_y_start; tile_y <= tile_y_end; tile_y++) {
-        for (int tile_x = tile_x_start; tile_x <= tile_x_end; tile_x++) {
-            int tile_idx = tile_y * TILES_X + tile_x;
-            __atomic_or_fetch(&write_dirty_tiles[tile_idx / 32], (1u << (tile_idx % 32)), __ATOMIC_RELAXED);
+    int start_y = offset / row_bytes;
+    int pixel_col_start = bytePixel(offset % row_bytes);
+    int pixel_col_end = bytePixel((offset % row_bytes) + width - 1) + current_pixels_per_byte - 1;
+    markDirtyPixels(pixel_col_start, start_y, pixel_col_end, start_y + height - 1);
+}
+
+/*
+ *  Mark the tiles under a rectangle of Mac pixels dirty (native blitters and
+ *  writers that know pixels rather than frame buffer bytes)
+ *  
+ *  @param x, y  Top left pixel
+ *  @param w, h  Rectangle size in pixels
+ */
+void VideoMarkDirtyPixels(int x, int y, int w, int h)
+{
+    if (w <= 0 || h <= 0) return;
+    markDirtyPixels(x, y, x + w - 1, y + h - 1);
+}
+
+#if USE_DISPLAY_SCROLL
+/*
+ *  Check whether the display is behind the frame buffer anywhere in a
+ *  rectangle (Mac pixels, end exclusive): a band is dirty, or collected by
+ *  the video task and not pushed yet. Called with frame_spinlock held.
+ */
+static bool scrollSourceStale(int x0, int y0, int x1, int y1)
+{
+    bool busy = video_frame_busy;
+    for (int ty = y0 / current_tile_height; ty <= (y1 - 1) / current_tile_height; ty++) {
+        uint32 bands = dirtyBandMask(ty, y0, y1 - 1);
+        for (int tx = x0 / current_tile_width; tx <= (x1 - 1) / current_tile_width; tx++) {
+            int i = ty * TILES_X + tx;
+            if ((__atomic_load_n(&write_dirty_bands[i], __ATOMIC_RELAXED) & bands) || (busy && (dirty_bands[i] & bands))) {
+                return true;
+            }
         }
     }
+    return false;
 }
+#endif
 
 /*
- *  Collect write-dirty tiles into the render dirty bitmap and clear write bitmap
- *  Returns the number of dirty tiles
- *  Called at the start of each video frame
+ *  A rectangle of the frame buffer was moved down by dy rows (up if negative)
+ *  
+ *  Large moves whose source is up to date on the display are queued for the
+ *  video task, which moves the pixels on the display instead of converting
+ *  and pushing the whole area again. Everything else is marked dirty.
+ *  
+ *  @param offset     Byte offset of the top left pixel of the destination
+ *  @param width      Rectangle width in bytes
+ *  @param height     Rectangle height in rows
+ *  @param row_bytes  Bytes per row of the Mac framebuffer
+ *  @param dy         Rows the rectangle moved by
  */
-static int collectWriteDirtyTiles(void)
+void VideoScrollRect(uint32 offset, uint32 width, uint32 height, uint32 row_bytes, int dy)
 {
-    int count = 0;
-    
-    // Copy write_dirty_tiles to dirty_tiles and count
-    for (int i = 0; i < (TOTAL_TILES + 31) / 32; i++) {
-        // Atomically read and clear the write dirty bitmap
-        uint32 bits = __atomic_exchange_n(&write_dirty_tiles[i], 0, __ATOMIC_RELAXED);
-        dirty_tiles[i] = bits;
-        
-        // Count set bits (popcount)
-        while (bits) {
-            count += (bits & 1);
-            bits >>= 1;
+#if USE_DISPLAY_SCROLL
+    if (offset >= frame_buffer_size || width == 0 || height == 0 || row_bytes == 0) return;
+    
+    int y0 = offset / row_bytes;
+    int y1 = y0 + height;
+    int x0 = bytePixel(offset % row_bytes);
+    int x1 = bytePixel((offset % row_bytes) + width - 1) + current_pixels_per_byte;
+    if (x1 > current_width) x1 = current_width;
+    
+    // Small moves are cheaper to push again than to synchronize
+    bool queued = false;
+    if (dy != 0 && x0 < x1 && y1 <= current_height && y0 - dy >= 0 && y1 - dy <= current_height
+     && (x1 - x0) * (y1 - y0) >= 2 * current_tile_width * current_tile_height) {
+        portENTER_CRITICAL(&frame_spinlock);
+        if (scroll_move_count < MAX_SCROLL_MOVES && !scrollSourceStale(x0, y0 - dy, x1, y1 - dy)) {
+            scroll_move &m = scroll_moves[scroll_move_count++];
+            m.x0 = x0;
+            m.y0 = y0;
+            m.x1 = x1;
+            m.y1 = y1;
+            m.dy = dy;
+            queued = true;
         }
+        portEXIT_CRITICAL(&frame_spinlock);
     }
-    
-    return count;
+    if (!queued) {
+        VideoMarkDirtyRect(offset, width, height, row_bytes);
+    }
+#else
+    UNUSED(dy);
+    VideoMarkDirtyRect(offset, width, height, row_bytes);
+#endif
 }
 
+#if USE_TEAR_FREE
 /*
- *  Copy a single tile's source data from framebuffer to a snapshot buffer
- *  This creates a consistent snapshot of the tile to avoid race conditions
- *  when the CPU is writing to the framebuffer while we're rendering.
- *  
- *  For packed pixel modes, decodes to 8-bit indices in the snapshot buffer.
+ *  Copy the bands written since the last VBL to the present buffer
  *  
- *  @param src_buffer     Mac framebuffer (may be packed or 8-bit)
- *  @param tile_x         Tile column index (0 to TILES_X-1)
- *  @param tile_y         Tile row index (0 to TILES_Y-1)
- *  @param snapshot       Output buffer (TILE_WIDTH * TILE_HEIGHT bytes, always 8-bit indices)
+ *  Runs on the CPU core between instructions, so the copy is the frame
+ *  buffer exactly as the Mac left it. While the video task renders, the
+ *  VBL is skipped and its bands stay dirty for the next one.
  */
-static void snapshotTile(uint8 *src_buffer, int tile_x, int tile_y, uint8 *snapshot)
+static void presentFrame(void)
 {
-    int src_start_x = tile_x * TILE_WIDTH;
-    int src_start_y = tile_y * TILE_HEIGHT;
-    
-    // Get current depth and bytes per row (volatile, so copy locally)
-    video_depth depth = current_depth;
-    uint32 bpr = current_bytes_per_row;
+    int idle = PRESENT_IDLE;
+    if (present_buffer == NULL || !__atomic_compare_exchange_n(&present_state, &idle, PRESENT_COPYING, false,
+                                                               __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return;
+    }
     
-    // Copy and decode each row of the tile to the contiguous snapshot buffer
-    uint8 *dst = snapshot;
+    uint32 taken[TOTAL_TILES];
+    bool any = false;
+    for (int i = 0; i < TOTAL_TILES; i++) {
+        taken[i] = __atomic_exchange_n(&write_dirty_bands[i], 0, __ATOMIC_RELAXED);
+        present_dirty_bands[i] |= taken[i];
+        any |= taken[i] != 0;
+    }
     
-    if (depth == VDEPTH_8BIT) {
-        // 8-bit mode: direct copy, no decoding needed
-        for (int row = 0; row < TILE_HEIGHT; row++) {
-            uint8 *src = src_buffer + (src_start_y + row) * bpr + src_start_x;
-            memcpy(dst, src, TILE_WIDTH);
-            dst += TILE_WIDTH;
-        }
-    } else {
-        // Packed mode: need to decode pixels
-        // For each row, extract the tile's pixel range from the packed source
-        for (int row = 0; row < TILE_HEIGHT; row++) {
-            uint8 *src_row = src_buffer + (src_start_y + row) * bpr;
-            
-            // Decode TILE_WIDTH pixels starting at src_start_x
-            for (int x = 0; x < TILE_WIDTH; x++) {
-                int pixel_x = src_start_x + x;
-                
-                switch (depth) {
-                    case VDEPTH_1BIT: {
-                        int byte_idx = pixel_x / 8;
-                        int bit_idx = 7 - (pixel_x % 8);
-                        *dst++ = (src_row[byte_idx] >> bit_idx) & 0x01;
-                        break;
-                    }
-                    case VDEPTH_2BIT: {
-                        int byte_idx = pixel_x / 4;
-                        int shift = 6 - ((pixel_x % 4) * 2);
-                        *dst++ = (src_row[byte_idx] >> shift) & 0x03;
-                        break;
+    if (any) {
+        // Copy runs of adjacent tiles that share a dirty band, row by row
+        uint32 bpr = current_bytes_per_row;
+        int tile_bytes = current_tile_width * current_bytes_per_pixel / current_pixels_per_byte;
+        int band_rows = current_band_rows;
+        for (int ty = 0; ty < TILES_Y; ty++) {
+            for (int band = 0; band < TILE_BANDS; band++) {
+                int y = ty * current_tile_height + band * band_rows;
+                for (int tx = 0; tx < TILES_X; ) {
+                    if (!(taken[ty * TILES_X + tx] & (1u << band))) {
+                        tx++;
+                        continue;
                     }
-                    case VDEPTH_4BIT: {
-                        int byte_idx = pixel_x / 2;
-                        int shift = (pixel_x % 2 == 0) ? 4 : 0;
-                        *dst++ = (src_row[byte_idx] >> shift) & 0x0F;
-                        break;
+                    int run = tx;
+                    while (run < TILES_X && (taken[ty * TILES_X + run] & (1u << band))) run++;
+                    uint32 offset = y * bpr + tx * tile_bytes;
+                    uint32 size = (run - tx) * tile_bytes;
+                    for (int row = 0; row < band_rows; row++, offset += bpr) {
+                        memcpy(present_buffer + offset, mac_frame_buffer + offset, size);
                     }
-                    default:
-                        *dst++ = src_row[pixel_x];
-                        break;
+                    tx = run;
                 }
             }
         }
     }
+    
+    __atomic_store_n(&present_state, PRESENT_IDLE, __ATOMIC_RELEASE);
+    if (any) {
+        VideoSignalFrameReady();
+    }
 }
+#endif
 
 /*
- *  Render a tile from a contiguous snapshot buffer (not from framebuffer)
- *  This ensures we render from consistent data that won't change mid-render.
- *  
- *  @param snapshot        Tile snapshot buffer (TILE_WIDTH * TILE_HEIGHT bytes, contiguous)
- *  @param local_palette   Pre-copied palette for thread safety
- *  @param out_buffer      Output buffer for RGB565 pixels
+ *  Publish the overlay cursor (called by cursor_esp32.cpp on every cursor
+ *  vector call, so only real changes wake the video task's repaint)
  */
-static void renderTileFromSnapshot(uint8 *snapshot, uint16 *local_palette, uint16 *out_buffer)
+void VideoSetCursor(const uint16 *data, const uint16 *mask, int x, int y, bool visible)
 {
-    int tile_pixel_width = TILE_WIDTH * PIXEL_SCALE;  // 80 pixels
-    
-    uint8 *src = snapshot;
-    uint16 *out = out_buffer;
-    
-    // Process each row of the Mac tile
-    for (int row = 0; row < TILE_HEIGHT; row++) {
-        // Output row pointers (two rows for 2x vertical scaling)
-        uint16 *dst_row0 = out;
-        uint16 *dst_row1 = out + tile_pixel_width;
-        
-        // Process 4 pixels at a time for better memory bandwidth
-        int x = 0;
-        for (; x < TILE_WIDTH - 3; x += 4) {
-            // Read 4 source pixels at once (32-bit read)
-            uint32 src4 = *((uint32 *)src);
-            src += 4;
-            
-            // Convert each pixel through palette and write 2x2 scaled
-            uint16 c0 = local_palette[src4 & 0xFF];
-            uint16 c1 = local_palette[(src4 >> 8) & 0xFF];
-            uint16 c2 = local_palette[(src4 >> 16) & 0xFF];
-            uint16 c3 = local_palette[(src4 >> 24) & 0xFF];
-            
-            // Write to row 0 (2 pixels per source pixel)
-            dst_row0[0] = c0; dst_row0[1] = c0;
-            dst_row0[2] = c1; dst_row0[3] = c1;
-            dst_row0[4] = c2; dst_row0[5] = c2;
-            dst_row0[6] = c3; dst_row0[7] = c3;
-            
-            // Write to row 1 (duplicate of row 0)
-            dst_row1[0] = c0; dst_row1[1] = c0;
-            dst_row1[2] = c1; dst_row1[3] = c1;
-            dst_row1[4] = c2; dst_row1[5] = c2;
-            dst_row1[6] = c3; dst_row1[7] = c3;
-            
-            dst_row0 += 8;
-            dst_row1 += 8;
-        }
-        
-        // Handle remaining pixels (TILE_WIDTH=40 is divisible by 4, so this rarely runs)
-        for (; x < TILE_WIDTH; x++) {
-            uint16 c = local_palette[*src++];
-            dst_row0[0] = c; dst_row0[1] = c;
-            dst_row1[0] = c; dst_row1[1] = c;
-            dst_row0 += 2;
-            dst_row1 += 2;
-        }
-        
-        // Move output pointer by 2 rows (2x vertical scaling)
-        out += tile_pixel_width * 2;
+#if USE_CURSOR_OVERLAY
+    cursor_sprite &c = cursor_pending;
+    portENTER_CRITICAL(&frame_spinlock);
+    if (c.x != x || c.y != y || c.visible != visible
+     || memcmp(c.data, data, sizeof(c.data)) != 0 || memcmp(c.mask, mask, sizeof(c.mask)) != 0) {
+        memcpy(c.data, data, sizeof(c.data));
+        memcpy(c.mask, mask, sizeof(c.mask));
+        c.x = x;
+        c.y = y;
+        c.visible = visible;
+        cursor_changed = true;
     }
+    portEXIT_CRITICAL(&frame_spinlock);
+#else
+    UNUSED(data);
+    UNUSED(mask);
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(visible);
+#endif
 }
 
 /*
- *  Render and push only dirty tiles to the display
+ *  Collect write-dirty row bands into dirty_bands, build the render dirty
+ *  bitmap from them and clear the write masks
+ *  Returns the number of dirty tiles
+ *  Called at the start of each video frame
+ */
+static int collectWriteDirtyTiles(void)
+{
+    int count = 0;
+    
+    memset(dirty_tiles, 0, sizeof(dirty_tiles));
+    for (int i = 0; i < TOTAL_TILES; i++) {
+#if USE_TEAR_FREE
+        // The bands presented since the last frame, the CPU is not copying now
+        uint32 bands = present_dirty_bands[i];
+        present_dirty_bands[i] = 0;
+#else
+        // Atomically read and clear the write dirty mask of the tile
+        uint32 bands = __atomic_exchange_n(&write_dirty_bands[i], 0, __ATOMIC_RELAXED);
+#endif
+        dirty_bands[i] = bands;
+        if (bands) {
+            dirty_tiles[i / 32] |= 1u << (i % 32);
+            count++;
+        }
+    }
+    
+    return count;
+}
+
+/*
+ *  Mark the tiles that use a changed palette entry dirty
+ *  
+ *  Their pixels did not change, so any stored band hashes are invalidated
+ *  for the bands to be pushed again.
+ *  
+ *  @param changed  Bit per palette index that changed
+ *  @return         Number of tiles that were not dirty before
+ */
+static int markPaletteDirtyTiles(const uint32 *changed)
+{
+    int count = 0;
+    
+    for (int i = 0; i < TOTAL_TILES; i++) {
+        uint32 used = 0;
+        for (int w = 0; w < 256 / 32; w++) {
+            used |= tile_colors[i][w] & changed[w];
+        }
+        if (!used) continue;
+        
+        if (!dirty_bands[i]) count++;
+        dirty_bands[i] = TILE_BANDS_ALL;
+        dirty_tiles[i / 32] |= 1u << (i % 32);
+#if USE_TILE_HASH
+        for (int band = 0; band < TILE_BANDS; band++) {
+            tile_band_hash[i * TILE_BANDS + band] = ~tile_band_hash[i * TILE_BANDS + band];
+        }
+#endif
+    }
+    
+    return count;
+}
+
+/*
+ *  Mark the row bands under an overlay (cursor, HUD) dirty
+ *  
+ *  The frame buffer did not change there, so the stored band hashes are
+ *  invalidated for the bands to be pushed with the overlay drawn (or erased).
+ *  
+ *  @param x, y           Top left Mac pixel, may be off screen
+ *  @param width, height  Size in Mac pixels
+ *  @return               Number of tiles that were not dirty before
+ */
+template <int SCALE>
+static int markAreaDirtyTiles(int x, int y, int width, int height)
+{
+    typedef screen_geometry<SCALE> geo;
+    int x0 = (x < 0) ? 0 : x;
+    int y0 = (y < 0) ? 0 : y;
+    int x1 = (x + width > geo::width) ? geo::width - 1 : x + width - 1;
+    int y1 = (y + height > geo::height) ? geo::height - 1 : y + height - 1;
+    if (x0 > x1 || y0 > y1) return 0;
+    
+    int count = 0;
+    for (int ty = y0 / geo::tile_height; ty <= y1 / geo::tile_height; ty++) {
+        int top = ty * geo::tile_height;
+        int first = (y0 <= top) ? 0 : (y0 - top) / geo::band_rows;
+        int last = (y1 >= top + geo::tile_height - 1) ? TILE_BANDS - 1 : (y1 - top) / geo::band_rows;
+        uint32 bands = (TILE_BANDS_ALL >> (TILE_BANDS - 1 - last)) & ~((1u << first) - 1);
+        for (int tx = x0 / geo::tile_width; tx <= x1 / geo::tile_width; tx++) {
+            int i = ty * TILES_X + tx;
+            if (!dirty_bands[i]) count++;
+            dirty_bands[i] |= bands;
+            dirty_tiles[i / 32] |= 1u << (i % 32);
+#if USE_TILE_HASH
+            for (int band = 0; band < TILE_BANDS; band++) {
+                if (bands & (1u << band)) {
+                    tile_band_hash[i * TILE_BANDS + band] = ~tile_band_hash[i * TILE_BANDS + band];
+                }
+            }
+#endif
+        }
+    }
+    
+    return count;
+}
+
+#if USE_CURSOR_OVERLAY
+/*
+ *  Mark the row bands under the overlay cursor dirty
+ *  
+ *  @param c  Cursor sprite, nothing is marked if it is hidden
+ *  @return   Number of tiles that were not dirty before
+ */
+template <int SCALE>
+static int markCursorDirtyTiles(const cursor_sprite &c)
+{
+    if (!c.visible) return 0;
+    return markAreaDirtyTiles<SCALE>(c.x, c.y, CURSOR_SIZE, CURSOR_SIZE);
+}
+
+/*
+ *  Draw the overlay cursor into a rendered band
+ *  
+ *  Mask and data bits give black, mask only white, data only inverts the
+ *  pixel below, as the ROM's cursor does.
+ *  
+ *  @param out        Rendered band (SCALE*mac_width x SCALE*rows RGB565 pixels)
+ *  @param mac_x      First Mac pixel column of the band
+ *  @param mac_y      First Mac row of the band
+ *  @param mac_width  Band width in Mac pixels
+ *  @param rows       Band height in Mac rows
+ */
+template <int SCALE>
+static void compositeCursor(uint16 *out, int mac_x, int mac_y, int mac_width, int rows)
+{
+    const cursor_sprite &c = cursor_shown;
+    if (!c.visible) return;
+    
+    int x0 = (c.x > mac_x) ? c.x : mac_x;
+    int y0 = (c.y > mac_y) ? c.y : mac_y;
+    int x1 = (c.x + CURSOR_SIZE < mac_x + mac_width) ? c.x + CURSOR_SIZE : mac_x + mac_width;
+    int y1 = (c.y + CURSOR_SIZE < mac_y + rows) ? c.y + CURSOR_SIZE : mac_y + rows;
+    int out_width = mac_width * SCALE;
+    
+    for (int y = y0; y < y1; y++) {
+        uint16 data = c.data[y - c.y];
+        uint16 mask = c.mask[y - c.y];
+        uint16 *row = out + (y - mac_y) * SCALE * out_width;
+        for (int x = x0; x < x1; x++) {
+            uint16 bit = 0x8000 >> (x - c.x);
+            if (!((data | mask) & bit)) continue;
+            
+            // Black and white are 0x0000 and 0xffff in either RGB565 byte order
+            uint16 *p = row + (x - mac_x) * SCALE;
+            for (int dy = 0; dy < SCALE; dy++) {
+                for (int dx = 0; dx < SCALE; dx++) {
+                    if (mask & bit) {
+                        p[dx] = (data & bit) ? 0x0000 : 0xffff;
+                    } else {
+                        p[dx] = ~p[dx];
+                    }
+                }
+                p += out_width;
+            }
+        }
+    }
+}
+#endif
+
+#if PERF_HUD
+// HUD as the video task shows it, and whether the strip must be pushed
+static bool hud_shown = false;
+static bool hud_push = false;
+
+/*
+ *  Copy the HUD strip over a rendered band
+ *  
+ *  @param out        Rendered band (SCALE*mac_width x SCALE*rows RGB565 pixels)
+ *  @param mac_x      First Mac pixel column of the band
+ *  @param mac_y      First Mac row of the band
+ *  @param mac_width  Band width in Mac pixels
+ *  @param rows       Band height in Mac rows
+ */
+template <int SCALE>
+static void compositeHud(uint16 *out, int mac_x, int mac_y, int mac_width, int rows)
+{
+    const uint16 *hud = HudPixels();
+    if (!hud_shown || hud == NULL) return;
+    
+    int left = mac_x * SCALE, top = mac_y * SCALE;
+    int out_width = mac_width * SCALE;
+    int x0 = (HUD_X > left) ? HUD_X : left;
+    int y0 = (HUD_Y > top) ? HUD_Y : top;
+    int x1 = (HUD_X + HUD_WIDTH < left + out_width) ? HUD_X + HUD_WIDTH : left + out_width;
+    int y1 = (HUD_Y + HUD_HEIGHT < top + rows * SCALE) ? HUD_Y + HUD_HEIGHT : top + rows * SCALE;
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    for (int y = y0; y < y1; y++) {
+        memcpy(out + (y - top) * out_width + (x0 - left),
+               hud + (y - HUD_Y) * HUD_WIDTH + (x0 - HUD_X), (x1 - x0) * sizeof(uint16));
+    }
+}
+
+/*
+ *  Mark the row bands under the HUD strip dirty, to repaint the Mac screen
+ *  there once it is hidden
+ */
+static int markHudDirtyTiles(int scale)
+{
+    if (scale == 1) {
+        return markAreaDirtyTiles<1>(HUD_X, HUD_Y, HUD_WIDTH, HUD_HEIGHT);
+    }
+    return markAreaDirtyTiles<2>(HUD_X / 2, HUD_Y / 2, HUD_WIDTH / 2, HUD_HEIGHT / 2);
+}
+
+/*
+ *  Push the whole strip after a refresh (video task, outside a frame)
+ */
+static void pushHud(void)
+{
+    const uint16 *hud = HudPixels();
+    if (hud == NULL) return;
+    M5.Display.startWrite();
+    M5.Display.setAddrWindow(HUD_X, HUD_Y, HUD_WIDTH, HUD_HEIGHT);
+    M5.Display.writePixels(hud, HUD_WIDTH * HUD_HEIGHT);
+    M5.Display.endWrite();
+}
+#endif
+
+#if USE_DISPLAY_SCROLL
+/*
+ *  Apply queued scroll moves to the display
+ *  
+ *  The display moves the pixels it already shows, so only the strip a
+ *  scroll exposes is converted and pushed. The destination tiles get the
+ *  colors of their source tiles (for markPaletteDirtyTiles()) and their
+ *  band hashes invalidated, the display no longer shows what they hashed.
+ *  
+ *  @param moves  Moves in the order the frame buffer was changed
+ *  @param count  Number of moves
+ *  @return       Number of tiles that were not dirty before
+ */
+template <int SCALE>
+static int applyScrollMoves(const scroll_move *moves, int count)
+{
+    typedef screen_geometry<SCALE> geo;
+    int marked = 0;
+    
+    M5.Display.startWrite();
+    for (int n = 0; n < count; n++) {
+        const scroll_move &m = moves[n];
+        M5.Display.copyRect(m.x0 * SCALE, m.y0 * SCALE, (m.x1 - m.x0) * SCALE, (m.y1 - m.y0) * SCALE,
+                            m.x0 * SCALE, (m.y0 - m.dy) * SCALE);
+#if REMOTE_DISPLAY
+        if (RemoteActive()) {
+            RemoteMarkDirty(m.x0, m.y0, m.x1 - m.x0, m.y1 - m.y0);
+        }
+#endif
+        
+        int src_top = (m.y0 - m.dy) / geo::tile_height;
+        int src_bottom = (m.y1 - 1 - m.dy) / geo::tile_height;
+        for (int tx = m.x0 / geo::tile_width; tx <= (m.x1 - 1) / geo::tile_width; tx++) {
+            uint32 colors[256 / 32] = {0};
+            for (int ty = src_top; ty <= src_bottom; ty++) {
+                for (int w = 0; w < 256 / 32; w++) {
+                    colors[w] |= tile_colors[ty * TILES_X + tx][w];
+                }
+            }
+            for (int ty = m.y0 / geo::tile_height; ty <= (m.y1 - 1) / geo::tile_height; ty++) {
+                int i = ty * TILES_X + tx;
+                for (int w = 0; w < 256 / 32; w++) {
+                    tile_colors[i][w] |= colors[w];
+                }
+#if USE_TILE_HASH
+                for (int band = 0; band < TILE_BANDS; band++) {
+                    tile_band_hash[i * TILE_BANDS + band] = ~tile_band_hash[i * TILE_BANDS + band];
+                }
+#endif
+            }
+        }
+        
+#if USE_CURSOR_OVERLAY
+        // The move took the composited cursor along and may have covered it
+        if (cursor_shown.visible) {
+            cursor_sprite moved = cursor_shown;
+            moved.y += m.dy;
+            marked += markCursorDirtyTiles<SCALE>(cursor_shown);
+            marked += markCursorDirtyTiles<SCALE>(moved);
+        }
+#endif
+#if PERF_HUD
+        // The move took the HUD along or covered part of it: repaint where
+        // it took it to, and push the strip again
+        if (hud_shown && m.x0 * SCALE < HUD_X + HUD_WIDTH && m.x1 * SCALE > HUD_X &&
+            (m.y0 - m.dy) * SCALE < HUD_Y + HUD_HEIGHT && (m.y1 - m.dy) * SCALE > HUD_Y) {
+            int y0 = HUD_Y / SCALE + m.dy;
+            int y1 = (HUD_Y + HUD_HEIGHT) / SCALE + m.dy;
+            if (y0 < m.y0) y0 = m.y0;
+            if (y1 > m.y1) y1 = m.y1;
+            int x0 = (HUD_X / SCALE > m.x0) ? HUD_X / SCALE : m.x0;
+            int x1 = ((HUD_X + HUD_WIDTH) / SCALE < m.x1) ? (HUD_X + HUD_WIDTH) / SCALE : m.x1;
+            if (y0 < y1) marked += markAreaDirtyTiles<SCALE>(x0, y0, x1 - x0, y1 - y0);
+        }
+        if (hud_shown && m.x0 * SCALE < HUD_X + HUD_WIDTH && m.x1 * SCALE > HUD_X &&
+            m.y0 * SCALE < HUD_Y + HUD_HEIGHT && m.y1 * SCALE > HUD_Y) {
+            hud_push = true;
+        }
+#endif
+    }
+    M5.Display.endWrite();
+    
+    return marked;
+}
+#endif
+
+/*
+ *  Merge the dirty tiles into rectangles
+ *  
+ *  Each tile row is split into runs of adjacent dirty tiles first. A run
+ *  covers the Mac rows from the first to the last dirty row band of any of
+ *  its tiles, so a caret blink renders a few rows instead of a whole tile.
+ *  A run that spans the same columns as a rectangle and starts on the row
+ *  right below it extends that rectangle downwards; any other run starts a
+ *  new rectangle. A line of text becomes one rectangle instead of a tile per
+ *  character cell, and a full update becomes a single rectangle covering the
+ *  screen.
+ *  
+ *  @return  Number of rectangles in dirty_rects[]
+ */
+template <int SCALE>
+static int coalesceDirtyTiles(void)
+{
+    typedef screen_geometry<SCALE> geo;
+    int count = 0;
+    
+    for (int ty = 0; ty < TILES_Y; ty++) {
+        int row_first = count;  // Rectangles started on this row are not extended by it
+        int tx = 0;
+        
+        while (tx < TILES_X) {
+            if (!isTileDirty(ty * TILES_X + tx)) {
+                tx++;
+                continue;
+            }
+            
+            // Row run of dirty tiles [x0, tx), and the union of their bands
+            int x0 = tx;
+            uint32 bands = 0;
+            while (tx < TILES_X && isTileDirty(ty * TILES_X + tx)) {
+                bands |= dirty_bands[ty * TILES_X + tx];
+                tx++;
+            }
+            int w = tx - x0;
+            int y0 = ty * geo::tile_height + __builtin_ctz(bands) * geo::band_rows;
+            int y1 = ty * geo::tile_height + (32 - __builtin_clz(bands)) * geo::band_rows;
+            
+            // Vertical merge with a rectangle of the same columns ending right above
+            bool merged = false;
+            for (int i = 0; i < row_first; i++) {
+                dirty_rect &r = dirty_rects[i];
+                if (r.x == x0 && r.w == w && r.y1 == y0) {
+                    r.y1 = y1;
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged) {
+                dirty_rect &r = dirty_rects[count++];
+                r.x = x0;
+                r.w = w;
+                r.y0 = y0;
+                r.y1 = y1;
+            }
+        }
+    }
+    
+    return count;
+}
+
+#if USE_POINTER_FIRST
+/*
+ *  Move the dirty rectangles at the mouse pointer to the front
+ *  
+ *  Rectangles come out of coalesceDirtyTiles() in raster order, so with
+ *  much of the screen dirty the tiles under the pointer could be pushed
+ *  last, most of a frame after the click or drag that changed them. The
+ *  rectangles touching the pointer's tile or its 8 neighbours are pushed
+ *  first. Their rows above and below the neighbourhood are split off and
+ *  keep their raster place, so a full update starts at the pointer and
+ *  costs no more to push. The pointer is the Mac's own (low memory Mouse),
+ *  which also follows touches and scripted input.
+ *  
+ *  @param count  Number of rectangles in dirty_rects[]
+ *  @return       Number of rectangles after the splits
+ */
+template <int SCALE>
+static int pointerRectsFirst(int count)
+{
+    typedef screen_geometry<SCALE> geo;
+    int tx = (int16)ReadMacInt16(0x832) / geo::tile_width;     // Mouse.h
+    int ty = (int16)ReadMacInt16(0x830) / geo::tile_height;    // Mouse.v
+    if (count == 0 || tx < 0 || tx >= TILES_X || ty < 0 || ty >= TILES_Y) {
+        return count;
+    }
+    
+    // Mac rows of the neighbourhood, whole tile rows
+    int near_y0 = (ty > 0 ? ty - 1 : 0) * geo::tile_height;
+    int near_y1 = (ty + 2 < TILES_Y ? ty + 2 : TILES_Y) * geo::tile_height;
+    
+    // Rectangles hold disjoint tiles: at most 9 touch the 3x3 tiles. Each
+    // may leave a piece above and one below in its raster place.
+    dirty_rect near[9];
+    int near_count = 0, extra = 0;
+    bool moved = false;
+    for (int i = 0; i < count; i++) {
+        const dirty_rect &r = dirty_rects[i];
+        if (r.x <= tx + 1 && r.x + r.w >= tx && r.y0 < near_y1 && r.y1 > near_y0) {
+            dirty_rect &n = near[near_count];
+            n = r;
+            if (r.y0 < near_y0) { n.y0 = near_y0; extra++; }
+            if (r.y1 > near_y1) { n.y1 = near_y1; extra++; }
+            moved |= i != near_count;
+            near_count++;
+        }
+    }
+    if (!moved && extra == 0) {
+        return count;
+    }
+    
+    // The others and the split pieces, from the back: each lands at or
+    // after the place it is read from
+    int total = count + extra;
+    int out = total;
+    for (int i = count - 1; i >= 0; i--) {
+        dirty_rect r = dirty_rects[i];
+        if (r.x <= tx + 1 && r.x + r.w >= tx && r.y0 < near_y1 && r.y1 > near_y0) {
+            if (r.y1 > near_y1) {
+                dirty_rects[--out] = r;
+                dirty_rects[out].y0 = near_y1;
+            }
+            if (r.y0 < near_y0) {
+                dirty_rects[--out] = r;
+                dirty_rects[out].y1 = near_y0;
+            }
+        } else {
+            dirty_rects[--out] = r;
+        }
+    }
+    memcpy(dirty_rects, near, near_count * sizeof(dirty_rect));
+    perf_add(perf_pointer_rects, near_count);
+    return total;
+}
+#endif
+
+/*
+ *  Set or clear the render lock of every tile of a dirty rectangle
+ */
+template <int SCALE>
+static void setRectRenderActive(const dirty_rect &r, bool active)
+{
+#if USE_TEAR_FREE
+    // The video task reads the present buffer, the CPU leaves it alone meanwhile
+    UNUSED(r);
+    UNUSED(active);
+#else
+    typedef screen_geometry<SCALE> geo;
+    for (int ty = r.y0 / geo::tile_height; ty <= (r.y1 - 1) / geo::tile_height; ty++) {
+        for (int tx = r.x; tx < r.x + r.w; tx++) {
+            if (active) {
+                setTileRenderActive(ty * TILES_X + tx);
+            } else {
+                clearTileRenderActive(ty * TILES_X + tx);
+            }
+        }
+    }
+#endif
+}
+
+/*
+ *  Copy a block of the framebuffer to a contiguous snapshot buffer
+ *  This creates a consistent snapshot of the block to avoid race conditions
+ *  when the CPU is writing to the framebuffer while we're rendering.
+ *  
+ *  For packed pixel modes, decodes to 8-bit indices in the snapshot buffer.
+ *  In 16-bit mode the snapshot holds the RGB565 pixels as they are.
+ *  
+ *  @param src_buffer     Mac framebuffer (may be packed, 8-bit or RGB565)
+ *  @param x              First Mac pixel column (multiple of the tile width, so byte aligned)
+ *  @param y              First Mac row
+ *  @param width          Block width in Mac pixels (multiple of the tile width)
+ *  @param rows           Block height in Mac rows
+ *  @param snapshot       Output buffer (width * rows pixels: 8-bit indices or RGB565)
+ */
+static void snapshotBlock(uint8 *src_buffer, int x, int y, int width, int rows, uint8 *snapshot)
+{
+    // Mode of this frame
+    bool direct_color = (frame_mode.depth == VDEPTH_16BIT);
+    uint32 bpr = frame_mode.bytes_per_row;
+    int pixels_per_byte = frame_mode.pixels_per_byte;
+    row_decoder decode = frame_mode.decode;
+    
+    // Copy and decode each row of the block to the contiguous snapshot buffer
+    uint8 *dst = snapshot;
+    
+    for (int row = 0; row < rows; row++) {
+        const uint8 *src_row = src_buffer + (y + row) * bpr;
+        
+        if (direct_color) {
+            // 16-bit mode: RGB565 already, two bytes per pixel
+            memcpy(dst, src_row + x * 2, width * 2);
+            dst += width * 2;
+        } else {
+            // 8-bit mode is a plain copy, packed modes decode to 8-bit indices
+            decode(src_row + x / pixels_per_byte, dst, width);
+            dst += width;
+        }
+    }
+}
+
+/*
+ *  Expand a row of 8-bit indices to RGB565, every pixel doubled horizontally
+ *  
+ *  The palette holds each color twice (low and high half of a word), so a
+ *  pixel costs one table load and one 32-bit store instead of two 16-bit
+ *  lookups and stores. This is the kernel of both the tile and the streaming
+ *  renderer; the second display row of each Mac row is a memcpy() of the
+ *  first.
+ *  
+ *  @param src        Row of 8-bit indices (4-byte aligned)
+ *  @param dst        Output, width doubled pixels (4-byte aligned)
+ *  @param palette2x  Doubled RGB565 palette
+ *  @param width      Number of source pixels
+ */
+static inline void expandRow2x(const uint8 *src, uint32 *dst, const uint32 *palette2x, int width)
+{
+    int x = 0;
+    for (; x <= width - 4; x += 4) {
+        // Read 4 source pixels at once (32-bit read)
+        uint32 src4 = *((const uint32 *)(src + x));
+        dst[x]     = palette2x[src4 & 0xFF];
+        dst[x + 1] = palette2x[(src4 >> 8) & 0xFF];
+        dst[x + 2] = palette2x[(src4 >> 16) & 0xFF];
+        dst[x + 3] = palette2x[src4 >> 24];
+    }
+    for (; x < width; x++) {
+        dst[x] = palette2x[src[x]];
+    }
+}
+
+/*
+ *  Expand a row of 8-bit indices to RGB565 at native size
+ *  
+ *  Two pixels are combined into one 32-bit store, the low half of the first
+ *  doubled palette entry and the high half of the second.
+ *  
+ *  @param src        Row of 8-bit indices (4-byte aligned)
+ *  @param dst        Output, width pixels (4-byte aligned)
+ *  @param palette2x  Doubled RGB565 palette
+ *  @param width      Number of source pixels (even)
+ */
+static inline void expandRow1x(const uint8 *src, uint32 *dst, const uint32 *palette2x, int width)
+{
+    int x = 0;
+    for (; x <= width - 4; x += 4) {
+        uint32 src4 = *((const uint32 *)(src + x));
+        dst[x / 2]     = (palette2x[src4 & 0xFF] & 0xFFFF) | (palette2x[(src4 >> 8) & 0xFF] & 0xFFFF0000);
+        dst[x / 2 + 1] = (palette2x[(src4 >> 16) & 0xFF] & 0xFFFF) | (palette2x[src4 >> 24] & 0xFFFF0000);
+    }
+    for (; x < width; x += 2) {
+        dst[x / 2] = (palette2x[src[x]] & 0xFFFF) | (palette2x[src[x + 1]] & 0xFFFF0000);
+    }
+}
+
+/*
+ *  Render a block from a contiguous snapshot buffer (not from framebuffer)
+ *  This ensures we render from consistent data that won't change mid-render.
+ *  
+ *  @param snapshot        Block snapshot buffer (width * rows bytes, contiguous)
+ *  @param width           Block width in Mac pixels
+ *  @param rows            Block height in Mac rows
+ *  @param local_palette   Pre-copied doubled palette for thread safety
+ *  @param out_buffer      Output buffer for RGB565 pixels (SCALE*width x SCALE*rows)
+ */
+template <int SCALE>
+static void renderBlockFromSnapshot(const uint8 *snapshot, int width, int rows, uint32 *local_palette, uint16 *out_buffer)
+{
+    int out_width = width * SCALE;
+    
+    const uint8 *src = snapshot;
+    uint16 *out = out_buffer;
+    
+    for (int row = 0; row < rows; row++) {
+        if (SCALE == 1) {
+            expandRow1x(src, (uint32 *)out, local_palette, width);
+        } else {
+            // Each Mac row becomes two identical display rows (2x vertical scaling)
+            expandRow2x(src, (uint32 *)out, local_palette, width);
+            memcpy(out + out_width, out, out_width * sizeof(uint16));
+        }
+        
+        src += width;
+        out += out_width * SCALE;
+    }
+}
+
+/*
+ *  Render a 16-bit block snapshot: the pixels are RGB565 in display order,
+ *  so they are only doubled, without a palette lookup
+ *  
+ *  @param snapshot        Block snapshot buffer (width * rows RGB565 pixels)
+ *  @param width           Block width in Mac pixels
+ *  @param rows            Block height in Mac rows
+ *  @param out_buffer      Output buffer for RGB565 pixels (SCALE*width x SCALE*rows)
+ */
+template <int SCALE>
+static void renderBlockFromSnapshot16(const uint16 *snapshot, int width, int rows, uint16 *out_buffer)
+{
+    if (SCALE == 1) {
+        memcpy(out_buffer, snapshot, width * rows * sizeof(uint16));
+        return;
+    }
+    
+    int out_width = width * SCALE;
+    
+    const uint16 *src = snapshot;
+    uint16 *out = out_buffer;
+    
+    for (int row = 0; row < rows; row++) {
+        // Write each pixel twice as one 32-bit store, then copy the row
+        uint32 *dst = (uint32 *)out;
+        for (int x = 0; x < width; x++) {
+            dst[x] = src[x] * 0x10001u;
+        }
+        memcpy(out + out_width, out, out_width * sizeof(uint16));
+        
+        src += width;
+        out += out_width * 2;
+    }
+}
+
+#if USE_RENDER_ASSIST
+/*
+ *  Render assist: the CPU task converts the lower half of a band
+ *  
+ *  After an application switch Core 0 converts a screen full of bands
+ *  while the Mac waits for it, and Core 1 sleeps in idle_wait(). The video
+ *  task now posts the lower half of each large band and wakes the CPU task
+ *  if it sleeps there; it converts the upper half meanwhile. Then it takes
+ *  the lower half back if nobody took it, or waits for the CPU task to
+ *  finish it. Only the band snapshot and the output buffer are shared, both
+ *  owned by the video task until it has the half back: the snapshot was
+ *  taken under the render lock as before, and the frame buffer is not read.
+ */
+#define ASSIST_MIN_ROWS 8       // Smaller bands are not worth the handover
+
+enum {
+    ASSIST_IDLE,                // No job
+    ASSIST_POSTED,              // Waiting for the CPU task
+    ASSIST_TAKEN,               // Being converted by the CPU task
+    ASSIST_DONE                 // Converted, for the video task to take back
+};
+
+struct assist_job {
+    const uint16 *snapshot;     // First row of the half (8-bit indices or RGB565)
+    int width, rows;
+    const uint32 *palette;
+    uint16 *out;                // First output row of the half
+    int scale;
+    bool direct_color;
+};
+static assist_job assist;                           // Written before ASSIST_POSTED (video task)
+static volatile uint32 assist_state = ASSIST_IDLE;
+static volatile uint32 render_assist = 1;           // 0: the video task converts all (console tunable)
+
+static void runAssistJob(const assist_job &j)
+{
+    if (j.direct_color) {
+        if (j.scale == 1) renderBlockFromSnapshot16<1>(j.snapshot, j.width, j.rows, j.out);
+        else renderBlockFromSnapshot16<2>(j.snapshot, j.width, j.rows, j.out);
+    } else {
+        uint32 *palette = (uint32 *)j.palette;
+        if (j.scale == 1) renderBlockFromSnapshot<1>((const uint8 *)j.snapshot, j.width, j.rows, palette, j.out);
+        else renderBlockFromSnapshot<2>((const uint8 *)j.snapshot, j.width, j.rows, palette, j.out);
+    }
+}
+
+/*
+ *  CPU task, idle in idle_wait(): convert the posted half, if any
+ *  
+ *  @return  True if it converted one
+ */
+bool VideoAssist(void)
+{
+    uint32 expected = ASSIST_POSTED;
+    if (!__atomic_compare_exchange_n(&assist_state, &expected, ASSIST_TAKEN, false,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return false;
+    }
+    runAssistJob(assist);
+    __atomic_store_n(&assist_state, ASSIST_DONE, __ATOMIC_RELEASE);
+    return true;
+}
+
+/*
+ *  Video task: convert a band with the CPU task's help
+ *  
+ *  @return  False (nothing converted) if the band is too small to share
+ */
+template <int SCALE>
+static bool renderBandAssisted(const uint16 *snapshot, int width, int rows, uint32 *local_palette,
+                               uint16 *out_buffer, bool direct_color)
+{
+    if (!render_assist || rows < ASSIST_MIN_ROWS) {
+        return false;
+    }
+    
+    int top = rows / 2;
+    assist.snapshot = direct_color ? snapshot + top * width : (const uint16 *)((const uint8 *)snapshot + top * width);
+    assist.width = width;
+    assist.rows = rows - top;
+    assist.palette = local_palette;
+    assist.out = out_buffer + top * width * SCALE * SCALE;
+    assist.scale = SCALE;
+    assist.direct_color = direct_color;
+    __atomic_store_n(&assist_state, ASSIST_POSTED, __ATOMIC_RELEASE);
+    idle_resume();
+    
+    if (direct_color) {
+        renderBlockFromSnapshot16<SCALE>(snapshot, width, top, out_buffer);
+    } else {
+        renderBlockFromSnapshot<SCALE>((const uint8 *)snapshot, width, top, local_palette, out_buffer);
+    }
+    
+    // Take the half back, or wait for the CPU task to finish it
+    uint32 expected = ASSIST_POSTED;
+    if (__atomic_compare_exchange_n(&assist_state, &expected, ASSIST_IDLE, false,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        runAssistJob(assist);
+    } else {
+        while (__atomic_load_n(&assist_state, __ATOMIC_ACQUIRE) != ASSIST_DONE) {
+        }
+        __atomic_store_n(&assist_state, ASSIST_IDLE, __ATOMIC_RELAXED);
+        perf_inc(perf_assist_bands);
+    }
+    return true;
+}
+#endif
+
+/*
+ *  Record the palette indices of an 8-bit band snapshot in tile_colors
+ *  
+ *  @param snapshot  Band snapshot of 8-bit indices (see snapshotBlock())
+ *  @param tile_x    First tile column of the band
+ *  @param width     Band width in Mac pixels (multiple of the tile width)
+ *  @param mac_y     First Mac row
+ *  @param rows      Band height in Mac rows
+ */
+template <int SCALE>
+static void recordBandColors(const uint8 *snapshot, int tile_x, int width, int mac_y, int rows)
+{
+    typedef screen_geometry<SCALE> geo;
+    const uint8 *src = snapshot;
+    
+    for (int row = 0; row < rows; row++) {
+        int tile_row = ((mac_y + row) / geo::tile_height) * TILES_X + tile_x;
+        for (int c = 0; c < width / geo::tile_width; c++) {
+            uint32 *used = tile_colors[tile_row + c];
+            for (int x = 0; x < geo::tile_width; x++) {
+                uint8 p = *src++;
+                used[p / 32] |= 1u << (p % 32);
+            }
+        }
+    }
+}
+
+#if USE_TILE_HASH
+/*
+ *  Hash one cell of a band snapshot: one tile width by one row band
+ */
+template <int SCALE>
+static inline uint32 hashSnapshotCell(const uint8 *cell, int cell_bytes, int row_bytes)
+{
+    uint32 h = 0x811c9dc5;
+    for (int row = 0; row < screen_geometry<SCALE>::band_rows; row++) {
+        const uint32 *p = (const uint32 *)(cell + row * row_bytes);
+        for (int i = 0; i < cell_bytes / 4; i++) {
+            h = (h ^ p[i]) * 0x9e3779b1;
+            h = (h << 13) | (h >> 19);
+        }
+    }
+    return h;
+}
+
+/*
+ *  Compare a band snapshot with what was last pushed for its tiles
+ *  
+ *  The snapshot is hashed in cells of one tile column by one row band, the
+ *  granularity of the dirty masks, and each hash replaces the stored one.
+ *  Hashing 4 bytes at a time from SRAM costs much less than rendering and
+ *  pushing the band.
+ *  
+ *  @param snapshot         Band snapshot (see snapshotBlock())
+ *  @param tile_x           First tile column of the band
+ *  @param width            Band width in Mac pixels (multiple of the tile width)
+ *  @param mac_y            First Mac row (multiple of the band rows)
+ *  @param rows             Band height in Mac rows (multiple of the band rows)
+ *  @param bytes_per_pixel  Snapshot bytes per pixel (2 in 16-bit mode, 1 otherwise)
+ *  @param refresh          Record the hashes only, the band is pushed anyway
+ *  @return                 true if the band must be pushed
+ */
+template <int SCALE>
+static bool bandSnapshotChanged(const uint8 *snapshot, int tile_x, int width, int mac_y, int rows,
+                                int bytes_per_pixel, bool refresh)
+{
+    typedef screen_geometry<SCALE> geo;
+    bool changed = refresh;
+    int row_bytes = width * bytes_per_pixel;
+    int cell_bytes = geo::tile_width * bytes_per_pixel;
+    
+    for (int y = 0; y < rows; y += geo::band_rows) {
+        int band_y = mac_y + y;
+        int tile_row = (band_y / geo::tile_height) * TILES_X + tile_x;
+        int band = (band_y % geo::tile_height) / geo::band_rows;
+        
+        for (int c = 0; c < width / geo::tile_width; c++) {
+            uint32 h = hashSnapshotCell<SCALE>(snapshot + y * row_bytes + c * cell_bytes, cell_bytes, row_bytes);
+            uint32 &stored = tile_band_hash[(tile_row + c) * TILE_BANDS + band];
+            if (stored != h) {
+                stored = h;
+                changed = true;
+            }
+        }
+    }
+    return changed;
+}
+#endif
+
+#if USE_PPA_SCALE
+/*
+ *  Register with the PPA scale/rotate/mirror engine
+ *  Returns false (software scaling stays in use) if the driver refuses
+ */
+static bool initPPA(void)
+{
+    ppa_client_config_t config = {};
+    config.oper_type = PPA_OPERATION_SRM;
+    config.max_pending_trans_num = 1;
+    
+    esp_err_t err = ppa_register_client(&config, &ppa_srm_client);
+    if (err != ESP_OK) {
+        Serial.printf("[VIDEO] WARNING: PPA not available (%s), scaling in software\n", esp_err_to_name(err));
+        ppa_srm_client = NULL;
+        return false;
+    }
+    Serial.println("[VIDEO] PPA tile scaling enabled");
+    return true;
+}
+
+/*
+ *  Scale an RGB565 block 2x into an output buffer on the PPA
+ *  
+ *  The call blocks on the driver's completion semaphore, so Core 0 is free
+ *  for other tasks while the 2D-DMA runs. Both buffers are cache line
+ *  aligned; the driver writes back the source and invalidates the output.
+ *  
+ *  @param src       width * rows RGB565 pixels
+ *  @param width     Block width in Mac pixels
+ *  @param rows      Block height in Mac rows
+ *  @param dst       Output buffer (2*width x 2*rows pixels)
+ *  @param dst_size  Size of the output buffer in bytes
+ *  @return          true if the PPA produced the block
+ */
+static bool scaleBlockPPA(const uint16 *src, int width, int rows, uint16 *dst, uint32 dst_size)
+{
+    ppa_srm_oper_config_t op = {};
+    op.in.buffer = src;
+    op.in.pic_w = width;
+    op.in.pic_h = rows;
+    op.in.block_w = width;
+    op.in.block_h = rows;
+    op.in.srm_cm = PPA_SRM_COLOR_MODE_RGB565;
+    op.out.buffer = dst;
+    op.out.buffer_size = dst_size;
+    op.out.pic_w = width * 2;
+    op.out.pic_h = rows * 2;
+    op.out.srm_cm = PPA_SRM_COLOR_MODE_RGB565;
+    op.rotation_angle = PPA_SRM_ROTATION_ANGLE_0;
+    op.scale_x = 2;
+    op.scale_y = 2;
+    op.mode = PPA_TRANS_MODE_BLOCKING;
+    return ppa_do_scale_rotate_mirror(ppa_srm_client, &op) == ESP_OK;
+}
+
+/*
+ *  Expand an 8-bit block snapshot to RGB565 at Mac resolution, for the PPA
+ */
+static void expandBlockRGB565(const uint8 *snapshot, int count, const uint32 *local_palette, uint16 *out)
+{
+    for (int i = 0; i < count; i++) {
+        out[i] = (uint16)local_palette[snapshot[i]];
+    }
+}
+#endif
+
+#if USE_ASYNC_SNAPSHOT
+static async_memcpy_handle_t snapshot_dma = NULL;     // NULL: snapshots are memcpy()'d
+static SemaphoreHandle_t snapshot_done = NULL;         // Given when a band copy completes
+
+static IRAM_ATTR bool snapshotCopyDone(async_memcpy_handle_t mcp, async_memcpy_event_t *event, void *args)
+{
+    UNUSED(mcp);
+    UNUSED(event);
+    UNUSED(args);
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(snapshot_done, &woken);
+    return woken == pdTRUE;
+}
+
+/*
+ *  Claim an AXI GDMA channel pair for band snapshots
+ *  Returns false (snapshots stay memcpy()) if the driver refuses
+ */
+static bool initSnapshotDMA(void)
+{
+    snapshot_done = xSemaphoreCreateBinary();
+    if (snapshot_done == NULL) return false;
+    
+    async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    config.backlog = 1;
+    esp_err_t err = esp_async_memcpy_install_gdma_axi(&config, &snapshot_dma);
+    if (err != ESP_OK) {
+        Serial.printf("[VIDEO] WARNING: GDMA copy not available (%s), snapshots by memcpy\n", esp_err_to_name(err));
+        snapshot_dma = NULL;
+        return false;
+    }
+    Serial.println("[VIDEO] GDMA band snapshots enabled");
+    return true;
+}
+
+/*
+ *  Start copying a contiguous run of frame buffer rows to a snapshot buffer
+ *  
+ *  The CPU core writes the frame buffer through the cache, so the lines are
+ *  written back first for the GDMA to see them.
+ *  
+ *  @param src   First row in the frame buffer
+ *  @param size  Bytes to copy (multiple of the cache line)
+ *  @param dst   Snapshot buffer (cache line aligned)
+ *  @return      false if the copy could not be queued
+ */
+static bool startBandCopy(const uint8 *src, uint32 size, uint8 *dst)
+{
+    esp_cache_msync((void *)src, size, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+    return esp_async_memcpy(snapshot_dma, dst, (void *)src, size, snapshotCopyDone, NULL) == ESP_OK;
+}
+
+/*
+ *  Wait for the copy started by startBandCopy() and drop stale cache lines
+ *  of its destination
+ */
+static void finishBandCopy(uint8 *dst, uint32 size)
+{
+    xSemaphoreTake(snapshot_done, portMAX_DELAY);
+    esp_cache_msync(dst, size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+}
+#endif
+
+#if USE_DSI_DIRECT
+/*
+ *  Direct rendering into the panel's frame buffer
+ *  
+ *  The MIPI-DSI panel scans out of a frame buffer in PSRAM, which M5GFX
+ *  fills from the band buffers: one setAddrWindow() and writePixelsDMA() per
+ *  band, rotating the pixels and converting their byte order on the way. The
+ *  bands are instead converted from their snapshots straight into that frame
+ *  buffer, so every pixel is written once instead of twice. The cache lines
+ *  written go back to PSRAM with one esp_cache_msync() at the end of the
+ *  frame. Bands under the cursor overlay or the HUD are still rendered into
+ *  a band buffer to be composited, then copied into the frame buffer.
+ *  
+ *  The frame buffer is the one M5GFX's panel draws into. Its layout is not
+ *  taken on trust: at startup, pixels drawn through M5GFX are looked for in
+ *  it, which gives the rotation and the byte order of the panel. If they are
+ *  not where a frame buffer would have them, M5GFX keeps pushing the bands.
+ */
+struct panel_layout {
+    uint16 *origin;             // Display pixel (0, 0)
+    int step_x, step_y;         // Panel pixels to the next display column and row
+    bool swap;                  // Panel pixels are byte-swapped from swap565
+    uint16 *lo, *hi;            // Pixels written since the last writeback
+};
+static panel_layout panel;
+static bool panel_direct = false;
+static uint16 panel_palette[256];   // Palette in the panel's byte order
+
+// The line pointers of M5GFX's frame buffer panels are protected
+struct panel_access : public lgfx::Panel_FrameBufferBase {
+    static uint8_t **lines(lgfx::Panel_FrameBufferBase *p) { return p->*(&panel_access::_lines_buffer); }
+};
+
+static void drawTestPixel(int x, int y, uint16 pixel)
+{
+    M5.Display.startWrite();
+    M5.Display.setAddrWindow(x, y, 1, 1);
+    M5.Display.writePixels(&pixel, 1);
+    M5.Display.endWrite();
+}
+
+// Index of the only pixel of the frame buffer with this value, -1 if none or several
+static int findTestPixel(const uint16 *fb, int count, uint16 pixel, bool *swapped)
+{
+    uint16 swapped_pixel = __builtin_bswap16(pixel);
+    int found = -1;
+    for (int i = 0; i < count; i++) {
+        if (fb[i] == pixel || fb[i] == swapped_pixel) {
+            if (found >= 0) return -1;
+            found = i;
+            *swapped = (fb[i] != pixel);
+        }
+    }
+    return found;
+}
+
+/*
+ *  Find the panel's frame buffer and the display's layout in it
+ *  Returns false (bands pushed through M5GFX) if it is not as expected
+ */
+static bool initPanelDirect(void)
+{
+    uint8_t **lines = NULL;
+    if (M5.getBoard() == m5::board_t::board_M5Tab5) {
+        lines = panel_access::lines((lgfx::Panel_FrameBufferBase *)M5.Display.getPanel());
+    }
+    if (lines == NULL || !esp_ptr_external_ram(lines[0])) {
+        Serial.println("[VIDEO] WARNING: No DSI frame buffer, bands pushed through M5GFX");
+        return false;
+    }
+    
+    // The panel rows are contiguous, in either orientation
+    const int count = DISPLAY_WIDTH * DISPLAY_HEIGHT;
+    int row_pixels = (lines[1] - lines[0]) / 2;
+    int panel_rows = row_pixels > 0 ? count / row_pixels : 0;
+    if (panel_rows == 0 || panel_rows * row_pixels != count || lines[panel_rows - 1] != lines[0] + (panel_rows - 1) * row_pixels * 2) {
+        Serial.println("[VIDEO] WARNING: DSI frame buffer rows not contiguous, bands pushed through M5GFX");
+        return false;
+    }
+    uint16 *fb = (uint16 *)lines[0];
+    
+    // Three corners give the steps, the fourth checks them. The first full
+    // update paints over the test pixels.
+    static const uint16 test_pixels[4] = {0x1234, 0x5678, 0x9abc, 0xdef1};
+    drawTestPixel(0, 0, test_pixels[0]);
+    drawTestPixel(1, 0, test_pixels[1]);
+    drawTestPixel(0, 1, test_pixels[2]);
+    drawTestPixel(DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1, test_pixels[3]);
+    M5.Display.waitDMA();
+    esp_cache_msync(fb, count * sizeof(uint16), ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE);
+    
+    int at[4];
+    bool swapped[4] = {false, false, false, false};
+    for (int i = 0; i < 4; i++) {
+        at[i] = findTestPixel(fb, count, test_pixels[i], &swapped[i]);
+    }
+    int step_x = at[1] - at[0];
+    int step_y = at[2] - at[0];
+    bool steps_ok = (abs(step_x) == 1 && abs(step_y) == row_pixels) || (abs(step_x) == row_pixels && abs(step_y) == 1);
+    if (at[0] < 0 || at[1] < 0 || at[2] < 0 || at[3] < 0 || !steps_ok ||
+        at[3] != at[0] + (DISPLAY_WIDTH - 1) * step_x + (DISPLAY_HEIGHT - 1) * step_y ||
+        swapped[1] != swapped[0] || swapped[2] != swapped[0] || swapped[3] != swapped[0]) {
+        Serial.println("[VIDEO] WARNING: Unexpected DSI frame buffer layout, bands pushed through M5GFX");
+        return false;
+    }
+    
+    panel.origin = fb + at[0];
+    panel.step_x = step_x;
+    panel.step_y = step_y;
+    panel.swap = swapped[0];
+    panel.lo = panel.hi = NULL;
+    Serial.printf("[VIDEO] Rendering into the DSI frame buffer at %p (steps %d/%d%s)\n",
+                  fb, step_x, step_y, panel.swap ? ", RGB565" : "");
+    return true;
+}
+
+// Panel pixel of a display pixel
+static inline uint16 *panelPixel(int x, int y)
+{
+    return panel.origin + x * panel.step_x + y * panel.step_y;
+}
+
+// Extend the range to write back by a display rectangle
+static void panelWritten(int x, int y, int width, int height)
+{
+    uint16 *a = panelPixel(x, y);
+    uint16 *b = panelPixel(x + width - 1, y + height - 1);
+    uint16 *lo = a < b ? a : b;
+    uint16 *hi = a < b ? b : a;
+    if (panel.lo == NULL || lo < panel.lo) panel.lo = lo;
+    if (panel.hi == NULL || hi > panel.hi) panel.hi = hi;
+}
+
+// Put the pixels written this frame back to PSRAM for the DSI's DMA
+static void panelWriteBack(void)
+{
+    if (panel.lo == NULL) return;
+    esp_cache_msync(panel.lo, (panel.hi - panel.lo + 1) * sizeof(uint16),
+                    ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+    panel.lo = panel.hi = NULL;
+}
+
+// The doubled swap565 palette of the frame in the panel's byte order
+static void makePanelPalette(const uint32 *local_palette)
+{
+    for (int i = 0; i < 256; i++) {
+        uint16 pixel = (uint16)local_palette[i];
+        panel_palette[i] = panel.swap ? __builtin_bswap16(pixel) : pixel;
+    }
+}
+
+/*
+ *  Convert a band snapshot into the panel's frame buffer
+ *  
+ *  On a portrait panel shown in landscape the display's columns are the
+ *  panel's rows, so the band is walked column by column: the inner loop then
+ *  writes along a panel row, a few cache lines at a time.
+ *  
+ *  @param snapshot      Band snapshot (8-bit indices or RGB565)
+ *  @param mac_x         First Mac pixel column of the band
+ *  @param mac_y         First Mac row of the band
+ *  @param width         Band width in Mac pixels
+ *  @param rows          Band height in Mac rows
+ *  @param direct_color  16-bit snapshot, else indices into panel_palette
+ */
+template <int SCALE>
+static void renderBandToPanel(const uint16 *snapshot, int mac_x, int mac_y, int width, int rows, bool direct_color)
+{
+    const uint8 *indices = (const uint8 *)snapshot;
+    uint16 *origin = panelPixel(mac_x * SCALE, mac_y * SCALE);
+    int step_x = panel.step_x, step_y = panel.step_y;
+    bool by_column = (abs(step_y) == 1);
+    int outer = by_column ? width : rows;
+    int inner = by_column ? rows : width;
+    
+    for (int a = 0; a < outer; a++) {
+        for (int b = 0; b < inner; b++) {
+            int x = by_column ? a : b;
+            int y = by_column ? b : a;
+            uint16 pixel;
+            if (direct_color) {
+                pixel = snapshot[y * width + x];
+                if (panel.swap) pixel = __builtin_bswap16(pixel);
+            } else {
+                pixel = panel_palette[indices[y * width + x]];
+            }
+            uint16 *p = origin + x * SCALE * step_x + y * SCALE * step_y;
+            p[0] = pixel;
+            if (SCALE == 2) {
+                p[step_x] = pixel;
+                p[step_y] = pixel;
+                p[step_x + step_y] = pixel;
+            }
+        }
+    }
+    panelWritten(mac_x * SCALE, mac_y * SCALE, width * SCALE, rows * SCALE);
+}
+
+/*
+ *  Copy a rendered band (swap565, row by row) into the panel's frame buffer
+ */
+static void copyBandToPanel(const uint16 *band, int x, int y, int width, int height)
+{
+    uint16 *origin = panelPixel(x, y);
+    int step_x = panel.step_x, step_y = panel.step_y;
+    bool by_column = (abs(step_y) == 1);
+    int outer = by_column ? width : height;
+    int inner = by_column ? height : width;
+    
+    for (int a = 0; a < outer; a++) {
+        for (int b = 0; b < inner; b++) {
+            int bx = by_column ? a : b;
+            int by = by_column ? b : a;
+            uint16 pixel = band[by * width + bx];
+            origin[bx * step_x + by * step_y] = panel.swap ? __builtin_bswap16(pixel) : pixel;
+        }
+    }
+    panelWritten(x, y, width, height);
+}
+
+// Whether the cursor overlay or the HUD must be composited over a band
+template <int SCALE>
+static bool bandHasOverlay(int mac_x, int mac_y, int mac_width, int rows)
+{
+#if USE_CURSOR_OVERLAY
+    const cursor_sprite &c = cursor_shown;
+    if (c.visible && c.x < mac_x + mac_width && c.x + CURSOR_SIZE > mac_x &&
+        c.y < mac_y + rows && c.y + CURSOR_SIZE > mac_y) {
+        return true;
+    }
+#endif
+#if PERF_HUD
+    if (hud_shown && HudPixels() != NULL &&
+        HUD_X < (mac_x + mac_width) * SCALE && HUD_X + HUD_WIDTH > mac_x * SCALE &&
+        HUD_Y < (mac_y + rows) * SCALE && HUD_Y + HUD_HEIGHT > mac_y * SCALE) {
+        return true;
+    }
+#endif
+    return false;
+}
+#endif
+
+/*
+ *  Render and push only dirty tiles to the display
  *  RACE-CONDITION FIX: Uses per-tile render lock and double-buffered DMA.
  *  
  *  This prevents visual glitches (especially around the mouse cursor) caused by
@@ -806,90 +2519,276 @@ static void renderTileFromSnapshot(uint8 *snapshot, uint16 *local_palette, uint1
  *  2. If CPU writes during snapshot, tile is re-marked dirty for next frame
  *  3. Double-buffered output allows DMA overlap with rendering
  *  
+ *  Dirty tiles are first merged into rectangles (coalesceDirtyTiles()). Each
+ *  rectangle is rendered in bands of full rectangle width, as many Mac rows
+ *  as fit RECT_BAND_PIXELS, and each band is one setAddrWindow() and one DMA
+ *  transfer. A run of tiles along a text line costs one transfer instead of
+ *  one per tile.
+ *  
+ *  With USE_TILE_HASH, a band whose pixels hash the same as when it was last
+ *  pushed is skipped. A full update pushes everything and records the hashes,
+ *  which covers mode changes; tiles repainted for a palette change have their
+ *  hashes invalidated by markPaletteDirtyTiles().
+ *  
+ *  The renderer is instantiated per scale factor (see screen_geometry), the
+ *  video task calls the one of the current mode.
+ *  
  *  @param src_buffer     Mac framebuffer (8-bit indexed)
- *  @param local_palette  Pre-copied palette for thread safety
+ *  @param local_palette  Pre-copied doubled palette for thread safety
+ *  @param full_update    Every tile is dirty: push all bands without comparing
  */
-static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
+// Band snapshot buffer (Mac resolution: 8-bit indices or RGB565)
+// Shared by the renderers of both scales, static to avoid stack allocation
+// In internal SRAM for fast access during partial updates, cache line
+// aligned so the PPA can read it
+DRAM_ATTR static uint16 band_snapshot[BAND_SNAPSHOT_BYTES / 2] __attribute__((aligned(CACHE_LINE_SIZE)));
+
+#if USE_ASYNC_SNAPSHOT
+// Snapshot of the next band, filled by the GDMA while the current one converts
+DRAM_ATTR static uint16 band_snapshot_next[BAND_SNAPSHOT_BYTES / 2] __attribute__((aligned(CACHE_LINE_SIZE)));
+#endif
+
+// Double-buffered RGB565 output buffers (RECT_BAND_PIXELS, 40KB each)
+// In internal SRAM for fast access during partial updates, cache line
+// aligned so the PPA can write them
+DRAM_ATTR static uint16 band_buffer_a[RECT_BAND_PIXELS] __attribute__((aligned(CACHE_LINE_SIZE)));
+DRAM_ATTR static uint16 band_buffer_b[RECT_BAND_PIXELS] __attribute__((aligned(CACHE_LINE_SIZE)));
+
+#if USE_PPA_SCALE
+// Palette-expanded 8-bit band at Mac resolution, the PPA's source (2x only)
+DRAM_ATTR static uint16 band_rgb565[RECT_BAND_PIXELS / 4] __attribute__((aligned(CACHE_LINE_SIZE)));
+#endif
+
+template <int SCALE>
+static void renderAndPushDirtyTiles(uint8 *src_buffer, uint32 *local_palette, bool full_update)
 {
-    // Double-buffered tile snapshot buffers (40x40 = 1600 bytes each)
-    // Static to avoid stack allocation on each call
-    // In internal SRAM for fast access during partial updates
-    DRAM_ATTR static uint8 tile_snapshot_a[TILE_WIDTH * TILE_HEIGHT];
-    DRAM_ATTR static uint8 tile_snapshot_b[TILE_WIDTH * TILE_HEIGHT];
-    
-    // Double-buffered RGB565 output buffers (80x80 = 12,800 bytes each)
-    // In internal SRAM for fast access during partial updates
-    DRAM_ATTR static uint16 tile_buffer_a[TILE_WIDTH * PIXEL_SCALE * TILE_HEIGHT * PIXEL_SCALE];
-    DRAM_ATTR static uint16 tile_buffer_b[TILE_WIDTH * PIXEL_SCALE * TILE_HEIGHT * PIXEL_SCALE];
-    
+    typedef screen_geometry<SCALE> geo;
     // Buffer pointers for double-buffering
-    uint8 *current_snapshot = tile_snapshot_a;
-    uint8 *next_snapshot = tile_snapshot_b;
-    uint16 *current_buffer = tile_buffer_a;
-    uint16 *next_buffer = tile_buffer_b;
-    
-    int tile_pixel_width = TILE_WIDTH * PIXEL_SCALE;
-    int tile_pixel_height = TILE_HEIGHT * PIXEL_SCALE;
-    int tiles_rendered = 0;
+    bool direct_color = (frame_mode.depth == VDEPTH_16BIT);
+    uint16 *current_buffer = band_buffer_a;
+    uint16 *next_buffer = band_buffer_b;
+    
+    int tile_pixels = TILE_DISPLAY_SIZE * TILE_DISPLAY_SIZE;
+    int pixels_since_yield = 0;
     bool dma_pending = false;
     
+    int rect_count = coalesceDirtyTiles<SCALE>();
+#if USE_POINTER_FIRST
+    rect_count = pointerRectsFirst<SCALE>(rect_count);
+#endif
+#if REMOTE_DISPLAY
+    if (RemoteActive()) {
+        for (int i = 0; i < rect_count; i++) {
+            const dirty_rect &r = dirty_rects[i];
+            RemoteMarkDirty(r.x * geo::tile_width, r.y0, r.w * geo::tile_width, r.y1 - r.y0);
+        }
+    }
+#endif
+    
+#if USE_DSI_DIRECT
+    if (panel_direct && !direct_color) {
+        makePanelPalette(local_palette);
+    }
+#endif
+    
     M5.Display.startWrite();
     
-    for (int ty = 0; ty < TILES_Y; ty++) {
-        for (int tx = 0; tx < TILES_X; tx++) {
-            int tile_idx = ty * TILES_X + tx;
-            
-            // Skip tiles that aren't dirty
-            if (!isTileDirty(tile_idx)) {
-                continue;
+    for (int i = 0; i < rect_count; i++) {
+        // A new mode makes the rest of this frame stale, its full repaint
+        // comes with the next one
+        if (pending_mode_version != frame_mode.version) {
+            perf_inc(perf_mode_aborts);
+            break;
+        }
+        
+        const dirty_rect &r = dirty_rects[i];
+        int mac_x = r.x * geo::tile_width;
+        int mac_width = r.w * geo::tile_width;
+        int mac_end_y = r.y1;
+        
+        // Mac rows per band, so that the scaled band fits an output buffer
+        // and the snapshot fits its buffer, in whole row bands
+        int band_rows = RECT_BAND_PIXELS / (mac_width * SCALE * SCALE);
+        int snapshot_rows = BAND_SNAPSHOT_BYTES / (mac_width * (direct_color ? 2 : 1));
+        if (band_rows > snapshot_rows) band_rows = snapshot_rows;
+        band_rows -= band_rows % geo::band_rows;
+        
+        // Tiles rendered whole get their color usage rebuilt from scratch
+        if (!direct_color) {
+            for (int ty = (r.y0 + geo::tile_height - 1) / geo::tile_height; ty < r.y1 / geo::tile_height; ty++) {
+                memset(tile_colors[ty * TILES_X + r.x], 0, r.w * sizeof(tile_colors[0]));
             }
+        }
+        
+        uint16 *snapshot = band_snapshot;
+#if USE_ASYNC_SNAPSHOT
+        // Full width bands of 8 and 16-bit modes are contiguous in the frame
+        // buffer: the GDMA fetches the next band while this one converts, and
+        // the rectangle stays render locked until the last band is fetched
+        uint32 bpr = frame_mode.bytes_per_row;
+        uint16 *snapshot_next = band_snapshot_next;
+        bool async_rect = snapshot_dma != NULL && r.w == TILES_X && frame_mode.pixels_per_byte == 1
+                       && bpr == (uint32)mac_width * (direct_color ? 2 : 1) && bpr % CACHE_LINE_SIZE == 0;
+        if (async_rect) {
+            int first_rows = (mac_end_y - r.y0 < band_rows) ? mac_end_y - r.y0 : band_rows;
+            setRectRenderActive<SCALE>(r, true);
+            async_rect = startBandCopy(src_buffer + r.y0 * bpr, first_rows * bpr, (uint8 *)snapshot);
+            if (!async_rect) setRectRenderActive<SCALE>(r, false);
+        }
+#endif
+        
+        for (int mac_y = r.y0; mac_y < mac_end_y; mac_y += band_rows) {
+            int rows = (mac_end_y - mac_y < band_rows) ? mac_end_y - mac_y : band_rows;
             
-            // STEP 1: Mark tile as being rendered (prevents CPU from tearing)
-            setTileRenderActive(tile_idx);
-            
-            // STEP 2: Take a mini-snapshot of just this tile
-            // While render_active is set, CPU writes will re-mark tile dirty
-            snapshotTile(src_buffer, tx, ty, current_snapshot);
-            
-            // STEP 3: Clear render lock - snapshot is complete
-            // Any CPU writes after this point will be visible in next frame
-            clearTileRenderActive(tile_idx);
+#if VIDEO_TELEMETRY
+            uint32 t_stage = micros();
+#endif
             
-            // Memory barrier to ensure snapshot is complete before rendering
-            __sync_synchronize();
+#if USE_ASYNC_SNAPSHOT
+            // This band was fetched while the previous one converted
+            if (mac_y != r.y0) {
+                uint16 *tmp_snapshot = snapshot;
+                snapshot = snapshot_next;
+                snapshot_next = tmp_snapshot;
+            }
+            if (async_rect) {
+                finishBandCopy((uint8 *)snapshot, rows * bpr);
+                int next_y = mac_y + rows;
+                if (next_y < mac_end_y) {
+                    int next_rows = (mac_end_y - next_y < band_rows) ? mac_end_y - next_y : band_rows;
+                    async_rect = startBandCopy(src_buffer + next_y * bpr, next_rows * bpr, (uint8 *)snapshot_next);
+                }
+                if (!async_rect || next_y >= mac_end_y) {
+                    setRectRenderActive<SCALE>(r, false);
+                    async_rect = false;
+                }
+                __sync_synchronize();
+            } else
+#endif
+            {
+                // STEP 1: Mark the rectangle as being rendered (prevents CPU from tearing)
+                setRectRenderActive<SCALE>(r, true);
+                
+                // STEP 2: Take a snapshot of just this band
+                // While render_active is set, CPU writes will re-mark tiles dirty
+                snapshotBlock(src_buffer, mac_x, mac_y, mac_width, rows, (uint8 *)snapshot);
+                
+                // STEP 3: Clear render lock - snapshot is complete
+                // Any CPU writes after this point will be visible in next frame
+                setRectRenderActive<SCALE>(r, false);
+                
+                // Memory barrier to ensure snapshot is complete before rendering
+                __sync_synchronize();
+            }
             
-            // STEP 4: Render from the snapshot (not from the live framebuffer)
-            renderTileFromSnapshot(current_snapshot, local_palette, current_buffer);
+#if VIDEO_TELEMETRY
+            uint32 t_now = micros();
+            frame_snapshot_us += t_now - t_stage;
+            t_stage = t_now;
+#endif
             
-            // STEP 5: Wait for any pending DMA before using its buffer
-            if (dma_pending) {
-                M5.Display.waitDMA();
-                dma_pending = false;
+            if (!direct_color) {
+                recordBandColors<SCALE>((uint8 *)snapshot, r.x, mac_width, mac_y, rows);
             }
             
-            // STEP 6: Push to display using async DMA
-            int dst_start_x = tx * tile_pixel_width;
-            int dst_start_y = ty * tile_pixel_height;
+#if USE_TILE_HASH
+            // Rewritten with the same pixels: the display already shows them
+            if (!bandSnapshotChanged<SCALE>((uint8 *)snapshot, r.x, mac_width, mac_y, rows,
+                                     direct_color ? 2 : 1, full_update)) {
+                perf_inc(perf_same_count);
+#if VIDEO_TELEMETRY
+                frame_convert_us += micros() - t_stage;
+#endif
+                continue;
+            }
+#endif
             
-            M5.Display.setAddrWindow(dst_start_x, dst_start_y, tile_pixel_width, tile_pixel_height);
-            M5.Display.writePixelsDMA(current_buffer, tile_pixel_width * tile_pixel_height);
-            dma_pending = true;
+            // STEP 4: Render from the snapshot (not from the live framebuffer)
+            bool rendered = false;
+#if USE_DSI_DIRECT
+            // Nothing to composite: straight into the panel's frame buffer
+            bool on_panel = false;
+            if (panel_direct && !bandHasOverlay<SCALE>(mac_x, mac_y, mac_width, rows)) {
+                renderBandToPanel<SCALE>(snapshot, mac_x, mac_y, mac_width, rows, direct_color);
+                perf_inc(perf_panel_bands);
+                rendered = on_panel = true;
+            }
+#endif
+#if USE_PPA_SCALE
+            // Only the palette lookup stays on Core 0, the PPA does the scaling
+            if (!rendered && SCALE == 2 && ppa_srm_client != NULL) {
+                const uint16 *rgb = snapshot;
+                if (!direct_color) {
+                    expandBlockRGB565((uint8 *)snapshot, mac_width * rows, local_palette, band_rgb565);
+                    rgb = band_rgb565;
+                }
+                rendered = scaleBlockPPA(rgb, mac_width, rows, current_buffer, sizeof(band_buffer_a));
+            }
+#endif
+#if USE_RENDER_ASSIST
+            if (!rendered) {
+                rendered = renderBandAssisted<SCALE>(snapshot, mac_width, rows, local_palette, current_buffer, direct_color);
+            }
+#endif
+            if (!rendered) {
+                if (direct_color) {
+                    renderBlockFromSnapshot16<SCALE>(snapshot, mac_width, rows, current_buffer);
+                } else {
+                    renderBlockFromSnapshot<SCALE>((uint8 *)snapshot, mac_width, rows, local_palette, current_buffer);
+                }
+            }
+#if USE_CURSOR_OVERLAY
+            compositeCursor<SCALE>(current_buffer, mac_x, mac_y, mac_width, rows);
+#endif
+#if PERF_HUD
+            compositeHud<SCALE>(current_buffer, mac_x, mac_y, mac_width, rows);
+#endif
             
-            // STEP 7: Swap buffers for next tile
-            // This allows rendering next tile while DMA pushes current
-            uint8 *tmp_snap = current_snapshot;
-            current_snapshot = next_snapshot;
-            next_snapshot = tmp_snap;
+#if VIDEO_TELEMETRY
+            t_now = micros();
+            frame_convert_us += t_now - t_stage;
+            t_stage = t_now;
+#endif
             
-            uint16 *tmp_buf = current_buffer;
-            current_buffer = next_buffer;
-            next_buffer = tmp_buf;
+            int band_width = mac_width * SCALE;
+            int band_height = rows * SCALE;
             
-            tiles_rendered++;
+#if USE_DSI_DIRECT
+            if (panel_direct) {
+                // A composited band is copied where M5GFX would have put it
+                if (!on_panel) {
+                    copyBandToPanel(current_buffer, mac_x * SCALE, mac_y * SCALE, band_width, band_height);
+                }
+            } else
+#endif
+            {
+                // STEP 5: Wait for any pending DMA before using its buffer
+                if (dma_pending) {
+                    M5.Display.waitDMA();
+                    dma_pending = false;
+                }
+                
+                // STEP 6: Push to display using async DMA
+                M5.Display.setAddrWindow(mac_x * SCALE, mac_y * SCALE, band_width, band_height);
+                M5.Display.writePixelsDMA(current_buffer, band_width * band_height);
+                dma_pending = true;
+                
+#if VIDEO_TELEMETRY
+                frame_dma_us += micros() - t_stage;
+#endif
+                
+                // STEP 7: Swap buffers for next band
+                // This allows rendering next band while DMA pushes current
+                uint16 *tmp_buf = current_buffer;
+                current_buffer = next_buffer;
+                next_buffer = tmp_buf;
+            }
             
-            // Every 8 tiles, yield to let other tasks run
+            // Every 8 tiles worth of pixels, yield to let other tasks run
             // This prevents starvation during full-screen updates
-            if ((tiles_rendered & 0x07) == 0) {
+            pixels_since_yield += band_width * band_height;
+            if (pixels_since_yield >= 8 * tile_pixels) {
+                pixels_since_yield = 0;
                 taskYIELD();
             }
         }
@@ -897,8 +2796,26 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
     
     // Wait for final DMA to complete before ending write session
     if (dma_pending) {
+#if VIDEO_TELEMETRY
+        uint32 t_wait = micros();
+        M5.Display.waitDMA();
+        frame_dma_us += micros() - t_wait;
+#else
         M5.Display.waitDMA();
+#endif
+    }
+    
+#if USE_DSI_DIRECT
+    if (panel_direct) {
+#if VIDEO_TELEMETRY
+        uint32 t_sync = micros();
+        panelWriteBack();
+        frame_dma_us += micros() - t_sync;
+#else
+        panelWriteBack();
+#endif
     }
+#endif
     
     M5.Display.endWrite();
 }
@@ -914,19 +2831,21 @@ static void renderAndPushDirtyTiles(uint8 *src_buffer, uint16 *local_palette)
  *  PSRAM traffic: ~230KB read (mac_frame_buffer only)
  *  vs old method: ~230KB read + 1.8MB write + 1.8MB read = ~3.8MB
  *  
- *  Supports all bit depths (1/2/4/8-bit) by decoding packed pixels first.
+ *  Supports all bit depths: 1/2/4-bit rows are decoded first, 16-bit rows
+ *  are RGB565 already and only doubled. 640x360 (2x) only.
  */
-static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
+static void renderFrameStreaming(uint8 *src_buffer, uint32 *local_palette)
 {
+    typedef screen_geometry<2> geo;
     if (!src_buffer) return;
     
-    // Get current depth and bytes per row (volatile, so copy locally)
-    video_depth depth = current_depth;
-    uint32 bpr = current_bytes_per_row;
+    // Mode of this frame
+    video_depth depth = frame_mode.depth;
+    uint32 bpr = frame_mode.bytes_per_row;
     
     // Row decode buffer for packed pixel modes
     // In internal SRAM for fast access during rendering
-    DRAM_ATTR static uint8 decoded_row[MAC_SCREEN_WIDTH];
+    DRAM_ATTR static uint8 decoded_row[geo::width] __attribute__((aligned(4)));
     
     // Track if we have a pending DMA transfer
     bool dma_pending = false;
@@ -936,17 +2855,28 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
     
     // Process 4 Mac rows at a time (produces 8 display rows with 2x scaling)
     // Double-buffering: render to one buffer while DMA pushes the other
-    for (int mac_y = 0; mac_y < MAC_SCREEN_HEIGHT; mac_y += 4) {
+    for (int mac_y = 0; mac_y < geo::height; mac_y += 4) {
         uint16 *out = render_buffer;
         
         // Process 4 Mac rows into render_buffer
         for (int row_offset = 0; row_offset < 4; row_offset++) {
             int y = mac_y + row_offset;
-            if (y >= MAC_SCREEN_HEIGHT) break;
+            if (y >= geo::height) break;
             
             // Get source row pointer
             uint8 *src_row = src_buffer + y * bpr;
             
+            if (depth == VDEPTH_16BIT) {
+                const uint16 *pixels = (const uint16 *)src_row;
+                uint32 *dst = (uint32 *)out;
+                for (int x = 0; x < geo::width; x++) {
+                    dst[x] = pixels[x] * 0x10001u;
+                }
+                memcpy(out + DISPLAY_WIDTH, out, DISPLAY_WIDTH * sizeof(uint16));
+                out += DISPLAY_WIDTH * 2;
+                continue;
+            }
+            
             // Decode the row if needed (converts packed pixels to 8-bit indices)
             uint8 *pixel_row;
             if (depth == VDEPTH_8BIT) {
@@ -954,50 +2884,13 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
                 pixel_row = src_row;
             } else {
                 // Packed mode: decode to 8-bit indices
-                decodePackedRow(src_row, decoded_row, MAC_SCREEN_WIDTH, depth);
+                frame_mode.decode(src_row, decoded_row, geo::width);
                 pixel_row = decoded_row;
             }
             
-            // Output row pointers for the two scaled display rows
-            uint16 *dst_row0 = out;
-            uint16 *dst_row1 = out + DISPLAY_WIDTH;
-            
-            // Process 4 decoded pixels at a time for better memory bandwidth
-            int x = 0;
-            for (; x < MAC_SCREEN_WIDTH - 3; x += 4) {
-                // Read 4 decoded pixels at once (32-bit read from 8-bit indices)
-                uint32 src4 = *((uint32 *)(pixel_row + x));
-                
-                // Convert each pixel through palette and write 2x2 scaled
-                uint16 c0 = local_palette[src4 & 0xFF];
-                uint16 c1 = local_palette[(src4 >> 8) & 0xFF];
-                uint16 c2 = local_palette[(src4 >> 16) & 0xFF];
-                uint16 c3 = local_palette[(src4 >> 24) & 0xFF];
-                
-                // Write to row 0 (2 pixels per source pixel)
-                dst_row0[0] = c0; dst_row0[1] = c0;
-                dst_row0[2] = c1; dst_row0[3] = c1;
-                dst_row0[4] = c2; dst_row0[5] = c2;
-                dst_row0[6] = c3; dst_row0[7] = c3;
-                
-                // Write to row 1 (duplicate of row 0)
-                dst_row1[0] = c0; dst_row1[1] = c0;
-                dst_row1[2] = c1; dst_row1[3] = c1;
-                dst_row1[4] = c2; dst_row1[5] = c2;
-                dst_row1[6] = c3; dst_row1[7] = c3;
-                
-                dst_row0 += 8;
-                dst_row1 += 8;
-            }
-            
-            // Handle remaining pixels (if width not divisible by 4)
-            for (; x < MAC_SCREEN_WIDTH; x++) {
-                uint16 c = local_palette[pixel_row[x]];
-                dst_row0[0] = c; dst_row0[1] = c;
-                dst_row1[0] = c; dst_row1[1] = c;
-                dst_row0 += 2;
-                dst_row1 += 2;
-            }
+            // Expand into the first display row, then duplicate it
+            expandRow2x(pixel_row, (uint32 *)out, local_palette, geo::width);
+            memcpy(out + DISPLAY_WIDTH, out, DISPLAY_WIDTH * sizeof(uint16));
             
             // Move output pointer by 2 display rows (2x vertical scaling)
             out += DISPLAY_WIDTH * 2;
@@ -1016,7 +2909,7 @@ static void renderFrameStreaming(uint8 *src_buffer, uint16 *local_palette)
         
         // Start async DMA push of the just-rendered buffer (now in push_buffer)
         // 8 display rows * 1280 pixels = 10240 pixels per chunk
-        int display_y = mac_y * PIXEL_SCALE;
+        int display_y = mac_y * 2;
         M5.Display.setAddrWindow(0, display_y, DISPLAY_WIDTH, STREAMING_ROW_COUNT);
         M5.Display.writePixelsDMA(push_buffer, DISPLAY_WIDTH * STREAMING_ROW_COUNT);
         dma_pending = true;
@@ -1063,25 +2956,108 @@ static void reportVideoPerfStats(void)
     if (now - perf_last_report_ms >= PERF_REPORT_INTERVAL_MS) {
         perf_last_report_ms = now;
         
-        uint32_t total_frames = perf_full_count + perf_partial_count + perf_skip_count;
-        if (total_frames > 0) {
-            Serial.printf("[VIDEO PERF] frames=%u (full=%u partial=%u skip=%u)\n",
-                          total_frames, perf_full_count, perf_partial_count, perf_skip_count);
+        // Changes since the last report
+        uint32_t full = perf_delta(perf_full_count, perf_last.full);
+        uint32_t partial = perf_delta(perf_partial_count, perf_last.partial);
+        uint32_t skip = perf_delta(perf_skip_count, perf_last.skip);
+        uint32_t same = perf_delta(perf_same_count, perf_last.same);
+        uint32_t scroll = perf_delta(perf_scroll_count, perf_last.scroll);
+        uint32_t detect_us = perf_delta(perf_detect_us, perf_last.detect_us);
+        uint32_t render_us = perf_delta(perf_render_us, perf_last.render_us);
+        perf_delta(perf_frame_count, perf_last.frames);
+        
+        uint32_t total_frames = full + partial + skip;
+        if (total_frames > 0 && ConsoleReports()) {
+            Serial.printf("[VIDEO PERF] frames=%u (full=%u partial=%u skip=%u) same_bands=%u scrolls=%u\n",
+                          total_frames, full, partial, skip, same, scroll);
             Serial.printf("[VIDEO PERF] avg: detect=%uus render=%uus\n",
-                          perf_detect_us / (total_frames > 0 ? total_frames : 1),
-                          perf_render_us / (total_frames > 0 ? total_frames : 1));
+                          detect_us / total_frames, render_us / total_frames);
         }
-        
-        // Reset counters for next interval
-        perf_detect_us = 0;
-        perf_render_us = 0;
-        perf_frame_count = 0;
-        perf_partial_count = 0;
-        perf_full_count = 0;
-        perf_skip_count = 0;
     }
 }
 
+#if VIDEO_TELEMETRY
+static inline void telemetryRecord(int which, uint32 v)
+{
+    perf_record(telemetry[which], v);
+}
+
+/*
+ *  Print p50/p95/p99 and the maximum of every stage (called from Core 1;
+ *  a frame recorded meanwhile may be partly counted)
+ */
+void VideoTelemetryDump(void)
+{
+    Serial.printf("[VIDEO TELEMETRY] %u frames pushed\n", telemetry[TELEMETRY_FRAME]->h.samples);
+    for (int i = 0; i < TELEMETRY_COUNT; i++) {
+        const telemetry_histogram &h = telemetry[i]->h;
+        if (h.samples == 0) continue;
+        Serial.printf("[VIDEO TELEMETRY] %-18s n=%-7u p50=%-6u p95=%-6u p99=%-6u max=%u\n",
+                      telemetry[i]->name, h.samples, telemetry_percentile(h, 50),
+                      telemetry_percentile(h, 95), telemetry_percentile(h, 99), h.max);
+    }
+}
+
+/*
+ *  Clear the histograms (done by the video task at its next sample)
+ */
+void VideoTelemetryReset(void)
+{
+    for (int i = 0; i < TELEMETRY_COUNT; i++)
+        telemetry[i]->reset = true;
+}
+#else
+void VideoTelemetryDump(void)
+{
+}
+
+void VideoTelemetryReset(void)
+{
+}
+#endif
+
+#if INPUT_TELEMETRY
+/*
+ *  Input to photon: arm the probe (CPU task), unless an event that is not
+ *  stale yet holds it
+ */
+void VideoPhotonArm(int which, uint32 posted)
+{
+    uint32 armed = __atomic_load_n(&photon_posted, __ATOMIC_RELAXED);
+    if (armed != 0 && (uint32)GetTicks_usec() - armed < PHOTON_TIMEOUT_US)
+        return;
+    photon_which = which;
+    __atomic_store_n(&photon_posted, posted ? posted : 1, __ATOMIC_RELEASE);
+}
+
+/*
+ *  End the probe taken at the start of a frame that changed the screen, now
+ *  that it is pushed (video task)
+ */
+static void photonRecord(uint32 armed, int which)
+{
+    uint32 latency = (uint32)GetTicks_usec() - armed;
+    if (latency < PHOTON_TIMEOUT_US)
+        perf_record(photon[which], latency);
+    else
+        perf_inc(perf_photon_lost);
+    // Armed again meanwhile only if it went stale: keep the new event
+    __atomic_compare_exchange_n(&photon_posted, &armed, 0, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+const telemetry_histogram *VideoPhotonLatency(int which)
+{
+    return &photon[which]->h;
+}
+
+// Cleared by the video task on its next record
+void VideoPhotonReset(void)
+{
+    for (int i = 0; i < ADB_LATENCY_COUNT; i++)
+        photon[i]->reset = true;
+}
+#endif
+
 /*
  *  Optimized video rendering task - uses WRITE-TIME dirty tracking
  *  
@@ -1112,90 +3088,248 @@ static void videoRenderTaskOptimized(void *param)
     
     // Wait a moment for everything to initialize
     vTaskDelay(pdMS_TO_TICKS(100));
+    task_run(video_task_stats);
     
-    // Local palette copy for thread safety
-    uint16 local_palette[256];
+    // Local palette copy for thread safety, each color doubled for expandRow2x()
+    uint32 local_palette[256];
     
     // Initialize perf reporting timer
     perf_last_report_ms = millis();
     
-    // Minimum frame interval (42ms = ~24 FPS)
-    // 24fps is cinema standard and perceptually smooth
-    const TickType_t min_frame_ticks = pdMS_TO_TICKS(42);
+    // Minimum interval to the next frame, set by the size of the last one
+    TickType_t min_frame_ticks = pdMS_TO_TICKS(slow_frame_ms);
     TickType_t last_frame_ticks = xTaskGetTickCount();
     
     while (video_task_running) {
         // Note: Watchdog is configured with 10s timeout and no panic,
         // so we don't need to reset it frequently
         
-        // Event-driven: wait for frame signal with timeout
-        // This replaces the old polling loop - task sleeps until signaled
-        // Max wait time ensures we still render periodically even if no signal
-        uint32_t notification = ulTaskNotifyTake(pdTRUE, min_frame_ticks);
+        // Event-driven: VideoRefresh() only signals when something changed,
+        // so a static screen costs no wakeups. The long timeout still picks
+        // up anything marked without a signal.
+        task_wait(video_task_stats, IDLE_WAIT_MS);
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IDLE_WAIT_MS));
+        task_run(video_task_stats);
         
-        // Also check legacy frame_ready flag for compatibility
-        bool should_render = (notification > 0) || frame_ready;
+        // Leave PSRAM and Core 0 alone while the CPU is being benchmarked
+        if (video_paused) {
+            continue;
+        }
         frame_ready = false;
         
-        // Rate limit: ensure minimum time between frames
+        // Rate limit: hold the frame until the minimum interval has passed,
+        // changes made meanwhile are picked up with it
         TickType_t now = xTaskGetTickCount();
         TickType_t elapsed = now - last_frame_ticks;
-        if (should_render && elapsed < min_frame_ticks) {
-            // Too soon - skip this frame signal, we'll render on next timeout
-            continue;
-        }
-        
-        // Only render if we have something to render
-        if (!should_render && !force_full_update) {
-            // Timeout with nothing to do - check for write-dirty tiles anyway
-            // This handles cases where writes happened but no explicit signal
+        if (elapsed < min_frame_ticks) {
+            task_wait(video_task_stats, (min_frame_ticks - elapsed) * portTICK_PERIOD_MS);
+            vTaskDelay(min_frame_ticks - elapsed);
+            task_run(video_task_stats);
+            now = xTaskGetTickCount();
         }
         
         uint32_t t0, t1;
         
+#if USE_TEAR_FREE
+        // Wait for the next VBL if the CPU is copying one right now
+        int idle = PRESENT_IDLE;
+        if (!__atomic_compare_exchange_n(&present_state, &idle, PRESENT_RENDERING, false,
+                                         __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            continue;
+        }
+        uint8 *render_source = present_buffer;
+#else
+        uint8 *render_source;
+#endif
+        
         // Take a snapshot of the palette only if it changed (thread-safe)
         // This avoids 512-byte memcpy and spinlock contention on every frame
-        if (palette_changed) {
+        // A new mode comes with it in the same step (publishFrameMode())
+        uint32 palette_dirty[256 / 32] = {0};
+        bool mode_switched = false;
+        if (palette_changed || pending_mode_version != frame_mode.version) {
             portENTER_CRITICAL(&frame_spinlock);
-            memcpy(local_palette, palette_rgb565, 256 * sizeof(uint16));
+            if (pending_mode.version != frame_mode.version) {
+                frame_mode = pending_mode;
+                mode_switched = true;
+            }
+            for (int i = 0; i < 256; i++) {
+                local_palette[i] = palette_rgb565[i] * 0x10001u;
+            }
+            memcpy(palette_dirty, palette_changed_mask, sizeof(palette_dirty));
+            memset(palette_changed_mask, 0, sizeof(palette_changed_mask));
             palette_changed = false;
             portEXIT_CRITICAL(&frame_spinlock);
+#if REMOTE_DISPLAY
+            if (mode_switched) {
+                int depth = frame_mode.depth == VDEPTH_16BIT ? 16 : 8 / frame_mode.pixels_per_byte;
+                RemoteSetMode(frame_mode.base, DISPLAY_WIDTH / frame_mode.scale, DISPLAY_HEIGHT / frame_mode.scale,
+                              depth, frame_mode.bytes_per_row);
+            }
+            RemoteSetPalette(local_palette);
+#endif
+        }
+        if (mode_switched) {
+            // One full repaint for the mode and its palette
+            force_full_update = true;
+            perf_inc(perf_mode_count);
         }
         
+        // Mac pixels of this frame per display pixel, fixed until it is pushed
+        int scale = frame_mode.scale;
+#if !USE_TEAR_FREE
+        render_source = frame_mode.base;
+#endif
+        
+        
+#if INPUT_TELEMETRY
+        // An input event handed to the Mac before this frame's changes are taken
+        uint32 photon_armed = __atomic_load_n(&photon_posted, __ATOMIC_ACQUIRE);
+        int photon_kind = photon_which;
+#endif
+        
         // Collect dirty tiles from write-time tracking
         t0 = micros();
+#if VIDEO_TELEMETRY
+        uint32_t frame_start = t0;
+#endif
+#if USE_DISPLAY_SCROLL
+        // Take the queued moves together with the dirty bands, VideoScrollRect()
+        // only queues a move while its source is not dirty or being pushed
+        scroll_move moves[MAX_SCROLL_MOVES];
+        portENTER_CRITICAL(&frame_spinlock);
+        dirty_tile_count = collectWriteDirtyTiles();
+        int move_count = scroll_move_count;
+        memcpy(moves, scroll_moves, move_count * sizeof(scroll_move));
+        scroll_move_count = 0;
+        video_frame_busy = true;
+        portEXIT_CRITICAL(&frame_spinlock);
+        
+        // A full update repaints the destinations anyway
+        if (move_count > 0 && !force_full_update) {
+            if (scale == 1) {
+                dirty_tile_count += applyScrollMoves<1>(moves, move_count);
+            } else {
+                dirty_tile_count += applyScrollMoves<2>(moves, move_count);
+            }
+            perf_add(perf_scroll_count, move_count);
+        }
+#else
         dirty_tile_count = collectWriteDirtyTiles();
+#endif
+        
+        // Repaint the tiles showing palette entries that changed
+        if (frame_mode.depth != VDEPTH_16BIT && !force_full_update) {
+            dirty_tile_count += markPaletteDirtyTiles(palette_dirty);
+        }
+        
+#if USE_CURSOR_OVERLAY
+        // Repaint where the cursor was and where it is now
+        if (cursor_changed) {
+            cursor_sprite next;
+            portENTER_CRITICAL(&frame_spinlock);
+            next = cursor_pending;
+            cursor_changed = false;
+            portEXIT_CRITICAL(&frame_spinlock);
+            if (scale == 1) {
+                dirty_tile_count += markCursorDirtyTiles<1>(cursor_shown);
+                dirty_tile_count += markCursorDirtyTiles<1>(next);
+            } else {
+                dirty_tile_count += markCursorDirtyTiles<2>(cursor_shown);
+                dirty_tile_count += markCursorDirtyTiles<2>(next);
+            }
+            cursor_shown = next;
+        }
+#endif
+#if PERF_HUD
+        // Show or hide the HUD, refresh its text once a second. Only hiding
+        // repaints tiles: the Mac screen it covered.
+        if (HudVisible() != hud_shown) {
+            hud_shown = !hud_shown;
+            if (!hud_shown) {
+                dirty_tile_count += markHudDirtyTiles(scale);
+            }
+        }
+        if (hud_shown && HudUpdate()) {
+            hud_push = true;
+        }
+#endif
         t1 = micros();
-        perf_detect_us += (t1 - t0);
+        perf_add(perf_detect_us, t1 - t0);
+#if VIDEO_TELEMETRY
+        telemetryRecord(TELEMETRY_COLLECT, t1 - t0);
+#endif
         
         // If force_full_update is set (palette change, first frame), mark ALL tiles dirty
         // This ensures we always use tile mode (faster than streaming mode)
-        if (force_full_update) {
+        bool full_update = force_full_update;
+        if (full_update) {
             // Mark all tiles as dirty
             for (int i = 0; i < (TOTAL_TILES + 31) / 32; i++) {
                 dirty_tiles[i] = 0xFFFFFFFF;
             }
+            for (int i = 0; i < TOTAL_TILES; i++) {
+                dirty_bands[i] = TILE_BANDS_ALL;
+            }
             dirty_tile_count = TOTAL_TILES;
             force_full_update = false;
-            perf_full_count++;
+#if USE_TEAR_FREE
+            // Mode switches and resumes rewrite the frame buffer behind the
+            // VBL copies: take all of it (later writes stay marked dirty)
+            memcpy(present_buffer, frame_mode.base, frame_mode.size);
+#endif
+            perf_inc(perf_full_count);
         }
         
         // RENDER - always use tile mode (faster than streaming even for full screen)
         if (dirty_tile_count > 0) {
             // Render and push only dirty tiles
             t0 = micros();
-            renderAndPushDirtyTiles(mac_frame_buffer, local_palette);
+#if VIDEO_TELEMETRY
+            frame_snapshot_us = frame_convert_us = frame_dma_us = 0;
+#endif
+            if (scale == 1) {
+                renderAndPushDirtyTiles<1>(render_source, local_palette, full_update);
+            } else {
+                renderAndPushDirtyTiles<2>(render_source, local_palette, full_update);
+            }
             t1 = micros();
-            perf_render_us += (t1 - t0);
+            perf_add(perf_render_us, t1 - t0);
+#if VIDEO_TELEMETRY
+            telemetryRecord(TELEMETRY_SNAPSHOT, frame_snapshot_us);
+            telemetryRecord(TELEMETRY_CONVERT, frame_convert_us);
+            telemetryRecord(TELEMETRY_DMA, frame_dma_us);
+            telemetryRecord(TELEMETRY_FRAME, t1 - frame_start);
+            telemetryRecord(TELEMETRY_TILES, dirty_tile_count);
+#endif
             
-            perf_partial_count++;
+            perf_inc(perf_partial_count);
+            perf_add(perf_tile_count, dirty_tile_count);
+#if INPUT_TELEMETRY
+            if (photon_armed) {
+                photonRecord(photon_armed, photon_kind);
+            }
+#endif
         } else {
             // No tiles dirty, nothing to do!
-            perf_skip_count++;
+            perf_inc(perf_skip_count);
+        }
+#if PERF_HUD
+        if (hud_push && hud_shown) {
+            pushHud();
         }
+        hud_push = false;
+#endif
+#if USE_DISPLAY_SCROLL
+        video_frame_busy = false;
+#endif
+#if USE_TEAR_FREE
+        __atomic_store_n(&present_state, PRESENT_IDLE, __ATOMIC_RELEASE);
+#endif
         
-        perf_frame_count++;
+        perf_inc(perf_frame_count);
         last_frame_ticks = now;
+        min_frame_ticks = pdMS_TO_TICKS(dirty_tile_count <= FAST_FRAME_TILES ? fast_frame_ms : slow_frame_ms);
         
         // Report performance stats periodically
         reportVideoPerfStats();
@@ -1205,6 +3339,26 @@ static void videoRenderTaskOptimized(void *param)
     vTaskDelete(NULL);
 }
 
+/*
+ *  Add the modes of one resolution, every depth from 1-bit to max_depth
+ */
+static void addVideoModes(vector<video_mode> &modes, int width, int height, uint32 resolution_id, video_depth max_depth)
+{
+    video_mode mode;
+    mode.x = width;
+    mode.y = height;
+    mode.resolution_id = resolution_id;
+    mode.user_data = 0;
+    
+    for (int depth = VDEPTH_1BIT; depth <= max_depth; depth++) {
+        mode.depth = (video_depth)depth;
+        mode.bytes_per_row = TrivialBytesPerRow(width, mode.depth);
+        modes.push_back(mode);
+        Serial.printf("[VIDEO] Added mode: %dx%d, %d-bit, %d bytes/row\n",
+                      width, height, 1 << depth, mode.bytes_per_row);
+    }
+}
+
 /*
  *  Initialize video driver
  */
@@ -1214,6 +3368,17 @@ bool VideoInit(bool classic)
     
     UNUSED(classic);
     
+    // Frame pacing set by the performance profile, if any
+    if (PrefsFindInt32("fastframems") > 0)
+        fast_frame_ms = PrefsFindInt32("fastframems");
+    if (PrefsFindInt32("slowframems") > 0)
+        slow_frame_ms = PrefsFindInt32("slowframems");
+    ConsoleAddTunable("fastframems", &fast_frame_ms, 1, 1000);
+    ConsoleAddTunable("slowframems", &slow_frame_ms, 1, 1000);
+#if USE_RENDER_ASSIST
+    ConsoleAddTunable("renderassist", &render_assist, 0, 1);
+#endif
+    
     // Get display dimensions
     display_width = M5.Display.width();
     display_height = M5.Display.height();
@@ -1225,24 +3390,45 @@ bool VideoInit(bool classic)
                       DISPLAY_WIDTH, DISPLAY_HEIGHT, display_width, display_height);
     }
     
-    // Allocate Mac frame buffer in PSRAM
-    // For 640x360 @ 8-bit = 230,400 bytes
-    frame_buffer_size = MAC_SCREEN_WIDTH * MAC_SCREEN_HEIGHT;
+    // Allocate Mac frame buffer in PSRAM, sized for the largest mode
+    // 640x360 @ 16-bit and 1280x720 @ 8-bit are both 921,600 bytes
+    frame_buffer_size = MAC_MAX_BYTES_PER_ROW * MAC_MAX_HEIGHT;
     
     mac_frame_buffer = (uint8 *)ps_malloc(frame_buffer_size);
     if (!mac_frame_buffer) {
         Serial.println("[VIDEO] ERROR: Failed to allocate Mac frame buffer in PSRAM!");
         return false;
     }
+    frame_psram = mac_frame_buffer;
+    frame_psram_size = frame_buffer_size;
     
     Serial.printf("[VIDEO] Mac frame buffer allocated: %p (%d bytes)\n", mac_frame_buffer, frame_buffer_size);
     
+#if FRAME_SRAM
+    // The small modes' frame buffer, if the plan gave it room
+    frame_sram = (uint8 *)SramAlloc(frame_sram_slot, FRAME_SRAM_SIZE);
+#endif
+    
     // Clear frame buffer to gray
     memset(mac_frame_buffer, 0x80, frame_buffer_size);
     
+#if USE_TEAR_FREE
+    // Second buffer the video task renders from, refreshed at each VBL
+    present_buffer = (uint8 *)ps_malloc(frame_buffer_size);
+    if (!present_buffer) {
+        Serial.println("[VIDEO] ERROR: Failed to allocate present buffer in PSRAM!");
+        return false;
+    }
+    memcpy(present_buffer, mac_frame_buffer, frame_buffer_size);
+    memset(present_dirty_bands, 0, sizeof(present_dirty_bands));
+#endif
+    
+    initDecodeTables();
+    
     // Initialize dirty tracking and render lock
     memset(dirty_tiles, 0, sizeof(dirty_tiles));
-    memset(write_dirty_tiles, 0, sizeof(write_dirty_tiles));
+    memset(dirty_bands, 0, sizeof(dirty_bands));
+    memset(write_dirty_bands, 0, sizeof(write_dirty_bands));
     memset(tile_render_active, 0, sizeof(tile_render_active));
     force_full_update = true;  // Force full update on first frame
     
@@ -1259,59 +3445,64 @@ bool VideoInit(bool classic)
     M5.Display.endWrite();
     Serial.println("[VIDEO] Initial screen cleared");
     
+#if USE_PPA_SCALE
+    // Hardware tile scaling (non-fatal, software scaling otherwise)
+    initPPA();
+#endif
+    
+#if USE_ASYNC_SNAPSHOT
+    // GDMA band snapshots (non-fatal, memcpy() otherwise)
+    initSnapshotDMA();
+#endif
+    
+#if USE_DSI_DIRECT
+    // Bands into the panel's frame buffer (non-fatal, pushed through M5GFX otherwise)
+    panel_direct = initPanelDirect();
+#endif
+    
     // Set up Mac frame buffer pointers
     MacFrameBaseHost = mac_frame_buffer;
     MacFrameSize = frame_buffer_size;
+    MacFrameMaxSize = frame_buffer_size;
     MacFrameLayout = FLAYOUT_DIRECT;
     
     // Initialize default palette for 8-bit mode (256 colors)
     // This sets up a proper color palette instead of grayscale,
     // so MacOS will default to "256 colors" instead of "256 grays"
-    initDefaultPalette(VDEPTH_8BIT);
+    initDefaultPalette(VDEPTH_8BIT, palette_rgb565);
     
     // Create video mode vector with all supported depths
     // Per Basilisk II rules: lowest depth must be available in all resolutions,
     // and if a resolution has a depth, it must have all lower depths too.
-    // We support 1/2/4/8 bit depths at 640x360.
+    // We support 1/2/4/8/16 bit depths at 640x360 and 1/2/4/8 bit depths at
+    // native 1280x720 (16-bit would need twice the frame buffer).
     vector<video_mode> modes;
+    addVideoModes(modes, DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 2, RES_ID_DOUBLED, VDEPTH_16BIT);
+    addVideoModes(modes, DISPLAY_WIDTH, DISPLAY_HEIGHT, RES_ID_NATIVE, VDEPTH_8BIT);
+    
+    // Start at the resolution of the "screen" pref (8-bit default)
+    int pref_width = 0, pref_height = 0;
+    const char *screen = PrefsFindString("screen");
+    if (screen) {
+        sscanf(screen, "%*[^/]/%d/%d", &pref_width, &pref_height);
+    }
+    uint32 resolution_id = (pref_width == DISPLAY_WIDTH && pref_height == DISPLAY_HEIGHT) ? RES_ID_NATIVE : RES_ID_DOUBLED;
     video_mode mode;
-    mode.x = MAC_SCREEN_WIDTH;
-    mode.y = MAC_SCREEN_HEIGHT;
-    mode.resolution_id = 0x80;
-    mode.user_data = 0;
-    
-    // Add 1-bit mode (black and white)
-    mode.depth = VDEPTH_1BIT;
-    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_1BIT);  // 80 bytes
-    modes.push_back(mode);
-    Serial.printf("[VIDEO] Added mode: 1-bit, %d bytes/row\n", mode.bytes_per_row);
-    
-    // Add 2-bit mode (4 colors)
-    mode.depth = VDEPTH_2BIT;
-    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_2BIT);  // 160 bytes
-    modes.push_back(mode);
-    Serial.printf("[VIDEO] Added mode: 2-bit, %d bytes/row\n", mode.bytes_per_row);
-    
-    // Add 4-bit mode (16 colors)
-    mode.depth = VDEPTH_4BIT;
-    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_4BIT);  // 320 bytes
-    modes.push_back(mode);
-    Serial.printf("[VIDEO] Added mode: 4-bit, %d bytes/row\n", mode.bytes_per_row);
-    
-    // Add 8-bit mode (256 colors) - this is our default
-    mode.depth = VDEPTH_8BIT;
-    mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, VDEPTH_8BIT);  // 640 bytes
-    modes.push_back(mode);
-    Serial.printf("[VIDEO] Added mode: 8-bit, %d bytes/row\n", mode.bytes_per_row);
-    
-    // Store current mode info (8-bit default)
+    for (size_t i = 0; i < modes.size(); i++) {
+        if (modes[i].resolution_id == resolution_id && modes[i].depth == VDEPTH_8BIT) {
+            mode = modes[i];
+        }
+    }
     current_mode = mode;
+    Serial.printf("[VIDEO] Default mode: %dx%d, 8-bit\n", mode.x, mode.y);
     
     // Initialize the video state cache for 8-bit mode
-    updateVideoStateCache(VDEPTH_8BIT, mode.bytes_per_row);
+    updateVideoStateCache(VDEPTH_8BIT, mode.bytes_per_row, DISPLAY_WIDTH / mode.x);
+    publishFrameMode(VDEPTH_8BIT, mode.bytes_per_row, DISPLAY_WIDTH / mode.x, NULL);
+    InputSetScreenSize(mode.x, mode.y);
     
     // Create monitor descriptor with 8-bit as default depth
-    the_monitor = new ESP32_monitor_desc(modes, VDEPTH_8BIT, 0x80);
+    the_monitor = new ESP32_monitor_desc(modes, VDEPTH_8BIT, resolution_id);
     VideoMonitors.push_back(the_monitor);
     
     // Set Mac frame buffer base address
@@ -1340,6 +3531,9 @@ bool VideoInit(bool classic)
     Serial.printf("[VIDEO] Mac frame base: 0x%08X\n", MacFrameBaseMac);
     Serial.printf("[VIDEO] Dirty tracking: %dx%d tiles (%d total), threshold %d%%\n", 
                   TILES_X, TILES_Y, TOTAL_TILES, DIRTY_THRESHOLD_PERCENT);
+    
+    // Remote viewer stream, fed by the video task
+    RemoteInit();
     Serial.println("[VIDEO] VideoInit complete (with dirty tile tracking)");
     
     return true;
@@ -1355,15 +3549,34 @@ void VideoExit(void)
     // Stop video task first
     stopVideoTask();
     
+#if USE_PPA_SCALE
+    if (ppa_srm_client != NULL) {
+        ppa_unregister_client(ppa_srm_client);
+        ppa_srm_client = NULL;
+    }
+#endif
+    
     // Clear dirty tracking and render lock (safety for potential re-init)
     memset(dirty_tiles, 0, sizeof(dirty_tiles));
-    memset(write_dirty_tiles, 0, sizeof(write_dirty_tiles));
+    memset(dirty_bands, 0, sizeof(dirty_bands));
+    memset(write_dirty_bands, 0, sizeof(write_dirty_bands));
     memset(tile_render_active, 0, sizeof(tile_render_active));
     
-    if (mac_frame_buffer) {
-        free(mac_frame_buffer);
-        mac_frame_buffer = NULL;
+    if (frame_psram) {
+        free(frame_psram);
+        frame_psram = NULL;
     }
+    if (frame_sram) {
+        free(frame_sram);
+        frame_sram = NULL;
+    }
+    mac_frame_buffer = NULL;
+#if USE_TEAR_FREE
+    if (present_buffer) {
+        free(present_buffer);
+        present_buffer = NULL;
+    }
+#endif
     
     // Clear monitors vector
     VideoMonitors.clear();
@@ -1390,10 +3603,45 @@ void VideoSignalFrameReady(void)
     // Send task notification to wake up video task immediately
     // This is more efficient than polling - video task sleeps until notified
     if (video_task_handle != NULL) {
+        task_notify(video_task_stats);
         xTaskNotifyGive(video_task_handle);
     }
 }
 
+/*
+ *  Pause/resume display updates
+ *  The whole screen is redrawn on resume, since the frame buffer may have
+ *  been written behind the video task's back
+ */
+void VideoSetPaused(bool paused)
+{
+    video_paused = paused;
+    if (!paused) {
+        force_full_update = true;
+    }
+}
+
+/*
+ *  Check whether the video task has anything to push (called on the CPU core)
+ */
+static bool videoUpdatePending(void)
+{
+    if (force_full_update || palette_changed) return true;
+#if USE_CURSOR_OVERLAY
+    if (cursor_changed) return true;
+#endif
+#if USE_DISPLAY_SCROLL
+    if (scroll_move_count > 0) return true;
+#endif
+#if !USE_TEAR_FREE
+    // (presentFrame() signals the bands it copies itself)
+    for (int i = 0; i < TOTAL_TILES; i++) {
+        if (__atomic_load_n(&write_dirty_bands[i], __ATOMIC_RELAXED)) return true;
+    }
+#endif
+    return false;
+}
+
 /*
  *  Video refresh - legacy synchronous function
  *  Now just signals the video task instead of doing the work directly
@@ -1406,8 +3654,18 @@ void VideoRefresh(void)
         return;
     }
     
-    // Signal video task that a new frame is ready
-    VideoSignalFrameReady();
+#if USE_TEAR_FREE
+    // Before the Mac runs its VBL there are no VBL copies
+    if (!HasMacStarted()) {
+        presentFrame();
+        return;
+    }
+#endif
+    
+    // Wake the video task only when there is something to show
+    if (videoUpdatePending()) {
+        VideoSignalFrameReady();
+    }
 }
 
 /*
@@ -1423,8 +3681,10 @@ void VideoQuitFullScreen(void)
  */
 void VideoInterrupt(void)
 {
-    // Trigger ADB interrupt for mouse/keyboard updates
-    SetInterruptFlag(INTFLAG_ADB);
+#if USE_TEAR_FREE
+    // The Mac is between two frames: show what it has drawn
+    presentFrame();
+#endif
 }
 
 /*
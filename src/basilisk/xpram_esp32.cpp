@@ -2,12 +2,31 @@
  *  xpram_esp32.cpp - XPRAM handling for ESP32
  *
  *  BasiliskII ESP32 Port
+ *
+ *  XPRAM used to be read from a file on the SD card at boot and written
+ *  back only by XPRAMExit(), which a Tab5 that is switched off never runs:
+ *  control panel changes were lost. It now lives in NVS (the "basilisk"
+ *  namespace of the nvs partition in flash). The Mac reads and writes the
+ *  copy in PSRAM as before. XPRAMPoll(), called by the service task on
+ *  Core 0, compares it with the last committed copy and commits it once it
+ *  has not changed for XPRAM_COMMIT_DELAY_MS, so a control panel writing a
+ *  dozen bytes costs one flash write, none of it on the CPU core or the SD
+ *  bus.
+ *
+ *  An old /BasiliskII_XPRAM file is taken over on the first boot without an
+ *  NVS copy. With XPRAM_NVS 0 the file is used as before.
  */
 
 #include "sysdeps.h"
 #include "xpram.h"
+#include "perf_registry.h"
+
+#include "sdcard.h"
 
-#include <SD.h>
+#if XPRAM_NVS
+#include <nvs_flash.h>
+#include <nvs.h>
+#endif
 
 #define DEBUG 1
 #include "debug.h"
@@ -15,48 +34,132 @@
 // XPRAM file on SD card
 const char XPRAM_FILE_PATH[] = "/BasiliskII_XPRAM";
 
+#if XPRAM_NVS
+#define XPRAM_NVS_NAMESPACE     "basilisk"
+#define XPRAM_NVS_KEY           "xpram"
+#define XPRAM_COMMIT_DELAY_MS   2000    // Unchanged this long before the commit
+
+static perf_counter *const perf_commits = PerfCounter("xpram.commits", PERF_COUNT, PERF_CORE_IO);
+
+static nvs_handle_t xpram_nvs = 0;          // 0: NVS not available, SD file used
+static uint8 committed[XPRAM_SIZE];         // Contents of NVS (service task)
+static uint8 pending[XPRAM_SIZE];           // Last copy seen changed, waiting to settle
+static bool changed = false;
+static uint32 changed_ms;                   // When pending last changed
+
+static bool openNVS(void)
+{
+    if (xpram_nvs)
+        return true;
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        nvs_flash_erase();
+        err = nvs_flash_init();
+    }
+    if (err == ESP_OK)
+        err = nvs_open(XPRAM_NVS_NAMESPACE, NVS_READWRITE, &xpram_nvs);
+    if (err != ESP_OK) {
+        Serial.printf("[XPRAM] WARNING: No NVS (%s), XPRAM kept on the SD card\n", esp_err_to_name(err));
+        xpram_nvs = 0;
+        return false;
+    }
+    return true;
+}
+
+static bool commitNVS(const uint8 *data)
+{
+    esp_err_t err = nvs_set_blob(xpram_nvs, XPRAM_NVS_KEY, data, XPRAM_SIZE);
+    if (err == ESP_OK)
+        err = nvs_commit(xpram_nvs);
+    if (err != ESP_OK) {
+        Serial.printf("[XPRAM] ERROR: NVS commit failed (%s)\n", esp_err_to_name(err));
+        return false;
+    }
+    memcpy(committed, data, XPRAM_SIZE);
+    perf_inc(perf_commits);
+    return true;
+}
+#endif
+
+static bool loadFile(void)
+{
+    File f = SDCard().open(XPRAM_FILE_PATH, FILE_READ);
+    if (!f)
+        return false;
+    size_t bytes_read = f.read(XPRAM, XPRAM_SIZE);
+    f.close();
+    Serial.printf("[XPRAM] Loaded %d bytes from %s\n", bytes_read, XPRAM_FILE_PATH);
+    return true;
+}
+
 /*
- *  Load XPRAM from SD card
+ *  Load XPRAM from NVS, or from the SD card
  */
 void LoadXPRAM(const char *vmdir)
 {
     UNUSED(vmdir);
-    
+
     Serial.println("[XPRAM] Loading XPRAM...");
-    
+
     // Check if XPRAM is allocated
     if (XPRAM == NULL) {
         Serial.println("[XPRAM] ERROR: XPRAM not allocated");
         return;
     }
-    
+
     // Clear XPRAM first
     memset(XPRAM, 0, XPRAM_SIZE);
-    
+
+#if XPRAM_NVS
+    if (openNVS()) {
+        size_t size = XPRAM_SIZE;
+        if (nvs_get_blob(xpram_nvs, XPRAM_NVS_KEY, XPRAM, &size) == ESP_OK && size == XPRAM_SIZE) {
+            memcpy(committed, XPRAM, XPRAM_SIZE);
+            Serial.println("[XPRAM] Loaded from NVS");
+            return;
+        }
+
+        // First boot with NVS: take over the SD file, committed by XPRAMPoll()
+        memset(XPRAM, 0, XPRAM_SIZE);
+        memset(committed, 0xff, XPRAM_SIZE);
+        if (!loadFile()) {
+            Serial.println("[XPRAM] No saved XPRAM found, using defaults");
+        }
+        return;
+    }
+#endif
+
     // Try to load from SD card
-    File f = SD.open(XPRAM_FILE_PATH, FILE_READ);
-    if (f) {
-        size_t bytes_read = f.read(XPRAM, XPRAM_SIZE);
-        f.close();
-        Serial.printf("[XPRAM] Loaded %d bytes from %s\n", bytes_read, XPRAM_FILE_PATH);
-    } else {
+    if (!loadFile()) {
         Serial.println("[XPRAM] No saved XPRAM found, using defaults");
     }
 }
 
 /*
- *  Save XPRAM to SD card
+ *  Save XPRAM to NVS (at once), or to the SD card
  */
 void SaveXPRAM(void)
 {
     Serial.println("[XPRAM] Saving XPRAM...");
-    
+
     if (XPRAM == NULL) {
         Serial.println("[XPRAM] ERROR: XPRAM not allocated");
         return;
     }
-    
-    File f = SD.open(XPRAM_FILE_PATH, FILE_WRITE);
+
+#if XPRAM_NVS
+    if (xpram_nvs) {
+        uint8 copy[XPRAM_SIZE];
+        memcpy(copy, XPRAM, XPRAM_SIZE);
+        if (memcmp(copy, committed, XPRAM_SIZE) != 0 && commitNVS(copy)) {
+            Serial.println("[XPRAM] Saved to NVS");
+        }
+        changed = false;
+        return;
+    }
+#endif
+
+    File f = SDCard().open(XPRAM_FILE_PATH, FILE_WRITE);
     if (f) {
         size_t bytes_written = f.write(XPRAM, XPRAM_SIZE);
         f.close();
@@ -66,15 +169,52 @@ void SaveXPRAM(void)
     }
 }
 
+#if XPRAM_NVS
 /*
- *  Delete XPRAM file
+ *  Commit XPRAM changes once they have settled (service task, Core 0)
+ */
+void XPRAMPoll(uint32 now_ms)
+{
+    if (xpram_nvs == 0 || XPRAM == NULL)
+        return;
+
+    // The CPU may be writing meanwhile: a torn copy differs from the next one
+    // and only restarts the delay
+    uint8 copy[XPRAM_SIZE];
+    memcpy(copy, XPRAM, XPRAM_SIZE);
+    if (!changed) {
+        if (memcmp(copy, committed, XPRAM_SIZE) == 0)
+            return;
+    } else if (memcmp(copy, pending, XPRAM_SIZE) == 0) {
+        if (now_ms - changed_ms >= XPRAM_COMMIT_DELAY_MS) {
+            commitNVS(copy);
+            changed = false;
+        }
+        return;
+    }
+    memcpy(pending, copy, XPRAM_SIZE);
+    changed = true;
+    changed_ms = now_ms;
+}
+#endif
+
+/*
+ *  Delete the saved XPRAM
  */
 void ZapPRAM(void)
 {
     Serial.println("[XPRAM] Zapping PRAM...");
-    
+
     if (XPRAM != NULL) {
         memset(XPRAM, 0, XPRAM_SIZE);
     }
-    SD.remove(XPRAM_FILE_PATH);
+#if XPRAM_NVS
+    if (openNVS()) {
+        nvs_erase_key(xpram_nvs, XPRAM_NVS_KEY);
+        nvs_commit(xpram_nvs);
+        memset(committed, 0, XPRAM_SIZE);
+        changed = false;
+    }
+#endif
+    SDCard().remove(XPRAM_FILE_PATH);
 }
@@ -0,0 +1,61 @@
+/*
+ *  Arduino.h - Minimal Arduino core for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  sysdeps.h and a few device-independent files include <Arduino.h> for
+ *  Serial, millis()/micros() and the memory attributes. This header provides
+ *  just those on top of the C library; timing comes from the emulated
+ *  instruction count (see main_host.cpp), so runs are repeatable.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <assert.h>
+#include <sys/time.h>
+#include <sys/param.h>      // MIN/MAX
+#include <arpa/inet.h>      // htons/ntohl, which lwIP provides on the device
+
+// sysdeps.h declares its own 32-bit loff_t, which clashes with glibc's
+#define loff_t b2_loff_t
+
+// Serial console, written to stderr so stdout stays free for trace output
+class HardwareSerial {
+public:
+    int printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vfprintf(stderr, fmt, ap);
+        va_end(ap);
+        return n;
+    }
+    void print(const char *s) { fputs(s, stderr); }
+    void println(const char *s = "") { fprintf(stderr, "%s\n", s); }
+    int available(void) { return 0; }
+    int read(void) { return -1; }
+};
+extern HardwareSerial Serial;
+
+// Virtual time since start (main_host.cpp)
+extern unsigned long millis(void);
+extern unsigned long micros(void);
+static inline void delay(unsigned long ms) { (void)ms; }
+static inline void delayMicroseconds(unsigned int us) { (void)us; }
+static inline void yield(void) {}
+
+static inline void *ps_malloc(size_t size) { return malloc(size); }
+static inline void *ps_calloc(size_t n, size_t size) { return calloc(n, size); }
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif /* HOST_ARDUINO_H */
@@ -0,0 +1,401 @@
+/*
+ *  main_host.cpp - Main program for the headless host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Runs the same emulator core as the device on a Linux/macOS host, for
+ *  benchmarking and profiling with the usual host tools (perf, gprof,
+ *  valgrind). There is no display, input or sound.
+ *
+ *  Time is emulated: the clock advances by one microsecond every
+ *  HOST_INSNS_PER_US instructions, and idle_wait() skips straight to the
+ *  next tick. Interrupts therefore arrive at the same instruction in every
+ *  run, so a ROM boot is deterministic and the per-second trace (pc and RAM
+ *  checksums) can be diffed between two builds of the core.
+ *
+ *  Usage: basilisk_host --rom Q650.ROM [--disk System.dsk] [--seconds 30]
+ *         [--trace true] [--screenshot screen.ppm]
+ *         [--hibernate true] [--resume true]
+ */
+
+#include "sysdeps.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#include "cpu_emulation.h"
+#include "sys.h"
+#include "rom_patches.h"
+#include "xpram.h"
+#include "timer.h"
+#include "video.h"
+#include "prefs.h"
+#include "prefs_items.h"
+#include "main.h"
+#include "macos_util.h"
+#include "user_strings.h"
+#include "adb.h"
+#include "m68k.h"
+#include "memory.h"
+#include "readcpu.h"
+#include "newcpu.h"
+#include "trace_ring.h"
+#include "cpu_bench.h"
+#include "cpu_check.h"
+#include "savestate.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// ROM file size limits
+const uint32 ROM_MIN_SIZE = 64 * 1024;    // 64KB minimum
+const uint32 ROM_MAX_SIZE = 1024 * 1024;  // 1MB maximum
+
+// Serial console (stderr, see include/Arduino.h)
+HardwareSerial Serial;
+
+// CPU and FPU type
+int CPUType = 4;           // 68040
+bool CPUIs68060 = false;
+int FPUType = 1;           // 68881
+bool TwentyFourBitAddressing = false;
+
+// Interrupt flags
+uint32 InterruptFlags = 0;
+
+// Emulated clock rate and loop quantum. The quantum matches the device's
+// QUANTUM_TARGET_US (2ms) at the emulated rate.
+#define HOST_INSNS_PER_US   16
+#define HOST_QUANTUM        (2000 * HOST_INSNS_PER_US)
+#define QUANTUM_PENDING     500         // Next check while an interrupt waits
+int32 emulated_ticks = HOST_QUANTUM;
+static int32 emulated_ticks_running = HOST_QUANTUM;
+
+static uint64 total_instructions = 0;
+static uint64 skipped_us = 0;           // Emulated time spent in idle_wait()
+
+static uint32 last_60hz_time = 0;
+static uint32 last_second_time = 0;
+static uint32 seconds_run = 0;
+static uint32 seconds_limit = 0;
+static bool trace_seconds = false;
+static bool hibernate = false;          // Snapshot instead of quitting at seconds_limit
+static volatile bool host_quit = false;
+
+extern bool quit_program;
+extern bool VideoHostSaveScreenshot(const char *path);
+extern uint8 *VideoGetFrameBuffer(void);
+extern uint32 VideoGetFrameBufferSize(void);
+
+/*
+ *  Emulated time
+ */
+uint64 host_virtual_us(void)
+{
+    uint64 executed = total_instructions + (emulated_ticks_running - emulated_ticks);
+    return executed / HOST_INSNS_PER_US + skipped_us;
+}
+
+unsigned long micros(void)
+{
+    return (unsigned long)host_virtual_us();
+}
+
+unsigned long millis(void)
+{
+    return (unsigned long)(host_virtual_us() / 1000);
+}
+
+/*
+ *  FNV-1a hash, for the trace
+ */
+static uint32 hash_bytes(const uint8 *p, uint32 size)
+{
+    uint32 h = 2166136261u;
+    for (uint32 i = 0; i < size; i++)
+        h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+/*
+ *  Set/clear interrupt flags (single-threaded, see main_esp32.cpp)
+ */
+void SetInterruptFlag(uint32 flag)
+{
+    __atomic_or_fetch(&InterruptFlags, flag, __ATOMIC_RELEASE);
+    idle_resume();
+}
+
+void ClearInterruptFlag(uint32 flag)
+{
+    __atomic_and_fetch(&InterruptFlags, ~flag, __ATOMIC_RELAXED);
+}
+
+/*
+ *  CPU tick check - called every HOST_QUANTUM instructions
+ */
+void cpu_do_check_ticks(void)
+{
+    total_instructions += emulated_ticks_running - emulated_ticks;
+    emulated_ticks_running = emulated_ticks = 0;
+    uint32 current_time = millis();
+
+    if (current_time - last_60hz_time >= 16) {
+        last_60hz_time = current_time;
+        SetInterruptFlag(ADBPending() ? INTFLAG_60HZ | INTFLAG_ADB : INTFLAG_60HZ);
+        TriggerInterrupt();
+    }
+
+    if (current_time - last_second_time >= 1000) {
+        last_second_time += 1000;
+        seconds_run++;
+        SetInterruptFlag(INTFLAG_1HZ);
+        TriggerInterrupt();
+
+        if (trace_seconds) {
+            uint8 *fb = VideoGetFrameBuffer();
+            printf("%4u insns=%llu pc=%08x sr=%04x ram=%08x fb=%08x\n", seconds_run,
+                   (unsigned long long)total_instructions, m68k_getpc(), regs.sr,
+                   hash_bytes(RAMBaseHost, RAMSize), fb ? hash_bytes(fb, VideoGetFrameBufferSize()) : 0);
+            fflush(stdout);
+        }
+        if (seconds_limit && seconds_run >= seconds_limit) {
+#if SAVE_STATE
+            if (hibernate)
+                SaveStateRequest();
+            else
+#endif
+            host_quit = true;
+        }
+    }
+
+#if SAVE_STATE
+    // Ends the run once the snapshot has been written (or has failed)
+    if (SaveStatePoll())
+        host_quit = true;
+#endif
+
+    // Execute68k() clears quit_program for every nested call, so keep
+    // breaking out until the outermost m68k_execute() has returned
+    if (host_quit) {
+        quit_program = true;
+        SPCFLAGS_SET(SPCFLAG_BRK);
+    }
+
+    emulated_ticks_running = InterruptFlags ? QUANTUM_PENDING : HOST_QUANTUM;
+    emulated_ticks = emulated_ticks_running;
+}
+
+/*
+ *  Idle support for idle_wait() (timer_host.cpp): the time until the next
+ *  60Hz tick is skipped instead of slept
+ */
+uint32 basilisk_idle_timeout_us(void)
+{
+    uint32 elapsed = millis() - last_60hz_time;
+    return elapsed >= 16 ? 0 : (16 - elapsed) * 1000;
+}
+
+void basilisk_idle_done(uint32 slept_us)
+{
+    skipped_us += slept_us;
+    emulated_ticks_running -= emulated_ticks;
+    emulated_ticks = 0;
+}
+
+/*
+ *  Mutex functions (single-threaded)
+ */
+B2_mutex *B2_create_mutex(void)
+{
+    return new B2_mutex;
+}
+
+void B2_lock_mutex(B2_mutex *mutex)
+{
+    UNUSED(mutex);
+}
+
+void B2_unlock_mutex(B2_mutex *mutex)
+{
+    UNUSED(mutex);
+}
+
+void B2_delete_mutex(B2_mutex *mutex)
+{
+    delete mutex;
+}
+
+/*
+ *  Flush code cache - retires decode cache traces covering the patched code
+ */
+void FlushCodeCache(void *start, uint32 size)
+{
+#if USE_DECODE_CACHE
+    uint8 *p = (uint8 *)start;
+    if (p >= RAMBaseHost && p < RAMBaseHost + RAMSize) {
+        m68k_dcache_invalidate(p - RAMBaseHost, size);
+    } else if (p >= ROMBaseHost && p < ROMBaseHost + ROMSize) {
+        // ROM traces share one generation, so patching ROM drops everything
+        m68k_dcache_flush();
+    }
+#else
+    UNUSED(start);
+    UNUSED(size);
+#endif
+}
+
+/*
+ *  Alerts
+ */
+void ErrorAlert(const char *text)
+{
+    Serial.printf("[ERROR] %s\n", text);
+}
+
+void WarningAlert(const char *text)
+{
+    Serial.printf("[WARNING] %s\n", text);
+}
+
+bool ChoiceAlert(const char *text, const char *pos, const char *neg)
+{
+    Serial.printf("[CHOICE] %s (%s/%s)\n", text, pos, neg);
+    return true;
+}
+
+/*
+ *  Quit emulator
+ */
+void QuitEmulator(void)
+{
+    Serial.println("[MAIN] QuitEmulator called");
+#if TRACE_RING
+    if (trace_ring_level)
+        trace_ring_flush();
+#endif
+    host_quit = true;
+}
+
+/*
+ *  Load ROM file
+ */
+static bool LoadROM(const char *rom_path)
+{
+    FILE *f = fopen(rom_path, "rb");
+    if (!f) {
+        Serial.printf("[MAIN] ERROR: Cannot open ROM file: %s\n", rom_path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long rom_size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    if (rom_size < (long)ROM_MIN_SIZE || rom_size > (long)ROM_MAX_SIZE) {
+        Serial.printf("[MAIN] ERROR: Invalid ROM size %ld (expected %d-%d bytes)\n",
+                      rom_size, ROM_MIN_SIZE, ROM_MAX_SIZE);
+        fclose(f);
+        return false;
+    }
+
+    // Round up to nearest 64KB
+    ROMSize = (rom_size + 0xFFFF) & ~0xFFFF;
+    ROMBaseHost = (uint8 *)calloc(1, ROMSize);
+    if (!ROMBaseHost || fread(ROMBaseHost, 1, rom_size, f) != (size_t)rom_size) {
+        Serial.printf("[MAIN] ERROR: Cannot read ROM file: %s\n", rom_path);
+        fclose(f);
+        free(ROMBaseHost);
+        ROMBaseHost = NULL;
+        return false;
+    }
+    fclose(f);
+
+    Serial.printf("[MAIN] ROM loaded (%d bytes)\n", ROMSize);
+    return true;
+}
+
+/*
+ *  Allocate Mac RAM
+ */
+static bool AllocateRAM(void)
+{
+    RAMSize = PrefsFindInt32("ramsize");
+    if (RAMSize < 1024 * 1024) {
+        RAMSize = 8 * 1024 * 1024;  // Default 8MB
+    }
+
+    RAMBaseHost = (uint8 *)calloc(1, RAMSize);
+    if (!RAMBaseHost) {
+        Serial.println("[MAIN] ERROR: Cannot allocate Mac RAM!");
+        return false;
+    }
+    Serial.printf("[MAIN] Mac RAM: %d bytes\n", RAMSize);
+    return true;
+}
+
+/*
+ *  Main program
+ */
+int main(int argc, char **argv)
+{
+    PrefsInit(NULL, argc, argv);
+    for (int i = 1; i < argc; i++) {
+        if (argv[i] != NULL) {
+            Serial.printf("[MAIN] Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    seconds_limit = PrefsFindInt32("seconds");
+    trace_seconds = PrefsFindBool("trace");
+    hibernate = PrefsFindBool("hibernate");
+
+    SysInit();
+    if (!AllocateRAM())
+        return 1;
+    if (!LoadROM(PrefsFindString("rom")))
+        return 1;
+    if (!InitAll(NULL)) {
+        ErrorAlert("InitAll() failed");
+        return 1;
+    }
+#if CPU_BENCH
+    if (PrefsFindBool("benchmark"))
+        cpu_bench_run();
+#endif
+#if CPU_CHECK
+    if (PrefsFindBool("cpucheck"))
+        cpu_check_run();
+#endif
+
+    bool resumed = false;
+#if SAVE_STATE
+    resumed = PrefsFindBool("resume") && SaveStateRestore();
+#endif
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (resumed)
+        Resume680x0();
+    else
+        Start680x0();
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    total_instructions += emulated_ticks_running - emulated_ticks;
+    emulated_ticks_running = emulated_ticks = 0;
+    double wall = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    uint8 *fb = VideoGetFrameBuffer();
+    Serial.printf("[MAIN] %llu instructions, %.2fs emulated (%.2fs idle), %.2fs wall, %.2f MIPS\n",
+                  (unsigned long long)total_instructions, host_virtual_us() / 1e6, skipped_us / 1e6,
+                  wall, wall > 0 ? total_instructions / wall / 1e6 : 0.0);
+    Serial.printf("[MAIN] pc=%08x ram=%08x fb=%08x\n", m68k_getpc(), hash_bytes(RAMBaseHost, RAMSize),
+                  fb ? hash_bytes(fb, VideoGetFrameBufferSize()) : 0);
+
+    const char *screenshot = PrefsFindString("screenshot");
+    if (screenshot)
+        VideoHostSaveScreenshot(screenshot);
+
+    ExitAll();
+    SysExit();
+    PrefsExit();
+    return 0;
+}
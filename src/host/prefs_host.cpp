@@ -0,0 +1,67 @@
+/*
+ *  prefs_host.cpp - Preferences handling for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Defaults mirror prefs_esp32.cpp; everything else comes from the command
+ *  line (PrefsInit() parses "--keyword value" for every prefs item, e.g.
+ *  --rom Q650.ROM --disk System.dsk --ramsize 16777216).
+ */
+
+#include "sysdeps.h"
+#include "prefs.h"
+
+#define DEBUG 0
+#include "debug.h"
+
+// Platform-specific preferences items
+prefs_desc platform_prefs_items[] = {
+    {"seconds", TYPE_INT32, false,      "emulated seconds to run (0 = until Mac OS shuts down)"},
+    {"trace", TYPE_BOOLEAN, false,      "print a CPU/RAM state line every emulated second"},
+    {"screenshot", TYPE_STRING, false,  "write the final screen to this PPM file"},
+    {"benchmark", TYPE_BOOLEAN, false,  "run the CPU benchmark before booting"},
+    {"fpufast", TYPE_BOOLEAN, false,    "round FPU arithmetic to single precision (faster, less accurate)"},
+    {"hibernate", TYPE_BOOLEAN, false,  "write basilisk.state instead of quitting at the end of --seconds"},
+    {"resume", TYPE_BOOLEAN, false,     "resume from basilisk.state instead of booting"},
+    {NULL, TYPE_END, false, NULL}  // End marker
+};
+
+/*
+ *  Load preferences (there is no settings file on the host)
+ */
+void LoadPrefs(const char *vmdir)
+{
+    UNUSED(vmdir);
+
+    // Same machine as the device: Quadra 900, 68040, no separate FPU
+    PrefsReplaceString("rom", "Q650.ROM");
+    PrefsReplaceInt32("modelid", 14);
+    PrefsReplaceInt32("cpu", 4);
+    PrefsReplaceBool("fpu", false);
+    PrefsReplaceString("screen", "win/640/480");
+    PrefsReplaceBool("nosound", true);
+    PrefsReplaceBool("nocdrom", true);
+    PrefsReplaceBool("nogui", true);
+    PrefsReplaceInt32("bootdrive", 0);
+    PrefsReplaceInt32("bootdriver", 0);
+    PrefsReplaceBool("idlewait", true);
+}
+
+/*
+ *  Save preferences (no-op)
+ */
+void SavePrefs(void)
+{
+}
+
+/*
+ *  Add default preferences items
+ */
+void AddPlatformPrefsDefaults(void)
+{
+    PrefsAddInt32("seconds", 30);
+    PrefsAddBool("trace", false);
+    PrefsAddBool("benchmark", false);
+    PrefsAddBool("hibernate", false);
+    PrefsAddBool("resume", false);
+}
@@ -0,0 +1,288 @@
+/*
+ *  sys_host.cpp - System dependent routines for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Disk images are read into memory when opened and writes only go to the
+ *  in-memory copy, so a run never modifies the image on disk and every run
+ *  of the same image starts from the same state.
+ */
+
+#include "sysdeps.h"
+#include "main.h"
+#include "macos_util.h"
+#include "prefs.h"
+#include "sys.h"
+
+#include <stdio.h>
+
+#define DEBUG 0
+#include "debug.h"
+
+// File handle structure
+struct file_handle {
+    uint8 *data;
+    bool read_only;
+    bool is_floppy;
+    bool is_cdrom;
+    loff_t size;
+};
+
+/*
+ *  Periodic flush (nothing to flush, writes stay in memory)
+ */
+void Sys_periodic_flush(void)
+{
+}
+
+void Sys_sync(void)
+{
+}
+
+/*
+ *  Asynchronous transfers (none, the drivers read and write synchronously)
+ */
+bool SysStartIO(void *fh, bool write, void *buffer, loff_t offset, size_t length)
+{
+    UNUSED(fh);
+    UNUSED(write);
+    UNUSED(buffer);
+    UNUSED(offset);
+    UNUSED(length);
+    return false;
+}
+
+bool SysIOResult(size_t *actual)
+{
+    UNUSED(actual);
+    return false;
+}
+
+size_t SysWaitIO(void)
+{
+    return 0;
+}
+
+/*
+ *  No disk telemetry
+ */
+void SysTelemetryDump(void)
+{
+}
+
+void SysTelemetryReset(void)
+{
+}
+
+void SysTelemetryReport(uint32 interval_ms)
+{
+    UNUSED(interval_ms);
+}
+
+/*
+ *  Initialization
+ */
+void SysInit(void)
+{
+    Serial.println("[SYS] In-memory disk images (writes are discarded)");
+}
+
+/*
+ *  Deinitialization
+ */
+void SysExit(void)
+{
+}
+
+/*
+ *  Mount first floppy disk
+ */
+void SysAddFloppyPrefs(void)
+{
+}
+
+/*
+ *  Mount first hard disk
+ */
+void SysAddDiskPrefs(void)
+{
+}
+
+/*
+ *  Mount CD-ROM
+ */
+void SysAddCDROMPrefs(void)
+{
+}
+
+/*
+ *  Add serial prefs
+ */
+void SysAddSerialPrefs(void)
+{
+}
+
+/*
+ *  Open a file/device
+ */
+void *Sys_open(const char *name, bool read_only, bool is_cdrom)
+{
+    if (!name || strlen(name) == 0) {
+        return NULL;
+    }
+
+    FILE *f = fopen(name, "rb");
+    if (!f) {
+        Serial.printf("[SYS] Cannot open %s\n", name);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint8 *data = (size > 0) ? (uint8 *)malloc(size) : NULL;
+    if (!data || fread(data, 1, size, f) != (size_t)size) {
+        Serial.printf("[SYS] Cannot read %s\n", name);
+        free(data);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+
+    file_handle *fh = new file_handle;
+    fh->data = data;
+    fh->size = size;
+    fh->is_cdrom = is_cdrom;
+    fh->is_floppy = (strstr(name, ".img") != NULL || strstr(name, ".IMG") != NULL);
+    fh->read_only = read_only || is_cdrom || strstr(name, ".iso") != NULL || strstr(name, ".ISO") != NULL;
+
+    Serial.printf("[SYS] Opened %s (%lld KB, ro=%d)\n",
+                  name, (long long)(fh->size / 1024), fh->read_only);
+
+    return fh;
+}
+
+/*
+ *  Close a file/device
+ */
+void Sys_close(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh) return;
+
+    free(fh->data);
+    delete fh;
+}
+
+/*
+ *  Read from a file/device
+ */
+size_t Sys_read(void *arg, void *buffer, loff_t offset, size_t length)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh || !buffer || offset < 0 || offset >= fh->size) {
+        return 0;
+    }
+
+    size_t actual = (size_t)MIN((loff_t)length, fh->size - offset);
+    memcpy(buffer, fh->data + offset, actual);
+
+    // Drivers read straight into Mac RAM, which may replace cached code
+    if (actual > 0) {
+        FlushCodeCache(buffer, actual);
+    }
+    return actual;
+}
+
+/*
+ *  Write to a file/device (in-memory copy only)
+ */
+size_t Sys_write(void *arg, void *buffer, loff_t offset, size_t length)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh || !buffer || fh->read_only || offset < 0 || offset >= fh->size) {
+        return 0;
+    }
+
+    size_t written = (size_t)MIN((loff_t)length, fh->size - offset);
+    memcpy(fh->data + offset, buffer, written);
+    return written;
+}
+
+/*
+ *  Return size of file/device
+ */
+loff_t SysGetFileSize(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh) {
+        return 0;
+    }
+    return fh->size;
+}
+
+/*
+ *  Eject disk (no-op)
+ */
+void SysEject(void *arg)
+{
+    UNUSED(arg);
+}
+
+/*
+ *  Format disk (not supported)
+ */
+bool SysFormat(void *arg)
+{
+    UNUSED(arg);
+    return false;
+}
+
+/*
+ *  Check if file/device is read-only
+ */
+bool SysIsReadOnly(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh) return true;
+    return fh->read_only;
+}
+
+/*
+ *  Check if a fixed disk
+ */
+bool SysIsFixedDisk(void *arg)
+{
+    file_handle *fh = (file_handle *)arg;
+    if (!fh) return true;
+    return !fh->is_floppy && !fh->is_cdrom;
+}
+
+/*
+ *  Check if disk is inserted
+ */
+bool SysIsDiskInserted(void *arg)
+{
+    return arg != NULL;
+}
+
+void SysPreventRemoval(void *arg) { UNUSED(arg); }
+void SysAllowRemoval(void *arg) { UNUSED(arg); }
+
+// CD-ROM stubs
+bool SysCDReadTOC(void *arg, uint8 *toc) { UNUSED(arg); UNUSED(toc); return false; }
+bool SysCDGetPosition(void *arg, uint8 *pos) { UNUSED(arg); UNUSED(pos); return false; }
+bool SysCDPlay(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, uint8 end_m, uint8 end_s, uint8 end_f) {
+    UNUSED(arg); UNUSED(start_m); UNUSED(start_s); UNUSED(start_f);
+    UNUSED(end_m); UNUSED(end_s); UNUSED(end_f); return false;
+}
+bool SysCDPause(void *arg) { UNUSED(arg); return false; }
+bool SysCDResume(void *arg) { UNUSED(arg); return false; }
+bool SysCDStop(void *arg, uint8 lead_out_m, uint8 lead_out_s, uint8 lead_out_f) {
+    UNUSED(arg); UNUSED(lead_out_m); UNUSED(lead_out_s); UNUSED(lead_out_f); return false;
+}
+bool SysCDScan(void *arg, uint8 start_m, uint8 start_s, uint8 start_f, bool reverse) {
+    UNUSED(arg); UNUSED(start_m); UNUSED(start_s); UNUSED(start_f); UNUSED(reverse); return false;
+}
+void SysCDSetVolume(void *arg, uint8 left, uint8 right) { UNUSED(arg); UNUSED(left); UNUSED(right); }
+void SysCDGetVolume(void *arg, uint8 &left, uint8 &right) { UNUSED(arg); left = right = 0; }
@@ -0,0 +1,48 @@
+/*
+ *  timer_host.cpp - Time Manager emulation for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Time is emulated time (main_host.cpp): it advances with executed
+ *  instructions, and idle_wait() skips ahead to the next tick instead of
+ *  sleeping.
+ */
+
+#include "sysdeps.h"
+#include "main.h"
+#include "timer.h"
+
+extern uint64 host_virtual_us(void);
+extern uint32 basilisk_idle_timeout_us(void);
+extern void basilisk_idle_done(uint32 slept_us);
+
+/*
+ *  Return emulated microseconds since start
+ */
+uint64 GetTicks_usec(void)
+{
+    return host_virtual_us();
+}
+
+/*
+ *  Delay (nothing to wait for in emulated time)
+ */
+void Delay_usec(uint64 usec)
+{
+    UNUSED(usec);
+}
+
+/*
+ *  Suspend emulator thread until the next tick is due
+ */
+void idle_wait(void)
+{
+    basilisk_idle_done(InterruptFlags ? 0 : basilisk_idle_timeout_us());
+}
+
+/*
+ *  Resume execution of emulator thread (nothing is ever asleep)
+ */
+void idle_resume(void)
+{
+}
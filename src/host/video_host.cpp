@@ -0,0 +1,212 @@
+/*
+ *  video_host.cpp - Headless video emulation for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  Offers the same 640x360 1/2/4/8-bit modes as video_esp32.cpp so the Mac
+ *  sees the same machine, but nothing is displayed: the frame buffer is only
+ *  hashed for the trace and optionally saved as a PPM screenshot at exit.
+ */
+
+#include "sysdeps.h"
+#include "cpu_emulation.h"
+#include "main.h"
+#include "adb.h"
+#include "prefs.h"
+#include "video.h"
+#include "video_defs.h"
+
+#include <stdio.h>
+
+#define DEBUG 0
+#include "debug.h"
+
+// Same screen as the device
+#define MAC_SCREEN_WIDTH  640
+#define MAC_SCREEN_HEIGHT 360
+
+// Frame buffer for Mac emulation
+static uint8 *mac_frame_buffer = NULL;
+static uint32 frame_buffer_size = 0;
+
+// Palette as RGB888, for screenshots
+static uint8 palette_rgb[256 * 3];
+
+// Monitor descriptor for the host
+class Host_monitor_desc : public monitor_desc {
+public:
+    Host_monitor_desc(const vector<video_mode> &available_modes, video_depth default_depth, uint32 default_id)
+        : monitor_desc(available_modes, default_depth, default_id) {}
+
+    virtual void switch_to_current_mode(void);
+    virtual void set_palette(uint8 *pal, int num);
+    virtual void set_gamma(uint8 *gamma, int num);
+};
+
+// Pointer to our monitor
+static Host_monitor_desc *the_monitor = NULL;
+
+/*
+ *  Set palette for indexed color modes
+ */
+void Host_monitor_desc::set_palette(uint8 *pal, int num)
+{
+    memcpy(palette_rgb, pal, MIN(num, 256) * 3);
+}
+
+/*
+ *  Set gamma table (ignored)
+ */
+void Host_monitor_desc::set_gamma(uint8 *gamma, int num)
+{
+    UNUSED(gamma);
+    UNUSED(num);
+}
+
+/*
+ *  Switch to current video mode
+ */
+void Host_monitor_desc::switch_to_current_mode(void)
+{
+    set_mac_frame_base(MacFrameBaseMac);
+}
+
+/*
+ *  Initialization
+ */
+bool VideoInit(bool classic)
+{
+    UNUSED(classic);
+
+    frame_buffer_size = MAC_SCREEN_WIDTH * MAC_SCREEN_HEIGHT;
+    mac_frame_buffer = (uint8 *)malloc(frame_buffer_size);
+    if (!mac_frame_buffer) {
+        Serial.println("[VIDEO] ERROR: Failed to allocate Mac frame buffer!");
+        return false;
+    }
+    memset(mac_frame_buffer, 0x80, frame_buffer_size);
+
+    MacFrameBaseHost = mac_frame_buffer;
+    MacFrameSize = frame_buffer_size;
+    MacFrameMaxSize = frame_buffer_size;
+    MacFrameLayout = FLAYOUT_DIRECT;
+
+    // Grayscale ramp until Mac OS sets its palette
+    for (int i = 0; i < 256; i++)
+        palette_rgb[i * 3 + 0] = palette_rgb[i * 3 + 1] = palette_rgb[i * 3 + 2] = 255 - i;
+
+    vector<video_mode> modes;
+    video_mode mode;
+    mode.x = MAC_SCREEN_WIDTH;
+    mode.y = MAC_SCREEN_HEIGHT;
+    mode.resolution_id = 0x80;
+    mode.user_data = 0;
+    static const video_depth depths[] = { VDEPTH_1BIT, VDEPTH_2BIT, VDEPTH_4BIT, VDEPTH_8BIT };
+    for (int i = 0; i < 4; i++) {
+        mode.depth = depths[i];
+        mode.bytes_per_row = TrivialBytesPerRow(MAC_SCREEN_WIDTH, depths[i]);
+        modes.push_back(mode);
+    }
+
+    the_monitor = new Host_monitor_desc(modes, VDEPTH_8BIT, 0x80);
+    VideoMonitors.push_back(the_monitor);
+    the_monitor->set_mac_frame_base(MacFrameBaseMac);
+
+    Serial.printf("[VIDEO] Headless %dx%d frame buffer at 0x%08X\n",
+                  MAC_SCREEN_WIDTH, MAC_SCREEN_HEIGHT, MacFrameBaseMac);
+    return true;
+}
+
+/*
+ *  Deinitialization
+ */
+void VideoExit(void)
+{
+    VideoMonitors.clear();
+    delete the_monitor;
+    the_monitor = NULL;
+    free(mac_frame_buffer);
+    mac_frame_buffer = NULL;
+}
+
+// Nothing is displayed, so there is nothing to refresh or track
+void VideoSignalFrameReady(void) {}
+void VideoRefresh(void) {}
+void VideoQuitFullScreen(void) {}
+void VideoSetPaused(bool paused) { UNUSED(paused); }
+void VideoMarkDirtyOffset(uint32 offset) { UNUSED(offset); }
+void VideoMarkDirtyRange(uint32 offset, uint32 size) { UNUSED(offset); UNUSED(size); }
+void VideoMarkDirtyRect(uint32 offset, uint32 width, uint32 height, uint32 row_bytes)
+{
+    UNUSED(offset); UNUSED(width); UNUSED(height); UNUSED(row_bytes);
+}
+void VideoMarkDirtyPixels(int x, int y, int w, int h) { UNUSED(x); UNUSED(y); UNUSED(w); UNUSED(h); }
+void VideoScrollRect(uint32 offset, uint32 width, uint32 height, uint32 row_bytes, int dy)
+{
+    UNUSED(offset); UNUSED(width); UNUSED(height); UNUSED(row_bytes); UNUSED(dy);
+}
+void VideoSetCursor(const uint16 *data, const uint16 *mask, int x, int y, bool visible)
+{
+    UNUSED(data); UNUSED(mask); UNUSED(x); UNUSED(y); UNUSED(visible);
+}
+#if INPUT_TELEMETRY
+void VideoPhotonArm(int which, uint32 posted) { UNUSED(which); UNUSED(posted); }
+#endif
+
+/*
+ *  Video interrupt handler (60Hz)
+ */
+void VideoInterrupt(void)
+{
+}
+
+/*
+ *  Get pointer to frame buffer (the buffer that CPU uses)
+ */
+uint8 *VideoGetFrameBuffer(void)
+{
+    return mac_frame_buffer;
+}
+
+/*
+ *  Get frame buffer size
+ */
+uint32 VideoGetFrameBufferSize(void)
+{
+    return frame_buffer_size;
+}
+
+/*
+ *  Write the current screen as a binary PPM
+ */
+bool VideoHostSaveScreenshot(const char *path)
+{
+    if (!mac_frame_buffer || !the_monitor) {
+        return false;
+    }
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        Serial.printf("[VIDEO] Cannot write %s\n", path);
+        return false;
+    }
+
+    const video_mode &mode = the_monitor->get_current_mode();
+    int bits = 1 << mode.depth;     // VDEPTH_1BIT..VDEPTH_8BIT are 0..3
+    if (bits > 8) {
+        bits = 8;
+    }
+    int mask = (1 << bits) - 1;
+
+    fprintf(f, "P6\n%d %d\n255\n", mode.x, mode.y);
+    for (uint32 y = 0; y < mode.y; y++) {
+        const uint8 *row = mac_frame_buffer + y * mode.bytes_per_row;
+        for (uint32 x = 0; x < mode.x; x++) {
+            uint32 bit = x * bits;
+            int index = (row[bit >> 3] >> (8 - bits - (bit & 7))) & mask;
+            fwrite(&palette_rgb[index * 3], 1, 3, f);
+        }
+    }
+    fclose(f);
+    Serial.printf("[VIDEO] Screenshot saved to %s\n", path);
+    return true;
+}
@@ -0,0 +1,28 @@
+/*
+ *  xpram_host.cpp - XPRAM handling for the host build
+ *
+ *  BasiliskII ESP32 Port
+ *
+ *  XPRAM always starts out empty (InitAll() then loads the defaults) and is
+ *  never saved, so every run boots with the same settings.
+ */
+
+#include "sysdeps.h"
+#include "xpram.h"
+
+void LoadXPRAM(const char *vmdir)
+{
+    UNUSED(vmdir);
+    if (XPRAM != NULL)
+        memset(XPRAM, 0, XPRAM_SIZE);
+}
+
+void SaveXPRAM(void)
+{
+}
+
+void ZapPRAM(void)
+{
+    if (XPRAM != NULL)
+        memset(XPRAM, 0, XPRAM_SIZE);
+}
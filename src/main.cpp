@@ -8,16 +8,9 @@
 #include <Arduino.h>
 #include <M5Unified.h>
 #include <M5GFX.h>
-#include <SPI.h>
-#include <SD.h>
 
 #include "boot_gui.h"
-
-// M5Stack Tab5 SD Card SPI pins (ESP32-P4)
-#define SD_SPI_SCK   43
-#define SD_SPI_MOSI  44
-#define SD_SPI_MISO  39
-#define SD_SPI_CS    42
+#include "sdcard.h"
 
 // Forward declarations for BasiliskII functions
 extern void basilisk_setup(void);
@@ -63,26 +56,18 @@ void showErrorScreen(const char* error) {
 
 bool initSDCard() {
     Serial.println("[MAIN] Initializing SD card...");
-    Serial.printf("[MAIN] SD pins: SCK=%d, MOSI=%d, MISO=%d, CS=%d\n", 
-                  SD_SPI_SCK, SD_SPI_MOSI, SD_SPI_MISO, SD_SPI_CS);
-    
-    // Initialize SPI with Tab5 SD card pins
-    SPI.begin(SD_SPI_SCK, SD_SPI_MISO, SD_SPI_MOSI, SD_SPI_CS);
     
-    // Try to initialize SD card with explicit CS pin
-    if (!SD.begin(SD_SPI_CS, SPI, 25000000)) {
+    // SDMMC 4-bit bus, SPI if the card does not answer there
+    if (!SDCardInit()) {
         Serial.println("[MAIN] ERROR: SD card initialization failed!");
         Serial.println("[MAIN] Make sure SD card is inserted and formatted as FAT32");
         return false;
     }
     
-    uint64_t cardSize = SD.cardSize() / (1024 * 1024);
-    Serial.printf("[MAIN] SD card initialized: %lluMB\n", cardSize);
-    
     // Check for required files
-    bool hasROM = SD.exists("/Q650.ROM");
-    bool hasDisk = SD.exists("/Macintosh.dsk");
-    bool hasFloppy = SD.exists("/DiskTools1.img");
+    bool hasROM = SDCard().exists("/Q650.ROM");
+    bool hasDisk = SDCard().exists("/Macintosh.dsk");
+    bool hasFloppy = SDCard().exists("/DiskTools1.img");
     
     Serial.printf("[MAIN] Q650.ROM: %s\n", hasROM ? "found" : "MISSING");
     Serial.printf("[MAIN] Macintosh.dsk: %s\n", hasDisk ? "found" : "MISSING");
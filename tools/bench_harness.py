@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""
+Benchmark harness: time scripted boots and application launches.
+
+Usage:
+    python3 tools/bench_harness.py tools/bench/boot_finder.txt
+    python3 tools/bench_harness.py tools/bench/launch_app.txt --runs 5 --csv bench.csv
+    python3 tools/bench_harness.py tools/bench/boot_finder.txt --flash --build-label jit-off
+
+Drives the board over the serial console (see console_esp32.cpp) through a
+scenario file, one step per line ('#' starts a comment):
+
+    reset                   reset the board through DTR and start the clock
+    wait ready [s]          until the console is up, then switch it to raw mode
+    wait mark <name> [s]    until the firmware prints a milestone: "cpu" when
+                            the 68k starts, "events" at the first
+                            GetNextEvent/WaitNextEvent, "launch" at _Launch,
+                            "replay" at the end of an input replay
+    wait quiet [ms] [s]     until the screen and the disk have been idle for
+                            ms (default 1500): at most --quiet-tiles dirty
+                            tiles per poll and no disk reads or writes
+    sleep <ms>              wait
+    record <milestone>      a CSV row: ms since the clock started, ms since
+                            the previous record
+    move <x> <y>            scripted input, sent to the console as is
+    click <x> <y> [n]       (Mac coordinates, Mac key codes)
+    button down|up [b]
+    key <code> [down|up]
+    send <line>             any other console command
+
+Waits give up after their timeout in seconds (default 120); the run is then
+reported as failed and its remaining rows are left out. Each run appends
+rows of build,scenario,run,milestone,ms,delta_ms to the CSV file, so runs
+of several builds can be compared; a summary per milestone is printed at
+the end.
+
+The serial port and the build and upload steps are those of
+build_upload_monitor.py.
+"""
+
+import argparse
+import csv
+import os
+import re
+import statistics
+import subprocess
+import sys
+import time
+
+import serial
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import build_upload_monitor as bum
+
+POLL_S = 0.25               # Counter polls while waiting for quiet
+DEFAULT_TIMEOUT_S = 120
+DEFAULT_QUIET_MS = 1500
+QUIET_COUNTERS = ('video.tiles', 'disk.read_bytes', 'disk.write_bytes')
+
+MARK_RE = re.compile(r'^(?:@mark|\[MARK\]) (\S+) ms=(\d+)')
+STATS_RE = re.compile(r'^@stats ms=\d+')
+READY_RE = re.compile(r'^\[CONSOLE\] Ready')
+ERROR_RE = re.compile(r'^(?:@err|\[CONSOLE\] ERROR:) (.*)')
+
+
+class StepFailed(Exception):
+    pass
+
+
+class Board:
+    """Serial console of the board: lines, milestones and counter samples."""
+
+    def __init__(self, port, baud, log):
+        self.ser = serial.Serial(port, baud, timeout=0.05)
+        self.log = log
+        self.marks = []         # (name, host time), in arrival order
+        self.mark_next = 0      # First mark not consumed by a wait
+        self.ready = False
+        self.stats = None       # Latest @stats sample, name -> value
+        self.errors = []
+
+    def close(self):
+        self.ser.close()
+
+    def reset(self):
+        self.ser.dtr = False
+        time.sleep(0.3)
+        self.ser.dtr = True
+        self.marks, self.mark_next = [], 0
+        self.ready = False
+        self.stats = None
+
+    def send(self, line):
+        self.ser.write((line + '\n').encode('ascii'))
+
+    def pump(self, seconds):
+        """Read and dispatch lines for up to the given time."""
+        end = time.monotonic() + seconds
+        while True:
+            raw = self.ser.readline()
+            if raw:
+                self.dispatch(raw.decode('utf-8', errors='replace').strip())
+            if time.monotonic() >= end:
+                return
+
+    def dispatch(self, line):
+        if not line:
+            return
+        if self.log:
+            self.log.write(line + '\n')
+        m = MARK_RE.match(line)
+        if m:
+            self.marks.append((m.group(1), time.monotonic()))
+        elif STATS_RE.match(line):
+            sample = {}
+            for field in line.split()[1:]:
+                name, _, value = field.partition('=')
+                if value.isdigit():
+                    sample[name] = int(value)
+            self.stats = sample
+        elif READY_RE.match(line):
+            self.ready = True
+        else:
+            m = ERROR_RE.match(line)
+            if m:
+                self.errors.append(m.group(1))
+
+    def wait_ready(self, timeout):
+        end = time.monotonic() + timeout
+        while not self.ready:
+            if time.monotonic() >= end:
+                raise StepFailed('console not ready')
+            self.pump(POLL_S)
+        self.send('mode raw')
+        self.send('report off')
+        self.pump(POLL_S)
+
+    def wait_mark(self, name, timeout):
+        end = time.monotonic() + timeout
+        while True:
+            for i in range(self.mark_next, len(self.marks)):
+                if self.marks[i][0] == name:
+                    self.mark_next = i + 1
+                    return self.marks[i][1]
+            if time.monotonic() >= end:
+                raise StepFailed(f'no "{name}" mark')
+            self.pump(POLL_S)
+
+    def sample(self):
+        self.stats = None
+        self.send('stats')
+        end = time.monotonic() + 2.0
+        while self.stats is None:
+            if time.monotonic() >= end:
+                raise StepFailed('no reply to stats')
+            self.pump(0.02)
+        return self.stats
+
+    def wait_quiet(self, quiet_ms, timeout, max_tiles):
+        """Until the screen and the disk have been idle for quiet_ms; returns
+        the time the idle stretch started."""
+        end = time.monotonic() + timeout
+        last = self.sample()
+        idle_since = None
+        while True:
+            self.pump(POLL_S)
+            now = time.monotonic()
+            cur = self.sample()
+            delta = {c: cur.get(c, 0) - last.get(c, 0) for c in QUIET_COUNTERS}
+            last = cur
+            busy = (delta['video.tiles'] > max_tiles or delta['disk.read_bytes'] > 0 or
+                    delta['disk.write_bytes'] > 0)
+            if busy:
+                idle_since = None
+            elif idle_since is None:
+                idle_since = now - POLL_S
+            elif (now - idle_since) * 1000 >= quiet_ms:
+                return idle_since
+            if now >= end:
+                raise StepFailed('never quiet')
+
+
+def parse_scenario(path):
+    steps = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if line:
+                steps.append((number, line.split()))
+    return steps
+
+
+def run_scenario(board, steps, args, name, run, writer):
+    """One run of a scenario; returns its milestones as (name, ms)."""
+    start = time.monotonic()
+    last_record = start
+    last_event = start          # End of the last wait: what a record measures
+    rows = []
+    for number, words in steps:
+        command, rest = words[0], words[1:]
+        try:
+            if command == 'reset':
+                board.reset()
+                start = last_record = last_event = time.monotonic()
+            elif command == 'wait' and rest and rest[0] == 'ready':
+                board.wait_ready(float(rest[1]) if len(rest) > 1 else DEFAULT_TIMEOUT_S)
+                last_event = time.monotonic()
+            elif command == 'wait' and len(rest) >= 2 and rest[0] == 'mark':
+                last_event = board.wait_mark(rest[1], float(rest[2]) if len(rest) > 2 else DEFAULT_TIMEOUT_S)
+            elif command == 'wait' and rest and rest[0] == 'quiet':
+                quiet_ms = int(rest[1]) if len(rest) > 1 else DEFAULT_QUIET_MS
+                timeout = float(rest[2]) if len(rest) > 2 else DEFAULT_TIMEOUT_S
+                last_event = board.wait_quiet(quiet_ms, timeout, args.quiet_tiles)
+            elif command == 'sleep' and len(rest) == 1:
+                board.pump(int(rest[0]) / 1000.0)
+                last_event = time.monotonic()
+            elif command == 'record' and len(rest) == 1:
+                ms = round((last_event - start) * 1000)
+                delta = round((last_event - last_record) * 1000)
+                last_record = last_event
+                rows.append((rest[0], ms))
+                writer.writerow([args.build_label, name, run, rest[0], ms, delta])
+                print(f'  {rest[0]:<20} {ms:>8} ms  (+{delta} ms)')
+            elif command in ('move', 'click', 'button', 'key'):
+                board.send(' '.join(words))
+                board.pump(0.05)
+                last_event = time.monotonic()
+            elif command == 'send' and rest:
+                board.send(' '.join(rest))
+                board.pump(0.05)
+                last_event = time.monotonic()
+            else:
+                raise StepFailed('unknown step')
+            if board.errors:
+                raise StepFailed(f'console error: {board.errors.pop(0)}')
+        except StepFailed as e:
+            print(f'  line {number} "{" ".join(words)}": {e}, run {run} failed')
+            return None
+    return rows
+
+
+def git_label():
+    try:
+        out = subprocess.run(['git', 'describe', '--always', '--dirty'], cwd=bum.get_project_root(),
+                             capture_output=True, text=True)
+        return out.stdout.strip() or 'unknown'
+    except OSError:
+        return 'unknown'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Time scripted scenarios on the board.')
+    parser.add_argument('scenario', help='scenario file (see tools/bench/)')
+    parser.add_argument('--runs', type=int, default=1, help='runs of the scenario (default 1)')
+    parser.add_argument('--csv', default='bench.csv', help='CSV file the rows are appended to')
+    parser.add_argument('--build-label', default=None, help='build column of the CSV (default: git describe)')
+    parser.add_argument('--port', default=bum.SERIAL_PORT, help='serial port')
+    parser.add_argument('--flash', action='store_true', help='build and upload first')
+    parser.add_argument('--quiet-tiles', type=int, default=4,
+                        help='dirty tiles per poll still counted as quiet (a blinking caret)')
+    parser.add_argument('--log', default=None, help='file the serial output is copied to')
+    args = parser.parse_args()
+    if args.build_label is None:
+        args.build_label = git_label()
+
+    os.chdir(bum.get_project_root())
+    if args.flash and not (bum.build() and bum.upload()):
+        print('\nBuild or upload failed!')
+        sys.exit(1)
+
+    steps = parse_scenario(args.scenario)
+    name = os.path.splitext(os.path.basename(args.scenario))[0]
+    log = open(args.log, 'a') if args.log else None
+    new_csv = not os.path.exists(args.csv)
+    results = {}
+    failed = 0
+
+    board = Board(args.port, bum.BAUD_RATE, log)
+    try:
+        with open(args.csv, 'a', newline='') as f:
+            writer = csv.writer(f)
+            if new_csv:
+                writer.writerow(['build', 'scenario', 'run', 'milestone', 'ms', 'delta_ms'])
+            for run in range(1, args.runs + 1):
+                print(f'{name} run {run}/{args.runs} ({args.build_label})')
+                rows = run_scenario(board, steps, args, name, run, writer)
+                f.flush()
+                if rows is None:
+                    failed += 1
+                    continue
+                for milestone, ms in rows:
+                    results.setdefault(milestone, []).append(ms)
+    except KeyboardInterrupt:
+        print('\n[Stopped by user]')
+    finally:
+        board.close()
+        if log:
+            log.close()
+
+    print(f'\n{name}: {args.runs - failed} of {args.runs} runs, rows appended to {args.csv}')
+    for milestone, values in results.items():
+        print(f'  {milestone:<20} median {statistics.median(values):>8.0f} ms  '
+              f'min {min(values)}  max {max(values)}')
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -50,6 +50,7 @@
 
 static FILE *headerfile;
 static FILE *stblfile;
+static FILE *dispfile;
 
 static int using_prefetch;
 static int using_exception_3;
@@ -64,6 +65,17 @@ static int *opcode_map;
 static int *opcode_next_clev;
 static int *opcode_last_postfix;
 static unsigned long *counts;
+static unsigned long counts_total;
+static int have_counts;
+
+/* Most frequently executed handlers first */
+static int compare_counts (const void *a, const void *b)
+{
+    unsigned long ca = counts[*(const int *)a], cb = counts[*(const int *)b];
+    if (ca != cb)
+	return ca < cb ? 1 : -1;
+    return *(const int *)a - *(const int *)b;
+}
 
 static void read_counts (void)
 {
@@ -76,28 +88,49 @@ static void read_counts (void)
     file = fopen ("frequent.68k", "r");
     if (file) {
 	fscanf (file, "Total: %lu\n", &total);
+	counts_total = total;
+	have_counts = 1;
+	/* The profile counts every opcode; fold them onto the handler that runs them */
 	while (fscanf (file, "%lx: %lu %s\n", &opcode, &count, name) == 3) {
-	    opcode_next_clev[nr] = 4;
-	    opcode_last_postfix[nr] = -1;
-	    opcode_map[nr++] = opcode;
-	    counts[opcode] = count;
+	    if (opcode < 0x10000 && table68k[opcode].mnemo != i_ILLG)
+		counts[table68k[opcode].handler == -1 ? opcode : table68k[opcode].handler] += count;
 	}
 	fclose (file);
     }
-    if (nr == nr_cpuop_funcs)
-	return;
     for (opcode = 0; opcode < 0x10000; opcode++) {
-	if (table68k[opcode].handler == -1 && table68k[opcode].mnemo != i_ILLG
-	    && counts[opcode] == 0)
+	if (table68k[opcode].handler == -1 && table68k[opcode].mnemo != i_ILLG)
 	{
 	    opcode_next_clev[nr] = 4;
 	    opcode_last_postfix[nr] = -1;
 	    opcode_map[nr++] = opcode;
-	    counts[opcode] = count;
 	}
     }
     if (nr != nr_cpuop_funcs)
 	abort ();
+    if (have_counts)
+	qsort (opcode_map, nr, sizeof (int), compare_counts);
+}
+
+/*
+ * Handlers to place in IRAM: the CPU_IRAM_HANDLERS (default 48) most
+ * frequent ones of the profile. Without a profile nothing is pinned.
+ */
+#define DEFAULT_IRAM_HANDLERS 48
+
+static char *hot_op;
+
+static void select_hot_handlers (void)
+{
+    const char *env = getenv ("CPU_IRAM_HANDLERS");
+    int n = env ? atoi (env) : DEFAULT_IRAM_HANDLERS;
+    int i;
+
+    hot_op = (char *) calloc (65536, 1);
+    if (!have_counts)
+	return;
+    for (i = 0; i < n && i < nr_cpuop_funcs && counts[opcode_map[i]] != 0; i++)
+	hot_op[opcode_map[i]] = 1;
+    fprintf (stderr, "gencpu: %d handlers marked for IRAM\n", i);
 }
 
 static char endlabelstr[80];
@@ -396,10 +429,7 @@ static void genamode (amodes mode, char *reg, wordsizes size, char *name, int ge
 
     if (using_exception_3 && getv != 0 && size != sz_byte) {	    
 	printf ("\tif ((%sa & 1) != 0) {\n", name);
-	printf ("\t\tlast_fault_for_exception_3 = %sa;\n", name);
-	printf ("\t\tlast_op_for_exception_3 = opcode;\n");
-	printf ("\t\tlast_addr_for_exception_3 = m68k_getpc() + %d;\n", m68k_pc_offset);
-	printf ("\t\tException(3, 0);\n");
+	printf ("\t\top_address_error(opcode, %sa, m68k_getpc() + %d);\n", name, m68k_pc_offset);
 	printf ("\t\tgoto %s;\n", endlabelstr);
 	printf ("\t}\n");
 	need_endlabel = 1;
@@ -524,25 +554,42 @@ static void genastore (char *from, amodes mode, char *reg, wordsizes size, char
     }
 }
 
+/* MOVEM: a register list moves at most MOVEM_MAX_BYTES. When
+ * movem_get_host() or movem_put_host() (memory.h) finds those bytes on its
+ * side of the start address in RAM, the registers are moved through the
+ * host pointer with one range check; otherwise they go through get_/put_
+ * one at a time. */
 static void genmovemel (uae_u16 opcode)
 {
-    char getcode[100];
+    char getcode[100], hostcode[100];
     int size = table68k[opcode].size == sz_long ? 4 : 2;
 
     if (table68k[opcode].size == sz_long) {
 	strcpy (getcode, "get_long(srca)");
+	strcpy (hostcode, "do_get_mem_long((uae_u32 *)m)");
     } else {
 	strcpy (getcode, "(uae_s32)(uae_s16)get_word(srca)");
+	strcpy (hostcode, "(uae_s32)(uae_s16)do_get_mem_word((uae_u16 *)m)");
     }
 
     printf ("\tuae_u16 mask = %s;\n", gen_nextiword ());
     printf ("\tunsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;\n");
     genamode (table68k[opcode].dmode, "dstreg", table68k[opcode].size, "src", 2, 1);
     start_brace ();
+    printf ("\tuae_u8 *movem_host = movem_get_host(srca);\n");
+    printf ("\tif (likely(movem_host != NULL)) {\n");
+    printf ("\tuae_u8 *m = movem_host;\n");
+    printf ("\twhile (dmask) { m68k_dreg(regs, movem_index1[dmask]) = %s; m += %d; dmask = movem_next[dmask]; }\n",
+	    hostcode, size);
+    printf ("\twhile (amask) { m68k_areg(regs, movem_index1[amask]) = %s; m += %d; amask = movem_next[amask]; }\n",
+	    hostcode, size);
+    printf ("\tsrca += m - movem_host;\n");
+    printf ("\t} else {\n");
     printf ("\twhile (dmask) { m68k_dreg(regs, movem_index1[dmask]) = %s; srca += %d; dmask = movem_next[dmask]; }\n",
 	    getcode, size);
     printf ("\twhile (amask) { m68k_areg(regs, movem_index1[amask]) = %s; srca += %d; amask = movem_next[amask]; }\n",
 	    getcode, size);
+    printf ("\t}\n");
 
     if (table68k[opcode].dmode == Aipi)
 	printf ("\tm68k_areg(regs, dstreg) = srca;\n");
@@ -550,12 +597,14 @@ static void genmovemel (uae_u16 opcode)
 
 static void genmovemle (uae_u16 opcode)
 {
-    char putcode[100];
+    char putcode[100], hostcode[100];
     int size = table68k[opcode].size == sz_long ? 4 : 2;
     if (table68k[opcode].size == sz_long) {
 	strcpy (putcode, "put_long(srca,");
+	strcpy (hostcode, "do_put_mem_long((uae_u32 *)m,");
     } else {
 	strcpy (putcode, "put_word(srca,");
+	strcpy (hostcode, "do_put_mem_word((uae_u16 *)m,");
     }
 
     printf ("\tuae_u16 mask = %s;\n", gen_nextiword ());
@@ -566,17 +615,38 @@ static void genmovemle (uae_u16 opcode)
     start_brace ();
     if (table68k[opcode].dmode == Apdi) {
 	printf ("\tuae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;\n");
+	printf ("\tuae_u8 *movem_host = movem_put_host(srca - MOVEM_MAX_BYTES);\n");
+	printf ("\tif (likely(movem_host != NULL)) {\n");
+	printf ("\tuae_u8 *m = movem_host + MOVEM_MAX_BYTES;\n");
+	printf ("\twhile (amask) { m -= %d; %s m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }\n",
+		size, hostcode);
+	printf ("\twhile (dmask) { m -= %d; %s m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }\n",
+		size, hostcode);
+	printf ("\tmovem_put_done(m, movem_host + MOVEM_MAX_BYTES - m);\n");
+	printf ("\tsrca -= movem_host + MOVEM_MAX_BYTES - m;\n");
+	printf ("\t} else {\n");
 	printf ("\twhile (amask) { srca -= %d; %s m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }\n",
 		size, putcode);
 	printf ("\twhile (dmask) { srca -= %d; %s m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }\n",
 		size, putcode);
+	printf ("\t}\n");
 	printf ("\tm68k_areg(regs, dstreg) = srca;\n");
     } else {
 	printf ("\tuae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;\n");
+	printf ("\tuae_u8 *movem_host = movem_put_host(srca);\n");
+	printf ("\tif (likely(movem_host != NULL)) {\n");
+	printf ("\tuae_u8 *m = movem_host;\n");
+	printf ("\twhile (dmask) { %s m68k_dreg(regs, movem_index1[dmask])); m += %d; dmask = movem_next[dmask]; }\n",
+		hostcode, size);
+	printf ("\twhile (amask) { %s m68k_areg(regs, movem_index1[amask])); m += %d; amask = movem_next[amask]; }\n",
+		hostcode, size);
+	printf ("\tmovem_put_done(movem_host, m - movem_host);\n");
+	printf ("\t} else {\n");
 	printf ("\twhile (dmask) { %s m68k_dreg(regs, movem_index1[dmask])); srca += %d; dmask = movem_next[dmask]; }\n",
 		putcode, size);
 	printf ("\twhile (amask) { %s m68k_areg(regs, movem_index1[amask])); srca += %d; amask = movem_next[amask]; }\n",
 		putcode, size);
+	printf ("\t}\n");
     }
 }
 
@@ -595,6 +665,7 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
     char vstr[100], sstr[100], dstr[100];
     char usstr[100], udstr[100];
     char unsstr[100], undstr[100];
+    int lazy;
 
     switch (size) {
      case sz_byte:
@@ -659,6 +730,37 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
 	break;
     }
 
+    /* Flag types that set all of N, Z, V and C can defer the work: the
+       handler records the operands and the kind of operation, and
+       m68k_flags_sync() works the flags out when something reads them.
+       X is not deferred (it outlives the other flags), so add and sub
+       still compute it here.  */
+    lazy = (type == flag_logical || type == flag_add || type == flag_sub || type == flag_cmp);
+    if (lazy) {
+	const char *kind = (type == flag_logical ? "LOGICAL" : type == flag_add ? "ADD" : "SUB");
+	char ksize = (size == sz_byte ? 'B' : size == sz_word ? 'W' : 'L');
+	printf ("\n#if LAZY_FLAGS\n");
+	switch (type) {
+	 case flag_logical:
+	    printf ("\tSET_LAZY_LOGICAL (LAZY_%s_%c, %s);\n", kind, ksize, value);
+	    break;
+	 case flag_add:
+	    printf ("{\tSET_XFLG (%s < %s);\n", undstr, usstr);
+	    printf ("\tSET_LAZY_FLAGS (LAZY_%s_%c, %s, %s, %s);\n", kind, ksize, src, dst, value);
+	    break;
+	 case flag_sub:
+	    printf ("{\tSET_XFLG (%s > %s);\n", usstr, udstr);
+	    printf ("\tSET_LAZY_FLAGS (LAZY_%s_%c, %s, %s, %s);\n", kind, ksize, src, dst, value);
+	    break;
+	 case flag_cmp:
+	    printf ("{\tSET_LAZY_FLAGS (LAZY_%s_%c, %s, %s, %s);\n", kind, ksize, src, dst, value);
+	    break;
+	 default:
+	    break;
+	}
+	printf ("#else\n");
+    }
+
     switch (type) {
      case flag_logical_noclobber:
      case flag_logical:
@@ -734,6 +836,9 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
 	printf ("\tSET_NFLG (flgn != 0);\n");
 	break;
     }
+
+    if (lazy)
+	printf ("#endif\n");
 }
 
 static void genflags (flagtypes type, wordsizes size, char *value, char *src, char *dst)
@@ -867,14 +972,14 @@ static void gen_opcode (unsigned long int opcode)
 
 	/* fall through */
      case 2: /* priviledged */
-	printf ("if (!regs.s) { Exception(8,0); goto %s; }\n", endlabelstr);
+	printf ("if (!regs.s) { op_exception(8,0); goto %s; }\n", endlabelstr);
 	need_endlabel = 1;
 	start_brace ();
 	break;
      case 3: /* privileged if size == word */
 	if (curi->size == sz_byte)
 	    break;
-	printf ("if (!regs.s) { Exception(8,0); goto %s; }\n", endlabelstr);
+	printf ("if (!regs.s) { op_exception(8,0); goto %s; }\n", endlabelstr);
 	need_endlabel = 1;
 	start_brace ();
 	break;
@@ -1254,7 +1359,7 @@ static void gen_opcode (unsigned long int opcode)
 	    printf ("\telse if ((format & 0xF000) == 0x9000) { m68k_areg(regs, 7) += 12; break; }\n");
 	    printf ("\telse if ((format & 0xF000) == 0xa000) { m68k_areg(regs, 7) += 24; break; }\n");
 	    printf ("\telse if ((format & 0xF000) == 0xb000) { m68k_areg(regs, 7) += 84; break; }\n");
-	    printf ("\telse { Exception(14,0); goto %s; }\n", endlabelstr);
+	    printf ("\telse { op_exception(14,0); goto %s; }\n", endlabelstr);
 	    printf ("\tregs.sr = newsr; MakeFromSR();\n}\n");
 	    pop_braces (old_brace_level);
 	    printf ("\tregs.sr = newsr; MakeFromSR();\n");
@@ -1295,7 +1400,7 @@ static void gen_opcode (unsigned long int opcode)
 	break;
      case i_TRAPV:
 	sync_m68k_pc ();
-	printf ("\tif (GET_VFLG) { Exception(7,m68k_getpc()); goto %s; }\n", endlabelstr);
+	printf ("\tif (GET_VFLG) { op_exception(7,m68k_getpc()); goto %s; }\n", endlabelstr);
 	need_endlabel = 1;
 	break;
      case i_RTR:
@@ -1325,9 +1430,7 @@ static void gen_opcode (unsigned long int opcode)
 	printf ("\tuae_s32 s = (uae_s32)src + 2;\n");
 	if (using_exception_3) {
 	    printf ("\tif (src & 1) {\n");
-	    printf ("\tlast_addr_for_exception_3 = m68k_getpc() + 2;\n");
-	    printf ("\t\tlast_fault_for_exception_3 = m68k_getpc() + s;\n");
-	    printf ("\t\tlast_op_for_exception_3 = opcode; Exception(3,0); goto %s;\n", endlabelstr);
+	    printf ("\t\top_address_error(opcode, m68k_getpc() + s, m68k_getpc() + 2); goto %s;\n", endlabelstr);
 	    printf ("\t}\n");
 	    need_endlabel = 1;
 	}
@@ -1352,9 +1455,7 @@ static void gen_opcode (unsigned long int opcode)
 	    if (cpu_level < 2) {
 		printf ("\tm68k_incpc(2);\n");
 		printf ("\tif (!cctrue(%d)) goto %s;\n", curi->cc, endlabelstr);
-		printf ("\t\tlast_addr_for_exception_3 = m68k_getpc() + 2;\n");
-		printf ("\t\tlast_fault_for_exception_3 = m68k_getpc() + 1;\n");
-		printf ("\t\tlast_op_for_exception_3 = opcode; Exception(3,0); goto %s;\n", endlabelstr);
+		printf ("\t\top_address_error(opcode, m68k_getpc() + 1, m68k_getpc() + 2); goto %s;\n", endlabelstr);
 		need_endlabel = 1;
 	    } else {
 		if (next_cpu_level < 1)
@@ -1365,15 +1466,13 @@ static void gen_opcode (unsigned long int opcode)
 	printf ("\tif (!cctrue(%d)) goto didnt_jump;\n", curi->cc);
 	if (using_exception_3) {
 	    printf ("\tif (src & 1) {\n");
-	    printf ("\t\tlast_addr_for_exception_3 = m68k_getpc() + 2;\n");
-	    printf ("\t\tlast_fault_for_exception_3 = m68k_getpc() + 2 + (uae_s32)src;\n");
-	    printf ("\t\tlast_op_for_exception_3 = opcode; Exception(3,0); goto %s;\n", endlabelstr);
+	    printf ("\t\top_address_error(opcode, m68k_getpc() + 2 + (uae_s32)src, m68k_getpc() + 2); goto %s;\n", endlabelstr);
 	    printf ("\t}\n");
 	    need_endlabel = 1;
 	}
 	printf ("\tm68k_incpc ((uae_s32)src + 2);\n");
 	fill_prefetch_0 ();
-	printf ("return;\n");
+	printf ("\tcpuop_return();\n");
 	printf ("didnt_jump:;\n");
 	need_endlabel = 1;
 	}
@@ -1398,15 +1497,13 @@ static void gen_opcode (unsigned long int opcode)
 	printf ("\t\tif (src) {\n");
 	if (using_exception_3) {
 	    printf ("\t\t\tif (offs & 1) {\n");
-	    printf ("\t\t\tlast_addr_for_exception_3 = m68k_getpc() + 2;\n");
-	    printf ("\t\t\tlast_fault_for_exception_3 = m68k_getpc() + 2 + (uae_s32)offs + 2;\n");
-	    printf ("\t\t\tlast_op_for_exception_3 = opcode; Exception(3,0); goto %s;\n", endlabelstr);
+	    printf ("\t\t\top_address_error(opcode, m68k_getpc() + 2 + (uae_s32)offs + 2, m68k_getpc() + 2); goto %s;\n", endlabelstr);
 	    printf ("\t\t}\n");
 	    need_endlabel = 1;
 	}
 	printf ("\t\t\tm68k_incpc((uae_s32)offs + 2);\n");
 	fill_prefetch_0 ();
-	printf ("return;\n");
+	printf ("\tcpuop_return();\n");
 	printf ("\t\t}\n");
 	printf ("\t}\n");
 	need_endlabel = 1;
@@ -1424,7 +1521,7 @@ static void gen_opcode (unsigned long int opcode)
 	sync_m68k_pc ();
 	/* Clear V flag when dividing by zero - Alcatraz Odyssey demo depends
 	 * on this (actually, it's doing a DIVS).  */
-	printf ("\tif (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto %s; } else {\n", endlabelstr);
+	printf ("\tif (src == 0) { SET_VFLG (0); op_exception (5, oldpc); goto %s; } else {\n", endlabelstr);
 	printf ("\tuae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;\n");
 	printf ("\tuae_u32 rem = (uae_u32)dst %% (uae_u32)(uae_u16)src;\n");
 	/* The N flag appears to be set each time there is an overflow.
@@ -1443,7 +1540,7 @@ static void gen_opcode (unsigned long int opcode)
 	genamode (curi->smode, "srcreg", sz_word, "src", 1, 0);
 	genamode (curi->dmode, "dstreg", sz_long, "dst", 1, 0);
 	sync_m68k_pc ();
-	printf ("\tif (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto %s; } else {\n", endlabelstr);
+	printf ("\tif (src == 0) { SET_VFLG (0); op_exception(5,oldpc); goto %s; } else {\n", endlabelstr);
 	printf ("\tuae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;\n");
 	printf ("\tuae_u16 rem = (uae_s32)dst %% (uae_s32)(uae_s16)src;\n");
 	printf ("\tif ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else\n\t{\n");
@@ -1478,8 +1575,8 @@ static void gen_opcode (unsigned long int opcode)
 	printf ("\tuaecptr oldpc = m68k_getpc();\n");
 	genamode (curi->smode, "srcreg", curi->size, "src", 1, 0);
 	genamode (curi->dmode, "dstreg", curi->size, "dst", 1, 0);
-	printf ("\tif ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto %s; }\n", endlabelstr);
-	printf ("\telse if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto %s; }\n", endlabelstr);
+	printf ("\tif ((uae_s32)dst < 0) { SET_NFLG (1); op_exception(6,oldpc); goto %s; }\n", endlabelstr);
+	printf ("\telse if (dst > src) { SET_NFLG (0); op_exception(6,oldpc); goto %s; }\n", endlabelstr);
 	need_endlabel = 1;
 	break;
 
@@ -1505,7 +1602,7 @@ static void gen_opcode (unsigned long int opcode)
 	}
 	printf ("\tSET_ZFLG (upper == reg || lower == reg);\n");
 	printf ("\tSET_CFLG_ALWAYS (lower <= upper ? reg < lower || reg > upper : reg > upper || reg < lower);\n");
-	printf ("\tif ((extra & 0x800) && GET_CFLG) { Exception(6,oldpc); goto %s; }\n}\n", endlabelstr);
+	printf ("\tif ((extra & 0x800) && GET_CFLG) { op_exception(6,oldpc); goto %s; }\n}\n", endlabelstr);
 	need_endlabel = 1;
 	break;
 
@@ -2001,7 +2098,7 @@ static void gen_opcode (unsigned long int opcode)
      case i_TRAPcc:
 	if (curi->smode != am_unknown && curi->smode != am_illg)
 	    genamode (curi->smode, "srcreg", curi->size, "dummy", 1, 0);
-	printf ("\tif (cctrue(%d)) { Exception(7,m68k_getpc()); goto %s; }\n", curi->cc, endlabelstr);
+	printf ("\tif (cctrue(%d)) { op_exception(7,m68k_getpc()); goto %s; }\n", curi->cc, endlabelstr);
 	need_endlabel = 1;
 	break;
      case i_DIVL:
@@ -2279,9 +2376,80 @@ static void generate_includes (FILE * f)
 
 static int postfix;
 
+/*
+ * Superinstructions: handlers that also run the instruction after them
+ * without another dispatch. Compares and tests absorb a following Bcc,
+ * and the usual one-instruction copy/clear/search loop bodies absorb the
+ * DBcc that closes the loop (see m68k_fuse_bcc/m68k_fuse_dbcc in newcpu.h).
+ */
+#define FUSE_BCC	1
+#define FUSE_DBCC	2
+
+static int fused_ops[1024];
+static int nr_fused_ops;
+
+/* Handler of each opcode with an entry in the current smalltbl, for the
+   precomputed dispatch tables: the postfix of its function (-1: no entry),
+   whether it is the "ff" variant and whether it has a fused variant */
+static int *disp_postfix;
+static char *disp_ff;
+static char *disp_fused;
+static int disp_count[6];
+
+static int fuse_kind (long int opcode)
+{
+    struct instr *curi = table68k + opcode;
+
+    switch (curi->mnemo) {
+     case i_TST:
+     case i_CMPA:
+     case i_CMPM:
+     case i_BTST:
+	return FUSE_BCC;
+     case i_CMP:
+	return FUSE_BCC | (curi->smode == Aipi ? FUSE_DBCC : 0);
+     case i_ADD:
+     case i_SUB:
+	/* ADDQ/SUBQ #n,Dn; Bcc */
+	return curi->smode == immi && curi->dmode == Dreg ? FUSE_BCC : 0;
+     case i_MOVE:
+	if (curi->dmode == Aipi
+	    && (curi->smode == Dreg || curi->smode == Aind || curi->smode == Aipi))
+	    return FUSE_DBCC;
+	return 0;
+     case i_CLR:
+	return curi->smode == Aipi ? FUSE_DBCC : 0;
+     default:
+	return 0;
+    }
+}
+
+/* With a frequent.68k profile, only fuse handlers that showed up in it
+   (read_counts has already folded the counts onto handler opcodes) */
+static int fuse_profiled (long int opcode)
+{
+    if (!have_counts)
+	return 1;
+    return counts[opcode] * 100000 >= counts_total;
+}
+
+/*
+ * Cold handlers: those of the 68040 table the profile never saw. They come
+ * last in profile order and are emitted between two inclusions of
+ * cpuop_cold.h, which makes their memory accesses calls to out of line
+ * accessors, and are marked CPUOP_COLD. Without a profile none is cold.
+ */
+static int cold_started;
+
+static int cold_op (long int opcode)
+{
+    return have_counts && postfix == 0 && counts[opcode] == 0;
+}
+
+static void generate_opcode_body (long int opcode, const char *opcode_str, int fuse);
+
 static void generate_one_opcode (int rp)
 {
-    uae_u16 smsk, dmsk;
     long int opcode = opcode_map[rp];
     const char *opcode_str;
 
@@ -2294,6 +2462,9 @@ static void generate_one_opcode (int rp)
 
     opcode_str = get_instruction_string (opcode);
 
+    disp_postfix[opcode] = opcode_next_clev[rp] != cpu_level ? opcode_last_postfix[rp] : postfix;
+    disp_ff[opcode] = table68k[opcode].flagdead == 0;
+
     if (opcode_next_clev[rp] != cpu_level) {
 	if (table68k[opcode].flagdead == 0)
 	/* force to the "ff" variant since the instruction doesn't set at all the condition codes */
@@ -2313,6 +2484,11 @@ static void generate_one_opcode (int rp)
 
     fprintf (headerfile, "extern cpuop_func op_%lx_%d_nf;\n", opcode, postfix);
     fprintf (headerfile, "extern cpuop_func op_%lx_%d_ff;\n", opcode, postfix);
+
+	if (cold_op (opcode) && !cold_started) {
+	printf ("#define CPUOP_COLD_REGION\n#include \"cpuop_cold.h\"\n\n");
+	cold_started = 1;
+	}
 	
 	/* gb-- The "nf" variant for an instruction that doesn't set the condition
 	   codes at all is the same as the "ff" variant, so we don't need the "nf"
@@ -2321,8 +2497,48 @@ static void generate_one_opcode (int rp)
 	if (table68k[opcode].flagdead == 0)
 	printf ("#ifndef NOFLAGS\n");
 
+	generate_opcode_body (opcode, opcode_str, 0);
+
+	if (table68k[opcode].flagdead == 0)
+	printf ("\n#endif\n");
+    opcode_next_clev[rp] = next_cpu_level;
+    opcode_last_postfix[rp] = postfix;
+
+	/* Superinstructions are only generated for the 68040 table, which is
+	   the one Basilisk II uses on ESP32 */
+	if (postfix == 0 && fuse_kind (opcode) != 0 && fuse_profiled (opcode)) {
+	fprintf (headerfile, "#if USE_SUPERINSNS\n");
+	fprintf (headerfile, "extern cpuop_func op_%lx_%d_fuse_nf;\n", opcode, postfix);
+	fprintf (headerfile, "extern cpuop_func op_%lx_%d_fuse_ff;\n", opcode, postfix);
+	fprintf (headerfile, "#endif\n");
+	printf ("#if USE_SUPERINSNS\n");
+	generate_opcode_body (opcode, opcode_str, fuse_kind (opcode));
+	printf ("#endif\n");
+	fused_ops[nr_fused_ops++] = opcode;
+	disp_fused[opcode] = 1;
+	}
+}
+
+static void generate_opcode_body (long int opcode, const char *opcode_str, int fuse)
+{
+    uae_u16 smsk, dmsk;
+
+	/* Profiled hot handlers go to IRAM; a fused variant replaces the plain
+	   handler when USE_SUPERINSNS is set, so only one of them is pinned */
+	if (postfix == 0 && hot_op[opcode])
+	printf (fuse ? "CPUOP_HOT\n" : fuse_kind (opcode) && fuse_profiled (opcode) ? "CPUOP_HOT_UNFUSED\n" : "CPUOP_HOT\n");
+	else if (cold_op (opcode))
+	printf ("CPUOP_COLD\n");
+	if (fuse) {
+	printf ("void REGPARAM2 CPUFUNC(op_%lx_%d_fuse)(uae_u32 opcode) /* %s + %s */\n{\n", opcode, postfix, opcode_str,
+		fuse == FUSE_BCC ? "Bcc" : fuse == FUSE_DBCC ? "DBcc" : "DBcc/Bcc");
+	printf ("\tcpuop_begin();\n");
+	if (fuse & FUSE_DBCC)
+	    printf ("\tuae_u8 *fuse_start = regs.pc_p;\n\tint fuse_budget = FUSE_LOOP_BUDGET;\n");
+	} else {
 	printf ("void REGPARAM2 CPUFUNC(op_%lx_%d)(uae_u32 opcode) /* %s */\n{\n", opcode, postfix, opcode_str);
 	printf ("\tcpuop_begin();\n");
+	}
 
     switch (table68k[opcode].stype) {
      case 0: smsk = 7; break;
@@ -2440,15 +2656,67 @@ static void generate_one_opcode (int rp)
     need_endlabel = 0;
     endlabelno++;
     sprintf (endlabelstr, "endlabel%d", endlabelno);
+	if (fuse & FUSE_DBCC)
+	printf ("fuse_again:;\n");
     gen_opcode (opcode);
+	if (fuse & FUSE_DBCC)
+	printf ("\tif (m68k_fuse_dbcc (opcode, fuse_start, &fuse_budget)) goto fuse_again;\n");
+	if (fuse & FUSE_BCC)
+	printf ("\tm68k_fuse_bcc ();\n");
     if (need_endlabel)
 	printf ("%s: ;\n", endlabelstr);
 	printf ("\tcpuop_end();\n");
     printf ("}\n");
-	if (table68k[opcode].flagdead == 0)
-	printf ("\n#endif\n");
-    opcode_next_clev[rp] = next_cpu_level;
-    opcode_last_postfix[rp] = postfix;
+}
+
+/*
+ * Precomputed dispatch (USE_CONST_DISPATCH): the compact handler index
+ * that build_cpufunctbl() would otherwise compute at every boot from
+ * table68k. Opcodes are numbered as read from memory, which is only
+ * right without HAVE_GET_WORD_UNSWAPPED. Index 0 is op_illg_1, the
+ * others are the handlers in order of their first opcode.
+ */
+static void generate_dispatch (void)
+{
+    static int slot[65536];
+    static uae_u16 idx[65536];
+    long int opcode;
+    int count = 1;
+
+    fprintf (dispfile, "cpuop_func *const CPUFUNC(op_dispatchptr_%d)[] = {\n", postfix);
+    fprintf (dispfile, "op_illg_1,\n");
+    memset (slot, 0, sizeof slot);
+    for (opcode = 0; opcode < 65536; opcode++) {
+	long int rep;
+
+	if (table68k[opcode].mnemo == i_ILLG
+	    || table68k[opcode].clev > (unsigned)cpu_level) {
+	    idx[opcode] = 0;
+	    continue;
+	}
+	rep = table68k[opcode].handler != -1 ? table68k[opcode].handler : opcode;
+	if (disp_postfix[rep] < 0) {
+	    fprintf (stderr, "gencpu: no handler for opcode %04lx in table %d\n", opcode, postfix);
+	    abort ();
+	}
+	if (slot[rep] == 0) {
+	    slot[rep] = count++;
+	    if (postfix == 0 && disp_fused[rep])
+		fprintf (dispfile, "#if USE_SUPERINSNS\nCPUFUNC(op_%lx_%d_fuse),\n#else\n", rep, disp_postfix[rep]);
+	    fprintf (dispfile, "%s(op_%lx_%d), /* %s */\n", disp_ff[rep] ? "CPUFUNC_FF" : "CPUFUNC",
+		     rep, disp_postfix[rep], get_instruction_string (rep));
+	    if (postfix == 0 && disp_fused[rep])
+		fprintf (dispfile, "#endif\n");
+	}
+	idx[opcode] = slot[rep];
+    }
+    fprintf (dispfile, "};\n");
+
+    fprintf (dispfile, "const uae_u16 op_dispatchidx_%d[65536] = {\n", postfix);
+    for (opcode = 0; opcode < 65536; opcode++)
+	fprintf (dispfile, "%d,%s", idx[opcode], (opcode & 15) == 15 ? "\n" : "");
+    fprintf (dispfile, "};\n\n");
+    disp_count[postfix] = count;
 }
 
 static void generate_func (void)
@@ -2474,6 +2742,8 @@ static void generate_func (void)
 	}
 	postfix = i;
 	fprintf (stblfile, "struct cputbl CPUFUNC(op_smalltbl_%d)[] = {\n", postfix);
+	for (j = 0; j < 65536; j++)
+	    disp_postfix[j] = -1;
 
 	/* Disable spurious warnings. */
 	printf ("\n"
@@ -2508,7 +2778,28 @@ static void generate_func (void)
 	}
 
 	fprintf (stblfile, "{ 0, 0, 0 }};\n");
+
+	if (cold_started) {
+	    printf ("#undef CPUOP_COLD_REGION\n#include \"cpuop_cold.h\"\n\n");
+	    cold_started = 0;
+	}
+
+	if (postfix == 0) {
+	    fprintf (stblfile, "#if USE_SUPERINSNS\n");
+	    fprintf (stblfile, "struct cputbl CPUFUNC(op_fusetbl_%d)[] = {\n", postfix);
+	    for (j = 0; j < nr_fused_ops; j++)
+		fprintf (stblfile, "{ CPUFUNC(op_%x_%d_fuse), 0, %d }, /* %s */\n", fused_ops[j], postfix,
+			 fused_ops[j], get_instruction_string (fused_ops[j]));
+	    fprintf (stblfile, "{ 0, 0, 0 }};\n");
+	    fprintf (stblfile, "#endif\n");
+	}
+	generate_dispatch ();
     }
+
+    fprintf (dispfile, "const struct cpudispatch CPUFUNC(op_dispatch)[] = {\n");
+    for (j = 0; j < i; j++)
+	fprintf (dispfile, "{ CPUFUNC(op_dispatchptr_%d), op_dispatchidx_%d, %d },\n", j, j, disp_count[j]);
+    fprintf (dispfile, "};\n");
 }
 
 int main (int argc, char **argv)
@@ -2521,7 +2812,11 @@ int main (int argc, char **argv)
     opcode_last_postfix = (int *) malloc (sizeof (int) * nr_cpuop_funcs);
     opcode_next_clev = (int *) malloc (sizeof (int) * nr_cpuop_funcs);
     counts = (unsigned long *) malloc (65536 * sizeof (unsigned long));
+    disp_postfix = (int *) malloc (65536 * sizeof (int));
+    disp_ff = (char *) calloc (65536, 1);
+    disp_fused = (char *) calloc (65536, 1);
     read_counts ();
+    select_hot_handlers ();
 
     /* It would be a lot nicer to put all in one file (we'd also get rid of
      * cputbl.h that way), but cpuopti can't cope.  That could be fixed, but
@@ -2529,16 +2824,21 @@ int main (int argc, char **argv)
 
     headerfile = fopen ("cputbl.h", "w");
     stblfile = fopen ("cpustbl.cpp", "w");
+    dispfile = fopen ("cpudispatch.cpp", "w");
     out = freopen ("cpuemu.cpp", "w", stdout);
 
     generate_includes (stdout);
     generate_includes (stblfile);
+    generate_includes (dispfile);
+    fprintf (dispfile, "#if USE_CONST_DISPATCH\n");
 
     generate_func ();
 
+    fprintf (dispfile, "#endif\n");
     free (table68k);
     fclose (headerfile);
     fclose (stblfile);
+    fclose (dispfile);
     fflush (out);
 
     /* For build systems (IDEs mainly) that don't make it easy to compile the
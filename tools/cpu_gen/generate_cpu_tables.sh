@@ -31,9 +31,19 @@ cc -I. -I"$OUTPUT_DIR" -o gencpu gencpu.c readcpu.cpp "$OUTPUT_DIR/cpudefs.cpp"
 echo "  Done."
 
 # Step 4: Generate CPU emulation files
+# A frequent.68k profile in the output directory (written to the SD card by a
+# COUNT_INSTRS=2 build) orders the handlers by use, restricts superinstructions
+# to handlers that ran, and marks the CPU_IRAM_HANDLERS (default 48) hottest
+# handlers for IRAM. The handlers it never saw are compiled for size, with
+# out of line memory accesses (COMPACT_COLD_HANDLERS, see cpuop_cold.h).
+# cpudispatch.cpp holds the compact handler index of each CPU level, which
+# USE_CONST_DISPATCH builds copy instead of building it from table68k.
 echo ""
 echo "Step 4: Generating CPU emulation files..."
 cd "$OUTPUT_DIR"
+if [ -f frequent.68k ]; then
+    echo "  Using instruction profile frequent.68k"
+fi
 "$SCRIPT_DIR/gencpu"
 echo "  Done."
 
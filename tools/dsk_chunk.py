@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""
+Convert disk and CD-ROM images to and from the chunked image format.
+
+Usage:
+    python3 tools/dsk_chunk.py pack Macintosh.dsk Macintosh-packed.dsk [--chunk-size 64]
+    python3 tools/dsk_chunk.py unpack Macintosh-packed.dsk Macintosh.dsk
+    python3 tools/dsk_chunk.py info Macintosh-packed.dsk
+
+A chunked image is split into fixed size chunks (64KB by default). Chunks
+that are all zeros are not stored, and the others are stored LZ4 compressed
+(or raw when that saves nothing). The emulator recognises a chunked image
+by its header, so the packed file keeps the .dsk/.img/.iso name of the
+original. Writes made by the emulator append raw copies of the chunks they
+change; packing the image again reclaims the space.
+
+Layout (little-endian, see sys_esp32.cpp):
+    header  magic "B2CI", version, chunk size, chunk count,
+            image size (u64), index offset (u64)
+    index   per chunk: data offset (u64), stored bytes (u32), type (u32)
+            type 0 = zero, 1 = raw, 2 = LZ4 block
+    data    chunks, each starting on a 64-byte boundary
+
+The lz4 module is used when it is installed (pip install lz4); otherwise a
+slower built-in compressor produces the same format.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x49433242          # "B2CI"
+VERSION = 1
+HEADER = struct.Struct('<IIIIQQ')
+ENTRY = struct.Struct('<QII')
+CHUNK_ZERO, CHUNK_RAW, CHUNK_LZ4 = 0, 1, 2
+DATA_ALIGN = 64             # DMA_ALIGN in sys_esp32.cpp
+MAX_CHUNK_SIZE = 1024 * 1024
+
+try:
+    import lz4.block
+
+    def lz4_compress(data):
+        return lz4.block.compress(data, store_size=False)
+except ImportError:
+    lz4 = None
+
+    def _write_length(out, n):
+        while n >= 255:
+            out.append(255)
+            n -= 255
+        out.append(n)
+
+    def _emit(out, literals, distance, match_length):
+        lit_len = len(literals)
+        extra = match_length - 4
+        out.append((min(lit_len, 15) << 4) | min(extra, 15))
+        if lit_len >= 15:
+            _write_length(out, lit_len - 15)
+        out += literals
+        out += struct.pack('<H', distance)
+        if extra >= 15:
+            _write_length(out, extra - 15)
+
+    def lz4_compress(data):
+        """Greedy LZ4 block compressor (last 5 bytes literal, no match in the last 12)."""
+        n = len(data)
+        out = bytearray()
+        table = {}
+        anchor = 0
+        i = 0
+        limit = n - 12
+        while i < limit:
+            key = data[i:i + 4]
+            candidate = table.get(key)
+            table[key] = i
+            if candidate is None or i - candidate > 65535:
+                i += 1
+                continue
+            length = 4
+            max_length = n - 5 - i
+            while length < max_length and data[candidate + length] == data[i + length]:
+                length += 1
+            _emit(out, data[anchor:i], i - candidate, length)
+            i += length
+            anchor = i
+        literals = data[anchor:]
+        out.append(min(len(literals), 15) << 4)
+        if len(literals) >= 15:
+            _write_length(out, len(literals) - 15)
+        out += literals
+        return bytes(out)
+
+
+def lz4_decompress(data, size):
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        token = data[i]
+        i += 1
+        length = token >> 4
+        if length == 15:
+            while True:
+                b = data[i]
+                i += 1
+                length += b
+                if b != 255:
+                    break
+        out += data[i:i + length]
+        i += length
+        if i >= n:
+            break
+        distance = data[i] | (data[i + 1] << 8)
+        i += 2
+        length = token & 15
+        if length == 15:
+            while True:
+                b = data[i]
+                i += 1
+                length += b
+                if b != 255:
+                    break
+        length += 4
+        start = len(out) - distance
+        for k in range(length):
+            out.append(out[start + k])
+    if len(out) != size:
+        raise ValueError('corrupt LZ4 chunk')
+    return bytes(out)
+
+
+def align(n):
+    return (n + DATA_ALIGN - 1) & ~(DATA_ALIGN - 1)
+
+
+def read_container(f):
+    header = f.read(HEADER.size)
+    if len(header) != HEADER.size:
+        return None
+    magic, version, chunk_size, chunk_count, image_size, index_offset = HEADER.unpack(header)
+    if magic != MAGIC:
+        return None
+    if version != VERSION:
+        sys.exit('unsupported chunked image version %d' % version)
+    f.seek(index_offset)
+    raw = f.read(chunk_count * ENTRY.size)
+    index = [ENTRY.unpack_from(raw, k * ENTRY.size) for k in range(chunk_count)]
+    return chunk_size, image_size, index
+
+
+def pack(src, dst, chunk_size):
+    image_size = os.path.getsize(src)
+    if image_size > 0x7fffffff:
+        sys.exit('images over 2GB are not supported')
+    chunk_count = (image_size + chunk_size - 1) // chunk_size
+    index_offset = align(HEADER.size)
+    data_offset = align(index_offset + chunk_count * ENTRY.size)
+    zero = bytes(chunk_size)
+    counts = [0, 0, 0]
+
+    with open(src, 'rb') as fin, open(dst, 'wb') as fout:
+        if read_container(fin) is not None:
+            sys.exit('%s is already a chunked image' % src)
+        fin.seek(0)
+        index = []
+        pos = data_offset
+        fout.seek(pos)
+        for n in range(chunk_count):
+            chunk = fin.read(chunk_size)
+            if len(chunk) < chunk_size:
+                chunk += bytes(chunk_size - len(chunk))
+            if chunk == zero:
+                index.append((0, 0, CHUNK_ZERO))
+                counts[CHUNK_ZERO] += 1
+                continue
+            packed = lz4_compress(chunk)
+            if len(packed) < chunk_size:
+                kind, data = CHUNK_LZ4, packed
+            else:
+                kind, data = CHUNK_RAW, chunk
+            index.append((pos, len(data), kind))
+            counts[kind] += 1
+            fout.write(data)
+            pos += len(data)
+            padding = align(pos) - pos
+            fout.write(bytes(padding))
+            pos += padding
+            if n % 256 == 0:
+                print('\r%d%%' % (n * 100 // chunk_count), end='', file=sys.stderr)
+
+        fout.seek(0)
+        fout.write(HEADER.pack(MAGIC, VERSION, chunk_size, chunk_count, image_size, index_offset))
+        fout.seek(index_offset)
+        for entry in index:
+            fout.write(ENTRY.pack(*entry))
+
+    print('\r%s: %d chunks of %dKB, %d zero, %d LZ4, %d raw, %dMB -> %dMB' % (
+        dst, chunk_count, chunk_size // 1024, counts[CHUNK_ZERO], counts[CHUNK_LZ4],
+        counts[CHUNK_RAW], image_size >> 20, os.path.getsize(dst) >> 20))
+
+
+def unpack(src, dst):
+    with open(src, 'rb') as fin:
+        container = read_container(fin)
+        if container is None:
+            sys.exit('%s is not a chunked image' % src)
+        chunk_size, image_size, index = container
+        with open(dst, 'wb') as fout:
+            for n, (offset, stored, kind) in enumerate(index):
+                if kind == CHUNK_ZERO:
+                    chunk = bytes(chunk_size)
+                else:
+                    fin.seek(offset)
+                    chunk = fin.read(stored)
+                    if kind == CHUNK_LZ4:
+                        chunk = lz4_decompress(chunk, chunk_size)
+                fout.write(chunk[:image_size - n * chunk_size])
+
+
+def info(src):
+    with open(src, 'rb') as fin:
+        container = read_container(fin)
+    if container is None:
+        sys.exit('%s is not a chunked image' % src)
+    chunk_size, image_size, index = container
+    counts = [0, 0, 0]
+    stored = 0
+    for offset, length, kind in index:
+        counts[kind] += 1
+        stored += length
+    print('%s: image %dMB, %d chunks of %dKB, %d zero, %d LZ4, %d raw, %dMB stored, file %dMB' % (
+        src, image_size >> 20, len(index), chunk_size // 1024, counts[CHUNK_ZERO], counts[CHUNK_LZ4],
+        counts[CHUNK_RAW], stored >> 20, os.path.getsize(src) >> 20))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Chunked disk image converter')
+    sub = parser.add_subparsers(dest='command', required=True)
+    p = sub.add_parser('pack', help='raw image to chunked image')
+    p.add_argument('src')
+    p.add_argument('dst')
+    p.add_argument('--chunk-size', type=int, default=64, help='chunk size in KB (power of two)')
+    p = sub.add_parser('unpack', help='chunked image to raw image')
+    p.add_argument('src')
+    p.add_argument('dst')
+    p = sub.add_parser('info', help='show the chunks of a chunked image')
+    p.add_argument('src')
+    args = parser.parse_args()
+
+    if args.command == 'pack':
+        chunk_size = args.chunk_size * 1024
+        if chunk_size > MAX_CHUNK_SIZE or chunk_size & (chunk_size - 1):
+            sys.exit('chunk size must be a power of two up to %dKB' % (MAX_CHUNK_SIZE // 1024))
+        pack(args.src, args.dst, chunk_size)
+    elif args.command == 'unpack':
+        unpack(args.src, args.dst)
+    else:
+        info(args.src)
+
+
+if __name__ == '__main__':
+    main()
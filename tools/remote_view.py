@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+"""
+Remote display viewer: show the Mac screen streamed over the USB port.
+
+Usage:
+    python3 tools/remote_view.py                    # Turn the stream on and show it
+    python3 tools/remote_view.py --port /dev/ttyACM0
+    python3 tools/remote_view.py --ppm screen.ppm   # Save each frame instead
+
+The firmware streams while the "remotedisplay" pref is set, or after
+"set remote 1" on the console, which the viewer sends unless --no-enable is
+given (see remote_esp32.cpp for the messages). The log and console text
+around the messages is printed as it comes. The window is redrawn at each
+FRAME message; closing it sends "set remote 0".
+
+The serial port is that of build_upload_monitor.py.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+
+import serial
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import build_upload_monitor as bum
+
+MAGIC = b'B2RD'
+HEADER = struct.Struct('<4sBBHI')
+MAX_PAYLOAD = 1 << 20       # Larger: not a header, resync
+
+MODE, PALETTE, RECT, FRAME = 1, 2, 3, 4
+
+
+def rgb565(c):
+    r, g, b = (c >> 11) & 31, (c >> 5) & 63, c & 31
+    return bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+
+
+def unpackbits(data, pos, size):
+    """Decode one PackBits row of size bytes at pos; returns (row, next pos)."""
+    out = bytearray()
+    while len(out) < size:
+        n = data[pos]
+        pos += 1
+        if n < 128:
+            out += data[pos:pos + n + 1]
+            pos += n + 1
+        elif n > 128:
+            out += bytes((data[pos],)) * (257 - n)
+            pos += 1
+    return bytes(out[:size]), pos
+
+
+class Screen:
+    """The Mac screen as 24-bit RGB, updated by the messages."""
+
+    def __init__(self):
+        self.width = self.height = 0
+        self.depth = 8
+        self.rgb = bytearray()
+        self.palette = [rgb565(i * 0x0841 & 0xffff) for i in range(256)]
+
+    def mode(self, payload):
+        self.width, self.height, self.depth = struct.unpack_from('<HHB', payload)
+        self.rgb = bytearray(self.width * self.height * 3)
+
+    def set_palette(self, payload):
+        self.palette = [rgb565(c) for c in struct.unpack_from('>256H', payload)]
+
+    def pixels(self, row, width):
+        """RGB bytes of one row in the stream's depth."""
+        if self.depth == 16:
+            colors = struct.unpack('>%dH' % width, row)
+            return b''.join(rgb565(c) for c in colors)
+        bits = self.depth
+        mask = (1 << bits) - 1
+        per_byte = 8 // bits
+        out = bytearray()
+        for x in range(width):
+            byte = row[x // per_byte]
+            shift = 8 - bits * (x % per_byte + 1)
+            out += self.palette[(byte >> shift) & mask]
+        return out
+
+    def rect(self, payload):
+        x, y, w, h = struct.unpack_from('<4H', payload)
+        if x + w > self.width or y + h > self.height:
+            return
+        row_bytes = w * self.depth // 8
+        pos = 8
+        for row in range(h):
+            data, pos = unpackbits(payload, pos, row_bytes)
+            start = ((y + row) * self.width + x) * 3
+            self.rgb[start:start + w * 3] = self.pixels(data, w)
+
+    def ppm(self):
+        return b'P6 %d %d 255\n' % (self.width, self.height) + bytes(self.rgb)
+
+
+class Stream:
+    """Messages from the port; the text between them goes to stdout."""
+
+    def __init__(self, ser):
+        self.ser = ser
+        self.buf = bytearray()
+
+    def messages(self):
+        chunk = self.ser.read(self.ser.in_waiting or 1)
+        self.buf += chunk
+        while True:
+            at = self.buf.find(MAGIC)
+            if at < 0:
+                # Keep a possible partial magic at the end
+                keep = len(MAGIC) - 1
+                self.text(self.buf[:-keep] if len(self.buf) > keep else b'')
+                del self.buf[:max(0, len(self.buf) - keep)]
+                return
+            self.text(self.buf[:at])
+            del self.buf[:at]
+            if len(self.buf) < HEADER.size:
+                return
+            _, kind, _, _, length = HEADER.unpack_from(self.buf)
+            if length > MAX_PAYLOAD:
+                del self.buf[:len(MAGIC)]
+                continue
+            if len(self.buf) < HEADER.size + length:
+                return
+            payload = bytes(self.buf[HEADER.size:HEADER.size + length])
+            del self.buf[:HEADER.size + length]
+            yield kind, payload
+
+    @staticmethod
+    def text(data):
+        if data:
+            sys.stdout.write(data.decode('utf-8', errors='replace'))
+            sys.stdout.flush()
+
+
+def dispatch(screen, kind, payload):
+    """Apply one message; True at the end of a frame."""
+    if kind == MODE:
+        screen.mode(payload)
+    elif kind == PALETTE:
+        screen.set_palette(payload)
+    elif kind == RECT:
+        screen.rect(payload)
+    elif kind == FRAME:
+        return screen.width > 0
+    return False
+
+
+def run_ppm(stream, screen, path):
+    while True:
+        for kind, payload in stream.messages():
+            if dispatch(screen, kind, payload):
+                with open(path + '.tmp', 'wb') as f:
+                    f.write(screen.ppm())
+                os.replace(path + '.tmp', path)
+
+
+def run_window(stream, screen, scale):
+    import tkinter as tk
+
+    root = tk.Tk()
+    root.title('BasiliskII remote display')
+    label = tk.Label(root)
+    label.pack()
+    state = {'image': None, 'open': True}
+
+    def poll():
+        shown = False
+        for kind, payload in stream.messages():
+            if dispatch(screen, kind, payload):
+                shown = True
+        if shown:
+            image = tk.PhotoImage(data=screen.ppm(), format='PPM')
+            if scale > 1:
+                image = image.zoom(scale)
+            label.configure(image=image)
+            state['image'] = image
+        if state['open']:
+            root.after(10, poll)
+
+    def close():
+        state['open'] = False
+        root.destroy()
+
+    root.protocol('WM_DELETE_WINDOW', close)
+    root.after(10, poll)
+    root.mainloop()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('--port', default=bum.SERIAL_PORT)
+    parser.add_argument('--baud', type=int, default=bum.BAUD_RATE)
+    parser.add_argument('--ppm', help='write each frame to this file instead of a window')
+    parser.add_argument('--scale', type=int, default=1, help='window zoom')
+    parser.add_argument('--no-enable', action='store_true', help="don't send 'set remote 1'")
+    args = parser.parse_args()
+
+    ser = serial.Serial(args.port, args.baud, timeout=0.05)
+    stream = Stream(ser)
+    screen = Screen()
+    if not args.no_enable:
+        # Off first, so that a stream already on starts over with the mode
+        ser.write(b'set remote 0\n')
+        time.sleep(0.3)
+        ser.write(b'set remote 1\n')
+    try:
+        if args.ppm:
+            run_ppm(stream, screen, args.ppm)
+        else:
+            run_window(stream, screen, args.scale)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if not args.no_enable:
+            ser.write(b'set remote 0\n')
+        ser.close()
+
+
+if __name__ == '__main__':
+    main()